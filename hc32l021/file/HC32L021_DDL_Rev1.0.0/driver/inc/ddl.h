@@ -49,6 +49,63 @@ extern "C" {
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup DDL_Global_Types DDL全局类型定义
+ * @{
+ */
+
+/**
+ * @brief  超时截止时间（由DDL_DeadlineInit()按微秒设定，与HCLK及编译优化无关；
+ *         或由DDL_DeadlineCountInit()按查询次数设定）
+ */
+typedef struct
+{
+    uint64_t  u64Expire; /*!< 到期时的时基计数 @ref DDL_TickGet() */
+    uint64_t  u64Last;   /*!< 上次查询时的时基计数，用于检测时基停止 */
+    uint32_t  u32Count;  /*!< 剩余查询次数：按次数计时，或时基停止时按次数兜底 */
+    boolean_t bCount;    /*!< TRUE: 仅按查询次数计时 */
+} stc_ddl_deadline_t;
+
+/**
+ * @brief  常数除法的倒数表示（由DDL_RecipInit()或DDL_RECIP_INIT()生成，DDL_RecipDiv()使用）
+ */
+typedef struct
+{
+    uint32_t u32Mul; /*!< 倒数：(2^32 - 1) / u32Div */
+    uint32_t u32Div; /*!< 除数 */
+} stc_ddl_recip_t;
+
+#if defined(DDL_MMIO_TRACE)
+/**
+ * @brief  寄存器访问跟踪：调用位置统计（按函数、行号及外设区分）
+ */
+typedef struct
+{
+    const char *pcFunc;       /*!< 调用函数名 */
+    const char *pcPeriph;     /*!< 外设名 */
+    uint32_t    u32Line;      /*!< 调用行号 */
+    uint32_t    u32Addr;      /*!< 首次访问的寄存器地址 */
+    uint32_t    u32Read;      /*!< 读访问次数（读-改-写计入读、写各一次） */
+    uint32_t    u32Write;     /*!< 写访问次数 */
+    uint32_t    u32FirstTick; /*!< 首次访问时间戳 */
+    uint32_t    u32LastTick;  /*!< 最近访问时间戳 */
+} stc_ddl_mmio_site_t;
+
+/**
+ * @brief  寄存器访问跟踪：单次访问记录
+ */
+typedef struct
+{
+    uint32_t u32Tick; /*!< 时间戳（HCLK周期） */
+    uint32_t u32Addr; /*!< 寄存器地址 */
+    uint16_t u16Site; /*!< 调用位置统计表索引 */
+    uint16_t u16Type; /*!< 访问类型 @ref DDL_MMIO_Trace */
+} stc_ddl_mmio_log_t;
+#endif /* DDL_MMIO_TRACE */
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
@@ -76,14 +133,78 @@ extern "C" {
  * @}
  */
 
+/**
+ * @defgroup DDL_Fixed_Point DDL定点数运算
+ * @brief    Q16.16格式：int32_t，低16位为小数；DDL_Q16()/DDL_RECIP_INIT()只用于常量，在编译时求值
+ * @{
+ */
+#define DDL_Q16_SHIFT       (16u)                                                /*!< Q16.16小数位数 */
+#define DDL_Q16_ONE         ((int32_t)0x00010000)                                /*!< Q16.16的1.0 */
+#define DDL_Q16_INT(x)      ((int32_t)((uint32_t)(int32_t)(x) << DDL_Q16_SHIFT)) /*!< 整数转换为Q16.16 */
+#define DDL_ROUND_SHR(x, n) (((x) + (1UL << ((n) - 1u))) >> (n))                 /*!< 无符号数右移n位（n>0）并四舍五入 */
+
+/* 常量转换为Q16.16（四舍五入） */
+#define DDL_Q16(x) ((int32_t)(((x) >= 0) ? (((x) * 65536.0) + 0.5) : (((x) * 65536.0) - 0.5)))
+/* 常数d（非0）的倒数初始化值 */
+#define DDL_RECIP_INIT(d) {(0xFFFFFFFFUL / (uint32_t)(d)), (uint32_t)(d)}
+/**
+ * @}
+ */
+
 /**
  * @defgroup DDL_Register_Func DDL寄存器操作函数
  * @{
  */
-#define RW_MEM8(addr)                      (*(volatile uint8_t *)(addr))
-#define RW_MEM16(addr)                     (*(volatile uint16_t *)(addr))
-#define RW_MEM32(addr)                     (*(volatile uint32_t *)(addr))
+#define RW_MEM8(addr)                      (*(volatile uint8_t *)DDL_MEM_MAP(addr))
+#define RW_MEM16(addr)                     (*(volatile uint16_t *)DDL_MEM_MAP(addr))
+#define RW_MEM32(addr)                     (*(volatile uint32_t *)DDL_MEM_MAP(addr))
+
+#if defined(DDL_MMIO_TRACE)
+/* 访问跟踪模式：每次寄存器访问先经DDL_MmioTrace()按外设及调用位置计数、打时间戳 */
+#define DDL_MMIO_AT(REG, TYPE)             DDL_MmioTrace((const volatile void *)&(REG), (TYPE), __func__, (uint32_t)__LINE__)
+
+#define SET_REG_BIT(REG, BIT)              (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) |= (BIT)))
+#define SET_REG8_BIT(REG, BIT)             (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) |= ((uint8_t)(BIT))))
+#define SET_REG16_BIT(REG, BIT)            (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) |= ((uint16_t)(BIT))))
+#define SET_REG32_BIT(REG, BIT)            (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) |= ((uint32_t)(BIT))))
+
+#define CLR_REG_BIT(REG, BIT)              (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) &= (~(BIT))))
+#define CLR_REG8_BIT(REG, BIT)             (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) &= ((uint8_t)(~((uint8_t)(BIT))))))
+#define CLR_REG16_BIT(REG, BIT)            (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) &= ((uint16_t)(~((uint16_t)(BIT))))))
+#define CLR_REG32_BIT(REG, BIT)            (DDL_MMIO_AT((REG), DDL_MMIO_RMW), ((REG) &= ((uint32_t)(~((uint32_t)(BIT))))))
+
+#define READ_REG_BIT(REG, BIT)             (DDL_MMIO_AT((REG), DDL_MMIO_RD), ((REG) & (BIT)))
+#define READ_REG8_BIT(REG, BIT)            (DDL_MMIO_AT((REG), DDL_MMIO_RD), ((REG) & ((uint8_t)(BIT))))
+#define READ_REG16_BIT(REG, BIT)           (DDL_MMIO_AT((REG), DDL_MMIO_RD), ((REG) & ((uint16_t)(BIT))))
+#define READ_REG32_BIT(REG, BIT)           (DDL_MMIO_AT((REG), DDL_MMIO_RD), ((REG) & ((uint32_t)(BIT))))
+
+#define CLR_REG(REG)                       (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = (0U)))
+#define CLR_REG8(REG)                      (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint8_t)(0U))))
+#define CLR_REG16(REG)                     (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint16_t)(0U))))
+#define CLR_REG32(REG)                     (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint32_t)(0UL))))
+
+#define WRITE_REG(REG, VAL)                (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = (VAL)))
+#define WRITE_REG8(REG, VAL)               (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint8_t)(VAL))))
+#define WRITE_REG16(REG, VAL)              (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint16_t)(VAL))))
+#define WRITE_REG32(REG, VAL)              (DDL_MMIO_AT((REG), DDL_MMIO_WR), ((REG) = ((uint32_t)(VAL))))
 
+#define READ_REG(REG)                      (DDL_MMIO_AT((REG), DDL_MMIO_RD), (REG))
+#define READ_REG8(REG)                     (DDL_MMIO_AT((REG), DDL_MMIO_RD), (REG))
+#define READ_REG16(REG)                    (DDL_MMIO_AT((REG), DDL_MMIO_RD), (REG))
+#define READ_REG32(REG)                    (DDL_MMIO_AT((REG), DDL_MMIO_RD), (REG))
+
+#define MODIFY_REG(REGS, CLRMASK, SETMASK) \
+    (DDL_MMIO_AT((REGS), DDL_MMIO_RMW), ((REGS) = (((REGS) & (~(CLRMASK))) | ((SETMASK) & (CLRMASK)))))
+#define MODIFY_REG8(REGS, CLRMASK, SETMASK) \
+    (DDL_MMIO_AT((REGS), DDL_MMIO_RMW),     \
+     ((REGS) = (uint8_t)(((REGS) & ((uint8_t)(~((uint8_t)(CLRMASK))))) | ((uint8_t)(SETMASK) & (uint8_t)(CLRMASK)))))
+#define MODIFY_REG16(REGS, CLRMASK, SETMASK) \
+    (DDL_MMIO_AT((REGS), DDL_MMIO_RMW),      \
+     ((REGS) = (uint16_t)(((REGS) & ((uint16_t)(~((uint16_t)(CLRMASK))))) | ((uint16_t)(SETMASK) & (uint16_t)(CLRMASK)))))
+#define MODIFY_REG32(REGS, CLRMASK, SETMASK) \
+    (DDL_MMIO_AT((REGS), DDL_MMIO_RMW),      \
+     ((REGS) = (uint32_t)(((REGS) & ((uint32_t)(~((uint32_t)(CLRMASK))))) | ((uint32_t)(SETMASK) & (uint32_t)(CLRMASK)))))
+#else
 #define SET_REG_BIT(REG, BIT)              ((REG) |= (BIT))
 #define SET_REG8_BIT(REG, BIT)             ((REG) |= ((uint8_t)(BIT)))
 #define SET_REG16_BIT(REG, BIT)            ((REG) |= ((uint16_t)(BIT)))
@@ -121,6 +242,45 @@ extern "C" {
     (WRITE_REG16((REGS), (((READ_REG16((REGS))) & ((uint16_t)(~((uint16_t)(CLRMASK))))) | ((uint16_t)(SETMASK) & (uint16_t)(CLRMASK)))))
 #define MODIFY_REG32(REGS, CLRMASK, SETMASK) \
     (WRITE_REG32((REGS), (((READ_REG32((REGS))) & ((uint32_t)(~((uint32_t)(CLRMASK))))) | ((uint32_t)(SETMASK) & (uint32_t)(CLRMASK)))))
+#endif /* DDL_MMIO_TRACE */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DDL_Timeout DDL超时时间
+ * @{
+ */
+#define DDL_TIMEOUT_FOREVER (0xFFFFFFFFu) /*!< 超时时间（us）取此值时永不超时 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DDL_Delay_Mode DDL延时模式
+ * @{
+ */
+#define DDL_DELAY_MD_BUSY  (0u) /*!< 忙等：延时期间持续查询时基（默认） */
+#define DDL_DELAY_MD_SLEEP (1u) /*!< 休眠：延时期间进入普通休眠（WFI），由SysTick溢出中断唤醒 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DDL_MMIO_Trace DDL寄存器访问跟踪
+ * @brief    编译时定义DDL_MMIO_TRACE后，上述寄存器操作宏经DDL_MmioTrace()记录访问
+ * @{
+ */
+#define DDL_MMIO_RD  (0x1u)                      /*!< 读访问 */
+#define DDL_MMIO_WR  (0x2u)                      /*!< 写访问 */
+#define DDL_MMIO_RMW (DDL_MMIO_RD | DDL_MMIO_WR) /*!< 读-改-写 */
+
+#ifndef DDL_MMIO_TRACE_SITE_NUM
+#define DDL_MMIO_TRACE_SITE_NUM (64u) /*!< 调用位置统计表容量（2的幂） */
+#endif
+#ifndef DDL_MMIO_TRACE_LOG_DEPTH
+#define DDL_MMIO_TRACE_LOG_DEPTH (32u) /*!< 最近访问记录深度（2的幂） */
+#endif
 /**
  * @}
  */
@@ -151,11 +311,47 @@ extern "C" {
  */
 uint32_t Log2(uint32_t u32Value);
 
-void DDL_MemoryClear(void *pu8StartAddr, uint32_t u32Count); /* Memory清零*/
+void    DDL_MemoryClear(void *pu8StartAddr, uint32_t u32Count);                      /* Memory清零*/
+void    DDL_MemorySet(void *pvDst, uint8_t u8Value, uint32_t u32Count);              /* Memory填充 */
+void    DDL_MemoryCopy(void *pvDst, const void *pvSrc, uint32_t u32Count);           /* Memory复制 */
+int32_t DDL_MemoryCompare(const void *pvBuf1, const void *pvBuf2, uint32_t u32Count); /* Memory比较 */
+
+int32_t  DDL_SatAdd(int32_t i32A, int32_t i32B);                             /* 饱和加法 */
+int32_t  DDL_SatSub(int32_t i32A, int32_t i32B);                             /* 饱和减法 */
+int32_t  DDL_Q16Mul(int32_t i32A, int32_t i32B);                             /* Q16.16乘法（四舍五入、饱和） */
+int32_t  DDL_Q16Div(int32_t i32A, int32_t i32B);                             /* Q16.16除法（四舍五入、饱和） */
+int32_t  DDL_Q16Round(int32_t i32A);                                         /* Q16.16四舍五入取整 */
+uint32_t DDL_UDivRound(uint32_t u32Num, uint32_t u32Den);                    /* 无符号除法四舍五入 */
+void     DDL_RecipInit(stc_ddl_recip_t *pstcRecip, uint32_t u32Div);         /* 常数除法倒数计算 */
+uint32_t DDL_RecipDiv(uint32_t u32Num, const stc_ddl_recip_t *pstcRecip);    /* 倒数乘法实现的除法（结果精确） */
+
+en_result_t DDL_TickInit(uint32_t u32Period); /* SysTick时基初始化 */
+void        DDL_TickIrqHandler(void);         /* SysTick溢出处理 */
+uint64_t    DDL_TickGet(void);                /* 64位时基计数（HCLK周期） */
+uint64_t    DDL_TimeUsGet(void);              /* 64位微秒时间 */
+uint64_t    DDL_TickToUs(uint64_t u64Tick);   /* 时基计数换算为微秒 */
+uint64_t    DDL_UsToTick(uint64_t u64Us);     /* 微秒换算为时基计数 */
+
+void      DDL_DeadlineInit(stc_ddl_deadline_t *pstcDeadline, uint32_t u32TimeoutUs);  /* 设定超时截止时间 */
+void      DDL_DeadlineCountInit(stc_ddl_deadline_t *pstcDeadline, uint32_t u32Count); /* 按查询次数设定超时 */
+boolean_t DDL_DeadlineExpired(stc_ddl_deadline_t *pstcDeadline);                      /* 是否已超时 */
+
+en_result_t DDL_DelayModeSet(uint32_t u32Mode); /* 延时模式设置 */
+uint32_t    DDL_DelayModeGet(void);             /* 延时模式获取 */
 
 void DDL_Delay1ms(uint32_t u32Count);   /* 1ms延时函数 */
 void DDL_Delay100us(uint32_t u32Count); /* 100us延时函数 */
 void DDL_Delay10us(uint32_t u32Count);  /* 1ous延时函数 */
+
+#if defined(DDL_MMIO_TRACE)
+void     DDL_MmioTrace(const volatile void *pvReg, uint32_t u32Type, const char *pcFunc, uint32_t u32Line); /* 记录一次寄存器访问 */
+uint32_t DDL_MmioTickGet(void);                                                                       /* 跟踪时间戳 */
+void     DDL_MmioTraceCmd(boolean_t bEnable);                                                        /* 跟踪使能/暂停 */
+void     DDL_MmioTraceClear(void);                                                                    /* 跟踪统计清零 */
+uint32_t DDL_MmioSiteGet(const stc_ddl_mmio_site_t **ppstcSite);                                     /* 调用位置统计表 */
+uint32_t DDL_MmioLogGet(stc_ddl_mmio_log_t *pstcLog, uint32_t u32Max);                                /* 最近访问记录 */
+void     DDL_MmioReport(void);                                                                        /* 输出访问统计报告 */
+#endif /* DDL_MMIO_TRACE */
 /**
  * @}
  */
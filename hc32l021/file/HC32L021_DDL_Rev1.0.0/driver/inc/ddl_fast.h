@@ -0,0 +1,310 @@
+/**
+ *******************************************************************************
+ * @file  ddl_fast.h
+ * @brief This file contains the static inline versions of the single register
+ *        access functions of the drivers (opt-in fast path)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __DDL_FAST_H__
+#define __DDL_FAST_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "adc.h"
+#include "btim.h"
+#include "gpio.h"
+#include "gtim.h"
+#include "iwdt.h"
+#include "lpuart.h"
+#include "spi.h"
+#include "trng.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_FAST 单寄存器访问函数内联版本
+ * @brief 用户源文件在驱动头文件之后包含本文件（驱动源文件不包含），下列函数的调用
+ *        即展开为内联的寄存器访问，不再有函数调用及现场保存的开销；函数名加括号调用
+ *        或取函数地址时仍使用驱动库中的函数，驱动库本身不变
+ * @note  传入常量外设实例（如BTIM0）时寄存器地址在编译时确定
+ * @{
+ */
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DDL_FAST_Redirect 驱动函数调用重定向至内联版本
+ * @{
+ */
+#define BTIM_CounterSet(BTIMx, u16CountValue)         BTIM_CounterSetFast((BTIMx), (u16CountValue))
+#define BTIM_CounterGet(BTIMx)                        BTIM_CounterGetFast(BTIMx)
+#define BTIM_IntFlagGet(BTIMx, u32IntFlag)            BTIM_IntFlagGetFast((BTIMx), (u32IntFlag))
+#define BTIM_IntFlagClear(BTIMx, u32IntClearFlag)     BTIM_IntFlagClearFast((BTIMx), (u32IntClearFlag))
+#define GTIM_CounterSet(GTIMx, u16CountValue)         GTIM_CounterSetFast((GTIMx), (u16CountValue))
+#define GTIM_CounterGet(GTIMx)                        GTIM_CounterGetFast(GTIMx)
+#define GTIM_IntFlagGet(GTIMx, u32IntFlagTypes)       GTIM_IntFlagGetFast((GTIMx), (u32IntFlagTypes))
+#define GTIM_IntFlagClear(GTIMx, u32IntClearFlag)     GTIM_IntFlagClearFast((GTIMx), (u32IntClearFlag))
+#define SPI_DataTransmit(SPIx, u16Data)               SPI_DataTransmitFast((SPIx), (u16Data))
+#define SPI_DataReceive(SPIx)                         SPI_DataReceiveFast(SPIx)
+#define SPI_FlagGet(SPIx, u32Flag)                    SPI_FlagGetFast((SPIx), (u32Flag))
+#define SPI_FlagClear(SPIx, u32Flag)                  SPI_FlagClearFast((SPIx), (u32Flag))
+#define LPUART_ReceiveInt(LPUARTx)                    LPUART_ReceiveIntFast(LPUARTx)
+#define LPUART_IntFlagGet(LPUARTx, u32IntFlag)        LPUART_IntFlagGetFast((LPUARTx), (u32IntFlag))
+#define LPUART_IntFlagClear(LPUARTx, u32IntFlag)      LPUART_IntFlagClearFast((LPUARTx), (u32IntFlag))
+#define ADC_SqrResultGet(u32AdcSqrChMux)              ADC_SqrResultGetFast(u32AdcSqrChMux)
+#define ADC_IntFlagGet(u32AdcInt)                     ADC_IntFlagGetFast(u32AdcInt)
+#define ADC_IntFlagClear(u32AdcInt)                   ADC_IntFlagClearFast(u32AdcInt)
+#define TRNG_Data0Get()                               TRNG_Data0GetFast()
+#define TRNG_Data1Get()                               TRNG_Data1GetFast()
+#define IWDT_Feed()                                   IWDT_FeedFast()
+#define GPIO_IntFlagGet(GPIOx, u32Pin)                GPIO_IntFlagGetFast((GPIOx), (u32Pin))
+#define GPIO_IntFlagClear(GPIOx, u32Pin)              GPIO_IntFlagClearFast((GPIOx), (u32Pin))
+/**
+ * @}
+ */
+
+#define DDL_FAST_IWDT_KEY_RELOAD (0xAAAAu) /*!< 重载IWDT计数器（与iwdt.c一致） */
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DDL_FAST_Global_Functions 内联函数定义（与同名驱动函数功能一致）
+ * @{
+ */
+/**
+ * @brief  BTIM 计数值设置 @ref BTIM_CounterSet()
+ */
+__STATIC_INLINE void BTIM_CounterSetFast(BTIM_TypeDef *BTIMx, uint16_t u16CountValue)
+{
+    WRITE_REG32(BTIMx->CNT, (uint32_t)u16CountValue);
+}
+
+/**
+ * @brief  BTIM 计数值获取 @ref BTIM_CounterGet()
+ */
+__STATIC_INLINE uint32_t BTIM_CounterGetFast(BTIM_TypeDef *BTIMx)
+{
+    return READ_REG32_BIT(BTIMx->CNT, BTIM_CNT_CNT_Msk);
+}
+
+/**
+ * @brief  BTIM 中断标志获取 @ref BTIM_IntFlagGet()
+ */
+__STATIC_INLINE boolean_t BTIM_IntFlagGetFast(BTIM_TypeDef *BTIMx, uint32_t u32IntFlag)
+{
+    return READ_REG32_BIT(BTIMx->IFR, u32IntFlag) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  BTIM 中断标志清除 @ref BTIM_IntFlagClear()
+ */
+__STATIC_INLINE void BTIM_IntFlagClearFast(BTIM_TypeDef *BTIMx, uint32_t u32IntClearFlag)
+{
+    CLR_REG32_BIT(BTIMx->ICR, u32IntClearFlag);
+}
+
+/**
+ * @brief  GTIM 计数值设置 @ref GTIM_CounterSet()
+ */
+__STATIC_INLINE void GTIM_CounterSetFast(GTIM_TypeDef *GTIMx, uint16_t u16CountValue)
+{
+    WRITE_REG32(GTIMx->CNT, (uint32_t)u16CountValue);
+}
+
+/**
+ * @brief  GTIM 计数值获取 @ref GTIM_CounterGet()
+ */
+__STATIC_INLINE uint32_t GTIM_CounterGetFast(GTIM_TypeDef *GTIMx)
+{
+    return READ_REG32_BIT(GTIMx->CNT, GTIM_CNT_CNT_Msk);
+}
+
+/**
+ * @brief  GTIM 中断标志获取 @ref GTIM_IntFlagGet()
+ */
+__STATIC_INLINE boolean_t GTIM_IntFlagGetFast(GTIM_TypeDef *GTIMx, uint32_t u32IntFlagTypes)
+{
+    return (READ_REG32_BIT(GTIMx->IFR, u32IntFlagTypes) == u32IntFlagTypes) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  GTIM 中断标志清除 @ref GTIM_IntFlagClear()
+ */
+__STATIC_INLINE void GTIM_IntFlagClearFast(GTIM_TypeDef *GTIMx, uint32_t u32IntClearFlag)
+{
+    CLR_REG32_BIT(GTIMx->ICR, u32IntClearFlag);
+}
+
+/**
+ * @brief  SPI 数据写入发送缓冲 @ref SPI_DataTransmit()
+ */
+__STATIC_INLINE en_result_t SPI_DataTransmitFast(SPI_TypeDef *SPIx, uint16_t u16Data)
+{
+    SPIx->DR = u16Data;
+
+    return Ok;
+}
+
+/**
+ * @brief  SPI 读取接收缓冲 @ref SPI_DataReceive()
+ */
+__STATIC_INLINE uint16_t SPI_DataReceiveFast(SPI_TypeDef *SPIx)
+{
+    return (uint16_t)SPIx->DR;
+}
+
+/**
+ * @brief  SPI 状态标志获取 @ref SPI_FlagGet()
+ */
+__STATIC_INLINE boolean_t SPI_FlagGetFast(SPI_TypeDef *SPIx, uint32_t u32Flag)
+{
+    return READ_REG_BIT(SPIx->SR, u32Flag) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  SPI 状态标志清除 @ref SPI_FlagClear()
+ */
+__STATIC_INLINE void SPI_FlagClearFast(SPI_TypeDef *SPIx, uint32_t u32Flag)
+{
+    CLR_REG_BIT(SPIx->ICR, u32Flag);
+}
+
+/**
+ * @brief  LPUART 读取接收数据 @ref LPUART_ReceiveInt()
+ */
+__STATIC_INLINE uint8_t LPUART_ReceiveIntFast(LPUART_TypeDef *LPUARTx)
+{
+    return (uint8_t)(READ_REG32_BIT(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk));
+}
+
+/**
+ * @brief  LPUART 中断标志获取 @ref LPUART_IntFlagGet()
+ */
+__STATIC_INLINE boolean_t LPUART_IntFlagGetFast(LPUART_TypeDef *LPUARTx, uint32_t u32IntFlag)
+{
+    return READ_REG32_BIT(LPUARTx->ISR, u32IntFlag) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  LPUART 中断标志清除 @ref LPUART_IntFlagClear()
+ */
+__STATIC_INLINE void LPUART_IntFlagClearFast(LPUART_TypeDef *LPUARTx, uint32_t u32IntFlag)
+{
+    CLR_REG32_BIT(LPUARTx->ICR, u32IntFlag);
+}
+
+/**
+ * @brief  ADC 顺序扫描转换结果获取 @ref ADC_SqrResultGet()
+ */
+__STATIC_INLINE uint32_t ADC_SqrResultGetFast(uint32_t u32AdcSqrChMux)
+{
+    volatile uint32_t *BaseSqrResultAddress = &(ADC->SQRRESULT0);
+
+    return *(BaseSqrResultAddress + ((uint32_t)u32AdcSqrChMux));
+}
+
+/**
+ * @brief  ADC 中断标志获取 @ref ADC_IntFlagGet()
+ */
+__STATIC_INLINE boolean_t ADC_IntFlagGetFast(uint32_t u32AdcInt)
+{
+    return READ_REG32_BIT(ADC->IFR, u32AdcInt) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  ADC 中断标志清除 @ref ADC_IntFlagClear()
+ */
+__STATIC_INLINE void ADC_IntFlagClearFast(uint32_t u32AdcInt)
+{
+    CLR_REG32_BIT(ADC->ICR, u32AdcInt);
+}
+
+/**
+ * @brief  TRNG 低32bits随机数获取 @ref TRNG_Data0Get()
+ */
+__STATIC_INLINE uint32_t TRNG_Data0GetFast(void)
+{
+    return TRNG->DATA0;
+}
+
+/**
+ * @brief  TRNG 高32bits随机数获取 @ref TRNG_Data1Get()
+ */
+__STATIC_INLINE uint32_t TRNG_Data1GetFast(void)
+{
+    return TRNG->DATA1;
+}
+
+/**
+ * @brief  IWDT 喂狗 @ref IWDT_Feed()
+ */
+__STATIC_INLINE void IWDT_FeedFast(void)
+{
+    WRITE_REG32(IWDT->KR, DDL_FAST_IWDT_KEY_RELOAD);
+}
+
+/**
+ * @brief  GPIO 中断标志获取 @ref GPIO_IntFlagGet()
+ */
+__STATIC_INLINE boolean_t GPIO_IntFlagGetFast(GPIO_TypeDef *GPIOx, uint32_t u32Pin)
+{
+    return READ_REG_BIT(GPIOx->STAT, u32Pin) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  GPIO 中断标志清除 @ref GPIO_IntFlagClear()
+ */
+__STATIC_INLINE void GPIO_IntFlagClearFast(GPIO_TypeDef *GPIOx, uint32_t u32Pin)
+{
+    CLR_REG_BIT(GPIOx->ICLR, u32Pin);
+}
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DDL_FAST_H__ */
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,145 @@
+/**
+ *******************************************************************************
+ * @file  ddl_log.h
+ * @brief This file contains all the functions prototypes of the deferred
+ *        binary log (format ID + raw arguments, encoded and sent off the
+ *        critical path, decoded on the host)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __DDL_LOG_H__
+#define __DDL_LOG_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_LOG 延迟二进制日志
+ * @brief 日志调用只把格式ID及32位参数写入RAM环形缓冲（关中断写入几个字），格式化推迟到主机：
+ *        DDL_LogRead()在空闲时或发送中断中取出记录并编码为字节流（LEB128变长整数，SLIP分帧），
+ *        主机由同一份格式字符串表还原文本（主机解码程序见example/lpuart/lpuart_log_deferred/decoder，
+ *        不属于驱动库）。格式字符串表由应用以X宏定义：
+ * @code
+ *        #define LOG_FMT_TABLE(X)                      \
+ *            X(LOG_BOOT, "boot, hclk=%u Hz")           \
+ *            X(LOG_ADC,  "adc ch%u = %u mV")
+ *
+ *        typedef enum { LOG_FMT_TABLE(DDL_LOG_FMT_ID) LOG_FMT_NUM } en_log_fmt_id_t;
+ *        static const char *const apcLogFmt[] = { LOG_FMT_TABLE(DDL_LOG_FMT_STR) };
+ *
+ *        DDL_LOG2(LOG_ADC, u32Ch, u32Mv);
+ * @endcode
+ *        目标板只引用枚举ID，apcLogFmt[]只在主机解码程序中定义，格式字符串不进入FLASH
+ * @{
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DDL_LOG_Global_Macros DDL_LOG全局宏定义
+ * @{
+ */
+#define DDL_LOG_ARG_MAX (4u)      /*!< 每条记录的参数个数上限 */
+#define DDL_LOG_ID_MAX  (0xFFFEu) /*!< 格式ID上限 */
+#define DDL_LOG_ID_DROP (0xFFFFu) /*!< 内部记录：缓冲满丢弃的记录数（参数1个） */
+
+#define DDL_LOG_REC_MAX (3u + (5u * DDL_LOG_ARG_MAX)) /*!< 一条记录的最大长度（变长整数，未转义） */
+#define DDL_LOG_ENC_MAX ((2u * DDL_LOG_REC_MAX) + 1u) /*!< 一条记录编码后的最大长度（含转义及帧结束符） */
+
+/**
+ * @defgroup DDL_LOG_Fmt_Table 格式字符串表展开
+ * @{
+ */
+#define DDL_LOG_FMT_ID(id, fmt)  id,  /*!< 展开为枚举成员 */
+#define DDL_LOG_FMT_STR(id, fmt) fmt, /*!< 展开为格式字符串 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DDL_LOG_Write 日志记录
+ * @note   参数均按32位整数保存，解码支持%d %i %u %x %X %o %c %p（可带标志、宽度、精度），
+ *         不支持%s及浮点（字符串以ID传递，小数以定点数传递）
+ * @{
+ */
+#define DDL_LOG0(id)             DDL_LogWrite((id), 0u, 0u, 0u, 0u, 0u)
+#define DDL_LOG1(id, a)          DDL_LogWrite((id), 1u, (uint32_t)(a), 0u, 0u, 0u)
+#define DDL_LOG2(id, a, b)       DDL_LogWrite((id), 2u, (uint32_t)(a), (uint32_t)(b), 0u, 0u)
+#define DDL_LOG3(id, a, b, c)    DDL_LogWrite((id), 3u, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0u)
+#define DDL_LOG4(id, a, b, c, d) DDL_LogWrite((id), 4u, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DDL_LOG_Global_Functions DDL_LOG全局函数定义
+ * @{
+ */
+en_result_t DDL_LogInit(uint32_t *pu32Buf, uint32_t u32Size); /* 日志缓冲初始化 */
+void        DDL_LogWrite(uint32_t u32Id, uint32_t u32Argc, uint32_t u32Arg0, uint32_t u32Arg1, uint32_t u32Arg2,
+                         uint32_t u32Arg3);                   /* 写入一条记录（线程及中断中均可调用） */
+uint32_t    DDL_LogRead(uint8_t *pu8Buf, uint32_t u32Size);   /* 取出编码后的字节流（不等待） */
+uint32_t    DDL_LogPendingGet(void);                          /* 缓冲中待取出的字数 */
+uint32_t    DDL_LogDropCountGet(void);                        /* 缓冲满丢弃的记录总数 */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DDL_LOG_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -138,6 +138,8 @@ extern "C" {
 #define RAMFUNC __attribute__((section(".ramfunc")))
 #elif defined(__ICCARM__)
 #define RAMFUNC __ramfunc
+#else
+#define RAMFUNC
 #endif
 en_result_t FLASH_OperateModeConfig(uint32_t u32FlashOperateMode);                      /* FLASH操作模式配置 */
 en_result_t FLASH_SectorErase(uint32_t u32SectorAddr);                                  /* FLASH扇区擦除 */
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-18       MADS            First version
+   2026-10-18       MADS            Add microsecond *TimeoutUs poll transfer variants
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -506,10 +507,12 @@ en_result_t HSI2C_MasterInit(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_init_t *pst
 en_result_t HSI2C_MasterBaudRateSet(HSI2C_TypeDef *HSI2Cx, const stc_hsi2c_master_init_t *pstcHsi2cInit, uint32_t u32SrcClockHz); /* 主机波特率设置 */
 en_result_t HSI2C_MasterTransferInt(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size);                                   /* 主机中断传输设置 */
 en_result_t HSI2C_MasterTransferPoll(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32Timeout);             /* 主机轮询传输 */
+en_result_t HSI2C_MasterTransferPollTimeoutUs(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeoutUs);  /* 主机轮询传输（微秒超时） */
 
-void        HSI2C_SlaveInit(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_slave_init_t *pstcHsi2cInit, uint32_t u32SrcClockHz);   /* 从机初始化 */
-en_result_t HSI2C_SlaveTransferInt(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size);                       /* 从机中断传输设置 */
-en_result_t HSI2C_SlaveTransferPoll(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32Timeout); /* 从机轮询传输 */
+void        HSI2C_SlaveInit(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_slave_init_t *pstcHsi2cInit, uint32_t u32SrcClockHz);               /* 从机初始化 */
+en_result_t HSI2C_SlaveTransferInt(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size);                                   /* 从机中断传输设置 */
+en_result_t HSI2C_SlaveTransferPoll(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32Timeout);             /* 从机轮询传输 */
+en_result_t HSI2C_SlaveTransferPollTimeoutUs(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeoutUs);  /* 从机轮询传输（微秒超时） */
 
 void HSI2C_MasterMcfgr1Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config1_t *pstcHsi2cConfig); /* 主机配置寄存器1设置(MCFGR1寄存器设置) */
 void HSI2C_MasterMcfgr2Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config2_t *pstcHsi2cConfig); /* 主机配置寄存器2设置(MCFGR2寄存器设置) */
@@ -7,6 +7,17 @@
    Change Logs:
    Date             Author          Notes
    2024-09-18       MADS            First version
+   2026-10-18       MADS            Add interrupt driven ring buffer transfer
+   2026-10-18       MADS            Add integer baud rate solver
+   2026-10-18       MADS            Add XTL BSEL/MODU baud rate generator
+   2026-10-18       MADS            Add inter-frame gap framing with BTIM one-shot
+   2026-10-18       MADS            Add address-filtered multidrop node stack
+   2026-10-18       MADS            Add auto-baud detection with ATIM3 PWC on RXD
+   2026-10-18       MADS            Add interrupt-driven single-wire half-duplex transaction engine
+   2026-10-18       MADS            Add deep sleep receive with batched wakeup
+   2026-10-18       MADS            Add microsecond *TimeOutUs poll transfer variants
+   2026-10-18       MADS            Add timeout parameter to LPUART_NodeSend()
+   2026-10-18       MADS            Save ATIM3_C0A input selection in stc_lpuart_autobaud_t
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -59,6 +70,28 @@ typedef struct
     uint32_t u32Baud;       /*!< 波特率 */
 } stc_lpuart_baud_t;
 
+/**
+ * @brief  LPUART波特率配置（OVER与SCNT）及误差
+ */
+typedef struct
+{
+    uint32_t u32Over;   /*!< 过采样分频 @ref LPUART_Over_Select */
+    uint32_t u32Scnt;   /*!< SCNT */
+    uint32_t u32Baud;   /*!< 实际波特率 */
+    int32_t  i32ErrPpm; /*!< 波特率误差（实际-目标）/目标，单位ppm */
+} stc_lpuart_baud_cfg_t;
+
+/**
+ * @brief  LPUART XTL调制波特率配置（BSEL与MODU）及误差
+ */
+typedef struct
+{
+    uint32_t u32Bsel;       /*!< 时钟基数 @ref LPUART_XTL_32768_Baud_Select */
+    uint32_t u32Modu;       /*!< 调制位：第i位为1时帧中第i位（起始位为第0位）加1个XTL时钟 */
+    int32_t  i32ErrPpm;     /*!< 12位平均波特率误差（实际-目标）/目标，单位ppm */
+    uint16_t u16EdgeErrPml; /*!< 帧内各位边沿与理想位置的最大偏差，单位0.1%位时间 */
+} stc_lpuart_xtl_baud_t;
+
 /**
  * @brief  LPUART LPUART初始化配置结构体
  */
@@ -72,6 +105,241 @@ typedef struct
     stc_lpuart_baud_t stcBaudRate;    /*!< 波特率配置 */
 } stc_lpuart_init_t;
 
+/**
+ * @brief  LPUART中断环形缓冲收发控制块（由调用者分配，使用期间不可释放）
+ * @note   发送缓冲由线程写入、中断取出，接收缓冲由中断写入、线程取出；每个索引只由一方修改，
+ *         线程与中断之间无需关中断。索引自由递增，按缓冲长度（2的幂）取模
+ */
+typedef struct
+{
+    LPUART_TypeDef   *LPUARTx;       /*!< LPUART通道 */
+    volatile uint8_t *pu8TxBuf;      /*!< 发送缓冲 */
+    volatile uint8_t *pu8RxBuf;      /*!< 接收缓冲 */
+    uint16_t          u16TxMask;     /*!< 发送缓冲长度-1 */
+    uint16_t          u16RxMask;     /*!< 接收缓冲长度-1 */
+    volatile uint16_t u16TxHead;     /*!< 发送写索引（线程修改） */
+    volatile uint16_t u16TxTail;     /*!< 发送读索引（中断修改） */
+    volatile uint16_t u16RxHead;     /*!< 接收写索引（中断修改） */
+    volatile uint16_t u16RxTail;     /*!< 接收读索引（线程修改） */
+    volatile uint32_t u32RxOverflow; /*!< 接收缓冲满丢弃的字节数 */
+    volatile uint32_t u32RxError;    /*!< 接收帧错误、校验错误次数 */
+    stc_int_cb_t      stcIntCb;      /*!< 内部使用：中断回调节点 */
+} stc_lpuart_ring_t;
+
+/**
+ * @brief  LPUART帧回调：帧结束间隔到期时在BTIM中断中调用
+ * @note   pu8Data指向帧缓冲（不拷贝），处理完成后调用LPUART_FrameRelease()归还
+ */
+typedef void (*func_ptr_lpuart_frame_t)(uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+
+/**
+ * @brief  LPUART帧间隔接收初始化配置
+ */
+typedef struct
+{
+    BTIM_TypeDef           *BTIMx;        /*!< 帧间隔定时器BTIM0~BTIM5 */
+    uint32_t                u32Pclk;      /*!< 定时器计数时钟（PCLK）频率 */
+    uint32_t                u32Baud;      /*!< 波特率 */
+    uint32_t                u32EndGapUs;  /*!< 帧结束静默时间（t3.5），单位us，0按Modbus RTU取t3.5 @ref LPUART_Frame_Gap */
+    uint32_t                u32CharGapUs; /*!< 帧内字符最大静默时间（t1.5），单位us，0不检查 @ref LPUART_Frame_Gap */
+    uint8_t                *pu8Buf;       /*!< 接收缓冲，等分为两个帧缓冲 */
+    uint16_t                u16BufSize;   /*!< 接收缓冲长度 */
+    func_ptr_lpuart_frame_t pfnFrame;     /*!< 帧回调 */
+    void                   *pvArg;        /*!< 帧回调参数 */
+} stc_lpuart_frame_init_t;
+
+/**
+ * @brief  LPUART帧间隔接收控制块（由调用者分配，使用期间不可释放）
+ * @note   两个帧缓冲交替接收：交给回调的帧缓冲由调用者持有直至归还，另一个继续接收。
+ *         持有标志由中断置位、线程清零，线程与中断之间无需关中断
+ */
+typedef struct
+{
+    LPUART_TypeDef         *LPUARTx;      /*!< LPUART通道 */
+    BTIM_TypeDef           *BTIMx;        /*!< 帧间隔定时器 */
+    uint8_t                *apu8Buf[2];   /*!< 帧缓冲 */
+    uint16_t                u16Size;      /*!< 每个帧缓冲的长度 */
+    uint16_t                u16CharTicks; /*!< 帧内相邻字节接收完成的最大间隔（定时器计数） */
+    volatile uint16_t       u16Len;       /*!< 当前帧已接收长度 */
+    volatile uint8_t        u8Active;     /*!< 正在接收的帧缓冲 */
+    volatile uint8_t        au8Held[2];   /*!< 帧缓冲由调用者持有 */
+    volatile uint32_t       u32Status;    /*!< 当前帧状态 @ref LPUART_Frame_Status */
+    volatile uint32_t       u32FrameCnt;  /*!< 交给回调的帧数 */
+    volatile uint32_t       u32FrameDrop; /*!< 两个帧缓冲均被持有而丢弃的帧数 */
+    func_ptr_lpuart_frame_t pfnFrame;     /*!< 帧回调 */
+    void                   *pvArg;        /*!< 帧回调参数 */
+    stc_int_cb_t            stcRxCb;      /*!< 内部使用：LPUART中断回调节点 */
+    stc_int_cb_t            stcGapCb;     /*!< 内部使用：BTIM中断回调节点 */
+} stc_lpuart_frame_t;
+
+/**
+ * @brief  LPUART多机节点帧回调：收完本节点或广播帧时在LPUART中断中调用
+ * @note   回调返回后pu8Data继续用于接收下一帧
+ */
+typedef void (*func_ptr_lpuart_node_t)(uint8_t u8Addr, uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+
+/**
+ * @brief  LPUART多机节点初始化配置
+ */
+typedef struct
+{
+    uint8_t                u8Addr;      /*!< 本节点地址（SADDR） */
+    uint8_t                u8AddrMsk;   /*!< 地址掩码（SADEN），为0的位不比较 */
+    uint32_t               u32Filter;   /*!< 地址过滤方式 @ref LPUART_Node_Filter */
+    uint8_t               *pu8Buf;      /*!< 接收缓冲 */
+    uint16_t               u16BufSize;  /*!< 接收缓冲长度 */
+    func_ptr_lpuart_node_t pfnFrame;    /*!< 帧回调 */
+    void                  *pvArg;       /*!< 帧回调参数 */
+} stc_lpuart_node_init_t;
+
+/**
+ * @brief  LPUART多机节点控制块（由调用者分配，使用期间不可释放）
+ * @note   总线帧格式：地址（第9位为1）、长度N、N字节数据（第9位为0）。
+ *         硬件过滤时ADRDET置位，只有与本节点地址或广播地址匹配的地址帧产生接收中断，
+ *         收到匹配的地址帧后清零ADRDET接收本帧数据，收完N字节后重新置位
+ */
+typedef struct
+{
+    LPUART_TypeDef        *LPUARTx;       /*!< LPUART通道 */
+    uint8_t               *pu8Buf;        /*!< 接收缓冲 */
+    uint16_t               u16Size;       /*!< 接收缓冲长度 */
+    uint8_t                u8Filter;      /*!< 地址过滤方式 */
+    volatile uint8_t       u8Addr;        /*!< 本节点地址 */
+    volatile uint8_t       u8AddrMsk;     /*!< 地址掩码 */
+    volatile uint8_t       u8State;       /*!< 接收状态 */
+    uint8_t                u8RxAddr;      /*!< 当前帧的地址 */
+    uint8_t                u8Remain;      /*!< 当前帧未收的数据字节数 */
+    volatile uint16_t      u16Len;        /*!< 当前帧已存入缓冲的长度 */
+    volatile uint32_t      u32Status;     /*!< 当前帧状态 @ref LPUART_Frame_Status */
+    volatile uint32_t      u32IrqCnt;     /*!< 接收中断次数（CPU唤醒次数） */
+    volatile uint32_t      u32FrameCnt;   /*!< 交给回调的帧数 */
+    volatile uint32_t      u32FrameAbort; /*!< 未收完即被新地址帧打断的帧数 */
+    func_ptr_lpuart_node_t pfnFrame;      /*!< 帧回调 */
+    void                  *pvArg;         /*!< 帧回调参数 */
+    stc_int_cb_t           stcIntCb;      /*!< 内部使用：中断回调节点 */
+} stc_lpuart_node_t;
+
+/**
+ * @brief  LPUART自动波特率检测完成回调：在ATIM3中断中调用，此时新波特率已生效且接收已使能
+ */
+typedef void (*func_ptr_lpuart_autobaud_t)(uint32_t u32Baud, void *pvArg);
+
+/**
+ * @brief  LPUART自动波特率检测初始化配置
+ */
+typedef struct
+{
+    uint32_t                   u32Pclk;      /*!< PCLK频率（ATIM3计数时钟及LPUART传输时钟） */
+    uint8_t                    u8SyncByte;   /*!< 主机发送的同步字节 @ref LPUART_AutoBaud_Sync */
+    uint32_t                   u32BaudMin;   /*!< 可检测的最低波特率，决定ATIM3预分频 */
+    uint32_t                   u32BaudMax;   /*!< 可检测的最高波特率，更窄的脉冲视为干扰 */
+    const uint32_t            *pu32BaudList; /*!< 标准波特率表，测量值取整到表中最近的波特率；NULL时直接使用测量值 */
+    uint16_t                   u16BaudNum;   /*!< 标准波特率表长度 */
+    uint32_t                   u32TolPpm;    /*!< 测量值与标准波特率的最大偏差，单位ppm */
+    func_ptr_lpuart_autobaud_t pfnDone;      /*!< 检测完成回调，可为NULL */
+    void                      *pvArg;        /*!< 回调参数 */
+} stc_lpuart_autobaud_init_t;
+
+/**
+ * @brief  LPUART自动波特率检测控制块（由调用者分配，检测期间不可释放）
+ * @note   u32Baud由ATIM3中断写入、线程查询，检测完成前为0
+ */
+typedef struct
+{
+    LPUART_TypeDef            *LPUARTx;      /*!< LPUART通道 */
+    uint32_t                   u32Pclk;      /*!< PCLK频率 */
+    uint32_t                   u32BaudLo;    /*!< 接受的最低测量波特率 */
+    uint32_t                   u32BaudHi;    /*!< 接受的最高测量波特率 */
+    const uint32_t            *pu32BaudList; /*!< 标准波特率表 */
+    uint16_t                   u16BaudNum;   /*!< 标准波特率表长度 */
+    uint8_t                    u8Bits;       /*!< 测量的低电平脉冲包含的位数 */
+    uint8_t                    u8PrsShift;   /*!< ATIM3预分频（2的幂次） */
+    uint32_t                   u32TolPpm;    /*!< 最大偏差，单位ppm */
+    volatile uint32_t          u32Ticks;     /*!< 最近一次测得的脉宽（PCLK周期） */
+    volatile uint32_t          u32Reject;    /*!< 超出范围或不匹配而丢弃的脉冲数 */
+    volatile uint32_t          u32Baud;      /*!< 检测结果，0为尚未完成 */
+    uint32_t                   u32Timcps;    /*!< 开始前GPIOAUX TIMCPS的ATIM3_C0A输入选择，停止时恢复 */
+    func_ptr_lpuart_autobaud_t pfnDone;      /*!< 检测完成回调 */
+    void                      *pvArg;        /*!< 回调参数 */
+    stc_int_cb_t               stcIntCb;     /*!< 内部使用：ATIM3中断回调节点 */
+} stc_lpuart_autobaud_t;
+
+/**
+ * @brief  LPUART单线半双工事务完成回调：在LPUART中断中调用，超时或中止时在LPUART_HdPoll()/LPUART_HdAbort()中调用
+ */
+typedef void (*func_ptr_lpuart_hd_t)(uint32_t u32Status, uint16_t u16RxLen, void *pvArg);
+
+/**
+ * @brief  LPUART单线半双工事务控制块（由调用者分配，使用期间不可释放）
+ * @note   事务期间接收始终使能：发送的每个字节经单线回读为回波，在接收中断中与发送数据比较后丢弃，
+ *         回波收齐之后的字节即为应答。最后一个字节由TC中断确认停止位发送完成，此时开始计算应答超时，
+ *         从机在停止位结束后立即应答也不会丢失
+ */
+typedef struct
+{
+    LPUART_TypeDef      *LPUARTx;      /*!< LPUART通道 */
+    const uint8_t       *pu8Tx;        /*!< 发送数据 */
+    uint8_t             *pu8Rx;        /*!< 应答接收缓冲 */
+    volatile uint16_t    u16TxLen;     /*!< 发送长度（总线冲突时截短为已写入的字节数） */
+    uint16_t             u16RxLen;     /*!< 应答长度 */
+    volatile uint16_t    u16TxCnt;     /*!< 已写入SBUF的字节数 */
+    volatile uint16_t    u16EchoCnt;   /*!< 已收到的回波字节数 */
+    volatile uint16_t    u16RxCnt;     /*!< 已收到的应答字节数 */
+    volatile uint8_t     u8State;      /*!< 事务阶段 */
+    uint32_t             u32TimeoutUs; /*!< 应答超时时间（微秒），从最后一个停止位发送完成起计算 */
+    stc_ddl_deadline_t   stcDeadline;  /*!< 应答截止时间 */
+    uint64_t             u64TxEnd;     /*!< 最后一个停止位发送完成（TC中断）时的时基计数 @ref DDL_TickGet() */
+    volatile uint32_t    u32Status;    /*!< 事务状态 @ref LPUART_Hd_Status */
+    volatile uint32_t    u32TurnTicks; /*!< 应答时间：TC中断到第一个应答字节接收完成（含该字节帧时间），HCLK周期 */
+    volatile uint32_t    u32XferCnt;   /*!< 结束的事务数 */
+    func_ptr_lpuart_hd_t pfnDone;      /*!< 事务完成回调，可为NULL */
+    void                *pvArg;        /*!< 回调参数 */
+    stc_int_cb_t         stcIntCb;     /*!< 内部使用：中断回调节点 */
+} stc_lpuart_hd_t;
+
+/**
+ * @brief  LPUART深度休眠批量接收配置
+ */
+typedef struct
+{
+    uint8_t *pu8Buf;       /*!< 接收缓冲 */
+    uint16_t u16Size;      /*!< 接收缓冲长度，2的幂（最大32768） */
+    uint16_t u16Watermark; /*!< 未读字节数达到该值时置LPUART_LPRX_EVT_WATERMARK，0为不使用 */
+    uint16_t u16Delim;     /*!< 收到该字节时置LPUART_LPRX_EVT_DELIM，LPUART_LPRX_DELIM_NONE为不使用 */
+    uint8_t  u8LenPos;     /*!< 长度前缀帧：长度字节在帧内的位置，LPUART_LPRX_FRAME_NONE为不使用 */
+    uint8_t  u8LenAdd;     /*!< 长度前缀帧：帧长 = 长度字节的值 + u8LenAdd（含长度字节及之前的字节，大于u8LenPos） */
+    uint32_t u32WakeMask;  /*!< 唤醒主循环的事件 @ref LPUART_LpRx_Event */
+} stc_lpuart_lprx_init_t;
+
+/**
+ * @brief  LPUART深度休眠批量接收控制块（由调用者分配，使用期间不可释放）
+ * @note   主循环在LPUART_LpRxSleep()中以SLEEPONEXIT进入深度休眠；接收中断只把数据写入接收缓冲并检查
+ *         唤醒条件，条件不满足时中断返回即再次休眠（不回到主循环），满足时清除SLEEPONEXIT，中断返回后
+ *         LPUART_LpRxSleep()返回事件。接收缓冲由中断写入、线程读出，每个索引只由一方修改
+ */
+typedef struct
+{
+    LPUART_TypeDef   *LPUARTx;      /*!< LPUART通道 */
+    volatile uint8_t *pu8Buf;       /*!< 接收缓冲 */
+    uint16_t          u16Mask;      /*!< 接收缓冲长度-1 */
+    volatile uint16_t u16Head;      /*!< 写索引（中断修改） */
+    volatile uint16_t u16Tail;      /*!< 读索引（线程修改） */
+    uint16_t          u16Watermark; /*!< 唤醒水位 */
+    uint16_t          u16Delim;     /*!< 分隔字节 */
+    uint8_t           u8LenPos;     /*!< 长度字节位置 */
+    uint8_t           u8LenAdd;     /*!< 帧长附加字节数 */
+    uint16_t          u16FramePos;  /*!< 当前帧已收到的字节数 */
+    uint16_t          u16FrameLen;  /*!< 当前帧长，0为长度字节尚未收到 */
+    uint32_t          u32WakeMask;  /*!< 唤醒主循环的事件 */
+    volatile uint32_t u32Event;     /*!< 尚未由LPUART_LpRxSleep()取走的事件 @ref LPUART_LpRx_Event */
+    volatile uint32_t u32IrqCnt;    /*!< 接收中断次数（CPU由深度休眠唤醒执行中断的次数） */
+    volatile uint32_t u32WakeCnt;   /*!< 唤醒主循环的次数 */
+    volatile uint32_t u32SleepCnt;  /*!< 主循环进入深度休眠的次数 */
+    volatile uint32_t u32Overflow;  /*!< 接收缓冲满丢弃的字节数 */
+    volatile uint32_t u32Error;     /*!< 接收帧错误、校验错误次数 */
+    stc_int_cb_t      stcIntCb;     /*!< 内部使用：中断回调节点 */
+} stc_lpuart_lprx_t;
+
 /**
  * @}
  */
@@ -146,13 +414,153 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup LPUART_Over_Select LPUART过采样分频选择
+ * @{
+ */
+#define LPUART_OVER_16 (0x00u << LPUART_SCON_OVER_Pos) /*!< 16分频 */
+#define LPUART_OVER_8  (0x01u << LPUART_SCON_OVER_Pos) /*!< 8分频 */
+#define LPUART_OVER_4  (0x02u << LPUART_SCON_OVER_Pos) /*!< 4分频 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Baud_Calc LPUART波特率编译期计算
+ * @brief    SCLK与波特率为常量时在编译期得到与LPUART_BaudCalc()相同的配置，如
+ *           static const stc_lpuart_baud_cfg_t stcBaud = LPUART_BAUD_CFG(48000000u, 115200u);
+ *           三种分频下SCNT均超出65535时无有效配置，可由LPUART_BAUD_SCNT(sclk, baud, 16u)检查
+ * @{
+ */
+/* 分频div（16/8/4）下的SCNT：Sclk/(div*Baud)四舍五入，最小为1 */
+#define LPUART_BAUD_SCNT(sclk, baud, div)                                                                                              \
+    ((((sclk) + (((div) * (baud)) >> 1)) / ((div) * (baud))) ? ((((sclk) + (((div) * (baud)) >> 1)) / ((div) * (baud)))) : 1u)
+/* 分频div下的波特率误差，单位ppm */
+#define LPUART_BAUD_ERR_PPM(sclk, baud, div)                                                                                           \
+    ((int32_t)((((int64_t)(sclk) - ((int64_t)(div) * LPUART_BAUD_SCNT((sclk), (baud), (div)) * (baud))) * 1000000)                   \
+               / ((int64_t)(div) * LPUART_BAUD_SCNT((sclk), (baud), (div)) * (baud))))
+/* 分频div下选择用的误差绝对值，SCNT超出范围时为最大值 */
+#define LPUART_BAUD_COST(sclk, baud, div)                                                                                              \
+    ((LPUART_BAUD_SCNT((sclk), (baud), (div)) > 0xFFFFu) ? INT32_MAX                                                                   \
+     : (LPUART_BAUD_ERR_PPM((sclk), (baud), (div)) < 0)  ? (-LPUART_BAUD_ERR_PPM((sclk), (baud), (div)))                               \
+                                                         : LPUART_BAUD_ERR_PPM((sclk), (baud), (div)))
+/* 误差最小的分频，误差相同时取较大的分频 */
+#define LPUART_BAUD_DIV(sclk, baud)                                                                                                    \
+    (((LPUART_BAUD_COST((sclk), (baud), 16u) <= LPUART_BAUD_COST((sclk), (baud), 8u))                                                  \
+      && (LPUART_BAUD_COST((sclk), (baud), 16u) <= LPUART_BAUD_COST((sclk), (baud), 4u)))                                              \
+         ? 16u                                                                                                                         \
+         : ((LPUART_BAUD_COST((sclk), (baud), 8u) <= LPUART_BAUD_COST((sclk), (baud), 4u)) ? 8u : 4u))
+#define LPUART_BAUD_DIV_TO_OVER(div) ((16u == (div)) ? LPUART_OVER_16 : ((8u == (div)) ? LPUART_OVER_8 : LPUART_OVER_4))
+/* 结构体stc_lpuart_baud_cfg_t的常量初始化值 */
+#define LPUART_BAUD_CFG(sclk, baud)                                                                                                    \
+    {                                                                                                                                  \
+        LPUART_BAUD_DIV_TO_OVER(LPUART_BAUD_DIV((sclk), (baud))),                                                                      \
+        LPUART_BAUD_SCNT((sclk), (baud), LPUART_BAUD_DIV((sclk), (baud))),                                                             \
+        ((sclk) / (LPUART_BAUD_DIV((sclk), (baud)) * LPUART_BAUD_SCNT((sclk), (baud), LPUART_BAUD_DIV((sclk), (baud))))),              \
+        LPUART_BAUD_ERR_PPM((sclk), (baud), LPUART_BAUD_DIV((sclk), (baud)))                                                           \
+    }
+/**
+ * @}
+ */
+
 /**
  * @defgroup LPUART_XTL_32768_Baud_Select LPUART XTL为32768时的波特率设定
  * @{
  */
 #define LPUART_XTL_BAUD_NORMAL (0x00u)                         /*!< 用OVER和SCNT产生波特率 */
-#define LPUART_XTL_BAUD_9600   (0x02u << LPUART_BSEL_BSEL_Pos) /*!< 时钟源是XTL，由调制生成9600波特率 */
-#define LPUART_XTL_BAUD_4800   (0x03u << LPUART_BSEL_BSEL_Pos) /*!< 时钟源是XTL，由调制生成4800波特率 */
+#define LPUART_XTL_BAUD_9600   (0x02u << LPUART_BSEL_BSEL_Pos) /*!< 时钟源是XTL，由调制生成9600波特率（每位3或4个XTL时钟，8192~10922bps） */
+#define LPUART_XTL_BAUD_4800   (0x03u << LPUART_BSEL_BSEL_Pos) /*!< 时钟源是XTL，由调制生成4800波特率（每位6或7个XTL时钟，4682~5461bps） */
+
+#define LPUART_XTL_FREQ      (32768u) /*!< XTL时钟频率 */
+#define LPUART_XTL_MODU_BITS (12u)    /*!< MODU调制位数（帧最长12位） */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Frame_Gap LPUART帧间隔
+ * @brief    Modbus RTU字符时间按11位计，波特率大于19200时t1.5、t3.5固定为750us、1750us，如
+ *           stcInit.u32CharGapUs = LPUART_FRAME_GAP_US(9600u, LPUART_FRAME_T15);
+ * @{
+ */
+#define LPUART_FRAME_T15 (15u) /*!< 1.5字符（单位0.1字符） */
+#define LPUART_FRAME_T35 (35u) /*!< 3.5字符（单位0.1字符） */
+
+/* tenths个0.1字符的静默时间，单位us，向上取整 */
+#define LPUART_FRAME_GAP_US(baud, tenths) (((baud) > 19200u) ? ((tenths) * 50u) : ((((tenths) * 1100000u) + (baud) - 1u) / (baud)))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Frame_Status LPUART帧状态
+ * @{
+ */
+#define LPUART_FRAME_STS_OK       (0x0u) /*!< 正常 */
+#define LPUART_FRAME_STS_OVERFLOW (0x1u) /*!< 帧长度超出帧缓冲，超出部分丢弃 */
+#define LPUART_FRAME_STS_CHAR_GAP (0x2u) /*!< 帧内字符间静默超过t1.5 */
+#define LPUART_FRAME_STS_RX_ERR   (0x4u) /*!< 帧错误或校验错误 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Node_Filter LPUART多机节点地址过滤方式
+ * @{
+ */
+#define LPUART_NODE_FILTER_HW (0x0u) /*!< 硬件地址识别（ADRDET），只在本节点及广播帧时中断 */
+#define LPUART_NODE_FILTER_SW (0x1u) /*!< 软件地址识别，每个字节均中断 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_AutoBaud_Sync LPUART自动波特率同步字节
+ * @brief    同步字节须为"低位若干0、其余为1"的形式（0x00、0x80、0xC0、0xE0、0xF0、0xF8、0xFC、0xFE、0xFF）：
+ *           起始位与低位的0构成一个低电平脉冲，之后直到停止位均为高电平，接收在该脉冲结束后使能，
+ *           不会把同步字节的其余部分误当作起始位。脉冲越宽测量分辨率越高
+ * @{
+ */
+#define LPUART_AUTOBAUD_SYNC_DEFAULT (0xF0u)  /*!< 默认同步字节：起始位+4个0，低电平5位 */
+#define LPUART_AUTOBAUD_TOL_DEFAULT  (30000u) /*!< 默认与标准波特率的最大偏差3% */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Hd_Status LPUART单线半双工事务状态
+ * @{
+ */
+#define LPUART_HD_STS_OK        (0x00u) /*!< 完成：发送完成且收齐应答 */
+#define LPUART_HD_STS_BUSY      (0x01u) /*!< 进行中 */
+#define LPUART_HD_STS_TIMEOUT   (0x02u) /*!< 截止时间内未收齐应答 */
+#define LPUART_HD_STS_COLLISION (0x04u) /*!< 回波与发送数据不同或缺失（总线冲突），停止发送其余字节且不等待应答 */
+#define LPUART_HD_STS_RX_ERR    (0x08u) /*!< 应答中有帧错误或校验错误 */
+#define LPUART_HD_STS_ABORT     (0x10u) /*!< 被LPUART_HdAbort()中止 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_LpRx_Event LPUART深度休眠批量接收事件
+ * @{
+ */
+#define LPUART_LPRX_EVT_DELIM     (0x01u) /*!< 收到分隔字节 */
+#define LPUART_LPRX_EVT_WATERMARK (0x02u) /*!< 未读字节数达到水位 */
+#define LPUART_LPRX_EVT_FRAME     (0x04u) /*!< 长度前缀帧收齐 */
+#define LPUART_LPRX_EVT_FULL      (0x08u) /*!< 接收缓冲满，之后的字节丢弃 */
+#define LPUART_LPRX_EVT_ERR       (0x10u) /*!< 帧错误或校验错误 */
+#define LPUART_LPRX_EVT_ALL       (0x1Fu)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_LpRx_Config LPUART深度休眠批量接收唤醒条件
+ * @{
+ */
+#define LPUART_LPRX_DELIM_NONE (0xFFFFu) /*!< 不使用分隔字节 */
+#define LPUART_LPRX_FRAME_NONE (0xFFu)   /*!< 不使用长度前缀帧 */
 /**
  * @}
  */
@@ -212,16 +620,22 @@ typedef struct
  * @{
  */
 uint32_t    LPUART_Init(LPUART_TypeDef *LPUARTx, stc_lpuart_init_t *pstcLpuartInit);            /* 总初始化处理 */
+en_result_t LPUART_BaudCalc(uint32_t u32Sclk, uint32_t u32Baud, stc_lpuart_baud_cfg_t *pstcCfg); /* 波特率配置计算 */
+void        LPUART_BaudSet(LPUART_TypeDef *LPUARTx, const stc_lpuart_baud_cfg_t *pstcCfg);      /* 波特率配置 */
 en_result_t LPUART_XtlBselSet(LPUART_TypeDef *LPUARTx, uint32_t u32BselConfig);                 /* LPUART XTL波特率产生寄存器 */
+en_result_t LPUART_XtlBaudCalc(uint32_t u32Baud, stc_lpuart_xtl_baud_t *pstcCfg);               /* XTL调制波特率计算 */
+en_result_t LPUART_XtlBaudSet(LPUART_TypeDef *LPUARTx, const stc_lpuart_xtl_baud_t *pstcCfg);   /* XTL调制波特率配置 */
 void        LPUART_MultiModeConfig(LPUART_TypeDef *LPUARTx, uint8_t u8Addr, uint8_t u8AddrMsk); /* LPUART通道多主机模式配置 */
 
-en_result_t LPUART_ReceivePoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size);                             /* 数据查询接收 */
-en_result_t LPUART_ReceivePollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut); /* 数据查询接收 */
-uint8_t     LPUART_ReceiveInt(LPUART_TypeDef *LPUARTx);                                                                  /* 数据中断接收 */
+en_result_t LPUART_ReceivePoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size);                                 /* 数据查询接收 */
+en_result_t LPUART_ReceivePollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut);     /* 数据查询接收 */
+en_result_t LPUART_ReceivePollTimeOutUs(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOutUs); /* 数据查询接收（微秒超时） */
+uint8_t     LPUART_ReceiveInt(LPUART_TypeDef *LPUARTx);                                                                      /* 数据中断接收 */
 
-en_result_t LPUART_TransmitPoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size);                             /* 数据查询发送 */
-en_result_t LPUART_TransmitPollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut); /* 数据查询发送 */
-en_result_t LPUART_TransmitInt(LPUART_TypeDef *LPUARTx, uint8_t u8Data);                                                  /* 数据中断发送 */
+en_result_t LPUART_TransmitPoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size);                                 /* 数据查询发送 */
+en_result_t LPUART_TransmitPollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut);     /* 数据查询发送 */
+en_result_t LPUART_TransmitPollTimeOutUs(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOutUs); /* 数据查询发送（微秒超时） */
+en_result_t LPUART_TransmitInt(LPUART_TypeDef *LPUARTx, uint8_t u8Data);                                                      /* 数据中断发送 */
 
 void LPUART_HdModeEnable(LPUART_TypeDef *LPUARTx);  /* LPUART 单线模式使能 */
 void LPUART_HdModeDisable(LPUART_TypeDef *LPUARTx); /* LPUART 单线模式禁止 */
@@ -242,6 +656,50 @@ void      LPUART_Bit8Clear(LPUART_TypeDef *LPUARTx); /* 数据寄存器bit8位
 boolean_t LPUART_Bit8Get(LPUART_TypeDef *LPUARTx);   /* 数据寄存器bit8位获取 */
 
 void LPUART_StcInit(stc_lpuart_init_t *pstcInit); /* 结构体初始化 */
+
+en_result_t LPUART_RingInit(LPUART_TypeDef *LPUARTx, stc_lpuart_ring_t *pstcRing, uint8_t *pu8TxBuf, uint16_t u16TxSize, uint8_t *pu8RxBuf,
+                            uint16_t u16RxSize, en_irq_priority_level_t enLevel);                /* 中断环形缓冲收发初始化 */
+void        LPUART_RingDeInit(stc_lpuart_ring_t *pstcRing);                                       /* 中断环形缓冲收发停止 */
+uint32_t    LPUART_RingWrite(stc_lpuart_ring_t *pstcRing, const uint8_t *pu8Data, uint32_t u32Size); /* 写入发送缓冲（不等待） */
+uint32_t    LPUART_RingRead(stc_lpuart_ring_t *pstcRing, uint8_t *pu8Data, uint32_t u32Size);        /* 读出接收缓冲（不等待） */
+uint32_t    LPUART_RingTxCountGet(const stc_lpuart_ring_t *pstcRing);                             /* 发送缓冲待发送字节数 */
+uint32_t    LPUART_RingRxCountGet(const stc_lpuart_ring_t *pstcRing);                             /* 接收缓冲可读字节数 */
+
+void        LPUART_FrameStcInit(stc_lpuart_frame_init_t *pstcInit); /* 帧间隔接收配置结构体初始化 */
+en_result_t LPUART_FrameInit(LPUART_TypeDef *LPUARTx, stc_lpuart_frame_t *pstcFrame, const stc_lpuart_frame_init_t *pstcInit,
+                             en_irq_priority_level_t enLevel);                         /* 帧间隔接收初始化 */
+void        LPUART_FrameDeInit(stc_lpuart_frame_t *pstcFrame);                         /* 帧间隔接收停止 */
+void        LPUART_FrameRelease(stc_lpuart_frame_t *pstcFrame, const uint8_t *pu8Data); /* 归还帧缓冲 */
+
+void        LPUART_NodeStcInit(stc_lpuart_node_init_t *pstcInit); /* 多机节点配置结构体初始化 */
+en_result_t LPUART_NodeInit(LPUART_TypeDef *LPUARTx, stc_lpuart_node_t *pstcNode, const stc_lpuart_node_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel);                                   /* 多机节点初始化 */
+void        LPUART_NodeDeInit(stc_lpuart_node_t *pstcNode);                                     /* 多机节点停止 */
+void        LPUART_NodeAddrSet(stc_lpuart_node_t *pstcNode, uint8_t u8Addr, uint8_t u8AddrMsk); /* 运行中修改节点地址 */
+en_result_t LPUART_NodeSend(LPUART_TypeDef *LPUARTx, uint8_t u8Addr, const uint8_t *pu8Data, uint8_t u8Len,
+                            uint32_t u32TimeOutUs);                                             /* 多机帧查询发送 */
+
+void        LPUART_AutoBaudStcInit(stc_lpuart_autobaud_init_t *pstcInit); /* 自动波特率检测配置结构体初始化 */
+en_result_t LPUART_AutoBaudStart(LPUART_TypeDef *LPUARTx, stc_lpuart_autobaud_t *pstcAb, const stc_lpuart_autobaud_init_t *pstcInit,
+                                 en_irq_priority_level_t enLevel);                                  /* 开始自动波特率检测 */
+void        LPUART_AutoBaudStop(stc_lpuart_autobaud_t *pstcAb);                                     /* 停止自动波特率检测 */
+uint32_t    LPUART_AutoBaudMatch(uint32_t u32Baud, const uint32_t *pu32List, uint32_t u32Num, uint32_t u32TolPpm); /* 测量值取整到标准波特率 */
+
+en_result_t LPUART_HdInit(LPUART_TypeDef *LPUARTx, stc_lpuart_hd_t *pstcHd, func_ptr_lpuart_hd_t pfnDone, void *pvArg,
+                          en_irq_priority_level_t enLevel);                         /* 单线半双工事务初始化 */
+void        LPUART_HdDeInit(stc_lpuart_hd_t *pstcHd);                              /* 单线半双工事务停止 */
+en_result_t LPUART_HdXfer(stc_lpuart_hd_t *pstcHd, const uint8_t *pu8Tx, uint16_t u16TxLen, uint8_t *pu8Rx, uint16_t u16RxLen,
+                          uint32_t u32TimeoutUs);                                   /* 开始事务：发送后接收应答 */
+uint32_t    LPUART_HdPoll(stc_lpuart_hd_t *pstcHd);                                /* 事务状态查询及超时检查 */
+void        LPUART_HdAbort(stc_lpuart_hd_t *pstcHd);                               /* 中止事务 */
+
+void        LPUART_LpRxStcInit(stc_lpuart_lprx_init_t *pstcInit); /* 深度休眠批量接收配置结构体初始化 */
+en_result_t LPUART_LpRxInit(LPUART_TypeDef *LPUARTx, stc_lpuart_lprx_t *pstcLpRx, const stc_lpuart_lprx_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel);                             /* 深度休眠批量接收初始化 */
+void        LPUART_LpRxDeInit(stc_lpuart_lprx_t *pstcLpRx);                                /* 深度休眠批量接收停止 */
+uint32_t    LPUART_LpRxSleep(stc_lpuart_lprx_t *pstcLpRx);                                 /* 深度休眠直到唤醒事件 */
+uint32_t    LPUART_LpRxRead(stc_lpuart_lprx_t *pstcLpRx, uint8_t *pu8Data, uint32_t u32Size); /* 读出接收缓冲 */
+uint32_t    LPUART_LpRxCountGet(const stc_lpuart_lprx_t *pstcLpRx);                        /* 接收缓冲可读字节数 */
 /**
  * @}
  */
@@ -0,0 +1,216 @@
+/**
+ *******************************************************************************
+ * @file  lpuart_link.h
+ * @brief This file contains all the functions prototypes of the LPUART framed
+ *        link layer (SLIP framing, CRC-16, sequence numbers, optional
+ *        go-back-N acknowledge and retransmit)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+   2026-10-18       MADS            Add transmit release status to func_ptr_lpuart_link_tx_t
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __LPUART_LINK_H__
+#define __LPUART_LINK_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpuart.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup LPUART_LINK LPUART帧传输链路层
+ * @brief 二进制帧：类型(1) + 序号(1) + 数据(0~N) + CRC-16/CCITT-FALSE(2，高字节在前)，经SLIP（RFC 1055）
+ *        分帧发送。发送由TX空中断直接从调用者缓冲逐字节转义输出（不复制），接收在接收中断中逐字节
+ *        去转义并计算CRC，帧结束符处校验后交出整帧。
+ *        窗口为0时不应答，接收方由序号统计丢失的帧；窗口1~LPUART_LINK_TXQ_SIZE时为可靠模式：
+ *        接收方按序交出并回送累计应答（下一个期望序号），发送方超时后从最早未应答的帧起重发（回退N帧）
+ * @{
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup LPUART_LINK_Global_Macros LPUART_LINK全局宏定义
+ * @{
+ */
+#define LPUART_LINK_TXQ_SIZE (8u) /*!< 发送队列长度（2的幂），即可靠模式窗口上限 */
+#define LPUART_LINK_OVERHEAD (4u) /*!< 每帧未转义的附加字节：类型、序号、CRC */
+
+/**
+ * @defgroup LPUART_LINK_Frame_Type 帧类型
+ * @{
+ */
+#define LPUART_LINK_TYPE_DATA     (0x00u) /*!< 数据帧，不应答 */
+#define LPUART_LINK_TYPE_DATA_ACK (0x01u) /*!< 数据帧，须应答 */
+#define LPUART_LINK_TYPE_ACK      (0x02u) /*!< 应答帧：序号为下一个期望接收的序号，无数据 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_LINK_Tx_Status 发送缓冲释放状态
+ * @{
+ */
+#define LPUART_LINK_TX_STS_OK    (0x00u) /*!< 已发出（不应答）或已收到应答 */
+#define LPUART_LINK_TX_STS_ABORT (0x01u) /*!< 被LPUART_LinkDeInit()中止：未发出或未收到应答 */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup LPUART_LINK_Global_Types LPUART_LINK全局类型定义
+ * @{
+ */
+
+/**
+ * @brief  收到数据帧回调（接收中断中调用）：pu8Data指向接收帧缓冲，只在回调期间有效
+ */
+typedef void (*func_ptr_lpuart_link_rx_t)(const uint8_t *pu8Data, uint16_t u16Len, void *pvArg);
+
+/**
+ * @brief  发送缓冲释放回调（中断中调用，中止时在LPUART_LinkDeInit()中调用）：不应答时在该帧最后一个字节
+ *         写入SBUF后调用，可靠模式下在收到应答后调用，之后调用者可修改或重用该缓冲；
+ *         u32Status @ref LPUART_LINK_Tx_Status
+ */
+typedef void (*func_ptr_lpuart_link_tx_t)(const uint8_t *pu8Data, uint32_t u32Status, void *pvArg);
+
+/**
+ * @brief  LPUART链路层配置
+ */
+typedef struct
+{
+    uint8_t                  *pu8RxBuf;  /*!< 接收帧缓冲（类型、序号、数据及CRC） */
+    uint16_t                  u16RxSize; /*!< 接收帧缓冲长度：最大数据长度 + LPUART_LINK_OVERHEAD */
+    uint8_t                   u8Window;  /*!< 0: 不应答；1~LPUART_LINK_TXQ_SIZE: 可靠模式，最多发出未应答的帧数 */
+    uint32_t                  u32RetxUs; /*!< 可靠模式重发超时（微秒），从最早未应答的帧开始发送起计算 */
+    func_ptr_lpuart_link_rx_t pfnRx;     /*!< 收到数据帧回调，可为NULL */
+    func_ptr_lpuart_link_tx_t pfnTxDone; /*!< 发送缓冲释放回调，可为NULL */
+    void                     *pvArg;     /*!< 回调参数 */
+} stc_lpuart_link_init_t;
+
+/**
+ * @brief  LPUART链路层控制块（由调用者分配，使用期间不可释放）
+ * @note   发送队列序号与帧序号相同（8位自由计数），队列下标为序号的低位
+ */
+typedef struct
+{
+    LPUART_TypeDef *LPUARTx; /*!< LPUART通道 */
+
+    const uint8_t     *apu8TxData[LPUART_LINK_TXQ_SIZE]; /*!< 发送队列：调用者缓冲 */
+    uint16_t           au16TxLen[LPUART_LINK_TXQ_SIZE];  /*!< 发送队列：数据长度 */
+    volatile uint8_t   u8TxHead;    /*!< 下一个入队帧的序号 */
+    volatile uint8_t   u8TxBase;    /*!< 最早未释放帧的序号 */
+    volatile uint8_t   u8TxNext;    /*!< 下一个发送帧的序号 */
+    volatile uint8_t   u8AckPend;   /*!< 有待发送的应答帧 */
+    uint8_t            u8AckSeq;    /*!< 待发送应答帧的序号 */
+    uint8_t            u8TxState;   /*!< 内部使用：发送帧编码阶段 */
+    uint8_t            u8TxEsc;     /*!< 内部使用：转义字节的第二字节，0为无 */
+    uint8_t            au8TxHdr[2]; /*!< 内部使用：当前帧类型及序号 */
+    uint8_t            au8TxCrc[2]; /*!< 内部使用：当前帧CRC */
+    uint16_t           u16TxPos;    /*!< 内部使用：当前阶段已输出的字节数 */
+    uint16_t           u16TxCrc;    /*!< 内部使用：当前帧CRC计算值 */
+    const uint8_t     *pu8TxCur;    /*!< 内部使用：当前帧数据 */
+    uint16_t           u16TxCurLen; /*!< 内部使用：当前帧数据长度 */
+    boolean_t          bTxFree;     /*!< 内部使用：当前帧发送完即释放（不应答） */
+    boolean_t          bTxIdle;     /*!< 内部使用：发送已停止，下一帧前先发帧结束符 */
+    stc_ddl_deadline_t stcRetx;     /*!< 内部使用：重发截止时间 */
+
+    uint8_t  *pu8RxBuf;    /*!< 接收帧缓冲 */
+    uint16_t  u16RxSize;   /*!< 接收帧缓冲长度 */
+    uint16_t  u16RxLen;    /*!< 当前帧已收到的字节数（去转义后） */
+    uint16_t  u16RxCrc;    /*!< 当前帧CRC计算值 */
+    boolean_t bRxEsc;      /*!< 上一字节为转义字节 */
+    boolean_t bRxOverflow; /*!< 当前帧超出接收缓冲 */
+    uint8_t   u8RxExpect;  /*!< 下一个期望接收的序号 */
+
+    uint8_t                   u8Window;  /*!< 窗口 */
+    uint32_t                  u32RetxUs; /*!< 重发超时 */
+    func_ptr_lpuart_link_rx_t pfnRx;     /*!< 收到数据帧回调 */
+    func_ptr_lpuart_link_tx_t pfnTxDone; /*!< 发送缓冲释放回调 */
+    void                     *pvArg;     /*!< 回调参数 */
+
+    volatile uint32_t u32TxFrames;   /*!< 发出的帧数（含应答帧及重发） */
+    volatile uint32_t u32TxBytes;    /*!< 发出的线路字节数（含转义及帧结束符） */
+    volatile uint32_t u32Retx;       /*!< 超时重发次数 */
+    volatile uint32_t u32RxFrames;   /*!< 交出的数据帧数 */
+    volatile uint32_t u32RxCrcErr;   /*!< CRC错误、过短或类型未知而丢弃的帧数 */
+    volatile uint32_t u32RxOverflow; /*!< 超出接收缓冲而丢弃的帧数 */
+    volatile uint32_t u32RxLost;     /*!< 序号不连续而判定丢失的帧数（可靠模式下为乱序丢弃的帧数） */
+    volatile uint32_t u32RxDup;      /*!< 可靠模式下重复而丢弃的帧数 */
+
+    stc_int_cb_t stcIntCb; /*!< 内部使用：中断回调节点 */
+} stc_lpuart_link_t;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup LPUART_LINK_Global_Functions LPUART_LINK全局函数定义
+ * @{
+ */
+void        LPUART_LinkStcInit(stc_lpuart_link_init_t *pstcInit); /* 配置结构体初始化 */
+en_result_t LPUART_LinkInit(LPUART_TypeDef *LPUARTx, stc_lpuart_link_t *pstcLink, const stc_lpuart_link_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel);      /* 链路初始化 */
+void        LPUART_LinkDeInit(stc_lpuart_link_t *pstcLink);        /* 链路停止，未释放的帧报告中止 */
+en_result_t LPUART_LinkSend(stc_lpuart_link_t *pstcLink, const uint8_t *pu8Data, uint16_t u16Len); /* 发送一帧（不复制） */
+uint32_t    LPUART_LinkPoll(stc_lpuart_link_t *pstcLink);          /* 重发检查，返回未释放的帧数 */
+uint16_t    LPUART_LinkCrc16(uint16_t u16Crc, const uint8_t *pu8Data, uint32_t u32Len); /* CRC-16/CCITT-FALSE */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LPUART_LINK_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -351,11 +351,12 @@ void      RTC_IntFlagClear(uint32_t u32IntFlag); /* RTC清除中断标志 */
 void      RTC_IntEnable(uint32_t u32IntFlag);    /* RTC中断使能 */
 void      RTC_IntDisable(uint32_t u32IntFlag);   /* RTC中断禁用 */
 
-en_result_t RTC_CompValueCalculate(float32_t f32CompUint, uint16_t u16Csteps, uint16_t *pu16CompValue); /* 计算RTC误差补偿寄存器的值 */
-en_result_t RTC_CompConfig(uint16_t u16CompValue, uint16_t u16Csteps);                                  /* 配置RTC的误差补偿寄存器 */
-void        RTC_CompEnable(void);                                                                       /* RTC时间误差补偿使能 */
-void        RTC_CompDisable(void);                                                                      /* RTC时间误差补偿禁止 */
-en_result_t RTC_HcompConfig(uint32_t u32Hcomppara);                                                     /* 配置RTC的高速补偿精度参数 */
+en_result_t RTC_CompValueCalculate(float32_t f32CompUint, uint16_t u16Csteps, uint16_t *pu16CompValue);  /* 计算RTC误差补偿寄存器的值 */
+en_result_t RTC_CompValueCalculateQ16(int32_t i32CompUint, uint16_t u16Csteps, uint16_t *pu16CompValue); /* 计算RTC误差补偿寄存器的值（整数运算） */
+en_result_t RTC_CompConfig(uint16_t u16CompValue, uint16_t u16Csteps);                                   /* 配置RTC的误差补偿寄存器 */
+void        RTC_CompEnable(void);                                                                        /* RTC时间误差补偿使能 */
+void        RTC_CompDisable(void);                                                                       /* RTC时间误差补偿禁止 */
+en_result_t RTC_HcompConfig(uint32_t u32Hcomppara);                                                      /* 配置RTC的高速补偿精度参数 */
 
 boolean_t RTC_FormatGet(void); /* 读取RTC当前的时间格式 */
 
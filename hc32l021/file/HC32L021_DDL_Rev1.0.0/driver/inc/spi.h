@@ -7,6 +7,10 @@
    Change Logs:
    Date             Author          Notes
    2024-11-14       MADS            First version
+   2026-10-18       MADS            Add pipelined 8/16-bit transmit, receive and full duplex transfers
+   2026-10-18       MADS            Add interrupt driven asynchronous transaction queue with chip select
+   2026-10-18       MADS            Add double-buffered interrupt driven slave streaming
+   2026-10-18       MADS            Restore loop-count timeouts, add microsecond *TimeoutUs variants
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +68,114 @@ typedef struct
     uint32_t u32NSS;         /*!< 配置NSS片选信号是硬件控制还是软件控制  @ref SPI_NSS_CFG */
     uint32_t u32SampleDelay; /*!< 主机模式延后采样                     @ref SPI_Sample_Delay_Select */
 } stc_spi_init_t;
+
+/**
+ * @brief  SPI异步事务的一个数据段：按字计数，数据宽度不超过8位时缓冲为uint8_t，否则为uint16_t
+ */
+typedef struct
+{
+    const void *pvTx;   /*!< 发送数据，NULL时发送事务的填充值 */
+    void       *pvRx;   /*!< 接收数据，NULL时丢弃 */
+    uint16_t    u16Len; /*!< 字数，可为0（跳过） */
+} stc_spi_seg_t;
+
+struct stc_spi_xfer;
+
+/**
+ * @brief  SPI异步事务完成回调：在SPI中断中调用（中止时在SPI_AsyncAbort()中调用），此时下一个事务已开始；
+ *         回调中可再次提交事务（包括本事务）
+ */
+typedef void (*func_ptr_spi_xfer_t)(struct stc_spi_xfer *pstcXfer, uint32_t u32Status, void *pvArg);
+
+/**
+ * @brief  SPI异步事务描述（由调用者分配，提交后到完成回调前不可修改或释放）
+ * @note   片选为GPIO，低电平有效：事务开始前置低，最后一个字接收完成后置高。
+ *         u32BaudRate/u32CPOL/u32CPHA/u32DataWidth与当前配置不同时在片选置低前设置
+ */
+typedef struct stc_spi_xfer
+{
+    GPIO_TypeDef        *CSx;          /*!< 片选端口，NULL时不操作片选 */
+    uint32_t             u32CsPin;     /*!< 片选引脚 @ref GPIO_Pins_Define */
+    uint32_t             u32BaudRate;  /*!< 波特率分频 @ref SPI_Baudrate_Select */
+    uint32_t             u32CPOL;      /*!< 时钟极性 @ref SPI_Clock_Polarity_Select */
+    uint32_t             u32CPHA;      /*!< 时钟相位 @ref SPI_Clock_Phase_Select */
+    uint32_t             u32DataWidth; /*!< 数据宽度 @ref SPI_Data_Width_Select */
+    uint16_t             u16Fill;      /*!< 数据段发送数据为NULL时发送的值 */
+    uint8_t              u8SegNum;     /*!< 数据段数 */
+    const stc_spi_seg_t *pstcSeg;      /*!< 数据段列表，依次在同一次片选内收发 */
+    func_ptr_spi_xfer_t  pfnDone;      /*!< 完成回调，可为NULL */
+    void                *pvArg;        /*!< 回调参数 */
+    volatile uint32_t    u32Status;    /*!< 事务状态 @ref SPI_Xfer_Status */
+    struct stc_spi_xfer *pstcNext;     /*!< 内部使用：队列中的下一个事务 */
+} stc_spi_xfer_t;
+
+/**
+ * @brief  SPI异步事务队列控制块（由调用者分配，使用期间不可释放）
+ */
+typedef struct
+{
+    SPI_TypeDef             *SPIx;       /*!< SPI通道 */
+    stc_spi_xfer_t *volatile pstcHead;   /*!< 当前事务（队首），NULL时空闲 */
+    stc_spi_xfer_t          *pstcTail;   /*!< 队尾 */
+    uint32_t                 u32Mode;    /*!< 当前的BRR/CPOL/CPHA/WIDTH配置 */
+    boolean_t                b16Bit;     /*!< 当前事务缓冲为uint16_t */
+    uint8_t                  u8TxSeg;    /*!< 发送数据段下标 */
+    uint8_t                  u8RxSeg;    /*!< 接收数据段下标 */
+    uint16_t                 u16TxPos;   /*!< 发送数据段内位置 */
+    uint16_t                 u16RxPos;   /*!< 接收数据段内位置 */
+    uint32_t                 u32TxLeft;  /*!< 当前事务未写入DR的字数 */
+    uint32_t                 u32RxLeft;  /*!< 当前事务未接收的字数 */
+    volatile uint32_t        u32Pending; /*!< 未完成的事务数（含当前事务） */
+    volatile uint32_t        u32XferCnt; /*!< 完成的事务数 */
+    volatile uint32_t        u32OvfCnt;  /*!< 接收上溢次数（中断响应超过一帧时间） */
+    stc_int_cb_t             stcIntCb;   /*!< 内部使用：中断回调节点 */
+} stc_spi_async_t;
+
+/**
+ * @brief  SPI从机双缓冲接收完成回调（SPI中断中调用）：u8Buf为交出的缓冲下标（0/1），u16Len为收到的字数，
+ *         u32Status @ref SPI_Slave_Status。处理完后以SPI_SlaveStreamRelease()归还，可在回调中归还或稍后在主循环中归还
+ */
+typedef void (*func_ptr_spi_slave_t)(uint8_t u8Buf, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+
+/**
+ * @brief  SPI从机双缓冲配置：数据宽度不超过8位时缓冲为uint8_t，否则为uint16_t
+ */
+typedef struct
+{
+    void                *apvRx[2]; /*!< 接收缓冲 */
+    const void          *apvTx[2]; /*!< 发送缓冲，与同下标的接收缓冲在同一次片选内使用；NULL时发送u16Fill */
+    uint16_t             u16Size;  /*!< 每个缓冲的字数 */
+    uint16_t             u16Fill;  /*!< 发送缓冲为NULL或主机读取超过u16Size时发送的值 */
+    func_ptr_spi_slave_t pfnDone;  /*!< 接收完成回调 */
+    void                *pvArg;    /*!< 回调参数 */
+} stc_spi_slave_init_t;
+
+/**
+ * @brief  SPI从机双缓冲控制块（由调用者分配，使用期间不可释放）
+ */
+typedef struct
+{
+    SPI_TypeDef         *SPIx;      /*!< SPI通道 */
+    void                *apvRx[2];  /*!< 接收缓冲 */
+    const void          *apvTx[2];  /*!< 发送缓冲 */
+    uint16_t             u16Size;   /*!< 每个缓冲的字数 */
+    uint16_t             u16Fill;   /*!< 发送填充值 */
+    boolean_t            b16Bit;    /*!< 缓冲为uint16_t */
+    uint8_t              u8Cur;     /*!< 正在收发的缓冲下标 */
+    volatile uint8_t     u8Owned;   /*!< 已交给应用未归还的缓冲（bit0/bit1） */
+    uint32_t             u32RxPos;  /*!< 本次片选已收到的字数（含上溢丢失的字） */
+    uint32_t             u32TxPos;  /*!< 本次片选已写入DR的字数 */
+    uint32_t             u32Status; /*!< 本次片选的状态 */
+    func_ptr_spi_slave_t pfnDone;   /*!< 接收完成回调 */
+    void                *pvArg;     /*!< 回调参数 */
+
+    volatile uint32_t u32FrameCnt; /*!< 交出的缓冲数（NSS上升沿） */
+    volatile uint32_t u32DropCnt;  /*!< 两个缓冲都未归还而丢弃的片选数 */
+    volatile uint32_t u32OvfCnt;   /*!< 接收上溢（丢失的字）次数 */
+    volatile uint32_t u32UdfCnt;   /*!< 发送下溢次数 */
+
+    stc_int_cb_t stcIntCb; /*!< 内部使用：中断回调节点 */
+} stc_spi_slave_t;
 /**
  * @}
  */
@@ -271,6 +383,31 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup SPI_Xfer_Status SPI异步事务状态
+ * @{
+ */
+#define SPI_XFER_STS_OK     (0x00u) /*!< 完成 */
+#define SPI_XFER_STS_QUEUED (0x01u) /*!< 在队列中等待 */
+#define SPI_XFER_STS_ACTIVE (0x02u) /*!< 正在传输 */
+#define SPI_XFER_STS_OVF    (0x04u) /*!< 已完成，但传输中接收上溢，有接收数据丢失 */
+#define SPI_XFER_STS_ABORT  (0x08u) /*!< 被SPI_AsyncAbort()中止 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPI_Slave_Status SPI从机双缓冲接收状态
+ * @{
+ */
+#define SPI_SLAVE_STS_OK    (0x00u) /*!< 正常 */
+#define SPI_SLAVE_STS_OVF   (0x01u) /*!< 接收上溢，有字丢失（其位置保留原内容） */
+#define SPI_SLAVE_STS_UDF   (0x02u) /*!< 发送下溢，主机收到的数据有误 */
+#define SPI_SLAVE_STS_TRUNC (0x04u) /*!< 主机发送超过缓冲长度，超出部分丢弃 */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -289,12 +426,36 @@ en_result_t SPI_Init(SPI_TypeDef *SPIx, stc_spi_init_t *pstcInitConfig); /* SPI
 en_result_t SPI_DataTransmit(SPI_TypeDef *SPIx, uint16_t u16Data); /* SPI 发送一数据函数 */
 uint16_t    SPI_DataReceive(SPI_TypeDef *SPIx);                    /* SPI 接收一数据函数 */
 
-en_result_t SPI_SlaveDummyDataTransmit(SPI_TypeDef *SPIx, uint16_t u16Data);                             /* SPI 从机预准备第一个数据 */
-en_result_t SPI_SlaveDummyDataTransmitTimeout(SPI_TypeDef *SPIx, uint16_t u16Data, uint32_t u32Timeout); /* SPI 从机预准备第一个数据超时等待 */
+en_result_t SPI_SlaveDummyDataTransmit(SPI_TypeDef *SPIx, uint16_t u16Data);                                 /* SPI 从机预准备第一个数据 */
+en_result_t SPI_SlaveDummyDataTransmitTimeout(SPI_TypeDef *SPIx, uint16_t u16Data, uint32_t u32Timeout);     /* SPI 从机预准备第一个数据超时等待 */
+en_result_t SPI_SlaveDummyDataTransmitTimeoutUs(SPI_TypeDef *SPIx, uint16_t u16Data, uint32_t u32TimeoutUs); /* SPI 从机预准备第一个数据超时等待（微秒） */
 
 en_result_t SPI_TransmitReceive(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len); /* SPI 连续发送接收多个数据函数 */
-/* SPI 连续发送接收多个数据函数超时等待 */
+/* SPI 连续发送接收多个数据函数超时等待（查询次数/微秒） */
 en_result_t SPI_TransmitReceiveTimeout(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len, uint32_t u32Timeout);
+en_result_t SPI_TransmitReceiveTimeoutUs(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len, uint32_t u32TimeoutUs);
+
+en_result_t SPI_Transmit8(SPI_TypeDef *SPIx, const uint8_t *pu8Data, uint32_t u32Len, uint32_t u32TimeoutUs);    /* SPI 连续发送8位数据（丢弃接收） */
+en_result_t SPI_Transmit16(SPI_TypeDef *SPIx, const uint16_t *pu16Data, uint32_t u32Len, uint32_t u32TimeoutUs); /* SPI 连续发送16位数据（丢弃接收） */
+/* SPI 连续接收8/16位数据（发送填充值） */
+en_result_t SPI_Receive8(SPI_TypeDef *SPIx, uint8_t *pu8Data, uint32_t u32Len, uint8_t u8Fill, uint32_t u32TimeoutUs);
+en_result_t SPI_Receive16(SPI_TypeDef *SPIx, uint16_t *pu16Data, uint32_t u32Len, uint16_t u16Fill, uint32_t u32TimeoutUs);
+/* SPI 全双工连续收发8/16位数据 */
+en_result_t SPI_TransmitReceive8(SPI_TypeDef *SPIx, const uint8_t *pu8Tx, uint8_t *pu8Rx, uint32_t u32Len, uint32_t u32TimeoutUs);
+en_result_t SPI_TransmitReceive16(SPI_TypeDef *SPIx, const uint16_t *pu16Tx, uint16_t *pu16Rx, uint32_t u32Len, uint32_t u32TimeoutUs);
+
+void        SPI_XferStcInit(stc_spi_xfer_t *pstcXfer);                                                     /* 异步事务描述初始化 */
+en_result_t SPI_AsyncInit(SPI_TypeDef *SPIx, stc_spi_async_t *pstcAsync, en_irq_priority_level_t enLevel); /* 异步事务队列初始化 */
+void        SPI_AsyncDeInit(stc_spi_async_t *pstcAsync);                                                   /* 异步事务队列停止 */
+en_result_t SPI_AsyncSubmit(stc_spi_async_t *pstcAsync, stc_spi_xfer_t *pstcXfer);                         /* 提交异步事务 */
+void        SPI_AsyncAbort(stc_spi_async_t *pstcAsync);                                                    /* 中止全部异步事务 */
+uint32_t    SPI_AsyncPendingGet(const stc_spi_async_t *pstcAsync);                                         /* 未完成的事务数 */
+
+void        SPI_SlaveStreamStcInit(stc_spi_slave_init_t *pstcInit); /* 从机双缓冲配置初始化 */
+en_result_t SPI_SlaveStreamInit(SPI_TypeDef *SPIx, stc_spi_slave_t *pstcSlave, const stc_spi_slave_init_t *pstcInit,
+                                en_irq_priority_level_t enLevel);   /* 从机双缓冲收发初始化 */
+void        SPI_SlaveStreamDeInit(stc_spi_slave_t *pstcSlave);     /* 从机双缓冲收发停止 */
+en_result_t SPI_SlaveStreamRelease(stc_spi_slave_t *pstcSlave, uint8_t u8Buf); /* 归还已处理的缓冲 */
 
 void SPI_Enable(SPI_TypeDef *SPIx);  /* 开启SPI模块 */
 void SPI_Disable(SPI_TypeDef *SPIx); /* 禁止SPI模块 */
@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2024-11-18       MADS            First version
+   2026-10-18       MADS            Fix BTIM_OneShotSet() ignoring the mode parameter
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -177,7 +178,7 @@ void BTIM_CounterClockDivSet(BTIM_TypeDef *BTIMx, uint32_t u32CounterClockDiv)
  */
 void BTIM_OneShotSet(BTIM_TypeDef *BTIMx, uint32_t u32OneShotMode)
 {
-    MODIFY_REG32(BTIMx->CR, BTIM_CR_OST_Msk, BTIM_ONESHOT_COUNTER);
+    MODIFY_REG32(BTIMx->CR, BTIM_CR_OST_Msk, u32OneShotMode);
 }
 
 /**
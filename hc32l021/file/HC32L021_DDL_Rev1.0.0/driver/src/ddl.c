@@ -36,18 +36,90 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @brief  时基换算系数：整数部分 + 小数部分 / 2^64
+ */
+typedef struct
+{
+    uint64_t u64Int;  /*!< 整数部分 */
+    uint64_t u64Frac; /*!< 小数部分（Q64，向上取整） */
+} stc_ddl_tick_ratio_t;
+
+#if defined(DDL_MMIO_TRACE)
+/**
+ * @brief  外设地址区间
+ */
+typedef struct
+{
+    const char *pcName;  /*!< 外设名 */
+    uint32_t    u32Base; /*!< 基地址 */
+    uint32_t    u32Size; /*!< 区间大小 */
+} stc_ddl_mmio_periph_t;
+#endif /* DDL_MMIO_TRACE */
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+#define DDL_ARRAY_SZ(x) (sizeof(x) / sizeof((x)[0]))
+
+#define DDL_DELAY_SLEEP_MIN (1000u) /* 休眠延时：剩余不足此HCLK周期数时忙等（重设SysTick及唤醒的开销） */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static void     DelayTick(uint64_t u64Tick);
+static void     TickReload(uint32_t u32Period, uint32_t u32Ctrl);
+static void     TickClockCheck(uint64_t u64Tick);
+static void     TickRatioCalc(uint32_t u32Num, uint32_t u32Den, stc_ddl_tick_ratio_t *pstcRatio);
+static uint64_t TickRatioMul(uint64_t u64Value, const stc_ddl_tick_ratio_t *pstcRatio);
+#if defined(DDL_MMIO_TRACE)
+static const char *MmioPeriphGet(uint32_t u32Addr);
+#endif /* DDL_MMIO_TRACE */
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static volatile uint64_t    m_u64TickBase    = 0u;          /* 最近一次重装时的时基计数 */
+static uint32_t             m_u32TickLastVal = 0xFFFFFFFFu; /* 上次读到的VAL */
+static boolean_t            m_bTickPendCnt   = FALSE;       /* 挂起中的溢出已计入时基 */
+static uint32_t             m_u32TickClock   = 0u;          /* 换算系数对应的HCLK */
+static uint64_t             m_u64TickEpoch   = 0u;          /* 换算起点（时基计数） */
+static uint64_t             m_u64UsEpoch     = 0u;          /* 换算起点（微秒） */
+static stc_ddl_tick_ratio_t m_stcUsPerTick   = {0u, 0u};
+static stc_ddl_tick_ratio_t m_stcTickPerUs   = {0u, 0u};
+static uint32_t             m_u32DelayMode   = DDL_DELAY_MD_BUSY; /* 延时模式 */
+#if defined(DDL_MMIO_TRACE)
+static const stc_ddl_mmio_periph_t m_astcMmioPeriph[] = {
+    {"LPUART0", LPUART0_BASE, 0x400u},
+    {"SPI", SPI_BASE, 0x400u},
+    {"IWDT", IWDT_BASE, 0x400u},
+    {"RTC", RTC_BASE, 0x400u},
+    {"GTIM0", GTIM0_BASE, 0x400u},
+    {"GTIM1", GTIM1_BASE, 0x400u},
+    {"ADC", ADC_BASE, 0x400u},
+    {"VC", VC_BASE, 0x400u},
+    {"LVD", LVD_BASE, 0x400u},
+    {"LPUART1", LPUART1_BASE, 0x400u},
+    {"TRNG", TRNG_BASE, 0x400u},
+    {"CTRIM", CTRIM_BASE, 0x400u},
+    {"ATIM3", ATIM3_MODE0_BASE, 0x400u},
+    {"HSI2C", HSI2C_BASE, 0x400u},
+    {"FLASH", FLASH_BASE, 0x400u},
+    {"GPIO", GPIOA_BASE, 0x400u},
+    {"SYSCTRL", SYSCTRL_BASE, 0x400u},
+    {"FLASHMEM", 0x00000000u, 0x10000u},
+    {"INFO", 0x00100000u, 0x1000u},
+    {"SCS", 0xE000E000u, 0x1000u},
+    {"OTHER", 0x00000000u, 0x0u},
+};
+
+static stc_ddl_mmio_site_t m_astcMmioSite[DDL_MMIO_TRACE_SITE_NUM];
+static stc_ddl_mmio_log_t  m_astcMmioLog[DDL_MMIO_TRACE_LOG_DEPTH];
+static uint32_t            m_u32MmioSiteCnt = 0u;
+static uint32_t            m_u32MmioLogCnt  = 0u;
+static uint32_t            m_u32MmioDropCnt = 0u;
+static boolean_t           m_bMmioEnable    = TRUE;
+#endif /* DDL_MMIO_TRACE */
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -87,51 +159,619 @@ uint32_t Log2(uint32_t u32Value)
  */
 void DDL_MemoryClear(void *pu8StartAddr, uint32_t u32Count)
 {
-    uint8_t *pu8Addr = (uint8_t *)pu8StartAddr;
+    DDL_MemorySet(pu8StartAddr, 0u, u32Count);
+}
+
+/**
+ * @brief  memory填充函数
+ * @param  [in] pvDst 起始地址
+ * @param  [in] u8Value 填充值
+ * @param  [in] u32Count 填充长度，以字节为单位
+ * @retval None
+ * @note   首尾不足一个字的部分按字节写，中间部分按字写（每次循环4个字，可编译为STM）
+ */
+void DDL_MemorySet(void *pvDst, uint8_t u8Value, uint32_t u32Count)
+{
+    uint8_t  *pu8Dst = (uint8_t *)pvDst;
+    uint32_t *pu32Dst;
+    uint32_t  u32Value;
 
-    if (NULL == pu8Addr)
+    if (NULL == pu8Dst)
     {
         return;
     }
 
-    while (u32Count--)
+    /* 头部：对齐到字边界 */
+    while ((0u != u32Count) && (0u != ((uintptr_t)pu8Dst & 3u)))
+    {
+        *pu8Dst++ = u8Value;
+        u32Count--;
+    }
+
+    pu32Dst  = (uint32_t *)(void *)pu8Dst;
+    u32Value = (uint32_t)u8Value * 0x01010101u;
+    while (u32Count >= 16u)
+    {
+        pu32Dst[0] = u32Value;
+        pu32Dst[1] = u32Value;
+        pu32Dst[2] = u32Value;
+        pu32Dst[3] = u32Value;
+        pu32Dst += 4u;
+        u32Count -= 16u;
+    }
+    while (u32Count >= 4u)
+    {
+        *pu32Dst++ = u32Value;
+        u32Count -= 4u;
+    }
+
+    /* 尾部 */
+    pu8Dst = (uint8_t *)pu32Dst;
+    while (0u != u32Count)
     {
-        *pu8Addr++ = 0;
+        *pu8Dst++ = u8Value;
+        u32Count--;
     }
 }
 
 /**
- * @brief  1ms延时函数
- * @param  [in] u32Count 延时时长，单位1ms
+ * @brief  memory复制函数
+ * @param  [out] pvDst 目标地址
+ * @param  [in] pvSrc 源地址
+ * @param  [in] u32Count 复制长度，以字节为单位
  * @retval None
+ * @note   源与目标不可重叠；两者地址低2位相同时中间部分按字复制，否则（M0+不支持非对齐访问）按字节复制
  */
-void DDL_Delay1ms(uint32_t u32Count)
+void DDL_MemoryCopy(void *pvDst, const void *pvSrc, uint32_t u32Count)
 {
-    uint32_t u32ValueNow = 0, u32ValueCount = 0;
-    uint32_t u32ValueEnd = (u32Count * (SystemCoreClock / 1000));
+    uint8_t        *pu8Dst = (uint8_t *)pvDst;
+    const uint8_t  *pu8Src = (const uint8_t *)pvSrc;
+    uint32_t       *pu32Dst;
+    const uint32_t *pu32Src;
 
-    uint32_t u32ValueStart = SysTick->VAL;
-    while (1)
+    if ((NULL == pu8Dst) || (NULL == pu8Src))
     {
-        u32ValueNow = SysTick->VAL;
+        return;
+    }
 
-        if (u32ValueNow != u32ValueStart)
+    if (0u == (((uintptr_t)pu8Dst ^ (uintptr_t)pu8Src) & 3u))
+    {
+        while ((0u != u32Count) && (0u != ((uintptr_t)pu8Dst & 3u)))
         {
-            if (u32ValueNow < u32ValueStart)
-            {
-                u32ValueCount += u32ValueStart - u32ValueNow;
-            }
-            else
+            *pu8Dst++ = *pu8Src++;
+            u32Count--;
+        }
+
+        pu32Dst = (uint32_t *)(void *)pu8Dst;
+        pu32Src = (const uint32_t *)(const void *)pu8Src;
+        while (u32Count >= 16u)
+        {
+            pu32Dst[0] = pu32Src[0];
+            pu32Dst[1] = pu32Src[1];
+            pu32Dst[2] = pu32Src[2];
+            pu32Dst[3] = pu32Src[3];
+            pu32Dst += 4u;
+            pu32Src += 4u;
+            u32Count -= 16u;
+        }
+        while (u32Count >= 4u)
+        {
+            *pu32Dst++ = *pu32Src++;
+            u32Count -= 4u;
+        }
+        pu8Dst = (uint8_t *)pu32Dst;
+        pu8Src = (const uint8_t *)pu32Src;
+    }
+
+    while (0u != u32Count)
+    {
+        *pu8Dst++ = *pu8Src++;
+        u32Count--;
+    }
+}
+
+/**
+ * @brief  memory比较函数
+ * @param  [in] pvBuf1 地址1
+ * @param  [in] pvBuf2 地址2
+ * @param  [in] u32Count 比较长度，以字节为单位
+ * @retval int32_t
+ *           - 0: 相同（或地址为NULL）
+ *           - <0: 第一个不同的字节pvBuf1中较小
+ *           - >0: 第一个不同的字节pvBuf1中较大
+ * @note   两者地址低2位相同时中间部分按字比较，遇到不同的字再按字节定位
+ */
+int32_t DDL_MemoryCompare(const void *pvBuf1, const void *pvBuf2, uint32_t u32Count)
+{
+    const uint8_t  *pu8Buf1 = (const uint8_t *)pvBuf1;
+    const uint8_t  *pu8Buf2 = (const uint8_t *)pvBuf2;
+    const uint32_t *pu32Buf1;
+    const uint32_t *pu32Buf2;
+
+    if ((NULL == pu8Buf1) || (NULL == pu8Buf2))
+    {
+        return 0;
+    }
+
+    if (0u == (((uintptr_t)pu8Buf1 ^ (uintptr_t)pu8Buf2) & 3u))
+    {
+        while ((0u != u32Count) && (0u != ((uintptr_t)pu8Buf1 & 3u)))
+        {
+            if (*pu8Buf1 != *pu8Buf2)
             {
-                u32ValueCount += SysTick->LOAD - u32ValueNow + u32ValueStart;
-            }
-            u32ValueStart = u32ValueNow;
-            if (u32ValueCount >= u32ValueEnd)
-            {
-                break;
+                return (int32_t)*pu8Buf1 - (int32_t)*pu8Buf2;
             }
+            pu8Buf1++;
+            pu8Buf2++;
+            u32Count--;
+        }
+
+        pu32Buf1 = (const uint32_t *)(const void *)pu8Buf1;
+        pu32Buf2 = (const uint32_t *)(const void *)pu8Buf2;
+        while ((u32Count >= 4u) && (*pu32Buf1 == *pu32Buf2))
+        {
+            pu32Buf1++;
+            pu32Buf2++;
+            u32Count -= 4u;
+        }
+        pu8Buf1 = (const uint8_t *)pu32Buf1;
+        pu8Buf2 = (const uint8_t *)pu32Buf2;
+    }
+
+    while (0u != u32Count)
+    {
+        if (*pu8Buf1 != *pu8Buf2)
+        {
+            return (int32_t)*pu8Buf1 - (int32_t)*pu8Buf2;
+        }
+        pu8Buf1++;
+        pu8Buf2++;
+        u32Count--;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  饱和加法
+ * @param  [in] i32A 加数
+ * @param  [in] i32B 加数
+ * @retval int32_t 和，溢出时为INT32_MAX或INT32_MIN
+ */
+int32_t DDL_SatAdd(int32_t i32A, int32_t i32B)
+{
+    int32_t i32Sum = (int32_t)((uint32_t)i32A + (uint32_t)i32B);
+
+    /* 同号相加结果变号即溢出 */
+    if ((0 <= (i32A ^ i32B)) && (0 > (i32A ^ i32Sum)))
+    {
+        i32Sum = (0 > i32A) ? INT32_MIN : INT32_MAX;
+    }
+
+    return i32Sum;
+}
+
+/**
+ * @brief  饱和减法
+ * @param  [in] i32A 被减数
+ * @param  [in] i32B 减数
+ * @retval int32_t 差，溢出时为INT32_MAX或INT32_MIN
+ */
+int32_t DDL_SatSub(int32_t i32A, int32_t i32B)
+{
+    int32_t i32Diff = (int32_t)((uint32_t)i32A - (uint32_t)i32B);
+
+    /* 异号相减结果与被减数变号即溢出 */
+    if ((0 > (i32A ^ i32B)) && (0 > (i32A ^ i32Diff)))
+    {
+        i32Diff = (0 > i32A) ? INT32_MIN : INT32_MAX;
+    }
+
+    return i32Diff;
+}
+
+/**
+ * @brief  Q16.16乘法
+ * @param  [in] i32A 乘数（Q16.16）
+ * @param  [in] i32B 乘数（Q16.16）
+ * @retval int32_t 积（Q16.16），四舍五入（0.5远离0），溢出时饱和
+ */
+int32_t DDL_Q16Mul(int32_t i32A, int32_t i32B)
+{
+    int64_t  i64Prod = (int64_t)i32A * i32B;
+    uint64_t u64Abs  = (0 > i64Prod) ? (0u - (uint64_t)i64Prod) : (uint64_t)i64Prod;
+
+    u64Abs = (u64Abs + (1u << (DDL_Q16_SHIFT - 1u))) >> DDL_Q16_SHIFT;
+    if (0 > i64Prod)
+    {
+        return (u64Abs > 0x80000000u) ? INT32_MIN : (int32_t)(0u - (uint32_t)u64Abs);
+    }
+
+    return (u64Abs > (uint64_t)INT32_MAX) ? INT32_MAX : (int32_t)u64Abs;
+}
+
+/**
+ * @brief  Q16.16除法
+ * @param  [in] i32A 被除数（Q16.16）
+ * @param  [in] i32B 除数（Q16.16）
+ * @retval int32_t 商（Q16.16），四舍五入（0.5远离0），溢出或除数为0时按被除数符号饱和
+ */
+int32_t DDL_Q16Div(int32_t i32A, int32_t i32B)
+{
+    uint64_t  u64Num = (0 > i32A) ? (0u - (uint64_t)(int64_t)i32A) : (uint64_t)i32A;
+    uint64_t  u64Den = (0 > i32B) ? (0u - (uint64_t)(int64_t)i32B) : (uint64_t)i32B;
+    uint64_t  u64Quot;
+    boolean_t bNeg = ((0 > i32A) != (0 > i32B)) ? TRUE : FALSE;
+
+    if (0u == u64Den)
+    {
+        return (0 > i32A) ? INT32_MIN : INT32_MAX;
+    }
+
+    u64Quot = ((u64Num << DDL_Q16_SHIFT) + (u64Den >> 1u)) / u64Den;
+    if (TRUE == bNeg)
+    {
+        return (u64Quot > 0x80000000u) ? INT32_MIN : (int32_t)(0u - (uint32_t)u64Quot);
+    }
+
+    return (u64Quot > (uint64_t)INT32_MAX) ? INT32_MAX : (int32_t)u64Quot;
+}
+
+/**
+ * @brief  Q16.16四舍五入取整（与roundf()相同，0.5远离0）
+ * @param  [in] i32A Q16.16数
+ * @retval int32_t 整数
+ */
+int32_t DDL_Q16Round(int32_t i32A)
+{
+    uint32_t u32Abs = (0 > i32A) ? (0u - (uint32_t)i32A) : (uint32_t)i32A;
+
+    u32Abs = (u32Abs + (1u << (DDL_Q16_SHIFT - 1u))) >> DDL_Q16_SHIFT;
+
+    return (0 > i32A) ? (int32_t)(0u - u32Abs) : (int32_t)u32Abs;
+}
+
+/**
+ * @brief  无符号除法，结果四舍五入（与浮点(uint32_t)(n / d + 0.5f)的精确值相同）
+ * @param  [in] u32Num 被除数
+ * @param  [in] u32Den 除数
+ * @retval uint32_t 商，除数为0时返回0xFFFFFFFF
+ */
+uint32_t DDL_UDivRound(uint32_t u32Num, uint32_t u32Den)
+{
+    uint32_t u32Quot;
+    uint32_t u32Rem;
+
+    if (0u == u32Den)
+    {
+        return 0xFFFFFFFFu;
+    }
+
+    u32Quot = u32Num / u32Den;
+    u32Rem  = u32Num - (u32Quot * u32Den);
+    /* 余数不小于除数的一半时进位，避免u32Num + u32Den / 2溢出 */
+    if (u32Rem >= (u32Den - u32Rem))
+    {
+        u32Quot++;
+    }
+
+    return u32Quot;
+}
+
+/**
+ * @brief  常数除法倒数计算
+ * @param  [out] pstcRecip 倒数
+ * @param  [in] u32Div 除数（非0）
+ * @retval None
+ * @note   除数为编译时常量时可直接用DDL_RECIP_INIT()初始化，省去运行时除法
+ */
+void DDL_RecipInit(stc_ddl_recip_t *pstcRecip, uint32_t u32Div)
+{
+    pstcRecip->u32Div = (0u == u32Div) ? 1u : u32Div;
+    pstcRecip->u32Mul = 0xFFFFFFFFu / pstcRecip->u32Div;
+}
+
+/**
+ * @brief  倒数乘法实现的除法：u32Num / u32Div
+ * @param  [in] u32Num 被除数
+ * @param  [in] pstcRecip 除数的倒数 @ref DDL_RecipInit()
+ * @retval uint32_t 商（向下取整，对全部32位被除数精确）
+ * @note   一次32x32位乘法取高32位，估计值偏小至多2，再由余数修正
+ */
+uint32_t DDL_RecipDiv(uint32_t u32Num, const stc_ddl_recip_t *pstcRecip)
+{
+    uint32_t u32Quot = (uint32_t)(((uint64_t)u32Num * pstcRecip->u32Mul) >> 32u);
+
+    while ((u32Num - (u32Quot * pstcRecip->u32Div)) >= pstcRecip->u32Div)
+    {
+        u32Quot++;
+    }
+
+    return u32Quot;
+}
+
+/**
+ * @brief  SysTick时基初始化：设置重载周期并使能SysTick溢出中断，计数保持连续
+ * @param  [in] u32Period 溢出周期（HCLK周期数），范围1~0x1000000
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - ErrorInvalidParameter: 无效参数
+ * @note   与SysTick_Config()相同，SysTick中断优先级设为最低；用户SysTick_IRQHandler()
+ *         仍在每次溢出时调用。直接调用SysTick_Config()或改写SysTick寄存器会使时基不连续
+ */
+en_result_t DDL_TickInit(uint32_t u32Period)
+{
+    uint32_t u32Primask;
+
+    if ((u32Period - 1u) > SysTick_LOAD_RELOAD_Msk)
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    NVIC_SetPriority(SysTick_IRQn, (1u << __NVIC_PRIO_BITS) - 1u);
+    TickReload(u32Period, SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  SysTick溢出处理：时基累加一个重载周期（已由DDL_TickGet()计入时跳过）
+ * @retval None
+ * @note   由SysTick_Handler()在调用SysTick_IRQHandler()之前调用
+ */
+void DDL_TickIrqHandler(void)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    /* 本次溢出未被DDL_TickGet()计入时在此累加；进入中断时挂起已由硬件清除 */
+    if (FALSE == m_bTickPendCnt)
+    {
+        m_u64TickBase += (uint64_t)(SysTick->LOAD & SysTick_LOAD_RELOAD_Msk) + 1u;
+    }
+    m_bTickPendCnt   = FALSE;
+    m_u32TickLastVal = SysTick->VAL;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  获取单调递增的64位时基计数
+ * @retval uint64_t 自上电起的HCLK周期数
+ * @note   每次调用由VAL回绕及SysTick挂起标志检测溢出并计入时基，不依赖SysTick中断：
+ *         在优先级不低于SysTick的中断（包括SysTick中断本身）或关中断期间调用时时基照常前进。
+ *         溢出中断使能时（DDL_TickInit()或SysTick_Config()）中断保证每个周期至少更新一次；
+ *         中断无法响应或未使能溢出中断时（SystemInit()默认配置），两次调用间隔须小于一个重载周期
+ *         （挂起标志可补足一次）
+ */
+uint64_t DDL_TickGet(void)
+{
+    uint64_t u64Base;
+    uint32_t u32Load;
+    uint32_t u32Val;
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    u32Load = SysTick->LOAD & SysTick_LOAD_RELOAD_Msk;
+    u32Val  = SysTick->VAL;
+    /* 溢出已挂起但中断尚未响应（关中断，或在不低于SysTick优先级的中断中）：
+       重读VAL保证其为溢出后的值；同一次挂起只计入一次 */
+    if ((FALSE == m_bTickPendCnt) && (0u != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)))
+    {
+        u32Val         = SysTick->VAL;
+        m_bTickPendCnt = TRUE;
+        m_u64TickBase += (uint64_t)u32Load + 1u;
+    }
+    /* 再次回绕（挂起期间或未使能溢出中断时）：VAL大于上次读到的值 */
+    else if (u32Val > m_u32TickLastVal)
+    {
+        m_bTickPendCnt = (0u != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) ? TRUE : FALSE;
+        m_u64TickBase += (uint64_t)u32Load + 1u;
+    }
+    else
+    {
+        ;
+    }
+    m_u32TickLastVal = u32Val;
+    u64Base          = m_u64TickBase;
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return u64Base + (u32Load - u32Val);
+}
+
+/**
+ * @brief  获取单调递增的64位微秒时间
+ * @retval uint64_t 自上电起的微秒数
+ * @note   HCLK（SystemCoreClock）变化后首次调用时以当前时间为新起点重新计算换算系数，
+ *         此后换算只用乘法和移位
+ */
+uint64_t DDL_TimeUsGet(void)
+{
+    stc_ddl_tick_ratio_t stcRatio;
+    uint64_t             u64Tick;
+    uint64_t             u64TickEpoch;
+    uint64_t             u64UsEpoch;
+    uint32_t             u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    u64Tick = DDL_TickGet();
+    TickClockCheck(u64Tick);
+    stcRatio     = m_stcUsPerTick;
+    u64TickEpoch = m_u64TickEpoch;
+    u64UsEpoch   = m_u64UsEpoch;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return u64UsEpoch + TickRatioMul(u64Tick - u64TickEpoch, &stcRatio);
+}
+
+/**
+ * @brief  时基计数换算为微秒（向下取整，按当前HCLK）
+ * @param  [in] u64Tick HCLK周期数
+ * @retval uint64_t 微秒数
+ */
+uint64_t DDL_TickToUs(uint64_t u64Tick)
+{
+    TickClockCheck(DDL_TickGet());
+
+    return TickRatioMul(u64Tick, &m_stcUsPerTick);
+}
+
+/**
+ * @brief  微秒换算为时基计数（向上取整，按当前HCLK）
+ * @param  [in] u64Us 微秒数
+ * @retval uint64_t HCLK周期数
+ */
+uint64_t DDL_UsToTick(uint64_t u64Us)
+{
+    uint64_t u64Tick;
+
+    TickClockCheck(DDL_TickGet());
+    u64Tick = TickRatioMul(u64Us, &m_stcTickPerUs);
+
+    /* 换算系数含小数时乘积向下取整，补1保证不短于设定时长 */
+    return ((0u != m_stcTickPerUs.u64Frac) && (0u != u64Us)) ? (u64Tick + 1u) : u64Tick;
+}
+
+/**
+ * @brief  设定超时截止时间：从当前时刻起经过u32TimeoutUs微秒后到期
+ * @param  [out] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @param  [in] u32TimeoutUs 超时时间，单位us；DDL_TIMEOUT_FOREVER表示永不超时
+ * @note   按设定时的HCLK换算为时基计数，等待过程中切换HCLK时实际时长按比例变化；
+ *         SysTick停止（时基不前进）时按每次查询至少一个HCLK周期折算为查询次数，
+ *         超时仍能结束且不短于设定值
+ * @retval None
+ */
+void DDL_DeadlineInit(stc_ddl_deadline_t *pstcDeadline, uint32_t u32TimeoutUs)
+{
+    uint64_t u64Tick;
+
+    pstcDeadline->bCount  = FALSE;
+    pstcDeadline->u64Last = DDL_TickGet();
+    if (DDL_TIMEOUT_FOREVER == u32TimeoutUs)
+    {
+        pstcDeadline->u64Expire = 0xFFFFFFFFFFFFFFFFull;
+        pstcDeadline->u32Count  = 0xFFFFFFFFu;
+    }
+    else
+    {
+        u64Tick                 = DDL_UsToTick(u32TimeoutUs);
+        pstcDeadline->u64Expire = pstcDeadline->u64Last + u64Tick;
+        pstcDeadline->u32Count  = (u64Tick > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)u64Tick;
+    }
+}
+
+/**
+ * @brief  按查询次数设定超时：第u32Count + 1次调用DDL_DeadlineExpired()时到期
+ * @param  [out] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @param  [in] u32Count 查询次数，实际时长随HCLK及编译优化变化
+ * @retval None
+ */
+void DDL_DeadlineCountInit(stc_ddl_deadline_t *pstcDeadline, uint32_t u32Count)
+{
+    pstcDeadline->bCount    = TRUE;
+    pstcDeadline->u64Expire = 0xFFFFFFFFFFFFFFFFull;
+    pstcDeadline->u64Last   = 0u;
+    pstcDeadline->u32Count  = u32Count;
+}
+
+/**
+ * @brief  判断是否已到达超时截止时间
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval boolean_t
+ *           - TRUE: 已超时
+ *           - FALSE: 未超时
+ */
+boolean_t DDL_DeadlineExpired(stc_ddl_deadline_t *pstcDeadline)
+{
+    uint64_t u64Tick;
+
+    if (FALSE == pstcDeadline->bCount)
+    {
+        if (0xFFFFFFFFFFFFFFFFull == pstcDeadline->u64Expire)
+        {
+            return FALSE;
+        }
+        u64Tick = DDL_TickGet();
+        if (u64Tick >= pstcDeadline->u64Expire)
+        {
+            return TRUE;
+        }
+        if (u64Tick != pstcDeadline->u64Last)
+        {
+            pstcDeadline->u64Last = u64Tick;
+            return FALSE;
         }
+        /* 时基未前进（SysTick停止）：按剩余查询次数判断 */
+    }
+
+    if (0u == pstcDeadline->u32Count)
+    {
+        return TRUE;
+    }
+    pstcDeadline->u32Count--;
+
+    return FALSE;
+}
+
+/**
+ * @brief  延时模式设置
+ * @param  [in] u32Mode 延时模式 @ref DDL_Delay_Mode
+ *           - DDL_DELAY_MD_BUSY: 忙等
+ *           - DDL_DELAY_MD_SLEEP: 休眠等待
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - ErrorInvalidParameter: 无效参数
+ * @note   休眠模式下SysTick溢出中断未使能时，每次延时临时以不超过剩余时长的最大周期
+ *         （最长0x1000000个HCLK周期）使能溢出中断，通常只唤醒一次，结束后恢复SysTick设置；
+ *         已使能时（DDL_TickInit()）保持用户周期，每次溢出唤醒一次。延时时长及DDL_Delay1ms()
+ *         等接口语义与忙等模式相同
+ */
+en_result_t DDL_DelayModeSet(uint32_t u32Mode)
+{
+    if ((DDL_DELAY_MD_BUSY != u32Mode) && (DDL_DELAY_MD_SLEEP != u32Mode))
+    {
+        return ErrorInvalidParameter;
     }
+    m_u32DelayMode = u32Mode;
+
+    return Ok;
+}
+
+/**
+ * @brief  延时模式获取
+ * @retval uint32_t 延时模式 @ref DDL_Delay_Mode
+ */
+uint32_t DDL_DelayModeGet(void)
+{
+    return m_u32DelayMode;
+}
+
+/**
+ * @brief  1ms延时函数
+ * @param  [in] u32Count 延时时长，单位1ms
+ * @retval None
+ */
+void DDL_Delay1ms(uint32_t u32Count)
+{
+    DelayTick(DDL_UsToTick((uint64_t)u32Count * 1000u));
 }
 
 /**
@@ -141,69 +781,472 @@ void DDL_Delay1ms(uint32_t u32Count)
  */
 void DDL_Delay100us(uint32_t u32Count)
 {
-    uint32_t u32ValueNow = 0, u32ValueCount = 0;
-    uint32_t u32ValueEnd = (u32Count * (SystemCoreClock / 10000));
+    DelayTick(DDL_UsToTick((uint64_t)u32Count * 100u));
+}
 
-    uint32_t u32ValueStart = SysTick->VAL;
-    while (1)
+/**
+ * @brief  10us延时函数
+ * @param  [in] u32Count 延时时长，单位10us
+ * @retval None
+ */
+void DDL_Delay10us(uint32_t u32Count)
+{
+    DelayTick(DDL_UsToTick((uint64_t)u32Count * 10u));
+}
+
+/**
+ * @brief  基于时基的延时：忙等，或在下一次SysTick溢出不晚于到期时刻时进入普通休眠
+ * @param  [in] u64Tick 延时时长，单位HCLK周期
+ * @retval None
+ * @note   判断与WFI在关中断下进行，避免判断后溢出中断先行响应而多睡一个周期；
+ *         调用前已关中断时，挂起的溢出使WFI立即返回，退化为忙等；
+ *         在中断服务函数中调用时（SysTick溢出可能无法唤醒）始终忙等；
+ *         溢出中断未使能时临时按剩余时长重设SysTick周期，延时结束后恢复
+ */
+static void DelayTick(uint64_t u64Tick)
+{
+    uint64_t  u64Start = DDL_TickGet();
+    uint64_t  u64Elapsed;
+    uint64_t  u64Remain;
+    uint32_t  u32Scr;
+    uint32_t  u32Ctrl;
+    uint32_t  u32Load;
+    uint32_t  u32Primask;
+    boolean_t bReload = FALSE;
+
+    if ((DDL_DELAY_MD_SLEEP != m_u32DelayMode) || (0u != __get_IPSR()))
     {
-        u32ValueNow = SysTick->VAL;
+        while ((DDL_TickGet() - u64Start) < u64Tick)
+        {
+            ;
+        }
+        return;
+    }
 
-        if (u32ValueNow != u32ValueStart)
+    /* 普通休眠：SysTick在休眠中继续计数 */
+    u32Scr   = SCB->SCR;
+    SCB->SCR = u32Scr & ~(SCB_SCR_SLEEPDEEP_Msk | SCB_SCR_SLEEPONEXIT_Msk);
+    u32Ctrl  = SysTick->CTRL & (SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+    u32Load  = SysTick->LOAD & SysTick_LOAD_RELOAD_Msk;
+    do
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        u64Elapsed = DDL_TickGet() - u64Start;
+        u64Remain  = (u64Elapsed < u64Tick) ? (u64Tick - u64Elapsed) : 0u;
+        if (0u != (u32Ctrl & SysTick_CTRL_TICKINT_Msk))
         {
-            if (u32ValueNow < u32ValueStart)
-            {
-                u32ValueCount += u32ValueStart - u32ValueNow;
-            }
-            else
+            /* 用户周期：下一次溢出在VAL个周期后，不晚于到期时刻才休眠 */
+            if (u64Remain > SysTick->VAL)
             {
-                u32ValueCount += SysTick->LOAD - u32ValueNow + u32ValueStart;
+                __WFI();
             }
+        }
+        else if (u64Remain >= DDL_DELAY_SLEEP_MIN)
+        {
+            /* 以不超过剩余时长的最大周期使能溢出中断，到期前唤醒 */
+            TickReload((u64Remain > (SysTick_LOAD_RELOAD_Msk + 1u)) ? (SysTick_LOAD_RELOAD_Msk + 1u) : (uint32_t)u64Remain,
+                       SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+            bReload = TRUE;
+            __WFI();
+        }
+        else
+        {
+            ;
+        }
+        if (0u == u32Primask)
+        {
+            __enable_irq();
+        }
+    } while (0u != u64Remain);
 
-            u32ValueStart = u32ValueNow;
+    if (TRUE == bReload)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TickReload(u32Load + 1u, u32Ctrl);
+        if (0u == u32Primask)
+        {
+            __enable_irq();
+        }
+    }
+    SCB->SCR = u32Scr;
+}
 
-            if (u32ValueCount >= u32ValueEnd)
-            {
-                break;
-            }
+/**
+ * @brief  重新设定SysTick周期及控制寄存器，时基保持连续
+ * @param  [in] u32Period 溢出周期（HCLK周期数），范围1~0x1000000
+ * @param  [in] u32Ctrl SysTick->CTRL设定值
+ * @retval None
+ * @note   须在关中断下调用；挂起的溢出先由DDL_TickGet()计入时基再清除
+ */
+static void TickReload(uint32_t u32Period, uint32_t u32Ctrl)
+{
+    uint64_t u64Tick = DDL_TickGet();
+
+    SysTick->LOAD = u32Period - 1u;
+    SysTick->VAL  = 0u;
+    SysTick->CTRL = u32Ctrl;
+    SCB->ICSR     = SCB_ICSR_PENDSTCLR_Msk;
+    /* 下一周期由0重装为LOAD（不产生溢出），此时时基为u64Tick */
+    m_u64TickBase    = u64Tick;
+    m_u32TickLastVal = u32Period - 1u;
+    m_bTickPendCnt   = FALSE;
+}
+
+/**
+ * @brief  HCLK变化时更新微秒换算起点及换算系数（仅此处使用除法）
+ * @param  [in] u64Tick 当前时基计数
+ * @retval None
+ */
+static void TickClockCheck(uint64_t u64Tick)
+{
+    uint32_t u32Primask;
+
+    if (SystemCoreClock == m_u32TickClock)
+    {
+        return;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    /* 首次换算以上电为起点 */
+    if (0u != m_u32TickClock)
+    {
+        m_u64UsEpoch += TickRatioMul(u64Tick - m_u64TickEpoch, &m_stcUsPerTick);
+        m_u64TickEpoch = u64Tick;
+    }
+    m_u32TickClock = SystemCoreClock;
+    TickRatioCalc(1000000u, m_u32TickClock, &m_stcUsPerTick);
+    TickRatioCalc(m_u32TickClock, 1000000u, &m_stcTickPerUs);
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  计算换算系数u32Num/u32Den：整数部分及向上取整的64位小数部分
+ * @param  [in] u32Num 分子
+ * @param  [in] u32Den 分母
+ * @param  [out] pstcRatio 换算系数
+ * @retval None
+ */
+static void TickRatioCalc(uint32_t u32Num, uint32_t u32Den, stc_ddl_tick_ratio_t *pstcRatio)
+{
+    uint64_t u64Rem = u32Num % u32Den;
+    uint64_t u64Hi;
+    uint64_t u64Lo;
+
+    pstcRatio->u64Int = u32Num / u32Den;
+
+    /* 小数部分 = ceil(余数 * 2^64 / 分母)，分两次32位长除 */
+    u64Hi  = (u64Rem << 32u) / u32Den;
+    u64Rem = (u64Rem << 32u) % u32Den;
+    u64Lo  = (u64Rem << 32u) / u32Den;
+    u64Rem = (u64Rem << 32u) % u32Den;
+
+    pstcRatio->u64Frac = (u64Hi << 32u) | u64Lo;
+    if (0u != u64Rem)
+    {
+        pstcRatio->u64Frac++;
+    }
+}
+
+/**
+ * @brief  按换算系数换算：u64Value * (整数部分 + 小数部分 / 2^64)，结果向下取整
+ * @param  [in] u64Value 输入值
+ * @param  [in] pstcRatio 换算系数
+ * @retval uint64_t 换算结果
+ * @note   小数部分取128位乘积的高64位，只用32x32位乘法
+ */
+static uint64_t TickRatioMul(uint64_t u64Value, const stc_ddl_tick_ratio_t *pstcRatio)
+{
+    uint32_t u32AL  = (uint32_t)u64Value;
+    uint32_t u32AH  = (uint32_t)(u64Value >> 32u);
+    uint32_t u32BL  = (uint32_t)pstcRatio->u64Frac;
+    uint32_t u32BH  = (uint32_t)(pstcRatio->u64Frac >> 32u);
+    uint64_t u64LL  = (uint64_t)u32AL * u32BL;
+    uint64_t u64LH  = (uint64_t)u32AL * u32BH;
+    uint64_t u64HL  = (uint64_t)u32AH * u32BL;
+    uint64_t u64HH  = (uint64_t)u32AH * u32BH;
+    uint64_t u64Mid = (u64LL >> 32u) + (uint32_t)u64LH + (uint32_t)u64HL;
+
+    return (u64Value * pstcRatio->u64Int) + u64HH + (u64LH >> 32u) + (u64HL >> 32u) + (u64Mid >> 32u);
+}
+
+#if defined(DDL_MMIO_TRACE)
+/**
+ * @brief  记录一次寄存器访问（由ddl.h寄存器操作宏调用）
+ * @param  [in] pvReg 寄存器指针
+ * @param  [in] u32Type 访问类型 @ref DDL_MMIO_Trace
+ * @param  [in] pcFunc 调用函数名
+ * @param  [in] u32Line 调用行号
+ * @retval None
+ * @note   调用位置按(函数, 行号, 外设)哈希，统计表满后新位置只计入丢弃计数
+ */
+void DDL_MmioTrace(const volatile void *pvReg, uint32_t u32Type, const char *pcFunc, uint32_t u32Line)
+{
+    stc_ddl_mmio_site_t *pstcSite;
+    stc_ddl_mmio_log_t  *pstcLog;
+    const char          *pcPeriph;
+    uint32_t             u32Addr;
+    uint32_t             u32Tick;
+    uint32_t             u32Idx;
+    uint32_t             u32Probe;
+    uint32_t             u32Primask;
+
+    if (FALSE == m_bMmioEnable)
+    {
+        return;
+    }
+
+    u32Addr  = (uint32_t)((uintptr_t)pvReg - (uintptr_t)DDL_MEM_MAP(0UL));
+    pcPeriph = MmioPeriphGet(u32Addr);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    u32Tick = DDL_MmioTickGet();
+    u32Idx  = ((uint32_t)((uintptr_t)pcFunc >> 2u) ^ (u32Line * 0x9E3779B1u) ^ (uint32_t)((uintptr_t)pcPeriph >> 2u));
+    u32Idx &= (DDL_MMIO_TRACE_SITE_NUM - 1u);
+
+    for (u32Probe = 0u; u32Probe < DDL_MMIO_TRACE_SITE_NUM; u32Probe++)
+    {
+        pstcSite = &m_astcMmioSite[u32Idx];
+        if (NULL == pstcSite->pcFunc)
+        {
+            pstcSite->pcFunc       = pcFunc;
+            pstcSite->pcPeriph     = pcPeriph;
+            pstcSite->u32Line      = u32Line;
+            pstcSite->u32Addr      = u32Addr;
+            pstcSite->u32FirstTick = u32Tick;
+            m_u32MmioSiteCnt++;
+            break;
+        }
+        if ((pcFunc == pstcSite->pcFunc) && (u32Line == pstcSite->u32Line) && (pcPeriph == pstcSite->pcPeriph))
+        {
+            break;
         }
+        u32Idx = (u32Idx + 1u) & (DDL_MMIO_TRACE_SITE_NUM - 1u);
+    }
+
+    if (u32Probe < DDL_MMIO_TRACE_SITE_NUM)
+    {
+        pstcSite->u32Read += (u32Type & DDL_MMIO_RD) ? 1u : 0u;
+        pstcSite->u32Write += (u32Type & DDL_MMIO_WR) ? 1u : 0u;
+        pstcSite->u32LastTick = u32Tick;
+
+        pstcLog          = &m_astcMmioLog[m_u32MmioLogCnt & (DDL_MMIO_TRACE_LOG_DEPTH - 1u)];
+        pstcLog->u32Tick = u32Tick;
+        pstcLog->u32Addr = u32Addr;
+        pstcLog->u16Site = (uint16_t)u32Idx;
+        pstcLog->u16Type = (uint16_t)u32Type;
+        m_u32MmioLogCnt++;
+    }
+    else
+    {
+        m_u32MmioDropCnt++;
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
     }
 }
 
 /**
- * @brief  10us延时函数
- * @param  [in] u32Count 延时时长，单位10us
+ * @brief  寄存器访问跟踪时间戳
+ * @retval uint32_t 时间戳，单位HCLK周期
+ * @note   目标板上取DDL_TickGet()低32位；主机模型下取模拟周期（不产生总线访问）；
+ *         用户可重新实现此函数接入其它时基
+ */
+__WEAK uint32_t DDL_MmioTickGet(void)
+{
+#if defined(DDL_HOST_MODEL)
+    return (uint32_t)HOST_CycleGet();
+#else
+    return (uint32_t)DDL_TickGet();
+#endif
+}
+
+/**
+ * @brief  寄存器访问跟踪使能/暂停
+ * @param  [in] bEnable TRUE：记录；FALSE：暂停记录
  * @retval None
  */
-void DDL_Delay10us(uint32_t u32Count)
+void DDL_MmioTraceCmd(boolean_t bEnable)
 {
-    uint32_t u32ValueNow = 0, u32ValueCount = 0;
+    m_bMmioEnable = bEnable;
+}
 
-    uint32_t u32ValueStart = SysTick->VAL;
-    while (1)
+/**
+ * @brief  寄存器访问跟踪统计清零
+ * @retval None
+ */
+void DDL_MmioTraceClear(void)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    DDL_MemoryClear(m_astcMmioSite, sizeof(m_astcMmioSite));
+    DDL_MemoryClear(m_astcMmioLog, sizeof(m_astcMmioLog));
+    m_u32MmioSiteCnt = 0u;
+    m_u32MmioLogCnt  = 0u;
+    m_u32MmioDropCnt = 0u;
+    if (0u == u32Primask)
     {
-        u32ValueNow = SysTick->VAL;
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  获取调用位置统计表
+ * @param  [out] ppstcSite 统计表首地址（未使用项pcFunc为NULL）
+ * @retval uint32_t 统计表项数
+ */
+uint32_t DDL_MmioSiteGet(const stc_ddl_mmio_site_t **ppstcSite)
+{
+    *ppstcSite = m_astcMmioSite;
+
+    return DDL_MMIO_TRACE_SITE_NUM;
+}
 
-        if (u32ValueNow != u32ValueStart)
+/**
+ * @brief  获取最近的访问记录（按时间先后排列）
+ * @param  [out] pstcLog 记录缓存
+ * @param  [in] u32Max 缓存项数
+ * @retval uint32_t 实际输出项数
+ */
+uint32_t DDL_MmioLogGet(stc_ddl_mmio_log_t *pstcLog, uint32_t u32Max)
+{
+    uint32_t u32Cnt   = m_u32MmioLogCnt;
+    uint32_t u32Num   = (u32Cnt < DDL_MMIO_TRACE_LOG_DEPTH) ? u32Cnt : DDL_MMIO_TRACE_LOG_DEPTH;
+    uint32_t u32Start;
+    uint32_t i;
+
+    if (u32Num > u32Max)
+    {
+        u32Num = u32Max;
+    }
+    u32Start = u32Cnt - u32Num;
+
+    for (i = 0u; i < u32Num; i++)
+    {
+        pstcLog[i] = m_astcMmioLog[(u32Start + i) & (DDL_MMIO_TRACE_LOG_DEPTH - 1u)];
+    }
+
+    return u32Num;
+}
+
+/**
+ * @brief  输出寄存器访问统计报告（printf）：按外设、按API函数、按调用位置
+ * @retval None
+ */
+void DDL_MmioReport(void)
+{
+    const stc_ddl_mmio_site_t *pstcSite = m_astcMmioSite;
+    uint32_t                   u32Read;
+    uint32_t                   u32Write;
+    uint32_t                   u32Sites;
+    uint32_t                   i;
+    uint32_t                   j;
+    boolean_t                  bDone;
+
+    DDL_MmioTraceCmd(FALSE);
+
+    printf("MMIO trace: %u sites, %u accesses, %u dropped\n", (unsigned)m_u32MmioSiteCnt, (unsigned)m_u32MmioLogCnt,
+           (unsigned)m_u32MmioDropCnt);
+
+    printf("%-10s %10s %10s\n", "PERIPH", "READ", "WRITE");
+    for (i = 0u; i < DDL_ARRAY_SZ(m_astcMmioPeriph); i++)
+    {
+        u32Read  = 0u;
+        u32Write = 0u;
+        for (j = 0u; j < DDL_MMIO_TRACE_SITE_NUM; j++)
         {
-            if (u32ValueNow < u32ValueStart)
+            if (pstcSite[j].pcPeriph == m_astcMmioPeriph[i].pcName)
             {
-                u32ValueCount += u32ValueStart - u32ValueNow;
+                u32Read += pstcSite[j].u32Read;
+                u32Write += pstcSite[j].u32Write;
             }
-            else
-            {
-                u32ValueCount += SysTick->LOAD - u32ValueNow + u32ValueStart;
-            }
-
-            u32ValueStart = u32ValueNow;
+        }
+        if ((0u != u32Read) || (0u != u32Write))
+        {
+            printf("%-10s %10u %10u\n", m_astcMmioPeriph[i].pcName, (unsigned)u32Read, (unsigned)u32Write);
+        }
+    }
 
-            if (u32ValueCount >= (u32Count * (SystemCoreClock / 100000)))
+    printf("%-32s %10s %10s %6s\n", "API", "READ", "WRITE", "SITES");
+    for (i = 0u; i < DDL_MMIO_TRACE_SITE_NUM; i++)
+    {
+        if (NULL == pstcSite[i].pcFunc)
+        {
+            continue;
+        }
+        /* 同名函数只在首次出现的位置汇总一次 */
+        bDone = FALSE;
+        for (j = 0u; j < i; j++)
+        {
+            if ((NULL != pstcSite[j].pcFunc) && (0 == strcmp(pstcSite[j].pcFunc, pstcSite[i].pcFunc)))
             {
+                bDone = TRUE;
                 break;
             }
         }
+        if (TRUE == bDone)
+        {
+            continue;
+        }
+        u32Read  = 0u;
+        u32Write = 0u;
+        u32Sites = 0u;
+        for (j = i; j < DDL_MMIO_TRACE_SITE_NUM; j++)
+        {
+            if ((NULL != pstcSite[j].pcFunc) && (0 == strcmp(pstcSite[j].pcFunc, pstcSite[i].pcFunc)))
+            {
+                u32Read += pstcSite[j].u32Read;
+                u32Write += pstcSite[j].u32Write;
+                u32Sites++;
+            }
+        }
+        printf("%-32s %10u %10u %6u\n", pstcSite[i].pcFunc, (unsigned)u32Read, (unsigned)u32Write, (unsigned)u32Sites);
     }
+
+    printf("%-32s %5s %-8s %10s %8s %8s %10s %10s\n", "SITE", "LINE", "PERIPH", "ADDR", "READ", "WRITE", "FIRST", "LAST");
+    for (i = 0u; i < DDL_MMIO_TRACE_SITE_NUM; i++)
+    {
+        if (NULL != pstcSite[i].pcFunc)
+        {
+            printf("%-32s %5u %-8s 0x%08X %8u %8u %10u %10u\n", pstcSite[i].pcFunc, (unsigned)pstcSite[i].u32Line,
+                   pstcSite[i].pcPeriph, (unsigned)pstcSite[i].u32Addr, (unsigned)pstcSite[i].u32Read,
+                   (unsigned)pstcSite[i].u32Write, (unsigned)pstcSite[i].u32FirstTick, (unsigned)pstcSite[i].u32LastTick);
+        }
+    }
+
+    DDL_MmioTraceCmd(TRUE);
+}
+
+/**
+ * @brief  按地址查找外设名
+ * @param  [in] u32Addr 寄存器地址
+ * @retval const char* 外设名
+ */
+static const char *MmioPeriphGet(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (DDL_ARRAY_SZ(m_astcMmioPeriph) - 1u); i++)
+    {
+        if ((u32Addr - m_astcMmioPeriph[i].u32Base) < m_astcMmioPeriph[i].u32Size)
+        {
+            break;
+        }
+    }
+
+    return m_astcMmioPeriph[i].pcName;
 }
+#endif /* DDL_MMIO_TRACE */
 /**
  * @}
  */
@@ -0,0 +1,356 @@
+/**
+ *******************************************************************************
+ * @file  ddl_log.c
+ * @brief This file provides firmware functions to manage the deferred binary
+ *        log: record ring buffer and stream encoder
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl_log.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_LOG
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DDL_LOG_Local_Macros DDL_LOG局部宏定义
+ * @{
+ */
+/* 缓冲中的记录：首字为(参数个数 << 16) | 格式ID，其后为参数 */
+#define DDL_LOG_HDR(id, argc) (((uint32_t)(argc) << 16) | ((uint32_t)(id) & 0xFFFFu))
+#define DDL_LOG_HDR_ID(hdr)   ((hdr) & 0xFFFFu)
+#define DDL_LOG_HDR_ARGC(hdr) ((hdr) >> 16)
+
+/* SLIP分帧（RFC 1055） */
+#define DDL_LOG_SLIP_END     (0xC0u)
+#define DDL_LOG_SLIP_ESC     (0xDBu)
+#define DDL_LOG_SLIP_ESC_END (0xDCu)
+#define DDL_LOG_SLIP_ESC_ESC (0xDDu)
+
+#define IS_VALID_LOG_SIZE(x) (((x) >= 8u) && ((x) <= 0x10000u) && (0u == ((x) & ((x) - 1u))))
+/**
+ * @}
+ */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static boolean_t LogStage(void);
+static void      LogEncByte(uint8_t u8Byte);
+static void      LogEncVarint(uint32_t u32Value);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t         *m_pu32LogBuf      = NULL; /* 记录缓冲 */
+static uint32_t          m_u32LogSize      = 0u;   /* 记录缓冲字数（2的幂），0为未初始化 */
+static volatile uint32_t m_u32LogHead      = 0u;   /* 写索引（关中断修改） */
+static volatile uint32_t m_u32LogTail      = 0u;   /* 读索引（只由DDL_LogRead()修改） */
+static volatile uint32_t m_u32LogDrop      = 0u;   /* 尚未报告的丢弃记录数 */
+static volatile uint32_t m_u32LogDropTotal = 0u;   /* 丢弃记录总数 */
+static uint8_t           m_au8LogEnc[DDL_LOG_ENC_MAX]; /* 编码中的记录 */
+static uint32_t          m_u32LogEncPos = 0u;          /* 已取出的字节数 */
+static uint32_t          m_u32LogEncLen = 0u;          /* 编码长度 */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DDL_LOG_Global_Functions DDL_LOG全局函数定义
+ * @{
+ */
+
+/**
+ * @brief  日志缓冲初始化：缓冲中的记录及待发送的字节丢弃，首先输出一个帧结束符使主机同步
+ * @param  [in] pu32Buf 记录缓冲（由调用者分配，使用期间不可释放）
+ * @param  [in] u32Size 记录缓冲字数：8~65536且为2的幂；一条记录占1 + 参数个数字
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误
+ */
+en_result_t DDL_LogInit(uint32_t *pu32Buf, uint32_t u32Size)
+{
+    uint32_t u32Primask;
+
+    if ((NULL == pu32Buf) || (!IS_VALID_LOG_SIZE(u32Size)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    m_pu32LogBuf      = pu32Buf;
+    m_u32LogSize      = u32Size;
+    m_u32LogHead      = 0u;
+    m_u32LogTail      = 0u;
+    m_u32LogDrop      = 0u;
+    m_u32LogDropTotal = 0u;
+    m_au8LogEnc[0]    = DDL_LOG_SLIP_END;
+    m_u32LogEncPos    = 0u;
+    m_u32LogEncLen    = 1u;
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  写入一条记录：只保存格式ID及参数，不格式化；缓冲空间不足时丢弃并计数，
+ *         有空间后先写入一条DDL_LOG_ID_DROP记录报告丢弃的条数
+ * @note   线程及任意优先级的中断中均可调用（关中断写入），通常经DDL_LOG0()~DDL_LOG4()调用；
+ *         DDL_LogInit()之前的调用计为丢弃
+ * @param  [in] u32Id 格式ID：0~DDL_LOG_ID_MAX
+ * @param  [in] u32Argc 参数个数：0~DDL_LOG_ARG_MAX，超出部分忽略
+ * @param  [in] u32Arg0 参数0
+ * @param  [in] u32Arg1 参数1
+ * @param  [in] u32Arg2 参数2
+ * @param  [in] u32Arg3 参数3
+ * @retval None
+ */
+void DDL_LogWrite(uint32_t u32Id, uint32_t u32Argc, uint32_t u32Arg0, uint32_t u32Arg1, uint32_t u32Arg2, uint32_t u32Arg3)
+{
+    uint32_t u32Primask;
+    uint32_t u32Head;
+    uint32_t u32Free;
+    uint32_t u32Mask;
+    uint32_t u32Need;
+
+    if (u32Argc > DDL_LOG_ARG_MAX)
+    {
+        u32Argc = DDL_LOG_ARG_MAX;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    u32Head = m_u32LogHead;
+    u32Mask = m_u32LogSize - 1u;
+    u32Free = m_u32LogSize - (u32Head - m_u32LogTail);
+    u32Need = 1u + u32Argc + ((0u != m_u32LogDrop) ? 2u : 0u);
+
+    if (u32Free < u32Need)
+    {
+        m_u32LogDrop++;
+        m_u32LogDropTotal++;
+    }
+    else
+    {
+        if (0u != m_u32LogDrop)
+        {
+            m_pu32LogBuf[u32Head & u32Mask] = DDL_LOG_HDR(DDL_LOG_ID_DROP, 1u);
+            u32Head++;
+            m_pu32LogBuf[u32Head & u32Mask] = m_u32LogDrop;
+            u32Head++;
+            m_u32LogDrop = 0u;
+        }
+
+        m_pu32LogBuf[u32Head & u32Mask] = DDL_LOG_HDR(u32Id, u32Argc);
+        u32Head++;
+        if (u32Argc > 0u)
+        {
+            m_pu32LogBuf[u32Head & u32Mask] = u32Arg0;
+            u32Head++;
+        }
+        if (u32Argc > 1u)
+        {
+            m_pu32LogBuf[u32Head & u32Mask] = u32Arg1;
+            u32Head++;
+        }
+        if (u32Argc > 2u)
+        {
+            m_pu32LogBuf[u32Head & u32Mask] = u32Arg2;
+            u32Head++;
+        }
+        if (u32Argc > 3u)
+        {
+            m_pu32LogBuf[u32Head & u32Mask] = u32Arg3;
+            u32Head++;
+        }
+        m_u32LogHead = u32Head;
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  取出编码后的字节流，不等待：每条记录编码为格式ID及各参数的LEB128变长整数，
+ *         以SLIP帧结束符分隔；一条记录可分多次取出
+ * @note   只能在一个执行上下文中调用：主循环空闲时（写入LPUART_RingWrite()等发送缓冲），
+ *         或LPUART TX空中断中逐字节取出
+ * @param  [out] pu8Buf 输出缓冲
+ * @param  [in] u32Size 输出缓冲长度
+ * @retval uint32_t 输出的字节数，0表示没有待发送的记录
+ */
+uint32_t DDL_LogRead(uint8_t *pu8Buf, uint32_t u32Size)
+{
+    uint32_t u32Cnt = 0u;
+
+    while (u32Cnt < u32Size)
+    {
+        if ((m_u32LogEncPos == m_u32LogEncLen) && (FALSE == LogStage()))
+        {
+            break;
+        }
+        while ((u32Cnt < u32Size) && (m_u32LogEncPos < m_u32LogEncLen))
+        {
+            pu8Buf[u32Cnt] = m_au8LogEnc[m_u32LogEncPos];
+            u32Cnt++;
+            m_u32LogEncPos++;
+        }
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  缓冲中尚未取出的字数
+ * @retval uint32_t 字数
+ */
+uint32_t DDL_LogPendingGet(void)
+{
+    return m_u32LogHead - m_u32LogTail;
+}
+
+/**
+ * @brief  缓冲满丢弃的记录总数（DDL_LogInit()后累计）
+ * @retval uint32_t 记录数
+ */
+uint32_t DDL_LogDropCountGet(void)
+{
+    return m_u32LogDropTotal;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DDL_LOG_Local_Functions DDL_LOG局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  从记录缓冲取出下一条记录并编码到m_au8LogEnc
+ * @retval boolean_t
+ *           - TRUE: 已取出一条记录
+ *           - FALSE: 缓冲为空
+ */
+static boolean_t LogStage(void)
+{
+    uint32_t u32Tail = m_u32LogTail;
+    uint32_t u32Mask = m_u32LogSize - 1u;
+    uint32_t u32Hdr;
+    uint32_t u32Argc;
+
+    if (u32Tail == m_u32LogHead)
+    {
+        return FALSE;
+    }
+
+    m_u32LogEncPos = 0u;
+    m_u32LogEncLen = 0u;
+
+    u32Hdr = m_pu32LogBuf[u32Tail & u32Mask];
+    u32Tail++;
+    LogEncVarint(DDL_LOG_HDR_ID(u32Hdr));
+    for (u32Argc = DDL_LOG_HDR_ARGC(u32Hdr); u32Argc > 0u; u32Argc--)
+    {
+        LogEncVarint(m_pu32LogBuf[u32Tail & u32Mask]);
+        u32Tail++;
+    }
+    m_au8LogEnc[m_u32LogEncLen] = DDL_LOG_SLIP_END;
+    m_u32LogEncLen++;
+
+    /* 读完后释放空间 */
+    m_u32LogTail = u32Tail;
+
+    return TRUE;
+}
+
+/**
+ * @brief  编码一字节（SLIP转义）
+ * @param  [in] u8Byte 字节
+ * @retval None
+ */
+static void LogEncByte(uint8_t u8Byte)
+{
+    if (DDL_LOG_SLIP_END == u8Byte)
+    {
+        m_au8LogEnc[m_u32LogEncLen++] = DDL_LOG_SLIP_ESC;
+        m_au8LogEnc[m_u32LogEncLen++] = DDL_LOG_SLIP_ESC_END;
+    }
+    else if (DDL_LOG_SLIP_ESC == u8Byte)
+    {
+        m_au8LogEnc[m_u32LogEncLen++] = DDL_LOG_SLIP_ESC;
+        m_au8LogEnc[m_u32LogEncLen++] = DDL_LOG_SLIP_ESC_ESC;
+    }
+    else
+    {
+        m_au8LogEnc[m_u32LogEncLen++] = u8Byte;
+    }
+}
+
+/**
+ * @brief  编码LEB128变长整数：每字节低7位，最高位为1表示后续还有字节
+ * @param  [in] u32Value 数值
+ * @retval None
+ */
+static void LogEncVarint(uint32_t u32Value)
+{
+    while (u32Value >= 0x80u)
+    {
+        LogEncByte((uint8_t)(u32Value | 0x80u));
+        u32Value >>= 7u;
+    }
+    LogEncByte((uint8_t)u32Value);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
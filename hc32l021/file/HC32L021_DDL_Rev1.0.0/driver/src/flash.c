@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-18       MADS            First version
+   2026-10-18       MADS            Bound busy timeouts by poll count when SysTick is stopped
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -37,6 +38,25 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup FLASH_Local_Types FLASH局部类型定义
+ * @{
+ */
+
+/**
+ * @brief  FLASH超时计时：直接累计SysTick VAL的递减量，计时过程不调用FLASH中的代码
+ */
+typedef struct
+{
+    uint32_t u32Period; /*!< 超时时间（HCLK周期） */
+    uint32_t u32Remain; /*!< 剩余时间（HCLK周期） */
+    uint32_t u32Last;   /*!< 上次读到的SysTick VAL */
+    uint32_t u32Stall;  /*!< SysTick停止时剩余的查询次数 */
+} stc_flash_timeout_t;
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
@@ -48,11 +68,13 @@
 #define RAMFUNC __attribute__((section(".ramfunc")))
 #elif defined(__ICCARM__)
 #define RAMFUNC __ramfunc
+#else
+#define RAMFUNC
 #endif
 
 #define FLASH_END_ADDR          (0x0000FFFFu) /* FLASH末尾地址 */
 
-#define FLASH_TIMEOUT           (0xFFFFFFu) /* FLASH超时保护计数值 */
+#define FLASH_TIMEOUT           (100000u)     /* FLASH超时保护时间（us），大于全片擦除时间 */
 
 #define FLASH_LOCK_ALL_SECTOR   (0u)          /* FLASH所有sector上锁 */
 #define FLASH_UNLOCK_ALL_SECTOR (0xFFFFFFFFu) /* FLASH所有sector解锁 */
@@ -66,12 +88,98 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @addtogroup FLASH_Local_Functions FLASH局部函数定义
+ * @{
+ */
+static void              FLASH_TimeoutInit(stc_flash_timeout_t *pstcTimeout);
+static RAMFUNC void      FLASH_TimeoutStart(stc_flash_timeout_t *pstcTimeout);
+static RAMFUNC boolean_t FLASH_TimeoutExpired(stc_flash_timeout_t *pstcTimeout);
+/**
+ * @}
+ */
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
+/**
+ * @defgroup FLASH_Local_Functions FLASH局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  FLASH超时计时初始化：按当前HCLK换算超时时间并开始计时
+ * @note   在FLASH操作开始之前调用（可调用FLASH中的代码）
+ * @param  [out] pstcTimeout 超时计时 @ref stc_flash_timeout_t
+ * @retval None
+ */
+static void FLASH_TimeoutInit(stc_flash_timeout_t *pstcTimeout)
+{
+    uint64_t u64Tick = DDL_UsToTick(FLASH_TIMEOUT);
+
+    pstcTimeout->u32Period = (u64Tick > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)u64Tick;
+    FLASH_TimeoutStart(pstcTimeout);
+}
+
+/**
+ * @brief  FLASH超时计时重新开始(RAM中执行)
+ * @param  [in] pstcTimeout 超时计时 @ref stc_flash_timeout_t
+ * @retval None
+ */
+static RAMFUNC void FLASH_TimeoutStart(stc_flash_timeout_t *pstcTimeout)
+{
+    pstcTimeout->u32Remain = pstcTimeout->u32Period;
+    pstcTimeout->u32Stall  = pstcTimeout->u32Period;
+    pstcTimeout->u32Last   = SysTick->VAL;
+}
+
+/**
+ * @brief  FLASH超时判断(RAM中执行)
+ * @note   按SysTick VAL的递减量累计，两次调用间隔须小于一个SysTick重载周期；
+ *         SysTick停止（VAL不变）时按每次查询至少一个HCLK周期计数，超时仍能结束
+ * @param  [in] pstcTimeout 超时计时 @ref stc_flash_timeout_t
+ * @retval boolean_t
+ *           - TRUE: 已超时
+ *           - FALSE: 未超时
+ */
+static RAMFUNC boolean_t FLASH_TimeoutExpired(stc_flash_timeout_t *pstcTimeout)
+{
+    uint32_t u32Val = SysTick->VAL;
+    uint32_t u32Elapsed;
+
+    if (u32Val <= pstcTimeout->u32Last)
+    {
+        u32Elapsed = pstcTimeout->u32Last - u32Val;
+    }
+    else
+    {
+        u32Elapsed = pstcTimeout->u32Last + SysTick->LOAD + 1u - u32Val; /* 期间发生重载 */
+    }
+    pstcTimeout->u32Last = u32Val;
+
+    if (0u == u32Elapsed)
+    {
+        if (0u == pstcTimeout->u32Stall)
+        {
+            return TRUE;
+        }
+        pstcTimeout->u32Stall--;
+        return FALSE;
+    }
+    if (u32Elapsed >= pstcTimeout->u32Remain)
+    {
+        return TRUE;
+    }
+    pstcTimeout->u32Remain -= u32Elapsed;
+
+    return FALSE;
+}
+/**
+ * @}
+ */
+
 /**
  * @defgroup FLASH_Global_Functions FLASH全局函数定义
  * @{
@@ -129,13 +237,15 @@ void FLASH_IntFlagClear(uint32_t u32FlashIntFlag)
  */
 en_result_t FLASH_LockAllSector(void)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     while (FLASH_LOCK_ALL_SECTOR != FLASH->SLOCK0)
     {
         FLASH_BYPASS();
         FLASH->SLOCK0 = FLASH_LOCK_ALL_SECTOR;
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -152,13 +262,15 @@ en_result_t FLASH_LockAllSector(void)
  */
 en_result_t FLASH_UnlockAllSector(void)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     while (FLASH_UNLOCK_ALL_SECTOR != FLASH->SLOCK0)
     {
         FLASH_BYPASS();
         FLASH->SLOCK0 = FLASH_UNLOCK_ALL_SECTOR;
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -180,13 +292,15 @@ en_result_t FLASH_UnlockAllSector(void)
  */
 en_result_t FLASH_LockUnlockSectors(uint32_t u32LockValue)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     while (u32LockValue != *((&FLASH->SLOCK0)))
     {
         FLASH_BYPASS();
         *((&FLASH->SLOCK0)) = u32LockValue;
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -204,13 +318,15 @@ en_result_t FLASH_LockUnlockSectors(uint32_t u32LockValue)
  */
 en_result_t FLASH_WaitCycle(uint32_t u32FlashWaitCycle)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_WAIT_Msk) != u32FlashWaitCycle)
     {
         FLASH_BYPASS();
         MODIFY_REG32(FLASH->CR, FLASH_CR_WAIT_Msk, u32FlashWaitCycle);
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -228,27 +344,30 @@ en_result_t FLASH_WaitCycle(uint32_t u32FlashWaitCycle)
  */
 en_result_t FLASH_OperateModeConfig(uint32_t u32FlashOperateMode)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
+
     if (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk | FLASH_CR_CONTP_Msk) != u32FlashOperateMode) /* 模式发生变化 */
     {
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk) != (u32FlashOperateMode & FLASH_CR_OP_Msk)) /* OP发生变化 */
         {
             FLASH_BYPASS();
             MODIFY_REG32(FLASH->CR, FLASH_CR_OP_Msk, u32FlashOperateMode & FLASH_CR_OP_Msk); /* 修改OP值 */
 
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
         }
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk) != (u32FlashOperateMode & FLASH_CR_CONTP_Msk)) /* CONTP发生变化 */
         {
             FLASH_BYPASS();
             MODIFY_REG32(FLASH->CR, FLASH_CR_CONTP_Msk, u32FlashOperateMode & FLASH_CR_CONTP_Msk); /* 修改CONTP值 */
 
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -270,8 +389,10 @@ en_result_t FLASH_OperateModeConfig(uint32_t u32FlashOperateMode)
  */
 en_result_t FLASH_WriteByte(uint32_t u32Addr, uint8_t *pu8Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len - 1u))
     {
@@ -284,10 +405,10 @@ en_result_t FLASH_WriteByte(uint32_t u32Addr, uint8_t *pu8Data, uint32_t u32Len)
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -296,20 +417,20 @@ en_result_t FLASH_WriteByte(uint32_t u32Addr, uint8_t *pu8Data, uint32_t u32Len)
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint8_t *)u32Addr) = pu8Data[u32Index];
+        RW_MEM8(u32Addr) = pu8Data[u32Index];
 
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
         }
 
         /* 校验 */
-        if (pu8Data[u32Index] != *((volatile uint8_t *)u32Addr))
+        if (pu8Data[u32Index] != RW_MEM8(u32Addr))
         {
             return Error;
         }
@@ -332,8 +453,10 @@ en_result_t FLASH_WriteByte(uint32_t u32Addr, uint8_t *pu8Data, uint32_t u32Len)
  */
 en_result_t FLASH_WriteHalfWord(uint32_t u32Addr, uint16_t *pu16Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len * 2u - 1u))
     {
@@ -346,10 +469,10 @@ en_result_t FLASH_WriteHalfWord(uint32_t u32Addr, uint16_t *pu16Data, uint32_t u
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -358,19 +481,19 @@ en_result_t FLASH_WriteHalfWord(uint32_t u32Addr, uint16_t *pu16Data, uint32_t u
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint16_t *)u32Addr) = pu16Data[u32Index];
+        RW_MEM16(u32Addr) = pu16Data[u32Index];
 
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
         }
 
-        if (pu16Data[u32Index] != *((volatile uint16_t *)u32Addr))
+        if (pu16Data[u32Index] != RW_MEM16(u32Addr))
         {
             return Error;
         }
@@ -393,8 +516,10 @@ en_result_t FLASH_WriteHalfWord(uint32_t u32Addr, uint16_t *pu16Data, uint32_t u
  */
 en_result_t FLASH_WriteWord(uint32_t u32Addr, uint32_t *pu32Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len * 4u - 1u))
     {
@@ -407,10 +532,10 @@ en_result_t FLASH_WriteWord(uint32_t u32Addr, uint32_t *pu32Data, uint32_t u32Le
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -419,19 +544,19 @@ en_result_t FLASH_WriteWord(uint32_t u32Addr, uint32_t *pu32Data, uint32_t u32Le
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint32_t *)u32Addr) = pu32Data[u32Index];
+        RW_MEM32(u32Addr) = pu32Data[u32Index];
 
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
         }
 
-        if (pu32Data[u32Index] != *((volatile uint32_t *)u32Addr))
+        if (pu32Data[u32Index] != RW_MEM32(u32Addr))
         {
             return Error;
         }
@@ -452,7 +577,9 @@ en_result_t FLASH_WriteWord(uint32_t u32Addr, uint32_t *pu32Data, uint32_t u32Le
  */
 en_result_t FLASH_SectorErase(uint32_t u32SectorAddr)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < u32SectorAddr)
     {
@@ -465,23 +592,23 @@ en_result_t FLASH_SectorErase(uint32_t u32SectorAddr)
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
     /* write data */
-    *((volatile uint32_t *)u32SectorAddr) = 0u;
+    RW_MEM32(u32SectorAddr) = 0u;
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -499,27 +626,30 @@ en_result_t FLASH_SectorErase(uint32_t u32SectorAddr)
  */
 RAMFUNC en_result_t FLASH_OperateModeConfigRamFunc(uint32_t u32FlashOperateMode)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
+
     if (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk | FLASH_CR_CONTP_Msk) != u32FlashOperateMode) /* 模式发生变化 */
     {
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk) != (u32FlashOperateMode & FLASH_CR_OP_Msk)) /* OP发生变化 */
         {
             FLASH_BYPASS();
             MODIFY_REG32(FLASH->CR, FLASH_CR_OP_Msk, u32FlashOperateMode & FLASH_CR_OP_Msk); /* 修改OP值 */
 
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
         }
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk) != (u32FlashOperateMode & FLASH_CR_CONTP_Msk)) /* CONTP发生变化 */
         {
             FLASH_BYPASS();
             MODIFY_REG32(FLASH->CR, FLASH_CR_CONTP_Msk, u32FlashOperateMode & FLASH_CR_CONTP_Msk); /* 修改CONTP值 */
 
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -537,40 +667,42 @@ RAMFUNC en_result_t FLASH_OperateModeConfigRamFunc(uint32_t u32FlashOperateMode)
  */
 RAMFUNC en_result_t FLASH_ChipErase(void)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (Ok != FLASH_OperateModeConfigRamFunc(FLASH_MD_CHIP_ERASE))
     {
         return Error;
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (FLASH_UNLOCK_ALL_SECTOR != FLASH->SLOCK0)
     {
         FLASH_BYPASS();
         FLASH->SLOCK0 = FLASH_UNLOCK_ALL_SECTOR;
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
-    *((volatile unsigned int *)0x00000000u) = 0u;
+    RW_MEM32(0x00000000u) = 0u;
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -592,8 +724,10 @@ RAMFUNC en_result_t FLASH_ChipErase(void)
  */
 RAMFUNC en_result_t FLASH_ContinousWriteByte(uint32_t u32Addr, uint8_t *pu8Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len - 1u))
     {
@@ -606,10 +740,10 @@ RAMFUNC en_result_t FLASH_ContinousWriteByte(uint32_t u32Addr, uint8_t *pu8Data,
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -618,12 +752,12 @@ RAMFUNC en_result_t FLASH_ContinousWriteByte(uint32_t u32Addr, uint8_t *pu8Data,
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint8_t *)u32Addr) = pu8Data[u32Index];
+        RW_MEM8(u32Addr) = pu8Data[u32Index];
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -632,33 +766,33 @@ RAMFUNC en_result_t FLASH_ContinousWriteByte(uint32_t u32Addr, uint8_t *pu8Data,
         u32Addr++;
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk) != FLASH_CR_OP_Msk)
     {
         FLASH_BYPASS();
         SET_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk); /* OP = 1 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk))
     {
         FLASH_BYPASS();
         CLR_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk); /* CONTP = 0 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -680,8 +814,10 @@ RAMFUNC en_result_t FLASH_ContinousWriteByte(uint32_t u32Addr, uint8_t *pu8Data,
  */
 RAMFUNC en_result_t FLASH_ContinousWriteHalfWord(uint32_t u32Addr, uint16_t *pu16Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len * 2u - 1u))
     {
@@ -694,10 +830,10 @@ RAMFUNC en_result_t FLASH_ContinousWriteHalfWord(uint32_t u32Addr, uint16_t *pu1
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -706,12 +842,12 @@ RAMFUNC en_result_t FLASH_ContinousWriteHalfWord(uint32_t u32Addr, uint16_t *pu1
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint16_t *)u32Addr) = pu16Data[u32Index];
+        RW_MEM16(u32Addr) = pu16Data[u32Index];
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -720,33 +856,33 @@ RAMFUNC en_result_t FLASH_ContinousWriteHalfWord(uint32_t u32Addr, uint16_t *pu1
         u32Addr += 2u;
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk) != FLASH_CR_OP_Msk)
     {
         FLASH_BYPASS();
         SET_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk); /* OP = 1 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk))
     {
         FLASH_BYPASS();
         CLR_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk); /* CONTP = 0 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -768,8 +904,10 @@ RAMFUNC en_result_t FLASH_ContinousWriteHalfWord(uint32_t u32Addr, uint16_t *pu1
  */
 RAMFUNC en_result_t FLASH_ContinousWriteWord(uint32_t u32Addr, uint32_t *pu32Data, uint32_t u32Len)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
-    uint32_t          u32Index   = 0u;
+    stc_flash_timeout_t stcTimeout;
+    uint32_t            u32Index = 0u;
+
+    FLASH_TimeoutInit(&stcTimeout);
 
     if (FLASH_END_ADDR < (u32Addr + u32Len * 4u - 1u))
     {
@@ -782,10 +920,10 @@ RAMFUNC en_result_t FLASH_ContinousWriteWord(uint32_t u32Addr, uint32_t *pu32Dat
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -794,12 +932,12 @@ RAMFUNC en_result_t FLASH_ContinousWriteWord(uint32_t u32Addr, uint32_t *pu32Dat
     /* write data byte */
     for (u32Index = 0u; u32Index < u32Len; u32Index++)
     {
-        *((volatile uint32_t *)u32Addr) = pu32Data[u32Index];
+        RW_MEM32(u32Addr) = pu32Data[u32Index];
         /* busy */
-        u32Timeout = FLASH_TIMEOUT;
+        FLASH_TimeoutStart(&stcTimeout);
         while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (FLASH_TimeoutExpired(&stcTimeout))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -808,33 +946,33 @@ RAMFUNC en_result_t FLASH_ContinousWriteWord(uint32_t u32Addr, uint32_t *pu32Dat
         u32Addr += 4u;
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk) != FLASH_CR_OP_Msk)
     {
         FLASH_BYPASS();
         SET_REG32_BIT(FLASH->CR, FLASH_CR_OP_Msk); /* OP = 1 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk))
     {
         FLASH_BYPASS();
         CLR_REG32_BIT(FLASH->CR, FLASH_CR_CONTP_Msk); /* CONTP = 0 */
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
     }
 
     /* busy */
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutStart(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_BUSY_Msk))
     {
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -851,15 +989,15 @@ RAMFUNC en_result_t FLASH_ContinousWriteWord(uint32_t u32Addr, uint32_t *pu32Dat
  */
 en_result_t FLASH_LowPowerEnable(void)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutInit(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_DPSTB_EN_Msk) != FLASH_CR_DPSTB_EN_Msk)
     {
         FLASH_BYPASS();
         SET_REG32_BIT(FLASH->CR, FLASH_CR_DPSTB_EN_Msk);
 
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
@@ -876,15 +1014,15 @@ en_result_t FLASH_LowPowerEnable(void)
  */
 en_result_t FLASH_LowPowerDisable(void)
 {
-    volatile uint32_t u32Timeout = FLASH_TIMEOUT;
+    stc_flash_timeout_t stcTimeout;
 
-    u32Timeout = FLASH_TIMEOUT;
+    FLASH_TimeoutInit(&stcTimeout);
     while (READ_REG32_BIT(FLASH->CR, FLASH_CR_DPSTB_EN_Msk) == FLASH_CR_DPSTB_EN_Msk)
     {
         FLASH_BYPASS();
         CLR_REG32_BIT(FLASH->CR, FLASH_CR_DPSTB_EN_Msk);
 
-        if (0x0u == u32Timeout--)
+        if (FLASH_TimeoutExpired(&stcTimeout))
         {
             return ErrorTimeout; /* 等待超时 */
         }
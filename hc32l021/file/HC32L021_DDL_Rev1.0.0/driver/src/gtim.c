@@ -234,9 +234,9 @@ void GTIM_CompareCaptureModeSet(GTIM_TypeDef *GTIMx, uint32_t u32Ch, uint32_t u3
  */
 void GTIM_CompareCaptureRegSet(GTIM_TypeDef *GTIMx, uint32_t u32Ch, uint32_t u32Capture)
 {
-    uint32_t u32BaseAdress;
+    uintptr_t u32BaseAdress;
 
-    u32BaseAdress = (uint32_t)(&GTIMx->CCR0) + (uint32_t)u32Ch;
+    u32BaseAdress = (uintptr_t)(&GTIMx->CCR0) + (uint32_t)u32Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseAdress, GTIM_CCR0_CCR_Msk, u32Capture);
 }
@@ -249,9 +249,9 @@ void GTIM_CompareCaptureRegSet(GTIM_TypeDef *GTIMx, uint32_t u32Ch, uint32_t u32
  */
 uint32_t GTIM_CompareCaptureRegGet(GTIM_TypeDef *GTIMx, uint32_t u32Ch)
 {
-    uint32_t u32BaseAdress;
+    uintptr_t u32BaseAdress;
 
-    u32BaseAdress = (uint32_t)(&GTIMx->CCR0) + u32Ch;
+    u32BaseAdress = (uintptr_t)(&GTIMx->CCR0) + u32Ch;
 
     return READ_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, GTIM_CCR0_CCR_Msk);
 }
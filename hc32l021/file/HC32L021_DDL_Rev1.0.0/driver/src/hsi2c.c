@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-18       MADS            First version
+   2026-10-18       MADS            Restore loop-count poll timeouts, add microsecond *TimeoutUs variants
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -56,6 +57,8 @@ stc_hsi2c_com_t           stcHsi2cCom           = {0x0u};           /* 通信结
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static en_result_t HSI2C_MasterTransferPollDeadline(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline);
+static en_result_t HSI2C_SlaveTransferPollDeadline(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
@@ -444,6 +447,7 @@ void HSI2C_MasterStatusMachineStop(void)
  * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
  * @param  [in] pu8Data 传输数据首地址
  * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] u32Timeout 超时保护计数值（查询次数，为整个传输的总次数上限）
  * @retval en_result_t
  *           - Ok: 设置成功
  *           - Error: 设置失败
@@ -451,160 +455,32 @@ void HSI2C_MasterStatusMachineStop(void)
  */
 en_result_t HSI2C_MasterTransferPoll(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32Timeout)
 {
-    uint32_t    u32Flag  = 0;
-    en_result_t enResult = Ok;
-    DDL_ZERO_STRUCT(stcHsi2cCom);
-
-    if (Hsi2cComIdle == stcHsi2cCom.enComStatus)
-    {
-        if (TRUE == HSI2C_MasterFlagGet(HSI2Cx, HSI2C_MASTER_FLAG_BBF))
-        {
-            enResult = Error;
-        }
-        else
-        {
-            enMasterStatusMachine = Hsi2cStatusStart;
-
-            stcHsi2cCom.HSI2CxBaseAddr = HSI2Cx;
-            stcHsi2cCom.enComStatus    = Hsi2cComBusy;
-            stcHsi2cCom.u32DataIndex   = 0;
-            stcHsi2cCom.u32Len         = u32Size;
-            stcHsi2cCom.pu8Buf         = pu8Data;
-
-            stcHsi2cCom.u32RxSize = stcHsi2cCom.u32Len;
-
-            HSI2C_MasterFlagClear(HSI2Cx, HSI2C_MASTER_FLAG_CLR_ALL); /* Clear flags */
-
-            HSI2Cx->MCFGR1 &= ~HSI2C_MCFGR1_AUTOSTOP_Msk; /* Disable auto-stop */
-
-            while (1)
-            {
-                if (0x0u == u32Timeout--)
-                {
-                    enResult = ErrorTimeout; /* 等待超时 */
-                    break;
-                }
-                u32Flag                          = stcHsi2cCom.HSI2CxBaseAddr->MSR;
-                stcHsi2cCom.HSI2CxBaseAddr->MSCR = u32Flag;
-
-                if (Hsi2cComSuccess == HSI2C_MasterErrorGet(u32Flag))
-                {
-                    switch (enMasterStatusMachine)
-                    {
-                        case Hsi2cStatusStart:
-                            HSI2C_MasterStatusMachineStart();
-                            break;
-                        case Hsi2cStatusSubAddr:
-                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
-                            {
-                                HSI2C_MasterStatusMachineSubAddr();
-                            }
-                            break;
-                        case Hsi2cStatusRestart:
-                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
-                            {
-                                HSI2C_MasterStatusMachineRestart();
-                            }
-                            break;
-                        case Hsi2cStatusRxCmd:
-                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
-                            {
-                                HSI2C_MasterStatusMachineRxCmd(&stcHsi2cCom.u32RxSize);
-                            }
-                            break;
-                        case Hsi2cStatusTransData:
-                            if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len) /* Data transmit or receive */
-                            {
-                                if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
-                                {
-                                    if (stcHsi2cMasterInit.enDir == Hsi2cMasterWriteSlaveRead) /* Transmit */
-                                    {
-                                        HSI2C_MasterWriteData(stcHsi2cCom.HSI2CxBaseAddr, stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++]);
-                                    }
-                                }
-                                if ((u32Flag & HSI2C_MSR_RDF_Msk) == HSI2C_MSR_RDF_Msk)
-                                {
-                                    if (stcHsi2cMasterInit.enDir == Hsi2cMasterReadSlaveWrite) /* Recieve */
-                                    {
-                                        if (Ok == HSI2C_MasterReadData(stcHsi2cCom.HSI2CxBaseAddr, &stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex]))
-                                        {
-                                            stcHsi2cCom.u32DataIndex++;
-                                        }
-                                    }
-                                }
-                            }
-                            HSI2C_MasterStatusMachineTrans();
-                            break;
-                        case Hsi2cStatusStop:
-                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
-                            {
-                                HSI2C_MasterStatusMachineStop();
-                            }
-                            break;
-                        case Hsi2cStatusWaitEnd:
-                            /* Wait for transfer end */
-                            if (u32Flag & HSI2C_MSR_SDF_Msk)
-                            {
-                                stcHsi2cCom.enComStatus = Hsi2cComIdle;
-                            }
-                            break;
-                        default:
-                            break;
-                    }
+    stc_ddl_deadline_t stcDeadline;
 
-                    if (stcHsi2cCom.enComStatus == Hsi2cComIdle)
-                    {
-                        break; /* Transfer完成 */
-                    }
-                }
-                else /* Error handling */
-                {
-                    /* Disable all master interrupts */
-                    HSI2C_MasterIntDisable(stcHsi2cCom.HSI2CxBaseAddr, HSI2C_MASTER_INT_ALL);
+    DDL_DeadlineCountInit(&stcDeadline, u32Timeout);
+    return HSI2C_MasterTransferPollDeadline(HSI2Cx, pu8Data, u32Size, &stcDeadline);
+}
 
-                    /* Arbitration lost? */
-                    if (u32Flag & HSI2C_MSR_ALF_Msk)
-                    {
-                        /* Reset master */
-                        HSI2C_MasterReset(HSI2Cx);
-                    }
-                    /* Pin low timeout? */
-                    else if (u32Flag & HSI2C_MSR_PLTF_Msk)
-                    {
-                        /* Reset master */
-                        HSI2C_MasterReset(HSI2Cx);
-                        /* ======================================= */
-                        /* ==========       WARNING       ======== */
-                        /* ======================================= */
-                        /* 1. 根据实际情况添加代码处理引脚低条件      */
-                        /* 2. 当引脚低超时持续时，PLTF不能被清除掉    */
-                        /* 3. 在I2C可以开始启动条件之前，必须清除PLTF */
-                    }
-                    /* Master busy? */
-                    else if (u32Flag & HSI2C_MSR_MBF_Msk)
-                    {
-                        /* Send stop command */
-                        HSI2C_MasterStop(stcHsi2cCom.HSI2CxBaseAddr);
-                    }
-                    else
-                    {
-                        ;
-                    }
+/**
+ * @brief  HSI2C主机轮询传输设置（微秒超时）
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pu8Data 传输数据首地址
+ * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] u32TimeoutUs 超时时间，单位us，为整个传输的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - Error: 设置失败
+ *           - ErrorTimeout：超时
+ */
+en_result_t HSI2C_MasterTransferPollTimeoutUs(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-                    stcHsi2cCom.enComStatus = Hsi2cComIdle;
-                    enResult                = Error;
-                    break;
-                }
-            }
-        }
-    }
-    else
-    {
-        enResult = Error;
-    }
-    return enResult;
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return HSI2C_MasterTransferPollDeadline(HSI2Cx, pu8Data, u32Size, &stcDeadline);
 }
 
+
 /**
  * @brief  HSI2C从机初始化
  * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
@@ -682,6 +558,7 @@ en_result_t HSI2C_SlaveTransferInt(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint
  * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
  * @param  [in] pu8Data 传输数据首地址
  * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] u32Timeout 超时保护计数值（查询次数，为整个传输的总次数上限）
  * @retval en_result_t
  *           - Ok: 设置成功
  *           - Error: 设置失败
@@ -689,151 +566,61 @@ en_result_t HSI2C_SlaveTransferInt(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint
  */
 en_result_t HSI2C_SlaveTransferPoll(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32Timeout)
 {
-    en_result_t enResult = Ok;
-    uint32_t    u32Flag  = 0;
-    DDL_ZERO_STRUCT(stcHsi2cCom);
+    stc_ddl_deadline_t stcDeadline;
 
-    if (Hsi2cComIdle == stcHsi2cCom.enComStatus)
-    {
-        if (TRUE == HSI2C_SlaveFlagGet(HSI2Cx, HSI2C_SLAVE_FLAG_BBF))
-        {
-            enResult = Error;
-        }
-        else
-        {
-            enMasterStatusMachine      = Hsi2cStatusStart;
-            stcHsi2cCom.HSI2CxBaseAddr = HSI2Cx;
-            stcHsi2cCom.enComStatus    = Hsi2cComBusy;
-            stcHsi2cCom.u32DataIndex   = 0U;
-            stcHsi2cCom.u32Len         = u32Size;
-            stcHsi2cCom.pu8Buf         = pu8Data;
+    DDL_DeadlineCountInit(&stcDeadline, u32Timeout);
+    return HSI2C_SlaveTransferPollDeadline(HSI2Cx, pu8Data, u32Size, &stcDeadline);
+}
 
-            stcHsi2cCom.u32RxSize = stcHsi2cSlaveInit.u8SubAddrSize;
+/**
+ * @brief  HSI2C从机轮询传输设置（微秒超时）
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pu8Data 传输数据首地址
+ * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] u32TimeoutUs 超时时间，单位us，为整个传输的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - Error: 设置失败
+ *           - ErrorTimeout：超时
+ */
+en_result_t HSI2C_SlaveTransferPollTimeoutUs(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-            HSI2C_SlaveFlagClear(HSI2Cx, HSI2C_SLAVE_FLAG_CLR_ALL); /* Clear flags */
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return HSI2C_SlaveTransferPollDeadline(HSI2Cx, pu8Data, u32Size, &stcDeadline);
+}
 
-            while (1)
-            {
-                if (0x0u == u32Timeout--)
-                {
-                    enResult = ErrorTimeout; /* 等待超时 */
-                    break;
-                }
 
-                u32Flag                          = stcHsi2cCom.HSI2CxBaseAddr->SSR;
-                stcHsi2cCom.HSI2CxBaseAddr->SSCR = u32Flag;
+/**
+ * @brief  主机配置寄存器1设置(MCFGR1寄存器设置)
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pstcHsi2cConfig MCFGR1寄存器配置结构体 @ref stc_hsi2c_master_config1_t
+ * @retval None
+ */
+void HSI2C_MasterMcfgr1Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config1_t *pstcHsi2cConfig)
+{
+    MODIFY_REG32(HSI2Cx->MCFGR1,
+                 HSI2C_MCFGR1_MATCFG_Msk | HSI2C_MCFGR1_RDMO_Msk | HSI2C_MCFGR1_TIMECFG_Msk | HSI2C_MCFGR1_IGNACK_Msk | HSI2C_MCFGR1_AUTOSTOP_Msk,
+                 pstcHsi2cConfig->u32MatchConfig | pstcHsi2cConfig->u32ReceiveDataMatchOnly | pstcHsi2cConfig->u32TimeoutConfig | pstcHsi2cConfig->u32IgnoreNack
+                     | pstcHsi2cConfig->u32AutoStop);
+}
 
-                if (Hsi2cComSuccess == HSI2C_SlaveErrorGet(u32Flag))
-                {
-                    /* Receive */
-                    if (u32Flag & HSI2C_SLAVE_FLAG_RDF)
-                    {
-                        uint32_t u32RxData = stcHsi2cCom.HSI2CxBaseAddr->SRDR;
-                        if (!(u32RxData & HSI2C_SRDR_REMP_Msk))
-                        {
-                            if (0 != stcHsi2cCom.u32RxSize) /* 需要接收Sub address */
-                            {
-                                stcHsi2cCom.u8SubAddr[stcHsi2cCom.u32RxSize - 1] = (uint8_t)(u32RxData);
-                                stcHsi2cCom.u32RxSize--;
-                            }
-                            else /* 不需要接收Sub address */
-                            {
-                                if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len)
-                                {
-                                    stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++] = (uint8_t)(u32RxData);
-                                }
-                                if (stcHsi2cCom.u32DataIndex >= stcHsi2cCom.u32Len)
-                                {
-                                    stcHsi2cCom.HSI2CxBaseAddr->STAR = HSI2C_STAR_TXNACK_Msk; /* Send NACK */
-                                    stcHsi2cCom.u32DataIndex         = 0;
-                                }
-                            }
-                        }
-                    }
-
-                    /* Transmit */
-                    if (u32Flag & HSI2C_SLAVE_FLAG_TDF)
-                    {
-                        if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len)
-                        {
-                            HSI2C_SlaveWriteData(stcHsi2cCom.HSI2CxBaseAddr, stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++]);
-                        }
-                        if (stcHsi2cCom.u32DataIndex >= stcHsi2cCom.u32Len)
-                        {
-                            stcHsi2cCom.u32DataIndex = 0;
-                        }
-                    }
-
-                    /* Stop or restart */
-                    if (u32Flag & (HSI2C_SLAVE_FLAG_RSF | HSI2C_SLAVE_FLAG_SDF))
-                    {
-                        if (u32Flag & HSI2C_SLAVE_FLAG_SDF)
-                        {
-                            stcHsi2cCom.enComStatus = Hsi2cComIdle;
-                        }
-                        stcHsi2cCom.HSI2CxBaseAddr->STAR = 0;
-                    }
-
-                    /* Valid address */
-                    if (u32Flag & (HSI2C_SLAVE_FLAG_AVF | HSI2C_SLAVE_FLAG_AM0F | HSI2C_SLAVE_FLAG_AM1F))
-                    {
-                        /* Get received slave address */
-                        volatile uint32_t u32Temp = stcHsi2cCom.HSI2CxBaseAddr->SASR;
-                    }
-
-                    /* Transmit ACK */
-                    if (u32Flag & HSI2C_SLAVE_FLAG_TAF)
-                    {
-                        stcHsi2cCom.HSI2CxBaseAddr->STAR = 0;
-                    }
-
-                    if (stcHsi2cCom.enComStatus == Hsi2cComIdle)
-                    {
-                        break; /* Transfer完成 */
-                    }
-                }
-                else /* Error handling */
-                {
-                    HSI2C_SlaveTransAbort(stcHsi2cCom.HSI2CxBaseAddr);
-                    stcHsi2cCom.enComStatus = Hsi2cComIdle;
-                    enResult                = Error;
-                    break;
-                }
-            }
-        }
-    }
-    return enResult;
-}
-
-/**
- * @brief  主机配置寄存器1设置(MCFGR1寄存器设置)
- * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
- * @param  [in] pstcHsi2cConfig MCFGR1寄存器配置结构体 @ref stc_hsi2c_master_config1_t
- * @retval None
- */
-void HSI2C_MasterMcfgr1Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config1_t *pstcHsi2cConfig)
-{
-    MODIFY_REG32(HSI2Cx->MCFGR1,
-                 HSI2C_MCFGR1_MATCFG_Msk | HSI2C_MCFGR1_RDMO_Msk | HSI2C_MCFGR1_TIMECFG_Msk | HSI2C_MCFGR1_IGNACK_Msk | HSI2C_MCFGR1_AUTOSTOP_Msk,
-                 pstcHsi2cConfig->u32MatchConfig | pstcHsi2cConfig->u32ReceiveDataMatchOnly | pstcHsi2cConfig->u32TimeoutConfig | pstcHsi2cConfig->u32IgnoreNack
-                     | pstcHsi2cConfig->u32AutoStop);
-}
-
-/**
- * @brief  主机配置寄存器2设置(MCFGR2寄存器设置)
- * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
- * @param  [in] pstcHsi2cConfig MCFGR2寄存器配置结构体 @ref stc_hsi2c_master_config2_t
- * @retval None
- */
-void HSI2C_MasterMcfgr2Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config2_t *pstcHsi2cConfig)
-{
-    MODIFY_REG32(HSI2Cx->MCFGR2, HSI2C_MCFGR2_FILTSDA_Msk | HSI2C_MCFGR2_FILTSCL_Msk | HSI2C_MCFGR2_BUSIDLE_Msk,
-                 (pstcHsi2cConfig->u32SdaGlitchFilterConfig << HSI2C_MCFGR2_FILTSDA_Pos)
-                     | (pstcHsi2cConfig->u32SclGlitchFilterConfig << HSI2C_MCFGR2_FILTSCL_Pos)
-                     | (pstcHsi2cConfig->u32BusIdleTimeout << HSI2C_MCFGR2_BUSIDLE_Pos));
-    MODIFY_REG32(HSI2Cx->MCFGR2, HSI2C_MCFGR2_FILTBPSDA_Msk | HSI2C_MCFGR2_FILTBPSCL_Msk,
-                 pstcHsi2cConfig->u32SdaFilterEnable | pstcHsi2cConfig->u32SclFilterEnable);
-}
+/**
+ * @brief  主机配置寄存器2设置(MCFGR2寄存器设置)
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pstcHsi2cConfig MCFGR2寄存器配置结构体 @ref stc_hsi2c_master_config2_t
+ * @retval None
+ */
+void HSI2C_MasterMcfgr2Config(HSI2C_TypeDef *HSI2Cx, stc_hsi2c_master_config2_t *pstcHsi2cConfig)
+{
+    MODIFY_REG32(HSI2Cx->MCFGR2, HSI2C_MCFGR2_FILTSDA_Msk | HSI2C_MCFGR2_FILTSCL_Msk | HSI2C_MCFGR2_BUSIDLE_Msk,
+                 (pstcHsi2cConfig->u32SdaGlitchFilterConfig << HSI2C_MCFGR2_FILTSDA_Pos)
+                     | (pstcHsi2cConfig->u32SclGlitchFilterConfig << HSI2C_MCFGR2_FILTSCL_Pos)
+                     | (pstcHsi2cConfig->u32BusIdleTimeout << HSI2C_MCFGR2_BUSIDLE_Pos));
+    MODIFY_REG32(HSI2Cx->MCFGR2, HSI2C_MCFGR2_FILTBPSDA_Msk | HSI2C_MCFGR2_FILTBPSCL_Msk,
+                 pstcHsi2cConfig->u32SdaFilterEnable | pstcHsi2cConfig->u32SclFilterEnable);
+}
 
 /**
  * @brief  主机配置寄存器3设置(MCFGR3寄存器设置)
@@ -1369,6 +1156,310 @@ void HSI2C_SlaveStcInit(stc_hsi2c_slave_init_t *pstcInit)
  * @}
  */
 
+/**
+ * @defgroup HSI2C_Local_Functions HSI2C局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  HSI2C主机轮询传输，超时由截止时间判断
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pu8Data 传输数据首地址
+ * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - Error: 设置失败
+ *           - ErrorTimeout：超时
+ */
+static en_result_t HSI2C_MasterTransferPollDeadline(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline)
+{
+    uint32_t    u32Flag  = 0;
+    en_result_t enResult = Ok;
+    DDL_ZERO_STRUCT(stcHsi2cCom);
+
+    if (Hsi2cComIdle == stcHsi2cCom.enComStatus)
+    {
+        if (TRUE == HSI2C_MasterFlagGet(HSI2Cx, HSI2C_MASTER_FLAG_BBF))
+        {
+            enResult = Error;
+        }
+        else
+        {
+            enMasterStatusMachine = Hsi2cStatusStart;
+
+            stcHsi2cCom.HSI2CxBaseAddr = HSI2Cx;
+            stcHsi2cCom.enComStatus    = Hsi2cComBusy;
+            stcHsi2cCom.u32DataIndex   = 0;
+            stcHsi2cCom.u32Len         = u32Size;
+            stcHsi2cCom.pu8Buf         = pu8Data;
+
+            stcHsi2cCom.u32RxSize = stcHsi2cCom.u32Len;
+
+            HSI2C_MasterFlagClear(HSI2Cx, HSI2C_MASTER_FLAG_CLR_ALL); /* Clear flags */
+
+            HSI2Cx->MCFGR1 &= ~HSI2C_MCFGR1_AUTOSTOP_Msk; /* Disable auto-stop */
+
+            while (1)
+            {
+                if (DDL_DeadlineExpired(pstcDeadline))
+                {
+                    enResult = ErrorTimeout; /* 等待超时 */
+                    break;
+                }
+                u32Flag                          = stcHsi2cCom.HSI2CxBaseAddr->MSR;
+                stcHsi2cCom.HSI2CxBaseAddr->MSCR = u32Flag;
+
+                if (Hsi2cComSuccess == HSI2C_MasterErrorGet(u32Flag))
+                {
+                    switch (enMasterStatusMachine)
+                    {
+                        case Hsi2cStatusStart:
+                            HSI2C_MasterStatusMachineStart();
+                            break;
+                        case Hsi2cStatusSubAddr:
+                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
+                            {
+                                HSI2C_MasterStatusMachineSubAddr();
+                            }
+                            break;
+                        case Hsi2cStatusRestart:
+                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
+                            {
+                                HSI2C_MasterStatusMachineRestart();
+                            }
+                            break;
+                        case Hsi2cStatusRxCmd:
+                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
+                            {
+                                HSI2C_MasterStatusMachineRxCmd(&stcHsi2cCom.u32RxSize);
+                            }
+                            break;
+                        case Hsi2cStatusTransData:
+                            if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len) /* Data transmit or receive */
+                            {
+                                if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
+                                {
+                                    if (stcHsi2cMasterInit.enDir == Hsi2cMasterWriteSlaveRead) /* Transmit */
+                                    {
+                                        HSI2C_MasterWriteData(stcHsi2cCom.HSI2CxBaseAddr, stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++]);
+                                    }
+                                }
+                                if ((u32Flag & HSI2C_MSR_RDF_Msk) == HSI2C_MSR_RDF_Msk)
+                                {
+                                    if (stcHsi2cMasterInit.enDir == Hsi2cMasterReadSlaveWrite) /* Recieve */
+                                    {
+                                        if (Ok == HSI2C_MasterReadData(stcHsi2cCom.HSI2CxBaseAddr, &stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex]))
+                                        {
+                                            stcHsi2cCom.u32DataIndex++;
+                                        }
+                                    }
+                                }
+                            }
+                            HSI2C_MasterStatusMachineTrans();
+                            break;
+                        case Hsi2cStatusStop:
+                            if ((u32Flag & HSI2C_MSR_TDF_Msk) == HSI2C_MSR_TDF_Msk)
+                            {
+                                HSI2C_MasterStatusMachineStop();
+                            }
+                            break;
+                        case Hsi2cStatusWaitEnd:
+                            /* Wait for transfer end */
+                            if (u32Flag & HSI2C_MSR_SDF_Msk)
+                            {
+                                stcHsi2cCom.enComStatus = Hsi2cComIdle;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+
+                    if (stcHsi2cCom.enComStatus == Hsi2cComIdle)
+                    {
+                        break; /* Transfer完成 */
+                    }
+                }
+                else /* Error handling */
+                {
+                    /* Disable all master interrupts */
+                    HSI2C_MasterIntDisable(stcHsi2cCom.HSI2CxBaseAddr, HSI2C_MASTER_INT_ALL);
+
+                    /* Arbitration lost? */
+                    if (u32Flag & HSI2C_MSR_ALF_Msk)
+                    {
+                        /* Reset master */
+                        HSI2C_MasterReset(HSI2Cx);
+                    }
+                    /* Pin low timeout? */
+                    else if (u32Flag & HSI2C_MSR_PLTF_Msk)
+                    {
+                        /* Reset master */
+                        HSI2C_MasterReset(HSI2Cx);
+                        /* ======================================= */
+                        /* ==========       WARNING       ======== */
+                        /* ======================================= */
+                        /* 1. 根据实际情况添加代码处理引脚低条件      */
+                        /* 2. 当引脚低超时持续时，PLTF不能被清除掉    */
+                        /* 3. 在I2C可以开始启动条件之前，必须清除PLTF */
+                    }
+                    /* Master busy? */
+                    else if (u32Flag & HSI2C_MSR_MBF_Msk)
+                    {
+                        /* Send stop command */
+                        HSI2C_MasterStop(stcHsi2cCom.HSI2CxBaseAddr);
+                    }
+                    else
+                    {
+                        ;
+                    }
+
+                    stcHsi2cCom.enComStatus = Hsi2cComIdle;
+                    enResult                = Error;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        enResult = Error;
+    }
+    return enResult;
+}
+
+/**
+ * @brief  HSI2C从机轮询传输，超时由截止时间判断
+ * @param  [in] HSI2Cx HSI2Cx通道 @ref HSI2C_TypeDef
+ * @param  [in] pu8Data 传输数据首地址
+ * @param  [in] u32Size 传输数据长度（字节）
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - Error: 设置失败
+ *           - ErrorTimeout：超时
+ */
+static en_result_t HSI2C_SlaveTransferPollDeadline(HSI2C_TypeDef *HSI2Cx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline)
+{
+    en_result_t enResult = Ok;
+    uint32_t    u32Flag  = 0;
+    DDL_ZERO_STRUCT(stcHsi2cCom);
+
+    if (Hsi2cComIdle == stcHsi2cCom.enComStatus)
+    {
+        if (TRUE == HSI2C_SlaveFlagGet(HSI2Cx, HSI2C_SLAVE_FLAG_BBF))
+        {
+            enResult = Error;
+        }
+        else
+        {
+            enMasterStatusMachine      = Hsi2cStatusStart;
+            stcHsi2cCom.HSI2CxBaseAddr = HSI2Cx;
+            stcHsi2cCom.enComStatus    = Hsi2cComBusy;
+            stcHsi2cCom.u32DataIndex   = 0U;
+            stcHsi2cCom.u32Len         = u32Size;
+            stcHsi2cCom.pu8Buf         = pu8Data;
+
+            stcHsi2cCom.u32RxSize = stcHsi2cSlaveInit.u8SubAddrSize;
+
+            HSI2C_SlaveFlagClear(HSI2Cx, HSI2C_SLAVE_FLAG_CLR_ALL); /* Clear flags */
+
+            while (1)
+            {
+                if (DDL_DeadlineExpired(pstcDeadline))
+                {
+                    enResult = ErrorTimeout; /* 等待超时 */
+                    break;
+                }
+
+                u32Flag                          = stcHsi2cCom.HSI2CxBaseAddr->SSR;
+                stcHsi2cCom.HSI2CxBaseAddr->SSCR = u32Flag;
+
+                if (Hsi2cComSuccess == HSI2C_SlaveErrorGet(u32Flag))
+                {
+                    /* Receive */
+                    if (u32Flag & HSI2C_SLAVE_FLAG_RDF)
+                    {
+                        uint32_t u32RxData = stcHsi2cCom.HSI2CxBaseAddr->SRDR;
+                        if (!(u32RxData & HSI2C_SRDR_REMP_Msk))
+                        {
+                            if (0 != stcHsi2cCom.u32RxSize) /* 需要接收Sub address */
+                            {
+                                stcHsi2cCom.u8SubAddr[stcHsi2cCom.u32RxSize - 1] = (uint8_t)(u32RxData);
+                                stcHsi2cCom.u32RxSize--;
+                            }
+                            else /* 不需要接收Sub address */
+                            {
+                                if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len)
+                                {
+                                    stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++] = (uint8_t)(u32RxData);
+                                }
+                                if (stcHsi2cCom.u32DataIndex >= stcHsi2cCom.u32Len)
+                                {
+                                    stcHsi2cCom.HSI2CxBaseAddr->STAR = HSI2C_STAR_TXNACK_Msk; /* Send NACK */
+                                    stcHsi2cCom.u32DataIndex         = 0;
+                                }
+                            }
+                        }
+                    }
+
+                    /* Transmit */
+                    if (u32Flag & HSI2C_SLAVE_FLAG_TDF)
+                    {
+                        if (stcHsi2cCom.u32DataIndex < stcHsi2cCom.u32Len)
+                        {
+                            HSI2C_SlaveWriteData(stcHsi2cCom.HSI2CxBaseAddr, stcHsi2cCom.pu8Buf[stcHsi2cCom.u32DataIndex++]);
+                        }
+                        if (stcHsi2cCom.u32DataIndex >= stcHsi2cCom.u32Len)
+                        {
+                            stcHsi2cCom.u32DataIndex = 0;
+                        }
+                    }
+
+                    /* Stop or restart */
+                    if (u32Flag & (HSI2C_SLAVE_FLAG_RSF | HSI2C_SLAVE_FLAG_SDF))
+                    {
+                        if (u32Flag & HSI2C_SLAVE_FLAG_SDF)
+                        {
+                            stcHsi2cCom.enComStatus = Hsi2cComIdle;
+                        }
+                        stcHsi2cCom.HSI2CxBaseAddr->STAR = 0;
+                    }
+
+                    /* Valid address */
+                    if (u32Flag & (HSI2C_SLAVE_FLAG_AVF | HSI2C_SLAVE_FLAG_AM0F | HSI2C_SLAVE_FLAG_AM1F))
+                    {
+                        /* Get received slave address */
+                        (void)stcHsi2cCom.HSI2CxBaseAddr->SASR;
+                    }
+
+                    /* Transmit ACK */
+                    if (u32Flag & HSI2C_SLAVE_FLAG_TAF)
+                    {
+                        stcHsi2cCom.HSI2CxBaseAddr->STAR = 0;
+                    }
+
+                    if (stcHsi2cCom.enComStatus == Hsi2cComIdle)
+                    {
+                        break; /* Transfer完成 */
+                    }
+                }
+                else /* Error handling */
+                {
+                    HSI2C_SlaveTransAbort(stcHsi2cCom.HSI2CxBaseAddr);
+                    stcHsi2cCom.enComStatus = Hsi2cComIdle;
+                    enResult                = Error;
+                    break;
+                }
+            }
+        }
+    }
+    return enResult;
+}
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -60,7 +60,7 @@
  * @defgroup IWDT_Timeout IWDT超时时间
  * @{
  */
-#define IWDT_TIMEOUT 0xFFFFu
+#define IWDT_TIMEOUT (20000u) /*!< 寄存器同步等待超时时间（us） */
 /**
  * @}
  */
@@ -94,35 +94,35 @@
  */
 en_result_t IWDT_Init(stc_iwdt_init_t *pstcIwdtInit)
 {
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
 
     WRITE_REG32(IWDT->KR, IWDT_KEY_START_VALUE);
     WRITE_REG32(IWDT->KR, IWDT_KEY_LOCK_RELEASE);
 
-    u32Timeout = IWDT_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, IWDT_TIMEOUT);
     while (READ_REG32_BIT(IWDT->SR, IWDT_SR_PRSF_Msk | IWDT_SR_ARRF_Msk | IWDT_SR_WINRF_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
     }
 
     WRITE_REG32(IWDT->CR, pstcIwdtInit->u32Action | pstcIwdtInit->u32Prescaler);
-    u32Timeout = IWDT_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, IWDT_TIMEOUT);
     while (READ_REG32_BIT(IWDT->SR, IWDT_SR_PRSF_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
     }
 
     WRITE_REG32(IWDT->ARR, pstcIwdtInit->u32ArrCounter);
-    u32Timeout = IWDT_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, IWDT_TIMEOUT);
     while (READ_REG32_BIT(IWDT->SR, IWDT_SR_ARRF_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -131,10 +131,10 @@ en_result_t IWDT_Init(stc_iwdt_init_t *pstcIwdtInit)
     if (pstcIwdtInit->u32Window < pstcIwdtInit->u32ArrCounter) /*!< 窗口看门狗模式 */
     {
         WRITE_REG32(IWDT->WINR, pstcIwdtInit->u32Window);
-        u32Timeout = IWDT_TIMEOUT;
+        DDL_DeadlineInit(&stcDeadline, IWDT_TIMEOUT);
         while (READ_REG32_BIT(IWDT->SR, IWDT_SR_WINRF_Msk))
         {
-            if (0 == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout;
             }
@@ -143,10 +143,10 @@ en_result_t IWDT_Init(stc_iwdt_init_t *pstcIwdtInit)
 
     else /*!< 独立看门狗模式 */
     {
-        u32Timeout = IWDT_TIMEOUT;
+        DDL_DeadlineInit(&stcDeadline, IWDT_TIMEOUT);
         while (!READ_REG32_BIT(IWDT->SR, IWDT_SR_RUN_Msk))
         {
-            if (0 == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout;
             }
@@ -6,6 +6,18 @@
    Change Logs:
    Date             Author          Notes
    2024-09-18       MADS            First version
+   2026-10-18       MADS            Add interrupt driven ring buffer transfer
+   2026-10-18       MADS            Add integer baud rate solver
+   2026-10-18       MADS            Add XTL BSEL/MODU baud rate generator
+   2026-10-18       MADS            Add inter-frame gap framing with BTIM one-shot
+   2026-10-18       MADS            Fix LPUART_MultiModeConfig() OR-ing SADDR/SADEN, add multidrop node stack
+   2026-10-18       MADS            Add auto-baud detection with ATIM3 PWC on RXD
+   2026-10-18       MADS            Add interrupt-driven single-wire half-duplex transaction engine
+   2026-10-18       MADS            Add deep sleep receive with batched wakeup
+   2026-10-18       MADS            Restore loop-count poll timeouts, add microsecond *TimeOutUs variants
+   2026-10-18       MADS            Check NULL control block in LPUART_RingDeInit()
+   2026-10-18       MADS            Add timeout to LPUART_NodeSend(), send the address bit with the SBUF write only
+   2026-10-18       MADS            Restore the previous ATIM3_C0A input selection in LPUART_AutoBaudStop()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -22,6 +34,10 @@
  * Include files
  ******************************************************************************/
 #include "lpuart.h"
+#include "atim3.h"
+#include "btim.h"
+#include "gpio.h"
+#include "lpm.h"
 
 /**
  * @addtogroup HC32L021_DDL 驱动库
@@ -43,7 +59,28 @@
  * @defgroup LPUART_Local_Macros LPUART局部宏定义
  * @{
  */
-#define LPUART_TIMEOUT (0xFFFFFFu) /* 超时保护计数值 */
+#define LPUART_RING_SIZE_MAX (0x8000u) /*!< 环形缓冲最大长度（16位自由递增索引） */
+
+#define IS_VALID_RING_SIZE(x) (((x) <= LPUART_RING_SIZE_MAX) && (0u == ((x) & ((x) - 1u))))
+
+#define LPUART_FRAME_CHAR_BITS (11u)    /*!< 帧内字符间隔检查的字符长度（位） */
+#define LPUART_FRAME_TICKS_MAX (0x10000u) /*!< 帧结束间隔最大计数（ARR+1） */
+
+#define LPUART_NODE_ST_IDLE (0u) /*!< 等待地址帧 */
+#define LPUART_NODE_ST_LEN  (1u) /*!< 等待长度字节 */
+#define LPUART_NODE_ST_DATA (2u) /*!< 接收数据字节 */
+
+#define IS_VALID_NODE_FILTER(x) ((LPUART_NODE_FILTER_HW == (x)) || (LPUART_NODE_FILTER_SW == (x)))
+
+#define LPUART_AUTOBAUD_PCLK_MAX (UINT32_MAX / 9u) /*!< PCLK乘脉冲位数不超出32位 */
+#define LPUART_AUTOBAUD_TOL_MAX  (100000u)         /*!< 最大偏差上限10% */
+
+/* 同步字节低位连续的0之后全为1：取反后为2^n-1 */
+#define IS_VALID_AUTOBAUD_SYNC(x) (0u == ((uint8_t)~(x) & (uint8_t)((uint8_t)~(x) + 1u)))
+
+#define LPUART_HD_ST_IDLE (0u) /*!< 无事务 */
+#define LPUART_HD_ST_TX   (1u) /*!< 发送中，核对回波 */
+#define LPUART_HD_ST_RX   (2u) /*!< 总线已释放，等待应答 */
 /**
  * @}
  */
@@ -53,6 +90,23 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static en_result_t LPUART_TransmitPollDeadline(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline);
+static en_result_t LPUART_ReceivePollDeadline(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline);
+static void        LPUART_RingIrqCallback(uint32_t u32Flags, void *pvArg);
+static en_result_t LPUART_FrameGapIrqGet(const BTIM_TypeDef *BTIMx, IRQn_Type *penIrq, uint32_t *pu32Flag);
+static uint32_t    LPUART_FrameTicks(uint32_t u32Pclk, uint32_t u32Us, uint32_t u32Prs);
+static void        LPUART_FrameEnd(stc_lpuart_frame_t *pstcFrame);
+static void        LPUART_FrameRxIrqCallback(uint32_t u32Flags, void *pvArg);
+static void        LPUART_FrameGapIrqCallback(uint32_t u32Flags, void *pvArg);
+static boolean_t   LPUART_NodeAddrMatch(const stc_lpuart_node_t *pstcNode, uint8_t u8Addr);
+static void        LPUART_NodeIdle(stc_lpuart_node_t *pstcNode);
+static void        LPUART_NodeFrameEnd(stc_lpuart_node_t *pstcNode);
+static en_result_t LPUART_NodeByteSend(LPUART_TypeDef *LPUARTx, uint32_t u32Frame, stc_ddl_deadline_t *pstcDeadline);
+static void        LPUART_NodeIrqCallback(uint32_t u32Flags, void *pvArg);
+static void        LPUART_AutoBaudIrqCallback(uint32_t u32Flags, void *pvArg);
+static void        LPUART_HdFinish(stc_lpuart_hd_t *pstcHd, uint32_t u32Status);
+static void        LPUART_HdIrqCallback(uint32_t u32Flags, void *pvArg);
+static void        LPUART_LpRxIrqCallback(uint32_t u32Flags, void *pvArg);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
@@ -66,34 +120,97 @@
 
 /**
  * @brief  LPUART初始化函数
+ * @note   OVER及SCNT由LPUART_BaudCalc()计算
  * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
  * @param  [in] pstcLpuartInit LPUART初始化配置结构体 @ref stc_lpuart_init_t
  * @retval uint32_t
- *           - 最终波特率设定值
+ *           - 最终波特率设定值，无有效配置时为0（不设置OVER及SCNT）
  */
 uint32_t LPUART_Init(LPUART_TypeDef *LPUARTx, stc_lpuart_init_t *pstcLpuartInit)
 {
-    uint32_t  u32Bps  = 0;
-    float32_t f32Scnt = 0;
+    stc_lpuart_baud_cfg_t stcBaudCfg;
 
     CLR_REG(LPUARTx->SCON);
 
     WRITE_REG(LPUARTx->SCON, pstcLpuartInit->u32StopBits | pstcLpuartInit->u32Parity | pstcLpuartInit->u32FrameLength | pstcLpuartInit->u32TransMode
                                  | pstcLpuartInit->u32HwControl | pstcLpuartInit->stcBaudRate.u32SclkSelect);
 
-    MODIFY_REG(LPUARTx->SCON, LPUART_SCON_OVER, (0x2UL << LPUART_SCON_OVER_Pos));
+    if (Ok != LPUART_BaudCalc(pstcLpuartInit->stcBaudRate.u32Sclk, pstcLpuartInit->stcBaudRate.u32Baud, &stcBaudCfg))
+    {
+        return 0u;
+    }
+    LPUART_BaudSet(LPUARTx, &stcBaudCfg);
+
+    return stcBaudCfg.u32Baud; /* 最终波特率设定值*/
+}
+
+/**
+ * @brief  LPUART波特率配置计算（整数运算）
+ * @note   依次计算16、8、4分频下的SCNT（Sclk/(分频*Baud)四舍五入，位时间误差最小），
+ *         取波特率误差绝对值最小的配置，误差相同时取较大的分频；SCNT超出65535的分频不选。
+ *         结果与编译期计算LPUART_BAUD_CFG()一致
+ * @param  [in] u32Sclk 传输时钟频率
+ * @param  [in] u32Baud 目标波特率
+ * @param  [out] pstcCfg 波特率配置及误差 @ref stc_lpuart_baud_cfg_t
+ * @retval en_result_t
+ *           - Ok: 计算成功
+ *           - ErrorInvalidParameter: 参数为0或无有效配置
+ */
+en_result_t LPUART_BaudCalc(uint32_t u32Sclk, uint32_t u32Baud, stc_lpuart_baud_cfg_t *pstcCfg)
+{
+    static const uint8_t au8Div[] = {16u, 8u, 4u};
+    uint32_t             u32Den;
+    uint32_t             u32Scnt;
+    uint32_t             u32AbsErr;
+    uint32_t             u32BestErr = UINT32_MAX;
+    int32_t              i32Err;
+    uint32_t             i;
+
+    if ((NULL == pstcCfg) || (0u == u32Sclk) || (0u == u32Baud) || (u32Baud > (UINT32_MAX / 16u)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    for (i = 0u; i < sizeof(au8Div); i++)
+    {
+        u32Scnt = DDL_UDivRound(u32Sclk, au8Div[i] * u32Baud);
+        u32Scnt = (0u == u32Scnt) ? 1u : u32Scnt;
+        if (u32Scnt > 0xFFFFu)
+        {
+            continue;
+        }
 
-    f32Scnt = (float32_t)(pstcLpuartInit->stcBaudRate.u32Sclk) / (float32_t)(pstcLpuartInit->stcBaudRate.u32Baud << 2);
-    WRITE_REG(LPUARTx->SCNT, (uint16_t)(float32_t)(f32Scnt + 0.5f));
+        u32Den    = au8Div[i] * u32Scnt;
+        i32Err    = (int32_t)((((int64_t)u32Sclk - ((int64_t)u32Den * u32Baud)) * 1000000) / ((int64_t)u32Den * u32Baud));
+        u32AbsErr = (uint32_t)((i32Err < 0) ? -i32Err : i32Err);
+        if (u32AbsErr < u32BestErr)
+        {
+            u32BestErr         = u32AbsErr;
+            pstcCfg->u32Over   = (uint32_t)i << LPUART_SCON_OVER_Pos;
+            pstcCfg->u32Scnt   = u32Scnt;
+            pstcCfg->u32Baud   = u32Sclk / u32Den;
+            pstcCfg->i32ErrPpm = i32Err;
+        }
+    }
 
-    u32Bps = (((pstcLpuartInit->stcBaudRate.u32Sclk) / ((uint16_t)(float32_t)(f32Scnt + 0.5f))) >> 2); /* 最终波特率设定值*/
+    return (UINT32_MAX == u32BestErr) ? ErrorInvalidParameter : Ok;
+}
 
-    return u32Bps;
+/**
+ * @brief  LPUART波特率配置：设置OVER及SCNT
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcCfg 波特率配置，由LPUART_BaudCalc()或LPUART_BAUD_CFG()得到 @ref stc_lpuart_baud_cfg_t
+ * @retval None
+ */
+void LPUART_BaudSet(LPUART_TypeDef *LPUARTx, const stc_lpuart_baud_cfg_t *pstcCfg)
+{
+    MODIFY_REG(LPUARTx->SCON, LPUART_SCON_OVER, pstcCfg->u32Over);
+    WRITE_REG(LPUARTx->SCNT, pstcCfg->u32Scnt);
 }
 
 /**
  * @brief  LPUART XTL波特率产生寄存器
- * @note   当XTL时钟为32768时，调用此函数产生9600或者4800波特率
+ * @note   当XTL时钟为32768时，调用此函数产生9600或者4800波特率，MODU由LPUART_XtlBaudCalc()计算
  * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
  * @param  [in] u32BselConfig 波特率选择 @ref LPUART_XTL_32768_Baud_Select
  * @retval en_result_t
@@ -102,35 +219,114 @@ uint32_t LPUART_Init(LPUART_TypeDef *LPUARTx, stc_lpuart_init_t *pstcLpuartInit)
  */
 en_result_t LPUART_XtlBselSet(LPUART_TypeDef *LPUARTx, uint32_t u32BselConfig)
 {
-    en_result_t enRet = Ok;
+    stc_lpuart_xtl_baud_t stcXtlBaud;
 
-    if (LPUART_SCLK_SEL_XTL == READ_REG32_BIT(LPUARTx->SCON, LPUART_SCON_SCLKSEL_Msk))
+    if (LPUART_XTL_BAUD_9600 == u32BselConfig)
     {
-        if (u32BselConfig == LPUART_XTL_BAUD_9600)
-        {
-            WRITE_REG32(LPUARTx->BSEL, LPUART_XTL_BAUD_9600);
-            WRITE_REG32(LPUARTx->MODU, 0x54Au);
-        }
-        else if (u32BselConfig == LPUART_XTL_BAUD_4800)
-        {
-            WRITE_REG32(LPUARTx->BSEL, LPUART_XTL_BAUD_4800);
-            WRITE_REG32(LPUARTx->MODU, 0xEFBu);
-        }
-        else
+        (void)LPUART_XtlBaudCalc(9600u, &stcXtlBaud); /* MODU = 0x54A */
+    }
+    else if (LPUART_XTL_BAUD_4800 == u32BselConfig)
+    {
+        (void)LPUART_XtlBaudCalc(4800u, &stcXtlBaud); /* MODU = 0xEFB */
+    }
+    else
+    {
+        return Error;
+    }
+
+    return LPUART_XtlBaudSet(LPUARTx, &stcXtlBaud);
+}
+
+/**
+ * @brief  LPUART XTL调制波特率计算（整数运算）
+ * @note   位时间T = 32768/Baud个XTL时钟，BSEL选择每位的时钟基数（3或6），MODU第i位为1时第i位加1个时钟。
+ *         第i位的时钟数取round((i+1)*T) - round(i*T)，各位边沿与理想位置的偏差不超过半个XTL时钟，
+ *         为12位内最大边沿偏差最小的调制；9600、4800波特率的结果为0x54A、0xEFB
+ * @param  [in] u32Baud 目标波特率：8192~10922（BSEL=2）或4682~5461（BSEL=3）
+ * @param  [out] pstcCfg 调制配置及误差 @ref stc_lpuart_xtl_baud_t
+ * @retval en_result_t
+ *           - Ok: 计算成功
+ *           - ErrorInvalidParameter: 波特率不能由调制产生
+ */
+en_result_t LPUART_XtlBaudCalc(uint32_t u32Baud, stc_lpuart_xtl_baud_t *pstcCfg)
+{
+    uint32_t u32Edge   = 0u; /* 实际边沿位置（XTL时钟） */
+    uint32_t u32MaxErr = 0u;
+    uint32_t u32Modu   = 0u;
+    uint32_t u32Ideal; /* 理想边沿位置round(i*T) */
+    uint32_t u32Base;
+    uint32_t u32Err;
+    uint32_t i;
+
+    if (NULL == pstcCfg)
+    {
+        return ErrorInvalidParameter;
+    }
+
+    if (((u32Baud * 3u) <= LPUART_XTL_FREQ) && ((u32Baud * 4u) >= LPUART_XTL_FREQ))
+    {
+        u32Base          = 3u;
+        pstcCfg->u32Bsel = LPUART_XTL_BAUD_9600;
+    }
+    else if (((u32Baud * 6u) <= LPUART_XTL_FREQ) && ((u32Baud * 7u) >= LPUART_XTL_FREQ))
+    {
+        u32Base          = 6u;
+        pstcCfg->u32Bsel = LPUART_XTL_BAUD_4800;
+    }
+    else
+    {
+        return ErrorInvalidParameter;
+    }
+
+    for (i = 1u; i <= LPUART_XTL_MODU_BITS; i++)
+    {
+        u32Ideal = ((2u * i * LPUART_XTL_FREQ) + u32Baud) / (2u * u32Baud);
+        if ((u32Ideal - u32Edge) > u32Base)
         {
-            enRet = Error;
+            u32Modu |= 1uL << (i - 1u);
         }
+        u32Edge = u32Ideal;
+
+        /* |Edge - i*T| / T = |Edge*Baud - i*32768| / 32768 */
+        u32Err = ((u32Edge * u32Baud) > (i * LPUART_XTL_FREQ)) ? ((u32Edge * u32Baud) - (i * LPUART_XTL_FREQ))
+                                                                : ((i * LPUART_XTL_FREQ) - (u32Edge * u32Baud));
+        u32MaxErr = (u32Err > u32MaxErr) ? u32Err : u32MaxErr;
     }
-    else
+
+    pstcCfg->u32Modu       = u32Modu;
+    pstcCfg->u16EdgeErrPml = (uint16_t)DDL_UDivRound(u32MaxErr * 1000u, LPUART_XTL_FREQ);
+    /* 12位平均：实际波特率 = 12*32768/Edge */
+    pstcCfg->i32ErrPpm
+        = (int32_t)(((((int64_t)LPUART_XTL_MODU_BITS * LPUART_XTL_FREQ) - ((int64_t)u32Edge * u32Baud)) * 1000000) / ((int64_t)u32Edge * u32Baud));
+
+    return Ok;
+}
+
+/**
+ * @brief  LPUART XTL调制波特率配置：设置BSEL及MODU
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcCfg 调制配置，由LPUART_XtlBaudCalc()得到 @ref stc_lpuart_xtl_baud_t
+ * @retval en_result_t
+ *           - Ok: 配置成功
+ *           - Error: 传输时钟不是XTL
+ */
+en_result_t LPUART_XtlBaudSet(LPUART_TypeDef *LPUARTx, const stc_lpuart_xtl_baud_t *pstcCfg)
+{
+    if (LPUART_SCLK_SEL_XTL != READ_REG32_BIT(LPUARTx->SCON, LPUART_SCON_SCLKSEL_Msk))
     {
-        enRet = Error;
+        return Error;
     }
 
-    return enRet;
+    WRITE_REG32(LPUARTx->BSEL, pstcCfg->u32Bsel);
+    WRITE_REG32(LPUARTx->MODU, pstcCfg->u32Modu);
+
+    return Ok;
 }
 
 /**
  * @brief  LPUART多机模式配置
+ * @note   地址及掩码为写入（可重复配置）；地址帧与(SADDR & SADEN)或广播地址(SADDR | SADEN)匹配时接收，
+ *         比较时忽略SADEN为0的位
  * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
  * @param  [in] u8Addr    从机设备地址
  * @param  [in] u8AddrMsk 从机设备地址掩码
@@ -139,8 +335,8 @@ en_result_t LPUART_XtlBselSet(LPUART_TypeDef *LPUARTx, uint32_t u32BselConfig)
 void LPUART_MultiModeConfig(LPUART_TypeDef *LPUARTx, uint8_t u8Addr, uint8_t u8AddrMsk)
 {
     SET_REG_BIT(LPUARTx->SCON, LPUART_SCON_ADRDET);
-    SET_REG_BIT(LPUARTx->SADDR, u8Addr);
-    SET_REG_BIT(LPUARTx->SADEN, u8AddrMsk);
+    WRITE_REG32(LPUARTx->SADDR, u8Addr);
+    WRITE_REG32(LPUARTx->SADEN, u8AddrMsk);
 }
 
 /**
@@ -267,7 +463,7 @@ en_result_t LPUART_TransmitPoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint3
         {
             ;
         }
-        WRITE_REG(LPUARTx->SBUF_f.DATA, *pu8Data);
+        MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, *pu8Data);
 
         pu8Data++;
         u32Size--;
@@ -286,38 +482,35 @@ en_result_t LPUART_TransmitPoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint3
  * @brief  LPUART发送数据函数,查询方式调用此函数，中断方式发送不适用
  * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
  * @param  [in] u8Data 发送数据
- * @param  [in] u32TimeOut 最长发送时间
+ * @param  [in] u32TimeOut 最长发送时间（查询次数，为整个调用的总次数上限）
  * @retval en_result_t
- *           - Ok: 配置成功
- *           - ErrorTimeout: 超时
+ *           - Ok: 配置成功
+ *           - ErrorTimeout: 超时
  */
 en_result_t LPUART_TransmitPollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut)
 {
-    while (u32Size)
-    {
-        while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TXE))
-        {
-            if (0x0u == u32TimeOut--)
-            {
-                return ErrorTimeout;
-            }
-        }
-        WRITE_REG(LPUARTx->SBUF_f.DATA, *pu8Data);
+    stc_ddl_deadline_t stcDeadline;
 
-        pu8Data++;
-        u32Size--;
-    }
+    DDL_DeadlineCountInit(&stcDeadline, u32TimeOut);
+    return LPUART_TransmitPollDeadline(LPUARTx, pu8Data, u32Size, &stcDeadline);
+}
 
-    while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TC))
-    {
-        if (0x0u == u32TimeOut--)
-        {
-            return ErrorTimeout;
-        }
-    }
-    CLR_REG_BIT(LPUARTx->ICR, LPUART_FLAG_TC);
+/**
+ * @brief  LPUART发送数据函数（微秒超时）,查询方式调用此函数，中断方式发送不适用
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pu8Data 发送数据
+ * @param  [in] u32Size 发送数据长度
+ * @param  [in] u32TimeOutUs 超时时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok: 发送完成
+ *           - ErrorTimeout: 超时
+ */
+en_result_t LPUART_TransmitPollTimeOutUs(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-    return Ok;
+    DDL_DeadlineInit(&stcDeadline, u32TimeOutUs);
+    return LPUART_TransmitPollDeadline(LPUARTx, pu8Data, u32Size, &stcDeadline);
 }
 
 /**
@@ -334,7 +527,7 @@ en_result_t LPUART_TransmitInt(LPUART_TypeDef *LPUARTx, uint8_t u8Data)
     {
         ;
     }
-    WRITE_REG(LPUARTx->SBUF_f.DATA, u8Data);
+    MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, u8Data);
     return Ok;
 }
 /**
@@ -364,30 +557,37 @@ en_result_t LPUART_ReceivePoll(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32
 /**
  * @brief  LPUART查询接收数据函数
  * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [out] pu8Data 接收数据缓存
+ * @param  [in] u32Size 接收数据长度
+ * @param  [in] u32TimeOut 最长接收时间（查询次数，为整个调用的总次数上限）
  * @retval en_result_t
- *           - Ok: 接收完成
- *           - ErrorTimeout: 超时
+ *           - Ok: 接收完成
+ *           - ErrorTimeout: 超时
  */
 en_result_t LPUART_ReceivePollTimeOut(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOut)
 {
-    while (u32Size)
-    {
-        while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_RC))
-        {
-            if (0x0u == u32TimeOut--)
-            {
-                return ErrorTimeout;
-            }
-        }
+    stc_ddl_deadline_t stcDeadline;
 
-        *pu8Data = READ_REG(LPUARTx->SBUF);
-        CLR_REG_BIT(LPUARTx->ICR, LPUART_ISR_RC);
+    DDL_DeadlineCountInit(&stcDeadline, u32TimeOut);
+    return LPUART_ReceivePollDeadline(LPUARTx, pu8Data, u32Size, &stcDeadline);
+}
 
-        pu8Data++;
-        u32Size--;
-    }
+/**
+ * @brief  LPUART查询接收数据函数（微秒超时）
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [out] pu8Data 接收数据缓存
+ * @param  [in] u32Size 接收数据长度
+ * @param  [in] u32TimeOutUs 超时时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok: 接收完成
+ *           - ErrorTimeout: 超时
+ */
+en_result_t LPUART_ReceivePollTimeOutUs(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, uint32_t u32TimeOutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-    return Ok;
+    DDL_DeadlineInit(&stcDeadline, u32TimeOutUs);
+    return LPUART_ReceivePollDeadline(LPUARTx, pu8Data, u32Size, &stcDeadline);
 }
 
 /**
@@ -449,6 +649,1743 @@ void LPUART_StcInit(stc_lpuart_init_t *pstcInit)
     pstcInit->stcBaudRate.u32Baud       = 0;
 }
 
+/**
+ * @brief  LPUART中断环形缓冲收发初始化
+ * @note   调用前完成LPUART_Init()（接收须使能REN）；经INT_CallbackRegister()注册中断回调并使能中断，
+ *         接收缓冲由接收中断写入，发送缓冲有数据时使能TX空中断。缓冲长度为2的幂（最大32768），
+ *         为0表示不使用该方向
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t
+ * @param  [in] pu8TxBuf 发送缓冲
+ * @param  [in] u16TxSize 发送缓冲长度
+ * @param  [in] pu8RxBuf 接收缓冲
+ * @param  [in] u16RxSize 接收缓冲长度
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorInvalidMode: 控制块已在使用
+ */
+en_result_t LPUART_RingInit(LPUART_TypeDef *LPUARTx, stc_lpuart_ring_t *pstcRing, uint8_t *pu8TxBuf, uint16_t u16TxSize, uint8_t *pu8RxBuf,
+                            uint16_t u16RxSize, en_irq_priority_level_t enLevel)
+{
+    IRQn_Type   enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if ((NULL == pstcRing) || ((0u == u16TxSize) && (0u == u16RxSize)) || ((0u != u16TxSize) && (NULL == pu8TxBuf))
+        || ((0u != u16RxSize) && (NULL == pu8RxBuf)) || (!IS_VALID_RING_SIZE(u16TxSize)) || (!IS_VALID_RING_SIZE(u16RxSize)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复初始化失败时不影响正在运行的实例 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcRing->stcIntCb.pfnCallback = LPUART_RingIrqCallback;
+    pstcRing->stcIntCb.pvArg       = pstcRing;
+    pstcRing->stcIntCb.u32SrcMask  = LPUART_FLAG_TXE | LPUART_FLAG_RC;
+    enRet                          = INT_CallbackRegister(enIrq, &pstcRing->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcRing->LPUARTx       = LPUARTx;
+        pstcRing->pu8TxBuf      = pu8TxBuf;
+        pstcRing->pu8RxBuf      = pu8RxBuf;
+        pstcRing->u16TxMask     = u16TxSize - 1u;
+        pstcRing->u16RxMask     = u16RxSize - 1u;
+        pstcRing->u16TxHead     = 0u;
+        pstcRing->u16TxTail     = 0u;
+        pstcRing->u16RxHead     = 0u;
+        pstcRing->u16RxTail     = 0u;
+        pstcRing->u32RxOverflow = 0u;
+        pstcRing->u32RxError    = 0u;
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_TXE | LPUART_INT_RC);
+        if (0u != u16RxSize)
+        {
+            LPUART_IntFlagClear(LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+            LPUART_IntEnable(LPUARTx, LPUART_INT_RC);
+        }
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART中断环形缓冲收发停止：禁止收发中断并注销中断回调，发送缓冲中未发送的数据丢弃
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t，为NULL或未初始化时不操作
+ * @retval None
+ */
+void LPUART_RingDeInit(stc_lpuart_ring_t *pstcRing)
+{
+    if ((NULL == pstcRing) || (NULL == pstcRing->LPUARTx))
+    {
+        return;
+    }
+
+    LPUART_IntDisable(pstcRing->LPUARTx, LPUART_INT_TXE | LPUART_INT_RC);
+    (void)INT_CallbackUnregister((LPUART0 == pstcRing->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcRing->stcIntCb);
+    pstcRing->u16TxTail = pstcRing->u16TxHead;
+}
+
+/**
+ * @brief  写入发送缓冲，不等待：写入缓冲剩余空间可容纳的部分，由TX空中断发送
+ * @note   只能在一个执行上下文（线程或同一中断）中调用
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t
+ * @param  [in] pu8Data 数据
+ * @param  [in] u32Size 数据长度
+ * @retval uint32_t 写入的字节数
+ */
+uint32_t LPUART_RingWrite(stc_lpuart_ring_t *pstcRing, const uint8_t *pu8Data, uint32_t u32Size)
+{
+    uint16_t u16Head = pstcRing->u16TxHead;
+    uint32_t u32Free;
+    uint32_t i;
+
+    if (NULL == pstcRing->pu8TxBuf)
+    {
+        return 0u;
+    }
+
+    u32Free = (uint32_t)pstcRing->u16TxMask + 1u - (uint16_t)(u16Head - pstcRing->u16TxTail);
+    u32Size = (u32Size < u32Free) ? u32Size : u32Free;
+    for (i = 0u; i < u32Size; i++)
+    {
+        pstcRing->pu8TxBuf[(uint16_t)(u16Head + i) & pstcRing->u16TxMask] = pu8Data[i];
+    }
+
+    if (0u != u32Size)
+    {
+        /* 先发布数据再使能中断：中断中发送缓冲为空时才禁止TX空中断 */
+        pstcRing->u16TxHead = (uint16_t)(u16Head + u32Size);
+        LPUART_IntEnable(pstcRing->LPUARTx, LPUART_INT_TXE);
+    }
+
+    return u32Size;
+}
+
+/**
+ * @brief  读出接收缓冲，不等待
+ * @note   只能在一个执行上下文（线程或同一中断）中调用
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t
+ * @param  [out] pu8Data 数据
+ * @param  [in] u32Size 最大长度
+ * @retval uint32_t 读出的字节数
+ */
+uint32_t LPUART_RingRead(stc_lpuart_ring_t *pstcRing, uint8_t *pu8Data, uint32_t u32Size)
+{
+    uint16_t u16Tail = pstcRing->u16RxTail;
+    uint32_t u32Count;
+    uint32_t i;
+
+    if (NULL == pstcRing->pu8RxBuf)
+    {
+        return 0u;
+    }
+
+    u32Count = (uint16_t)(pstcRing->u16RxHead - u16Tail);
+    u32Size  = (u32Size < u32Count) ? u32Size : u32Count;
+    for (i = 0u; i < u32Size; i++)
+    {
+        pu8Data[i] = pstcRing->pu8RxBuf[(uint16_t)(u16Tail + i) & pstcRing->u16RxMask];
+    }
+    pstcRing->u16RxTail = (uint16_t)(u16Tail + u32Size);
+
+    return u32Size;
+}
+
+/**
+ * @brief  发送缓冲中待发送的字节数（不含已写入SBUF的数据）
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t
+ * @retval uint32_t 字节数
+ */
+uint32_t LPUART_RingTxCountGet(const stc_lpuart_ring_t *pstcRing)
+{
+    return (uint16_t)(pstcRing->u16TxHead - pstcRing->u16TxTail);
+}
+
+/**
+ * @brief  接收缓冲中可读的字节数
+ * @param  [in] pstcRing 控制块 @ref stc_lpuart_ring_t
+ * @retval uint32_t 字节数
+ */
+uint32_t LPUART_RingRxCountGet(const stc_lpuart_ring_t *pstcRing)
+{
+    return (uint16_t)(pstcRing->u16RxHead - pstcRing->u16RxTail);
+}
+
+/**
+ * @brief  LPUART帧间隔接收配置结构体初始化
+ * @param  [in] pstcInit 配置结构体 @ref stc_lpuart_frame_init_t
+ * @retval None
+ */
+void LPUART_FrameStcInit(stc_lpuart_frame_init_t *pstcInit)
+{
+    pstcInit->BTIMx        = BTIM0;
+    pstcInit->u32Pclk      = SYSCTRL_HclkFreqGet();
+    pstcInit->u32Baud      = 0u;
+    pstcInit->u32EndGapUs  = 0u;
+    pstcInit->u32CharGapUs = 0u;
+    pstcInit->pu8Buf       = NULL;
+    pstcInit->u16BufSize   = 0u;
+    pstcInit->pfnFrame     = NULL;
+    pstcInit->pvArg        = NULL;
+}
+
+/**
+ * @brief  LPUART帧间隔接收初始化：每收到一字节重启BTIM单次计数，静默u32EndGapUs后经帧回调交出整帧
+ * @note   调用前完成LPUART_Init()（须使能REN），并使能BTIM外设时钟、将CTIMER0/1配置为BTIM
+ *         （SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMERx_USE_BTIM)）。LPUART与BTIM中断回调以同一优先级注册，
+ *         二者不可互相抢占（该CTIM向量上勿以更高优先级注册其他回调）。
+ *         帧内字符间隔按接收完成时刻计，超过1个字符（11位）加u32CharGapUs时帧状态标记LPUART_FRAME_STS_CHAR_GAP
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcFrame 控制块 @ref stc_lpuart_frame_t
+ * @param  [in] pstcInit 配置 @ref stc_lpuart_frame_init_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误或间隔超出BTIM计数范围
+ *           - ErrorInvalidMode: 控制块已在使用
+ */
+en_result_t LPUART_FrameInit(LPUART_TypeDef *LPUARTx, stc_lpuart_frame_t *pstcFrame, const stc_lpuart_frame_init_t *pstcInit,
+                             en_irq_priority_level_t enLevel)
+{
+    IRQn_Type       enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    IRQn_Type       enGapIrq;
+    uint32_t        u32GapFlag;
+    uint32_t        u32EndUs;
+    uint32_t        u32EndTicks  = 0u;
+    uint32_t        u32CharTicks = 0xFFFFu;
+    uint32_t        u32Prs;
+    uint32_t        u32Primask;
+    stc_btim_init_t stcBtimInit;
+    en_result_t     enRet;
+
+    if ((NULL == pstcFrame) || (NULL == pstcInit) || (NULL == pstcInit->pfnFrame) || (NULL == pstcInit->pu8Buf)
+        || (pstcInit->u16BufSize < 2u) || (0u == pstcInit->u32Baud) || (0u == pstcInit->u32Pclk)
+        || (Ok != LPUART_FrameGapIrqGet(pstcInit->BTIMx, &enGapIrq, &u32GapFlag)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 取帧结束间隔不超出16位计数的最小预分频 */
+    u32EndUs = (0u == pstcInit->u32EndGapUs) ? LPUART_FRAME_GAP_US(pstcInit->u32Baud, LPUART_FRAME_T35) : pstcInit->u32EndGapUs;
+    for (u32Prs = 0u; u32Prs <= (BTIM_CR_PRS_Msk >> BTIM_CR_PRS_Pos); u32Prs++)
+    {
+        u32EndTicks = LPUART_FrameTicks(pstcInit->u32Pclk, u32EndUs, u32Prs);
+        if (u32EndTicks <= LPUART_FRAME_TICKS_MAX)
+        {
+            break;
+        }
+    }
+    if (u32EndTicks > LPUART_FRAME_TICKS_MAX)
+    {
+        return ErrorInvalidParameter;
+    }
+
+    if (0u != pstcInit->u32CharGapUs)
+    {
+        u32CharTicks = LPUART_FrameTicks(pstcInit->u32Pclk,
+                                         pstcInit->u32CharGapUs + DDL_UDivRound(LPUART_FRAME_CHAR_BITS * 1000000u, pstcInit->u32Baud), u32Prs);
+        if (u32CharTicks >= u32EndTicks)
+        {
+            return ErrorInvalidParameter;
+        }
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复初始化失败时不影响正在运行的实例 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcFrame->stcRxCb.pfnCallback  = LPUART_FrameRxIrqCallback;
+    pstcFrame->stcRxCb.pvArg        = pstcFrame;
+    pstcFrame->stcRxCb.u32SrcMask   = LPUART_FLAG_RC;
+    pstcFrame->stcGapCb.pfnCallback = LPUART_FrameGapIrqCallback;
+    pstcFrame->stcGapCb.pvArg       = pstcFrame;
+    pstcFrame->stcGapCb.u32SrcMask  = u32GapFlag;
+    enRet                           = INT_CallbackRegister(enIrq, &pstcFrame->stcRxCb, enLevel);
+    if (Ok == enRet)
+    {
+        enRet = INT_CallbackRegister(enGapIrq, &pstcFrame->stcGapCb, enLevel);
+        if (Ok != enRet)
+        {
+            (void)INT_CallbackUnregister(enIrq, &pstcFrame->stcRxCb);
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcFrame->LPUARTx      = LPUARTx;
+        pstcFrame->BTIMx        = pstcInit->BTIMx;
+        pstcFrame->u16Size      = pstcInit->u16BufSize >> 1;
+        pstcFrame->apu8Buf[0]   = pstcInit->pu8Buf;
+        pstcFrame->apu8Buf[1]   = &pstcInit->pu8Buf[pstcFrame->u16Size];
+        pstcFrame->u16CharTicks = (uint16_t)u32CharTicks;
+        pstcFrame->u16Len       = 0u;
+        pstcFrame->u8Active     = 0u;
+        pstcFrame->au8Held[0]   = 0u;
+        pstcFrame->au8Held[1]   = 0u;
+        pstcFrame->u32Status    = LPUART_FRAME_STS_OK;
+        pstcFrame->u32FrameCnt  = 0u;
+        pstcFrame->u32FrameDrop = 0u;
+        pstcFrame->pfnFrame     = pstcInit->pfnFrame;
+        pstcFrame->pvArg        = pstcInit->pvArg;
+
+        /* 单次计数：计满ARR+1个计数（帧结束间隔）后溢出并停止 */
+        BTIM_Disable(pstcInit->BTIMx);
+        BTIM_StcInit(&stcBtimInit);
+        stcBtimInit.u32Prescaler       = u32Prs << BTIM_CR_PRS_Pos;
+        stcBtimInit.u32AutoReloadValue = u32EndTicks - 1u;
+        (void)BTIM_Init(pstcInit->BTIMx, &stcBtimInit);
+        BTIM_OneShotSet(pstcInit->BTIMx, BTIM_ONESHOT_COUNTER);
+        BTIM_CounterSet(pstcInit->BTIMx, 0u);
+        BTIM_IntFlagClear(pstcInit->BTIMx, BTIM_FLAG_UI);
+        BTIM_IntEnable(pstcInit->BTIMx, BTIM_INT_UI);
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_RC);
+        LPUART_IntFlagClear(LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+        LPUART_IntEnable(LPUARTx, LPUART_INT_RC);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART帧间隔接收停止：禁止接收中断及BTIM，注销中断回调，正在接收的帧丢弃
+ * @param  [in] pstcFrame 控制块 @ref stc_lpuart_frame_t
+ * @retval None
+ */
+void LPUART_FrameDeInit(stc_lpuart_frame_t *pstcFrame)
+{
+    IRQn_Type enGapIrq;
+    uint32_t  u32GapFlag;
+
+    LPUART_IntDisable(pstcFrame->LPUARTx, LPUART_INT_RC);
+    BTIM_Disable(pstcFrame->BTIMx);
+    BTIM_IntDisable(pstcFrame->BTIMx, BTIM_INT_UI);
+    BTIM_IntFlagClear(pstcFrame->BTIMx, BTIM_FLAG_UI);
+    (void)INT_CallbackUnregister((LPUART0 == pstcFrame->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcFrame->stcRxCb);
+    if (Ok == LPUART_FrameGapIrqGet(pstcFrame->BTIMx, &enGapIrq, &u32GapFlag))
+    {
+        (void)INT_CallbackUnregister(enGapIrq, &pstcFrame->stcGapCb);
+    }
+    pstcFrame->u16Len = 0u;
+}
+
+/**
+ * @brief  归还帧回调交出的帧缓冲，之后该缓冲可继续接收
+ * @param  [in] pstcFrame 控制块 @ref stc_lpuart_frame_t
+ * @param  [in] pu8Data 帧回调的pu8Data
+ * @retval None
+ */
+void LPUART_FrameRelease(stc_lpuart_frame_t *pstcFrame, const uint8_t *pu8Data)
+{
+    if (pu8Data == pstcFrame->apu8Buf[0])
+    {
+        pstcFrame->au8Held[0] = 0u;
+    }
+    else if (pu8Data == pstcFrame->apu8Buf[1])
+    {
+        pstcFrame->au8Held[1] = 0u;
+    }
+    else
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  LPUART多机节点配置结构体初始化
+ * @param  [in] pstcInit 配置结构体 @ref stc_lpuart_node_init_t
+ * @retval None
+ */
+void LPUART_NodeStcInit(stc_lpuart_node_init_t *pstcInit)
+{
+    pstcInit->u8Addr     = 0u;
+    pstcInit->u8AddrMsk  = 0xFFu;
+    pstcInit->u32Filter  = LPUART_NODE_FILTER_HW;
+    pstcInit->pu8Buf     = NULL;
+    pstcInit->u16BufSize = 0u;
+    pstcInit->pfnFrame   = NULL;
+    pstcInit->pvArg      = NULL;
+}
+
+/**
+ * @brief  LPUART多机节点初始化：按地址过滤接收总线帧，收完本节点或广播帧后经帧回调交出
+ * @note   调用前以LPUART_FRAME_LEN_8B_PAR、LPUART_B8_MULTI_DataOrAddr及接收使能完成LPUART_Init()。
+ *         帧长度超出接收缓冲时超出部分丢弃并标记LPUART_FRAME_STS_OVERFLOW，
+ *         帧错误标记LPUART_FRAME_STS_RX_ERR
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @param  [in] pstcInit 配置 @ref stc_lpuart_node_init_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorInvalidMode: LPUART不是多机模式，或控制块已在使用
+ */
+en_result_t LPUART_NodeInit(LPUART_TypeDef *LPUARTx, stc_lpuart_node_t *pstcNode, const stc_lpuart_node_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel)
+{
+    IRQn_Type   enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if ((NULL == pstcNode) || (NULL == pstcInit) || (NULL == pstcInit->pfnFrame) || (NULL == pstcInit->pu8Buf)
+        || (0u == pstcInit->u16BufSize) || (!IS_VALID_NODE_FILTER(pstcInit->u32Filter)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    if ((LPUART_FRAME_LEN_8B_PAR != READ_REG32_BIT(LPUARTx->SCON, LPUART_SCON_SM))
+        || (LPUART_B8_MULTI_DataOrAddr != READ_REG32_BIT(LPUARTx->SCON, LPUART_SCON_B8CONT))
+        || (0u == READ_REG32_BIT(LPUARTx->SCON, LPUART_SCON_REN)))
+    {
+        return ErrorInvalidMode;
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复初始化失败时不影响正在运行的实例 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcNode->stcIntCb.pfnCallback = LPUART_NodeIrqCallback;
+    pstcNode->stcIntCb.pvArg       = pstcNode;
+    pstcNode->stcIntCb.u32SrcMask  = LPUART_FLAG_RC;
+    enRet                          = INT_CallbackRegister(enIrq, &pstcNode->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcNode->LPUARTx       = LPUARTx;
+        pstcNode->pu8Buf        = pstcInit->pu8Buf;
+        pstcNode->u16Size       = pstcInit->u16BufSize;
+        pstcNode->u8Filter      = (uint8_t)pstcInit->u32Filter;
+        pstcNode->u16Len        = 0u;
+        pstcNode->u32Status     = LPUART_FRAME_STS_OK;
+        pstcNode->u32IrqCnt     = 0u;
+        pstcNode->u32FrameCnt   = 0u;
+        pstcNode->u32FrameAbort = 0u;
+        pstcNode->pfnFrame      = pstcInit->pfnFrame;
+        pstcNode->pvArg         = pstcInit->pvArg;
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_RC);
+        LPUART_NodeAddrSet(pstcNode, pstcInit->u8Addr, pstcInit->u8AddrMsk);
+        LPUART_NodeIdle(pstcNode);
+        LPUART_IntFlagClear(LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+        LPUART_IntEnable(LPUARTx, LPUART_INT_RC);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART多机节点停止：禁止接收中断并注销中断回调，正在接收的帧丢弃
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @retval None
+ */
+void LPUART_NodeDeInit(stc_lpuart_node_t *pstcNode)
+{
+    LPUART_IntDisable(pstcNode->LPUARTx, LPUART_INT_RC);
+    (void)INT_CallbackUnregister((LPUART0 == pstcNode->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcNode->stcIntCb);
+    pstcNode->u8State = LPUART_NODE_ST_IDLE;
+}
+
+/**
+ * @brief  修改多机节点地址，可在运行中调用
+ * @note   正在接收的帧按原地址收完，之后的地址帧按新地址过滤
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @param  [in] u8Addr 本节点地址
+ * @param  [in] u8AddrMsk 地址掩码
+ * @retval None
+ */
+void LPUART_NodeAddrSet(stc_lpuart_node_t *pstcNode, uint8_t u8Addr, uint8_t u8AddrMsk)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    /* 软件比较与硬件识别使用同一地址 */
+    __disable_irq();
+    pstcNode->u8Addr    = u8Addr;
+    pstcNode->u8AddrMsk = u8AddrMsk;
+    WRITE_REG32(pstcNode->LPUARTx->SADDR, u8Addr);
+    WRITE_REG32(pstcNode->LPUARTx->SADEN, u8AddrMsk);
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  多机帧查询发送：地址（第9位为1）、长度、数据（第9位为0），等待发送完成后返回
+ * @note   RS-485收发器方向由调用者控制：返回Ok时最后一字节的停止位已发出
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] u8Addr 目的地址
+ * @param  [in] pu8Data 数据
+ * @param  [in] u8Len 数据长度
+ * @param  [in] u32TimeOutUs 超时时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok: 发送完成
+ *           - ErrorInvalidParameter: 数据为空
+ *           - ErrorTimeout: 超时，帧未发完
+ */
+en_result_t LPUART_NodeSend(LPUART_TypeDef *LPUARTx, uint8_t u8Addr, const uint8_t *pu8Data, uint8_t u8Len, uint32_t u32TimeOutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+    uint32_t           i;
+
+    if ((NULL == pu8Data) && (0u != u8Len))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeOutUs);
+
+    /* 第9位随SBUF写入：地址帧写DATA8=1，长度及数据写DATA8=0 */
+    if (Ok != LPUART_NodeByteSend(LPUARTx, LPUART_SBUF_DATA8_Msk | u8Addr, &stcDeadline))
+    {
+        return ErrorTimeout;
+    }
+    if (Ok != LPUART_NodeByteSend(LPUARTx, u8Len, &stcDeadline))
+    {
+        return ErrorTimeout;
+    }
+    for (i = 0u; i < u8Len; i++)
+    {
+        if (Ok != LPUART_NodeByteSend(LPUARTx, pu8Data[i], &stcDeadline))
+        {
+            return ErrorTimeout;
+        }
+    }
+
+    while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TC))
+    {
+        if (DDL_DeadlineExpired(&stcDeadline))
+        {
+            return ErrorTimeout;
+        }
+    }
+    CLR_REG_BIT(LPUARTx->ICR, LPUART_FLAG_TC);
+
+    return Ok;
+}
+
+/**
+ * @brief  LPUART自动波特率检测配置结构体初始化
+ * @param  [in] pstcInit 配置结构体 @ref stc_lpuart_autobaud_init_t
+ * @retval None
+ */
+void LPUART_AutoBaudStcInit(stc_lpuart_autobaud_init_t *pstcInit)
+{
+    pstcInit->u32Pclk      = SYSCTRL_HclkFreqGet();
+    pstcInit->u8SyncByte   = LPUART_AUTOBAUD_SYNC_DEFAULT;
+    pstcInit->u32BaudMin   = 1200u;
+    pstcInit->u32BaudMax   = 115200u;
+    pstcInit->pu32BaudList = NULL;
+    pstcInit->u16BaudNum   = 0u;
+    pstcInit->u32TolPpm    = LPUART_AUTOBAUD_TOL_DEFAULT;
+    pstcInit->pfnDone      = NULL;
+    pstcInit->pvArg        = NULL;
+}
+
+/**
+ * @brief  开始LPUART自动波特率检测：RXD经GPIOAUX TIMCPS接到ATIM3 CH0A，以模式1 PWC单次测量同步字节
+ *         起始位下降沿到其后上升沿的低电平宽度；在该上升沿的ATIM3中断中计算并设置OVER/SCNT、
+ *         恢复RXD路由并使能接收，同步字节之后的第一帧即按新波特率接收
+ * @note   调用前以LPUART_SCLK_SEL_PCLK完成LPUART_Init()（帧格式按主机设置），RX端口保持LPUART_RXD复用，
+ *         并使能ATIM3外设时钟；检测期间ATIM3由本函数独占，LPUART接收禁止。
+ *         同步字节低电平脉冲之后的高电平（其余位及停止位）须长于ATIM3中断响应时间。
+ *         宽度超出范围或与标准波特率表不匹配的脉冲（干扰、其他字节）被丢弃并重新等待
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcAb 控制块 @ref stc_lpuart_autobaud_t
+ * @param  [in] pstcInit 配置 @ref stc_lpuart_autobaud_init_t
+ * @param  [in] enLevel ATIM3中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 检测已开始
+ *           - ErrorInvalidParameter: 参数错误、同步字节形式不符或波特率范围超出ATIM3计数范围
+ *           - ErrorInvalidMode: 控制块已在使用
+ */
+en_result_t LPUART_AutoBaudStart(LPUART_TypeDef *LPUARTx, stc_lpuart_autobaud_t *pstcAb, const stc_lpuart_autobaud_init_t *pstcInit,
+                                 en_irq_priority_level_t enLevel)
+{
+    static const uint8_t       au8PrsShift[] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 8u}; /* ATIM3_M1_M1CR_ATIM3CLK_PRS1~PRS256 */
+    stc_atim3_mode1_init_t     stcAtimInit;
+    stc_atim3_pwc_input_init_t stcInputInit;
+    uint32_t                   u32Bits;
+    uint32_t                   u32BaudLo;
+    uint32_t                   u32Ticks;
+    uint32_t                   u32Prs;
+    uint32_t                   u32Primask;
+    en_result_t                enRet;
+
+    if ((NULL == pstcAb) || (NULL == pstcInit) || (0u == pstcInit->u32Pclk) || (pstcInit->u32Pclk > LPUART_AUTOBAUD_PCLK_MAX)
+        || (!IS_VALID_AUTOBAUD_SYNC(pstcInit->u8SyncByte)) || (0u == pstcInit->u32BaudMin)
+        || (pstcInit->u32BaudMin > pstcInit->u32BaudMax) || (pstcInit->u32TolPpm > LPUART_AUTOBAUD_TOL_MAX)
+        || ((NULL == pstcInit->pu32BaudList) != (0u == pstcInit->u16BaudNum)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 低电平脉冲位数：起始位加同步字节低位连续的0 */
+    for (u32Bits = 1u; (u32Bits < 9u) && (0u == (pstcInit->u8SyncByte & (1u << (u32Bits - 1u)))); u32Bits++)
+    {
+        ;
+    }
+
+    /* 最低波特率（含偏差）的脉宽不超出16位计数的最小预分频 */
+    u32BaudLo = pstcInit->u32BaudMin - (uint32_t)(((uint64_t)pstcInit->u32BaudMin * pstcInit->u32TolPpm) / 1000000u);
+    u32BaudLo = (0u == u32BaudLo) ? 1u : u32BaudLo;
+    u32Ticks  = ((pstcInit->u32Pclk * u32Bits) + u32BaudLo - 1u) / u32BaudLo;
+    for (u32Prs = 0u; u32Prs < sizeof(au8PrsShift); u32Prs++)
+    {
+        if ((u32Ticks >> au8PrsShift[u32Prs]) <= 0xFFFFu)
+        {
+            break;
+        }
+    }
+    if (u32Prs >= sizeof(au8PrsShift))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复开始失败时不影响正在运行的检测 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcAb->stcIntCb.pfnCallback = LPUART_AutoBaudIrqCallback;
+    pstcAb->stcIntCb.pvArg       = pstcAb;
+    pstcAb->stcIntCb.u32SrcMask  = ATIM3_FLAG_PWC_CA0;
+    enRet                        = INT_CallbackRegister(ATIM3_IRQn, &pstcAb->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcAb->LPUARTx      = LPUARTx;
+        pstcAb->u32Pclk      = pstcInit->u32Pclk;
+        pstcAb->u32BaudLo    = u32BaudLo;
+        pstcAb->u32BaudHi    = pstcInit->u32BaudMax + (uint32_t)(((uint64_t)pstcInit->u32BaudMax * pstcInit->u32TolPpm) / 1000000u);
+        pstcAb->pu32BaudList = pstcInit->pu32BaudList;
+        pstcAb->u16BaudNum   = pstcInit->u16BaudNum;
+        pstcAb->u8Bits       = (uint8_t)u32Bits;
+        pstcAb->u8PrsShift   = au8PrsShift[u32Prs];
+        pstcAb->u32TolPpm    = pstcInit->u32TolPpm;
+        pstcAb->u32Ticks     = 0u;
+        pstcAb->u32Reject    = 0u;
+        pstcAb->u32Baud      = 0u;
+        pstcAb->pfnDone      = pstcInit->pfnDone;
+        pstcAb->pvArg        = pstcInit->pvArg;
+
+        /* 检测期间禁止接收，避免按旧波特率收到同步字节；保存ATIM3_C0A原输入选择 */
+        LPUART_FuncDisable(LPUARTx, LPUART_FUN_REN);
+        pstcAb->u32Timcps = READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk);
+        if (LPUART0 == LPUARTx)
+        {
+            GPIO_TIMCPS_ATIM3_C0A_LPUART0_RXD();
+        }
+        else
+        {
+            GPIO_TIMCPS_ATIM3_C0A_LPUART1_RXD();
+        }
+
+        /* 模式1 PWC单次测量：下降沿到上升沿（低电平宽度），CH0A不滤波 */
+        ATIM3_Mode1_Stop();
+        ATIM3_Mode1_StcInit(&stcAtimInit);
+        stcAtimInit.u32WorkMode         = ATIM3_M1_M1CR_WORK_MODE_PWC;
+        stcAtimInit.u32PRS              = u32Prs << ATIM3_MODE1_M1CR_PRS_Pos;
+        stcAtimInit.u32CountClockSelect = ATIM3_M1_M1CR_CT_PCLK;
+        stcAtimInit.u32ShotMode         = ATIM3_M1_M1CR_SHOT_ONE;
+        ATIM3_Mode1_Init(&stcAtimInit);
+
+        ATIM3_Mode1_InputStcInit(&stcInputInit);
+        stcInputInit.u32TsSelect  = ATIM3_M1_MSCR_TS_CH0A_FILTER;
+        stcInputInit.u32IA0Select = ATIM3_M1_MSCR_IA0S_CH0A;
+        stcInputInit.u32FltIA0    = ATIM3_M1_FLTR_FLTA0_B0_ET_NONE;
+        ATIM3_Mode1_InputConfig(&stcInputInit);
+        ATIM3_Mode1_PWCEdgeSelect(ATIM3_M1_M1CR_DETECT_EDGE_FALL_TO_RISE);
+
+        ATIM3_Mode1_Cnt16Set(0u);
+        ATIM3_IntFlagClear(ATIM3_FLAG_UI | ATIM3_FLAG_PWC_CA0);
+        ATIM3_Mode1_IntEnable(ATIM3_M1_INT_CA0);
+        ATIM3_Mode1_Run();
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  停止LPUART自动波特率检测：停止ATIM3并注销中断回调，ATIM3_C0A输入选择恢复为开始前的设置，
+ *         重新使能接收（波特率不变）
+ * @note   检测完成时由中断回调调用；超时未检测到时调用者可在停止后按缺省波特率重新LPUART_Init()
+ * @param  [in] pstcAb 控制块 @ref stc_lpuart_autobaud_t
+ * @retval None
+ */
+void LPUART_AutoBaudStop(stc_lpuart_autobaud_t *pstcAb)
+{
+    ATIM3_Mode1_Stop();
+    ATIM3_Mode1_IntDisable(ATIM3_M1_INT_CA0);
+    ATIM3_IntFlagClear(ATIM3_FLAG_UI | ATIM3_FLAG_PWC_CA0);
+    (void)INT_CallbackUnregister(ATIM3_IRQn, &pstcAb->stcIntCb);
+    MODIFY_REG(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk, pstcAb->u32Timcps);
+
+    LPUART_IntFlagClear(pstcAb->LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+    LPUART_FuncEnable(pstcAb->LPUARTx, LPUART_FUN_REN);
+}
+
+/**
+ * @brief  测得的波特率取整到标准波特率表中最近的一项
+ * @note   也可用于GTIM等其他定时器捕获得到的测量值
+ * @param  [in] u32Baud 测量值
+ * @param  [in] pu32List 标准波特率表，NULL时直接返回测量值
+ * @param  [in] u32Num 表长度
+ * @param  [in] u32TolPpm 最大偏差，单位ppm
+ * @retval uint32_t 偏差不超过u32TolPpm的最近一项，没有时为0
+ */
+uint32_t LPUART_AutoBaudMatch(uint32_t u32Baud, const uint32_t *pu32List, uint32_t u32Num, uint32_t u32TolPpm)
+{
+    uint32_t u32Best     = 0u;
+    uint32_t u32BestDiff = UINT32_MAX;
+    uint32_t u32Diff;
+    uint32_t i;
+
+    if (NULL == pu32List)
+    {
+        return u32Baud;
+    }
+
+    for (i = 0u; i < u32Num; i++)
+    {
+        u32Diff = (u32Baud > pu32List[i]) ? (u32Baud - pu32List[i]) : (pu32List[i] - u32Baud);
+        if ((u32Diff < u32BestDiff) && (((uint64_t)u32Diff * 1000000u) <= ((uint64_t)pu32List[i] * u32TolPpm)))
+        {
+            u32Best     = pu32List[i];
+            u32BestDiff = u32Diff;
+        }
+    }
+
+    return u32Best;
+}
+
+/**
+ * @brief  LPUART单线半双工事务初始化：使能单线半双工及接收并注册中断回调，之后以LPUART_HdXfer()发起事务
+ * @note   调用前完成LPUART_Init()，TXD端口配置为开漏输出（外部或内部上拉）并复用为LPUART_TXD。
+ *         单线半双工模式下发送结束后硬件即释放总线，事务期间接收始终使能，无需软件切换方向
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @param  [in] pfnDone 事务完成回调，可为NULL
+ * @param  [in] pvArg 回调参数
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: pstcHd为NULL
+ *           - ErrorInvalidMode: 该LPUART中断已注册同一控制块
+ */
+en_result_t LPUART_HdInit(LPUART_TypeDef *LPUARTx, stc_lpuart_hd_t *pstcHd, func_ptr_lpuart_hd_t pfnDone, void *pvArg,
+                          en_irq_priority_level_t enLevel)
+{
+    IRQn_Type   enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if (NULL == pstcHd)
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcHd->stcIntCb.pfnCallback = LPUART_HdIrqCallback;
+    pstcHd->stcIntCb.pvArg       = pstcHd;
+    pstcHd->stcIntCb.u32SrcMask  = LPUART_FLAG_RC | LPUART_FLAG_TXE | LPUART_FLAG_TC;
+    enRet                        = INT_CallbackRegister(enIrq, &pstcHd->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcHd->LPUARTx      = LPUARTx;
+        pstcHd->u8State      = LPUART_HD_ST_IDLE;
+        pstcHd->u32Status    = LPUART_HD_STS_OK;
+        pstcHd->u32TurnTicks = 0u;
+        pstcHd->u32XferCnt   = 0u;
+        pstcHd->pfnDone      = pfnDone;
+        pstcHd->pvArg        = pvArg;
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_RC | LPUART_INT_TXE | LPUART_INT_TC);
+        LPUART_FuncEnable(LPUARTx, LPUART_FUN_HDSEL | LPUART_FUN_REN);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART单线半双工事务停止：禁止相关中断并注销中断回调，进行中的事务丢弃（不调用完成回调）
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @retval None
+ */
+void LPUART_HdDeInit(stc_lpuart_hd_t *pstcHd)
+{
+    LPUART_IntDisable(pstcHd->LPUARTx, LPUART_INT_RC | LPUART_INT_TXE | LPUART_INT_TC);
+    (void)INT_CallbackUnregister((LPUART0 == pstcHd->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcHd->stcIntCb);
+    pstcHd->u8State   = LPUART_HD_ST_IDLE;
+    pstcHd->u32Status = LPUART_HD_STS_OK;
+}
+
+/**
+ * @brief  开始单线半双工事务：由TX空中断逐字节发送u16TxLen字节，接收中断比较并丢弃回波，
+ *         最后一个停止位发送完成（TC中断）时开始计时，u32TimeoutUs内收齐u16RxLen字节应答即完成
+ * @note   函数立即返回；完成后调用完成回调，或以LPUART_HdPoll()查询。超时由LPUART_HdPoll()检测，
+ *         等待应答期间须周期调用。pu8Tx、pu8Rx在事务结束前不可修改
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @param  [in] pu8Tx 发送数据
+ * @param  [in] u16TxLen 发送长度，不可为0
+ * @param  [out] pu8Rx 应答接收缓冲，u16RxLen为0时可为NULL
+ * @param  [in] u16RxLen 应答长度，为0时发送完成即结束
+ * @param  [in] u32TimeoutUs 应答超时时间（微秒），DDL_TIMEOUT_FOREVER表示一直等待
+ * @retval en_result_t
+ *           - Ok: 事务已开始
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorNotReady: 上一个事务未结束
+ */
+en_result_t LPUART_HdXfer(stc_lpuart_hd_t *pstcHd, const uint8_t *pu8Tx, uint16_t u16TxLen, uint8_t *pu8Rx, uint16_t u16RxLen,
+                          uint32_t u32TimeoutUs)
+{
+    LPUART_TypeDef *LPUARTx;
+    uint32_t        u32Primask;
+
+    if ((NULL == pstcHd) || (NULL == pu8Tx) || (0u == u16TxLen) || ((NULL == pu8Rx) && (0u != u16RxLen)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    LPUARTx    = pstcHd->LPUARTx;
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (LPUART_HD_ST_IDLE != pstcHd->u8State)
+    {
+        if (0u == u32Primask)
+        {
+            __enable_irq();
+        }
+        return ErrorNotReady;
+    }
+
+    pstcHd->pu8Tx        = pu8Tx;
+    pstcHd->pu8Rx        = pu8Rx;
+    pstcHd->u16TxLen     = u16TxLen;
+    pstcHd->u16RxLen     = u16RxLen;
+    pstcHd->u16TxCnt     = 1u;
+    pstcHd->u16EchoCnt   = 0u;
+    pstcHd->u16RxCnt     = 0u;
+    pstcHd->u32TimeoutUs = u32TimeoutUs;
+    pstcHd->u32TurnTicks = 0u;
+    pstcHd->u32Status    = LPUART_HD_STS_BUSY;
+    pstcHd->u8State      = LPUART_HD_ST_TX;
+
+    /* 丢弃上一事务之后总线上的残留数据；TC在每次写SBUF前清除，之后置位即表示已写入的字节全部发送完成 */
+    CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE | LPUART_FLAG_TC);
+    MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, pu8Tx[0]);
+    LPUART_IntEnable(LPUARTx, LPUART_INT_RC | ((1u == u16TxLen) ? LPUART_INT_TC : LPUART_INT_TXE));
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  单线半双工事务状态查询：等待应答期间截止时间已到则以LPUART_HD_STS_TIMEOUT结束事务
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @retval uint32_t 事务状态 @ref LPUART_Hd_Status，含LPUART_HD_STS_BUSY时事务未结束
+ */
+uint32_t LPUART_HdPoll(stc_lpuart_hd_t *pstcHd)
+{
+    uint32_t u32Primask;
+
+    if ((LPUART_HD_ST_RX == pstcHd->u8State) && (TRUE == DDL_DeadlineExpired(&pstcHd->stcDeadline)))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        /* 关中断后再次确认：最后一个应答字节可能刚在中断中收到 */
+        if (LPUART_HD_ST_RX == pstcHd->u8State)
+        {
+            LPUART_HdFinish(pstcHd, LPUART_HD_STS_TIMEOUT);
+        }
+        if (0u == u32Primask)
+        {
+            __enable_irq();
+        }
+    }
+
+    return pstcHd->u32Status;
+}
+
+/**
+ * @brief  中止单线半双工事务，已写入SBUF的字节仍会发送完；事务进行中时以LPUART_HD_STS_ABORT调用完成回调
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @retval None
+ */
+void LPUART_HdAbort(stc_lpuart_hd_t *pstcHd)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (LPUART_HD_ST_IDLE != pstcHd->u8State)
+    {
+        LPUART_HdFinish(pstcHd, LPUART_HD_STS_ABORT);
+    }
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  LPUART深度休眠批量接收配置结构体初始化：只以分隔字节'\n'唤醒
+ * @param  [in] pstcInit 配置结构体 @ref stc_lpuart_lprx_init_t
+ * @retval None
+ */
+void LPUART_LpRxStcInit(stc_lpuart_lprx_init_t *pstcInit)
+{
+    pstcInit->pu8Buf       = NULL;
+    pstcInit->u16Size      = 0u;
+    pstcInit->u16Watermark = 0u;
+    pstcInit->u16Delim     = (uint16_t)'\n';
+    pstcInit->u8LenPos     = LPUART_LPRX_FRAME_NONE;
+    pstcInit->u8LenAdd     = 0u;
+    pstcInit->u32WakeMask  = LPUART_LPRX_EVT_DELIM | LPUART_LPRX_EVT_FULL;
+}
+
+/**
+ * @brief  LPUART深度休眠批量接收初始化
+ * @note   调用前完成LPUART_Init()（接收须使能REN），深度休眠时传输时钟须为XTL或RCL（LPUART_SCLK_SEL_XTL/RCL），
+ *         PCLK在深度休眠时停止；经INT_CallbackRegister()注册中断回调并使能接收中断。
+ *         唤醒条件：分隔字节、未读字节数达到水位、长度前缀帧收齐（帧长由帧内第u8LenPos字节的值加u8LenAdd得到），
+ *         另有接收缓冲满及接收错误，只有u32WakeMask中的事件唤醒主循环
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcLpRx 控制块 @ref stc_lpuart_lprx_t
+ * @param  [in] pstcInit 配置 @ref stc_lpuart_lprx_init_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorInvalidMode: 控制块已在使用
+ */
+en_result_t LPUART_LpRxInit(LPUART_TypeDef *LPUARTx, stc_lpuart_lprx_t *pstcLpRx, const stc_lpuart_lprx_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel)
+{
+    IRQn_Type   enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if ((NULL == pstcLpRx) || (NULL == pstcInit) || (NULL == pstcInit->pu8Buf) || (0u == pstcInit->u16Size)
+        || (!IS_VALID_RING_SIZE(pstcInit->u16Size)) || (pstcInit->u16Watermark > pstcInit->u16Size)
+        || ((LPUART_LPRX_DELIM_NONE != pstcInit->u16Delim) && (pstcInit->u16Delim > 0xFFu))
+        || ((LPUART_LPRX_FRAME_NONE != pstcInit->u8LenPos) && (pstcInit->u8LenAdd <= pstcInit->u8LenPos))
+        || (0u == (pstcInit->u32WakeMask & LPUART_LPRX_EVT_ALL)) || (0u != (pstcInit->u32WakeMask & ~LPUART_LPRX_EVT_ALL)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复初始化失败时不影响正在运行的实例 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcLpRx->stcIntCb.pfnCallback = LPUART_LpRxIrqCallback;
+    pstcLpRx->stcIntCb.pvArg       = pstcLpRx;
+    pstcLpRx->stcIntCb.u32SrcMask  = LPUART_FLAG_RC;
+    enRet                          = INT_CallbackRegister(enIrq, &pstcLpRx->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcLpRx->LPUARTx      = LPUARTx;
+        pstcLpRx->pu8Buf       = pstcInit->pu8Buf;
+        pstcLpRx->u16Mask      = pstcInit->u16Size - 1u;
+        pstcLpRx->u16Head      = 0u;
+        pstcLpRx->u16Tail      = 0u;
+        pstcLpRx->u16Watermark = pstcInit->u16Watermark;
+        pstcLpRx->u16Delim     = pstcInit->u16Delim;
+        pstcLpRx->u8LenPos     = pstcInit->u8LenPos;
+        pstcLpRx->u8LenAdd     = pstcInit->u8LenAdd;
+        pstcLpRx->u16FramePos  = 0u;
+        pstcLpRx->u16FrameLen  = 0u;
+        pstcLpRx->u32WakeMask  = pstcInit->u32WakeMask;
+        pstcLpRx->u32Event     = 0u;
+        pstcLpRx->u32IrqCnt    = 0u;
+        pstcLpRx->u32WakeCnt   = 0u;
+        pstcLpRx->u32SleepCnt  = 0u;
+        pstcLpRx->u32Overflow  = 0u;
+        pstcLpRx->u32Error     = 0u;
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_TXE | LPUART_INT_RC);
+        LPUART_IntFlagClear(LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+        LPUART_IntEnable(LPUARTx, LPUART_INT_RC);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART深度休眠批量接收停止：禁止接收中断并注销中断回调，接收缓冲中的数据仍可读出
+ * @param  [in] pstcLpRx 控制块 @ref stc_lpuart_lprx_t
+ * @retval None
+ */
+void LPUART_LpRxDeInit(stc_lpuart_lprx_t *pstcLpRx)
+{
+    LPUART_IntDisable(pstcLpRx->LPUARTx, LPUART_INT_RC);
+    (void)INT_CallbackUnregister((LPUART0 == pstcLpRx->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcLpRx->stcIntCb);
+}
+
+/**
+ * @brief  以SLEEPONEXIT进入深度休眠，直到唤醒事件发生：期间的接收中断执行完即返回休眠，不回到主循环
+ * @note   只能在线程（主循环）中调用；关中断检查事件后再休眠，事件在检查与休眠之间发生时WFI立即返回，
+ *         不会漏掉唤醒。其他中断若需唤醒主循环，须自行清除SCB->SCR的SLEEPONEXIT位（本函数随后会再次休眠，
+ *         直到出现唤醒事件）。唤醒前已发生的其他事件一并返回
+ * @param  [in] pstcLpRx 控制块 @ref stc_lpuart_lprx_t
+ * @retval uint32_t 发生的事件 @ref LPUART_LpRx_Event，返回后清除
+ */
+uint32_t LPUART_LpRxSleep(stc_lpuart_lprx_t *pstcLpRx)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+    uint32_t u32Event;
+
+    __disable_irq();
+    while (0u == (pstcLpRx->u32Event & pstcLpRx->u32WakeMask))
+    {
+        pstcLpRx->u32SleepCnt++;
+        LPM_GotoDeepSleep(TRUE);
+        /* 开中断执行挂起的接收中断，中断返回时SLEEPONEXIT仍置位则直接再次休眠，唤醒事件在中断中清除该位 */
+        __enable_irq();
+        __disable_irq();
+    }
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+    u32Event           = pstcLpRx->u32Event;
+    pstcLpRx->u32Event = 0u;
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return u32Event;
+}
+
+/**
+ * @brief  读出接收缓冲，不等待
+ * @note   只能在一个执行上下文（线程或同一中断）中调用
+ * @param  [in] pstcLpRx 控制块 @ref stc_lpuart_lprx_t
+ * @param  [out] pu8Data 数据
+ * @param  [in] u32Size 最大长度
+ * @retval uint32_t 读出的字节数
+ */
+uint32_t LPUART_LpRxRead(stc_lpuart_lprx_t *pstcLpRx, uint8_t *pu8Data, uint32_t u32Size)
+{
+    uint16_t u16Tail = pstcLpRx->u16Tail;
+    uint32_t u32Count;
+    uint32_t i;
+
+    u32Count = (uint16_t)(pstcLpRx->u16Head - u16Tail);
+    u32Size  = (u32Size < u32Count) ? u32Size : u32Count;
+    for (i = 0u; i < u32Size; i++)
+    {
+        pu8Data[i] = pstcLpRx->pu8Buf[(uint16_t)(u16Tail + i) & pstcLpRx->u16Mask];
+    }
+    pstcLpRx->u16Tail = (uint16_t)(u16Tail + u32Size);
+
+    return u32Size;
+}
+
+/**
+ * @brief  接收缓冲中可读的字节数
+ * @param  [in] pstcLpRx 控制块 @ref stc_lpuart_lprx_t
+ * @retval uint32_t 字节数
+ */
+uint32_t LPUART_LpRxCountGet(const stc_lpuart_lprx_t *pstcLpRx)
+{
+    return (uint16_t)(pstcLpRx->u16Head - pstcLpRx->u16Tail);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_Local_Functions LPUART局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  LPUART查询发送，超时由截止时间判断
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pu8Data 发送数据
+ * @param  [in] u32Size 发送数据长度
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval en_result_t
+ *           - Ok: 发送完成
+ *           - ErrorTimeout: 超时
+ */
+static en_result_t LPUART_TransmitPollDeadline(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline)
+{
+    while (u32Size)
+    {
+        while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TXE))
+        {
+            if (DDL_DeadlineExpired(pstcDeadline))
+            {
+                return ErrorTimeout;
+            }
+        }
+        MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, *pu8Data);
+
+        pu8Data++;
+        u32Size--;
+    }
+
+    while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TC))
+    {
+        if (DDL_DeadlineExpired(pstcDeadline))
+        {
+            return ErrorTimeout;
+        }
+    }
+    CLR_REG_BIT(LPUARTx->ICR, LPUART_FLAG_TC);
+
+    return Ok;
+}
+
+/**
+ * @brief  LPUART查询接收，超时由截止时间判断
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [out] pu8Data 接收数据缓存
+ * @param  [in] u32Size 接收数据长度
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval en_result_t
+ *           - Ok: 接收完成
+ *           - ErrorTimeout: 超时
+ */
+static en_result_t LPUART_ReceivePollDeadline(LPUART_TypeDef *LPUARTx, uint8_t *pu8Data, uint32_t u32Size, stc_ddl_deadline_t *pstcDeadline)
+{
+    while (u32Size)
+    {
+        while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_RC))
+        {
+            if (DDL_DeadlineExpired(pstcDeadline))
+            {
+                return ErrorTimeout;
+            }
+        }
+
+        *pu8Data = READ_REG(LPUARTx->SBUF);
+        CLR_REG_BIT(LPUARTx->ICR, LPUART_ISR_RC);
+
+        pu8Data++;
+        u32Size--;
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  中断环形缓冲收发中断回调：接收数据写入接收缓冲，TX空时从发送缓冲取一字节发送，
+ *         发送缓冲为空时禁止TX空中断
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_ring_t
+ * @retval None
+ */
+static void LPUART_RingIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_ring_t *pstcRing = (stc_lpuart_ring_t *)pvArg;
+    LPUART_TypeDef    *LPUARTx  = pstcRing->LPUARTx;
+    uint16_t           u16Index;
+    uint8_t            u8Data;
+
+    if (0u != (u32Flags & LPUART_FLAG_RC))
+    {
+        u8Data = (uint8_t)READ_REG32_BIT(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk);
+        if (0u != (u32Flags & (LPUART_FLAG_FE | LPUART_FLAG_PE)))
+        {
+            pstcRing->u32RxError++;
+        }
+        CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+
+        u16Index = pstcRing->u16RxHead;
+        if ((uint16_t)(u16Index - pstcRing->u16RxTail) <= pstcRing->u16RxMask)
+        {
+            pstcRing->pu8RxBuf[u16Index & pstcRing->u16RxMask] = u8Data;
+            pstcRing->u16RxHead                                 = u16Index + 1u;
+        }
+        else
+        {
+            pstcRing->u32RxOverflow++;
+        }
+    }
+
+    if ((0u != (u32Flags & LPUART_FLAG_TXE)) && (0u != READ_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE)))
+    {
+        u16Index = pstcRing->u16TxTail;
+        if (u16Index != pstcRing->u16TxHead)
+        {
+            MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, pstcRing->pu8TxBuf[u16Index & pstcRing->u16TxMask]);
+            pstcRing->u16TxTail = u16Index + 1u;
+        }
+        else
+        {
+            CLR_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE);
+        }
+    }
+}
+
+/**
+ * @brief  帧间隔定时器对应的中断向量及AIFR溢出标志
+ * @param  [in] BTIMx BTIM单元 BTIM0~BTIM5
+ * @param  [out] penIrq 中断向量
+ * @param  [out] pu32Flag AIFR溢出标志 @ref BTIM_All_Int_Flag
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: 不是BTIM0~BTIM5
+ */
+static en_result_t LPUART_FrameGapIrqGet(const BTIM_TypeDef *BTIMx, IRQn_Type *penIrq, uint32_t *pu32Flag)
+{
+    static const uint32_t au32Flag[] = {BTIM03_AIT_FLAG_UI, BTIM14_AIT_FLAG_UI, BTIM25_AIT_FLAG_UI};
+    const BTIM_TypeDef   *apstcBtim[] = {BTIM0, BTIM1, BTIM2, BTIM3, BTIM4, BTIM5};
+    uint32_t              i;
+
+    for (i = 0u; i < ARRAY_SZ(apstcBtim); i++)
+    {
+        if (BTIMx == apstcBtim[i])
+        {
+            *penIrq   = (i < 3u) ? CTIM0_IRQn : CTIM1_IRQn;
+            *pu32Flag = au32Flag[i % 3u];
+            return Ok;
+        }
+    }
+    return ErrorInvalidParameter;
+}
+
+/**
+ * @brief  静默时间换算为BTIM计数，向上取整
+ * @param  [in] u32Pclk 计数时钟频率
+ * @param  [in] u32Us 时间，单位us
+ * @param  [in] u32Prs 预分频系数2^u32Prs
+ * @retval uint32_t 计数
+ */
+static uint32_t LPUART_FrameTicks(uint32_t u32Pclk, uint32_t u32Us, uint32_t u32Prs)
+{
+    uint64_t u64Div   = (uint64_t)1000000u << u32Prs;
+    uint64_t u64Ticks = (((uint64_t)u32Us * u32Pclk) + u64Div - 1u) / u64Div;
+
+    return (u64Ticks > UINT32_MAX) ? UINT32_MAX : (uint32_t)u64Ticks;
+}
+
+/**
+ * @brief  帧结束：另一个帧缓冲空闲时交出当前帧并切换缓冲，否则丢弃当前帧
+ * @param  [in] pstcFrame 控制块 @ref stc_lpuart_frame_t
+ * @retval None
+ */
+static void LPUART_FrameEnd(stc_lpuart_frame_t *pstcFrame)
+{
+    uint8_t  u8Active  = pstcFrame->u8Active;
+    uint16_t u16Len    = pstcFrame->u16Len;
+    uint32_t u32Status = pstcFrame->u32Status;
+
+    BTIM_IntFlagClear(pstcFrame->BTIMx, BTIM_FLAG_UI);
+    if (0u == u16Len)
+    {
+        return;
+    }
+
+    pstcFrame->u16Len    = 0u;
+    pstcFrame->u32Status = LPUART_FRAME_STS_OK;
+    if (0u != pstcFrame->au8Held[u8Active ^ 1u])
+    {
+        pstcFrame->u32FrameDrop++;
+        return;
+    }
+
+    pstcFrame->au8Held[u8Active] = 1u;
+    pstcFrame->u8Active          = u8Active ^ 1u;
+    pstcFrame->u32FrameCnt++;
+    pstcFrame->pfnFrame(pstcFrame->apu8Buf[u8Active], u16Len, u32Status, pstcFrame->pvArg);
+}
+
+/**
+ * @brief  帧间隔接收LPUART中断回调：数据写入当前帧缓冲，重启BTIM单次计数
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_frame_t
+ * @retval None
+ */
+static void LPUART_FrameRxIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_frame_t *pstcFrame = (stc_lpuart_frame_t *)pvArg;
+    BTIM_TypeDef       *BTIMx     = pstcFrame->BTIMx;
+    uint32_t            u32Elapsed;
+    uint16_t            u16Len;
+    uint8_t             u8Data;
+
+    u8Data = (uint8_t)READ_REG32_BIT(pstcFrame->LPUARTx->SBUF, LPUART_SBUF_DATA_Msk);
+    CLR_REG32_BIT(pstcFrame->LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+
+    u32Elapsed = BTIM_CounterGet(BTIMx);
+    BTIM_CounterSet(BTIMx, 0u);
+    BTIM_Enable(BTIMx);
+    if (TRUE == BTIM_IntFlagGet(BTIMx, BTIM_FLAG_UI))
+    {
+        /* 重启前间隔已到期而BTIM中断尚未执行：先结束上一帧 */
+        LPUART_FrameEnd(pstcFrame);
+    }
+    else if ((0u != pstcFrame->u16Len) && (u32Elapsed > pstcFrame->u16CharTicks))
+    {
+        pstcFrame->u32Status |= LPUART_FRAME_STS_CHAR_GAP;
+    }
+    else
+    {
+        ;
+    }
+
+    if (0u != (u32Flags & (LPUART_FLAG_FE | LPUART_FLAG_PE)))
+    {
+        pstcFrame->u32Status |= LPUART_FRAME_STS_RX_ERR;
+    }
+
+    u16Len = pstcFrame->u16Len;
+    if (u16Len < pstcFrame->u16Size)
+    {
+        pstcFrame->apu8Buf[pstcFrame->u8Active][u16Len] = u8Data;
+        pstcFrame->u16Len                               = u16Len + 1u;
+    }
+    else
+    {
+        pstcFrame->u32Status |= LPUART_FRAME_STS_OVERFLOW;
+    }
+}
+
+/**
+ * @brief  帧间隔接收BTIM中断回调：帧结束间隔到期
+ * @param  [in] u32Flags 进入中断时的AIFR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_frame_t
+ * @retval None
+ */
+static void LPUART_FrameGapIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    (void)u32Flags;
+
+    LPUART_FrameEnd((stc_lpuart_frame_t *)pvArg);
+}
+
+/**
+ * @brief  地址帧是否为本节点或广播地址（与硬件地址识别相同）
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @param  [in] u8Addr 地址帧数据
+ * @retval boolean_t
+ *           - TRUE: 匹配
+ *           - FALSE: 不匹配
+ */
+static boolean_t LPUART_NodeAddrMatch(const stc_lpuart_node_t *pstcNode, uint8_t u8Addr)
+{
+    uint8_t u8Msk   = pstcNode->u8AddrMsk;
+    uint8_t u8Bcast = pstcNode->u8Addr | u8Msk;
+
+    return ((0u == ((u8Addr ^ pstcNode->u8Addr) & u8Msk)) || (u8Bcast == (u8Addr & u8Bcast))) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  回到等待地址帧状态，硬件过滤时置位ADRDET
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @retval None
+ */
+static void LPUART_NodeIdle(stc_lpuart_node_t *pstcNode)
+{
+    pstcNode->u8State = LPUART_NODE_ST_IDLE;
+    if (LPUART_NODE_FILTER_HW == pstcNode->u8Filter)
+    {
+        SET_REG32_BIT(pstcNode->LPUARTx->SCON, LPUART_SCON_ADRDET);
+    }
+    else
+    {
+        CLR_REG32_BIT(pstcNode->LPUARTx->SCON, LPUART_SCON_ADRDET);
+    }
+}
+
+/**
+ * @brief  帧收完：恢复地址过滤后调用帧回调
+ * @param  [in] pstcNode 控制块 @ref stc_lpuart_node_t
+ * @retval None
+ */
+static void LPUART_NodeFrameEnd(stc_lpuart_node_t *pstcNode)
+{
+    LPUART_NodeIdle(pstcNode);
+    pstcNode->u32FrameCnt++;
+    pstcNode->pfnFrame(pstcNode->u8RxAddr, pstcNode->pu8Buf, pstcNode->u16Len, pstcNode->u32Status, pstcNode->pvArg);
+}
+
+/**
+ * @brief  等待TX空后写入一帧（bit8为第9位）
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] u32Frame 数据
+ * @param  [in] pstcDeadline 超时时限
+ * @retval en_result_t
+ *           - Ok: 已写入
+ *           - ErrorTimeout: TX空等待超时
+ */
+static en_result_t LPUART_NodeByteSend(LPUART_TypeDef *LPUARTx, uint32_t u32Frame, stc_ddl_deadline_t *pstcDeadline)
+{
+    while (!READ_REG_BIT(LPUARTx->ISR, LPUART_ISR_TXE))
+    {
+        if (DDL_DeadlineExpired(pstcDeadline))
+        {
+            return ErrorTimeout;
+        }
+    }
+    WRITE_REG32(LPUARTx->SBUF, u32Frame);
+
+    return Ok;
+}
+
+/**
+ * @brief  多机节点接收中断回调：地址帧匹配时开始接收本帧（清零ADRDET），收完长度字节指定的数据后交出
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_node_t
+ * @retval None
+ */
+static void LPUART_NodeIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_node_t *pstcNode = (stc_lpuart_node_t *)pvArg;
+    LPUART_TypeDef    *LPUARTx  = pstcNode->LPUARTx;
+    boolean_t          bAddr;
+    uint16_t           u16Len;
+    uint8_t            u8Data;
+
+    bAddr  = LPUART_Bit8Get(LPUARTx);
+    u8Data = LPUART_ReceiveInt(LPUARTx);
+    CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+    pstcNode->u32IrqCnt++;
+
+    if (TRUE == bAddr)
+    {
+        if (LPUART_NODE_ST_IDLE != pstcNode->u8State)
+        {
+            pstcNode->u32FrameAbort++;
+        }
+
+        if (TRUE == LPUART_NodeAddrMatch(pstcNode, u8Data))
+        {
+            pstcNode->u8RxAddr  = u8Data;
+            pstcNode->u16Len    = 0u;
+            pstcNode->u32Status = LPUART_FRAME_STS_OK;
+            pstcNode->u8State   = LPUART_NODE_ST_LEN;
+            CLR_REG32_BIT(LPUARTx->SCON, LPUART_SCON_ADRDET);
+        }
+        else
+        {
+            /* 仅软件过滤或帧未收完时收到其他节点的地址帧 */
+            LPUART_NodeIdle(pstcNode);
+        }
+    }
+    else if (LPUART_NODE_ST_IDLE != pstcNode->u8State)
+    {
+        if (0u != (u32Flags & (LPUART_FLAG_FE | LPUART_FLAG_PE)))
+        {
+            pstcNode->u32Status |= LPUART_FRAME_STS_RX_ERR;
+        }
+
+        if (LPUART_NODE_ST_LEN == pstcNode->u8State)
+        {
+            pstcNode->u8Remain = u8Data;
+            pstcNode->u8State  = LPUART_NODE_ST_DATA;
+        }
+        else
+        {
+            u16Len = pstcNode->u16Len;
+            if (u16Len < pstcNode->u16Size)
+            {
+                pstcNode->pu8Buf[u16Len] = u8Data;
+                pstcNode->u16Len         = u16Len + 1u;
+            }
+            else
+            {
+                pstcNode->u32Status |= LPUART_FRAME_STS_OVERFLOW;
+            }
+            pstcNode->u8Remain--;
+        }
+
+        if ((LPUART_NODE_ST_DATA == pstcNode->u8State) && (0u == pstcNode->u8Remain))
+        {
+            LPUART_NodeFrameEnd(pstcNode);
+        }
+    }
+    else
+    {
+        ; /* 软件过滤：其他节点的数据帧 */
+    }
+}
+
+/**
+ * @brief  自动波特率检测ATIM3中断回调：脉宽换算为波特率，在范围内且与标准波特率匹配时设置OVER/SCNT并结束检测，
+ *         否则丢弃并重新开始单次测量
+ * @param  [in] u32Flags 进入中断时的IFR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_autobaud_t
+ * @retval None
+ */
+static void LPUART_AutoBaudIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_autobaud_t *pstcAb  = (stc_lpuart_autobaud_t *)pvArg;
+    uint32_t               u32Baud = 0u;
+    uint32_t               u32Ticks;
+    stc_lpuart_baud_cfg_t  stcCfg;
+
+    (void)u32Flags;
+
+    /* 脉宽超出16位计数时UI同时置位 */
+    u32Ticks = ATIM3_Mode1_PWCCapValueGet() << pstcAb->u8PrsShift;
+    if ((FALSE == ATIM3_IntFlagGet(ATIM3_FLAG_UI)) && (0u != u32Ticks))
+    {
+        u32Baud = DDL_UDivRound(pstcAb->u32Pclk * pstcAb->u8Bits, u32Ticks);
+        u32Baud = ((u32Baud < pstcAb->u32BaudLo) || (u32Baud > pstcAb->u32BaudHi))
+                      ? 0u
+                      : LPUART_AutoBaudMatch(u32Baud, pstcAb->pu32BaudList, pstcAb->u16BaudNum, pstcAb->u32TolPpm);
+    }
+    ATIM3_IntFlagClear(ATIM3_FLAG_UI | ATIM3_FLAG_PWC_CA0);
+    pstcAb->u32Ticks = u32Ticks;
+
+    if ((0u == u32Baud) || (Ok != LPUART_BaudCalc(pstcAb->u32Pclk, u32Baud, &stcCfg)))
+    {
+        pstcAb->u32Reject++;
+        ATIM3_Mode1_Run(); /* 单次测量结束后已停止计数 */
+        return;
+    }
+
+    LPUART_BaudSet(pstcAb->LPUARTx, &stcCfg);
+    LPUART_AutoBaudStop(pstcAb);
+    pstcAb->u32Baud = u32Baud;
+    if (NULL != pstcAb->pfnDone)
+    {
+        pstcAb->pfnDone(u32Baud, pstcAb->pvArg);
+    }
+}
+
+/**
+ * @brief  结束单线半双工事务：禁止相关中断，合并事务中累计的错误并调用完成回调
+ * @param  [in] pstcHd 控制块 @ref stc_lpuart_hd_t
+ * @param  [in] u32Status 结束原因 @ref LPUART_Hd_Status
+ * @retval None
+ */
+static void LPUART_HdFinish(stc_lpuart_hd_t *pstcHd, uint32_t u32Status)
+{
+    LPUART_IntDisable(pstcHd->LPUARTx, LPUART_INT_RC | LPUART_INT_TXE | LPUART_INT_TC);
+    pstcHd->u8State   = LPUART_HD_ST_IDLE;
+    pstcHd->u32Status = (pstcHd->u32Status & ~LPUART_HD_STS_BUSY) | u32Status;
+    pstcHd->u32XferCnt++;
+    if (NULL != pstcHd->pfnDone)
+    {
+        pstcHd->pfnDone(pstcHd->u32Status, pstcHd->u16RxCnt, pstcHd->pvArg);
+    }
+}
+
+/**
+ * @brief  单线半双工事务中断回调：接收中断先按发送数据核对回波，之后的字节存为应答；TX空中断写下一字节，
+ *         全部写入后改用TC中断；TC中断即总线释放时刻，开始应答计时
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_hd_t
+ * @retval None
+ */
+static void LPUART_HdIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_hd_t *pstcHd  = (stc_lpuart_hd_t *)pvArg;
+    LPUART_TypeDef  *LPUARTx = pstcHd->LPUARTx;
+    uint32_t         u32Err;
+    uint8_t          u8Data;
+
+    if (0u != (u32Flags & LPUART_FLAG_RC))
+    {
+        u8Data = (uint8_t)READ_REG32_BIT(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk);
+        u32Err = u32Flags & (LPUART_FLAG_FE | LPUART_FLAG_PE);
+        CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+
+        if (LPUART_HD_ST_IDLE == pstcHd->u8State)
+        {
+            ; /* 事务结束后的残留数据 */
+        }
+        else if (LPUART_HD_ST_TX == pstcHd->u8State)
+        {
+            /* 发送期间总线由本机占用，收到的均为回波：多出或与发送数据不同即总线冲突，停止写入其余字节 */
+            if ((pstcHd->u16EchoCnt >= pstcHd->u16TxCnt) || (0u != u32Err) || (u8Data != pstcHd->pu8Tx[pstcHd->u16EchoCnt]))
+            {
+                pstcHd->u32Status |= LPUART_HD_STS_COLLISION;
+                pstcHd->u16TxLen = pstcHd->u16TxCnt;
+            }
+            else
+            {
+                pstcHd->u16EchoCnt++;
+            }
+        }
+        else
+        {
+            if (0u == pstcHd->u16RxCnt)
+            {
+                pstcHd->u32TurnTicks = (uint32_t)(DDL_TickGet() - pstcHd->u64TxEnd);
+            }
+            if (pstcHd->u16RxCnt < pstcHd->u16RxLen)
+            {
+                pstcHd->pu8Rx[pstcHd->u16RxCnt] = u8Data;
+                pstcHd->u16RxCnt++;
+            }
+            if (0u != u32Err)
+            {
+                pstcHd->u32Status |= LPUART_HD_STS_RX_ERR;
+            }
+            if (pstcHd->u16RxCnt >= pstcHd->u16RxLen)
+            {
+                LPUART_HdFinish(pstcHd, LPUART_HD_STS_OK);
+                return;
+            }
+        }
+    }
+
+    if ((0u != (u32Flags & LPUART_FLAG_TXE)) && (0u != READ_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE)))
+    {
+        if (pstcHd->u16TxCnt < pstcHd->u16TxLen)
+        {
+            CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_TC);
+            MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, pstcHd->pu8Tx[pstcHd->u16TxCnt]);
+            pstcHd->u16TxCnt++;
+        }
+        if (pstcHd->u16TxCnt >= pstcHd->u16TxLen)
+        {
+            CLR_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE);
+            SET_REG32_BIT(LPUARTx->SCON, LPUART_INT_TC);
+        }
+    }
+
+    if ((0u != (u32Flags & LPUART_FLAG_TC)) && (0u != READ_REG32_BIT(LPUARTx->SCON, LPUART_INT_TC)))
+    {
+        /* 最后一个停止位已发出，总线释放 */
+        pstcHd->u64TxEnd = DDL_TickGet();
+        CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_TC);
+        CLR_REG32_BIT(LPUARTx->SCON, LPUART_INT_TC);
+        pstcHd->u8State = LPUART_HD_ST_RX;
+
+        if (pstcHd->u16EchoCnt < pstcHd->u16TxCnt)
+        {
+            pstcHd->u32Status |= LPUART_HD_STS_COLLISION; /* 回波缺失：总线被拉低或接收未使能 */
+        }
+        /* 冲突时不等待应答 */
+        if ((0u != (pstcHd->u32Status & LPUART_HD_STS_COLLISION)) || (pstcHd->u16RxCnt >= pstcHd->u16RxLen))
+        {
+            LPUART_HdFinish(pstcHd, LPUART_HD_STS_OK);
+        }
+        else
+        {
+            DDL_DeadlineInit(&pstcHd->stcDeadline, pstcHd->u32TimeoutUs);
+        }
+    }
+}
+
+/**
+ * @brief  深度休眠批量接收中断回调：接收数据写入接收缓冲并检查唤醒条件，满足时清除SLEEPONEXIT，
+ *         中断返回后主循环继续执行，否则返回后继续深度休眠
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_lprx_t
+ * @retval None
+ */
+static void LPUART_LpRxIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_lprx_t *pstcLpRx = (stc_lpuart_lprx_t *)pvArg;
+    LPUART_TypeDef    *LPUARTx  = pstcLpRx->LPUARTx;
+    uint32_t           u32Event = 0u;
+    uint16_t           u16Index;
+    uint16_t           u16Count;
+    uint8_t            u8Data;
+
+    if (0u == (u32Flags & LPUART_FLAG_RC))
+    {
+        return;
+    }
+
+    pstcLpRx->u32IrqCnt++;
+    u8Data = (uint8_t)READ_REG32_BIT(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk);
+    if (0u != (u32Flags & (LPUART_FLAG_FE | LPUART_FLAG_PE)))
+    {
+        /* 错误字节仍写入缓冲，长度前缀帧从下一字节起重新同步 */
+        pstcLpRx->u32Error++;
+        pstcLpRx->u16FramePos = 0u;
+        pstcLpRx->u16FrameLen = 0u;
+        u32Event |= LPUART_LPRX_EVT_ERR;
+    }
+    CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+
+    u16Index = pstcLpRx->u16Head;
+    u16Count = (uint16_t)(u16Index - pstcLpRx->u16Tail);
+    if (u16Count <= pstcLpRx->u16Mask)
+    {
+        pstcLpRx->pu8Buf[u16Index & pstcLpRx->u16Mask] = u8Data;
+        pstcLpRx->u16Head                               = u16Index + 1u;
+        u16Count++;
+        if (u16Count > pstcLpRx->u16Mask)
+        {
+            u32Event |= LPUART_LPRX_EVT_FULL;
+        }
+    }
+    else
+    {
+        pstcLpRx->u32Overflow++;
+        u32Event |= LPUART_LPRX_EVT_FULL;
+    }
+
+    if ((0u != pstcLpRx->u16Watermark) && (u16Count >= pstcLpRx->u16Watermark))
+    {
+        u32Event |= LPUART_LPRX_EVT_WATERMARK;
+    }
+    if ((uint16_t)u8Data == pstcLpRx->u16Delim)
+    {
+        u32Event |= LPUART_LPRX_EVT_DELIM;
+    }
+    if ((LPUART_LPRX_FRAME_NONE != pstcLpRx->u8LenPos) && (0u == (u32Event & LPUART_LPRX_EVT_ERR)))
+    {
+        if (pstcLpRx->u16FramePos == pstcLpRx->u8LenPos)
+        {
+            pstcLpRx->u16FrameLen = (uint16_t)u8Data + pstcLpRx->u8LenAdd;
+        }
+        pstcLpRx->u16FramePos++;
+        if ((0u != pstcLpRx->u16FrameLen) && (pstcLpRx->u16FramePos >= pstcLpRx->u16FrameLen))
+        {
+            pstcLpRx->u16FramePos = 0u;
+            pstcLpRx->u16FrameLen = 0u;
+            u32Event |= LPUART_LPRX_EVT_FRAME;
+        }
+    }
+
+    pstcLpRx->u32Event |= u32Event;
+    if ((0u != (pstcLpRx->u32Event & pstcLpRx->u32WakeMask)) && (0u != (SCB->SCR & SCB_SCR_SLEEPONEXIT_Msk)))
+    {
+        SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+        pstcLpRx->u32WakeCnt++;
+    }
+}
+
 /**
  * @}
  */
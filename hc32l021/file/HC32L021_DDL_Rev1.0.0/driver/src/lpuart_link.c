@@ -0,0 +1,723 @@
+/**
+ *******************************************************************************
+ * @file  lpuart_link.c
+ * @brief This file provides firmware functions to manage the LPUART framed
+ *        link layer: zero-copy SLIP encoder in the TX empty interrupt,
+ *        incremental decoder in the receive interrupt, go-back-N retransmit
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+   2026-10-18       MADS            Report outstanding frames as aborted in LPUART_LinkDeInit()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "lpuart_link.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup LPUART_LINK
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup LPUART_LINK_Local_Macros LPUART_LINK局部宏定义
+ * @{
+ */
+/* SLIP分帧（RFC 1055） */
+#define LINK_SLIP_END     (0xC0u)
+#define LINK_SLIP_ESC     (0xDBu)
+#define LINK_SLIP_ESC_END (0xDCu)
+#define LINK_SLIP_ESC_ESC (0xDDu)
+
+#define LINK_CRC_INIT (0xFFFFu)
+#define LINK_CRC_UPDATE(crc, byte) \
+    ((uint16_t)(((uint16_t)(crc) << 8) ^ m_au16LinkCrcTable[(uint8_t)(((uint16_t)(crc) >> 8) ^ (uint8_t)(byte))]))
+
+#define LINK_TXQ_MASK (LPUART_LINK_TXQ_SIZE - 1u)
+
+/* 发送帧编码阶段 */
+#define LINK_TX_IDLE (0u) /* 无帧 */
+#define LINK_TX_HDR  (1u) /* 类型、序号 */
+#define LINK_TX_DATA (2u) /* 数据 */
+#define LINK_TX_CRC  (3u) /* CRC */
+#define LINK_TX_END  (4u) /* 帧结束符 */
+/**
+ * @}
+ */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static boolean_t LPUART_LinkTxStart(stc_lpuart_link_t *pstcLink);
+static boolean_t LPUART_LinkTxByte(stc_lpuart_link_t *pstcLink, uint8_t *pu8Byte);
+static void      LPUART_LinkRelease(stc_lpuart_link_t *pstcLink, uint32_t u32Status);
+static void      LPUART_LinkAck(stc_lpuart_link_t *pstcLink, uint8_t u8Ack);
+static void      LPUART_LinkRxFrame(stc_lpuart_link_t *pstcLink);
+static void      LPUART_LinkRxByte(stc_lpuart_link_t *pstcLink, uint8_t u8Byte);
+static void      LPUART_LinkIrqCallback(uint32_t u32Flags, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* CRC-16/CCITT-FALSE（多项式0x1021，不反射）按字节查表 */
+static const uint16_t m_au16LinkCrcTable[256] = {
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+    0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+    0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+    0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+    0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+    0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+    0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+    0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+    0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+    0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+    0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup LPUART_LINK_Global_Functions LPUART_LINK全局函数定义
+ * @{
+ */
+
+/**
+ * @brief  LPUART链路层配置结构体初始化：不应答，可靠模式重发超时20ms
+ * @param  [in] pstcInit 配置结构体 @ref stc_lpuart_link_init_t
+ * @retval None
+ */
+void LPUART_LinkStcInit(stc_lpuart_link_init_t *pstcInit)
+{
+    pstcInit->pu8RxBuf  = NULL;
+    pstcInit->u16RxSize = 0u;
+    pstcInit->u8Window  = 0u;
+    pstcInit->u32RetxUs = 20000u;
+    pstcInit->pfnRx     = NULL;
+    pstcInit->pfnTxDone = NULL;
+    pstcInit->pvArg     = NULL;
+}
+
+/**
+ * @brief  LPUART链路层初始化：注册中断回调并使能接收中断，发送队列为空，收发序号从0开始
+ * @note   调用前完成LPUART_Init()（8位数据，收发模式）及端口配置。可靠模式的重发超时须大于
+ *         窗口内各帧的发送时间加对方应答的时间
+ * @param  [in] LPUARTx LPUARTx通道 @ref LPUART_TypeDef
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [in] pstcInit 配置 @ref stc_lpuart_link_init_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorInvalidMode: 该LPUART中断已注册同一控制块
+ */
+en_result_t LPUART_LinkInit(LPUART_TypeDef *LPUARTx, stc_lpuart_link_t *pstcLink, const stc_lpuart_link_init_t *pstcInit,
+                            en_irq_priority_level_t enLevel)
+{
+    IRQn_Type   enIrq = (LPUART0 == LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn;
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if ((NULL == pstcLink) || (NULL == pstcInit) || (NULL == pstcInit->pu8RxBuf) || (pstcInit->u16RxSize < LPUART_LINK_OVERHEAD)
+        || (pstcInit->u8Window > LPUART_LINK_TXQ_SIZE) || ((0u != pstcInit->u8Window) && (0u == pstcInit->u32RetxUs)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    /* 关中断期间注册回调并初始化控制块：重复初始化失败时不影响正在运行的实例 */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcLink->stcIntCb.pfnCallback = LPUART_LinkIrqCallback;
+    pstcLink->stcIntCb.pvArg       = pstcLink;
+    pstcLink->stcIntCb.u32SrcMask  = LPUART_FLAG_RC | LPUART_FLAG_TXE;
+    enRet                          = INT_CallbackRegister(enIrq, &pstcLink->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcLink->LPUARTx       = LPUARTx;
+        pstcLink->u8TxHead      = 0u;
+        pstcLink->u8TxBase      = 0u;
+        pstcLink->u8TxNext      = 0u;
+        pstcLink->u8AckPend     = 0u;
+        pstcLink->u8AckSeq      = 0u;
+        pstcLink->u8TxState     = LINK_TX_IDLE;
+        pstcLink->u8TxEsc       = 0u;
+        pstcLink->bTxIdle       = TRUE;
+        pstcLink->pu8RxBuf      = pstcInit->pu8RxBuf;
+        pstcLink->u16RxSize     = pstcInit->u16RxSize;
+        pstcLink->u16RxLen      = 0u;
+        pstcLink->u16RxCrc      = LINK_CRC_INIT;
+        pstcLink->bRxEsc        = FALSE;
+        pstcLink->bRxOverflow   = FALSE;
+        pstcLink->u8RxExpect    = 0u;
+        pstcLink->u8Window      = pstcInit->u8Window;
+        pstcLink->u32RetxUs     = pstcInit->u32RetxUs;
+        pstcLink->pfnRx         = pstcInit->pfnRx;
+        pstcLink->pfnTxDone     = pstcInit->pfnTxDone;
+        pstcLink->pvArg         = pstcInit->pvArg;
+        pstcLink->u32TxFrames   = 0u;
+        pstcLink->u32TxBytes    = 0u;
+        pstcLink->u32Retx       = 0u;
+        pstcLink->u32RxFrames   = 0u;
+        pstcLink->u32RxCrcErr   = 0u;
+        pstcLink->u32RxOverflow = 0u;
+        pstcLink->u32RxLost     = 0u;
+        pstcLink->u32RxDup      = 0u;
+
+        LPUART_IntDisable(LPUARTx, LPUART_INT_TXE);
+        LPUART_IntFlagClear(LPUARTx, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+        LPUART_IntEnable(LPUARTx, LPUART_INT_RC);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  LPUART链路层停止：禁止收发中断并注销中断回调，丢弃待发送的应答帧，队列中未释放的帧
+ *         （未发出或已发出未应答）不再发送，按序以LPUART_LINK_TX_STS_ABORT调用释放回调
+ * @note   释放回调中不可调用LPUART_LinkSend()，重新LPUART_LinkInit()后再发送
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @retval None
+ */
+void LPUART_LinkDeInit(stc_lpuart_link_t *pstcLink)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+    uint8_t  u8Head;
+
+    __disable_irq();
+    LPUART_IntDisable(pstcLink->LPUARTx, LPUART_INT_RC | LPUART_INT_TXE);
+    (void)INT_CallbackUnregister((LPUART0 == pstcLink->LPUARTx) ? LPUART0_IRQn : LPUART1_IRQn, &pstcLink->stcIntCb);
+    u8Head              = pstcLink->u8TxHead;
+    pstcLink->u8TxNext  = u8Head;
+    pstcLink->u8AckPend = 0u;
+    pstcLink->u8TxState = LINK_TX_IDLE;
+    pstcLink->u8TxEsc   = 0u;
+    pstcLink->bTxIdle   = TRUE;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    /* 中断已禁止，在关中断之外调用释放回调 */
+    while (pstcLink->u8TxBase != u8Head)
+    {
+        LPUART_LinkRelease(pstcLink, LPUART_LINK_TX_STS_ABORT);
+    }
+}
+
+/**
+ * @brief  发送一帧：缓冲加入发送队列后立即返回，由TX空中断直接从该缓冲编码发送（不复制）
+ * @note   释放回调之前不可修改该缓冲；线程及中断中均可调用
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [in] pu8Data 数据
+ * @param  [in] u16Len 数据长度，不可为0且不超过对方接收帧缓冲长度减LPUART_LINK_OVERHEAD
+ * @retval en_result_t
+ *           - Ok: 已加入发送队列
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorBufferFull: 发送队列满（可靠模式下包括已发出未应答的帧）
+ */
+en_result_t LPUART_LinkSend(stc_lpuart_link_t *pstcLink, const uint8_t *pu8Data, uint16_t u16Len)
+{
+    uint32_t    u32Primask;
+    en_result_t enRet = ErrorBufferFull;
+    uint8_t     u8Head;
+
+    if ((NULL == pstcLink) || (NULL == pu8Data) || (0u == u16Len))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    u8Head = pstcLink->u8TxHead;
+    if ((uint8_t)(u8Head - pstcLink->u8TxBase) < LPUART_LINK_TXQ_SIZE)
+    {
+        pstcLink->apu8TxData[u8Head & LINK_TXQ_MASK] = pu8Data;
+        pstcLink->au16TxLen[u8Head & LINK_TXQ_MASK]  = u16Len;
+        pstcLink->u8TxHead                           = u8Head + 1u;
+        SET_REG32_BIT(pstcLink->LPUARTx->SCON, LPUART_INT_TXE);
+        enRet = Ok;
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  可靠模式重发检查：最早未应答的帧开始发送后u32RetxUs内未收到应答，则从该帧起全部重发
+ * @note   须在主循环中周期调用；不应答时只返回队列中的帧数
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @retval uint32_t 未释放的帧数（0表示全部发出且已应答）
+ */
+uint32_t LPUART_LinkPoll(stc_lpuart_link_t *pstcLink)
+{
+    uint32_t u32Primask;
+
+    if ((0u != pstcLink->u8Window) && (pstcLink->u8TxBase != pstcLink->u8TxNext)
+        && (TRUE == DDL_DeadlineExpired(&pstcLink->stcRetx)))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        /* 关中断后再次确认：应答可能刚在中断中收到 */
+        if ((pstcLink->u8TxBase != pstcLink->u8TxNext) && (TRUE == DDL_DeadlineExpired(&pstcLink->stcRetx)))
+        {
+            pstcLink->u8TxNext = pstcLink->u8TxBase;
+            pstcLink->u32Retx++;
+            DDL_DeadlineInit(&pstcLink->stcRetx, pstcLink->u32RetxUs);
+            SET_REG32_BIT(pstcLink->LPUARTx->SCON, LPUART_INT_TXE);
+        }
+        if (0u == u32Primask)
+        {
+            __enable_irq();
+        }
+    }
+
+    return (uint8_t)(pstcLink->u8TxHead - pstcLink->u8TxBase);
+}
+
+/**
+ * @brief  CRC-16/CCITT-FALSE（多项式0x1021，初值0xFFFF，不反射，不异或输出），可分段计算
+ * @note   帧数据后附加高字节在前的CRC后，对整帧计算的结果为0
+ * @param  [in] u16Crc 初值：首段为0xFFFF，后续段为上一段的结果
+ * @param  [in] pu8Data 数据
+ * @param  [in] u32Len 数据长度
+ * @retval uint16_t CRC
+ */
+uint16_t LPUART_LinkCrc16(uint16_t u16Crc, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t i;
+
+    for (i = 0u; i < u32Len; i++)
+    {
+        u16Crc = LINK_CRC_UPDATE(u16Crc, pu8Data[i]);
+    }
+
+    return u16Crc;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LPUART_LINK_Local_Functions LPUART_LINK局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  选择下一帧：待发送的应答帧优先，其次为窗口内的下一个数据帧
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @retval boolean_t TRUE: 开始发送一帧；FALSE: 无帧可发
+ */
+static boolean_t LPUART_LinkTxStart(stc_lpuart_link_t *pstcLink)
+{
+    uint8_t u8Seq = pstcLink->u8TxNext;
+
+    if (0u != pstcLink->u8AckPend)
+    {
+        pstcLink->u8AckPend   = 0u;
+        pstcLink->au8TxHdr[0] = LPUART_LINK_TYPE_ACK;
+        pstcLink->au8TxHdr[1] = pstcLink->u8AckSeq;
+        pstcLink->u16TxCurLen = 0u;
+        pstcLink->bTxFree     = FALSE;
+    }
+    else if ((u8Seq != pstcLink->u8TxHead)
+             && ((0u == pstcLink->u8Window) || ((uint8_t)(u8Seq - pstcLink->u8TxBase) < pstcLink->u8Window)))
+    {
+        pstcLink->au8TxHdr[0] = (0u == pstcLink->u8Window) ? LPUART_LINK_TYPE_DATA : LPUART_LINK_TYPE_DATA_ACK;
+        pstcLink->au8TxHdr[1] = u8Seq;
+        pstcLink->pu8TxCur    = pstcLink->apu8TxData[u8Seq & LINK_TXQ_MASK];
+        pstcLink->u16TxCurLen = pstcLink->au16TxLen[u8Seq & LINK_TXQ_MASK];
+        pstcLink->bTxFree     = (0u == pstcLink->u8Window) ? TRUE : FALSE;
+        if ((0u != pstcLink->u8Window) && (u8Seq == pstcLink->u8TxBase))
+        {
+            DDL_DeadlineInit(&pstcLink->stcRetx, pstcLink->u32RetxUs);
+        }
+        pstcLink->u8TxNext = u8Seq + 1u;
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    pstcLink->u8TxState = LINK_TX_HDR;
+    pstcLink->u16TxPos  = 0u;
+    pstcLink->u16TxCrc  = LINK_CRC_INIT;
+    return TRUE;
+}
+
+/**
+ * @brief  发送编码：输出下一个线路字节（转义后），CRC随数据逐字节计算
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [out] pu8Byte 线路字节
+ * @retval boolean_t TRUE: 有字节输出；FALSE: 无帧可发
+ */
+static boolean_t LPUART_LinkTxByte(stc_lpuart_link_t *pstcLink, uint8_t *pu8Byte)
+{
+    uint8_t u8Raw;
+
+    if (0u != pstcLink->u8TxEsc)
+    {
+        *pu8Byte          = pstcLink->u8TxEsc;
+        pstcLink->u8TxEsc = 0u;
+        return TRUE;
+    }
+
+    if (LINK_TX_IDLE == pstcLink->u8TxState)
+    {
+        if (FALSE == LPUART_LinkTxStart(pstcLink))
+        {
+            pstcLink->bTxIdle = TRUE;
+            return FALSE;
+        }
+        /* 发送停止后的第一帧前加帧结束符，使接收方丢弃线路上的残余字节 */
+        if (TRUE == pstcLink->bTxIdle)
+        {
+            pstcLink->bTxIdle = FALSE;
+            *pu8Byte          = LINK_SLIP_END;
+            return TRUE;
+        }
+    }
+
+    switch (pstcLink->u8TxState)
+    {
+        case LINK_TX_HDR:
+            u8Raw              = pstcLink->au8TxHdr[pstcLink->u16TxPos];
+            pstcLink->u16TxCrc = LINK_CRC_UPDATE(pstcLink->u16TxCrc, u8Raw);
+            pstcLink->u16TxPos++;
+            if (pstcLink->u16TxPos >= 2u)
+            {
+                pstcLink->u16TxPos  = 0u;
+                pstcLink->u8TxState = (0u != pstcLink->u16TxCurLen) ? LINK_TX_DATA : LINK_TX_CRC;
+            }
+            break;
+        case LINK_TX_DATA:
+            u8Raw              = pstcLink->pu8TxCur[pstcLink->u16TxPos];
+            pstcLink->u16TxCrc = LINK_CRC_UPDATE(pstcLink->u16TxCrc, u8Raw);
+            pstcLink->u16TxPos++;
+            if (pstcLink->u16TxPos >= pstcLink->u16TxCurLen)
+            {
+                pstcLink->u16TxPos  = 0u;
+                pstcLink->u8TxState = LINK_TX_CRC;
+            }
+            break;
+        case LINK_TX_CRC:
+            if (0u == pstcLink->u16TxPos)
+            {
+                pstcLink->au8TxCrc[0] = (uint8_t)(pstcLink->u16TxCrc >> 8);
+                pstcLink->au8TxCrc[1] = (uint8_t)pstcLink->u16TxCrc;
+            }
+            u8Raw = pstcLink->au8TxCrc[pstcLink->u16TxPos];
+            pstcLink->u16TxPos++;
+            if (pstcLink->u16TxPos >= 2u)
+            {
+                pstcLink->u8TxState = LINK_TX_END;
+            }
+            break;
+        default:
+            /* 帧结束符：不应答的帧此时已全部写入SBUF，释放调用者缓冲 */
+            *pu8Byte            = LINK_SLIP_END;
+            pstcLink->u8TxState = LINK_TX_IDLE;
+            pstcLink->u32TxFrames++;
+            if (TRUE == pstcLink->bTxFree)
+            {
+                LPUART_LinkRelease(pstcLink, LPUART_LINK_TX_STS_OK);
+            }
+            return TRUE;
+    }
+
+    if (LINK_SLIP_END == u8Raw)
+    {
+        *pu8Byte          = LINK_SLIP_ESC;
+        pstcLink->u8TxEsc = LINK_SLIP_ESC_END;
+    }
+    else if (LINK_SLIP_ESC == u8Raw)
+    {
+        *pu8Byte          = LINK_SLIP_ESC;
+        pstcLink->u8TxEsc = LINK_SLIP_ESC_ESC;
+    }
+    else
+    {
+        *pu8Byte = u8Raw;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief  释放最早的帧并调用释放回调
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [in] u32Status 释放状态 @ref LPUART_LINK_Tx_Status
+ * @retval None
+ */
+static void LPUART_LinkRelease(stc_lpuart_link_t *pstcLink, uint32_t u32Status)
+{
+    const uint8_t *pu8Data = pstcLink->apu8TxData[pstcLink->u8TxBase & LINK_TXQ_MASK];
+
+    pstcLink->u8TxBase++;
+    if (NULL != pstcLink->pfnTxDone)
+    {
+        pstcLink->pfnTxDone(pu8Data, u32Status, pstcLink->pvArg);
+    }
+}
+
+/**
+ * @brief  收到应答：释放序号u8Ack之前的帧，仍有未应答的帧时重新开始重发计时
+ * @note   重发回退后正在发送的帧可能已被应答释放，接收方按重复帧丢弃
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [in] u8Ack 对方下一个期望接收的序号
+ * @retval None
+ */
+static void LPUART_LinkAck(stc_lpuart_link_t *pstcLink, uint8_t u8Ack)
+{
+    uint8_t u8Cnt = (uint8_t)(u8Ack - pstcLink->u8TxBase);
+
+    /* 过时的应答或超出已入队的帧 */
+    if ((0u == pstcLink->u8Window) || (0u == u8Cnt) || (u8Cnt > (uint8_t)(pstcLink->u8TxHead - pstcLink->u8TxBase)))
+    {
+        return;
+    }
+
+    while (pstcLink->u8TxBase != u8Ack)
+    {
+        LPUART_LinkRelease(pstcLink, LPUART_LINK_TX_STS_OK);
+    }
+
+    if ((uint8_t)(pstcLink->u8TxNext - pstcLink->u8TxBase) > (uint8_t)(pstcLink->u8TxHead - pstcLink->u8TxBase))
+    {
+        pstcLink->u8TxNext = pstcLink->u8TxBase;
+    }
+    if (pstcLink->u8TxBase != pstcLink->u8TxNext)
+    {
+        DDL_DeadlineInit(&pstcLink->stcRetx, pstcLink->u32RetxUs);
+    }
+
+    /* 窗口已移动 */
+    SET_REG32_BIT(pstcLink->LPUARTx->SCON, LPUART_INT_TXE);
+}
+
+/**
+ * @brief  接收帧结束：检查长度及CRC，按类型处理
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @retval None
+ */
+static void LPUART_LinkRxFrame(stc_lpuart_link_t *pstcLink)
+{
+    uint8_t  *pu8Buf   = pstcLink->pu8RxBuf;
+    boolean_t bDeliver = FALSE;
+    uint16_t  u16Len;
+    uint8_t   u8Seq;
+
+    if (TRUE == pstcLink->bRxOverflow)
+    {
+        pstcLink->u32RxOverflow++;
+        return;
+    }
+    if ((pstcLink->u16RxLen < LPUART_LINK_OVERHEAD) || (0u != pstcLink->u16RxCrc))
+    {
+        pstcLink->u32RxCrcErr++;
+        return;
+    }
+
+    /* 长度已检查，解码帧头 */
+    u16Len = pstcLink->u16RxLen - LPUART_LINK_OVERHEAD;
+    u8Seq  = pu8Buf[1];
+
+    switch (pu8Buf[0])
+    {
+        case LPUART_LINK_TYPE_DATA:
+            pstcLink->u32RxLost += (uint8_t)(u8Seq - pstcLink->u8RxExpect);
+            pstcLink->u8RxExpect = u8Seq + 1u;
+            bDeliver             = TRUE;
+            break;
+        case LPUART_LINK_TYPE_DATA_ACK:
+            if (u8Seq == pstcLink->u8RxExpect)
+            {
+                pstcLink->u8RxExpect++;
+                bDeliver = TRUE;
+            }
+            else if ((uint8_t)(pstcLink->u8RxExpect - u8Seq - 1u) < 0x80u)
+            {
+                pstcLink->u32RxDup++;
+            }
+            else
+            {
+                pstcLink->u32RxLost++;
+            }
+            /* 每个数据帧都回送累计应答，重复帧的应答用于补发丢失的应答 */
+            pstcLink->u8AckSeq  = pstcLink->u8RxExpect;
+            pstcLink->u8AckPend = 1u;
+            SET_REG32_BIT(pstcLink->LPUARTx->SCON, LPUART_INT_TXE);
+            break;
+        case LPUART_LINK_TYPE_ACK:
+            if (0u == u16Len)
+            {
+                LPUART_LinkAck(pstcLink, u8Seq);
+            }
+            else
+            {
+                pstcLink->u32RxCrcErr++;
+            }
+            break;
+        default:
+            pstcLink->u32RxCrcErr++;
+            break;
+    }
+
+    if (TRUE == bDeliver)
+    {
+        pstcLink->u32RxFrames++;
+        if (NULL != pstcLink->pfnRx)
+        {
+            pstcLink->pfnRx(&pu8Buf[2], u16Len, pstcLink->pvArg);
+        }
+    }
+}
+
+/**
+ * @brief  接收解码：去转义、计算CRC并写入接收帧缓冲，帧结束符处处理整帧
+ * @param  [in] pstcLink 控制块 @ref stc_lpuart_link_t
+ * @param  [in] u8Byte 线路字节
+ * @retval None
+ */
+static void LPUART_LinkRxByte(stc_lpuart_link_t *pstcLink, uint8_t u8Byte)
+{
+    if (LINK_SLIP_END == u8Byte)
+    {
+        /* 空帧（连续的帧结束符）忽略 */
+        if ((0u != pstcLink->u16RxLen) || (TRUE == pstcLink->bRxOverflow))
+        {
+            LPUART_LinkRxFrame(pstcLink);
+        }
+        pstcLink->u16RxLen    = 0u;
+        pstcLink->u16RxCrc    = LINK_CRC_INIT;
+        pstcLink->bRxEsc      = FALSE;
+        pstcLink->bRxOverflow = FALSE;
+        return;
+    }
+
+    if (LINK_SLIP_ESC == u8Byte)
+    {
+        pstcLink->bRxEsc = TRUE;
+        return;
+    }
+
+    if (TRUE == pstcLink->bRxEsc)
+    {
+        pstcLink->bRxEsc = FALSE;
+        u8Byte = (LINK_SLIP_ESC_END == u8Byte) ? LINK_SLIP_END : ((LINK_SLIP_ESC_ESC == u8Byte) ? LINK_SLIP_ESC : u8Byte);
+    }
+
+    if (pstcLink->u16RxLen < pstcLink->u16RxSize)
+    {
+        pstcLink->pu8RxBuf[pstcLink->u16RxLen] = u8Byte;
+        pstcLink->u16RxLen++;
+        pstcLink->u16RxCrc = LINK_CRC_UPDATE(pstcLink->u16RxCrc, u8Byte);
+    }
+    else
+    {
+        pstcLink->bRxOverflow = TRUE;
+    }
+}
+
+/**
+ * @brief  链路层中断回调：接收字节送解码器；TX空时输出下一个线路字节，无帧可发时禁止TX空中断
+ * @param  [in] u32Flags 进入中断时的ISR
+ * @param  [in] pvArg 控制块 @ref stc_lpuart_link_t
+ * @retval None
+ */
+static void LPUART_LinkIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_lpuart_link_t *pstcLink = (stc_lpuart_link_t *)pvArg;
+    LPUART_TypeDef    *LPUARTx  = pstcLink->LPUARTx;
+    uint8_t            u8Byte;
+
+    if (0u != (u32Flags & LPUART_FLAG_RC))
+    {
+        u8Byte = (uint8_t)READ_REG32_BIT(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk);
+        CLR_REG32_BIT(LPUARTx->ICR, LPUART_FLAG_RC | LPUART_FLAG_FE | LPUART_FLAG_PE);
+        LPUART_LinkRxByte(pstcLink, u8Byte);
+    }
+
+    if ((0u != (u32Flags & LPUART_FLAG_TXE)) && (0u != READ_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE)))
+    {
+        if (TRUE == LPUART_LinkTxByte(pstcLink, &u8Byte))
+        {
+            MODIFY_REG32(LPUARTx->SBUF, LPUART_SBUF_DATA_Msk, u8Byte);
+            pstcLink->u32TxBytes++;
+        }
+        else
+        {
+            CLR_REG32_BIT(LPUARTx->SCON, LPUART_INT_TXE);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -56,7 +56,23 @@
  * @defgroup RTC_Timeout RTC超时时间
  * @{
  */
-#define RTC_TIMEOUT 0xFFFFu
+#define RTC_TIMEOUT (10000u) /*!< RTC同步等待超时时间（us） */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup RTC_Compen_Calc RTC误差补偿值计算（补偿目标值为Q16.16格式，单位ppm）
+ * @{
+ */
+#define RTC_COMP_PPM_MIN       (-18000117) /*!< 下限-274.66ppm */
+#define RTC_COMP_0P96_PPM_MAX  (13937541)  /*!< 0.96ppm精度上限212.67ppm */
+#define RTC_COMP_0P06_PPM_MAX  (13996523)  /*!< 0.06ppm精度上限213.57ppm */
+#define RTC_COMP_0P96_PPM_NEG  (-2062501)  /*!< 0.96ppm精度负向补偿分界-31.47125ppm */
+#define RTC_COMP_0P06_PPM_NEG  (-2000001)  /*!< 0.06ppm精度负向补偿分界-30.51758ppm */
+#define RTC_COMP_0P96_DIV      (62500u)    /*!< 0.96ppm步长0.9536743 = 15625/2^14，ppm/步长 = Q16值/62500 */
+#define RTC_COMP_0P06_DIV      (3999997u)  /*!< 0.06ppm步长0.0596046f = 15999988/2^28，ppm/步长 = Q16值*1024/3999997 */
+#define RTC_COMP_0P06_DIV_BITS (10u)       /*!< 0.06ppm计算被除数分段长除的位数 */
 /**
  * @}
  */
@@ -81,6 +97,12 @@
  * @brief  平年每个月最后一天日期表 BCD格式
  */
 const static uint8_t au8CommonYearMonthEndDates[12] = {0x31, 0x28, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31};
+
+/**
+ * @brief  误差补偿步长的倒数
+ */
+const static stc_ddl_recip_t stcComp0p96Recip = DDL_RECIP_INIT(RTC_COMP_0P96_DIV);
+const static stc_ddl_recip_t stcComp0p06Recip = DDL_RECIP_INIT(RTC_COMP_0P06_DIV);
 /**
  * @}
  */
@@ -93,6 +115,7 @@ const static uint8_t au8CommonYearMonthEndDates[12] = {0x31, 0x28, 0x31, 0x30, 0
  */
 static en_result_t RTC_CheckBCDFormat(uint8_t u8Data, uint8_t u8Min, uint8_t u8Max);
 static boolean_t   RTC_IsLeapYear(uint8_t u8Year);
+static uint32_t    RTC_Comp0p06Div(uint64_t u64Num);
 /**
  * @}
  */
@@ -136,6 +159,24 @@ static boolean_t RTC_IsLeapYear(uint8_t u8Year)
 
     return (((u16Year % 4u == 0u) && (u16Year % 100u != 0u)) || (u16Year % 400u == 0u)) ? TRUE : FALSE;
 }
+
+/**
+ * @brief  0.06ppm误差补偿计算的除法：u64Num / RTC_COMP_0P06_DIV
+ * @param  [in] u64Num 被除数（小于2^36）
+ * @retval uint32_t 商（向下取整）
+ * @note   除数小于2^22，按高26位、低10位分两次长除，每次被除数均不超过32位
+ */
+static uint32_t RTC_Comp0p06Div(uint64_t u64Num)
+{
+    uint32_t u32Hi = (uint32_t)(u64Num >> RTC_COMP_0P06_DIV_BITS);
+    uint32_t u32Lo = (uint32_t)u64Num & ((1u << RTC_COMP_0P06_DIV_BITS) - 1u);
+    uint32_t u32QuotHi;
+
+    u32QuotHi = DDL_RecipDiv(u32Hi, &stcComp0p06Recip);
+    u32Lo |= (u32Hi - (u32QuotHi * RTC_COMP_0P06_DIV)) << RTC_COMP_0P06_DIV_BITS;
+
+    return (u32QuotHi << RTC_COMP_0P06_DIV_BITS) + DDL_RecipDiv(u32Lo, &stcComp0p06Recip);
+}
 /**
  * @}
  */
@@ -218,14 +259,14 @@ void RTC_Disable(void)
  */
 en_result_t RTC_StartWait(void)
 {
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
 
     SET_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
 
-    u32Timeout = RTC_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
     while (RTC_CR1_WAITF_Msk != READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk)) /* 等待直到WAITF=1 */
     {
-        if (0x0u == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -233,10 +274,10 @@ en_result_t RTC_StartWait(void)
 
     CLR_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
 
-    u32Timeout = RTC_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
     while (RTC_CR1_WAITF_Msk == READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk)) /* 等待直到WAITF=0 */
     {
-        if (0x0u == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -356,16 +397,16 @@ void RTC_AlarmDisalbe(uint32_t u32AlarmX)
  */
 void RTC_AlarmTimeGet(uint32_t u32AlarmX, stc_rtc_alarmtime_t *pstcAlarmTime)
 {
-    uint32_t u32RegAddr;
+    uintptr_t u32RegAddr;
     uint8_t  u8Hour;
 
     if (RTC_ALM_CHA == u32AlarmX)
     {
-        u32RegAddr = (uint32_t)&RTC->ALMA;
+        u32RegAddr = (uintptr_t)&RTC->ALMA;
     }
     else
     {
-        u32RegAddr = (uint32_t)&RTC->ALMB;
+        u32RegAddr = (uintptr_t)&RTC->ALMB;
     }
 
     pstcAlarmTime->u8AlarmSecond    = (uint8_t)(((*(uint32_t *)u32RegAddr) & (RTC_ALMA_SECL_Msk | RTC_ALMA_SECH_Msk)) >> RTC_ALMA_SECL_Pos);
@@ -664,6 +705,91 @@ en_result_t RTC_CompValueCalculate(float32_t f32CompUint, uint16_t u16Csteps, ui
     return Ok;
 }
 
+/**
+ * @brief  计算RTC误差补偿寄存器的值（整数运算）
+ * @param  [in] i32CompUint: 补偿目标值，单位ppm，Q16.16格式（如DDL_Q16(10.5)）
+ * @param  [in] u16Csteps: 补偿精度选择 @ref RTC_Compen_Pricision_Select
+ * @param  [out] pu16CompValue: 计算结果
+ * @retval en_result_t
+ *           - Ok: 计算成功
+ *           - ErrorInvalidParameter: 参数错误
+ * @note   只用整数运算，结果为精确值四舍五入
+ */
+en_result_t RTC_CompValueCalculateQ16(int32_t i32CompUint, uint16_t u16Csteps, uint16_t *pu16CompValue)
+{
+    uint16_t u16Res = 0;
+    int32_t  i32Num;
+    uint32_t u32Res;
+    uint64_t u64Num;
+
+    /* 根据 u16Csteps 选择补偿精度 */
+    if (u16Csteps == RTC_COMPEN_PRICISION_0P96PPM)
+    {
+        if ((i32CompUint < RTC_COMP_PPM_MIN) || (i32CompUint > RTC_COMP_0P96_PPM_MAX))
+        {
+            return ErrorInvalidParameter;
+        }
+
+        if (i32CompUint > RTC_COMP_0P96_PPM_NEG)
+        {
+            CLR_REG32_BIT(RTC->COMPEN, RTC_COMPEN_CSTEPS_Msk);
+            /* 32 + ppm / 0.9536743 = (2000000 + Q16值) / 62500，四舍五入（0.5远离0） */
+            i32Num = 2000000 + i32CompUint;
+            if (0 <= i32Num)
+            {
+                u32Res = DDL_RecipDiv((uint32_t)i32Num + (RTC_COMP_0P96_DIV / 2u), &stcComp0p96Recip);
+            }
+            else
+            {
+                u32Res = 0u - DDL_RecipDiv((uint32_t)(-i32Num) + (RTC_COMP_0P96_DIV / 2u), &stcComp0p96Recip);
+            }
+            u16Res = (uint16_t)u32Res; /* 仅保留低9位 */
+            u16Res &= 0x1FFu;
+        }
+        else
+        {
+            CLR_REG32_BIT(RTC->COMPEN, RTC_COMPEN_CSTEPS_Msk);
+            /* 512 + (ppm + 32 * 0.9536743) / 0.9536743 = (34000000 + Q16值) / 62500，被除数为正 */
+            u32Res = DDL_RecipDiv((uint32_t)(34000000 + i32CompUint) + (RTC_COMP_0P96_DIV / 2u), &stcComp0p96Recip);
+            u16Res = (uint16_t)u32Res; /* 仅保留低9位 */
+            u16Res &= 0x1FFu;
+        }
+    }
+
+    else if (u16Csteps == RTC_COMPEN_PRICISION_0P06PPM)
+    {
+        if ((i32CompUint < RTC_COMP_PPM_MIN) || (i32CompUint > RTC_COMP_0P06_PPM_MAX))
+        {
+            return ErrorInvalidParameter;
+        }
+
+        /* K + ppm / 0.0596046 = (K * 3999997 + Q16值 * 1024) / 3999997，除数为奇数，不存在恰为0.5的情况，
+           加(3999997 - 1) / 2后向下取整即四舍五入，被除数为正 */
+        if (i32CompUint > RTC_COMP_0P06_PPM_NEG)
+        {
+            SET_REG32_BIT(RTC->COMPEN, RTC_COMPEN_CSTEPS_Msk);
+            u64Num = (512u * (uint64_t)RTC_COMP_0P06_DIV) + (RTC_COMP_0P06_DIV / 2u);
+        }
+        else
+        {
+            SET_REG32_BIT(RTC->COMPEN, RTC_COMPEN_CSTEPS_Msk);
+            u64Num = ((8192u + 512u) * (uint64_t)RTC_COMP_0P06_DIV) + (RTC_COMP_0P06_DIV / 2u);
+        }
+        u64Num = (uint64_t)((int64_t)u64Num + ((int64_t)i32CompUint * 1024));
+        u16Res = (uint16_t)RTC_Comp0p06Div(u64Num); /* 仅保留低13位 */
+        u16Res &= 0x1FFFu;
+    }
+
+    else
+    {
+        return ErrorInvalidParameter;
+    }
+
+    *pu16CompValue = u16Res;
+
+    return Ok;
+}
+
 /**
  * @brief  配置RTC的误差补偿寄存器
  * @param  [in] u16CompValue 对于0.96ppm精度：范围为0-511（即0x1FF）；对于0.06ppm精度：范围为0-8191（即0x1FFF）
@@ -749,16 +875,16 @@ void RTC_CompDisable(void)
  */
 en_result_t RTC_DateTimeRead(stc_rtc_time_t *pstcDateTime)
 {
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
 
     if (READ_REG32_BIT(RTC->CR0, RTC_CR0_START_Msk))
     {
         SET_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
 
-        u32Timeout = RTC_TIMEOUT;
+        DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
         while (RTC_CR1_WAITF_Msk != READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -783,12 +909,12 @@ en_result_t RTC_DateTimeRead(stc_rtc_time_t *pstcDateTime)
 
     CLR_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
 
-    u32Timeout = RTC_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
     if (READ_REG32_BIT(RTC->CR0, RTC_CR0_START_Msk))
     {
         while (RTC_CR1_WAITF_Msk == READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -808,9 +934,9 @@ en_result_t RTC_DateTimeRead(stc_rtc_time_t *pstcDateTime)
  */
 en_result_t RTC_DateTimeSet(stc_rtc_time_t *pstcDateTime)
 {
-    en_result_t enRet = Ok;
-    uint32_t    u32Timeout;
-    uint8_t     u8MonthIndex;
+    en_result_t        enRet = Ok;
+    stc_ddl_deadline_t stcDeadline;
+    uint8_t            u8MonthIndex;
 
     if (Ok != RTC_CheckBCDFormat(pstcDateTime->u8Second, 0x00u, 0x59u))
     {
@@ -868,10 +994,10 @@ en_result_t RTC_DateTimeSet(stc_rtc_time_t *pstcDateTime)
     if (READ_REG32_BIT(RTC->CR0, RTC_CR0_START_Msk))
     {
         SET_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
-        u32Timeout = RTC_TIMEOUT;
+        DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
         while (RTC_CR1_WAITF_Msk != READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -894,12 +1020,12 @@ en_result_t RTC_DateTimeSet(stc_rtc_time_t *pstcDateTime)
 
     CLR_REG32_BIT(RTC->CR1, RTC_CR1_WAIT_Msk);
 
-    u32Timeout = RTC_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, RTC_TIMEOUT);
     if (READ_REG32_BIT(RTC->CR0, RTC_CR0_START_Msk))
     {
         while (RTC_CR1_WAITF_Msk == READ_REG32_BIT(RTC->CR1, RTC_CR1_WAITF_Msk))
         {
-            if (0x0u == u32Timeout--)
+            if (DDL_DeadlineExpired(&stcDeadline))
             {
                 return ErrorTimeout; /* 等待超时 */
             }
@@ -7,6 +7,11 @@
    Change Logs:
    Date             Author          Notes
    2024-11-14       MADS            First version
+   2026-10-18       MADS            Add pipelined 8/16-bit transmit, receive and full duplex transfers
+   2026-10-18       MADS            Add interrupt driven asynchronous transaction queue with chip select
+   2026-10-18       MADS            Add double-buffered interrupt driven slave streaming
+   2026-10-18       MADS            Restore loop-count timeouts, add microsecond *TimeoutUs variants
+   2026-10-18       MADS            Detect receive overrun in pipelined transfers
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -42,12 +47,25 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+#define SPI_ASYNC_MODE_MSK (SPI_CR0_BRR_Msk | SPI_CR0_CPOL_Msk | SPI_CR0_CPHA_Msk | SPI_CR0_WIDTH_Msk)
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static en_result_t SPI_SlaveDummyDataTransmitDeadline(SPI_TypeDef *SPIx, uint16_t u16Data, stc_ddl_deadline_t *pstcDeadline);
+static en_result_t SPI_PipeXfer(SPI_TypeDef *SPIx, const void *pvTx, void *pvRx, uint32_t u32Len, uint16_t u16Fill,
+                                boolean_t b16Bit, stc_ddl_deadline_t *pstcDeadline);
+static void        SPI_AsyncStart(stc_spi_async_t *pstcAsync);
+static void        SPI_AsyncTxFill(stc_spi_async_t *pstcAsync);
+static void        SPI_AsyncRxStore(stc_spi_async_t *pstcAsync, uint16_t u16Data, boolean_t bStore);
+static void        SPI_AsyncFinish(stc_spi_async_t *pstcAsync);
+static void        SPI_AsyncIrqCallback(uint32_t u32Flags, void *pvArg);
+static void        SPI_SlaveTxFill(stc_spi_slave_t *pstcSlave, uint32_t u32Sr);
+static void        SPI_SlavePreload(stc_spi_slave_t *pstcSlave);
+static void        SPI_SlaveFrameEnd(stc_spi_slave_t *pstcSlave);
+static void        SPI_SlaveIrqCallback(uint32_t u32Flags, void *pvArg);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
@@ -346,107 +364,598 @@ en_result_t SPI_SlaveDummyDataTransmit(SPI_TypeDef *SPIx, uint16_t u16Data)
  * @brief  SPI 从机预准备第一个数据超时等待
  * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
  * @param  [in] u16Data 预准备第一个数据
- * @param  [in] u32Timeout 等待时间
+ * @param  [in] u32Timeout 等待时间（查询次数）
  * @retval en_result_t
  *           - Ok 从机预准备第一个数据成功
  *           - ErrorTimeout 等待超时
  */
 en_result_t SPI_SlaveDummyDataTransmitTimeout(SPI_TypeDef *SPIx, uint16_t u16Data, uint32_t u32Timeout)
 {
-    while (FALSE == SPIx->SR_f.TXE)
-    {
-        if (0x0u == u32Timeout--)
-        {
-            return ErrorTimeout; /* 等待超时 */
-        }
-    }
-    SPIx->DR = u16Data;
-    return Ok;
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineCountInit(&stcDeadline, u32Timeout);
+    return SPI_SlaveDummyDataTransmitDeadline(SPIx, u16Data, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 从机预准备第一个数据超时等待（微秒超时）
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] u16Data 预准备第一个数据
+ * @param  [in] u32TimeoutUs 等待时间，单位us；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *           - Ok 从机预准备第一个数据成功
+ *           - ErrorTimeout 等待超时
+ */
+en_result_t SPI_SlaveDummyDataTransmitTimeoutUs(SPI_TypeDef *SPIx, uint16_t u16Data, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_SlaveDummyDataTransmitDeadline(SPIx, u16Data, &stcDeadline);
 }
 
 /**
  * @brief  SPI 连续发送接收多个数据函数
  * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
- * @param  [in] pu16SendBuf 发送数据指针
- * @param  [in] pu16RecBuf 接收数据指针
+ * @param  [in] pu16SendBuf 发送数据指针，为NULL时发送0xFFFF
+ * @param  [in] pu16RecBuf 接收数据指针，为NULL时丢弃接收数据
  * @param  [in] u32Len 发送数据长度
  * @retval en_result_t
  *         - Ok 收发数据成功
+ *         - Error 接收上溢，有接收数据丢失
  */
 en_result_t SPI_TransmitReceive(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len)
 {
-    uint32_t u32Index = 0u;
-    for (u32Index = 0u; u32Index < u32Len; u32Index++)
-    {
-        while (FALSE == SPIx->SR_f.TXE) {}
-
-        SPIx->DR = pu16SendBuf[u32Index];
+    return SPI_PipeXfer(SPIx, pu16SendBuf, pu16RecBuf, u32Len, 0xFFFFu, TRUE, NULL);
+}
 
-        while (FALSE == SPIx->SR_f.RXNE) {}
+/**
+ * @brief  SPI 连续发送接收多个数据等待超时函数
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pu16SendBuf 发送数据指针，为NULL时发送0xFFFF
+ * @param  [in] pu16RecBuf 接收数据指针，为NULL时丢弃接收数据
+ * @param  [in] u32Len 发送数据长度
+ * @param  [in] u32Timeout 等待时间（查询次数，为整个调用的总次数上限）
+ * @retval en_result_t
+ *         - Ok SPI初始化成功
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_TransmitReceiveTimeout(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len, uint32_t u32Timeout)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-        pu16RecBuf[u32Index] = (uint16_t)SPIx->DR;
-    }
+    DDL_DeadlineCountInit(&stcDeadline, u32Timeout);
+    return SPI_PipeXfer(SPIx, pu16SendBuf, pu16RecBuf, u32Len, 0xFFFFu, TRUE, &stcDeadline);
+}
 
-    while (FALSE == SPIx->SR_f.TXE) {}
-    while (TRUE == SPIx->SR_f.BUSY) {}
+/**
+ * @brief  SPI 连续发送接收多个数据等待超时函数（微秒超时）
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pu16SendBuf 发送数据指针，为NULL时发送0xFFFF
+ * @param  [in] pu16RecBuf 接收数据指针，为NULL时丢弃接收数据
+ * @param  [in] u32Len 发送数据长度
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 收发数据成功
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_TransmitReceiveTimeoutUs(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
 
-    return Ok;
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, pu16SendBuf, pu16RecBuf, u32Len, 0xFFFFu, TRUE, &stcDeadline);
 }
 
 /**
- * @brief  SPI 连续发送接收多个数据等待超时函数
+ * @brief  SPI 主机连续发送8位数据，丢弃接收数据
  * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
- * @param  [in] pu16SendBuf 发送数据指针
- * @param  [in] pu16RecBuf 接收数据指针
+ * @param  [in] pu8Data 发送数据指针
  * @param  [in] u32Len 发送数据长度
- * @param  [in] u32Timeout 等待时间
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
  * @retval en_result_t
- *         - Ok SPI初始化成功
+ *         - Ok 发送完成（总线空闲）
  *         - ErrorTimeout 等待超时
  */
-en_result_t SPI_TransmitReceiveTimeout(SPI_TypeDef *SPIx, uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len, uint32_t u32Timeout)
+en_result_t SPI_Transmit8(SPI_TypeDef *SPIx, const uint8_t *pu8Data, uint32_t u32Len, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, pu8Data, NULL, u32Len, 0u, FALSE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 主机连续发送16位数据，丢弃接收数据
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pu16Data 发送数据指针
+ * @param  [in] u32Len 发送数据长度（字数）
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 发送完成（总线空闲）
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_Transmit16(SPI_TypeDef *SPIx, const uint16_t *pu16Data, uint32_t u32Len, uint32_t u32TimeoutUs)
 {
-    uint32_t u32Index = 0u;
+    stc_ddl_deadline_t stcDeadline;
 
-    for (u32Index = 0u; u32Index < u32Len; u32Index++)
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, pu16Data, NULL, u32Len, 0u, TRUE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 主机连续接收8位数据，发送填充值
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [out] pu8Data 接收数据指针
+ * @param  [in] u32Len 接收数据长度
+ * @param  [in] u8Fill 接收期间发送的填充值（如存储器读取时的0xFF）
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 接收完成
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_Receive8(SPI_TypeDef *SPIx, uint8_t *pu8Data, uint32_t u32Len, uint8_t u8Fill, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, NULL, pu8Data, u32Len, u8Fill, FALSE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 主机连续接收16位数据，发送填充值
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [out] pu16Data 接收数据指针
+ * @param  [in] u32Len 接收数据长度（字数）
+ * @param  [in] u16Fill 接收期间发送的填充值
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 接收完成
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_Receive16(SPI_TypeDef *SPIx, uint16_t *pu16Data, uint32_t u32Len, uint16_t u16Fill, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, NULL, pu16Data, u32Len, u16Fill, TRUE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 主机全双工连续收发8位数据
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pu8Tx 发送数据指针，为NULL时发送0xFF
+ * @param  [out] pu8Rx 接收数据指针，为NULL时丢弃接收数据；可与pu8Tx相同（原地收发）
+ * @param  [in] u32Len 数据长度
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 收发完成
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_TransmitReceive8(SPI_TypeDef *SPIx, const uint8_t *pu8Tx, uint8_t *pu8Rx, uint32_t u32Len, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, pu8Tx, pu8Rx, u32Len, 0xFFu, FALSE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI 主机全双工连续收发16位数据
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pu16Tx 发送数据指针，为NULL时发送0xFFFF
+ * @param  [out] pu16Rx 接收数据指针，为NULL时丢弃接收数据；可与pu16Tx相同（原地收发）
+ * @param  [in] u32Len 数据长度（字数）
+ * @param  [in] u32TimeoutUs 等待时间，单位us，为整个调用的总时长上限；DDL_TIMEOUT_FOREVER表示永不超时
+ * @retval en_result_t
+ *         - Ok 收发完成
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+en_result_t SPI_TransmitReceive16(SPI_TypeDef *SPIx, const uint16_t *pu16Tx, uint16_t *pu16Rx, uint32_t u32Len, uint32_t u32TimeoutUs)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32TimeoutUs);
+    return SPI_PipeXfer(SPIx, pu16Tx, pu16Rx, u32Len, 0xFFFFu, TRUE, &stcDeadline);
+}
+
+/**
+ * @brief  SPI异步事务描述初始化：无片选、PCLK/2、模式0、8位、填充值0xFFFF、无数据段
+ * @param  [in] pstcXfer 事务描述 @ref stc_spi_xfer_t
+ * @retval None
+ */
+void SPI_XferStcInit(stc_spi_xfer_t *pstcXfer)
+{
+    pstcXfer->CSx          = NULL;
+    pstcXfer->u32CsPin     = 0u;
+    pstcXfer->u32BaudRate  = SPI_BAUDRATE_PCLK_DIV2;
+    pstcXfer->u32CPOL      = SPI_CLK_POLARITY_LOW;
+    pstcXfer->u32CPHA      = SPI_CLK_PHASE_1EDGE;
+    pstcXfer->u32DataWidth = SPI_DATA_WIDTH_8BIT;
+    pstcXfer->u16Fill      = 0xFFFFu;
+    pstcXfer->u8SegNum     = 0u;
+    pstcXfer->pstcSeg      = NULL;
+    pstcXfer->pfnDone      = NULL;
+    pstcXfer->pvArg        = NULL;
+    pstcXfer->u32Status    = SPI_XFER_STS_OK;
+    pstcXfer->pstcNext     = NULL;
+}
+
+/**
+ * @brief  SPI异步事务队列初始化：注册SPI中断回调并使能SPI，之后以SPI_AsyncSubmit()提交事务
+ * @note   调用前以SPI_Init()配置为主机模式，片选GPIO配置为推挽输出高电平。
+ *         事务进行中不可调用阻塞收发函数（SPI_TransmitReceive()等）；接收中断响应须在一帧时间内，
+ *         否则接收上溢，事务以SPI_XFER_STS_OVF结束
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: pstcAsync为NULL
+ *           - ErrorInvalidMode: 控制块已在使用
+ */
+en_result_t SPI_AsyncInit(SPI_TypeDef *SPIx, stc_spi_async_t *pstcAsync, en_irq_priority_level_t enLevel)
+{
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if (NULL == pstcAsync)
     {
-        while (FALSE == SPIx->SR_f.TXE)
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcAsync->stcIntCb.pfnCallback = SPI_AsyncIrqCallback;
+    pstcAsync->stcIntCb.pvArg       = pstcAsync;
+    pstcAsync->stcIntCb.u32SrcMask  = SPI_FLAG_RXNE;
+    enRet                           = INT_CallbackRegister(SPI_IRQn, &pstcAsync->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcAsync->SPIx       = SPIx;
+        pstcAsync->pstcHead   = NULL;
+        pstcAsync->pstcTail   = NULL;
+        pstcAsync->u32Mode    = READ_REG32(SPIx->CR0) & SPI_ASYNC_MODE_MSK;
+        pstcAsync->u32Pending = 0u;
+        pstcAsync->u32XferCnt = 0u;
+        pstcAsync->u32OvfCnt  = 0u;
+
+        SPI_IntDisable(SPIx, SPI_INT_TXE | SPI_INT_RXNE);
+        SPI_Enable(SPIx);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  SPI异步事务队列停止：禁止中断并注销中断回调，等待已写入的数据发送完后释放片选，
+ *         未完成的事务以SPI_XFER_STS_ABORT结束（不调用完成回调）
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+void SPI_AsyncDeInit(stc_spi_async_t *pstcAsync)
+{
+    stc_spi_xfer_t *pstcXfer;
+    uint32_t        u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    SPI_IntDisable(pstcAsync->SPIx, SPI_INT_RXNE);
+    (void)INT_CallbackUnregister(SPI_IRQn, &pstcAsync->stcIntCb);
+
+    pstcXfer = pstcAsync->pstcHead;
+    if (NULL != pstcXfer)
+    {
+        while (TRUE == pstcAsync->SPIx->SR_f.BUSY) {}
+        (void)pstcAsync->SPIx->DR;
+        if (NULL != pstcXfer->CSx)
         {
-            if (0x0u == u32Timeout--)
-            {
-                return ErrorTimeout; /* 等待超时 */
-            }
+            WRITE_REG32(pstcXfer->CSx->BSET, pstcXfer->u32CsPin);
         }
+    }
+    while (NULL != pstcXfer)
+    {
+        pstcXfer->u32Status = SPI_XFER_STS_ABORT;
+        pstcXfer            = pstcXfer->pstcNext;
+    }
+    pstcAsync->pstcHead   = NULL;
+    pstcAsync->pstcTail   = NULL;
+    pstcAsync->u32Pending = 0u;
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  提交SPI异步事务：队列空闲时立即开始，否则排在队尾，前一事务完成后在中断中紧接着开始
+ * @note   函数立即返回。事务按段顺序收发：发送最多领先接收一个字，每个接收中断读出一个字并写入下一个字，
+ *         帧间总线不空闲；最后一个字接收完成后释放片选、开始下一个事务，再调用本事务的完成回调
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @param  [in] pstcXfer 事务描述 @ref stc_spi_xfer_t
+ * @retval en_result_t
+ *           - Ok: 已提交
+ *           - ErrorInvalidParameter: 参数错误或总字数为0
+ *           - ErrorNotReady: 该事务已在队列中
+ */
+en_result_t SPI_AsyncSubmit(stc_spi_async_t *pstcAsync, stc_spi_xfer_t *pstcXfer)
+{
+    uint32_t u32Primask;
+    uint32_t u32Len = 0u;
+    uint32_t i;
+
+    if ((NULL == pstcAsync) || (NULL == pstcXfer) || (NULL == pstcXfer->pstcSeg))
+    {
+        return ErrorInvalidParameter;
+    }
+    for (i = 0u; i < pstcXfer->u8SegNum; i++)
+    {
+        u32Len += pstcXfer->pstcSeg[i].u16Len;
+    }
+    if (0u == u32Len)
+    {
+        return ErrorInvalidParameter;
+    }
 
-        SPIx->DR = pu16SendBuf[u32Index];
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
 
-        while (FALSE == SPIx->SR_f.RXNE)
+    if (0u != (pstcXfer->u32Status & (SPI_XFER_STS_QUEUED | SPI_XFER_STS_ACTIVE)))
+    {
+        if (0u == u32Primask)
         {
-            if (0x0u == u32Timeout--)
-            {
-                return ErrorTimeout; /* 等待超时 */
-            }
+            __enable_irq();
         }
+        return ErrorNotReady;
+    }
 
-        pu16RecBuf[u32Index] = (uint16_t)SPIx->DR;
+    pstcXfer->pstcNext  = NULL;
+    pstcXfer->u32Status = SPI_XFER_STS_QUEUED;
+    pstcAsync->u32Pending++;
+    if (NULL == pstcAsync->pstcHead)
+    {
+        pstcAsync->pstcHead = pstcXfer;
+        pstcAsync->pstcTail = pstcXfer;
+        SPI_AsyncStart(pstcAsync);
+        SPI_IntEnable(pstcAsync->SPIx, SPI_INT_RXNE);
+    }
+    else
+    {
+        pstcAsync->pstcTail->pstcNext = pstcXfer;
+        pstcAsync->pstcTail           = pstcXfer;
     }
 
-    while (FALSE == SPIx->SR_f.TXE)
+    if (0u == u32Primask)
     {
-        if (0x0u == u32Timeout--)
+        __enable_irq();
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  中止全部SPI异步事务：等待已写入的数据发送完后释放片选，
+ *         未完成的事务依次以SPI_XFER_STS_ABORT调用完成回调
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+void SPI_AsyncAbort(stc_spi_async_t *pstcAsync)
+{
+    stc_spi_xfer_t *pstcXfer;
+    stc_spi_xfer_t *pstcNext;
+    uint32_t        u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    SPI_IntDisable(pstcAsync->SPIx, SPI_INT_RXNE);
+    pstcXfer = pstcAsync->pstcHead;
+    if (NULL != pstcXfer)
+    {
+        while (TRUE == pstcAsync->SPIx->SR_f.BUSY) {}
+        (void)pstcAsync->SPIx->DR;
+        if (NULL != pstcXfer->CSx)
         {
-            return ErrorTimeout; /* 等待超时 */
+            WRITE_REG32(pstcXfer->CSx->BSET, pstcXfer->u32CsPin);
+        }
+    }
+    pstcAsync->pstcHead   = NULL;
+    pstcAsync->pstcTail   = NULL;
+    pstcAsync->u32Pending = 0u;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    /* 已从队列摘下，回调中可重新提交 */
+    while (NULL != pstcXfer)
+    {
+        pstcNext            = pstcXfer->pstcNext;
+        pstcXfer->pstcNext  = NULL;
+        pstcXfer->u32Status = SPI_XFER_STS_ABORT;
+        if (NULL != pstcXfer->pfnDone)
+        {
+            pstcXfer->pfnDone(pstcXfer, SPI_XFER_STS_ABORT, pstcXfer->pvArg);
         }
+        pstcXfer = pstcNext;
+    }
+}
+
+/**
+ * @brief  未完成的SPI异步事务数
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval uint32_t 队列中的事务数（含正在传输的事务），0为空闲
+ */
+uint32_t SPI_AsyncPendingGet(const stc_spi_async_t *pstcAsync)
+{
+    return pstcAsync->u32Pending;
+}
+
+/**
+ * @brief  SPI从机双缓冲配置初始化：缓冲为NULL、长度0、填充值0xFFFF、无回调
+ * @param  [in] pstcInit 配置 @ref stc_spi_slave_init_t
+ * @retval None
+ */
+void SPI_SlaveStreamStcInit(stc_spi_slave_init_t *pstcInit)
+{
+    pstcInit->apvRx[0] = NULL;
+    pstcInit->apvRx[1] = NULL;
+    pstcInit->apvTx[0] = NULL;
+    pstcInit->apvTx[1] = NULL;
+    pstcInit->u16Size  = 0u;
+    pstcInit->u16Fill  = 0xFFFFu;
+    pstcInit->pfnDone  = NULL;
+    pstcInit->pvArg    = NULL;
+}
+
+/**
+ * @brief  SPI从机双缓冲收发初始化：每次片选（NSS低电平期间）收发一个缓冲，NSS上升沿中断中把收满的缓冲
+ *         交给应用、切换到另一个缓冲并预装其发送数据，应用处理前一个缓冲时另一个缓冲继续接收
+ * @note   调用前以SPI_Init()配置为从机模式（NSS由管脚输入），须在NSS无效时调用。
+ *         接收中断中每读出一个字即补充一个发送字，发送数据始终领先两个字（移位寄存器与发送缓冲）；
+ *         中断响应超过一帧时间时接收上溢，计数并在状态中报告，不会使后续数据错位。
+ *         两个缓冲都未归还时该次片选的数据丢弃并计数。片选无效的时间须大于中断响应时间
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @param  [in] pstcInit 配置 @ref stc_spi_slave_init_t
+ * @param  [in] enLevel 中断优先级 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorInvalidMode: 非从机模式或控制块已在使用
+ *           - ErrorNotReady: NSS有效（主机正在传输）
+ */
+en_result_t SPI_SlaveStreamInit(SPI_TypeDef *SPIx, stc_spi_slave_t *pstcSlave, const stc_spi_slave_init_t *pstcInit,
+                                en_irq_priority_level_t enLevel)
+{
+    uint32_t    u32Primask;
+    en_result_t enRet;
+
+    if ((NULL == pstcSlave) || (NULL == pstcInit) || (NULL == pstcInit->apvRx[0]) || (NULL == pstcInit->apvRx[1]) ||
+        (0u == pstcInit->u16Size))
+    {
+        return ErrorInvalidParameter;
+    }
+    if (0u != READ_REG32_BIT(SPIx->CR0, SPI_CR0_MSTR_Msk))
+    {
+        return ErrorInvalidMode;
     }
-    while (TRUE == SPIx->SR_f.BUSY)
+    if (SPI_NSS_EXTERN_INPUT_LOW_LEVEL == SPI_NSSExternInputGet(SPIx))
     {
-        if (0x0u == u32Timeout--)
+        return ErrorNotReady;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pstcSlave->stcIntCb.pfnCallback = SPI_SlaveIrqCallback;
+    pstcSlave->stcIntCb.pvArg       = pstcSlave;
+    pstcSlave->stcIntCb.u32SrcMask  = SPI_FLAG_RXNE | SPI_FLAG_SSR;
+    enRet                           = INT_CallbackRegister(SPI_IRQn, &pstcSlave->stcIntCb, enLevel);
+    if (Ok == enRet)
+    {
+        pstcSlave->SPIx        = SPIx;
+        pstcSlave->apvRx[0]    = pstcInit->apvRx[0];
+        pstcSlave->apvRx[1]    = pstcInit->apvRx[1];
+        pstcSlave->apvTx[0]    = pstcInit->apvTx[0];
+        pstcSlave->apvTx[1]    = pstcInit->apvTx[1];
+        pstcSlave->u16Size     = pstcInit->u16Size;
+        pstcSlave->u16Fill     = pstcInit->u16Fill;
+        pstcSlave->b16Bit      = (READ_REG32_BIT(SPIx->CR0, SPI_CR0_WIDTH_Msk) > SPI_DATA_WIDTH_8BIT) ? TRUE : FALSE;
+        pstcSlave->u8Cur       = 0u;
+        pstcSlave->u8Owned     = 0u;
+        pstcSlave->pfnDone     = pstcInit->pfnDone;
+        pstcSlave->pvArg       = pstcInit->pvArg;
+        pstcSlave->u32FrameCnt = 0u;
+        pstcSlave->u32DropCnt  = 0u;
+        pstcSlave->u32OvfCnt   = 0u;
+        pstcSlave->u32UdfCnt   = 0u;
+
+        SPI_IntDisable(SPIx, SPI_INT_TXE | SPI_INT_RXNE | SPI_INT_SSF | SPI_INT_SSR);
+        SPI_Disable(SPIx);
+        SPI_Enable(SPIx);
+        if (TRUE == SPIx->SR_f.RXNE)
         {
-            return ErrorTimeout; /* 等待超时 */
+            (void)SPIx->DR;
         }
+        SPI_FlagClearALL(SPIx);
+        SPI_SlavePreload(pstcSlave);
+        SPI_IntEnable(SPIx, SPI_INT_RXNE | SPI_INT_SSR);
     }
 
-    return Ok;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  SPI从机双缓冲收发停止：禁止中断、注销中断回调并禁止SPI（丢弃已预装的发送数据）
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @retval None
+ */
+void SPI_SlaveStreamDeInit(stc_spi_slave_t *pstcSlave)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    SPI_IntDisable(pstcSlave->SPIx, SPI_INT_RXNE | SPI_INT_SSR);
+    (void)INT_CallbackUnregister(SPI_IRQn, &pstcSlave->stcIntCb);
+    SPI_Disable(pstcSlave->SPIx);
+    pstcSlave->u8Owned = 0u;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief  归还已处理的缓冲：之后该缓冲可再次接收，其发送缓冲可在归还前更新
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @param  [in] u8Buf 缓冲下标（完成回调的u8Buf）
+ * @retval en_result_t
+ *           - Ok: 成功
+ *           - ErrorInvalidParameter: u8Buf错误
+ *           - ErrorInvalidMode: 该缓冲未交给应用
+ */
+en_result_t SPI_SlaveStreamRelease(stc_spi_slave_t *pstcSlave, uint8_t u8Buf)
+{
+    uint32_t    u32Primask;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcSlave) || (u8Buf > 1u))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (0u == (pstcSlave->u8Owned & (1u << u8Buf)))
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else
+    {
+        pstcSlave->u8Owned &= (uint8_t)~(1u << u8Buf);
+    }
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
 }
 
 /**
@@ -466,6 +975,489 @@ void SPI_StcInit(stc_spi_init_t *pstcInit)
     pstcInit->u32NSS         = SPI_NSS_HARD_INPUT;
     pstcInit->u32SampleDelay = SPI_SAMPLE_NORMAL;
 }
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPI_Local_Functions SPI局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  SPI 从机预准备第一个数据，超时由截止时间判断
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] u16Data 预准备第一个数据
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t
+ * @retval en_result_t
+ *           - Ok 从机预准备第一个数据成功
+ *           - ErrorTimeout 等待超时
+ */
+static en_result_t SPI_SlaveDummyDataTransmitDeadline(SPI_TypeDef *SPIx, uint16_t u16Data, stc_ddl_deadline_t *pstcDeadline)
+{
+    while (FALSE == SPIx->SR_f.TXE)
+    {
+        if (DDL_DeadlineExpired(pstcDeadline))
+        {
+            return ErrorTimeout; /* 等待超时 */
+        }
+    }
+    SPIx->DR = u16Data;
+    return Ok;
+}
+
+/**
+ * @brief  SPI 主机流水线收发：发送最多领先接收一个字（移位寄存器 + 发送缓冲各一个），帧间总线不空闲
+ * @note   接收缓冲须在下一帧移位完成前读出；被中断抢占超过一帧时间时接收上溢，被覆盖的字跳过其位置
+ *         （不写入），收发完成后返回Error
+ * @param  [in] SPIx SPI结构体 @ref SPI_TypeDef
+ * @param  [in] pvTx 发送数据，为NULL时发送u16Fill
+ * @param  [out] pvRx 接收数据，为NULL时丢弃（不报告上溢）
+ * @param  [in] u32Len 数据长度（字数）
+ * @param  [in] u16Fill 无发送数据时的填充值
+ * @param  [in] b16Bit TRUE: 缓冲为uint16_t；FALSE: 缓冲为uint8_t
+ * @param  [in] pstcDeadline 截止时间 @ref stc_ddl_deadline_t，为NULL时永不超时
+ * @retval en_result_t
+ *         - Ok 收发完成（总线空闲）
+ *         - Error 接收上溢，有接收数据丢失
+ *         - ErrorTimeout 等待超时
+ */
+static en_result_t SPI_PipeXfer(SPI_TypeDef *SPIx, const void *pvTx, void *pvRx, uint32_t u32Len, uint16_t u16Fill,
+                                boolean_t b16Bit, stc_ddl_deadline_t *pstcDeadline)
+{
+    const uint8_t     *pu8Tx  = (const uint8_t *)pvTx;
+    const uint16_t    *pu16Tx = (const uint16_t *)pvTx;
+    uint8_t           *pu8Rx  = (uint8_t *)pvRx;
+    uint16_t          *pu16Rx = (uint16_t *)pvRx;
+    uint32_t           u32TxCnt = 0u;
+    uint32_t           u32RxCnt = 0u;
+    uint32_t           u32Sr;
+    uint16_t           u16Data;
+    boolean_t          bOvf = FALSE;
+
+    /* 丢弃之前残留的接收数据，否则第一帧即上溢且收发计数错位 */
+    if (0u != (SPIx->SR & SPI_SR_RXNE_Msk))
+    {
+        (void)SPIx->DR;
+    }
+    SPI_FlagClear(SPIx, SPI_FLAG_OVF);
+
+    while (u32RxCnt < u32Len)
+    {
+        u32Sr = SPIx->SR;
+
+        if ((u32TxCnt < u32Len) && ((u32TxCnt - u32RxCnt) < 2u) && (0u != (u32Sr & SPI_SR_TXE_Msk)))
+        {
+            if (NULL == pvTx)
+            {
+                u16Data = u16Fill;
+            }
+            else
+            {
+                u16Data = (TRUE == b16Bit) ? pu16Tx[u32TxCnt] : pu8Tx[u32TxCnt];
+            }
+            SPIx->DR = u16Data;
+            u32TxCnt++;
+        }
+        else if (0u != (u32Sr & SPI_SR_RXNE_Msk))
+        {
+            u16Data = (uint16_t)SPIx->DR;
+            if ((0u != (u32Sr & SPI_SR_OVF_Msk)) && ((u32TxCnt - u32RxCnt) > 1u))
+            {
+                /* 读出前下一帧已移位完成：前一个字被覆盖，跳过其位置 */
+                SPI_FlagClear(SPIx, SPI_FLAG_OVF);
+                bOvf = TRUE;
+                u32RxCnt++;
+            }
+            if (NULL != pvRx)
+            {
+                if (TRUE == b16Bit)
+                {
+                    pu16Rx[u32RxCnt] = u16Data;
+                }
+                else
+                {
+                    pu8Rx[u32RxCnt] = (uint8_t)u16Data;
+                }
+            }
+            u32RxCnt++;
+        }
+        else if ((NULL != pstcDeadline) && (TRUE == DDL_DeadlineExpired(pstcDeadline)))
+        {
+            return ErrorTimeout; /* 等待超时 */
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    while (0u != (SPIx->SR & SPI_SR_BUSY_Msk))
+    {
+        if ((NULL != pstcDeadline) && (TRUE == DDL_DeadlineExpired(pstcDeadline)))
+        {
+            return ErrorTimeout; /* 等待超时 */
+        }
+    }
+
+    /* 读状态与读数据之间发生的上溢 */
+    if (0u != (SPIx->SR & SPI_SR_OVF_Msk))
+    {
+        SPI_FlagClear(SPIx, SPI_FLAG_OVF);
+        bOvf = TRUE;
+    }
+
+    return ((TRUE == bOvf) && (NULL != pvRx)) ? Error : Ok;
+}
+
+/**
+ * @brief  开始队首事务：切换模式、片选置低、写入前两个字（关中断或SPI中断中调用）
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+static void SPI_AsyncStart(stc_spi_async_t *pstcAsync)
+{
+    stc_spi_xfer_t *pstcXfer = pstcAsync->pstcHead;
+    SPI_TypeDef    *SPIx     = pstcAsync->SPIx;
+    uint32_t        u32Mode;
+    uint32_t        u32Len = 0u;
+    uint32_t        i;
+
+    u32Mode = pstcXfer->u32BaudRate | pstcXfer->u32CPOL | pstcXfer->u32CPHA | pstcXfer->u32DataWidth;
+    if (u32Mode != pstcAsync->u32Mode)
+    {
+        SPI_BaudRateSet(SPIx, pstcXfer->u32BaudRate);
+        SPI_ClockPolaritySet(SPIx, pstcXfer->u32CPOL);
+        SPI_ClockPhaseSet(SPIx, pstcXfer->u32CPHA);
+        SPI_DataWidthSet(SPIx, pstcXfer->u32DataWidth);
+        pstcAsync->u32Mode = u32Mode;
+    }
+
+    for (i = 0u; i < pstcXfer->u8SegNum; i++)
+    {
+        u32Len += pstcXfer->pstcSeg[i].u16Len;
+    }
+    pstcAsync->b16Bit    = (pstcXfer->u32DataWidth > SPI_DATA_WIDTH_8BIT) ? TRUE : FALSE;
+    pstcAsync->u8TxSeg   = 0u;
+    pstcAsync->u8RxSeg   = 0u;
+    pstcAsync->u16TxPos  = 0u;
+    pstcAsync->u16RxPos  = 0u;
+    pstcAsync->u32TxLeft = u32Len;
+    pstcAsync->u32RxLeft = u32Len;
+    pstcXfer->u32Status  = SPI_XFER_STS_ACTIVE;
+
+    if (NULL != pstcXfer->CSx)
+    {
+        WRITE_REG32(pstcXfer->CSx->BCLR, pstcXfer->u32CsPin);
+    }
+    /* 丢弃残留的接收数据及上溢标志，否则收发计数错位 */
+    if (TRUE == SPIx->SR_f.RXNE)
+    {
+        (void)SPIx->DR;
+    }
+    SPI_FlagClear(SPIx, SPI_FLAG_OVF);
+
+    SPI_AsyncTxFill(pstcAsync);
+}
+
+/**
+ * @brief  写入发送数据，使在途的字数（已写入未接收）达到2：移位寄存器与发送缓冲各一个
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+static void SPI_AsyncTxFill(stc_spi_async_t *pstcAsync)
+{
+    const stc_spi_xfer_t *pstcXfer = pstcAsync->pstcHead;
+    const stc_spi_seg_t  *pstcSeg;
+    SPI_TypeDef          *SPIx = pstcAsync->SPIx;
+    uint32_t              u32InFlight;
+    uint16_t              u16Data;
+
+    while (0u != pstcAsync->u32TxLeft)
+    {
+        u32InFlight = pstcAsync->u32RxLeft - pstcAsync->u32TxLeft;
+        if ((u32InFlight >= 2u) || ((1u == u32InFlight) && (FALSE == SPIx->SR_f.TXE)))
+        {
+            break;
+        }
+
+        pstcSeg = &pstcXfer->pstcSeg[pstcAsync->u8TxSeg];
+        while (pstcAsync->u16TxPos >= pstcSeg->u16Len)
+        {
+            pstcAsync->u8TxSeg++;
+            pstcAsync->u16TxPos = 0u;
+            pstcSeg++;
+        }
+
+        if (NULL == pstcSeg->pvTx)
+        {
+            u16Data = pstcXfer->u16Fill;
+        }
+        else if (TRUE == pstcAsync->b16Bit)
+        {
+            u16Data = ((const uint16_t *)pstcSeg->pvTx)[pstcAsync->u16TxPos];
+        }
+        else
+        {
+            u16Data = ((const uint8_t *)pstcSeg->pvTx)[pstcAsync->u16TxPos];
+        }
+        SPIx->DR = u16Data;
+        pstcAsync->u16TxPos++;
+        pstcAsync->u32TxLeft--;
+    }
+}
+
+/**
+ * @brief  保存一个接收字到当前接收数据段
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @param  [in] u16Data 接收数据
+ * @param  [in] bStore FALSE: 只跳过该位置（上溢丢失的字）
+ * @retval None
+ */
+static void SPI_AsyncRxStore(stc_spi_async_t *pstcAsync, uint16_t u16Data, boolean_t bStore)
+{
+    const stc_spi_seg_t *pstcSeg = &pstcAsync->pstcHead->pstcSeg[pstcAsync->u8RxSeg];
+
+    while (pstcAsync->u16RxPos >= pstcSeg->u16Len)
+    {
+        pstcAsync->u8RxSeg++;
+        pstcAsync->u16RxPos = 0u;
+        pstcSeg++;
+    }
+
+    if ((TRUE == bStore) && (NULL != pstcSeg->pvRx))
+    {
+        if (TRUE == pstcAsync->b16Bit)
+        {
+            ((uint16_t *)pstcSeg->pvRx)[pstcAsync->u16RxPos] = u16Data;
+        }
+        else
+        {
+            ((uint8_t *)pstcSeg->pvRx)[pstcAsync->u16RxPos] = (uint8_t)u16Data;
+        }
+    }
+    pstcAsync->u16RxPos++;
+    pstcAsync->u32RxLeft--;
+}
+
+/**
+ * @brief  队首事务完成：释放片选、开始下一个事务，再调用完成回调
+ * @param  [in] pstcAsync 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+static void SPI_AsyncFinish(stc_spi_async_t *pstcAsync)
+{
+    stc_spi_xfer_t *pstcXfer  = pstcAsync->pstcHead;
+    uint32_t        u32Status = pstcXfer->u32Status & SPI_XFER_STS_OVF;
+
+    /* 最后一帧已接收，BUSY在最后一个时钟沿后撤销 */
+    while (TRUE == pstcAsync->SPIx->SR_f.BUSY) {}
+    if (NULL != pstcXfer->CSx)
+    {
+        WRITE_REG32(pstcXfer->CSx->BSET, pstcXfer->u32CsPin);
+    }
+
+    pstcAsync->pstcHead = pstcXfer->pstcNext;
+    if (NULL == pstcAsync->pstcHead)
+    {
+        pstcAsync->pstcTail = NULL;
+        SPI_IntDisable(pstcAsync->SPIx, SPI_INT_RXNE);
+    }
+    else
+    {
+        SPI_AsyncStart(pstcAsync);
+    }
+    pstcAsync->u32Pending--;
+    pstcAsync->u32XferCnt++;
+
+    pstcXfer->pstcNext  = NULL;
+    pstcXfer->u32Status = u32Status;
+    if (NULL != pstcXfer->pfnDone)
+    {
+        pstcXfer->pfnDone(pstcXfer, u32Status, pstcXfer->pvArg);
+    }
+}
+
+/**
+ * @brief  SPI接收中断回调：读出一个字、补充发送，事务的字全部收到后结束该事务
+ * @param  [in] u32Flags 中断源标志（SR）
+ * @param  [in] pvArg 控制块 @ref stc_spi_async_t
+ * @retval None
+ */
+static void SPI_AsyncIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_spi_async_t *pstcAsync = (stc_spi_async_t *)pvArg;
+    uint16_t         u16Data;
+
+    if (NULL == pstcAsync->pstcHead)
+    {
+        return;
+    }
+
+    u16Data = (uint16_t)pstcAsync->SPIx->DR;
+    if ((0u != (u32Flags & SPI_FLAG_OVF)) && (pstcAsync->u32RxLeft > 1u))
+    {
+        /* 中断响应超过一帧时间：前一个字被覆盖，跳过其位置 */
+        SPI_FlagClear(pstcAsync->SPIx, SPI_FLAG_OVF);
+        pstcAsync->u32OvfCnt++;
+        pstcAsync->pstcHead->u32Status |= SPI_XFER_STS_OVF;
+        SPI_AsyncRxStore(pstcAsync, 0u, FALSE);
+    }
+    SPI_AsyncRxStore(pstcAsync, u16Data, TRUE);
+    SPI_AsyncTxFill(pstcAsync);
+
+    if (0u == pstcAsync->u32RxLeft)
+    {
+        SPI_AsyncFinish(pstcAsync);
+    }
+}
+
+/**
+ * @brief  补充发送数据，使在途的字数（已写入DR未收到）达到2
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @param  [in] u32Sr 最近读取的SR
+ * @retval None
+ */
+static void SPI_SlaveTxFill(stc_spi_slave_t *pstcSlave, uint32_t u32Sr)
+{
+    const void *pvTx = pstcSlave->apvTx[pstcSlave->u8Cur];
+    uint32_t    u32Pos;
+    uint16_t    u16Data;
+
+    while ((pstcSlave->u32TxPos < (pstcSlave->u32RxPos + 2u)) && (0u != (u32Sr & SPI_SR_TXE_Msk)))
+    {
+        u32Pos = pstcSlave->u32TxPos;
+        if ((NULL == pvTx) || (u32Pos >= pstcSlave->u16Size))
+        {
+            u16Data = pstcSlave->u16Fill;
+        }
+        else if (TRUE == pstcSlave->b16Bit)
+        {
+            u16Data = ((const uint16_t *)pvTx)[u32Pos];
+        }
+        else
+        {
+            u16Data = ((const uint8_t *)pvTx)[u32Pos];
+        }
+        pstcSlave->SPIx->DR = u16Data;
+        pstcSlave->u32TxPos = u32Pos + 1u;
+        u32Sr               = READ_REG32(pstcSlave->SPIx->SR);
+    }
+}
+
+/**
+ * @brief  开始新的片选：收发位置清零，预装当前缓冲的前两个发送字
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @retval None
+ */
+static void SPI_SlavePreload(stc_spi_slave_t *pstcSlave)
+{
+    pstcSlave->u32RxPos  = 0u;
+    pstcSlave->u32TxPos  = 0u;
+    pstcSlave->u32Status = SPI_SLAVE_STS_OK;
+    SPI_SlaveTxFill(pstcSlave, SPI_SR_TXE_Msk);
+}
+
+/**
+ * @brief  NSS上升沿：交出当前缓冲并切换到另一个缓冲（另一个缓冲未归还时丢弃本次数据），清空并预装发送数据
+ * @param  [in] pstcSlave 控制块 @ref stc_spi_slave_t
+ * @retval None
+ */
+static void SPI_SlaveFrameEnd(stc_spi_slave_t *pstcSlave)
+{
+    SPI_TypeDef *SPIx   = pstcSlave->SPIx;
+    uint8_t      u8Done = pstcSlave->u8Cur;
+    uint32_t     u32Status;
+    uint16_t     u16Len;
+
+    SPI_FlagClear(SPIx, SPI_FLAG_SSR | SPI_FLAG_SSF);
+    if (TRUE == SPIx->SR_f.UDF)
+    {
+        SPI_FlagClear(SPIx, SPI_FLAG_UDF);
+        pstcSlave->u32UdfCnt++;
+        pstcSlave->u32Status |= SPI_SLAVE_STS_UDF;
+    }
+    if (0u == pstcSlave->u32RxPos)
+    {
+        return; /* 片选期间无时钟 */
+    }
+
+    /* 预装而未发出的字留在移位寄存器及发送缓冲中，关闭再使能SPI清空 */
+    SPI_Disable(SPIx);
+    SPI_Enable(SPIx);
+
+    u32Status = pstcSlave->u32Status;
+    u16Len    = (pstcSlave->u32RxPos < pstcSlave->u16Size) ? (uint16_t)pstcSlave->u32RxPos : pstcSlave->u16Size;
+    if (0u != (pstcSlave->u8Owned & (1u << (u8Done ^ 1u))))
+    {
+        pstcSlave->u32DropCnt++;
+        SPI_SlavePreload(pstcSlave);
+        return;
+    }
+    pstcSlave->u8Owned |= (uint8_t)(1u << u8Done);
+    pstcSlave->u8Cur = u8Done ^ 1u;
+    pstcSlave->u32FrameCnt++;
+    SPI_SlavePreload(pstcSlave);
+
+    if (NULL != pstcSlave->pfnDone)
+    {
+        pstcSlave->pfnDone(u8Done, u16Len, u32Status, pstcSlave->pvArg);
+    }
+}
+
+/**
+ * @brief  SPI从机中断回调：读出全部已接收的字并补充发送，NSS上升沿时交出缓冲
+ * @param  [in] u32Flags 中断源标志（SR）
+ * @param  [in] pvArg 控制块 @ref stc_spi_slave_t
+ * @retval None
+ */
+static void SPI_SlaveIrqCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_spi_slave_t *pstcSlave = (stc_spi_slave_t *)pvArg;
+    SPI_TypeDef     *SPIx      = pstcSlave->SPIx;
+    void            *pvRx      = pstcSlave->apvRx[pstcSlave->u8Cur];
+    uint32_t         u32Sr     = READ_REG32(SPIx->SR);
+    uint32_t         u32Pos;
+    uint16_t         u16Data;
+
+    (void)u32Flags;
+
+    while (0u != (u32Sr & SPI_SR_RXNE_Msk))
+    {
+        u32Pos = pstcSlave->u32RxPos;
+        if (0u != (u32Sr & SPI_SR_OVF_Msk))
+        {
+            /* 前一个字被覆盖：跳过其位置，保持其余数据位置不变 */
+            SPI_FlagClear(SPIx, SPI_FLAG_OVF);
+            pstcSlave->u32OvfCnt++;
+            pstcSlave->u32Status |= SPI_SLAVE_STS_OVF;
+            u32Pos++;
+        }
+        u16Data = (uint16_t)SPIx->DR;
+        if (u32Pos >= pstcSlave->u16Size)
+        {
+            pstcSlave->u32Status |= SPI_SLAVE_STS_TRUNC;
+        }
+        else if (TRUE == pstcSlave->b16Bit)
+        {
+            ((uint16_t *)pvRx)[u32Pos] = u16Data;
+        }
+        else
+        {
+            ((uint8_t *)pvRx)[u32Pos] = (uint8_t)u16Data;
+        }
+        pstcSlave->u32RxPos = u32Pos + 1u;
+
+        SPI_SlaveTxFill(pstcSlave, u32Sr);
+        u32Sr = READ_REG32(SPIx->SR);
+    }
+
+    if (0u != (u32Sr & SPI_SR_SSR_Msk))
+    {
+        SPI_SlaveFrameEnd(pstcSlave);
+    }
+}
+
 /**
  * @}
  */
@@ -47,16 +47,16 @@
 /**
  * @brief  RCL Trim值
  */
-#define RCL_CR_TRIM_38400_VAL (*((volatile uint16_t *)(0x001007ACul)))
-#define RCL_CR_TRIM_32768_VAL (*((volatile uint16_t *)(0x001007A8ul)))
+#define RCL_CR_TRIM_38400_VAL RW_MEM16(0x001007ACul)
+#define RCL_CR_TRIM_32768_VAL RW_MEM16(0x001007A8ul)
 
 /**
  * @brief  RC48M Trim值
  */
-#define RC48M_CR_TRIM_48M_VAL (*((volatile uint32_t *)(0x001007B0ul)))
-#define RC48M_CR_TRIM_32M_VAL (*((volatile uint32_t *)(0x001007B4ul)))
-#define RC48M_CR_TRIM_6M_VAL  (*((volatile uint32_t *)(0x001007B8ul)))
-#define RC48M_CR_TRIM_4M_VAL  (*((volatile uint32_t *)(0x001007BCul)))
+#define RC48M_CR_TRIM_48M_VAL RW_MEM32(0x001007B0ul)
+#define RC48M_CR_TRIM_32M_VAL RW_MEM32(0x001007B4ul)
+#define RC48M_CR_TRIM_6M_VAL  RW_MEM32(0x001007B8ul)
+#define RC48M_CR_TRIM_4M_VAL  RW_MEM32(0x001007BCul)
 
 /**
  * @brief  Clock时钟源切换选择
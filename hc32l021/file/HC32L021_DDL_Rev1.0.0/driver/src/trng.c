@@ -83,7 +83,7 @@
  * @defgroup TRNG_Timeout TRNG超时时间
  * @{
  */
-#define TRNG_TIMEOUT 0xFFFFu
+#define TRNG_TIMEOUT (10000u) /*!< 随机数生成超时时间（us） */
 /**
  * @}
  */
@@ -116,7 +116,7 @@
  */
 en_result_t TRNG_Init(void)
 {
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
 
     /* 生成64bits随机数(上电第一次) */
     SET_REG32_BIT(TRNG->CR, TRNG_CR_RNGCIR_EN_Msk);
@@ -126,10 +126,10 @@ en_result_t TRNG_Init(void)
 
     /* 生成随机数0 */
     SET_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk);
-    u32Timeout = TRNG_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, TRNG_TIMEOUT);
     while (READ_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -139,10 +139,10 @@ en_result_t TRNG_Init(void)
     MODIFY_REG32(TRNG->MODE, TRNG_MODE_LOAD_Msk | TRNG_MODE_FDBK_Msk | TRNG_MODE_CNT_Msk, TRNG_LOAD_DISABLE | TRNG_FDBK_XOR_DISABLE | TRNG_SHIFT_TIMES_64);
     /* 生成随机数1 */
     SET_REG_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk);
-    u32Timeout = TRNG_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, TRNG_TIMEOUT);
     while (READ_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -162,7 +162,7 @@ en_result_t TRNG_Init(void)
  */
 en_result_t TRNG_Generate(void)
 {
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
 
     /* 生成64bits随机数(非上电第一次生成) */
     SET_REG32_BIT(TRNG->CR, TRNG_CR_RNGCIR_EN_Msk);
@@ -171,10 +171,10 @@ en_result_t TRNG_Generate(void)
     MODIFY_REG32(TRNG->MODE, TRNG_MODE_LOAD_Msk | TRNG_MODE_FDBK_Msk | TRNG_MODE_CNT_Msk, TRNG_LOAD_DISABLE | TRNG_FDBK_XOR_DISABLE | TRNG_SHIFT_TIMES_256);
     /* 生成随机数0 */
     SET_REG_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk);
-    u32Timeout = TRNG_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, TRNG_TIMEOUT);
     while (READ_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
@@ -184,10 +184,10 @@ en_result_t TRNG_Generate(void)
     MODIFY_REG32(TRNG->MODE, TRNG_MODE_FDBK_Msk | TRNG_MODE_CNT_Msk, TRNG_FDBK_XOR_DISABLE | TRNG_SHIFT_TIMES_64);
     /* 生成随机数1 */
     SET_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk);
-    u32Timeout = TRNG_TIMEOUT;
+    DDL_DeadlineInit(&stcDeadline, TRNG_TIMEOUT);
     while (READ_REG32_BIT(TRNG->CR, TRNG_CR_RNG_RUN_Msk))
     {
-        if (0 == u32Timeout--)
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
             return ErrorTimeout;
         }
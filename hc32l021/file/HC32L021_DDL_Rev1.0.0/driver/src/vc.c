@@ -64,9 +64,9 @@
  */
 en_result_t VC_Init(stc_vc_init_t *pstcVcInit)
 {
-    uint32_t u32BaseCR0 = (uint32_t)(&VC->VC0_CR0) + pstcVcInit->u32Ch;
-    uint32_t u32BaseCR1 = (uint32_t)(&VC->VC0_CR1) + pstcVcInit->u32Ch;
-    uint32_t u32BaseCR2 = (uint32_t)(&VC->VC0_CR2) + pstcVcInit->u32Ch;
+    uintptr_t u32BaseCR0 = (uintptr_t)(&VC->VC0_CR0) + pstcVcInit->u32Ch;
+    uintptr_t u32BaseCR1 = (uintptr_t)(&VC->VC0_CR1) + pstcVcInit->u32Ch;
+    uintptr_t u32BaseCR2 = (uintptr_t)(&VC->VC0_CR2) + pstcVcInit->u32Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseCR0, VC_VC0_CR0_BIAS_Msk | VC_VC0_CR0_HYS_Msk, pstcVcInit->u32BiasCurrent | pstcVcInit->u32HysVolt);
     MODIFY_REG32(*(volatile uint32_t *)u32BaseCR1,
@@ -88,7 +88,7 @@ en_result_t VC_Init(stc_vc_init_t *pstcVcInit)
  */
 void VC_Enable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR1) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR1) + u8Ch;
 
     SET_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR1_EN_Msk);
 }
@@ -100,7 +100,7 @@ void VC_Enable(uint8_t u8Ch)
  */
 void VC_Disable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR1) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR1) + u8Ch;
 
     CLR_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR1_EN_Msk);
 }
@@ -113,7 +113,7 @@ void VC_Disable(uint8_t u8Ch)
  */
 void VC_ResVoltDivConfig(uint8_t u8Ch, uint32_t u32RefVoltDiv)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR0) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR0) + u8Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR0_DIV_Msk, u32RefVoltDiv);
 }
@@ -144,7 +144,7 @@ void VC_ResVoltDivDisable(void)
  */
 void VC_IntModeConfig(uint8_t u8Ch, uint32_t u32IntMode)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR1) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR1) + u8Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR1_LEVEL_Msk | VC_VC0_CR1_RISING_Msk | VC_VC0_CR1_FALLING_Msk, u32IntMode);
 }
@@ -156,7 +156,7 @@ void VC_IntModeConfig(uint8_t u8Ch, uint32_t u32IntMode)
  */
 void VC_IntEnable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR1) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR1) + u8Ch;
 
     SET_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR1_IE_Msk);
 }
@@ -168,7 +168,7 @@ void VC_IntEnable(uint8_t u8Ch)
  */
 void VC_IntDisable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR1) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR1) + u8Ch;
 
     CLR_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR1_IE_Msk);
 }
@@ -182,7 +182,7 @@ void VC_IntDisable(uint8_t u8Ch)
  */
 boolean_t VC_IntFlagGet(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_SR) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_SR) + u8Ch;
 
     return READ_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_SR_INTF_Msk) ? TRUE : FALSE;
 }
@@ -194,7 +194,7 @@ boolean_t VC_IntFlagGet(uint8_t u8Ch)
  */
 void VC_IntFlagClear(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_SR) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_SR) + u8Ch;
 
     CLR_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC1_SR_INTF_Msk);
 }
@@ -207,7 +207,7 @@ void VC_IntFlagClear(uint8_t u8Ch)
  */
 void VC_OutputAtimConfig(uint8_t u8Ch, uint32_t u32OutputAtimMode)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR2) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR2) + u8Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR2_ATIM3CLR_Msk | VC_VC0_CR2_ATIMBK_Msk, u32OutputAtimMode);
 }
@@ -220,7 +220,7 @@ void VC_OutputAtimConfig(uint8_t u8Ch, uint32_t u32OutputAtimMode)
  */
 void VC_BlankWindowConfig(uint8_t u8Ch, uint32_t u32BlankWindow)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR2) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR2) + u8Ch;
 
     MODIFY_REG32(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR2_BLANK_Msk, u32BlankWindow);
 }
@@ -232,7 +232,7 @@ void VC_BlankWindowConfig(uint8_t u8Ch, uint32_t u32BlankWindow)
  */
 void VC_WindowEnable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR2) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR2) + u8Ch;
 
     SET_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR2_WINDOW_Msk);
 }
@@ -244,7 +244,7 @@ void VC_WindowEnable(uint8_t u8Ch)
  */
 void VC_WindowDisable(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_CR2) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_CR2) + u8Ch;
 
     CLR_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_CR2_WINDOW_Msk);
 }
@@ -258,7 +258,7 @@ void VC_WindowDisable(uint8_t u8Ch)
  */
 boolean_t VC_FilterOutputGet(uint8_t u8Ch)
 {
-    uint32_t u32BaseAdress = (uint32_t)(&VC->VC0_SR) + u8Ch;
+    uintptr_t u32BaseAdress = (uintptr_t)(&VC->VC0_SR) + u8Ch;
 
     return READ_REG32_BIT(*(volatile uint32_t *)u32BaseAdress, VC_VC0_SR_FLTV_Msk) ? TRUE : FALSE;
 }
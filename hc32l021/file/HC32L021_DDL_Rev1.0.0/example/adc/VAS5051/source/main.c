@@ -32,6 +32,8 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+#define ADC_VREF_MV  (3300u) /* 参考电压AVCC（mV） */
+#define ADC_RES_BITS (12u)   /* ADC分辨率 */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
@@ -46,8 +48,8 @@ static void AdcConfig(void);
  ******************************************************************************/
 uint32_t AdcResult1;
 uint32_t AdcResult2;
-float VO;
-float IO;
+uint32_t VO; /* 电压（mV） */
+uint32_t IO; /* 电压（mV） */
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -77,8 +79,8 @@ int32_t main(void)
 		{
 				
 			DDL_Delay100us(1000);
-			IO = AdcResult1 *3.3 / 4096 ;
-			VO = AdcResult2 *3.3 / 4096 ;
+			IO = DDL_ROUND_SHR(AdcResult1 * ADC_VREF_MV, ADC_RES_BITS); /* 采样值 * 3.3V / 4096，整数运算 */
+			VO = DDL_ROUND_SHR(AdcResult2 * ADC_VREF_MV, ADC_RES_BITS);
 			DDL_Delay100us(1000);
 			IIC_WR(0x01,0xff);
 				
@@ -0,0 +1,1189 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides the per-API cycle benchmark of every public driver
+ *        function, timed by SysTick on target and by the simulated HCLK on the
+ *        host register model, and printed as a CSV table
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "adc.h"
+#include "atim3.h"
+#include "btim.h"
+#include "ctrim.h"
+#include "flash.h"
+#include "gpio.h"
+#include "gtim.h"
+#include "hsi2c.h"
+#include "iwdt.h"
+#include "lpuart.h"
+#include "lvd.h"
+#include "rtc.h"
+#include "spi.h"
+#include "sysctrl.h"
+#include "trng.h"
+#include "vc.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  单个API的测量结果
+ */
+typedef struct
+{
+    char     acApi[40]; /*!< API名称 */
+    uint32_t u32Min;    /*!< 最小周期 */
+    uint32_t u32Avg;    /*!< 平均周期 */
+    uint32_t u32Max;    /*!< 最大周期 */
+    uint32_t u32Read;   /*!< 每次调用的总线读次数（仅主机模型） */
+    uint32_t u32Write;  /*!< 每次调用的总线写次数（仅主机模型） */
+} stc_bench_result_t;
+
+/**
+ * @brief  当前API的采样累计
+ */
+typedef struct
+{
+    uint64_t u64Start; /*!< 本次调用起始时刻 */
+    uint64_t u64Read;  /*!< 本次调用起始读次数 */
+    uint64_t u64Write; /*!< 本次调用起始写次数 */
+    uint64_t u64Sum;   /*!< 周期累计 */
+    uint64_t u64RdSum; /*!< 读次数累计 */
+    uint64_t u64WrSum; /*!< 写次数累计 */
+    uint32_t u32Min;   /*!< 最小周期 */
+    uint32_t u32Max;   /*!< 最大周期 */
+} stc_bench_sample_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_NUM         (8u)     /* 每个API的调用次数 */
+#define BENCH_RESULT_MAX  (480u)   /* 结果表容量 */
+#define BENCH_TIMEOUT_US  (100u)   /* 带超时参数的API（无对端时走超时路径）的超时时间 */
+#define BENCH_TIMEOUT_CNT (400u)   /* 按查询次数计时的超时API的查询次数 */
+#define BENCH_FLASH_ADR   (0xFE00u) /* 扇区127 首地址，擦写测试区 */
+#define BENCH_BAUD        (9600u)
+
+#if defined(DDL_HOST_MODEL)
+#define BENCH_PLATFORM "host"
+#define BENCH_UNIT     "bus_cycle" /* 模型只对外设及SRAM访问计周期，CPU运算不计 */
+#else
+#define BENCH_PLATFORM    "target"
+#define BENCH_UNIT        "hclk_cycle"
+#define PUTCHAR_PROTOTYPE int fputc(int ch, FILE *f)
+#endif
+
+/**
+ * @brief  调用BENCH_NUM次并输出一行结果，API名称取自调用表达式
+ * @note   prep为每次调用前执行、不计时的准备语句；call中可使用循环变量u32Iter
+ */
+#define BENCH_PREP(prep, call)                                     \
+    do                                                             \
+    {                                                              \
+        uint32_t u32Iter;                                          \
+        for (u32Iter = 0u; u32Iter < BENCH_NUM; u32Iter++)         \
+        {                                                          \
+            prep;                                                  \
+            BenchBegin();                                          \
+            (void)(call);                                          \
+            BenchEnd();                                            \
+        }                                                          \
+        BenchReport(#call);                                        \
+    } while (0)
+
+#define BENCH(call) BENCH_PREP((void)0, call)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint64_t BenchStamp(void);
+static void     BenchBegin(void);
+static void     BenchEnd(void);
+static void     BenchReport(const char *pcCall);
+static void     BenchCalibrate(void);
+static const stc_bench_result_t *BenchResultFind(const char *pcApi);
+
+static void BenchDdl(void);
+static void BenchSysctrl(void);
+static void BenchGpio(void);
+static void BenchFlash(void);
+static void BenchAdc(void);
+static void BenchAtim3(void);
+static void BenchBtim(void);
+static void BenchGtim(void);
+static void BenchCtrim(void);
+static void BenchHsi2c(void);
+static void BenchIwdt(void);
+static void BenchLpuart(void);
+static void BenchLvd(void);
+static void BenchRtc(void);
+static void BenchSpi(void);
+static void BenchTrng(void);
+static void BenchVc(void);
+
+#if !defined(DDL_HOST_MODEL)
+static void PrintConfig(void);
+#endif
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t           u32ErrCnt = 0u;
+static uint32_t           m_u32Overhead;                      /* 空测量的周期（自每次结果中扣除） */
+static stc_bench_sample_t m_stcSample;
+static stc_bench_result_t m_astcResult[BENCH_RESULT_MAX];
+static uint32_t           m_u32ResultCnt = 0u;
+static uint8_t            m_au8Buf1[64];
+static uint8_t            m_au8Buf2[64];
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    const char *apcKeyApi[] = {"GPIO_Init",        "ADC_SqrResultGet", "SPI_TransmitReceive",    "LPUART_TransmitPoll",
+                               "FLASH_WriteWord",  "RTC_DateTimeRead", "HSI2C_MasterBaudRateSet"};
+    const stc_bench_result_t *pstcResult;
+    uint32_t                  u32Hclk = SystemCoreClock;
+    uint32_t                  i;
+
+#if !defined(DDL_HOST_MODEL)
+    PrintConfig();
+#endif
+
+    BenchCalibrate();
+    printf("# hc32l021 ddl api bench, platform=%s, hclk=%u, unit=%s, calls=%u, overhead=%u\n", BENCH_PLATFORM,
+           (unsigned)SystemCoreClock, BENCH_UNIT, (unsigned)BENCH_NUM, (unsigned)m_u32Overhead);
+#if defined(DDL_HOST_MODEL)
+    printf("# min/avg/max: bus access cycles only, empty for apis without bus accesses (cpu only, not measured)\n");
+#endif
+    printf("api,min,avg,max,reads,writes\n");
+
+    BenchDdl();
+    BenchSysctrl();
+    BenchGpio();
+    BenchFlash();
+    BenchAdc();
+    BenchAtim3();
+    BenchBtim();
+    BenchGtim();
+    BenchCtrim();
+    BenchHsi2c();
+    BenchIwdt();
+    BenchLpuart();
+    BenchLvd();
+    BenchRtc();
+    BenchSpi();
+    BenchTrng();
+    BenchVc();
+
+    printf("# %u apis\n", (unsigned)m_u32ResultCnt);
+
+    /* 结果表完整，HCLK在测试前后不变 */
+    CHECK(m_u32ResultCnt < BENCH_RESULT_MAX);
+    CHECK(u32Hclk == SystemCoreClock);
+    for (i = 0u; i < ARRAY_SZ(apcKeyApi); i++)
+    {
+        pstcResult = BenchResultFind(apcKeyApi[i]);
+        CHECK(NULL != pstcResult);
+#if defined(DDL_HOST_MODEL)
+        /* 访问外设寄存器的API在模型上有确定的总线开销 */
+        if ((NULL != pstcResult) && (0 != strcmp(apcKeyApi[i], "HSI2C_MasterBaudRateSet")))
+        {
+            CHECK(0u != pstcResult->u32Min);
+            CHECK(pstcResult->u32Min == pstcResult->u32Max);
+            CHECK(0u != (pstcResult->u32Read + pstcResult->u32Write));
+        }
+#endif
+    }
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+#if defined(DDL_HOST_MODEL)
+    return (0u == u32ErrCnt) ? 0 : 1;
+#else
+    while (1)
+    {
+        ;
+    }
+#endif
+}
+
+/**
+ * @brief  计时基准：目标板为SysTick时基，主机模型为模拟HCLK周期
+ * @retval uint64_t 当前时刻（HCLK周期）
+ */
+static uint64_t BenchStamp(void)
+{
+#if defined(DDL_HOST_MODEL)
+    return HOST_CycleGet();
+#else
+    return DDL_TickGet();
+#endif
+}
+
+/**
+ * @brief  单次调用开始
+ * @retval None
+ */
+static void BenchBegin(void)
+{
+#if defined(DDL_HOST_MODEL)
+    stc_host_access_stat_t stcStat;
+
+    HOST_AccessStatGet(&stcStat);
+    m_stcSample.u64Read  = stcStat.u64Read;
+    m_stcSample.u64Write = stcStat.u64Write;
+#endif
+    m_stcSample.u64Start = BenchStamp();
+}
+
+/**
+ * @brief  单次调用结束，累计周期及总线访问次数
+ * @retval None
+ */
+static void BenchEnd(void)
+{
+    uint64_t u64Cycle = BenchStamp() - m_stcSample.u64Start;
+    uint32_t u32Cycle;
+#if defined(DDL_HOST_MODEL)
+    stc_host_access_stat_t stcStat;
+
+    HOST_AccessStatGet(&stcStat);
+    m_stcSample.u64RdSum += stcStat.u64Read - m_stcSample.u64Read;
+    m_stcSample.u64WrSum += stcStat.u64Write - m_stcSample.u64Write;
+#endif
+
+    u64Cycle = (u64Cycle > m_u32Overhead) ? (u64Cycle - m_u32Overhead) : 0u;
+    u32Cycle = (u64Cycle > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)u64Cycle;
+
+    m_stcSample.u64Sum += u32Cycle;
+    if (u32Cycle < m_stcSample.u32Min)
+    {
+        m_stcSample.u32Min = u32Cycle;
+    }
+    if (u32Cycle > m_stcSample.u32Max)
+    {
+        m_stcSample.u32Max = u32Cycle;
+    }
+}
+
+/**
+ * @brief  输出一行结果并保存，清除采样累计
+ * @param  [in] pcCall 调用表达式，取'('之前部分为API名称
+ * @retval None
+ */
+static void BenchReport(const char *pcCall)
+{
+    stc_bench_result_t  stcResult;
+    stc_bench_result_t *pstcResult = &stcResult;
+    uint32_t            i          = 0u;
+
+    if (m_u32ResultCnt < BENCH_RESULT_MAX)
+    {
+        pstcResult = &m_astcResult[m_u32ResultCnt++];
+    }
+
+    while ((' ' == *pcCall) || ('(' == *pcCall))
+    {
+        pcCall++;
+    }
+    while (('\0' != pcCall[i]) && ('(' != pcCall[i]) && (' ' != pcCall[i]) && (i < (sizeof(pstcResult->acApi) - 1u)))
+    {
+        pstcResult->acApi[i] = pcCall[i];
+        i++;
+    }
+    pstcResult->acApi[i] = '\0';
+
+    pstcResult->u32Min   = m_stcSample.u32Min;
+    pstcResult->u32Max   = m_stcSample.u32Max;
+    pstcResult->u32Avg   = (uint32_t)((m_stcSample.u64Sum + (BENCH_NUM / 2u)) / BENCH_NUM);
+    pstcResult->u32Read  = (uint32_t)(m_stcSample.u64RdSum / BENCH_NUM);
+    pstcResult->u32Write = (uint32_t)(m_stcSample.u64WrSum / BENCH_NUM);
+
+#if defined(DDL_HOST_MODEL)
+    if (0u == (m_stcSample.u64Sum + m_stcSample.u64RdSum + m_stcSample.u64WrSum))
+    {
+        /* 无总线访问（纯CPU运算）：模型不计CPU周期，周期列留空 */
+        printf("%s,,,,0,0\n", pstcResult->acApi);
+    }
+    else
+    {
+        printf("%s,%u,%u,%u,%u,%u\n", pstcResult->acApi, (unsigned)pstcResult->u32Min, (unsigned)pstcResult->u32Avg,
+               (unsigned)pstcResult->u32Max, (unsigned)pstcResult->u32Read, (unsigned)pstcResult->u32Write);
+    }
+#else
+    printf("%s,%u,%u,%u,,\r\n", pstcResult->acApi, (unsigned)pstcResult->u32Min, (unsigned)pstcResult->u32Avg,
+           (unsigned)pstcResult->u32Max);
+#endif
+
+    DDL_ZERO_STRUCT(m_stcSample);
+    m_stcSample.u32Min = 0xFFFFFFFFu;
+}
+
+/**
+ * @brief  测量空调用的计时开销
+ * @retval None
+ */
+static void BenchCalibrate(void)
+{
+    uint32_t i;
+
+    m_u32Overhead = 0u;
+    DDL_ZERO_STRUCT(m_stcSample);
+    m_stcSample.u32Min = 0xFFFFFFFFu;
+    for (i = 0u; i < BENCH_NUM; i++)
+    {
+        BenchBegin();
+        BenchEnd();
+    }
+    m_u32Overhead = m_stcSample.u32Min;
+
+    DDL_ZERO_STRUCT(m_stcSample);
+    m_stcSample.u32Min = 0xFFFFFFFFu;
+}
+
+/**
+ * @brief  按API名称查找结果
+ * @param  [in] pcApi API名称
+ * @retval const stc_bench_result_t* 结果，未找到时为NULL
+ */
+static const stc_bench_result_t *BenchResultFind(const char *pcApi)
+{
+    uint32_t i;
+
+    for (i = 0u; i < m_u32ResultCnt; i++)
+    {
+        if (0 == strcmp(m_astcResult[i].acApi, pcApi))
+        {
+            return &m_astcResult[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief  DDL公共函数（DDL_TickInit()/DDL_TickIrqHandler()为计时基准本身，DDL_Mmio*仅用于跟踪版本，不测）
+ * @retval None
+ */
+static void BenchDdl(void)
+{
+    stc_ddl_recip_t    stcRecip;
+    stc_ddl_deadline_t stcDeadline;
+
+    BENCH(Log2(0x12345u));
+    BENCH(DDL_MemoryClear(m_au8Buf1, sizeof(m_au8Buf1)));
+    BENCH(DDL_MemorySet(m_au8Buf1, 0x5Au, sizeof(m_au8Buf1)));
+    BENCH(DDL_MemoryCopy(m_au8Buf2, m_au8Buf1, sizeof(m_au8Buf2)));
+    BENCH(DDL_MemoryCompare(m_au8Buf1, m_au8Buf2, sizeof(m_au8Buf1)));
+    BENCH(DDL_SatAdd(0x7FFFFF00, 0x1000));
+    BENCH(DDL_SatSub(-0x7FFFFF00, 0x1000));
+    BENCH(DDL_Q16Mul(DDL_Q16(1.5), DDL_Q16(-2.5)));
+    BENCH(DDL_Q16Div(DDL_Q16(1.5), DDL_Q16(-2.5)));
+    BENCH(DDL_Q16Round(DDL_Q16(2.5)));
+    BENCH(DDL_UDivRound(48000000u, 9600u));
+    BENCH(DDL_RecipInit(&stcRecip, 1000u));
+    BENCH(DDL_RecipDiv(48000000u, &stcRecip));
+    BENCH(DDL_TickGet());
+    BENCH(DDL_TimeUsGet());
+    BENCH(DDL_TickToUs(4000000u));
+    BENCH(DDL_UsToTick(1000000u));
+    BENCH(DDL_DeadlineInit(&stcDeadline, 1000u));
+    BENCH(DDL_DeadlineExpired(&stcDeadline));
+    BENCH(DDL_DelayModeSet(DDL_DELAY_MD_BUSY));
+    BENCH(DDL_DelayModeGet());
+    BENCH(DDL_Delay1ms(1u));
+    BENCH(DDL_Delay100us(1u));
+    BENCH(DDL_Delay10us(1u));
+}
+
+/**
+ * @brief  SYSCTRL（时钟保持RC48M 4MHz不变）
+ * @retval None
+ */
+static void BenchSysctrl(void)
+{
+    stc_sysctrl_clock_init_t stcClockInit;
+
+    SYSCTRL_ClockStcInit(&stcClockInit);
+
+    BENCH(SYSCTRL_ClockInit(&stcClockInit));
+    BENCH(SYSCTRL_ClockDeInit());
+    BENCH(SYSCTRL_ClockSrcEnable(SYSCTRL_CLK_SRC_RCL_32768));
+    BENCH(SYSCTRL_ClockSrcDisable(SYSCTRL_CLK_SRC_RCL_32768));
+    BENCH(SYSCTRL_SysClockSwitch(SYSCTRL_CLK_SRC_RC48M_4M));
+    BENCH(SYSCTRL_HclkDivSet(SYSCTRL_HCLK_PRS_DIV1));
+    BENCH(SYSCTRL_HclkFreqGet());
+    BENCH(SYSCTRL_RC48MTrimSet(SYSCTRL_RC48M_FREQ_4M));
+    BENCH(SYSCTRL_RCLTrimSet(SYSCTRL_RCL_FREQ_32768));
+    BENCH(SYSCTRL_XTLStableTimeSet(SYSCTRL_XTL_STB_CYCLE16384));
+    BENCH(SYSCTRL_XTLDrvConfig(SYSCTRL_XTL_AMP2, SYSCTRL_XTL_DRV2));
+    BENCH(SYSCTRL_XTLFailureConfig(SYSCTRL_XTL_FAILURE_DETECT_DISABLE));
+    BENCH(SYSCTRL_XTLFailureIntEnable());
+    BENCH(SYSCTRL_XTLFailureIntDisable());
+    BENCH(SYSCTRL_XTLFailureIntFlagGet());
+    BENCH(SYSCTRL_XTLFailureIntFlagClear());
+    BENCH(SYSCTRL_XTLAlwaysOnEnable());
+    BENCH(SYSCTRL_XTLAlwaysOnDisable());
+    BENCH(SYSCTRL_PeriphClockEnable(PeriphClockTrng));
+    BENCH(SYSCTRL_PeriphClockDisable(PeriphClockTrng));
+    BENCH(SYSCTRL_PeriphClockStatusGet(PeriphClockTrng));
+    BENCH(SYSCTRL_FuncEnable(SYSCTRL_FUNC_LOCKUP_EN));
+    BENCH(SYSCTRL_FuncDisable(SYSCTRL_FUNC_LOCKUP_EN));
+    BENCH(SYSCTRL_WakeupByRC48M(SYSCTRL_WAKEUP_SRC_KEEP));
+    BENCH(SYSCTRL_PeriphReset(PeriphResetTrng));
+    BENCH(SYSCTRL_ResetFlagGet(SYSCTRL_RST_RSTB));
+    BENCH(SYSCTRL_ResetFlagClear(SYSCTRL_RST_RSTB));
+    BENCH(SYSCTRL_ResetFlagClearAll());
+    BENCH(SYSCTRL_DebugActiveEnable(SYSCTRL_DEBUG_IWDT_ACTIVE));
+    BENCH(SYSCTRL_DebugActiveDisable(SYSCTRL_DEBUG_IWDT_ACTIVE));
+    BENCH(SYSCTRL_ClockStcInit(&stcClockInit));
+
+    /* 后续RTC使用RCL */
+    SYSCTRL_ClockSrcEnable(SYSCTRL_CLK_SRC_RCL_32768);
+}
+
+/**
+ * @brief  GPIO（PA09输入，不占用打印端口PA01）
+ * @retval None
+ */
+static void BenchGpio(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Pin  = GPIO_PIN_09;
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+
+    BENCH(GPIO_Init(GPIOA, &stcGpioInit));
+    BENCH(GPIO_IntFlagGet(GPIOA, GPIO_PIN_09));
+    BENCH(GPIO_IntFlagClear(GPIOA, GPIO_PIN_09));
+    BENCH(GPIO_StcInit(&stcGpioInit));
+}
+
+/**
+ * @brief  FLASH（只擦写扇区127，FLASH_ChipErase()会擦除程序本身，不测）
+ * @retval None
+ */
+static void BenchFlash(void)
+{
+    uint8_t  au8Data[4]  = {0x11u, 0x22u, 0x33u, 0x44u};
+    uint16_t au16Data[4] = {0x1111u, 0x2222u, 0x3333u, 0x4444u};
+    uint32_t au32Data[4] = {0x11111111u, 0x22222222u, 0x33333333u, 0x44444444u};
+
+    SYSCTRL_PeriphClockEnable(PeriphClockFlash);
+    FLASH_ReadOnlyDisable();
+
+    BENCH(FLASH_LockAllSector());
+    BENCH(FLASH_UnlockAllSector());
+    BENCH(FLASH_LockUnlockSectors(0x80000000u));
+    BENCH(FLASH_WaitCycle(FLASH_WAIT_CYCLE0));
+    BENCH(FLASH_ProtectStatusGet());
+    BENCH(FLASH_IntEnable(FLASH_INT_ENABLE_PC));
+    BENCH(FLASH_IntDisable(FLASH_INT_ENABLE_PC));
+    BENCH(FLASH_IntFlagGet(FLASH_INT_FLAG_PC));
+    BENCH(FLASH_IntFlagClear(FLASH_INT_FLAG_PC));
+    BENCH(FLASH_LowPowerEnable());
+    BENCH(FLASH_LowPowerDisable());
+    BENCH(FLASH_OperateModeConfig(FLASH_MD_RD));
+    BENCH(FLASH_OperateModeConfigRamFunc(FLASH_MD_RD));
+
+    /* 每次写不同地址，各API使用扇区内不同区域 */
+    BENCH(FLASH_SectorErase(BENCH_FLASH_ADR));
+    BENCH(FLASH_WriteByte(BENCH_FLASH_ADR + 0x000u + u32Iter, au8Data, 1u));
+    BENCH(FLASH_WriteHalfWord(BENCH_FLASH_ADR + 0x020u + 2u * u32Iter, au16Data, 1u));
+    BENCH(FLASH_WriteWord(BENCH_FLASH_ADR + 0x040u + 4u * u32Iter, au32Data, 1u));
+    BENCH(FLASH_ContinousWriteByte(BENCH_FLASH_ADR + 0x080u + 4u * u32Iter, au8Data, 4u));
+    BENCH(FLASH_ContinousWriteHalfWord(BENCH_FLASH_ADR + 0x0C0u + 8u * u32Iter, au16Data, 4u));
+    BENCH(FLASH_ContinousWriteWord(BENCH_FLASH_ADR + 0x100u + 16u * u32Iter, au32Data, 4u));
+    BENCH(FLASH_OperateModeConfig(FLASH_MD_RD));
+
+    CHECK(0x11111111u == *(volatile uint32_t *)DDL_MEM_MAP(BENCH_FLASH_ADR + 0x040u));
+    CHECK(0x44444444u == *(volatile uint32_t *)DDL_MEM_MAP(BENCH_FLASH_ADR + 0x10Cu));
+
+    BENCH(FLASH_ReadOnlyEnable());
+    BENCH(FLASH_ReadOnlyDisable());
+    FLASH_LockAllSector();
+}
+
+/**
+ * @brief  ADC
+ * @retval None
+ */
+static void BenchAdc(void)
+{
+    stc_adc_sqr_init_t stcAdcInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockAdc);
+    ADC_SqrStcInit(&stcAdcInit);
+
+    BENCH(ADC_SqrInit(&stcAdcInit));
+    BENCH(ADC_Enable());
+    BENCH(ADC_ConfigSqrCh(ADC_SQR_CH0_MUX, ADC_INPUT_CH0));
+    BENCH(ADC_ExternTrigEnable(ADC_TRIG_PA03));
+    BENCH(ADC_ExternTrigDisable(ADC_TRIG_PA03));
+    BENCH(ADC_SqrStart());
+    BENCH(ADC_SqrResultGet(ADC_SQR_CH0_MUX));
+    BENCH(ADC_IntEnable());
+    BENCH(ADC_IntDisable());
+    BENCH(ADC_IntFlagGet(ADC_FLAG_SQR));
+    BENCH(ADC_IntFlagClear(ADC_FLAG_SQR));
+    BENCH(ADC_Disable());
+    BENCH(ADC_SqrStcInit(&stcAdcInit));
+}
+
+/**
+ * @brief  ATIMER3 模式0/1/23
+ * @retval None
+ */
+static void BenchAtim3(void)
+{
+    stc_atim3_mode0_init_t            stcM0;
+    stc_atim3_mode1_init_t            stcM1;
+    stc_atim3_pwc_input_init_t        stcPwc;
+    stc_atim3_mode23_init_t           stcM23;
+    stc_atim3_m23_gate_init_t         stcGate   = {0};
+    stc_atim3_m23_master_slave_init_t stcMs;
+    stc_atim3_m23_compare_init_t      stcCmp;
+    stc_atim3_m23_input_init_t        stcInput;
+    stc_atim3_m23_etr_input_init_t    stcEtr    = {0};
+    stc_atim3_m23_bk_input_init_t     stcBk;
+    stc_atim3_m23_dt_init_t           stcDt;
+    stc_atim3_m23_adc_trig_init_t     stcAdcTrig;
+    stc_atim3_m23_rcr_init_t          stcRcr;
+    stc_atim3_m23_ocref_clr_init_t    stcOcref  = {0};
+
+    SYSCTRL_PeriphClockEnable(PeriphClockAtim3);
+
+    /* 模式0 */
+    BENCH(ATIM3_Mode0_StcInit(&stcM0));
+    BENCH(ATIM3_Mode0_Init(&stcM0));
+    BENCH(ATIM3_Mode0_ARRSet(0x8000u));
+    BENCH(ATIM3_Mode0_ARRGet());
+    BENCH(ATIM3_Mode0_Cnt16Set(0x1000u));
+    BENCH(ATIM3_Mode0_Cnt16Get());
+    BENCH(ATIM3_Mode0_Cnt32Set(0x10000u));
+    BENCH(ATIM3_Mode0_Cnt32Get());
+    BENCH(ATIM3_Mode0_OutputEnable());
+    BENCH(ATIM3_Mode0_OutputDisable());
+    BENCH(ATIM3_Mode0_TOGEnable());
+    BENCH(ATIM3_Mode0_TOGDisable());
+    BENCH(ATIM3_Mode0_IntEnable());
+    BENCH(ATIM3_Mode0_IntDisable());
+    BENCH(ATIM3_Mode0_Run());
+    BENCH(ATIM3_Mode0_Stop());
+
+    /* 模式1 PWC */
+    BENCH(ATIM3_Mode1_StcInit(&stcM1));
+    BENCH(ATIM3_Mode1_Init(&stcM1));
+    BENCH(ATIM3_Mode1_InputStcInit(&stcPwc));
+    BENCH(ATIM3_Mode1_InputConfig(&stcPwc));
+    BENCH(ATIM3_Mode1_PWCEdgeSelect(ATIM3_M1_M1CR_DETECT_EDGE_RISE_TO_FALL));
+    BENCH(ATIM3_Mode1_Cnt16Set(0x1000u));
+    BENCH(ATIM3_Mode1_Cnt16Get());
+    BENCH(ATIM3_Mode1_PWCCapValueGet());
+    BENCH(ATIM3_Mode1_IntEnable(ATIM3_M1_INT_UI));
+    BENCH(ATIM3_Mode1_IntDisable(ATIM3_M1_INT_UI));
+    BENCH(ATIM3_Mode1_Run());
+    BENCH(ATIM3_Mode1_Stop());
+
+    /* 模式23 */
+    BENCH(ATIM3_Mode23_StcInit(&stcM23));
+    BENCH(ATIM3_Mode23_Init(&stcM23));
+    BENCH(ATIM3_Mode23_ManualPWMOutputEnable());
+    BENCH(ATIM3_Mode23_ManualPWMOutputDisable());
+    BENCH(ATIM3_Mode23_AutoPWMOutputEnable());
+    BENCH(ATIM3_Mode23_AutoPWMOutputDisable());
+    BENCH(ATIM3_Mode23_ARRBufferEnable());
+    BENCH(ATIM3_Mode23_ARRBufferDisable());
+    BENCH(ATIM3_Mode23_ARRSet(0x8000u));
+    BENCH(ATIM3_Mode23_GetARR());
+    BENCH(ATIM3_Mode23_Cnt16Set(0x1000u));
+    BENCH(ATIM3_Mode23_Cnt16Get());
+    BENCH(ATIM3_Mode23_ChannelCompareValueSet(ATIM3_COMPARE_CAPTURE_CH0A, 0x4000u));
+    BENCH(ATIM3_Mode23_ChannelCaptureValueGet(ATIM3_COMPARE_CAPTURE_CH0A));
+    BENCH(ATIM3_Mode23_GateFuncSel(&stcGate));
+    BENCH(ATIM3_Mode23_MasterSlaveStcInit(&stcMs));
+    BENCH(ATIM3_Mode23_MasterSlaveTrigSet(&stcMs));
+    BENCH(ATIM3_Mode23_MSCRIA0Sel(ATIM3_M23_MSCR_IA0_CH0A));
+    BENCH(ATIM3_Mode23_MSCRIB0Sel(ATIM3_M23_MSCR_IB0_CH0B));
+    BENCH(ATIM3_Mode23_CompareStcInit(&stcCmp));
+    BENCH(ATIM3_Mode23_PortOutputCHxAConfig(ATIM3_M23_OUTPUT_CHANNEL_CH0, &stcCmp));
+    BENCH(ATIM3_Mode23_PortOutputCHxBConfig(ATIM3_M23_OUTPUT_CHANNEL_CH0, &stcCmp));
+    BENCH(ATIM3_Mode23_InputStcInit(&stcInput));
+    BENCH(ATIM3_Mode23_PortInputCHxAConfig(ATIM3_M23_OUTPUT_CHANNEL_CH1, &stcInput));
+    BENCH(ATIM3_Mode23_PortInputCHxBConfig(ATIM3_M23_OUTPUT_CHANNEL_CH1, &stcInput));
+    BENCH(ATIM3_Mode23_ETRInputConfig(&stcEtr));
+    BENCH(ATIM3_Mode23_BKInputStcInit(&stcBk));
+    BENCH(ATIM3_Mode23_BrakeInputConfig(&stcBk));
+    BENCH(ATIM3_Mode23_BrakePortStatusConfig(ATIM3_M23_OUTPUT_CHANNEL_CH0, ATIM3_M23_CRCHx_BKSA_BKSB_PORT_OUTPUT_LOW,
+                                             ATIM3_M23_CRCHx_BKSA_BKSB_PORT_OUTPUT_LOW));
+    BENCH(ATIM3_Mode23_DTStcInit(&stcDt));
+    BENCH(ATIM3_Mode23_DTConfig(&stcDt));
+    BENCH(ATIM3_Mode23_ADCTrigStcInit(&stcAdcTrig));
+    BENCH(ATIM3_Mode23_TrigADCConfig(&stcAdcTrig));
+    BENCH(ATIM3_Mode23_RCRStcInit(&stcRcr));
+    BENCH(ATIM3_Mode23_SetRepeatPeriod(&stcRcr));
+    BENCH(ATIM3_Mode23_OCRefClr(&stcOcref));
+    BENCH(ATIM3_Mode23_EnableCH0ASwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableCH0BSwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableCH1ASwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableCH1BSwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableCH2ASwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableCH2BSwTrigCaptureCompare());
+    BENCH(ATIM3_Mode23_EnableSoftwareUev());
+    BENCH(ATIM3_Mode23_EnableSoftwareTrig());
+    BENCH(ATIM3_Mode23_EnableSoftwareBrake());
+    BENCH(ATIM3_Mode23_IntEnable(ATIM3_M23_INT_UI));
+    BENCH(ATIM3_Mode23_IntDisable(ATIM3_M23_INT_UI));
+    BENCH(ATIM3_Mode23_Run());
+    BENCH(ATIM3_Mode23_Stop());
+
+    BENCH(ATIM3_IntFlagGet(ATIM3_FLAG_UI));
+    BENCH(ATIM3_IntFlagClear(ATIM3_FLAG_UI));
+    BENCH(ATIM3_IntFlagClearAll());
+
+    SYSCTRL_PeriphReset(PeriphResetAtim3);
+}
+
+/**
+ * @brief  BTIM（CTIMER0作为BTIM0/1/2）
+ * @retval None
+ */
+static void BenchBtim(void)
+{
+    stc_btim_init_t stcBtimInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    BTIM_StcInit(&stcBtimInit);
+
+    BENCH(BTIM_Init(BTIM0, &stcBtimInit));
+    BENCH(BTIM_CounterSet(BTIM0, 0x1000u));
+    BENCH(BTIM_CounterGet(BTIM0));
+    BENCH(BTIM_AutoReloadSet(BTIM0, 0x8000u));
+    BENCH(BTIM_ModeSet(BTIM0, BTIM_MD_PCLK));
+    BENCH(BTIM_ToggleEnable(BTIM0));
+    BENCH(BTIM_ToggleDisable(BTIM0));
+    BENCH(BTIM_CounterClockDivSet(BTIM0, BTIM_COUNTER_CLK_DIV1));
+    BENCH(BTIM_OneShotSet(BTIM0, BTIM_CONTINUOUS_COUNTER));
+    BENCH(BTIM_TriggerSrcSet(BTIM0, BTIM_TRIG_SRC_ETR));
+    BENCH(BTIM_ExternInputPolaritySet(BTIM0, BTIM_ETR_POLARITY_NORMAL));
+    BENCH(BTIM_IntEnable(BTIM0, BTIM_INT_UI));
+    BENCH(BTIM_IntDisable(BTIM0, BTIM_INT_UI));
+    BENCH(BTIM_IntFlagGet(BTIM0, BTIM_FLAG_UI));
+    BENCH(BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI));
+    BENCH(BTIM_AifrFlagGet(BTIM0, BTIM03_AIT_FLAG_UI));
+    BENCH(BTIM_AicrFlagClear(BTIM0, BTIM03_AIT_FLAG_UI));
+    BENCH(BTIM_Enable(BTIM0));
+    BENCH(BTIM_Disable(BTIM0));
+    BENCH(BTIM_StcInit(&stcBtimInit));
+
+    SYSCTRL_FuncDisable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    SYSCTRL_PeriphReset(PeriphResetCtim0);
+}
+
+/**
+ * @brief  GTIM（CTIMER0作为GTIM0）
+ * @retval None
+ */
+static void BenchGtim(void)
+{
+    stc_gtim_init_t stcGtimInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+    GTIM_StcInit(&stcGtimInit);
+
+    BENCH(GTIM_Init(GTIM0, &stcGtimInit));
+    BENCH(GTIM_CounterSet(GTIM0, 0x1000u));
+    BENCH(GTIM_CounterGet(GTIM0));
+    BENCH(GTIM_AutoReloadSet(GTIM0, 0x8000u));
+    BENCH(GTIM_ModeSet(GTIM0, GTIM_MD_PCLK));
+    BENCH(GTIM_ToggleEnable(GTIM0));
+    BENCH(GTIM_ToggleDisable(GTIM0));
+    BENCH(GTIM_CounterClockDivSet(GTIM0, GTIM_COUNTER_CLK_DIV1));
+    BENCH(GTIM_OneShotSet(GTIM0, GTIM_CONTINUOUS_COUNTER));
+    BENCH(GTIM_TriggerSrcSet(GTIM0, GTIM_TRIG_SRC_ETR));
+    BENCH(GTIM_ExternInputPolaritySet(GTIM0, GTIM_ETR_POLARITY_NORMAL));
+    BENCH(GTIM_ExternInputFilterSet(GTIM0, GTIM_ETR_FLT_NONE));
+    BENCH(GTIM_CompareCaptureModeSet(GTIM0, GTIM_COMPARE_CAPTURE_CH0, GTIM_COMPARE_CAPTURE_PWM_NORMAL));
+    BENCH(GTIM_CompareCaptureRegSet(GTIM0, GTIM_COMPARE_CAPTURE_CH0, 0x4000u));
+    BENCH(GTIM_CompareCaptureRegGet(GTIM0, GTIM_COMPARE_CAPTURE_CH0));
+    BENCH(GTIM_CompareCaptureAllDisable(GTIM0));
+    BENCH(GTIM_IntEnable(GTIM0, GTIM_INT_UI));
+    BENCH(GTIM_IntDisable(GTIM0, GTIM_INT_UI));
+    BENCH(GTIM_IntFlagGet(GTIM0, GTIM_FLAG_UI));
+    BENCH(GTIM_IntFlagClear(GTIM0, GTIM_FLAG_UI));
+    BENCH(GTIM_Enable(GTIM0));
+    BENCH(GTIM_Disable(GTIM0));
+    BENCH(GTIM_StcInit(&stcGtimInit));
+
+    SYSCTRL_PeriphReset(PeriphResetCtim0);
+}
+
+/**
+ * @brief  CTRIM
+ * @retval None
+ */
+static void BenchCtrim(void)
+{
+    stc_ctrim_calib_init_t stcCalibInit;
+    stc_ctrim_timer_init_t stcTimerInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockCtrim);
+    CTRIM_CalibStcInit(&stcCalibInit);
+    CTRIM_TimerStcInit(&stcTimerInit);
+
+    BENCH(CTRIM_CalibInit(&stcCalibInit));
+    BENCH(CTRIM_TimerInit(&stcTimerInit));
+    BENCH(CTRIM_CounterGet());
+    BENCH(CTRIM_AutoReloadSet(0x1000u));
+    BENCH(CTRIM_InitStepSet(CTRIM_INIT_STEP_2));
+    BENCH(CTRIM_ExternClockFilterSet(CTRIM_ETR_CLK_FLT_NONE));
+    BENCH(CTRIM_AccurateClockSet(CTRIM_ACCURATE_CLOCK_RCL));
+    BENCH(CTRIM_ModeSet(CTRIM_AUTO_CALIB_MD_RC48M));
+    BENCH(CTRIM_RefClockDivSet(CTRIM_REF_CLOCK_DIV2));
+    BENCH(CTRIM_OneShotSet(CTRIM_ONE_SHOT_REPETITIVE));
+    BENCH(CTRIM_ARRCoutDirGet());
+    BENCH(CTRIM_TrimCodeGet());
+    BENCH(CTRIM_CountErrorCaptureGet());
+    BENCH(CTRIM_CountErrorLimitSet(0x10u));
+    BENCH(CTRIM_IntEnable(CTRIM_INT_OK));
+    BENCH(CTRIM_IntDisable(CTRIM_INT_OK));
+    BENCH(CTRIM_FlagGet(CTRIM_FLAG_OK));
+    BENCH(CTRIM_FlagClear(CTRIM_FLAG_OK));
+    BENCH(CTRIM_FlagClearALL());
+    BENCH(CTRIM_Enable());
+    BENCH(CTRIM_Disable());
+    BENCH(CTRIM_CalibStcInit(&stcCalibInit));
+    BENCH(CTRIM_TimerStcInit(&stcTimerInit));
+
+    SYSCTRL_PeriphReset(PeriphResetCtrim);
+}
+
+/**
+ * @brief  HSI2C（无从机：传输类API走超时或错误路径）
+ * @retval None
+ */
+static void BenchHsi2c(void)
+{
+    stc_hsi2c_master_init_t    stcMasterInit;
+    stc_hsi2c_slave_init_t     stcSlaveInit;
+    stc_hsi2c_master_config1_t stcMcfg1 = {0};
+    stc_hsi2c_master_config2_t stcMcfg2 = {0};
+    stc_hsi2c_master_config3_t stcMcfg3 = {0};
+    stc_hsi2c_slave_control1_t stcScr1  = {0};
+    stc_hsi2c_slave_control2_t stcScr2  = {0};
+    uint8_t                    au8Data[4];
+    uint16_t                   u16Addr;
+    uint32_t                   u32RxLen = 1u;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockHsi2c);
+    HSI2C_MasterStcInit(&stcMasterInit);
+    stcMasterInit.u32BaudRateHz = 100000u;
+    stcMasterInit.u8SlaveAddr   = 0x50u;
+    HSI2C_SlaveStcInit(&stcSlaveInit);
+
+    BENCH(HSI2C_MasterInit(HSI2C, &stcMasterInit, SystemCoreClock));
+    BENCH(HSI2C_MasterBaudRateSet(HSI2C, &stcMasterInit, SystemCoreClock));
+    BENCH(HSI2C_MasterMcfgr1Config(HSI2C, &stcMcfg1));
+    BENCH(HSI2C_MasterMcfgr2Config(HSI2C, &stcMcfg2));
+    BENCH(HSI2C_MasterMcfgr3Config(HSI2C, &stcMcfg3));
+    BENCH(HSI2C_MasterDataMatchConfig(HSI2C, 0u, 0u));
+    BENCH(HSI2C_MasterReset(HSI2C));
+    BENCH(HSI2C_MasterEnable(HSI2C));
+    BENCH(HSI2C_MasterDisable(HSI2C));
+    BENCH(HSI2C_MasterFlagGet(HSI2C, HSI2C_MASTER_FLAG_BBF));
+    BENCH(HSI2C_MasterFlagClear(HSI2C, HSI2C_MASTER_FLAG_CLR_ALL));
+    BENCH(HSI2C_MasterIntEnable(HSI2C, HSI2C_MASTER_INT_NDIE));
+    BENCH(HSI2C_MasterIntDisable(HSI2C, HSI2C_MASTER_INT_NDIE));
+    BENCH(HSI2C_MasterIntGet(HSI2C));
+    BENCH(HSI2C_MasterStart(HSI2C, 0x50u, Hsi2cMasterWriteSlaveRead));
+    BENCH(HSI2C_MasterWriteData(HSI2C, 0x5Au));
+    BENCH(HSI2C_MasterReceiveCmd(HSI2C, 1u));
+    BENCH(HSI2C_MasterStop(HSI2C));
+    BENCH(HSI2C_MasterReadData(HSI2C, au8Data));
+    BENCH(HSI2C_MasterErrorGet(0u));
+    BENCH(HSI2C_MasterTransferPoll(HSI2C, au8Data, sizeof(au8Data), BENCH_TIMEOUT_CNT));
+    BENCH(HSI2C_MasterTransferPollTimeoutUs(HSI2C, au8Data, sizeof(au8Data), BENCH_TIMEOUT_US));
+
+    /* 状态机及终止函数使用中断传输设置的全局传输信息，须在其后执行 */
+    BENCH(HSI2C_MasterTransferInt(HSI2C, au8Data, sizeof(au8Data)));
+    BENCH(HSI2C_MasterStatusMachineStart());
+    BENCH(HSI2C_MasterStatusMachineSubAddr());
+    BENCH(HSI2C_MasterStatusMachineRestart());
+    BENCH_PREP(u32RxLen = 1u, HSI2C_MasterStatusMachineRxCmd(&u32RxLen));
+    BENCH(HSI2C_MasterStatusMachineTrans());
+    BENCH(HSI2C_MasterStatusMachineStop());
+    BENCH(HSI2C_MasterTransAbort(HSI2C));
+    HSI2C_MasterIntDisable(HSI2C, HSI2C_MASTER_INT_ALL);
+    HSI2C_MasterReset(HSI2C);
+
+    BENCH(HSI2C_SlaveInit(HSI2C, &stcSlaveInit, SystemCoreClock));
+    BENCH(HSI2C_SlaveScr1Config(HSI2C, &stcScr1));
+    BENCH(HSI2C_SlaveScr2Config(HSI2C, &stcScr2));
+    BENCH(HSI2C_SlaveReset(HSI2C));
+    BENCH(HSI2C_SlaveEnable(HSI2C));
+    BENCH(HSI2C_SlaveDisable(HSI2C));
+    BENCH(HSI2C_SlaveFlagGet(HSI2C, HSI2C_SLAVE_FLAG_BBF));
+    BENCH(HSI2C_SlaveFlagClear(HSI2C, HSI2C_SLAVE_FLAG_CLR_ALL));
+    BENCH(HSI2C_SlaveIntEnable(HSI2C, HSI2C_SLAVE_INT_SDIE));
+    BENCH(HSI2C_SlaveIntDisable(HSI2C, HSI2C_SLAVE_INT_SDIE));
+    BENCH(HSI2C_SlaveIntGet(HSI2C));
+    BENCH(HSI2C_SlaveWriteAddr(HSI2C, 0x50u, 0x51u));
+    BENCH(HSI2C_SlaveWriteData(HSI2C, 0x5Au));
+    BENCH(HSI2C_SlaveReadData(HSI2C, au8Data));
+    BENCH(HSI2C_SlaveReadAddr(HSI2C, &u16Addr));
+    BENCH(HSI2C_SlaveErrorGet(0u));
+    BENCH(HSI2C_SlaveTransNack(HSI2C, HSI2C_SLAVE_TX_ACK));
+    BENCH(HSI2C_SlaveTransferPoll(HSI2C, au8Data, sizeof(au8Data), BENCH_TIMEOUT_CNT));
+    BENCH(HSI2C_SlaveTransferPollTimeoutUs(HSI2C, au8Data, sizeof(au8Data), BENCH_TIMEOUT_US));
+    BENCH(HSI2C_SlaveTransferInt(HSI2C, au8Data, sizeof(au8Data)));
+    BENCH(HSI2C_SlaveTransAbort(HSI2C));
+    HSI2C_SlaveIntDisable(HSI2C, HSI2C_SLAVE_INT_ALL);
+
+    BENCH(HSI2C_10BitAddrMdHighBitsGet(0x2A5u));
+    BENCH(HSI2C_10BitAddrMdLowBitsGet(0x2A5u));
+    BENCH(HSI2C_MasterStcInit(&stcMasterInit));
+    BENCH(HSI2C_SlaveStcInit(&stcSlaveInit));
+
+    SYSCTRL_PeriphReset(PeriphResetHsi2c);
+}
+
+/**
+ * @brief  IWDT（溢出产生中断而非复位，测试结束后停止）
+ * @retval None
+ */
+static void BenchIwdt(void)
+{
+    stc_iwdt_init_t stcIwdtInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockIwdt);
+    IWDT_StcInit(&stcIwdtInit);
+    stcIwdtInit.u32Action    = IWDT_OVER_INT_SLEEPMODE_RUN;
+    stcIwdtInit.u32Prescaler = IWDT_RC10K_DIV_512;
+
+    BENCH(IWDT_Init(&stcIwdtInit));
+    BENCH(IWDT_Start());
+    BENCH(IWDT_Feed());
+    BENCH(IWDT_OverFlagGet());
+    BENCH(IWDT_RunFlagGet());
+    BENCH(IWDT_OverFlagClear());
+    BENCH(IWDT_Stop());
+    BENCH(IWDT_StcInit(&stcIwdtInit));
+
+    IWDT_Stop();
+}
+
+/**
+ * @brief  LPUART0（LPUART1用于目标板打印）
+ * @note   LPUART_ReceivePoll()需要对端数据，只在主机模型上注入数据后测量；目标板上带超时的接收走超时路径
+ * @retval None
+ */
+static void BenchLpuart(void)
+{
+    stc_lpuart_init_t     stcLpuartInit;
+    stc_lpuart_baud_cfg_t stcBaudCfg;
+    stc_lpuart_xtl_baud_t stcXtlBaud;
+    uint8_t               u8Data = 0x5Au;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+
+    BENCH(LPUART_Init(LPUART0, &stcLpuartInit));
+    BENCH(LPUART_BaudCalc(SystemCoreClock, BENCH_BAUD, &stcBaudCfg));
+    BENCH(LPUART_BaudSet(LPUART0, &stcBaudCfg));
+    BENCH(LPUART_XtlBselSet(LPUART0, LPUART_XTL_BAUD_NORMAL));
+    BENCH(LPUART_XtlBaudCalc(9600u, &stcXtlBaud));
+    BENCH(LPUART_XtlBaudSet(LPUART0, &stcXtlBaud));
+    BENCH(LPUART_MultiModeConfig(LPUART0, 0x10u, 0xFFu));
+    BENCH(LPUART_TransmitPoll(LPUART0, &u8Data, 1u));
+    BENCH(LPUART_TransmitPollTimeOut(LPUART0, &u8Data, 1u, 0xFFFFFFFFu));
+    BENCH(LPUART_TransmitPollTimeOutUs(LPUART0, &u8Data, 1u, DDL_TIMEOUT_FOREVER));
+    BENCH(LPUART_TransmitInt(LPUART0, u8Data));
+#if defined(DDL_HOST_MODEL)
+    BENCH_PREP(HOST_LpuartRxPush(0u, 0xA5u), LPUART_ReceivePoll(LPUART0, &u8Data, 1u));
+    BENCH_PREP(HOST_LpuartRxPush(0u, 0xA5u), LPUART_ReceivePollTimeOut(LPUART0, &u8Data, 1u, BENCH_TIMEOUT_CNT));
+    BENCH_PREP(HOST_LpuartRxPush(0u, 0xA5u), LPUART_ReceivePollTimeOutUs(LPUART0, &u8Data, 1u, BENCH_TIMEOUT_US));
+    CHECK(0xA5u == u8Data);
+#else
+    BENCH(LPUART_ReceivePollTimeOut(LPUART0, &u8Data, 1u, BENCH_TIMEOUT_CNT));
+    BENCH(LPUART_ReceivePollTimeOutUs(LPUART0, &u8Data, 1u, BENCH_TIMEOUT_US));
+#endif
+    BENCH(LPUART_ReceiveInt(LPUART0));
+    BENCH(LPUART_HdModeEnable(LPUART0));
+    BENCH(LPUART_HdModeDisable(LPUART0));
+    BENCH(LPUART_FuncEnable(LPUART0, LPUART_FUN_REN));
+    BENCH(LPUART_FuncDisable(LPUART0, LPUART_FUN_REN));
+    BENCH(LPUART_IntEnable(LPUART0, LPUART_INT_RC));
+    BENCH(LPUART_IntDisable(LPUART0, LPUART_INT_RC));
+    BENCH(LPUART_IntFlagGet(LPUART0, LPUART_FLAG_TC));
+    BENCH(LPUART_IntFlagClear(LPUART0, LPUART_FLAG_TC));
+    BENCH(LPUART_IntFlagGetAll(LPUART0));
+    BENCH(LPUART_IntFlagClearAll(LPUART0));
+    BENCH(LPUART_Bit8Set(LPUART0));
+    BENCH(LPUART_Bit8Clear(LPUART0));
+    BENCH(LPUART_Bit8Get(LPUART0));
+    BENCH(LPUART_StcInit(&stcLpuartInit));
+
+    SYSCTRL_PeriphReset(PeriphResetLpuart0);
+}
+
+/**
+ * @brief  LVD（触发动作为中断）
+ * @retval None
+ */
+static void BenchLvd(void)
+{
+    stc_lvd_init_t stcLvdInit;
+
+    LVD_StcInit(&stcLvdInit);
+
+    BENCH(LVD_Init(&stcLvdInit));
+    BENCH(LVD_TriggerActionConfig(LVD_TRIG_ACT_INT));
+    BENCH(LVD_TriggerModeConfig(LVD_TRIG_MD_NONE));
+    BENCH(LVD_IntEnable());
+    BENCH(LVD_IntDisable());
+    BENCH(LVD_IntFlagGet());
+    BENCH(LVD_IntFlagClear());
+    BENCH(LVD_FilterOutputGet());
+    BENCH(LVD_Enable());
+    BENCH(LVD_Disable());
+    BENCH(LVD_StcInit(&stcLvdInit));
+}
+
+/**
+ * @brief  RTC（RCL时钟）
+ * @retval None
+ */
+static void BenchRtc(void)
+{
+    stc_rtc_init_t      stcRtcInit;
+    stc_rtc_time_t      stcTime;
+    stc_rtc_prd_t       stcPrd;
+    stc_rtc_alarmtime_t stcAlarm;
+    stc_rtc_ts_t        stcTs;
+    uint16_t            u16CompValue;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockRtc);
+    RTC_RtcStcInit(&stcRtcInit);
+    stcRtcInit.u32ClockSelect = RTC_CLK_RCL;
+    stcRtcInit.u8Format       = RTC_FMT_24H;
+    stcTime                   = stcRtcInit.stcRtcTime;
+    RTC_PrdStcInit(&stcPrd);
+    RTC_AlarmStcInit(&stcAlarm);
+
+    BENCH(RTC_Init(&stcRtcInit));
+    BENCH(RTC_Unlock());
+    BENCH(RTC_Lock());
+    BENCH(RTC_DateTimeSet(&stcTime));
+    BENCH(RTC_DateTimeRead(&stcTime));
+    BENCH(RTC_StartWait());
+    BENCH(RTC_FormatGet());
+    BENCH(RTC_1HzConfig(RTC_1HZ_NORMAL_PRICISION));
+    BENCH(RTC_1HzEnable());
+    BENCH(RTC_1HzDisable());
+    BENCH(RTC_PrdConfig(&stcPrd));
+    BENCH(RTC_AlarmTimeSet(RTC_ALM_CHA, &stcAlarm));
+    BENCH(RTC_AlarmTimeGet(RTC_ALM_CHA, &stcAlarm));
+    BENCH(RTC_AlarmEnalbe(RTC_ALM_CHA));
+    BENCH(RTC_AlarmDisalbe(RTC_ALM_CHA));
+    BENCH(RTC_WakeupTimerClockSelect(RTC_WUTR_DIV2));
+    BENCH(RTC_WakeupTimerCycleSet(100u));
+    BENCH(RTC_WakeupTimerCycleGet());
+    BENCH(RTC_WakeupTimerEnable());
+    BENCH(RTC_WakeupTimerDisable());
+    BENCH(RTC_TimestampEdgeSelect(RTC_TS_EDGE_RISING));
+    BENCH(RTC_TimestampEnable());
+    BENCH(RTC_TimestampDisable());
+    BENCH(RTC_TimestampGet(&stcTs));
+    BENCH(RTC_IntEnable(RTC_INT_PRD));
+    BENCH(RTC_IntDisable(RTC_INT_PRD));
+    BENCH(RTC_IntFlagGet(RTC_FLAG_PRD));
+    BENCH(RTC_IntFlagClear(RTC_FLAG_PRD));
+    BENCH(RTC_CompValueCalculate(10.5f, RTC_COMPEN_PRICISION_0P96PPM, &u16CompValue));
+    BENCH(RTC_CompValueCalculateQ16(DDL_Q16(10.5), RTC_COMPEN_PRICISION_0P96PPM, &u16CompValue));
+    BENCH(RTC_CompConfig(u16CompValue, RTC_COMPEN_PRICISION_0P96PPM));
+    BENCH(RTC_CompEnable());
+    BENCH(RTC_CompDisable());
+    BENCH(RTC_HcompConfig(RTC_HCOMP_PARA_4M));
+    BENCH(RTC_Enable());
+    BENCH(RTC_Disable());
+    BENCH(RTC_RtcStcInit(&stcRtcInit));
+    BENCH(RTC_PrdStcInit(&stcPrd));
+    BENCH(RTC_AlarmStcInit(&stcAlarm));
+}
+
+/**
+ * @brief  SPI（主机，主机模型上从设备为MOSI回环）
+ * @retval None
+ */
+static void BenchSpi(void)
+{
+    stc_spi_init_t stcSpiInit;
+    uint16_t       au16Tx[4] = {0x11u, 0x22u, 0x33u, 0x44u};
+    uint16_t       au16Rx[4];
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32Mode = SPI_MD_MASTER;
+    stcSpiInit.u32NSS  = SPI_NSS_SOFT;
+
+    BENCH(SPI_Init(SPI, &stcSpiInit));
+    BENCH(SPI_Enable(SPI));
+    BENCH(SPI_DataTransmit(SPI, 0x5Au));
+    BENCH(SPI_DataReceive(SPI));
+    BENCH(SPI_SlaveDummyDataTransmit(SPI, 0x5Au));
+    BENCH(SPI_SlaveDummyDataTransmitTimeout(SPI, 0x5Au, BENCH_TIMEOUT_CNT));
+    BENCH(SPI_SlaveDummyDataTransmitTimeoutUs(SPI, 0x5Au, BENCH_TIMEOUT_US));
+    DDL_Delay10us(1u);
+    SPI_FlagClearALL(SPI);
+    (void)SPI_DataReceive(SPI);
+    BENCH(SPI_TransmitReceive(SPI, au16Tx, au16Rx, 4u));
+    BENCH(SPI_TransmitReceiveTimeout(SPI, au16Tx, au16Rx, 4u, BENCH_TIMEOUT_CNT));
+    BENCH(SPI_TransmitReceiveTimeoutUs(SPI, au16Tx, au16Rx, 4u, BENCH_TIMEOUT_US));
+#if defined(DDL_HOST_MODEL)
+    CHECK(0 == memcmp(au16Tx, au16Rx, sizeof(au16Tx)));
+#endif
+    BENCH(SPI_BaudRateSet(SPI, SPI_BAUDRATE_PCLK_DIV2));
+    BENCH(SPI_ClockPhaseSet(SPI, SPI_CLK_PHASE_1EDGE));
+    BENCH(SPI_ClockPolaritySet(SPI, SPI_CLK_POLARITY_LOW));
+    BENCH(SPI_ModeSet(SPI, SPI_MD_MASTER));
+    BENCH(SPI_TransBitOrderSet(SPI, SPI_MSB_FIRST));
+    BENCH(SPI_DataWidthSet(SPI, SPI_DATA_WIDTH_8BIT));
+    BENCH(SPI_NSSModeSet(SPI, SPI_NSS_SOFT));
+    BENCH(SPI_SlaveNSSConfig(SPI, SPI_NSS_CONFIG_DISABLE));
+    BENCH(SPI_MasterNSSOutput(SPI, SPI_NSS_CONFIG_DISABLE));
+    BENCH(SPI_NSSSoftValueGet(SPI));
+    BENCH(SPI_NSSExternInputGet(SPI));
+    BENCH(SPI_TransDirSet(SPI, SPI_FULL_DUPLEX));
+    BENCH(SPI_HalfDuplexDirSet(SPI, SPI_HALF_DUPLEX_TX));
+    BENCH(SPI_IntEnable(SPI, SPI_INT_RXNE));
+    BENCH(SPI_IntDisable(SPI, SPI_INT_RXNE));
+    BENCH(SPI_FlagGet(SPI, SPI_FLAG_TXE));
+    BENCH(SPI_FlagClear(SPI, SPI_FLAG_OVF));
+    BENCH(SPI_FlagClearALL(SPI));
+    BENCH(SPI_TXEFlagSet(SPI));
+    BENCH(SPI_Disable(SPI));
+    BENCH(SPI_StcInit(&stcSpiInit));
+
+    SYSCTRL_PeriphReset(PeriphResetSpi);
+}
+
+/**
+ * @brief  TRNG
+ * @retval None
+ */
+static void BenchTrng(void)
+{
+    SYSCTRL_PeriphClockEnable(PeriphClockTrng);
+
+    BENCH(TRNG_Init());
+    BENCH(TRNG_Generate());
+    BENCH(TRNG_Data0Get());
+    BENCH(TRNG_Data1Get());
+}
+
+/**
+ * @brief  VC（通道0，输入未连接）
+ * @retval None
+ */
+static void BenchVc(void)
+{
+    stc_vc_init_t stcVcInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockVc);
+    VC_StcInit(&stcVcInit);
+
+    BENCH(VC_Init(&stcVcInit));
+    BENCH(VC_ResVoltDivConfig(VC_CH0, 0u));
+    BENCH(VC_ResVoltDivEnable());
+    BENCH(VC_ResVoltDivDisable());
+    BENCH(VC_IntModeConfig(VC_CH0, VC_INT_MD_RISING));
+    BENCH(VC_IntEnable(VC_CH0));
+    BENCH(VC_IntDisable(VC_CH0));
+    BENCH(VC_IntFlagGet(VC_CH0));
+    BENCH(VC_IntFlagClear(VC_CH0));
+    BENCH(VC_WindowEnable(VC_CH0));
+    BENCH(VC_WindowDisable(VC_CH0));
+    BENCH(VC_BlankWindowConfig(VC_CH0, VC_BLANK_WIN_NONE));
+    BENCH(VC_OutputAtimConfig(VC_CH0, VC_OUTPUT_ATIM_NONE));
+    BENCH(VC_FilterOutputGet(VC_CH0));
+    BENCH(VC_Enable(VC_CH0));
+    BENCH(VC_Disable(VC_CH0));
+    BENCH(VC_StcInit(&stcVcInit));
+
+    SYSCTRL_PeriphReset(PeriphResetVc);
+}
+
+#if !defined(DDL_HOST_MODEL)
+/**
+ * @brief  目标板：PA01作为LPUART1_TX输出结果（9600bps 8N1）
+ * @retval None
+ */
+static void PrintConfig(void)
+{
+    stc_gpio_init_t   stcGpioInit;
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+PUTCHAR_PROTOTYPE
+{
+    LPUART_TransmitInt(LPUART1, (uint8_t)(ch));
+    return ch;
+}
+#endif
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,335 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides the comparison of the out-of-line driver calls and
+ *        the static inline fast path (ddl_fast.h) on an interrupt service style
+ *        register access sequence
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "adc.h"
+#include "btim.h"
+#include "gpio.h"
+#include "iwdt.h"
+#include "lpuart.h"
+#include "spi.h"
+#include "trng.h"
+#include "ddl_fast.h" /* 必须在驱动头文件之后包含 */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  一种调用方式的测量结果
+ */
+typedef struct
+{
+    uint32_t u32Result; /*!< 访问序列的结果（两种方式须一致） */
+    uint32_t u32Cycle;  /*!< 每次访问序列的周期 */
+    uint32_t u32Read;   /*!< 每次访问序列的总线读次数（仅主机模型） */
+    uint32_t u32Write;  /*!< 每次访问序列的总线写次数（仅主机模型） */
+} stc_fast_result_t;
+
+typedef uint32_t (*func_isr_t)(void);
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_NUM  (100u) /* 访问序列执行次数 */
+#define BENCH_BAUD (9600u)
+
+#if defined(__GNUC__) || defined(__ARMCC_VERSION)
+#define BENCH_NOINLINE __attribute__((noinline))
+#elif defined(__ICCARM__)
+#define BENCH_NOINLINE _Pragma("inline=never")
+#else
+#define BENCH_NOINLINE
+#endif
+
+#if defined(DDL_HOST_MODEL)
+#define BENCH_UNIT "bus_cycle" /* 模型只对外设及SRAM访问计周期，函数调用开销不计 */
+#else
+#define BENCH_UNIT        "hclk_cycle"
+#define PUTCHAR_PROTOTYPE int fputc(int ch, FILE *f)
+#endif
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t IsrSequenceCall(void);
+static uint32_t IsrSequenceFast(void);
+static void     PeriphConfig(void);
+static void     Measure(func_isr_t pfnIsr, stc_fast_result_t *pstcResult);
+
+#if !defined(DDL_HOST_MODEL)
+static void PrintConfig(void);
+#endif
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_fast_result_t stcCall;
+    stc_fast_result_t stcFast;
+    uint32_t (*pfnCounterGet)(BTIM_TypeDef *BTIMx) = BTIM_CounterGet; /* 取地址为驱动库函数 */
+
+#if !defined(DDL_HOST_MODEL)
+    PrintConfig();
+#endif
+    PeriphConfig();
+
+    Measure(IsrSequenceCall, &stcCall);
+    Measure(IsrSequenceFast, &stcFast);
+
+    printf("# ddl_fast.h inline vs out-of-line, hclk=%u, unit=%s, runs=%u\n", (unsigned)SystemCoreClock, BENCH_UNIT,
+           (unsigned)BENCH_NUM);
+    printf("variant,cycles,reads,writes\n");
+    printf("call,%u,%u,%u\n", (unsigned)stcCall.u32Cycle, (unsigned)stcCall.u32Read, (unsigned)stcCall.u32Write);
+    printf("fast,%u,%u,%u\n", (unsigned)stcFast.u32Cycle, (unsigned)stcFast.u32Read, (unsigned)stcFast.u32Write);
+
+    /* 两种方式的寄存器访问及结果完全一致 */
+    CHECK(stcCall.u32Result == stcFast.u32Result);
+    CHECK(stcCall.u32Read == stcFast.u32Read);
+    CHECK(stcCall.u32Write == stcFast.u32Write);
+    CHECK(stcFast.u32Cycle <= stcCall.u32Cycle);
+
+    /* 函数指针仍指向驱动库函数 */
+    (BTIM_CounterSet)(BTIM0, 0x1234u);
+    CHECK(0x1234u == pfnCounterGet(BTIM0));
+    CHECK(0x1234u == BTIM_CounterGet(BTIM0));
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+#if defined(DDL_HOST_MODEL)
+    return (0u == u32ErrCnt) ? 0 : 1;
+#else
+    while (1)
+    {
+        ;
+    }
+#endif
+}
+
+/**
+ * @brief  中断服务程序中典型的访问序列：驱动库函数调用（函数名加括号，不使用内联版本）
+ * @retval uint32_t 读取结果累加值
+ */
+BENCH_NOINLINE static uint32_t IsrSequenceCall(void)
+{
+    uint32_t u32Sum = 0u;
+
+    if ((GPIO_IntFlagGet)(GPIOA, GPIO_PIN_09))
+    {
+        (GPIO_IntFlagClear)(GPIOA, GPIO_PIN_09);
+    }
+    if ((BTIM_IntFlagGet)(BTIM0, BTIM_FLAG_UI))
+    {
+        (BTIM_IntFlagClear)(BTIM0, BTIM_FLAG_UI);
+    }
+    u32Sum += (BTIM_CounterGet)(BTIM0);
+    if ((LPUART_IntFlagGet)(LPUART0, LPUART_FLAG_RC))
+    {
+        u32Sum += (LPUART_ReceiveInt)(LPUART0);
+        (LPUART_IntFlagClear)(LPUART0, LPUART_FLAG_RC);
+    }
+    (void)(SPI_DataTransmit)(SPI, 0x5Au);
+    u32Sum += (SPI_DataReceive)(SPI);
+    u32Sum += (ADC_SqrResultGet)(ADC_SQR_CH0_MUX);
+    u32Sum += (TRNG_Data0Get)();
+    (IWDT_Feed)();
+
+    return u32Sum;
+}
+
+/**
+ * @brief  同一访问序列：包含ddl_fast.h后的内联版本
+ * @retval uint32_t 读取结果累加值
+ */
+BENCH_NOINLINE static uint32_t IsrSequenceFast(void)
+{
+    uint32_t u32Sum = 0u;
+
+    if (GPIO_IntFlagGet(GPIOA, GPIO_PIN_09))
+    {
+        GPIO_IntFlagClear(GPIOA, GPIO_PIN_09);
+    }
+    if (BTIM_IntFlagGet(BTIM0, BTIM_FLAG_UI))
+    {
+        BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);
+    }
+    u32Sum += BTIM_CounterGet(BTIM0);
+    if (LPUART_IntFlagGet(LPUART0, LPUART_FLAG_RC))
+    {
+        u32Sum += LPUART_ReceiveInt(LPUART0);
+        LPUART_IntFlagClear(LPUART0, LPUART_FLAG_RC);
+    }
+    (void)SPI_DataTransmit(SPI, 0x5Au);
+    u32Sum += SPI_DataReceive(SPI);
+    u32Sum += ADC_SqrResultGet(ADC_SQR_CH0_MUX);
+    u32Sum += TRNG_Data0Get();
+    IWDT_Feed();
+
+    return u32Sum;
+}
+
+/**
+ * @brief  访问序列使用的外设：BTIM0计数值固定、LPUART0接收、SPI主机、ADC、TRNG生成一次随机数
+ * @retval None
+ */
+static void PeriphConfig(void)
+{
+    stc_lpuart_init_t  stcLpuartInit;
+    stc_spi_init_t     stcSpiInit;
+    stc_adc_sqr_init_t stcAdcInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SYSCTRL_PeriphClockEnable(PeriphClockAdc);
+    SYSCTRL_PeriphClockEnable(PeriphClockTrng);
+    SYSCTRL_PeriphClockEnable(PeriphClockIwdt);
+
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    BTIM_CounterSet(BTIM0, 0x1000u);
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32Mode = SPI_MD_MASTER;
+    stcSpiInit.u32NSS  = SPI_NSS_SOFT;
+    SPI_Init(SPI, &stcSpiInit);
+    SPI_Enable(SPI);
+
+    ADC_SqrStcInit(&stcAdcInit);
+    ADC_SqrInit(&stcAdcInit);
+    ADC_Enable();
+
+    (void)TRNG_Init();
+}
+
+/**
+ * @brief  测量访问序列执行BENCH_NUM次的平均周期及总线访问次数
+ * @param  [in] pfnIsr 访问序列
+ * @param  [out] pstcResult 测量结果
+ * @retval None
+ */
+static void Measure(func_isr_t pfnIsr, stc_fast_result_t *pstcResult)
+{
+    uint64_t u64Start;
+    uint64_t u64Cycle = 0u;
+    uint32_t u32Sum   = 0u;
+    uint32_t i;
+#if defined(DDL_HOST_MODEL)
+    stc_host_access_stat_t stcBegin;
+    stc_host_access_stat_t stcEnd;
+#endif
+
+    /* 两种方式从相同的SPI接收缓冲状态开始 */
+    (void)SPI_DataTransmit(SPI, 0x5Au);
+    DDL_Delay10us(10u);
+#if defined(DDL_HOST_MODEL)
+    HOST_AccessStatGet(&stcBegin);
+#endif
+
+    for (i = 0u; i < BENCH_NUM; i++)
+    {
+#if defined(DDL_HOST_MODEL)
+        (void)HOST_LpuartRxPush(0u, (uint16_t)i); /* 每次进入时有一个接收数据 */
+        u64Start = HOST_CycleGet();
+        u32Sum += pfnIsr();
+        u64Cycle += HOST_CycleGet() - u64Start;
+#else
+        u64Start = DDL_TickGet();
+        u32Sum += pfnIsr();
+        u64Cycle += DDL_TickGet() - u64Start;
+#endif
+    }
+
+    pstcResult->u32Result = u32Sum;
+    pstcResult->u32Cycle  = (uint32_t)((u64Cycle + (BENCH_NUM / 2u)) / BENCH_NUM);
+#if defined(DDL_HOST_MODEL)
+    HOST_AccessStatGet(&stcEnd);
+    pstcResult->u32Read  = (uint32_t)((stcEnd.u64Read - stcBegin.u64Read) / BENCH_NUM);
+    pstcResult->u32Write = (uint32_t)((stcEnd.u64Write - stcBegin.u64Write) / BENCH_NUM);
+#else
+    pstcResult->u32Read  = 0u;
+    pstcResult->u32Write = 0u;
+#endif
+}
+
+#if !defined(DDL_HOST_MODEL)
+/**
+ * @brief  目标板：PA01作为LPUART1_TX输出结果（9600bps 8N1）
+ * @retval None
+ */
+static void PrintConfig(void)
+{
+    stc_gpio_init_t   stcGpioInit;
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+PUTCHAR_PROTOTYPE
+{
+    LPUART_TransmitInt(LPUART1, (uint8_t)(ch));
+    return ch;
+}
+#endif
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,398 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides the throughput benchmark of the LPUART framed link
+ *        layer: telemetry samples sent as binary frames without and with
+ *        acknowledge, against the same samples formatted as text lines
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "lpuart_link.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  一种发送方式的测量结果
+ */
+typedef struct
+{
+    uint32_t u32Payload; /*!< 发送的数据字节数 */
+    uint32_t u32Wire;    /*!< 线路字节数（含帧头、CRC、转义、帧结束符及应答帧） */
+    uint32_t u32Retx;    /*!< 重发次数 */
+    uint32_t u32Us;      /*!< 全部发出、收到并释放的时间 */
+} stc_link_result_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_BAUD  (9600u)    /* 目标板打印 */
+#define LINK_BAUD   (115200u)  /* 链路 */
+#define FRAMES      (32u)      /* 每种方式的帧数 */
+#define SMP_PER_FRM (4u)       /* 每帧采样数 */
+#define SMP_CH      (4u)       /* 每个采样的ADC通道数 */
+#define FRM_MAX     (128u)     /* 每帧最大数据长度 */
+#define WINDOW      (4u)       /* 应答方式的窗口 */
+#define RETX_US     (20000u)   /* 应答方式的重发超时 */
+#define RUN_TMO_US  (2000000u) /* 每种方式的最长运行时间 */
+
+#define MODE_BIN_NOACK (0u)
+#define MODE_BIN_ACK   (1u)
+#define MODE_TEXT      (2u)
+#define MODE_NUM       (3u)
+
+#if !defined(DDL_HOST_MODEL)
+#define PUTCHAR_PROTOTYPE int fputc(int ch, FILE *f)
+#endif
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     LinkConfig(void);
+static void     Measure(uint32_t u32Mode, stc_link_result_t *pstcResult);
+static uint16_t FrameBuild(uint32_t u32Mode, uint32_t u32Frame, uint8_t *pu8Buf);
+static uint32_t Hash(uint32_t u32Hash, const uint8_t *pu8Data, uint16_t u16Len);
+static void     OnRx(const uint8_t *pu8Data, uint16_t u16Len, void *pvArg);
+static void     OnTxDone(const uint8_t *pu8Data, uint32_t u32Status, void *pvArg);
+
+#if defined(DDL_HOST_MODEL)
+static void LinkLoopback(uint8_t u8Unit, uint16_t u16Data);
+#else
+static void PrintConfig(void);
+#endif
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32ErrCnt = 0u;
+static stc_lpuart_link_t m_stcLink;
+static uint8_t           m_au8RxBuf[FRM_MAX + LPUART_LINK_OVERHEAD];
+
+/* 发送缓冲池：帧i使用缓冲i%LPUART_LINK_TXQ_SIZE，释放按序，队列未满时该缓冲已释放 */
+static uint8_t m_au8TxPool[LPUART_LINK_TXQ_SIZE][FRM_MAX];
+
+static volatile uint32_t m_u32RxFrames = 0u;
+static volatile uint32_t m_u32RxHash   = 0u;
+static volatile uint32_t m_u32TxDone   = 0u;
+
+static const char *const m_apcMode[MODE_NUM] = {"bin_noack", "bin_ack", "text"};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_link_result_t astcResult[MODE_NUM];
+    uint32_t          i;
+
+#if !defined(DDL_HOST_MODEL)
+    PrintConfig();
+#endif
+    LinkConfig();
+
+    for (i = 0u; i < MODE_NUM; i++)
+    {
+        Measure(i, &astcResult[i]);
+    }
+
+    printf("# lpuart link, frames=%u, samples=%u, baud=%u, hclk=%u, window=%u\n", (unsigned)FRAMES,
+           (unsigned)(FRAMES * SMP_PER_FRM), (unsigned)LINK_BAUD, (unsigned)SystemCoreClock, (unsigned)WINDOW);
+    printf("mode,payload_bytes,wire_bytes,retx,ms,samples_per_s,payload_bytes_per_s,wire_efficiency_pct\n");
+    for (i = 0u; i < MODE_NUM; i++)
+    {
+        printf("%s,%u,%u,%u,%u,%u,%u,%u\n", m_apcMode[i], (unsigned)astcResult[i].u32Payload,
+               (unsigned)astcResult[i].u32Wire, (unsigned)astcResult[i].u32Retx, (unsigned)(astcResult[i].u32Us / 1000u),
+               (unsigned)((uint64_t)FRAMES * SMP_PER_FRM * 1000000u / astcResult[i].u32Us),
+               (unsigned)((uint64_t)astcResult[i].u32Payload * 1000000u / astcResult[i].u32Us),
+               (unsigned)(astcResult[i].u32Payload * 100u / astcResult[i].u32Wire));
+    }
+
+    /* 同一采样的二进制帧短于文本行，采样速率更高 */
+    CHECK(astcResult[MODE_BIN_NOACK].u32Payload < astcResult[MODE_TEXT].u32Payload);
+    CHECK(astcResult[MODE_BIN_NOACK].u32Us < astcResult[MODE_TEXT].u32Us);
+    CHECK(astcResult[MODE_BIN_NOACK].u32Wire < astcResult[MODE_BIN_ACK].u32Wire);
+    CHECK(0u == astcResult[MODE_BIN_ACK].u32Retx);
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+#if defined(DDL_HOST_MODEL)
+    return (0u == u32ErrCnt) ? 0 : 1;
+#else
+    while (1)
+    {
+        ;
+    }
+#endif
+}
+
+/**
+ * @brief  按一种方式发送FRAMES帧：LPUART0发送回环到LPUART0接收，同一链路收发（应答方式下
+ *         应答帧同样回环），从缓冲池直接发送
+ * @param  [in] u32Mode 发送方式
+ * @param  [out] pstcResult 测量结果
+ * @retval None
+ */
+static void Measure(uint32_t u32Mode, stc_link_result_t *pstcResult)
+{
+    stc_lpuart_link_init_t stcInit;
+    stc_ddl_deadline_t     stcTmo;
+    uint64_t               u64Start;
+    uint32_t               u32TxHash = 0u;
+    uint32_t               i;
+    uint8_t               *pu8Buf;
+    uint16_t               u16Len;
+
+    pstcResult->u32Payload = 0u;
+    m_u32RxFrames          = 0u;
+    m_u32RxHash            = 0u;
+    m_u32TxDone            = 0u;
+
+    LPUART_LinkStcInit(&stcInit);
+    stcInit.pu8RxBuf  = m_au8RxBuf;
+    stcInit.u16RxSize = sizeof(m_au8RxBuf);
+    stcInit.u8Window  = (MODE_BIN_ACK == u32Mode) ? WINDOW : 0u;
+    stcInit.u32RetxUs = RETX_US;
+    stcInit.pfnRx     = OnRx;
+    stcInit.pfnTxDone = OnTxDone;
+    CHECK(Ok == LPUART_LinkInit(LPUART0, &m_stcLink, &stcInit, IrqPriorityLevel3));
+
+    DDL_DeadlineInit(&stcTmo, RUN_TMO_US);
+    u64Start = DDL_TimeUsGet();
+    for (i = 0u; i < FRAMES; i++)
+    {
+        /* 等待缓冲释放 */
+        while ((LPUART_LinkPoll(&m_stcLink) >= LPUART_LINK_TXQ_SIZE) && (FALSE == DDL_DeadlineExpired(&stcTmo)))
+        {
+            DDL_Delay10us(1u);
+        }
+        pu8Buf    = m_au8TxPool[i % LPUART_LINK_TXQ_SIZE];
+        u16Len    = FrameBuild(u32Mode, i, pu8Buf);
+        u32TxHash = Hash(u32TxHash, pu8Buf, u16Len);
+        pstcResult->u32Payload += u16Len;
+        CHECK(Ok == LPUART_LinkSend(&m_stcLink, pu8Buf, u16Len));
+    }
+    while (((m_u32RxFrames < FRAMES) || (0u != LPUART_LinkPoll(&m_stcLink))) && (FALSE == DDL_DeadlineExpired(&stcTmo)))
+    {
+        DDL_Delay10us(1u);
+    }
+    pstcResult->u32Us   = (uint32_t)(DDL_TimeUsGet() - u64Start);
+    pstcResult->u32Wire = m_stcLink.u32TxBytes;
+    pstcResult->u32Retx = m_stcLink.u32Retx;
+
+    CHECK(FRAMES == m_u32RxFrames);
+    CHECK(FRAMES == m_u32TxDone);
+    CHECK(u32TxHash == m_u32RxHash);
+    CHECK(0u == m_stcLink.u32RxCrcErr);
+    CHECK(0u == m_stcLink.u32RxLost);
+    LPUART_LinkDeInit(&m_stcLink);
+}
+
+/**
+ * @brief  生成一帧的SMP_PER_FRM个采样：时间戳（us）及SMP_CH个12位ADC值
+ * @param  [in] u32Mode 发送方式：二进制为小端结构，文本为每个采样一行十进制CSV
+ * @param  [in] u32Frame 帧序号
+ * @param  [out] pu8Buf 帧数据
+ * @retval uint16_t 帧数据长度
+ */
+static uint16_t FrameBuild(uint32_t u32Mode, uint32_t u32Frame, uint8_t *pu8Buf)
+{
+    uint32_t u32Smp;
+    uint32_t u32Ts;
+    uint16_t au16Adc[SMP_CH];
+    uint16_t u16Len = 0u;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0u; i < SMP_PER_FRM; i++)
+    {
+        u32Smp = (u32Frame * SMP_PER_FRM) + i;
+        u32Ts  = u32Smp * 1000u;
+        for (j = 0u; j < SMP_CH; j++)
+        {
+            au16Adc[j] = (uint16_t)(((u32Smp * 37u) + (j * 1021u)) & 0xFFFu);
+        }
+
+        if (MODE_TEXT == u32Mode)
+        {
+            u16Len += (uint16_t)sprintf((char *)&pu8Buf[u16Len], "%u,%u,%u,%u,%u\n", (unsigned)u32Ts,
+                                        (unsigned)au16Adc[0], (unsigned)au16Adc[1], (unsigned)au16Adc[2],
+                                        (unsigned)au16Adc[3]);
+        }
+        else
+        {
+            pu8Buf[u16Len++] = (uint8_t)u32Ts;
+            pu8Buf[u16Len++] = (uint8_t)(u32Ts >> 8);
+            pu8Buf[u16Len++] = (uint8_t)(u32Ts >> 16);
+            pu8Buf[u16Len++] = (uint8_t)(u32Ts >> 24);
+            for (j = 0u; j < SMP_CH; j++)
+            {
+                pu8Buf[u16Len++] = (uint8_t)au16Adc[j];
+                pu8Buf[u16Len++] = (uint8_t)(au16Adc[j] >> 8);
+            }
+        }
+    }
+
+    return u16Len;
+}
+
+/**
+ * @brief  数据摘要：收发双方按帧顺序累计，核对交出的数据
+ * @param  [in] u32Hash 上一帧的摘要
+ * @param  [in] pu8Data 数据
+ * @param  [in] u16Len 数据长度
+ * @retval uint32_t 摘要
+ */
+static uint32_t Hash(uint32_t u32Hash, const uint8_t *pu8Data, uint16_t u16Len)
+{
+    uint32_t i;
+
+    for (i = 0u; i < u16Len; i++)
+    {
+        u32Hash = (u32Hash * 31u) + pu8Data[i];
+    }
+
+    return (u32Hash * 31u) + u16Len;
+}
+
+/**
+ * @brief  收到数据帧：累计摘要
+ * @retval None
+ */
+static void OnRx(const uint8_t *pu8Data, uint16_t u16Len, void *pvArg)
+{
+    (void)pvArg;
+
+    m_u32RxHash = Hash(m_u32RxHash, pu8Data, u16Len);
+    m_u32RxFrames++;
+}
+
+/**
+ * @brief  发送缓冲释放：计数（不含中止的帧）
+ * @retval None
+ */
+static void OnTxDone(const uint8_t *pu8Data, uint32_t u32Status, void *pvArg)
+{
+    (void)pu8Data;
+    (void)pvArg;
+
+    if (LPUART_LINK_TX_STS_OK == u32Status)
+    {
+        m_u32TxDone++;
+    }
+}
+
+/**
+ * @brief  链路配置：LPUART0 8位无校验，TX与RX相连
+ * @retval None
+ */
+static void LinkConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+#if !defined(DDL_HOST_MODEL)
+    stc_gpio_init_t stcGpioInit;
+
+    /* 配置PA11为LPUART0_TX，PA10为LPUART0_RX */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_11;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA11_AF_LPUART0_TXD();
+
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_10;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA10_AF_LPUART0_RXD();
+#else
+    HOST_LpuartTxHookSet(LinkLoopback);
+#endif
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32FrameLength      = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = LINK_BAUD;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART0);
+}
+
+#if defined(DDL_HOST_MODEL)
+/**
+ * @brief  LPUART发送帧回调：TX与RX相连
+ * @retval None
+ */
+static void LinkLoopback(uint8_t u8Unit, uint16_t u16Data)
+{
+    (void)HOST_LpuartRxPush(u8Unit, u16Data);
+}
+#else
+/**
+ * @brief  打印串口配置：PA01为LPUART1_TX
+ * @retval None
+ */
+static void PrintConfig(void)
+{
+    stc_gpio_init_t   stcGpioInit;
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+PUTCHAR_PROTOTYPE
+{
+    LPUART_TransmitInt(LPUART1, (uint8_t)(ch));
+    return ch;
+}
+#endif
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
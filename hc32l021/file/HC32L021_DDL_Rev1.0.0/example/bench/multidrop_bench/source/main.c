@@ -0,0 +1,305 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides the wakeup-count benchmark of the LPUART multidrop
+ *        node stack: hardware address detection (ADRDET) against promiscuous
+ *        receive with software address filtering on a 32-node bus
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  一种过滤方式的测量结果
+ */
+typedef struct
+{
+    uint32_t u32Irq;      /*!< 接收中断次数（CPU唤醒次数） */
+    uint32_t u32Frame;    /*!< 交出的帧数 */
+    uint32_t u32Byte;     /*!< 交出的数据字节数 */
+    uint32_t u32Sum;      /*!< 交出数据的校验和（两种方式须一致） */
+    uint32_t u32Us;       /*!< 总线流量持续时间 */
+} stc_node_result_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_BAUD   (9600u)  /* 目标板打印 */
+#define BUS_BAUD     (115200u) /* 总线 */
+#define BUS_NODES    (32u)    /* 总线节点数，地址0~31 */
+#define BUS_FRAMES   (64u)    /* 总线帧数 */
+#define BUS_PAYLOAD  (8u)     /* 每帧数据长度 */
+#define BUS_BCAST    (16u)    /* 每16帧中1帧为广播 */
+#define OWN_ADDR     (0x05u)
+#define BCAST_ADDR   (0xFFu)
+
+#if !defined(DDL_HOST_MODEL)
+#define PUTCHAR_PROTOTYPE int fputc(int ch, FILE *f)
+#endif
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void    BusConfig(void);
+static uint8_t BusDst(uint32_t u32Frame);
+static void    Measure(uint32_t u32Filter, stc_node_result_t *pstcResult);
+static void    OnFrame(uint8_t u8Addr, uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+
+#if defined(DDL_HOST_MODEL)
+static void BusLoopback(uint8_t u8Unit, uint16_t u16Data);
+#else
+static void PrintConfig(void);
+#endif
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32ErrCnt = 0u;
+static stc_lpuart_node_t m_stcNode;
+static uint8_t           m_au8Buf[BUS_PAYLOAD];
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_node_result_t stcHw;
+    stc_node_result_t stcSw;
+    uint32_t          u32OwnFrame = 0u;
+    uint32_t          u32BusByte  = BUS_FRAMES * (2u + BUS_PAYLOAD);
+    uint32_t          i;
+
+#if !defined(DDL_HOST_MODEL)
+    PrintConfig();
+#endif
+    BusConfig();
+
+    Measure(LPUART_NODE_FILTER_SW, &stcSw);
+    Measure(LPUART_NODE_FILTER_HW, &stcHw);
+
+    for (i = 0u; i < BUS_FRAMES; i++)
+    {
+        u32OwnFrame += ((OWN_ADDR == BusDst(i)) || (BCAST_ADDR == BusDst(i))) ? 1u : 0u;
+    }
+
+    printf("# multidrop node rx, nodes=%u, own=0x%02X, bus_frames=%u, bus_bytes=%u, baud=%u, hclk=%u\n", (unsigned)BUS_NODES,
+           (unsigned)OWN_ADDR, (unsigned)BUS_FRAMES, (unsigned)u32BusByte, (unsigned)BUS_BAUD, (unsigned)SystemCoreClock);
+    printf("filter,own_frames,own_bytes,rx_irqs,irqs_per_own_frame,bus_ms,own_bytes_per_s\n");
+    printf("sw,%u,%u,%u,%u,%u,%u\n", (unsigned)stcSw.u32Frame, (unsigned)stcSw.u32Byte, (unsigned)stcSw.u32Irq,
+           (unsigned)(stcSw.u32Irq / stcSw.u32Frame), (unsigned)(stcSw.u32Us / 1000u),
+           (unsigned)((uint64_t)stcSw.u32Byte * 1000000u / stcSw.u32Us));
+    printf("hw,%u,%u,%u,%u,%u,%u\n", (unsigned)stcHw.u32Frame, (unsigned)stcHw.u32Byte, (unsigned)stcHw.u32Irq,
+           (unsigned)(stcHw.u32Irq / stcHw.u32Frame), (unsigned)(stcHw.u32Us / 1000u),
+           (unsigned)((uint64_t)stcHw.u32Byte * 1000000u / stcHw.u32Us));
+
+    /* 两种方式交出的帧相同；软件过滤每字节中断，硬件过滤只在本节点及广播帧中断 */
+    CHECK(u32OwnFrame == stcSw.u32Frame);
+    CHECK(u32OwnFrame == stcHw.u32Frame);
+    CHECK((u32OwnFrame * BUS_PAYLOAD) == stcHw.u32Byte);
+    CHECK(stcSw.u32Sum == stcHw.u32Sum);
+    CHECK(u32BusByte == stcSw.u32Irq);
+    CHECK((u32OwnFrame * (2u + BUS_PAYLOAD)) == stcHw.u32Irq);
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+#if defined(DDL_HOST_MODEL)
+    return (0u == u32ErrCnt) ? 0 : 1;
+#else
+    while (1)
+    {
+        ;
+    }
+#endif
+}
+
+/**
+ * @brief  总线帧的目的地址：节点0~31轮流，每16帧中1帧为广播
+ * @param  [in] u32Frame 帧序号
+ * @retval uint8_t 目的地址
+ */
+static uint8_t BusDst(uint32_t u32Frame)
+{
+    return ((BUS_BCAST - 1u) == (u32Frame % BUS_BCAST)) ? BCAST_ADDR : (uint8_t)(u32Frame % BUS_NODES);
+}
+
+/**
+ * @brief  按一种过滤方式接收总线流量：LPUART0发送（其余节点）回环到LPUART0接收（本节点）
+ * @param  [in] u32Filter 过滤方式 @ref LPUART_Node_Filter
+ * @param  [out] pstcResult 测量结果
+ * @retval None
+ */
+static void Measure(uint32_t u32Filter, stc_node_result_t *pstcResult)
+{
+    stc_lpuart_node_init_t stcInit;
+    uint8_t                au8Data[BUS_PAYLOAD];
+    uint64_t               u64Start;
+    uint32_t               i;
+    uint32_t               j;
+
+    pstcResult->u32Byte = 0u;
+    pstcResult->u32Sum  = 0u;
+
+    LPUART_NodeStcInit(&stcInit);
+    stcInit.u8Addr     = OWN_ADDR;
+    stcInit.u8AddrMsk  = 0xFFu;
+    stcInit.u32Filter  = u32Filter;
+    stcInit.pu8Buf     = m_au8Buf;
+    stcInit.u16BufSize = sizeof(m_au8Buf);
+    stcInit.pfnFrame   = OnFrame;
+    stcInit.pvArg      = pstcResult;
+    CHECK(Ok == LPUART_NodeInit(LPUART0, &m_stcNode, &stcInit, IrqPriorityLevel3));
+
+    u64Start = DDL_TimeUsGet();
+    for (i = 0u; i < BUS_FRAMES; i++)
+    {
+        for (j = 0u; j < BUS_PAYLOAD; j++)
+        {
+            au8Data[j] = (uint8_t)((i * BUS_PAYLOAD) + j);
+        }
+        (void)LPUART_NodeSend(LPUART0, BusDst(i), au8Data, BUS_PAYLOAD, DDL_TIMEOUT_FOREVER);
+    }
+    DDL_Delay1ms(1u); /* 最后一字节的接收中断 */
+    pstcResult->u32Us = (uint32_t)(DDL_TimeUsGet() - u64Start);
+
+    pstcResult->u32Irq   = m_stcNode.u32IrqCnt;
+    pstcResult->u32Frame = m_stcNode.u32FrameCnt;
+    LPUART_NodeDeInit(&m_stcNode);
+}
+
+/**
+ * @brief  帧回调：累计交出的数据
+ * @retval None
+ */
+static void OnFrame(uint8_t u8Addr, uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg)
+{
+    stc_node_result_t *pstcResult = (stc_node_result_t *)pvArg;
+    uint32_t           i;
+
+    CHECK((OWN_ADDR == u8Addr) || (BCAST_ADDR == u8Addr));
+    CHECK(LPUART_FRAME_STS_OK == u32Status);
+
+    for (i = 0u; i < u16Len; i++)
+    {
+        pstcResult->u32Sum = (pstcResult->u32Sum * 31u) + pu8Data[i];
+    }
+    pstcResult->u32Byte += u16Len;
+}
+
+/**
+ * @brief  总线配置：LPUART0多机模式（9位），TX与RX相连
+ * @retval None
+ */
+static void BusConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+#if !defined(DDL_HOST_MODEL)
+    stc_gpio_init_t stcGpioInit;
+
+    /* 配置PA11为LPUART0_TX，PA10为LPUART0_RX */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_11;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA11_AF_LPUART0_TXD();
+
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_10;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA10_AF_LPUART0_RXD();
+#else
+    HOST_LpuartTxHookSet(BusLoopback);
+#endif
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32FrameLength      = LPUART_FRAME_LEN_8B_PAR;
+    stcLpuartInit.u32Parity           = LPUART_B8_MULTI_DataOrAddr;
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BUS_BAUD;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART0);
+}
+
+#if defined(DDL_HOST_MODEL)
+/**
+ * @brief  LPUART发送帧回调：TX与RX相连
+ * @retval None
+ */
+static void BusLoopback(uint8_t u8Unit, uint16_t u16Data)
+{
+    (void)HOST_LpuartRxPush(u8Unit, u16Data);
+}
+#else
+/**
+ * @brief  打印串口配置：PA01为LPUART1_TX
+ * @retval None
+ */
+static void PrintConfig(void)
+{
+    stc_gpio_init_t   stcGpioInit;
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+PUTCHAR_PROTOTYPE
+{
+    LPUART_TransmitInt(LPUART1, (uint8_t)(ch));
+    return ch;
+}
+#endif
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,470 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides the throughput benchmark of the SPI master block
+ *        transfers: the lock-step loop of Rev1.0.0 against the pipelined
+ *        transmit-only, receive-only and full duplex transfers, 8 and 16 bit
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "spi.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  一种传输方式的测量结果
+ */
+typedef struct
+{
+    uint32_t u32BufBytes; /*!< 调用者收发缓冲占用的RAM */
+    uint32_t u32Cycle;    /*!< 传输BYTES字节的HCLK周期数 */
+    uint32_t u32Util;     /*!< 总线利用率（%）：帧时间之和 / 传输时间 */
+    uint32_t u32Ovf;      /*!< 传输后接收上溢标志 */
+} stc_spi_result_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_BAUD (9600u) /* 目标板打印 */
+#define BYTES      (256u)  /* 每次传输的字节数（一个存储器页） */
+#define FILL       (0xA5u) /* 只收时发送的填充值 */
+
+#define API_LOCKSTEP (0u) /* Rev1.0.0 SPI_TransmitReceive()：每帧等待接收后再写下一帧 */
+#define API_TXRX_U16 (1u) /* SPI_TransmitReceive()：16位缓冲接口，8位帧 */
+#define API_TX8      (2u)
+#define API_RX8      (3u)
+#define API_TXRX8    (4u)
+#define API_TXRX16   (5u) /* 16位帧，BYTES/2个字 */
+#define API_NUM      (6u)
+
+#define DIV_NUM (2u)
+
+#define OVF_BYTES   (16u) /* 主机模型上溢检查的传输字节数 */
+#define OVF_PREEMPT (5u)  /* 第几帧移位完成时挂起抢占中断 */
+
+#if !defined(DDL_HOST_MODEL)
+#define PUTCHAR_PROTOTYPE int fputc(int ch, FILE *f)
+#endif
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void        SpiConfig(uint32_t u32BaudRate, uint32_t u32DataWidth);
+static void        Measure(uint32_t u32Api, uint32_t u32Div, stc_spi_result_t *pstcResult);
+static en_result_t LockStep(uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len);
+static uint64_t    BenchStamp(void);
+
+#if defined(DDL_HOST_MODEL)
+static void     OvfCheck(void);
+static uint16_t PreemptDevice(uint16_t u16Tx);
+#else
+static void PrintConfig(void);
+#endif
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+
+/* 16位缓冲接口需要2倍RAM：发送及接收各BYTES个uint16_t */
+static uint16_t m_au16Tx[BYTES];
+static uint16_t m_au16Rx[BYTES];
+static uint8_t  m_au8Tx[BYTES];
+static uint8_t  m_au8Rx[BYTES];
+
+static const char *const m_apcApi[API_NUM] = {"lockstep_u16", "SPI_TransmitReceive", "SPI_Transmit8",
+                                              "SPI_Receive8", "SPI_TransmitReceive8", "SPI_TransmitReceive16"};
+static const uint32_t    m_au32Div[DIV_NUM]    = {SPI_BAUDRATE_PCLK_DIV2, SPI_BAUDRATE_PCLK_DIV8};
+
+#if defined(DDL_HOST_MODEL)
+static uint32_t m_u32DevFrames = 0u; /* 从设备模型收到的帧数 */
+static uint32_t m_u32Preempt   = 0u; /* 抢占时长（HCLK周期），0为不抢占 */
+#endif
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_spi_result_t astcResult[DIV_NUM][API_NUM];
+    uint32_t         i;
+    uint32_t         j;
+
+#if !defined(DDL_HOST_MODEL)
+    PrintConfig();
+#else
+    HOST_SpiDeviceSet(NULL); /* MISO回环MOSI */
+#endif
+
+    for (i = 0u; i < BYTES; i++)
+    {
+        m_au8Tx[i]  = (uint8_t)((i * 7u) + 3u);
+        m_au16Tx[i] = m_au8Tx[i];
+    }
+
+    for (j = 0u; j < DIV_NUM; j++)
+    {
+        for (i = 0u; i < API_NUM; i++)
+        {
+            Measure(i, j, &astcResult[j][i]);
+        }
+    }
+
+    /* 旧接口NULL缓冲：发送0xFFFF、丢弃接收；SPI未使能时按总时长超时返回 */
+    SpiConfig(SPI_BAUDRATE_PCLK_DIV2, SPI_DATA_WIDTH_8BIT);
+    CHECK(Ok == SPI_TransmitReceive(SPI, NULL, NULL, 4u));
+    SPI_Disable(SPI);
+    CHECK(ErrorTimeout == SPI_Receive8(SPI, m_au8Rx, 4u, FILL, 100u));
+#if defined(DDL_HOST_MODEL)
+    OvfCheck();
+#endif
+
+    printf("# spi master block transfer, bytes=%u, hclk=%u, pclk=hclk\n", (unsigned)BYTES, (unsigned)SystemCoreClock);
+    printf("api,pclk_div,buf_bytes,cycles,cycles_per_byte,bytes_per_s,bus_util_pct\n");
+    for (j = 0u; j < DIV_NUM; j++)
+    {
+        for (i = 0u; i < API_NUM; i++)
+        {
+            printf("%s,%u,%u,%u,%u,%u,%u\n", m_apcApi[i], (unsigned)(2u << (m_au32Div[j] >> SPI_CR0_BRR_Pos)),
+                   (unsigned)astcResult[j][i].u32BufBytes, (unsigned)astcResult[j][i].u32Cycle,
+                   (unsigned)(astcResult[j][i].u32Cycle / BYTES),
+                   (unsigned)((uint64_t)BYTES * SystemCoreClock / astcResult[j][i].u32Cycle),
+                   (unsigned)astcResult[j][i].u32Util);
+        }
+    }
+
+    for (j = 0u; j < DIV_NUM; j++)
+    {
+        /* 流水线收发不慢于逐帧等待，且不上溢 */
+        for (i = API_TXRX_U16; i < API_NUM; i++)
+        {
+            CHECK(astcResult[j][i].u32Cycle <= astcResult[j][API_LOCKSTEP].u32Cycle);
+            CHECK(0u == astcResult[j][i].u32Ovf);
+        }
+    }
+    /* 8位接口只需一半或四分之一的缓冲 */
+    CHECK(astcResult[0][API_TX8].u32BufBytes * 4u == astcResult[0][API_TXRX_U16].u32BufBytes);
+    CHECK(astcResult[0][API_TXRX8].u32BufBytes * 2u == astcResult[0][API_TXRX_U16].u32BufBytes);
+#if defined(DDL_HOST_MODEL)
+    /* 主机模型：流水线帧间无空闲，逐帧等待在PCLK/2时有明显空闲 */
+    CHECK(astcResult[0][API_TXRX8].u32Util > astcResult[0][API_LOCKSTEP].u32Util);
+    CHECK(astcResult[0][API_TXRX8].u32Util >= 95u);
+    CHECK(astcResult[1][API_TXRX8].u32Util >= 95u);
+    CHECK(astcResult[1][API_RX8].u32Util >= 95u);
+#endif
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+#if defined(DDL_HOST_MODEL)
+    return (0u == u32ErrCnt) ? 0 : 1;
+#else
+    while (1)
+    {
+        ;
+    }
+#endif
+}
+
+/**
+ * @brief  测量一种传输方式：传输BYTES字节，检查回环数据（MOSI接MISO）
+ * @param  [in] u32Api 传输方式
+ * @param  [in] u32Div 分频序号
+ * @param  [out] pstcResult 测量结果
+ * @retval None
+ */
+static void Measure(uint32_t u32Api, uint32_t u32Div, stc_spi_result_t *pstcResult)
+{
+    uint64_t    u64Start;
+    uint32_t    u32Frame;
+    uint32_t    i;
+    en_result_t enRet = Error;
+
+    SpiConfig(m_au32Div[u32Div], (API_TXRX16 == u32Api) ? SPI_DATA_WIDTH_16BIT : SPI_DATA_WIDTH_8BIT);
+    for (i = 0u; i < BYTES; i++)
+    {
+        m_au8Rx[i]  = 0u;
+        m_au16Rx[i] = 0u;
+    }
+
+    u64Start = BenchStamp();
+    switch (u32Api)
+    {
+        case API_LOCKSTEP:
+            enRet = LockStep(m_au16Tx, m_au16Rx, BYTES);
+            break;
+        case API_TXRX_U16:
+            enRet = SPI_TransmitReceive(SPI, m_au16Tx, m_au16Rx, BYTES);
+            break;
+        case API_TX8:
+            enRet = SPI_Transmit8(SPI, m_au8Tx, BYTES, DDL_TIMEOUT_FOREVER);
+            break;
+        case API_RX8:
+            enRet = SPI_Receive8(SPI, m_au8Rx, BYTES, FILL, DDL_TIMEOUT_FOREVER);
+            break;
+        case API_TXRX8:
+            enRet = SPI_TransmitReceive8(SPI, m_au8Tx, m_au8Rx, BYTES, DDL_TIMEOUT_FOREVER);
+            break;
+        default:
+            enRet = SPI_TransmitReceive16(SPI, (const uint16_t *)(const void *)m_au8Tx, (uint16_t *)(void *)m_au8Rx,
+                                          BYTES / 2u, DDL_TIMEOUT_FOREVER);
+            break;
+    }
+    pstcResult->u32Cycle = (uint32_t)(BenchStamp() - u64Start);
+    pstcResult->u32Ovf   = (TRUE == SPI_FlagGet(SPI, SPI_FLAG_OVF)) ? 1u : 0u;
+    CHECK(Ok == enRet);
+
+    /* 一帧：数据位数 x (2 << BRR) 个PCLK */
+    u32Frame            = 8u * (2u << (m_au32Div[u32Div] >> SPI_CR0_BRR_Pos));
+    pstcResult->u32Util = (uint32_t)((uint64_t)u32Frame * BYTES * 100u / pstcResult->u32Cycle);
+
+    switch (u32Api)
+    {
+        case API_LOCKSTEP:
+        case API_TXRX_U16:
+            pstcResult->u32BufBytes = 2u * BYTES * sizeof(uint16_t);
+            for (i = 0u; i < BYTES; i++)
+            {
+                CHECK(m_au16Tx[i] == m_au16Rx[i]);
+            }
+            break;
+        case API_TX8:
+            pstcResult->u32BufBytes = BYTES;
+            break;
+        case API_RX8:
+            pstcResult->u32BufBytes = BYTES;
+            for (i = 0u; i < BYTES; i++)
+            {
+                CHECK(FILL == m_au8Rx[i]);
+            }
+            break;
+        default:
+            pstcResult->u32BufBytes = 2u * BYTES;
+            for (i = 0u; i < BYTES; i++)
+            {
+                CHECK(m_au8Tx[i] == m_au8Rx[i]);
+            }
+            break;
+    }
+
+    SPI_Disable(SPI);
+}
+
+/**
+ * @brief  Rev1.0.0的SPI_TransmitReceive()：写一帧后等待接收完成再写下一帧
+ * @param  [in] pu16SendBuf 发送数据
+ * @param  [out] pu16RecBuf 接收数据
+ * @param  [in] u32Len 数据长度
+ * @retval en_result_t
+ *         - Ok 收发完成
+ */
+static en_result_t LockStep(uint16_t pu16SendBuf[], uint16_t pu16RecBuf[], uint32_t u32Len)
+{
+    uint32_t u32Index;
+
+    for (u32Index = 0u; u32Index < u32Len; u32Index++)
+    {
+        while (FALSE == SPI->SR_f.TXE) {}
+
+        SPI->DR = pu16SendBuf[u32Index];
+
+        while (FALSE == SPI->SR_f.RXNE) {}
+
+        pu16RecBuf[u32Index] = (uint16_t)SPI->DR;
+    }
+
+    while (FALSE == SPI->SR_f.TXE) {}
+    while (TRUE == SPI->SR_f.BUSY) {}
+
+    return Ok;
+}
+
+/**
+ * @brief  计时基准：目标板为SysTick时基，主机模型为模拟HCLK周期
+ * @retval uint64_t 当前时刻（HCLK周期）
+ */
+static uint64_t BenchStamp(void)
+{
+#if defined(DDL_HOST_MODEL)
+    return HOST_CycleGet();
+#else
+    return DDL_TickGet();
+#endif
+}
+
+/**
+ * @brief  SPI主机配置：PA06 SCK，PA09 MOSI，PA08 MISO（目标板上MOSI与MISO相连）
+ * @param  [in] u32BaudRate 波特率分频 @ref SPI_Baudrate_Select
+ * @param  [in] u32DataWidth 数据宽度 @ref SPI_Data_Width_Select
+ * @retval None
+ */
+static void SpiConfig(uint32_t u32BaudRate, uint32_t u32DataWidth)
+{
+    stc_spi_init_t stcSpiInit;
+#if !defined(DDL_HOST_MODEL)
+    stc_gpio_init_t stcGpioInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32Pin  = GPIO_PIN_06 | GPIO_PIN_09;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_08;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA06_AF_SPI_SCK();
+    GPIO_PA09_AF_SPI_MOSI();
+    GPIO_PA08_AF_SPI_MISO();
+#endif
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SYSCTRL_PeriphReset(PeriphResetSpi);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32BaudRate  = u32BaudRate;
+    stcSpiInit.u32Mode      = SPI_MD_MASTER;
+    stcSpiInit.u32DataWidth = u32DataWidth;
+    stcSpiInit.u32NSS       = SPI_NSS_HARD_OUTPUT;
+    SPI_Init(SPI, &stcSpiInit);
+    SPI_FlagClearALL(SPI);
+    SPI_Enable(SPI);
+}
+
+#if defined(DDL_HOST_MODEL)
+/**
+ * @brief  主机模型：收发中被中断抢占超过两帧时间，接收上溢：丢失的字位置不写入，其余字正确，
+ *         返回Error并清除上溢标志；只发送时不报告；下一次传输不受影响
+ * @retval None
+ */
+static void OvfCheck(void)
+{
+    uint32_t i;
+    uint32_t u32Lost = 0u;
+
+    HOST_SpiDeviceSet(PreemptDevice);
+    EnableNvic(CTIM0_IRQn, IrqPriorityLevel3, TRUE);
+    SpiConfig(SPI_BAUDRATE_PCLK_DIV8, SPI_DATA_WIDTH_8BIT);
+
+    memset(m_au8Rx, 0, OVF_BYTES);
+    m_u32DevFrames = 0u;
+    m_u32Preempt   = 4u * 8u * (2u << (SPI_BAUDRATE_PCLK_DIV8 >> SPI_CR0_BRR_Pos));
+    CHECK(Error == SPI_TransmitReceive8(SPI, m_au8Tx, m_au8Rx, OVF_BYTES, DDL_TIMEOUT_FOREVER));
+    CHECK(FALSE == SPI_FlagGet(SPI, SPI_FLAG_OVF));
+    CHECK(OVF_BYTES == m_u32DevFrames);
+    for (i = 0u; i < OVF_BYTES; i++)
+    {
+        if (m_au8Tx[i] != m_au8Rx[i])
+        {
+            CHECK(0u == m_au8Rx[i]);
+            u32Lost++;
+        }
+    }
+    CHECK(1u == u32Lost);
+
+    m_u32DevFrames = 0u;
+    CHECK(Ok == SPI_Transmit8(SPI, m_au8Tx, OVF_BYTES, DDL_TIMEOUT_FOREVER));
+    CHECK(OVF_BYTES == m_u32DevFrames);
+    CHECK(FALSE == SPI_FlagGet(SPI, SPI_FLAG_OVF));
+
+    m_u32Preempt = 0u;
+    CHECK(Ok == SPI_TransmitReceive8(SPI, m_au8Tx, m_au8Rx, OVF_BYTES, DDL_TIMEOUT_FOREVER));
+    CHECK(0 == memcmp(m_au8Tx, m_au8Rx, OVF_BYTES));
+
+    EnableNvic(CTIM0_IRQn, IrqPriorityLevel3, FALSE);
+    HOST_SpiDeviceSet(NULL);
+    SPI_Disable(SPI);
+}
+
+/**
+ * @brief  从设备模型：MISO回环MOSI，第OVF_PREEMPT帧时挂起CTIM0中断模拟抢占
+ * @param  [in] u16Tx 主机发出的帧
+ * @retval uint16_t 从机回送的帧
+ */
+static uint16_t PreemptDevice(uint16_t u16Tx)
+{
+    m_u32DevFrames++;
+    if ((0u != m_u32Preempt) && (OVF_PREEMPT == m_u32DevFrames))
+    {
+        HOST_IrqPend((int32_t)CTIM0_IRQn);
+    }
+
+    return u16Tx;
+}
+
+/**
+ * @brief  CTIM0中断：占用m_u32Preempt个周期
+ * @retval None
+ */
+void Ctim0_IRQHandler(void)
+{
+    HOST_CycleAdvance(m_u32Preempt);
+}
+#else
+/**
+ * @brief  打印串口配置：LPUART1 TX PA01，9600bps
+ * @retval None
+ */
+static void PrintConfig(void)
+{
+    stc_gpio_init_t   stcGpioInit;
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = BENCH_BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+PUTCHAR_PROTOTYPE
+{
+    LPUART_TransmitInt(LPUART1, (uint8_t)(ch));
+    return ch;
+}
+#endif
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -35,9 +35,11 @@
  * Local function prototypes ('static')
  ******************************************************************************/
 static void GpioUserKeyConfig(void);
+static void UserKeyCallback(uint32_t u32Flags, void *pvArg);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static stc_int_cb_t stcUserKeyCb = {0}; /* USER KEY中断回调节点 */
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -58,20 +60,22 @@ int32_t main(void)
 }
 
 /**
- * @brief  PortA中断服务函数
+ * @brief  USER KEY中断回调（PortA中断中按引脚分发）
+ * @param  [in] u32Flags PortA中断状态
+ * @param  [in] pvArg 回调参数
  * @retval None
  */
-void PortA_IRQHandler(void)
+static void UserKeyCallback(uint32_t u32Flags, void *pvArg)
 {
-    if (TRUE == GPIO_IntFlagGet(STK_USER_PORT, STK_USER_PIN)) /* 获取中断状态 */
-    {
-        STK_LED_ON(); /* LED点亮 */
-        DDL_Delay1ms(2000);
+    (void)u32Flags;
+    (void)pvArg;
 
-        STK_LED_OFF(); /* LED关闭 */
+    STK_LED_ON(); /* LED点亮 */
+    DDL_Delay1ms(2000);
 
-        GPIO_IntFlagClear(STK_USER_PORT, STK_USER_PIN); /* 清除中断标志位 */
-    }
+    STK_LED_OFF(); /* LED关闭 */
+
+    GPIO_IntFlagClear(STK_USER_PORT, STK_USER_PIN); /* 清除中断标志位 */
 }
 
 /**
@@ -89,7 +93,10 @@ static void GpioUserKeyConfig(void)
     stcGpioInit.u32ExternInt = GPIO_EXTI_LOW;        /* 端口外部中断触发方式配置 */
     stcGpioInit.u32Pin       = STK_USER_PIN;         /* 端口引脚配置 */
     GPIOA_Init(&stcGpioInit);                        /* GPIO USER KEY初始化 */
-    EnableNvic(PORTA_IRQn, IrqPriorityLevel3, TRUE); /* 使能端口PORTA系统中断 */
+
+    stcUserKeyCb.pfnCallback = UserKeyCallback;
+    stcUserKeyCb.u32SrcMask  = STK_USER_PIN;
+    INT_CallbackRegister(PORTA_IRQn, &stcUserKeyCb, IrqPriorityLevel3); /* 注册回调并使能端口PORTA系统中断 */
 }
 
 /******************************************************************************
@@ -50,6 +50,8 @@ int32_t main(void)
 {
     GpioIrFuncConfig(); /* IR 功能配置 */
 
+    DDL_DelayModeSet(DDL_DELAY_MD_SLEEP); /* 延时期间CPU进入休眠，降低功耗 */
+
     DDL_Delay1ms(3000);
 
     while (1)
@@ -0,0 +1,527 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the deferred binary log (DDL_LogWrite,
+ *        DDL_LogRead, LOG_Decode) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <string.h>
+#include "btim.h"
+#include "ddl.h"
+#include "ddl_log.h"
+#include "log_dec.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/* 格式字符串表：目标板只使用枚举ID，主机解码使用字符串 */
+#define LOG_FMT_TABLE(X)                                     \
+    X(LOG_BOOT, "boot, hclk=%u Hz")                          \
+    X(LOG_ADC, "adc ch%u = %u mV")                           \
+    X(LOG_SIGNED, "t=%d dt=%+d")                             \
+    X(LOG_HEX, "reg %08X %#x %x")                            \
+    X(LOG_WIDTH, "[%5u] [%-5d] [%05d] [%.3u]")               \
+    X(LOG_PCT, "load %u%%")                                  \
+    X(LOG_CHAR, "%c%c")                                      \
+    X(LOG_LONG, "%lu %ld")                                   \
+    X(LOG_PTR, "%p")                                         \
+    X(LOG_IDLE, "idle")                                      \
+    X(LOG_PAIR, "%u %u")                                     \
+    X(LOG_STR, "name=%s")                                    \
+    X(LOG_MAIN, "main %u")                                   \
+    X(LOG_ISR, "isr %u")
+
+typedef enum
+{
+    LOG_FMT_TABLE(DDL_LOG_FMT_ID) LOG_FMT_NUM
+} en_log_fmt_id_t;
+
+/**
+ * @brief  一条测试记录及期望文本
+ */
+typedef struct
+{
+    uint32_t    u32Id;       /*!< 格式ID */
+    uint32_t    u32Argc;     /*!< 参数个数 */
+    uint32_t    au32Arg[4];  /*!< 参数 */
+    const char *pcText;      /*!< 期望的解码文本 */
+} stc_log_case_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define LOG_WORDS   (64u)
+#define STREAM_MAX  (8192u)
+#define TEXT_MAX    (64u)
+#define IRQ_LOOPS   (400u)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     ParamCheck(void);
+static void     FormatCheck(void);
+static void     SplitCheck(void);
+static void     DropCheck(void);
+static void     ResyncCheck(void);
+static void     IrqCheck(void);
+static void     CostCheck(void);
+static void     CaseWrite(const stc_log_case_t *pstcCase, uint32_t u32Num);
+static uint32_t StreamDrain(uint8_t *pu8Buf, uint32_t u32Size, uint32_t u32Chunk);
+static uint32_t StreamDecode(const uint8_t *pu8Buf, uint32_t u32Len, char (*pacText)[TEXT_MAX], uint32_t u32Max);
+static void     TimerCallback(uint32_t u32Flags, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32ErrCnt = 0u;
+static uint32_t          m_au32Log[LOG_WORDS];
+static uint8_t           m_au8Stream[STREAM_MAX];
+static char              m_aacText[2u * IRQ_LOOPS][TEXT_MAX];
+static stc_log_dec_t m_stcDec;
+static uint32_t          m_u32IsrSeq = 0u;
+
+static const char *const m_apcLogFmt[] = {LOG_FMT_TABLE(DDL_LOG_FMT_STR)};
+
+static const stc_log_case_t m_astcCase[] = {
+    {LOG_BOOT, 1u, {48000000u}, "boot, hclk=48000000 Hz"},
+    {LOG_ADC, 2u, {3u, 1234u}, "adc ch3 = 1234 mV"},
+    {LOG_SIGNED, 2u, {(uint32_t)-40, 5u}, "t=-40 dt=+5"},
+    {LOG_HEX, 3u, {0xDEADBEEFu, 0xC0u, 0xDBu}, "reg DEADBEEF 0xc0 db"},
+    {LOG_WIDTH, 4u, {42u, (uint32_t)-7, (uint32_t)-7, 5u}, "[   42] [-7   ] [-0007] [005]"},
+    {LOG_PCT, 1u, {87u}, "load 87%"},
+    {LOG_CHAR, 2u, {'o', 'k'}, "ok"},
+    {LOG_LONG, 2u, {4000000000u, 0xFFFFFFFFu}, "4000000000 -1"},
+    {LOG_PTR, 1u, {0x20000100u}, "0x20000100"},
+    {LOG_IDLE, 0u, {0u}, "idle"},
+    {LOG_PAIR, 1u, {7u}, "7 ?"},                               /* 参数不足 */
+    {LOG_STR, 1u, {0x20000000u}, "name=?"},                    /* 不支持%s */
+    {LOG_PAIR, 2u, {0xC0C0C0C0u, 0xDBDBu}, "3233857728 56283"}, /* 需转义的字节 */
+};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    ParamCheck();
+    FormatCheck();
+    SplitCheck();
+    DropCheck();
+    ResyncCheck();
+    IrqCheck();
+    CostCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查；初始化前写入计为丢弃，读出为空
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    uint8_t           au8Buf[4];
+    stc_log_dec_t stcDec;
+
+    DDL_LOG1(LOG_BOOT, 1u);
+    CHECK(0u == DDL_LogRead(au8Buf, sizeof(au8Buf)));
+    CHECK(1u == DDL_LogDropCountGet());
+
+    CHECK(ErrorInvalidParameter == DDL_LogInit(NULL, LOG_WORDS));
+    CHECK(ErrorInvalidParameter == DDL_LogInit(m_au32Log, 4u));  /* 小于8字 */
+    CHECK(ErrorInvalidParameter == DDL_LogInit(m_au32Log, 48u)); /* 不是2的幂 */
+    CHECK(Ok == DDL_LogInit(m_au32Log, 8u));
+    CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+    CHECK(0u == DDL_LogDropCountGet());
+
+    /* 初始化后首先输出帧结束符 */
+    CHECK((1u == DDL_LogRead(au8Buf, sizeof(au8Buf))) && (0xC0u == au8Buf[0]));
+    CHECK(0u == DDL_LogRead(au8Buf, sizeof(au8Buf)));
+
+    CHECK(ErrorInvalidParameter == LOG_DecodeInit(NULL, m_apcLogFmt, LOG_FMT_NUM));
+    CHECK(ErrorInvalidParameter == LOG_DecodeInit(&stcDec, NULL, LOG_FMT_NUM));
+    CHECK(Ok == LOG_DecodeInit(&stcDec, NULL, 0u));
+}
+
+/**
+ * @brief  各种转换说明的解码文本；与printf文本比较编码长度
+ * @retval None
+ */
+static void FormatCheck(void)
+{
+    uint32_t u32Len;
+    uint32_t u32Num;
+    uint32_t u32Text = 0u;
+    uint32_t i;
+
+    CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+    CaseWrite(m_astcCase, ARRAY_SZ(m_astcCase));
+    CHECK(0u != DDL_LogPendingGet());
+    u32Len = StreamDrain(m_au8Stream, sizeof(m_au8Stream), sizeof(m_au8Stream));
+    CHECK(0u == DDL_LogPendingGet());
+
+    /* 编码流中0xC0只作为帧结束符 */
+    for (i = 0u, u32Num = 0u; i < u32Len; i++)
+    {
+        u32Num += (0xC0u == m_au8Stream[i]) ? 1u : 0u;
+    }
+    CHECK((ARRAY_SZ(m_astcCase) + 1u) == u32Num);
+
+    u32Num = StreamDecode(m_au8Stream, u32Len, m_aacText, ARRAY_SZ(m_aacText));
+    CHECK(ARRAY_SZ(m_astcCase) == u32Num);
+    for (i = 0u; (i < u32Num) && (i < ARRAY_SZ(m_astcCase)); i++)
+    {
+        if (0 != strcmp(m_astcCase[i].pcText, m_aacText[i]))
+        {
+            printf("  case %u: \"%s\" != \"%s\"\n", (unsigned)i, m_aacText[i], m_astcCase[i].pcText);
+            u32ErrCnt++;
+        }
+        u32Text += (uint32_t)strlen(m_astcCase[i].pcText) + 2u; /* printf文本含\r\n */
+    }
+    CHECK(ARRAY_SZ(m_astcCase) == m_stcDec.u32RecCnt);
+    CHECK(0u == m_stcDec.u32ErrCnt);
+    printf("records=%u stream_bytes=%u text_bytes=%u\n", (unsigned)u32Num, (unsigned)u32Len, (unsigned)u32Text);
+    CHECK(u32Len < u32Text);
+
+    /* 文本缓冲不足时截断，总以'\0'结束 */
+    {
+        char     acShort[8];
+        uint32_t u32Ret = 0u;
+
+        CaseWrite(&m_astcCase[4], 1u);
+        u32Len = StreamDrain(m_au8Stream, sizeof(m_au8Stream), sizeof(m_au8Stream));
+        for (i = 0u; i < u32Len; i++)
+        {
+            u32Ret = LOG_Decode(&m_stcDec, m_au8Stream[i], acShort, sizeof(acShort));
+        }
+        CHECK((7u == u32Ret) && (0 == strcmp("[   42]", acShort)));
+    }
+}
+
+/**
+ * @brief  逐字节取出与一次取出的字节流相同；缓冲回绕
+ * @retval None
+ */
+static void SplitCheck(void)
+{
+    static uint8_t au8Byte[STREAM_MAX];
+    uint32_t       u32Len = 0u;
+    uint32_t       u32Len1;
+    uint32_t       i;
+
+    for (i = 0u; i < 5u; i++)
+    {
+        CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+        CaseWrite(m_astcCase, ARRAY_SZ(m_astcCase));
+        if (0u == i)
+        {
+            u32Len = StreamDrain(m_au8Stream, sizeof(m_au8Stream), sizeof(m_au8Stream));
+        }
+        else
+        {
+            u32Len1 = StreamDrain(au8Byte, sizeof(au8Byte), i);
+            CHECK((u32Len == u32Len1) && (0 == memcmp(m_au8Stream, au8Byte, u32Len)));
+        }
+    }
+
+    /* 写入、取出交替，索引多次回绕 */
+    CHECK(Ok == DDL_LogInit(m_au32Log, 8u));
+    (void)StreamDrain(au8Byte, sizeof(au8Byte), sizeof(au8Byte));
+    for (i = 0u; i < 100u; i++)
+    {
+        DDL_LOG3(LOG_HEX, i, i * 3u, i ^ 0xC0u);
+        DDL_LOG2(LOG_PAIR, i, 0u - i);
+        u32Len = StreamDrain(au8Byte, sizeof(au8Byte), 3u);
+        CHECK(2u == StreamDecode(au8Byte, u32Len, m_aacText, ARRAY_SZ(m_aacText)));
+    }
+    CHECK(0u == DDL_LogDropCountGet());
+    CHECK(0 == strcmp("99 4294967197", m_aacText[1]));
+}
+
+/**
+ * @brief  缓冲满丢弃，有空间后先报告丢弃条数
+ * @retval None
+ */
+static void DropCheck(void)
+{
+    uint32_t u32Len;
+    uint32_t u32Num;
+
+    CHECK(Ok == DDL_LogInit(m_au32Log, 8u));
+    DDL_LOG2(LOG_ADC, 1u, 100u); /* 3字 */
+    DDL_LOG2(LOG_ADC, 2u, 200u); /* 3字 */
+    DDL_LOG2(LOG_ADC, 3u, 300u); /* 丢弃 */
+    DDL_LOG0(LOG_IDLE);          /* 丢弃：报告丢弃须另加2字 */
+    CHECK(2u == DDL_LogDropCountGet());
+    CHECK(6u == DDL_LogPendingGet());
+
+    u32Len = StreamDrain(m_au8Stream, sizeof(m_au8Stream), 4u);
+    DDL_LOG2(LOG_ADC, 4u, 400u);
+    u32Len += StreamDrain(&m_au8Stream[u32Len], sizeof(m_au8Stream) - u32Len, 4u);
+
+    u32Num = StreamDecode(m_au8Stream, u32Len, m_aacText, ARRAY_SZ(m_aacText));
+    CHECK(4u == u32Num);
+    CHECK(0 == strcmp("adc ch1 = 100 mV", m_aacText[0]));
+    CHECK(0 == strcmp("adc ch2 = 200 mV", m_aacText[1]));
+    CHECK(0 == strcmp("<2 log records dropped>", m_aacText[2]));
+    CHECK(0 == strcmp("adc ch4 = 400 mV", m_aacText[3]));
+    CHECK((2u == m_stcDec.u32DropCnt) && (3u == m_stcDec.u32RecCnt));
+    CHECK(2u == DDL_LogDropCountGet());
+}
+
+/**
+ * @brief  帧同步前的残余字节、未知ID、超长记录：输出提示，之后的记录正常解码
+ * @retval None
+ */
+static void ResyncCheck(void)
+{
+    static const uint8_t au8Noise[] = {0x12u, 0x85u};
+    uint8_t              au8Long[40];
+    uint32_t             u32Len = 0u;
+    uint32_t             u32Num;
+
+    CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+    memcpy(m_au8Stream, au8Noise, sizeof(au8Noise));
+    u32Len += sizeof(au8Noise);
+    DDL_LOG0(200u);
+    DDL_LOG0(LOG_IDLE);
+    u32Len += StreamDrain(&m_au8Stream[u32Len], sizeof(m_au8Stream) - u32Len, sizeof(m_au8Stream));
+
+    /* 超长记录（参数超过4个） */
+    memset(au8Long, 0x01, sizeof(au8Long));
+    au8Long[sizeof(au8Long) - 1u] = 0xC0u;
+    memcpy(&m_au8Stream[u32Len], au8Long, sizeof(au8Long));
+    u32Len += sizeof(au8Long);
+    DDL_LOG1(LOG_PCT, 5u);
+    u32Len += StreamDrain(&m_au8Stream[u32Len], sizeof(m_au8Stream) - u32Len, sizeof(m_au8Stream));
+
+    u32Num = StreamDecode(m_au8Stream, u32Len, m_aacText, ARRAY_SZ(m_aacText));
+    CHECK(5u == u32Num);
+    CHECK(0 == strcmp("<bad log record, 2 bytes>", m_aacText[0]));
+    CHECK(0 == strcmp("<unknown log id 200>", m_aacText[1]));
+    CHECK(0 == strcmp("idle", m_aacText[2]));
+    CHECK(0 == strcmp("<bad log record, 23 bytes>", m_aacText[3]));
+    CHECK(0 == strcmp("load 5%", m_aacText[4]));
+    CHECK((3u == m_stcDec.u32ErrCnt) && (2u == m_stcDec.u32RecCnt));
+}
+
+/**
+ * @brief  线程与BTIM0中断同时写入，线程取出：两路记录各自完整、有序
+ * @retval None
+ */
+static void IrqCheck(void)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit;
+    stc_btim_init_t          stcBtimInit;
+    stc_int_cb_t             stcCb = {0};
+    uint32_t                 u32Len = 0u;
+    uint32_t                 u32Num;
+    uint32_t                 u32Main = 0u;
+    uint32_t                 u32Isr  = 0u;
+    uint32_t                 u32Seq;
+    uint32_t                 u32Mixed = 0u;
+    uint32_t                 i;
+
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+    stcSysClockInit.u32SysClockSrc = SYSCTRL_CLK_SRC_RC48M_48M;
+    SYSCTRL_ClockInit(&stcSysClockInit);
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+
+    CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+    (void)StreamDrain(m_au8Stream, sizeof(m_au8Stream), sizeof(m_au8Stream));
+
+    stcCb.pfnCallback = TimerCallback;
+    stcCb.u32SrcMask  = BTIM03_AIT_FLAG_UI;
+    CHECK(Ok == INT_CallbackRegister(CTIM0_IRQn, &stcCb, IrqPriorityLevel1));
+
+    BTIM_StcInit(&stcBtimInit);
+    stcBtimInit.u32Prescaler       = BTIM_COUNTER_CLK_DIV1;
+    stcBtimInit.u32AutoReloadValue = 97u;
+    (void)BTIM_Init(BTIM0, &stcBtimInit);
+    BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);
+    BTIM_IntEnable(BTIM0, BTIM_INT_UI);
+    BTIM_Enable(BTIM0);
+
+    for (i = 0u; i < IRQ_LOOPS; i++)
+    {
+        DDL_LOG1(LOG_MAIN, i);
+        HOST_CycleAdvance(60u);
+        (void)BTIM_CounterGet(BTIM0);
+        u32Len += DDL_LogRead(&m_au8Stream[u32Len], 8u);
+    }
+    BTIM_Disable(BTIM0);
+    BTIM_IntDisable(BTIM0, BTIM_INT_UI);
+    CHECK(Ok == INT_CallbackUnregister(CTIM0_IRQn, &stcCb));
+    u32Len += StreamDrain(&m_au8Stream[u32Len], sizeof(m_au8Stream) - u32Len, sizeof(m_au8Stream));
+
+    u32Num = StreamDecode(m_au8Stream, u32Len, m_aacText, ARRAY_SZ(m_aacText));
+    for (i = 0u; i < u32Num; i++)
+    {
+        if (1 == sscanf(m_aacText[i], "main %u", (unsigned *)&u32Seq))
+        {
+            CHECK(u32Main == u32Seq);
+            u32Main++;
+        }
+        else if (1 == sscanf(m_aacText[i], "isr %u", (unsigned *)&u32Seq))
+        {
+            CHECK(u32Isr == u32Seq);
+            u32Isr++;
+            u32Mixed += ((0u != u32Main) && (IRQ_LOOPS != u32Main)) ? 1u : 0u;
+        }
+        else
+        {
+            u32ErrCnt++;
+        }
+    }
+    printf("irq: main=%u isr=%u dropped=%u\n", (unsigned)u32Main, (unsigned)u32Isr, (unsigned)DDL_LogDropCountGet());
+    CHECK(IRQ_LOOPS == u32Main);
+    CHECK((m_u32IsrSeq == u32Isr) && (u32Isr > (IRQ_LOOPS / 4u)));
+    CHECK(u32Mixed > 0u);
+    CHECK(0u == DDL_LogDropCountGet());
+}
+
+/**
+ * @brief  日志调用不访问外设；与9600bps阻塞printf（LPUART_TransmitInt()逐字节发送）比较耗时
+ * @retval None
+ */
+static void CostCheck(void)
+{
+    stc_lpuart_init_t      stcLpuartInit;
+    stc_host_access_stat_t stcStat;
+    char                   acText[TEXT_MAX];
+    uint64_t               u64Start;
+    uint64_t               u64Print;
+    uint32_t               u32Len;
+    uint32_t               i;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX;
+    stcLpuartInit.stcBaudRate.u32Baud = 9600u;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+
+    CHECK(Ok == DDL_LogInit(m_au32Log, LOG_WORDS));
+    HOST_AccessStatClear();
+    DDL_LOG2(LOG_ADC, 3u, 1234u);
+    HOST_AccessStatGet(&stcStat);
+    CHECK((0u == stcStat.u64Read) && (0u == stcStat.u64Write));
+
+    u32Len   = (uint32_t)snprintf(acText, sizeof(acText), "adc ch%u = %u mV\r\n", 3u, 1234u);
+    u64Start = HOST_CycleGet();
+    for (i = 0u; i < u32Len; i++)
+    {
+        (void)LPUART_TransmitInt(LPUART1, (uint8_t)acText[i]);
+    }
+    u64Print = HOST_CycleGet() - u64Start;
+
+    /* 模型不计CPU周期，日志调用的周期只能在目标板上测得（lpuart_log_deferred样例） */
+    printf("cost: log_bus_accesses=0 printf_us=%u\n", (unsigned)(u64Print / (SystemCoreClock / 1000000u)));
+    CHECK(u64Print >= ((uint64_t)(u32Len - 2u) * HOST_LpuartFrameCycles(1u))); /* 最后两字节在发送缓冲及移位寄存器中 */
+}
+
+/**
+ * @brief  按测试表写入记录
+ * @retval None
+ */
+static void CaseWrite(const stc_log_case_t *pstcCase, uint32_t u32Num)
+{
+    uint32_t i;
+
+    for (i = 0u; i < u32Num; i++)
+    {
+        DDL_LogWrite(pstcCase[i].u32Id, pstcCase[i].u32Argc, pstcCase[i].au32Arg[0], pstcCase[i].au32Arg[1], pstcCase[i].au32Arg[2],
+                     pstcCase[i].au32Arg[3]);
+    }
+}
+
+/**
+ * @brief  以u32Chunk字节为单位取出全部字节流
+ * @retval uint32_t 字节数
+ */
+static uint32_t StreamDrain(uint8_t *pu8Buf, uint32_t u32Size, uint32_t u32Chunk)
+{
+    uint32_t u32Len = 0u;
+    uint32_t u32Ret;
+
+    do
+    {
+        u32Ret = DDL_LogRead(&pu8Buf[u32Len], ((u32Size - u32Len) < u32Chunk) ? (u32Size - u32Len) : u32Chunk);
+        u32Len += u32Ret;
+    } while ((0u != u32Ret) && (u32Len < u32Size));
+
+    return u32Len;
+}
+
+/**
+ * @brief  解码字节流（解码器重新初始化）
+ * @retval uint32_t 文本行数
+ */
+static uint32_t StreamDecode(const uint8_t *pu8Buf, uint32_t u32Len, char (*pacText)[TEXT_MAX], uint32_t u32Max)
+{
+    uint32_t u32Num = 0u;
+    char     acText[TEXT_MAX];
+    uint32_t i;
+
+    (void)LOG_DecodeInit(&m_stcDec, m_apcLogFmt, LOG_FMT_NUM);
+    for (i = 0u; i < u32Len; i++)
+    {
+        if ((0u != LOG_Decode(&m_stcDec, pu8Buf[i], acText, sizeof(acText))) && (u32Num < u32Max))
+        {
+            memcpy(pacText[u32Num], acText, sizeof(acText));
+            u32Num++;
+        }
+    }
+
+    return u32Num;
+}
+
+/**
+ * @brief  BTIM0溢出中断：写入一条记录
+ * @retval None
+ */
+static void TimerCallback(uint32_t u32Flags, void *pvArg)
+{
+    (void)u32Flags;
+    (void)pvArg;
+    BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);
+    DDL_LOG1(LOG_ISR, m_u32IsrSeq);
+    m_u32IsrSeq++;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
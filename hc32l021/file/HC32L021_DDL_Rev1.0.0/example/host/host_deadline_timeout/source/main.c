@@ -0,0 +1,247 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the microsecond deadline timeouts of the
+ *        blocking driver APIs running on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "flash.h"
+#include "lpuart.h"
+#include "spi.h"
+#include "sysctrl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TIMEOUT_US     (2000u)   /* 查询接收超时时间 */
+#define TIMEOUT_SLACK  (50u)     /* 超时判断的轮询粒度（us） */
+#define FLASH_TEST_ADR (0xFE00u) /* 扇区127 首地址 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint64_t ElapsedUs(uint64_t u64StartCycle);
+static void     LpUartRxTimeoutCheck(void);
+static void     LpUartRxInject(void *pvArg);
+static void     LpUartConfig(void);
+static void     SysClockConfig(uint32_t u32SysClockSrc);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_ddl_deadline_t stcDeadline;
+    stc_spi_init_t     stcSpiInit = {0};
+    uint16_t           au16Tx[4]  = {1u, 2u, 3u, 4u};
+    uint16_t           au16Rx[4];
+    uint8_t            u8Rx;
+    uint64_t           u64Start;
+    uint64_t           u64Us;
+    uint64_t           u64Cycle;
+    uint32_t           u32Ctrl;
+
+    /* 1. 截止时间：按微秒设定，DDL_TIMEOUT_FOREVER永不超时 */
+    DDL_DeadlineInit(&stcDeadline, 100u);
+    CHECK(FALSE == DDL_DeadlineExpired(&stcDeadline));
+    HOST_CycleAdvance(100u * (SystemCoreClock / 1000000u));
+    CHECK(TRUE == DDL_DeadlineExpired(&stcDeadline));
+    DDL_DeadlineInit(&stcDeadline, 0u);
+    CHECK(TRUE == DDL_DeadlineExpired(&stcDeadline));
+    DDL_DeadlineInit(&stcDeadline, DDL_TIMEOUT_FOREVER);
+    HOST_CycleAdvance(0xFFFFFFFFu);
+    CHECK(FALSE == DDL_DeadlineExpired(&stcDeadline));
+
+    /* 2. LPUART查询接收超时：4MHz与48MHz下超时时长相同 */
+    LpUartConfig();
+    LpUartRxTimeoutCheck();
+    SysClockConfig(SYSCTRL_CLK_SRC_RC48M_48M);
+    LpUartConfig();
+    LpUartRxTimeoutCheck();
+    SysClockConfig(SYSCTRL_CLK_SRC_RC48M_4M);
+    LpUartConfig();
+
+    /* 3. 永不超时：数据在5ms后到达 */
+    HOST_EventSchedule(5u * (SystemCoreClock / 1000u), LpUartRxInject, (void *)(uintptr_t)0xA5u);
+    CHECK(Ok == LPUART_ReceivePollTimeOutUs(LPUART1, &u8Rx, 1u, DDL_TIMEOUT_FOREVER));
+    CHECK(0xA5u == u8Rx);
+
+    /* 4. SPI未使能：无数据收发，超时返回 */
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32Mode = SPI_MD_MASTER;
+    SPI_Init(SPI, &stcSpiInit);
+    SPI_Disable(SPI);
+    u64Start = HOST_CycleGet();
+    CHECK(ErrorTimeout == SPI_TransmitReceiveTimeoutUs(SPI, au16Tx, au16Rx, 4u, 500u));
+    u64Us = ElapsedUs(u64Start);
+    printf("SPI timeout 500us: %llu us\n", (unsigned long long)u64Us);
+    CHECK((u64Us >= 500u) && (u64Us < 500u + TIMEOUT_SLACK));
+
+    /* 5. FLASH：正常擦写；忙标志不释放时按FLASH_TIMEOUT（100ms）超时 */
+    FLASH_ReadOnlyDisable();
+    CHECK(Ok == FLASH_LockUnlockSectors(0x80000000u));
+    CHECK(Ok == FLASH_SectorErase(FLASH_TEST_ADR));
+    HOST_RegWrite(FLASH_BASE + offsetof(FLASH_TypeDef, CR), HOST_RegRead(FLASH_BASE + offsetof(FLASH_TypeDef, CR)) | FLASH_CR_BUSY_Msk);
+    HOST_AccessCyclesSet(16u); /* 加大单次访问周期以缩短主机运行时间 */
+    u64Start = HOST_CycleGet();
+    CHECK(ErrorTimeout == FLASH_SectorErase(FLASH_TEST_ADR));
+    u64Us = ElapsedUs(u64Start);
+    HOST_AccessCyclesSet(HOST_ACCESS_CYCLES_DEFAULT);
+    printf("FLASH busy timeout: %llu us\n", (unsigned long long)u64Us);
+    CHECK((u64Us >= 100000u) && (u64Us < 100000u + TIMEOUT_SLACK));
+    HOST_RegWrite(FLASH_BASE + offsetof(FLASH_TypeDef, CR), HOST_RegRead(FLASH_BASE + offsetof(FLASH_TypeDef, CR)) & ~FLASH_CR_BUSY_Msk);
+
+    /* 6. 原有接口按查询次数计时：时长与次数成正比，与HCLK无关 */
+    u64Start = HOST_CycleGet();
+    CHECK(ErrorTimeout == LPUART_ReceivePollTimeOut(LPUART1, &u8Rx, 1u, 1000u));
+    u64Cycle = HOST_CycleGet() - u64Start;
+    u64Start = HOST_CycleGet();
+    CHECK(ErrorTimeout == LPUART_ReceivePollTimeOut(LPUART1, &u8Rx, 1u, 2000u));
+    printf("LPUART rx timeout 1000/2000 polls: %llu/%llu cycles\n", (unsigned long long)u64Cycle,
+           (unsigned long long)(HOST_CycleGet() - u64Start));
+    CHECK(u64Cycle >= 1000u);
+    CHECK((HOST_CycleGet() - u64Start) >= (2u * u64Cycle - 64u));
+    CHECK((HOST_CycleGet() - u64Start) <= (2u * u64Cycle + 64u));
+    CHECK(ErrorTimeout == SPI_TransmitReceiveTimeout(SPI, au16Tx, au16Rx, 4u, 100u));
+
+    /* 7. SysTick停止：微秒超时按查询次数兜底，仍能结束且不短于设定值 */
+    u32Ctrl       = SysTick->CTRL;
+    SysTick->CTRL = 0u;
+    u64Start      = HOST_CycleGet();
+    CHECK(ErrorTimeout == LPUART_ReceivePollTimeOutUs(LPUART1, &u8Rx, 1u, TIMEOUT_US));
+    u64Us = ElapsedUs(u64Start);
+    printf("SysTick stopped: LPUART rx timeout %u us -> %llu us\n", (unsigned)TIMEOUT_US, (unsigned long long)u64Us);
+    CHECK((u64Us >= TIMEOUT_US) && (u64Us < 64u * TIMEOUT_US));
+    HOST_RegWrite(FLASH_BASE + offsetof(FLASH_TypeDef, CR), HOST_RegRead(FLASH_BASE + offsetof(FLASH_TypeDef, CR)) | FLASH_CR_BUSY_Msk);
+    HOST_AccessCyclesSet(16u);
+    u64Start = HOST_CycleGet();
+    CHECK(ErrorTimeout == FLASH_SectorErase(FLASH_TEST_ADR));
+    u64Us = ElapsedUs(u64Start);
+    HOST_AccessCyclesSet(HOST_ACCESS_CYCLES_DEFAULT);
+    printf("SysTick stopped: FLASH busy timeout %llu us\n", (unsigned long long)u64Us);
+    CHECK((u64Us >= 100000u) && (u64Us < 64u * 100000u));
+    HOST_RegWrite(FLASH_BASE + offsetof(FLASH_TypeDef, CR), HOST_RegRead(FLASH_BASE + offsetof(FLASH_TypeDef, CR)) & ~FLASH_CR_BUSY_Msk);
+    SysTick->CTRL = u32Ctrl;
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  自u64StartCycle起经过的时间（按当前HCLK）
+ * @param  [in] u64StartCycle 起始模拟周期
+ * @retval uint64_t 经过的时间（us）
+ */
+static uint64_t ElapsedUs(uint64_t u64StartCycle)
+{
+    return (HOST_CycleGet() - u64StartCycle) / (SystemCoreClock / 1000000u);
+}
+
+/**
+ * @brief  无数据时查询接收超时时长检查
+ * @retval None
+ */
+static void LpUartRxTimeoutCheck(void)
+{
+    uint8_t  u8Rx;
+    uint64_t u64Start = HOST_CycleGet();
+    uint64_t u64Us;
+
+    CHECK(ErrorTimeout == LPUART_ReceivePollTimeOutUs(LPUART1, &u8Rx, 1u, TIMEOUT_US));
+    u64Us = ElapsedUs(u64Start);
+    printf("HCLK %u Hz: LPUART rx timeout %u us -> %llu us, %llu cycles\n", (unsigned)SystemCoreClock, (unsigned)TIMEOUT_US,
+           (unsigned long long)u64Us, (unsigned long long)(HOST_CycleGet() - u64Start));
+    CHECK((u64Us >= TIMEOUT_US) && (u64Us < TIMEOUT_US + TIMEOUT_SLACK));
+}
+
+/**
+ * @brief  模拟上位机发送一字节
+ * @param  [in] pvArg 数据
+ * @retval None
+ */
+static void LpUartRxInject(void *pvArg)
+{
+    HOST_LpuartRxPush(1u, (uint16_t)(uintptr_t)pvArg);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();
+    stcLpuartInit.stcBaudRate.u32Baud       = 9600u;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+/**
+ * @brief  时钟初始化
+ * @param  [in] u32SysClockSrc 系统时钟源 @ref SYSCTRL_Clock_Source
+ * @retval None
+ */
+static void SysClockConfig(uint32_t u32SysClockSrc)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit = {0};
+
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+    stcSysClockInit.u32SysClockSrc = u32SysClockSrc;
+    stcSysClockInit.u32HclkDiv     = SYSCTRL_HCLK_PRS_DIV1;
+    SYSCTRL_ClockInit(&stcSysClockInit);
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
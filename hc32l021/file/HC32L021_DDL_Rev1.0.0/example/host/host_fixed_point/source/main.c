@@ -0,0 +1,332 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the integer fixed-point library and
+ *        the integer ports of LPUART_Init()/RTC_CompValueCalculateQ16(), checked
+ *        against the former floating point formulas on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "ddl.h"
+#include "lpuart.h"
+#include "rtc.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define RTC_PPM_MIN  (-18000117) /* -274.66ppm（Q16.16） */
+#define RTC_PPM_MAX  (13996523)  /* 213.57ppm（Q16.16） */
+#define RTC_PPM_STEP (1022)      /* RTC扫描步长（偶数：输入小数不超过15位，浮点表示精确） */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     FixedPointCheck(void);
+static void     RecipCheck(void);
+static void     LpuartScntCheck(void);
+static void     RtcCompCheck(void);
+static void     AdcVoltageCheck(void);
+static uint32_t Rand(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+static uint32_t u32Seed   = 0x12345678u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    FixedPointCheck();
+    RecipCheck();
+    LpuartScntCheck();
+    RtcCompCheck();
+    AdcVoltageCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  饱和运算、Q16.16乘除及取整
+ * @retval None
+ */
+static void FixedPointCheck(void)
+{
+    int32_t  i32A;
+    int32_t  i32B;
+    double   dRef;
+    uint32_t i;
+
+    CHECK(INT32_MAX == DDL_SatAdd(INT32_MAX, 1));
+    CHECK(INT32_MIN == DDL_SatAdd(INT32_MIN, -1));
+    CHECK(-1 == DDL_SatAdd(INT32_MAX, INT32_MIN));
+    CHECK(INT32_MAX == DDL_SatSub(0, INT32_MIN));
+    CHECK(INT32_MIN == DDL_SatSub(-2, INT32_MAX));
+    CHECK(5 == DDL_SatSub(2, -3));
+
+    CHECK(DDL_Q16_ONE == DDL_Q16(1.0));
+    CHECK(-98304 == DDL_Q16(-1.5));
+    CHECK(DDL_Q16_INT(-3) == DDL_Q16(-3));
+    CHECK(DDL_Q16(-3.75) == DDL_Q16Mul(DDL_Q16(1.5), DDL_Q16(-2.5)));
+    CHECK(INT32_MAX == DDL_Q16Mul(DDL_Q16(30000), DDL_Q16(30000)));
+    CHECK(INT32_MIN == DDL_Q16Mul(DDL_Q16(-30000), DDL_Q16(30000)));
+    CHECK(DDL_Q16(-0.5) == DDL_Q16Div(DDL_Q16(1), DDL_Q16(-2)));
+    CHECK(INT32_MAX == DDL_Q16Div(DDL_Q16(1), 0));
+    CHECK(INT32_MIN == DDL_Q16Div(DDL_Q16(-20000), DDL_Q16(0.5)));
+
+    for (i = 0u; i < 200000u; i++)
+    {
+        i32A = (int32_t)Rand() >> (Rand() & 15u);
+        i32B = (int32_t)Rand() >> (Rand() & 15u);
+
+        dRef = round((double)i32A * (double)i32B / 65536.0);
+        if ((dRef < 2147483647.0) && (dRef > -2147483648.0))
+        {
+            CHECK((double)DDL_Q16Mul(i32A, i32B) == dRef);
+        }
+        if (0 != i32B)
+        {
+            dRef = round((double)i32A * 65536.0 / (double)i32B);
+            if ((dRef < 2147483647.0) && (dRef > -2147483648.0) && (fabs(fmod((double)i32A * 65536.0, (double)i32B)) != 0.0))
+            {
+                /* 商的小数部分恰为0.5时双精度round()同样远离0 */
+                CHECK((double)DDL_Q16Div(i32A, i32B) == dRef);
+            }
+        }
+
+        /* 与roundf()一致（值在浮点精确表示范围内） */
+        i32A = (int32_t)Rand() >> 8u;
+        CHECK((int32_t)roundf((float32_t)i32A / 65536.0f) == DDL_Q16Round(i32A));
+    }
+    CHECK(3 == DDL_Q16Round(DDL_Q16(2.5)));
+    CHECK(-3 == DDL_Q16Round(DDL_Q16(-2.5)));
+    CHECK(-2 == DDL_Q16Round(DDL_Q16(-2.4999)));
+    CHECK(-32768 == DDL_Q16Round(INT32_MIN));
+    CHECK(8u == DDL_ROUND_SHR(15u, 1u));
+    CHECK(7u == DDL_ROUND_SHR(14u, 1u));
+}
+
+/**
+ * @brief  四舍五入除法及倒数除法
+ * @retval None
+ */
+static void RecipCheck(void)
+{
+    const stc_ddl_recip_t stcConst = DDL_RECIP_INIT(62500u);
+    const uint32_t        au32Div[] = {1u, 2u, 3u, 7u, 10u, 62500u, 3999997u, 0x7FFFFFFFu, 0x80000001u, 0xFFFFFFFFu};
+    stc_ddl_recip_t       stcRecip;
+    uint32_t              u32Num;
+    uint32_t              u32Div;
+    uint32_t              u32Ref;
+    uint32_t              i;
+    uint32_t              j;
+
+    DDL_RecipInit(&stcRecip, 62500u);
+    CHECK((stcConst.u32Mul == stcRecip.u32Mul) && (stcConst.u32Div == stcRecip.u32Div));
+
+    CHECK(0xFFFFFFFFu == DDL_UDivRound(1u, 0u));
+    CHECK(0x80000000u == DDL_UDivRound(0xFFFFFFFFu, 2u));
+    CHECK(1u == DDL_UDivRound(0xFFFFFFFFu, 0xFFFFFFFFu));
+    CHECK(1u == DDL_UDivRound(0x80000000u, 0xFFFFFFFFu));
+    CHECK(0u == DDL_UDivRound(0x7FFFFFFFu, 0xFFFFFFFFu));
+
+    for (i = 0u; i < 400000u; i++)
+    {
+        u32Div = (i < ARRAY_SZ(au32Div)) ? au32Div[i] : (Rand() >> (Rand() & 31u));
+        u32Div = (0u == u32Div) ? 1u : u32Div;
+        DDL_RecipInit(&stcRecip, u32Div);
+        for (j = 0u; j < 4u; j++)
+        {
+            u32Num = (0u == j) ? 0xFFFFFFFFu : ((1u == j) ? (u32Div - 1u) : Rand());
+            CHECK((u32Num / u32Div) == DDL_RecipDiv(u32Num, &stcRecip));
+            u32Ref = (u32Num / u32Div) + ((((uint64_t)(u32Num % u32Div) * 2u) >= u32Div) ? 1u : 0u);
+            CHECK(u32Ref == DDL_UDivRound(u32Num, u32Div));
+        }
+    }
+}
+
+/**
+ * @brief  LPUART_Init()：SCNT及返回的波特率与原浮点计算一致（全部系统时钟源及分频）
+ * @retval None
+ */
+static void LpuartScntCheck(void)
+{
+    const uint32_t    au32Clk[]  = {4000000u, 8000000u, 16000000u, 24000000u, 48000000u, 32768u, 38400u};
+    const uint32_t    au32Baud[] = {300u, 1200u, 2400u, 4800u, 9600u, 14400u, 19200u, 38400u, 57600u, 115200u, 230400u, 460800u, 921600u};
+    stc_lpuart_init_t stcInit;
+    float32_t         f32Scnt;
+    uint16_t          u16Scnt;
+    uint32_t          u32Sclk;
+    uint32_t          u32Bps;
+    uint32_t          u32Cnt = 0u;
+    uint32_t          i;
+    uint32_t          j;
+    uint32_t          k;
+
+    LPUART_StcInit(&stcInit);
+    for (i = 0u; i < ARRAY_SZ(au32Clk); i++)
+    {
+        /* HCLK 1~128分频、PCLK 1~8分频 */
+        for (k = 0u; k <= 10u; k++)
+        {
+            u32Sclk = au32Clk[i] >> k;
+            for (j = 0u; j < ARRAY_SZ(au32Baud); j++)
+            {
+                if ((au32Baud[j] << 2) > u32Sclk)
+                {
+                    continue;
+                }
+                stcInit.stcBaudRate.u32Sclk = u32Sclk;
+                stcInit.stcBaudRate.u32Baud = au32Baud[j];
+                u32Bps                      = LPUART_Init(LPUART1, &stcInit);
+
+                f32Scnt = (float32_t)u32Sclk / (float32_t)(au32Baud[j] << 2);
+                u16Scnt = (uint16_t)(float32_t)(f32Scnt + 0.5f);
+                /* 分频*SCNT（位时间）与原4分频计算一致，误差相同时取较大的分频 */
+                CHECK((4u * u16Scnt) == ((16u >> ((LPUART1->SCON & LPUART_SCON_OVER_Msk) >> LPUART_SCON_OVER_Pos)) * LPUART1->SCNT));
+                CHECK(((u32Sclk / u16Scnt) >> 2) == u32Bps);
+                u32Cnt++;
+            }
+        }
+    }
+    printf("LPUART SCNT: %u clock/baud combinations match\n", (unsigned)u32Cnt);
+}
+
+/**
+ * @brief  RTC_CompValueCalculateQ16()：与浮点RTC_CompValueCalculate()比较
+ * @retval None
+ */
+static void RtcCompCheck(void)
+{
+    uint16_t u16New;
+    uint16_t u16Old;
+    int64_t  i64Num;
+    int64_t  i64Exact;
+    int32_t  i32Ppm;
+    uint32_t u32Cnt  = 0u;
+    uint32_t u32Diff = 0u;
+
+    /* 范围检查与原浮点比较阈值一致 */
+    CHECK(ErrorInvalidParameter == RTC_CompValueCalculateQ16(RTC_PPM_MIN - 1, RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+    CHECK(Ok == RTC_CompValueCalculateQ16(RTC_PPM_MIN, RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+    CHECK(ErrorInvalidParameter == RTC_CompValueCalculateQ16(13937542, RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+    CHECK(Ok == RTC_CompValueCalculateQ16(13937541, RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+    CHECK(ErrorInvalidParameter == RTC_CompValueCalculateQ16(RTC_PPM_MAX + 1, RTC_COMPEN_PRICISION_0P06PPM, &u16New));
+    CHECK(ErrorInvalidParameter == RTC_CompValueCalculateQ16(0, 0x1234u, &u16New));
+
+    /* rtc_cali样例：+10ppm */
+    CHECK(Ok == RTC_CompValueCalculateQ16(DDL_Q16(10), RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+    CHECK(42u == u16New);
+    CHECK(0u == (RTC->COMPEN & RTC_COMPEN_CSTEPS_Msk));
+    CHECK(Ok == RTC_CompValueCalculateQ16(DDL_Q16(10), RTC_COMPEN_PRICISION_0P06PPM, &u16New));
+    CHECK(680u == u16New);
+    CHECK(0u != (RTC->COMPEN & RTC_COMPEN_CSTEPS_Msk));
+    CHECK(Ok == RTC_CompValueCalculate(10.0f, RTC_COMPEN_PRICISION_0P96PPM, &u16Old));
+    CHECK(42u == u16Old);
+    CHECK(0u == (RTC->COMPEN & RTC_COMPEN_CSTEPS_Msk));
+    CHECK(ErrorInvalidParameter == RTC_CompValueCalculate(213.0f, RTC_COMPEN_PRICISION_0P96PPM, &u16Old));
+
+    for (i32Ppm = RTC_PPM_MIN + 1; i32Ppm <= RTC_PPM_MAX; i32Ppm += RTC_PPM_STEP)
+    {
+        /* 0.96ppm：与原浮点结果逐一相同 */
+        if (Ok == RTC_CompValueCalculate((float32_t)i32Ppm / 65536.0f, RTC_COMPEN_PRICISION_0P96PPM, &u16Old))
+        {
+            CHECK(Ok == RTC_CompValueCalculateQ16(i32Ppm, RTC_COMPEN_PRICISION_0P96PPM, &u16New));
+            CHECK(u16Old == u16New);
+            u32Cnt++;
+        }
+
+        /* 0.06ppm：与精确值四舍五入相同；原单精度计算在距0.5不足约2^-11步时可能进位错误 */
+        CHECK(Ok == RTC_CompValueCalculate((float32_t)i32Ppm / 65536.0f, RTC_COMPEN_PRICISION_0P06PPM, &u16Old));
+        CHECK(Ok == RTC_CompValueCalculateQ16(i32Ppm, RTC_COMPEN_PRICISION_0P06PPM, &u16New));
+        i64Num   = ((i32Ppm > -2000001) ? 512 : 8704) * (int64_t)3999997 + (int64_t)i32Ppm * 1024;
+        i64Exact = (i64Num + 1999998) / 3999997;
+        CHECK((uint16_t)(i64Exact & 0x1FFF) == u16New);
+        if (u16Old != u16New)
+        {
+            /* 仅在接近0.5处不同，且只差1 */
+            CHECK(llabs((i64Num % 3999997) - 1999998) < (3999997 >> 10));
+            CHECK(1u == (uint16_t)(u16Old - u16New));
+            u32Diff++;
+        }
+        u32Cnt++;
+    }
+    printf("RTC comp: %u values checked, %u near-tie values corrected in 0.06ppm mode\n", (unsigned)u32Cnt, (unsigned)u32Diff);
+
+    /* 原单精度计算误差示例：-101ppm精确值为7009.49985 */
+    CHECK(Ok == RTC_CompValueCalculateQ16(DDL_Q16(-101), RTC_COMPEN_PRICISION_0P06PPM, &u16New));
+    CHECK(7009u == u16New);
+}
+
+/**
+ * @brief  VAS5051样例的电压换算：采样值 * 3.3V / 4096，mV
+ * @retval None
+ */
+static void AdcVoltageCheck(void)
+{
+    uint32_t u32Code;
+    uint32_t u32Mv;
+    double   dMv;
+
+    for (u32Code = 0u; u32Code < 4096u; u32Code++)
+    {
+        u32Mv = DDL_ROUND_SHR(u32Code * 3300u, 12u);
+        dMv   = (double)u32Code * 3.3 / 4096.0 * 1000.0;
+        CHECK(fabs((double)u32Mv - dMv) <= 0.5 + 1e-9);
+    }
+}
+
+/**
+ * @brief  伪随机数（xorshift32）
+ * @retval uint32_t 随机数
+ */
+static uint32_t Rand(void)
+{
+    u32Seed ^= u32Seed << 13u;
+    u32Seed ^= u32Seed >> 17u;
+    u32Seed ^= u32Seed << 5u;
+
+    return u32Seed;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,364 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the runtime interrupt callback dispatch
+ *        (INT_CallbackRegister) with shared vectors and entry-to-callback
+ *        latency measurement on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "btim.h"
+#include "gpio.h"
+#include "gtim.h"
+#include "sysctrl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  回调调用记录
+ */
+typedef struct
+{
+    uint32_t u32Count; /*!< 调用次数 */
+    uint32_t u32Flags; /*!< 最近一次传入的标志 */
+} stc_cb_record_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define REG_ADDR(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg))
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void PortSharedCheck(void);
+static void CtimSharedCheck(void);
+static void Hsi2cSplitCheck(void);
+static void ParamCheck(void);
+static void PinCallback(uint32_t u32Flags, void *pvArg);
+static void TimerCallback(uint32_t u32Flags, void *pvArg);
+static void RecordCallback(uint32_t u32Flags, void *pvArg);
+static void SelfRemoveCallback(uint32_t u32Flags, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t        u32ErrCnt       = 0u;
+static uint32_t        u32PortBLegacy  = 0u;
+static stc_cb_record_t astcRecord[4];
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    /* 延迟测量使用SysTick->VAL（SystemInit()默认24位自由运行） */
+    PortSharedCheck();
+    CtimSharedCheck();
+    Hsi2cSplitCheck();
+    ParamCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  原弱定义中断服务函数仍在回调之后调用
+ * @retval None
+ */
+void PortB_IRQHandler(void)
+{
+    u32PortBLegacy++;
+}
+
+/**
+ * @brief  PORTA：两个模块各自注册引脚，共享同一向量；优先级取最高
+ * @retval None
+ */
+static void PortSharedCheck(void)
+{
+    stc_int_cb_t stcPin0  = {0};
+    stc_int_cb_t stcPin5  = {0};
+    stc_int_cb_t stcPortB = {0};
+
+    memset(astcRecord, 0, sizeof(astcRecord));
+    stcPin0.pfnCallback = PinCallback;
+    stcPin0.pvArg       = &astcRecord[0];
+    stcPin0.u32SrcMask  = GPIO_PIN_00;
+    stcPin5.pfnCallback = PinCallback;
+    stcPin5.pvArg       = &astcRecord[1];
+    stcPin5.u32SrcMask  = GPIO_PIN_05 | GPIO_PIN_06;
+
+    CHECK(Ok == INT_CallbackRegister(PORTA_IRQn, &stcPin0, IrqPriorityLevel3));
+    CHECK(0u != (NVIC->ISER[0] & (1UL << PORTA_IRQn)));
+    CHECK(IrqPriorityLevel3 == NVIC_GetPriority(PORTA_IRQn));
+    CHECK(Ok == INT_CallbackRegister(PORTA_IRQn, &stcPin5, IrqPriorityLevel1));
+    CHECK(IrqPriorityLevel1 == NVIC_GetPriority(PORTA_IRQn));
+    CHECK(ErrorInvalidMode == INT_CallbackRegister(PORTA_IRQn, &stcPin5, IrqPriorityLevel1));
+
+    /* 引脚5中断：只调用stcPin5，回调清除后电平中断撤销 */
+    HOST_RegWrite(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, STAT), GPIO_PIN_05);
+    HOST_IrqDispatch();
+    CHECK((0u == astcRecord[0].u32Count) && (1u == astcRecord[1].u32Count));
+    CHECK(GPIO_PIN_05 == astcRecord[1].u32Flags);
+    CHECK(0u == HOST_RegRead(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, STAT)));
+
+    /* 同时挂起：一次进入中断，两个回调收到同一标志 */
+    HOST_RegWrite(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, STAT), GPIO_PIN_00 | GPIO_PIN_06);
+    HOST_IrqDispatch();
+    CHECK((1u == astcRecord[0].u32Count) && (2u == astcRecord[1].u32Count));
+    CHECK((GPIO_PIN_00 | GPIO_PIN_06) == astcRecord[0].u32Flags);
+    CHECK(0u == HOST_RegRead(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, STAT)));
+
+    /* 延迟：按注册顺序调用，后一个回调延迟更大 */
+    printf("PORTA latency: pin0 last %u (min %u, max %u), pin5 last %u (min %u, max %u) cycles\n",
+           (unsigned)stcPin0.stcLatency.u32Last, (unsigned)stcPin0.stcLatency.u32Min, (unsigned)stcPin0.stcLatency.u32Max,
+           (unsigned)stcPin5.stcLatency.u32Last, (unsigned)stcPin5.stcLatency.u32Min, (unsigned)stcPin5.stcLatency.u32Max);
+    CHECK((1u == stcPin0.stcLatency.u32Count) && (2u == stcPin5.stcLatency.u32Count));
+    CHECK(stcPin0.stcLatency.u32Last > 0u);
+    CHECK(stcPin5.stcLatency.u32Last > stcPin0.stcLatency.u32Last);
+    CHECK(stcPin5.stcLatency.u32Min <= stcPin5.stcLatency.u32Max);
+    INT_LatencyClear(&stcPin5);
+    CHECK((0u == stcPin5.stcLatency.u32Count) && (0xFFFFFFFFu == stcPin5.stcLatency.u32Min));
+
+    /* 注销：优先级按剩余回调恢复，最后一个注销后禁止中断 */
+    CHECK(Ok == INT_CallbackUnregister(PORTA_IRQn, &stcPin5));
+    CHECK(IrqPriorityLevel3 == NVIC_GetPriority(PORTA_IRQn));
+    CHECK(ErrorUninitialized == INT_CallbackUnregister(PORTA_IRQn, &stcPin5));
+    CHECK(Ok == INT_CallbackUnregister(PORTA_IRQn, &stcPin0));
+    CHECK(0u == (NVIC->ISER[0] & (1UL << PORTA_IRQn)));
+
+    /* PORTB：INT_SRC_ALL回调及原弱定义服务函数 */
+    stcPortB.pfnCallback = PinCallback;
+    stcPortB.pvArg       = &astcRecord[2];
+    stcPortB.u32SrcMask  = INT_SRC_ALL;
+    CHECK(Ok == INT_CallbackRegister(PORTB_IRQn, &stcPortB, IrqPriorityLevel2));
+    HOST_RegWrite(REG_ADDR(GPIOB_BASE, GPIO_TypeDef, STAT), GPIO_PIN_03);
+    HOST_IrqDispatch();
+    CHECK((1u == astcRecord[2].u32Count) && (GPIO_PIN_03 == astcRecord[2].u32Flags));
+    CHECK(1u == u32PortBLegacy);
+    CHECK(Ok == INT_CallbackUnregister(PORTB_IRQn, &stcPortB));
+}
+
+/**
+ * @brief  CTIM0：BTIM0/BTIM1共享向量（BTIM模式），GTIM0独占（GTIM模式）
+ * @retval None
+ */
+static void CtimSharedCheck(void)
+{
+    stc_int_cb_t stcBtim0 = {0};
+    stc_int_cb_t stcBtim1 = {0};
+    stc_int_cb_t stcGtim0 = {0};
+
+    memset(astcRecord, 0, sizeof(astcRecord));
+    stcBtim0.pfnCallback = TimerCallback;
+    stcBtim0.pvArg       = &astcRecord[0];
+    stcBtim0.u32SrcMask  = BTIM03_AIT_FLAG_UI | BTIM03_AIT_FLAG_TI;
+    stcBtim1.pfnCallback = TimerCallback;
+    stcBtim1.pvArg       = &astcRecord[1];
+    stcBtim1.u32SrcMask  = BTIM14_AIT_FLAG_UI | BTIM14_AIT_FLAG_TI;
+    stcGtim0.pfnCallback = TimerCallback;
+    stcGtim0.pvArg       = &astcRecord[2];
+    stcGtim0.u32SrcMask  = GTIM_FLAG_CC0 | GTIM_FLAG_UI;
+
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    CHECK(Ok == INT_CallbackRegister(CTIM0_IRQn, &stcBtim0, IrqPriorityLevel2));
+    CHECK(Ok == INT_CallbackRegister(CTIM0_IRQn, &stcBtim1, IrqPriorityLevel2));
+
+    HOST_RegWrite(REG_ADDR(BTIM0_BASE, BTIM_TypeDef, AIFR), BTIM14_AIT_FLAG_UI);
+    HOST_IrqPend((int32_t)CTIM0_IRQn);
+    HOST_IrqDispatch();
+    CHECK((0u == astcRecord[0].u32Count) && (1u == astcRecord[1].u32Count));
+    CHECK(BTIM14_AIT_FLAG_UI == astcRecord[1].u32Flags);
+
+    HOST_RegWrite(REG_ADDR(BTIM0_BASE, BTIM_TypeDef, AIFR), BTIM03_AIT_FLAG_TI | BTIM14_AIT_FLAG_UI);
+    HOST_IrqPend((int32_t)CTIM0_IRQn);
+    HOST_IrqDispatch();
+    CHECK((1u == astcRecord[0].u32Count) && (2u == astcRecord[1].u32Count));
+
+    CHECK(Ok == INT_CallbackUnregister(CTIM0_IRQn, &stcBtim0));
+    CHECK(Ok == INT_CallbackUnregister(CTIM0_IRQn, &stcBtim1));
+
+    /* GTIM模式：标志取GTIM0->IFR */
+    SYSCTRL_FuncDisable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    CHECK(Ok == INT_CallbackRegister(CTIM0_IRQn, &stcGtim0, IrqPriorityLevel0));
+    CHECK(IrqPriorityLevel0 == NVIC_GetPriority(CTIM0_IRQn));
+    HOST_RegWrite(REG_ADDR(BTIM0_BASE, BTIM_TypeDef, AIFR), 0u);
+    HOST_RegWrite(REG_ADDR(GTIM0_BASE, GTIM_TypeDef, IFR), GTIM_FLAG_CC0);
+    HOST_IrqPend((int32_t)CTIM0_IRQn);
+    HOST_IrqDispatch();
+    CHECK((1u == astcRecord[2].u32Count) && (GTIM_FLAG_CC0 == astcRecord[2].u32Flags));
+    CHECK(Ok == INT_CallbackUnregister(CTIM0_IRQn, &stcGtim0));
+}
+
+/**
+ * @brief  HSI2C：主机与从机回调分别接收MSR/SSR；回调中注销自身
+ * @retval None
+ */
+static void Hsi2cSplitCheck(void)
+{
+    stc_int_cb_t stcMaster = {0};
+    stc_int_cb_t stcSlave  = {0};
+    stc_int_cb_t stcOnce   = {0};
+
+    memset(astcRecord, 0, sizeof(astcRecord));
+    stcOnce.pfnCallback   = SelfRemoveCallback;
+    stcOnce.pvArg         = &stcOnce;
+    stcOnce.u32SrcMask    = INT_SRC_ALL;
+    stcMaster.pfnCallback = RecordCallback;
+    stcMaster.pvArg       = &astcRecord[0];
+    stcMaster.u32SrcMask  = INT_SRC_HSI2C_MASTER;
+    stcSlave.pfnCallback  = RecordCallback;
+    stcSlave.pvArg        = &astcRecord[1];
+    stcSlave.u32SrcMask   = INT_SRC_HSI2C_SLAVE;
+
+    CHECK(Ok == INT_CallbackRegister(HSI2C_IRQn, &stcOnce, IrqPriorityLevel1));
+    CHECK(Ok == INT_CallbackRegister(HSI2C_IRQn, &stcMaster, IrqPriorityLevel1));
+    CHECK(Ok == INT_CallbackRegister(HSI2C_IRQn, &stcSlave, IrqPriorityLevel1));
+
+    HOST_RegWrite(REG_ADDR(HSI2C_BASE, HSI2C_TypeDef, MSR), 0u);
+    HOST_RegWrite(REG_ADDR(HSI2C_BASE, HSI2C_TypeDef, SSR), HSI2C_SSR_RDF_Msk | HSI2C_SSR_AM0F_Msk);
+    HOST_IrqPend((int32_t)HSI2C_IRQn);
+    HOST_IrqDispatch();
+    CHECK((0u == astcRecord[0].u32Count) && (1u == astcRecord[1].u32Count));
+    CHECK(((HSI2C_SSR_RDF_Msk | HSI2C_SSR_AM0F_Msk) << 16u) == astcRecord[1].u32Flags);
+    CHECK(ErrorUninitialized == INT_CallbackUnregister(HSI2C_IRQn, &stcOnce));
+
+    HOST_RegWrite(REG_ADDR(HSI2C_BASE, HSI2C_TypeDef, SSR), 0u);
+    HOST_RegWrite(REG_ADDR(HSI2C_BASE, HSI2C_TypeDef, MSR), HSI2C_MSR_TDF_Msk | HSI2C_MSR_BBF_Msk);
+    HOST_IrqPend((int32_t)HSI2C_IRQn);
+    HOST_IrqDispatch();
+    CHECK((1u == astcRecord[0].u32Count) && (1u == astcRecord[1].u32Count));
+    CHECK(HSI2C_MSR_TDF_Msk == astcRecord[0].u32Flags); /* 忙标志在高16位之外 */
+
+    CHECK(Ok == INT_CallbackUnregister(HSI2C_IRQn, &stcMaster));
+    CHECK(Ok == INT_CallbackUnregister(HSI2C_IRQn, &stcSlave));
+}
+
+/**
+ * @brief  参数检查
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_int_cb_t stcCb = {0};
+
+    CHECK(ErrorInvalidParameter == INT_CallbackRegister(PORTA_IRQn, &stcCb, IrqPriorityLevel0)); /* 无回调函数 */
+    stcCb.pfnCallback = RecordCallback;
+    stcCb.pvArg       = &astcRecord[0];
+    stcCb.u32SrcMask  = INT_SRC_ALL;
+    CHECK(ErrorInvalidParameter == INT_CallbackRegister(PORTA_IRQn, NULL, IrqPriorityLevel0));
+    CHECK(ErrorInvalidParameter == INT_CallbackRegister((IRQn_Type)2, &stcCb, IrqPriorityLevel0)); /* 无此向量 */
+    CHECK(ErrorInvalidParameter == INT_CallbackRegister(HardFault_IRQn, &stcCb, IrqPriorityLevel0));
+    CHECK(ErrorInvalidParameter == INT_CallbackRegister(PORTA_IRQn, &stcCb, (en_irq_priority_level_t)4));
+    CHECK(ErrorInvalidParameter == INT_CallbackUnregister((IRQn_Type)32, &stcCb));
+
+    /* SysTick：只设置优先级，不改变使能 */
+    memset(astcRecord, 0, sizeof(astcRecord));
+    CHECK(Ok == DDL_TickInit(SystemCoreClock / 1000u));
+    CHECK(Ok == INT_CallbackRegister(SysTick_IRQn, &stcCb, IrqPriorityLevel2));
+    CHECK(IrqPriorityLevel2 == NVIC_GetPriority(SysTick_IRQn));
+    DDL_Delay1ms(5u);
+    CHECK((astcRecord[0].u32Count >= 4u) && (astcRecord[0].u32Count <= 6u));
+    CHECK(Ok == INT_CallbackUnregister(SysTick_IRQn, &stcCb));
+    CHECK(0u != (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk));
+}
+
+/**
+ * @brief  GPIO回调：记录并清除所关注的引脚标志
+ * @param  [in] u32Flags STAT
+ * @param  [in] pvArg 记录
+ * @retval None
+ */
+static void PinCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_cb_record_t *pstcRecord = (stc_cb_record_t *)pvArg;
+
+    pstcRecord->u32Count++;
+    pstcRecord->u32Flags = u32Flags;
+    if (pstcRecord == &astcRecord[0])
+    {
+        GPIO_IntFlagClear(GPIOA, GPIO_PIN_00);
+    }
+    else if (pstcRecord == &astcRecord[1])
+    {
+        GPIO_IntFlagClear(GPIOA, u32Flags & (GPIO_PIN_05 | GPIO_PIN_06));
+    }
+    else
+    {
+        GPIO_IntFlagClear(GPIOB, u32Flags);
+    }
+}
+
+/**
+ * @brief  定时器回调：记录（模型中AIFR/IFR由测试程序置位）
+ * @param  [in] u32Flags AIFR或IFR
+ * @param  [in] pvArg 记录
+ * @retval None
+ */
+static void TimerCallback(uint32_t u32Flags, void *pvArg)
+{
+    RecordCallback(u32Flags, pvArg);
+}
+
+/**
+ * @brief  记录回调
+ * @param  [in] u32Flags 中断源标志
+ * @param  [in] pvArg 记录
+ * @retval None
+ */
+static void RecordCallback(uint32_t u32Flags, void *pvArg)
+{
+    stc_cb_record_t *pstcRecord = (stc_cb_record_t *)pvArg;
+
+    pstcRecord->u32Count++;
+    pstcRecord->u32Flags = u32Flags;
+}
+
+/**
+ * @brief  首次调用时注销自身
+ * @param  [in] u32Flags 中断源标志
+ * @param  [in] pvArg 回调节点
+ * @retval None
+ */
+static void SelfRemoveCallback(uint32_t u32Flags, void *pvArg)
+{
+    (void)u32Flags;
+    INT_CallbackUnregister(HSI2C_IRQn, (stc_int_cb_t *)pvArg);
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
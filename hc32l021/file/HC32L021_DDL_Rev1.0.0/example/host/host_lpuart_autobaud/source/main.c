@@ -0,0 +1,429 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART auto-baud detection
+ *        (LPUART_AutoBaudStart, ATIM3 PWC on RXD) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpuart.h"
+#include "gpio.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BAUD_START (2400u) /* 检测前LPUART的波特率，与主机不同 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void      ParamCheck(void);
+static void      MatchCheck(void);
+static void      DetectCheck(void);
+static void      SyncCheck(void);
+static void      RejectCheck(void);
+static void      NoListCheck(void);
+static void      StopCheck(void);
+static void      UartConfig(void);
+static void      AbInitDefault(stc_lpuart_autobaud_init_t *pstcInit);
+static void      OnDone(uint32_t u32Baud, void *pvArg);
+static void      LineSend(uint8_t u8Data, uint32_t u32Baud);
+static boolean_t RxCheck(uint8_t u8Data, uint32_t u32Baud);
+static boolean_t IdleCheck(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t              u32ErrCnt = 0u;
+static stc_lpuart_autobaud_t m_stcAb;
+static uint32_t              m_u32DoneCnt  = 0u;
+static uint32_t              m_u32DoneBaud = 0u;
+
+static const uint32_t m_au32BaudList[] = {1200u, 2400u, 4800u, 9600u, 19200u, 38400u, 57600u, 115200u};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    SYSCTRL_PeriphClockEnable(PeriphClockAtim3);
+
+    ParamCheck();
+    MatchCheck();
+    DetectCheck();
+    SyncCheck();
+    RejectCheck();
+    NoListCheck();
+    StopCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查：同步字节形式、波特率范围、偏差、波特率表，重复开始
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_lpuart_autobaud_init_t stcInit;
+
+    UartConfig();
+    AbInitDefault(&stcInit);
+    CHECK(SystemCoreClock == stcInit.u32Pclk);
+    CHECK(LPUART_AUTOBAUD_SYNC_DEFAULT == stcInit.u8SyncByte);
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, NULL, &stcInit, IrqPriorityLevel2));
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, NULL, IrqPriorityLevel2));
+
+    /* 0x55、0xF1低电平不连续 */
+    stcInit.u8SyncByte = 0x55u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    stcInit.u8SyncByte = 0xF1u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+
+    AbInitDefault(&stcInit);
+    stcInit.u32BaudMin = 230400u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    AbInitDefault(&stcInit);
+    stcInit.u32TolPpm = 200000u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    AbInitDefault(&stcInit);
+    stcInit.u16BaudNum = 0u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    AbInitDefault(&stcInit);
+    stcInit.u32Pclk = 0u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+
+    /* 1波特的脉宽在256分频下仍超出16位计数 */
+    AbInitDefault(&stcInit);
+    stcInit.u32BaudMin = 1u;
+    CHECK(ErrorInvalidParameter == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    CHECK(0u == NVIC->ISER[0]);
+    CHECK(0u != READ_REG32_BIT(LPUART0->SCON, LPUART_SCON_REN));
+
+    /* 开始后接收禁止，RXD接到ATIM3 CH0A；重复开始不影响正在运行的检测 */
+    AbInitDefault(&stcInit);
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_SCON_REN));
+    CHECK((1uL << GPIOAUX_TIMCPS_ATIM3_C0A_Pos) == READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk));
+    CHECK(0u != (NVIC->ISER[0] & (1uL << (uint32_t)ATIM3_IRQn)));
+    CHECK(5u == m_stcAb.u8Bits);
+    CHECK(ErrorInvalidMode == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    CHECK(0u != READ_REG32_BIT(ATIM3_MODE1->M1CR, ATIM3_MODE1_M1CR_CTEN));
+    LPUART_AutoBaudStop(&m_stcAb);
+    CHECK(IdleCheck());
+}
+
+/**
+ * @brief  LPUART_AutoBaudMatch()：最近的标准波特率，超出偏差为0，无表时返回测量值
+ * @retval None
+ */
+static void MatchCheck(void)
+{
+    static const uint32_t au32Near[] = {9600u, 10000u};
+
+    CHECK(9600u == LPUART_AutoBaudMatch(9650u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 30000u));
+    CHECK(115200u == LPUART_AutoBaudMatch(112000u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 30000u));
+    CHECK(0u == LPUART_AutoBaudMatch(48000u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 30000u));
+    CHECK(0u == LPUART_AutoBaudMatch(9950u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 30000u));
+    CHECK(9600u == LPUART_AutoBaudMatch(9600u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 0u));
+    CHECK(0u == LPUART_AutoBaudMatch(9601u, m_au32BaudList, ARRAY_SZ(m_au32BaudList), 0u));
+    CHECK(10000u == LPUART_AutoBaudMatch(9850u, au32Near, ARRAY_SZ(au32Near), 30000u));
+    CHECK(12345u == LPUART_AutoBaudMatch(12345u, NULL, 0u, 30000u));
+}
+
+/**
+ * @brief  以2400波特开始，主机按9600~115200发送同步字节0xF0：检测后设置波特率，之后的数据帧正确接收
+ * @retval None
+ */
+static void DetectCheck(void)
+{
+    static const uint32_t      au32Baud[] = {9600u, 19200u, 57600u, 115200u, 1200u};
+    stc_lpuart_autobaud_init_t stcInit;
+    uint32_t                   i;
+
+    for (i = 0u; i < ARRAY_SZ(au32Baud); i++)
+    {
+        UartConfig();
+        m_u32DoneCnt = 0u;
+        AbInitDefault(&stcInit);
+        CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+
+        /* 同步字节：接收禁止，不产生接收帧 */
+        LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, au32Baud[i]);
+        CHECK(FALSE == LPUART_IntFlagGet(LPUART0, LPUART_FLAG_RC));
+        CHECK(au32Baud[i] == m_stcAb.u32Baud);
+        CHECK((1u == m_u32DoneCnt) && (au32Baud[i] == m_u32DoneBaud));
+        CHECK(0u == m_stcAb.u32Reject);
+        CHECK(IdleCheck());
+        printf("%6u baud: %u ticks << %u\n", (unsigned)au32Baud[i], (unsigned)(m_stcAb.u32Ticks >> m_stcAb.u8PrsShift),
+               (unsigned)m_stcAb.u8PrsShift);
+
+        CHECK(RxCheck(0x5Au, au32Baud[i]));
+        CHECK(RxCheck(0xA5u, au32Baud[i]));
+
+        /* 检测结束后同步字节按数据接收，不再改变波特率 */
+        CHECK(RxCheck(LPUART_AUTOBAUD_SYNC_DEFAULT, au32Baud[i]));
+        CHECK(1u == m_u32DoneCnt);
+    }
+}
+
+/**
+ * @brief  其他同步字节：0x00（9位低电平）、0x80（8位）、0xFE（2位）、0xFF（只有起始位）
+ * @retval None
+ */
+static void SyncCheck(void)
+{
+    static const uint8_t       au8Sync[] = {0x00u, 0x80u, 0xFEu, 0xFFu};
+    static const uint8_t       au8Bits[] = {9u, 8u, 2u, 1u};
+    stc_lpuart_autobaud_init_t stcInit;
+    uint32_t                   i;
+
+    for (i = 0u; i < ARRAY_SZ(au8Sync); i++)
+    {
+        UartConfig();
+        AbInitDefault(&stcInit);
+        stcInit.u8SyncByte = au8Sync[i];
+        CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+        CHECK(au8Bits[i] == m_stcAb.u8Bits);
+
+        LineSend(au8Sync[i], 38400u);
+        CHECK(38400u == m_stcAb.u32Baud);
+        CHECK(IdleCheck());
+        CHECK(RxCheck(0x3Cu, 38400u));
+    }
+}
+
+/**
+ * @brief  干扰脉冲与其他字节被丢弃，之后的同步字节正常检测
+ * @retval None
+ */
+static void RejectCheck(void)
+{
+    stc_lpuart_autobaud_init_t stcInit;
+
+    UartConfig();
+    m_u32DoneCnt = 0u;
+    AbInitDefault(&stcInit);
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+
+    /* 1us低电平脉冲：超出最高波特率 */
+    LineSend(0xFFu, 1000000u);
+    CHECK(1u == m_stcAb.u32Reject);
+    CHECK(0u == m_u32DoneCnt);
+
+    /* 0x55的5个1位低电平按5位换算为48000，不在波特率表中 */
+    LineSend(0x55u, 9600u);
+    CHECK(6u == m_stcAb.u32Reject);
+    CHECK(0u == m_stcAb.u32Baud);
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_SCON_REN));
+
+    /* 低于最低波特率：脉宽超出16位计数，UI置位 */
+    LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, 300u);
+    CHECK(7u == m_stcAb.u32Reject);
+
+    /* 主机时钟偏差+2% */
+    LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, 19584u);
+    CHECK(19200u == m_stcAb.u32Baud);
+    CHECK(1u == m_u32DoneCnt);
+    CHECK(IdleCheck());
+    CHECK(RxCheck(0x96u, 19584u));
+    printf("rejected %u pulses\n", (unsigned)m_stcAb.u32Reject);
+}
+
+/**
+ * @brief  无波特率表：直接使用测量值，可检测非标准波特率
+ * @retval None
+ */
+static void NoListCheck(void)
+{
+    stc_lpuart_autobaud_init_t stcInit;
+
+    UartConfig();
+    AbInitDefault(&stcInit);
+    stcInit.pu32BaudList = NULL;
+    stcInit.u16BaudNum   = 0u;
+    stcInit.u32BaudMax   = 250000u;
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+
+    LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, 250000u);
+    CHECK(250000u == m_stcAb.u32Baud);
+    CHECK(RxCheck(0x81u, 250000u));
+
+    UartConfig();
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, 31250u);
+    CHECK(31250u == m_stcAb.u32Baud);
+    CHECK(RxCheck(0x7Eu, 31250u));
+}
+
+/**
+ * @brief  未检测到时停止：恢复接收及ATIM3_C0A输入选择，波特率不变，可重新开始
+ * @retval None
+ */
+static void StopCheck(void)
+{
+    stc_lpuart_autobaud_init_t stcInit;
+
+    UartConfig();
+    AbInitDefault(&stcInit);
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    LPUART_AutoBaudStop(&m_stcAb);
+    CHECK(0u == m_stcAb.u32Baud);
+    CHECK(IdleCheck());
+    CHECK(RxCheck(0x42u, BAUD_START));
+
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    LineSend(LPUART_AUTOBAUD_SYNC_DEFAULT, 4800u);
+    CHECK(4800u == m_stcAb.u32Baud);
+    CHECK(RxCheck(0x24u, 4800u));
+
+    /* 恢复开始前的ATIM3_C0A输入选择，TIMCPS其他字段不变 */
+    GPIO_TIMCPS_ATIM3_C0A_VC1_OUT();
+    GPIO_TIMCPS_CTIM1_C0_LPUART0_RXD();
+    CHECK(Ok == LPUART_AutoBaudStart(LPUART0, &m_stcAb, &stcInit, IrqPriorityLevel2));
+    CHECK((1uL << GPIOAUX_TIMCPS_ATIM3_C0A_Pos) == READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk));
+    LPUART_AutoBaudStop(&m_stcAb);
+    CHECK((3uL << GPIOAUX_TIMCPS_ATIM3_C0A_Pos) == READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk));
+    CHECK((1uL << GPIOAUX_TIMCPS_CTIM1_C0_Pos) == READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_CTIM1_C0_Msk));
+    GPIO_TIMCPS_ATIM3_C0A_PXY_SEL();
+    GPIO_TIMCPS_CTIM1_C0_PXY_SEL();
+}
+
+/**
+ * @brief  LPUART0按BAUD_START初始化，PCLK为传输时钟
+ * @retval None
+ */
+static void UartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();
+    stcLpuartInit.stcBaudRate.u32Baud       = BAUD_START;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART0);
+}
+
+/**
+ * @brief  默认测试配置：同步字节0xF0，1200~115200，标准波特率表，偏差3%
+ * @param  [out] pstcInit 配置
+ * @retval None
+ */
+static void AbInitDefault(stc_lpuart_autobaud_init_t *pstcInit)
+{
+    LPUART_AutoBaudStcInit(pstcInit);
+    pstcInit->pu32BaudList = m_au32BaudList;
+    pstcInit->u16BaudNum   = ARRAY_SZ(m_au32BaudList);
+    pstcInit->pfnDone      = OnDone;
+}
+
+/**
+ * @brief  检测完成回调（ATIM3中断中）
+ * @param  [in] u32Baud 检测到的波特率
+ * @param  [in] pvArg 回调参数
+ * @retval None
+ */
+static void OnDone(uint32_t u32Baud, void *pvArg)
+{
+    (void)pvArg;
+
+    m_u32DoneCnt++;
+    m_u32DoneBaud = u32Baud;
+}
+
+/**
+ * @brief  主机以u32Baud向RX线发送一帧，以1/8位为步长推进到停止位之后，每步执行挂起的中断
+ * @param  [in] u8Data 数据
+ * @param  [in] u32Baud 主机波特率
+ * @retval None
+ */
+static void LineSend(uint8_t u8Data, uint32_t u32Baud)
+{
+    uint32_t u32Step = SystemCoreClock / u32Baud / 8u;
+    uint64_t u64End;
+
+    u32Step = (0u == u32Step) ? 1u : u32Step;
+    CHECK(Ok == HOST_LpuartRxWave(0u, u8Data, u32Baud));
+
+    u64End = HOST_CycleGet() + ((11u * (uint64_t)SystemCoreClock) / u32Baud);
+    while (HOST_CycleGet() < u64End)
+    {
+        HOST_CycleAdvance(u32Step);
+        HOST_IrqDispatch();
+    }
+}
+
+/**
+ * @brief  主机发送一帧，检查LPUART0收到相同数据且无帧错误
+ * @param  [in] u8Data 数据
+ * @param  [in] u32Baud 主机波特率
+ * @retval boolean_t TRUE: 正确接收
+ */
+static boolean_t RxCheck(uint8_t u8Data, uint32_t u32Baud)
+{
+    boolean_t bRet;
+
+    LineSend(u8Data, u32Baud);
+    bRet = ((TRUE == LPUART_IntFlagGet(LPUART0, LPUART_FLAG_RC)) && (FALSE == LPUART_IntFlagGet(LPUART0, LPUART_FLAG_FE))
+            && (u8Data == LPUART_ReceiveInt(LPUART0)))
+               ? TRUE
+               : FALSE;
+    LPUART_IntFlagClearAll(LPUART0);
+    return bRet;
+}
+
+/**
+ * @brief  检测已结束：ATIM3停止、中断回调已注销、RXD路由为端口、接收使能
+ * @retval boolean_t TRUE: 已结束
+ */
+static boolean_t IdleCheck(void)
+{
+    return ((0u == READ_REG32_BIT(ATIM3_MODE1->M1CR, ATIM3_MODE1_M1CR_CTEN)) && (0u == READ_REG32_BIT(ATIM3_MODE1->CR0, ATIM3_MODE1_CR0_CIEA))
+            && (0u == READ_REG32_BIT(GPIOAUX->TIMCPS, GPIOAUX_TIMCPS_ATIM3_C0A_Msk)) && (0u != READ_REG32_BIT(LPUART0->SCON, LPUART_SCON_REN))
+            && (0u == (NVIC->ISER[0] & (1uL << (uint32_t)ATIM3_IRQn))))
+               ? TRUE
+               : FALSE;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
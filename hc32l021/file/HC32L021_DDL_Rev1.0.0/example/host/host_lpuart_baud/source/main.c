@@ -0,0 +1,229 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the integer baud rate solver of the
+ *        LPUART (LPUART_BaudCalc/LPUART_BAUD_CFG) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdlib.h>
+#include "ddl.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TOLERANCE_PPM (20000) /* 表中标记超出±2%的配置 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void    ParamCheck(void);
+static void    SolverCheck(void);
+static void    ConstCheck(void);
+static void    FrameCheck(void);
+static int32_t Over4ErrPpm(uint32_t u32Sclk, uint32_t u32Baud);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t       u32ErrCnt  = 0u;
+static const uint32_t au32Clk[]  = {4000000u, 6000000u, 32000000u, 48000000u};
+static const uint32_t au32Baud[] = {1200u, 2400u, 4800u, 9600u, 19200u, 38400u, 57600u, 115200u, 230400u, 460800u, 921600u};
+
+/* 编译期计算的配置 */
+static const stc_lpuart_baud_cfg_t astcConstCfg[] = {
+    LPUART_BAUD_CFG(4000000u, 9600u),    LPUART_BAUD_CFG(4000000u, 115200u),  LPUART_BAUD_CFG(6000000u, 57600u),
+    LPUART_BAUD_CFG(32000000u, 115200u), LPUART_BAUD_CFG(48000000u, 921600u), LPUART_BAUD_CFG(48000000u, 150u),
+};
+static const uint32_t au32ConstClk[]  = {4000000u, 4000000u, 6000000u, 32000000u, 48000000u, 48000000u};
+static const uint32_t au32ConstBaud[] = {9600u, 115200u, 57600u, 115200u, 921600u, 150u};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    ParamCheck();
+    SolverCheck();
+    ConstCheck();
+    FrameCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数为0、无有效配置
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_lpuart_baud_cfg_t stcCfg;
+
+    CHECK(ErrorInvalidParameter == LPUART_BaudCalc(48000000u, 0u, &stcCfg));
+    CHECK(ErrorInvalidParameter == LPUART_BaudCalc(0u, 9600u, &stcCfg));
+    CHECK(ErrorInvalidParameter == LPUART_BaudCalc(48000000u, 9600u, NULL));
+    /* 16分频下SCNT为300000，超出范围 */
+    CHECK(ErrorInvalidParameter == LPUART_BaudCalc(48000000u, 10u, &stcCfg));
+    CHECK(LPUART_BAUD_SCNT(48000000u, 10u, 16u) > 0xFFFFu);
+
+    /* 原4分频计算SCNT为80000，超出范围 */
+    CHECK(Ok == LPUART_BaudCalc(48000000u, 150u, &stcCfg));
+    CHECK((LPUART_OVER_16 == stcCfg.u32Over) && (20000u == stcCfg.u32Scnt) && (150u == stcCfg.u32Baud) && (0 == stcCfg.i32ErrPpm));
+    CHECK(LPUART_BAUD_SCNT(48000000u, 150u, 4u) > 0xFFFFu);
+
+    /* SCNT不小于1 */
+    CHECK(Ok == LPUART_BaudCalc(4000000u, 3000000u, &stcCfg));
+    CHECK((LPUART_OVER_4 == stcCfg.u32Over) && (1u == stcCfg.u32Scnt) && (1000000u == stcCfg.u32Baud));
+}
+
+/**
+ * @brief  RC48M各频率及常用波特率：误差不大于原4分频计算，误差相同时取较大的分频；输出误差表
+ * @retval None
+ */
+static void SolverCheck(void)
+{
+    stc_lpuart_baud_cfg_t stcCfg;
+    int32_t               i32Old;
+    uint32_t              u32Div;
+    uint32_t              i;
+    uint32_t              j;
+
+    printf("%-8s", "baud");
+    for (i = 0u; i < ARRAY_SZ(au32Clk); i++)
+    {
+        printf("  %8uHz  div     ppm", (unsigned)au32Clk[i]);
+    }
+    printf("\n");
+
+    for (j = 0u; j < ARRAY_SZ(au32Baud); j++)
+    {
+        printf("%-8u", (unsigned)au32Baud[j]);
+        for (i = 0u; i < ARRAY_SZ(au32Clk); i++)
+        {
+            CHECK(Ok == LPUART_BaudCalc(au32Clk[i], au32Baud[j], &stcCfg));
+            u32Div = 16u >> (stcCfg.u32Over >> LPUART_SCON_OVER_Pos);
+            i32Old = Over4ErrPpm(au32Clk[i], au32Baud[j]);
+
+            CHECK(abs(stcCfg.i32ErrPpm) <= abs(i32Old));
+            CHECK((au32Clk[i] / (u32Div * stcCfg.u32Scnt)) == stcCfg.u32Baud);
+            /* 较大的分频误差相同时应被选中 */
+            if (u32Div < 16u)
+            {
+                CHECK(abs(LPUART_BAUD_ERR_PPM(au32Clk[i], au32Baud[j], u32Div * 2u)) > abs(stcCfg.i32ErrPpm));
+            }
+            printf("  %10s %4u %7d%s", "", (unsigned)u32Div, (int)stcCfg.i32ErrPpm, (abs(stcCfg.i32ErrPpm) > TOLERANCE_PPM) ? "*" : " ");
+        }
+        printf("\n");
+    }
+    printf("* |error| > %d ppm\n", TOLERANCE_PPM);
+}
+
+/**
+ * @brief  编译期计算LPUART_BAUD_CFG()与LPUART_BaudCalc()一致
+ * @retval None
+ */
+static void ConstCheck(void)
+{
+    stc_lpuart_baud_cfg_t stcCfg;
+    uint32_t              i;
+
+    for (i = 0u; i < ARRAY_SZ(astcConstCfg); i++)
+    {
+        CHECK(Ok == LPUART_BaudCalc(au32ConstClk[i], au32ConstBaud[i], &stcCfg));
+        CHECK(stcCfg.u32Over == astcConstCfg[i].u32Over);
+        CHECK(stcCfg.u32Scnt == astcConstCfg[i].u32Scnt);
+        CHECK(stcCfg.u32Baud == astcConstCfg[i].u32Baud);
+        CHECK(stcCfg.i32ErrPpm == astcConstCfg[i].i32ErrPpm);
+    }
+}
+
+/**
+ * @brief  LPUART_Init()设置OVER及SCNT，帧时间与计算的波特率一致
+ * @retval None
+ */
+static void FrameCheck(void)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit;
+    stc_lpuart_init_t        stcInit;
+    stc_lpuart_baud_cfg_t    stcCfg;
+    uint32_t                 u32Bps;
+    uint32_t                 u32Div;
+    uint32_t                 j;
+
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+    stcSysClockInit.u32SysClockSrc = SYSCTRL_CLK_SRC_RC48M_48M;
+    SYSCTRL_ClockInit(&stcSysClockInit);
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+
+    for (j = 0u; j < ARRAY_SZ(au32Baud); j++)
+    {
+        LPUART_StcInit(&stcInit);
+        stcInit.stcBaudRate.u32Baud = au32Baud[j];
+        u32Bps                      = LPUART_Init(LPUART0, &stcInit);
+
+        CHECK(Ok == LPUART_BaudCalc(SystemCoreClock, au32Baud[j], &stcCfg));
+        CHECK(stcCfg.u32Baud == u32Bps);
+        CHECK(stcCfg.u32Over == READ_REG32_BIT(LPUART0->SCON, LPUART_SCON_OVER));
+        CHECK(stcCfg.u32Scnt == LPUART0->SCNT);
+        /* 8N1：10位 */
+        u32Div = 16u >> (stcCfg.u32Over >> LPUART_SCON_OVER_Pos);
+        CHECK((10u * u32Div * stcCfg.u32Scnt) == HOST_LpuartFrameCycles(0u));
+    }
+
+    /* 无有效配置：返回0 */
+    stcInit.stcBaudRate.u32Baud = 0u;
+    CHECK(0u == LPUART_Init(LPUART0, &stcInit));
+}
+
+/**
+ * @brief  原固定4分频计算的误差
+ * @param  [in] u32Sclk 传输时钟频率
+ * @param  [in] u32Baud 波特率
+ * @retval int32_t 误差，单位ppm
+ */
+static int32_t Over4ErrPpm(uint32_t u32Sclk, uint32_t u32Baud)
+{
+    uint32_t u32Scnt = DDL_UDivRound(u32Sclk, u32Baud << 2);
+
+    u32Scnt = (0u == u32Scnt) ? 1u : u32Scnt;
+    return (int32_t)((((int64_t)u32Sclk - ((int64_t)u32Scnt * 4 * u32Baud)) * 1000000) / ((int64_t)u32Scnt * 4 * u32Baud));
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
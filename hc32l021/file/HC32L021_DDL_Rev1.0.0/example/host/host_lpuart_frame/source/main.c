@@ -0,0 +1,508 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART inter-frame gap framing
+ *        (LPUART_FrameInit) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "btim.h"
+#include "ddl.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  线路上的一个字节
+ */
+typedef struct
+{
+    uint32_t u32IdleUs; /*!< 该字节起始位之前的静默时间 */
+    uint8_t  u8Data;    /*!< 数据 */
+    uint8_t  u8Fe;      /*!< 以帧错误接收 */
+} stc_line_byte_t;
+
+/**
+ * @brief  帧回调记录
+ */
+typedef struct
+{
+    uint8_t *pu8Data;   /*!< 帧回调的帧缓冲 */
+    uint16_t u16Len;    /*!< 帧长度 */
+    uint32_t u32Status; /*!< 帧状态 */
+    uint64_t u64Cycle;  /*!< 帧回调时刻 */
+} stc_frame_rec_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BAUD       (9600u)
+#define FRAME_SIZE (16u) /* 每个帧缓冲长度 */
+#define IDLE_US    (10000u)
+#define REC_MAX    (16u)
+#define LINE_MAX   (64u)
+
+#define REG_ADDR(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg))
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     ParamCheck(void);
+static void     FrameCheck(void);
+static void     OverflowCheck(void);
+static void     HoldCheck(void);
+static void     RaceCheck(void);
+static void     DeInitCheck(void);
+static void     HwConfig(void);
+static void     FrameInitDefault(stc_lpuart_frame_init_t *pstcInit);
+static void     OnFrame(uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+static void     LineAdd(const uint8_t *pu8Data, uint32_t u32Len, uint32_t u32IdleUs, uint32_t u32CharGapUs);
+static void     LineByteEvent(void *pvArg);
+static uint32_t LineRun(boolean_t bRelease);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t           u32ErrCnt = 0u;
+static stc_lpuart_frame_t m_stcFrame;
+static uint8_t            m_au8Buf[FRAME_SIZE * 2u];
+
+static stc_line_byte_t m_astcLine[LINE_MAX];
+static uint32_t        m_u32LineLen = 0u;
+static uint32_t        m_u32LinePos = 0u;
+static uint64_t        m_u64LastRx  = 0u;
+
+static stc_frame_rec_t m_astcRec[REC_MAX];
+static uint8_t         m_au8Copy[REC_MAX][FRAME_SIZE]; /* 主循环处理时复制的帧数据 */
+static uint32_t        m_u32RecCnt = 0u;
+
+static const uint8_t m_au8Req[]  = {0x01u, 0x03u, 0x00u, 0x00u, 0x00u, 0x0Au, 0xC5u, 0xCDu}; /* Modbus读保持寄存器 */
+static const uint8_t m_au8Resp[] = {0x01u, 0x06u, 0x00u, 0x01u, 0x00u, 0x03u, 0x98u, 0x0Bu, 0x11u, 0x22u};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    HwConfig();
+
+    ParamCheck();
+    FrameCheck();
+    OverflowCheck();
+    HoldCheck();
+    RaceCheck();
+    DeInitCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查、间隔宏、BTIM配置，重复初始化
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_lpuart_frame_init_t stcInit;
+
+    /* Modbus RTU：11位字符，19200以上固定750us/1750us */
+    CHECK(1719u == LPUART_FRAME_GAP_US(9600u, LPUART_FRAME_T15));
+    CHECK(4011u == LPUART_FRAME_GAP_US(9600u, LPUART_FRAME_T35));
+    CHECK(2006u == LPUART_FRAME_GAP_US(19200u, LPUART_FRAME_T35));
+    CHECK(750u == LPUART_FRAME_GAP_US(38400u, LPUART_FRAME_T15));
+    CHECK(1750u == LPUART_FRAME_GAP_US(115200u, LPUART_FRAME_T35));
+
+    FrameInitDefault(&stcInit);
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, NULL, &stcInit, IrqPriorityLevel2));
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, NULL, IrqPriorityLevel2));
+    stcInit.BTIMx = (BTIM_TypeDef *)LPUART0;
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    FrameInitDefault(&stcInit);
+    stcInit.pfnFrame = NULL;
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    FrameInitDefault(&stcInit);
+    stcInit.u16BufSize = 1u;
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    /* 48MHz下32768分频最长约44.7s */
+    FrameInitDefault(&stcInit);
+    stcInit.u32EndGapUs = 60000000u;
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    /* 字符时间加t1.5不小于t3.5时无法区分 */
+    FrameInitDefault(&stcInit);
+    stcInit.u32CharGapUs = LPUART_FRAME_GAP_US(BAUD, 30u);
+    CHECK(ErrorInvalidParameter == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    CHECK(0u == NVIC->ISER[0]);
+
+    /* u32EndGapUs为0按t3.5：4011us*48MHz超出16位，取4分频 */
+    FrameInitDefault(&stcInit);
+    stcInit.u32EndGapUs = 0u;
+    CHECK(Ok == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    CHECK(BTIM_COUNTER_CLK_DIV4 == READ_REG32_BIT(BTIM0->CR, BTIM_CR_PRS_Msk));
+    CHECK((4011u * 12u - 1u) == READ_REG32_BIT(BTIM0->ARR, BTIM_ARR_ARR_Msk));
+    CHECK(BTIM_ONESHOT_COUNTER == READ_REG32_BIT(BTIM0->CR, BTIM_CR_OST_Msk));
+    CHECK(0u == READ_REG32_BIT(BTIM0->CR, BTIM_CR_CEN_Msk)); /* 收到第一个字节时才启动 */
+    CHECK(BTIM_INT_UI == READ_REG32_BIT(BTIM0->IER, BTIM_INT_UI));
+    CHECK(((1146u + 1719u) * 12u) == m_stcFrame.u16CharTicks); /* 11位字符1146us加t1.5 */
+    CHECK(0u != (NVIC->ISER[0] & (1uL << (uint32_t)LPUART1_IRQn)));
+    CHECK(0u != (NVIC->ISER[0] & (1uL << (uint32_t)CTIM0_IRQn)));
+
+    /* 重复初始化不影响已运行的实例 */
+    CHECK(ErrorInvalidMode == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    CHECK(0u != READ_REG32_BIT(LPUART1->SCON, LPUART_INT_RC));
+    CHECK(BTIM_INT_UI == READ_REG32_BIT(BTIM0->IER, BTIM_INT_UI));
+    LPUART_FrameDeInit(&m_stcFrame);
+
+    /* BTIM_OneShotSet()按参数设置 */
+    BTIM_OneShotSet(BTIM1, BTIM_ONESHOT_COUNTER);
+    CHECK(BTIM_ONESHOT_COUNTER == READ_REG32_BIT(BTIM1->CR, BTIM_CR_OST_Msk));
+    BTIM_OneShotSet(BTIM1, BTIM_CONTINUOUS_COUNTER);
+    CHECK(BTIM_CONTINUOUS_COUNTER == READ_REG32_BIT(BTIM1->CR, BTIM_CR_OST_Msk));
+}
+
+/**
+ * @brief  帧间隔分帧：每帧回调一次、主循环每帧唤醒一次，t1.5检查，FE标记，帧结束时刻
+ * @retval None
+ */
+static void FrameCheck(void)
+{
+    stc_lpuart_frame_init_t stcInit;
+    stc_host_access_stat_t  stcStat;
+    uint32_t                u32Bytes;
+    uint32_t                u32Wakeup;
+    uint64_t                u64Gap;
+    uint64_t                u64End;
+
+    FrameInitDefault(&stcInit);
+    CHECK(Ok == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+
+    LineAdd(m_au8Req, sizeof(m_au8Req), IDLE_US, 0u);    /* 0: 连续 */
+    LineAdd(m_au8Resp, 5u, IDLE_US, 1000u);              /* 1: 字符间1ms（小于t1.5） */
+    LineAdd(m_au8Resp, 6u, IDLE_US, 2500u);              /* 2: 字符间2.5ms（t1.5~t3.5） */
+    LineAdd(m_au8Req, 4u, IDLE_US, 0u);                  /* 3: 第3字节帧错误 */
+    m_astcLine[m_u32LineLen - 2u].u8Fe = 1u;
+    LineAdd(m_au8Resp, 3u, IDLE_US, 0u);                 /* 4/5: 字符间5ms（大于t3.5）分为两帧 */
+    LineAdd(&m_au8Resp[3], 3u, 5000u, 0u);
+    u32Bytes = m_u32LineLen;
+
+    HOST_AccessStatClear();
+    u32Wakeup = LineRun(TRUE);
+    HOST_AccessStatGet(&stcStat);
+
+    CHECK(6u == m_u32RecCnt);
+    CHECK(6u == m_stcFrame.u32FrameCnt);
+    CHECK(6u == u32Wakeup);
+    CHECK((sizeof(m_au8Req) == m_astcRec[0].u16Len) && (LPUART_FRAME_STS_OK == m_astcRec[0].u32Status));
+    CHECK(0 == memcmp(m_au8Copy[0], m_au8Req, sizeof(m_au8Req)));
+    CHECK((5u == m_astcRec[1].u16Len) && (LPUART_FRAME_STS_OK == m_astcRec[1].u32Status));
+    CHECK(0 == memcmp(m_au8Copy[1], m_au8Resp, 5u));
+    CHECK((6u == m_astcRec[2].u16Len) && (LPUART_FRAME_STS_CHAR_GAP == m_astcRec[2].u32Status));
+    CHECK((4u == m_astcRec[3].u16Len) && (LPUART_FRAME_STS_RX_ERR == m_astcRec[3].u32Status));
+    CHECK((3u == m_astcRec[4].u16Len) && (3u == m_astcRec[5].u16Len));
+    CHECK(0 == memcmp(m_au8Copy[5], &m_au8Resp[3], 3u));
+    /* 两个帧缓冲交替使用 */
+    CHECK((m_astcRec[0].pu8Data == &m_au8Buf[0]) && (m_astcRec[1].pu8Data == &m_au8Buf[FRAME_SIZE]));
+
+    /* 最后一字节接收完成后t3.5交出帧（误差为中断执行时间） */
+    u64Gap = (uint64_t)LPUART_FRAME_GAP_US(BAUD, LPUART_FRAME_T35) * (SystemCoreClock / 1000000u);
+    u64End = m_astcRec[5].u64Cycle - m_u64LastRx;
+    printf("frame end %llu cycles after last byte (t3.5 %llu)\n", (unsigned long long)u64End, (unsigned long long)u64Gap);
+    CHECK((u64End >= u64Gap) && (u64End < (u64Gap + 200u)));
+
+    printf("%u bytes, %u frames: irqs %llu, main loop wakeups %u\n", (unsigned)u32Bytes, (unsigned)m_u32RecCnt,
+           (unsigned long long)stcStat.u64Irq, (unsigned)u32Wakeup);
+    CHECK(stcStat.u64Irq == (u32Bytes + m_u32RecCnt));
+
+    LPUART_FrameDeInit(&m_stcFrame);
+}
+
+/**
+ * @brief  帧长度超出帧缓冲：截断并标记，下一帧不受影响
+ * @retval None
+ */
+static void OverflowCheck(void)
+{
+    stc_lpuart_frame_init_t stcInit;
+    uint8_t                 au8Long[FRAME_SIZE + 4u];
+    uint32_t                i;
+
+    for (i = 0u; i < sizeof(au8Long); i++)
+    {
+        au8Long[i] = (uint8_t)(0x40u + i);
+    }
+
+    FrameInitDefault(&stcInit);
+    CHECK(Ok == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    LineAdd(au8Long, sizeof(au8Long), IDLE_US, 0u);
+    LineAdd(m_au8Req, sizeof(m_au8Req), IDLE_US, 0u);
+    (void)LineRun(TRUE);
+
+    CHECK(2u == m_u32RecCnt);
+    CHECK((FRAME_SIZE == m_astcRec[0].u16Len) && (LPUART_FRAME_STS_OVERFLOW == m_astcRec[0].u32Status));
+    CHECK(0 == memcmp(m_au8Copy[0], au8Long, FRAME_SIZE));
+    CHECK((sizeof(m_au8Req) == m_astcRec[1].u16Len) && (LPUART_FRAME_STS_OK == m_astcRec[1].u32Status));
+    CHECK(0 == memcmp(m_au8Copy[1], m_au8Req, sizeof(m_au8Req)));
+    LPUART_FrameDeInit(&m_stcFrame);
+}
+
+/**
+ * @brief  帧缓冲被持有：另一缓冲继续接收，无空闲缓冲交出时丢弃该帧；归还后恢复
+ * @retval None
+ */
+static void HoldCheck(void)
+{
+    stc_lpuart_frame_init_t stcInit;
+
+    FrameInitDefault(&stcInit);
+    CHECK(Ok == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    LineAdd(m_au8Req, 4u, IDLE_US, 0u);
+    LineAdd(m_au8Resp, 4u, IDLE_US, 0u);
+    (void)LineRun(FALSE);
+
+    CHECK(1u == m_u32RecCnt);
+    CHECK(1u == m_stcFrame.u32FrameDrop);
+    CHECK(0 == memcmp(m_astcRec[0].pu8Data, m_au8Req, 4u)); /* 持有的帧未被覆盖 */
+
+    LPUART_FrameRelease(&m_stcFrame, m_astcRec[0].pu8Data);
+    LineAdd(m_au8Resp, 4u, IDLE_US, 0u);
+    (void)LineRun(TRUE);
+    CHECK(1u == m_u32RecCnt);
+    CHECK((4u == m_astcRec[0].u16Len) && (0 == memcmp(m_au8Copy[0], m_au8Resp, 4u)));
+    CHECK(2u == m_stcFrame.u32FrameCnt);
+    LPUART_FrameDeInit(&m_stcFrame);
+}
+
+/**
+ * @brief  帧结束间隔到期与下一字节的接收中断同时挂起：接收中断先执行时先结束上一帧
+ * @retval None
+ */
+static void RaceCheck(void)
+{
+    stc_lpuart_frame_init_t stcInit;
+    uint32_t                u32Gap = LPUART_FRAME_GAP_US(BAUD, LPUART_FRAME_T35) * (SystemCoreClock / 1000000u);
+
+    FrameInitDefault(&stcInit);
+    CHECK(Ok == LPUART_FrameInit(LPUART1, &m_stcFrame, &stcInit, IrqPriorityLevel2));
+    m_u32RecCnt = 0u;
+
+    CHECK(Ok == HOST_LpuartRxPush(1u, 0x5Au));
+    HOST_IrqDispatch();
+    __disable_irq();
+    HOST_CycleAdvance(u32Gap + 1000u);
+    CHECK(TRUE == BTIM_IntFlagGet(BTIM0, BTIM_FLAG_UI));
+    CHECK(Ok == HOST_LpuartRxPush(1u, 0xA5u));
+    __enable_irq(); /* LPUART1（9）先于CTIM0（14）执行 */
+
+    CHECK(1u == m_u32RecCnt);
+    CHECK((1u == m_astcRec[0].u16Len) && (0x5Au == m_astcRec[0].pu8Data[0]) && (LPUART_FRAME_STS_OK == m_astcRec[0].u32Status));
+    LPUART_FrameRelease(&m_stcFrame, m_astcRec[0].pu8Data);
+
+    HOST_CycleAdvance(u32Gap + 1000u);
+    HOST_IrqDispatch();
+    CHECK(2u == m_u32RecCnt);
+    CHECK((1u == m_astcRec[1].u16Len) && (0xA5u == m_astcRec[1].pu8Data[0]) && (LPUART_FRAME_STS_OK == m_astcRec[1].u32Status));
+    CHECK(2u == m_stcFrame.u32FrameCnt);
+    LPUART_FrameDeInit(&m_stcFrame);
+}
+
+/**
+ * @brief  停止后不再接收，中断回调已注销
+ * @retval None
+ */
+static void DeInitCheck(void)
+{
+    CHECK(0u == READ_REG32_BIT(LPUART1->SCON, LPUART_INT_RC));
+    CHECK(0u == READ_REG32_BIT(BTIM0->IER, BTIM_INT_UI));
+    CHECK(0u == READ_REG32_BIT(BTIM0->CR, BTIM_CR_CEN_Msk));
+    CHECK(0u == (NVIC->ISER[0] & ((1uL << (uint32_t)LPUART1_IRQn) | (1uL << (uint32_t)CTIM0_IRQn))));
+
+    LineAdd(m_au8Req, 4u, IDLE_US, 0u);
+    (void)LineRun(TRUE);
+    CHECK(0u == m_u32RecCnt);
+}
+
+/**
+ * @brief  48MHz，LPUART1 9600bps 8N1，CTIMER0配置为BTIM
+ * @retval None
+ */
+static void HwConfig(void)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit;
+    stc_lpuart_init_t        stcLpuartInit;
+
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+    stcSysClockInit.u32SysClockSrc = SYSCTRL_CLK_SRC_RC48M_48M;
+    SYSCTRL_ClockInit(&stcSysClockInit);
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BAUD;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART1);
+
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+}
+
+/**
+ * @brief  默认测试配置：BTIM0，t1.5/t3.5，2*16字节帧缓冲
+ * @param  [out] pstcInit 配置
+ * @retval None
+ */
+static void FrameInitDefault(stc_lpuart_frame_init_t *pstcInit)
+{
+    LPUART_FrameStcInit(pstcInit);
+    pstcInit->BTIMx        = BTIM0;
+    pstcInit->u32Baud      = BAUD;
+    pstcInit->u32EndGapUs  = LPUART_FRAME_GAP_US(BAUD, LPUART_FRAME_T35);
+    pstcInit->u32CharGapUs = LPUART_FRAME_GAP_US(BAUD, LPUART_FRAME_T15);
+    pstcInit->pu8Buf       = m_au8Buf;
+    pstcInit->u16BufSize   = sizeof(m_au8Buf);
+    pstcInit->pfnFrame     = OnFrame;
+    pstcInit->pvArg        = &m_stcFrame;
+}
+
+/**
+ * @brief  帧回调：记录帧，清除SLEEPONEXIT使主循环返回
+ * @retval None
+ */
+static void OnFrame(uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg)
+{
+    CHECK(&m_stcFrame == pvArg);
+    if (m_u32RecCnt < REC_MAX)
+    {
+        m_astcRec[m_u32RecCnt].pu8Data   = pu8Data;
+        m_astcRec[m_u32RecCnt].u16Len    = u16Len;
+        m_astcRec[m_u32RecCnt].u32Status = u32Status;
+        m_astcRec[m_u32RecCnt].u64Cycle  = HOST_CycleGet();
+        m_u32RecCnt++;
+    }
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+}
+
+/**
+ * @brief  向线路追加一帧
+ * @param  [in] pu8Data 数据
+ * @param  [in] u32Len 长度
+ * @param  [in] u32IdleUs 帧前静默时间
+ * @param  [in] u32CharGapUs 帧内字符间静默时间
+ * @retval None
+ */
+static void LineAdd(const uint8_t *pu8Data, uint32_t u32Len, uint32_t u32IdleUs, uint32_t u32CharGapUs)
+{
+    uint32_t i;
+
+    for (i = 0u; (i < u32Len) && (m_u32LineLen < LINE_MAX); i++)
+    {
+        m_astcLine[m_u32LineLen].u32IdleUs = (0u == i) ? u32IdleUs : u32CharGapUs;
+        m_astcLine[m_u32LineLen].u8Data    = pu8Data[i];
+        m_astcLine[m_u32LineLen].u8Fe      = 0u;
+        m_u32LineLen++;
+    }
+}
+
+/**
+ * @brief  线路字节接收完成（模拟时间事件），登记下一字节
+ */
+static void LineByteEvent(void *pvArg)
+{
+    stc_line_byte_t *pstc = &m_astcLine[m_u32LinePos];
+    uint32_t         u32Isr = REG_ADDR(LPUART1_BASE, LPUART_TypeDef, ISR);
+
+    (void)pvArg;
+
+    if (0u != pstc->u8Fe)
+    {
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_FE_Msk);
+    }
+    (void)HOST_LpuartRxPush(1u, pstc->u8Data);
+    m_u64LastRx = HOST_CycleGet();
+
+    if (++m_u32LinePos < m_u32LineLen)
+    {
+        pstc = &m_astcLine[m_u32LinePos];
+        (void)HOST_EventSchedule((uint64_t)HOST_LpuartFrameCycles(1u) + ((uint64_t)pstc->u32IdleUs * (SystemCoreClock / 1000000u)),
+                                 LineByteEvent, NULL);
+    }
+}
+
+/**
+ * @brief  主循环：SLEEPONEXIT休眠，帧回调后返回处理帧；线路数据发完且无定时事件时结束
+ * @param  [in] bRelease 处理后归还帧缓冲
+ * @retval uint32_t 因帧回调唤醒的次数
+ */
+static uint32_t LineRun(boolean_t bRelease)
+{
+    uint32_t u32Wakeup = 0u;
+    uint32_t u32Done   = 0u;
+    uint32_t u32StCtrl = SysTick->CTRL;
+
+    /* 停止SystemInit()启动的SysTick：线路数据发完且BTIM停止后WFI无唤醒源即返回 */
+    SysTick->CTRL = 0u;
+    m_u32RecCnt   = 0u;
+    m_u32LinePos  = 0u;
+    if (0u != m_u32LineLen)
+    {
+        (void)HOST_EventSchedule((uint64_t)HOST_LpuartFrameCycles(1u) + ((uint64_t)m_astcLine[0].u32IdleUs * (SystemCoreClock / 1000000u)),
+                                 LineByteEvent, NULL);
+    }
+
+    for (;;)
+    {
+        SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+        __WFI();
+        if (u32Done == m_u32RecCnt)
+        {
+            break; /* 没有唤醒源 */
+        }
+        u32Wakeup++;
+        for (; u32Done < m_u32RecCnt; u32Done++)
+        {
+            memcpy(m_au8Copy[u32Done], m_astcRec[u32Done].pu8Data, m_astcRec[u32Done].u16Len);
+            if (TRUE == bRelease)
+            {
+                LPUART_FrameRelease(&m_stcFrame, m_astcRec[u32Done].pu8Data);
+            }
+        }
+    }
+
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+    SysTick->CTRL = u32StCtrl;
+    m_u32LineLen  = 0u;
+    return u32Wakeup;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
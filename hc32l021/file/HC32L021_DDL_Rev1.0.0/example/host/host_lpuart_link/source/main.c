@@ -0,0 +1,701 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART framed link layer (SLIP
+ *        framing, CRC-16, sequence numbers, go-back-N retransmit) with
+ *        LPUART0 and LPUART1 cross-connected on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpuart.h"
+#include "lpuart_link.h"
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BAUD      (115200u)
+#define STEP      (50u)   /* 模拟时间步长，HCLK周期 */
+#define RETX_US   (5000u) /* 可靠模式重发超时 */
+#define RX_SIZE   (32u)   /* 接收帧缓冲长度 */
+#define LOG_MAX   (16u)   /* 接收及释放记录条数 */
+#define FRAME_NUM (8u)    /* 测试帧数 */
+#define ANY_SEQ   (0xFFu)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  链路端点：控制块及收发记录
+ */
+typedef struct
+{
+    stc_lpuart_link_t stcLink;
+    uint8_t           au8RxBuf[RX_SIZE];
+    uint32_t          u32RxCnt;          /* 收到的帧数 */
+    uint8_t           au8RxId[LOG_MAX];  /* 每帧第一个数据字节 */
+    uint32_t          u32RxBad;          /* 数据与发送不符的帧数 */
+    uint32_t          u32DoneCnt;        /* 释放回调次数 */
+    const uint8_t    *apu8Done[LOG_MAX]; /* 释放的缓冲 */
+    uint32_t          u32AbortCnt;       /* 其中中止的次数 */
+    uint32_t          u32WireCnt;        /* 线路上发出的字节数 */
+    uint8_t           u8WirePos;         /* 当前帧已发出的字节数（帧结束符清零） */
+    uint8_t           u8WireType;        /* 当前帧类型 */
+} stc_node_t;
+
+/**
+ * @brief  线路干扰：把指定类型及序号的帧的序号字节翻转一位，接收方CRC错误
+ */
+typedef struct
+{
+    uint8_t  u8Type; /* 帧类型 */
+    uint8_t  u8Seq;  /* 序号，ANY_SEQ为任意 */
+    uint32_t u32Cnt; /* 剩余次数 */
+} stc_wire_fault_t;
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void      CrcCheck(void);
+static void      ParamCheck(void);
+static void      StreamCheck(void);
+static void      LossCheck(void);
+static void      OverflowCheck(void);
+static void      QueueCheck(void);
+static void      ReliableCheck(void);
+static void      LostAckCheck(void);
+static void      AbortCheck(void);
+static void      UartConfig(void);
+static void      NodeInit(uint8_t u8Unit, uint8_t u8Window, uint16_t u16RxSize);
+static void      NodeDeInit(void);
+static void      FrameFill(void);
+static boolean_t Run(uint64_t u64MaxCycles, uint32_t u32RxA, uint32_t u32RxB);
+static void      Step(uint64_t u64Cycles);
+static uint32_t  EncLen(uint8_t u8Type, uint8_t u8Seq, const uint8_t *pu8Data, uint16_t u16Len);
+static void      Wire(uint8_t u8Unit, uint16_t u16Data);
+static void      OnRx(const uint8_t *pu8Data, uint16_t u16Len, void *pvArg);
+static void      OnTxDone(const uint8_t *pu8Data, uint32_t u32Status, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+
+static stc_node_t       m_astcNode[2];  /* 0: LPUART0，1: LPUART1 */
+static stc_wire_fault_t m_astcFault[2]; /* 各单元发出方向的干扰 */
+
+/* 发送帧：第一个字节为帧编号，数据含帧结束符及转义字节 */
+static uint8_t  m_au8Frame[FRAME_NUM][12];
+static uint16_t m_au16FrameLen[FRAME_NUM];
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    HOST_LpuartTxHookSet(Wire);
+    FrameFill();
+
+    CrcCheck();
+    ParamCheck();
+    StreamCheck();
+    LossCheck();
+    OverflowCheck();
+    QueueCheck();
+    ReliableCheck();
+    LostAckCheck();
+    AbortCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  CRC-16/CCITT-FALSE校验值，分段计算，附加CRC后余数为0
+ * @retval None
+ */
+static void CrcCheck(void)
+{
+    const uint8_t au8Str[] = "123456789";
+    uint8_t       au8Buf[11];
+    uint16_t      u16Crc;
+
+    u16Crc = LPUART_LinkCrc16(0xFFFFu, au8Str, 9u);
+    CHECK(0x29B1u == u16Crc);
+    CHECK(u16Crc == LPUART_LinkCrc16(LPUART_LinkCrc16(0xFFFFu, au8Str, 4u), &au8Str[4], 5u));
+
+    memcpy(au8Buf, au8Str, 9u);
+    au8Buf[9]  = (uint8_t)(u16Crc >> 8);
+    au8Buf[10] = (uint8_t)u16Crc;
+    CHECK(0u == LPUART_LinkCrc16(0xFFFFu, au8Buf, 11u));
+}
+
+/**
+ * @brief  参数检查、重复初始化、停止后禁止中断
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_lpuart_link_init_t stcInit;
+    stc_lpuart_link_t     *pstcLink = &m_astcNode[0].stcLink;
+
+    UartConfig();
+    LPUART_LinkStcInit(&stcInit);
+    CHECK(ErrorInvalidParameter == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    stcInit.pu8RxBuf  = m_astcNode[0].au8RxBuf;
+    stcInit.u16RxSize = LPUART_LINK_OVERHEAD - 1u;
+    CHECK(ErrorInvalidParameter == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    stcInit.u16RxSize = RX_SIZE;
+    stcInit.u8Window  = LPUART_LINK_TXQ_SIZE + 1u;
+    CHECK(ErrorInvalidParameter == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    stcInit.u8Window  = 2u;
+    stcInit.u32RetxUs = 0u;
+    CHECK(ErrorInvalidParameter == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    CHECK(ErrorInvalidParameter == LPUART_LinkInit(LPUART0, NULL, &stcInit, IrqPriorityLevel2));
+
+    stcInit.u32RetxUs = RETX_US;
+    CHECK(Ok == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    CHECK(ErrorInvalidMode == LPUART_LinkInit(LPUART0, pstcLink, &stcInit, IrqPriorityLevel2));
+    CHECK(0u != READ_REG32_BIT(LPUART0->SCON, LPUART_INT_RC));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_TXE));
+
+    CHECK(ErrorInvalidParameter == LPUART_LinkSend(pstcLink, NULL, 4u));
+    CHECK(ErrorInvalidParameter == LPUART_LinkSend(pstcLink, m_au8Frame[0], 0u));
+    CHECK(0u == LPUART_LinkPoll(pstcLink));
+
+    LPUART_LinkDeInit(pstcLink);
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_RC | LPUART_INT_TXE));
+}
+
+/**
+ * @brief  不应答模式双向同时发送：数据含帧结束符及转义字节，逐帧交出，缓冲按序释放，
+ *         线路字节数等于编码长度
+ * @retval None
+ */
+static void StreamCheck(void)
+{
+    uint32_t i;
+    uint32_t u32Wire = 1u; /* 第一帧前的帧结束符 */
+
+    UartConfig();
+    NodeInit(0u, 0u, RX_SIZE);
+    NodeInit(1u, 0u, RX_SIZE);
+
+    for (i = 0u; i < 4u; i++)
+    {
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[i], m_au16FrameLen[i]));
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[1].stcLink, m_au8Frame[7u - i], m_au16FrameLen[7u - i]));
+        u32Wire += EncLen(LPUART_LINK_TYPE_DATA, (uint8_t)i, m_au8Frame[i], m_au16FrameLen[i]);
+    }
+    CHECK(4u == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+    CHECK(TRUE == Run(1000000u, 4u, 4u));
+
+    for (i = 0u; i < 4u; i++)
+    {
+        CHECK(i == m_astcNode[1].au8RxId[i]);
+        CHECK((7u - i) == m_astcNode[0].au8RxId[i]);
+        CHECK(m_au8Frame[i] == m_astcNode[0].apu8Done[i]);
+        CHECK(m_au8Frame[7u - i] == m_astcNode[1].apu8Done[i]);
+    }
+    CHECK(0u == m_astcNode[0].u32RxBad);
+    CHECK(0u == m_astcNode[1].u32RxBad);
+    CHECK(4u == m_astcNode[0].stcLink.u32TxFrames);
+    CHECK(0u == m_astcNode[1].stcLink.u32RxCrcErr);
+    CHECK(0u == m_astcNode[1].stcLink.u32RxLost);
+    CHECK(u32Wire == m_astcNode[0].u32WireCnt);
+    CHECK(u32Wire == m_astcNode[0].stcLink.u32TxBytes);
+
+    /* 空闲后再次发送：先发帧结束符 */
+    m_astcNode[0].u32WireCnt = 0u;
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[4], m_au16FrameLen[4]));
+    CHECK(TRUE == Run(1000000u, 4u, 5u));
+    CHECK(4u == m_astcNode[1].au8RxId[4]);
+    CHECK((1u + EncLen(LPUART_LINK_TYPE_DATA, 4u, m_au8Frame[4], m_au16FrameLen[4])) == m_astcNode[0].u32WireCnt);
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  不应答模式线路干扰：CRC错误的帧丢弃，接收方由序号统计丢失，其余帧正常交出
+ * @retval None
+ */
+static void LossCheck(void)
+{
+    uint32_t i;
+
+    UartConfig();
+    NodeInit(0u, 0u, RX_SIZE);
+    NodeInit(1u, 0u, RX_SIZE);
+
+    m_astcFault[0].u8Type = LPUART_LINK_TYPE_DATA;
+    m_astcFault[0].u8Seq  = 1u;
+    m_astcFault[0].u32Cnt = 1u;
+    for (i = 0u; i < 3u; i++)
+    {
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[i], m_au16FrameLen[i]));
+    }
+    CHECK(FALSE == Run(200000u, 0u, 3u));
+    CHECK(0u == m_astcFault[0].u32Cnt);
+    CHECK(2u == m_astcNode[1].u32RxCnt);
+    CHECK(0u == m_astcNode[1].au8RxId[0]);
+    CHECK(2u == m_astcNode[1].au8RxId[1]);
+    CHECK(1u == m_astcNode[1].stcLink.u32RxCrcErr);
+    CHECK(1u == m_astcNode[1].stcLink.u32RxLost);
+    /* 不应答的帧发出即释放 */
+    CHECK(3u == m_astcNode[0].u32DoneCnt);
+    CHECK(0u == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  超出接收帧缓冲的帧丢弃，下一帧正常交出
+ * @retval None
+ */
+static void OverflowCheck(void)
+{
+    UartConfig();
+    NodeInit(0u, 0u, RX_SIZE);
+    NodeInit(1u, 0u, LPUART_LINK_OVERHEAD + 4u);
+
+    CHECK(m_au16FrameLen[2] > 4u);
+    CHECK(m_au16FrameLen[0] <= 4u);
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[2], m_au16FrameLen[2]));
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[0], m_au16FrameLen[0]));
+    CHECK(FALSE == Run(200000u, 0u, 2u));
+    CHECK(1u == m_astcNode[1].u32RxCnt);
+    CHECK(0u == m_astcNode[1].au8RxId[0]);
+    CHECK(1u == m_astcNode[1].stcLink.u32RxOverflow);
+    CHECK(0u == m_astcNode[1].stcLink.u32RxCrcErr);
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  发送队列满返回ErrorBufferFull，发出后可再次加入
+ * @retval None
+ */
+static void QueueCheck(void)
+{
+    uint32_t i;
+
+    UartConfig();
+    NodeInit(0u, 0u, RX_SIZE);
+    NodeInit(1u, 0u, RX_SIZE);
+
+    for (i = 0u; i < LPUART_LINK_TXQ_SIZE; i++)
+    {
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[i], m_au16FrameLen[i]));
+    }
+    CHECK(ErrorBufferFull == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[0], m_au16FrameLen[0]));
+    CHECK(LPUART_LINK_TXQ_SIZE == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+    CHECK(TRUE == Run(1000000u, 0u, LPUART_LINK_TXQ_SIZE));
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[0], m_au16FrameLen[0]));
+    CHECK(TRUE == Run(1000000u, 0u, LPUART_LINK_TXQ_SIZE + 1u));
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  可靠模式（窗口4）：一个数据帧受干扰后超时回退重发，接收方按序只交出一次，
+ *         收到应答后才释放缓冲，未应答的帧不超过窗口
+ * @retval None
+ */
+static void ReliableCheck(void)
+{
+    uint32_t i;
+    uint8_t  u8Flight;
+    uint8_t  u8MaxFlight = 0u;
+    uint64_t u64End;
+
+    UartConfig();
+    NodeInit(0u, 4u, RX_SIZE);
+    NodeInit(1u, 4u, RX_SIZE);
+
+    m_astcFault[0].u8Type = LPUART_LINK_TYPE_DATA_ACK;
+    m_astcFault[0].u8Seq  = 2u;
+    m_astcFault[0].u32Cnt = 1u;
+    for (i = 0u; i < FRAME_NUM; i++)
+    {
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[i], m_au16FrameLen[i]));
+    }
+
+    u64End = HOST_CycleGet() + 2000000u;
+    while ((0u != LPUART_LinkPoll(&m_astcNode[0].stcLink)) && (HOST_CycleGet() < u64End))
+    {
+        HOST_CycleAdvance(STEP);
+        HOST_IrqDispatch();
+        (void)LPUART_LinkPoll(&m_astcNode[1].stcLink);
+        u8Flight    = (uint8_t)(m_astcNode[0].stcLink.u8TxNext - m_astcNode[0].stcLink.u8TxBase);
+        u8MaxFlight = (u8Flight > u8MaxFlight) ? u8Flight : u8MaxFlight;
+        /* 释放前对方已收到 */
+        CHECK(m_astcNode[0].u32DoneCnt <= m_astcNode[1].u32RxCnt);
+    }
+
+    CHECK(0u == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+    CHECK(0u == m_astcFault[0].u32Cnt);
+    CHECK(4u == u8MaxFlight);
+    CHECK(FRAME_NUM == m_astcNode[1].u32RxCnt);
+    CHECK(FRAME_NUM == m_astcNode[0].u32DoneCnt);
+    for (i = 0u; i < FRAME_NUM; i++)
+    {
+        CHECK(i == m_astcNode[1].au8RxId[i]);
+        CHECK(m_au8Frame[i] == m_astcNode[0].apu8Done[i]);
+    }
+    CHECK(0u == m_astcNode[1].u32RxBad);
+    CHECK(1u == m_astcNode[0].stcLink.u32Retx);
+    CHECK(1u == m_astcNode[1].stcLink.u32RxCrcErr);
+    /* 序号3~5在序号2之前到达，乱序丢弃 */
+    CHECK(3u == m_astcNode[1].stcLink.u32RxLost);
+    printf("reliable: %u frames, tx %u frames / %u bytes, retx %u, rx lost %u dup %u\n", (unsigned)FRAME_NUM,
+           (unsigned)m_astcNode[0].stcLink.u32TxFrames, (unsigned)m_astcNode[0].stcLink.u32TxBytes,
+           (unsigned)m_astcNode[0].stcLink.u32Retx, (unsigned)m_astcNode[1].stcLink.u32RxLost,
+           (unsigned)m_astcNode[1].stcLink.u32RxDup);
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  可靠模式应答丢失：发送方超时重发，接收方按重复帧丢弃并再次应答，不重复交出
+ * @retval None
+ */
+static void LostAckCheck(void)
+{
+    UartConfig();
+    NodeInit(0u, 2u, RX_SIZE);
+    NodeInit(1u, 2u, RX_SIZE);
+
+    m_astcFault[1].u8Type = LPUART_LINK_TYPE_ACK;
+    m_astcFault[1].u8Seq  = 1u;
+    m_astcFault[1].u32Cnt = 1u;
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[0], m_au16FrameLen[0]));
+    /* 数据帧及应答帧均已发出，未到重发超时 */
+    Step(DDL_UsToTick(RETX_US) / 2u);
+    CHECK(0u == m_astcFault[1].u32Cnt);
+    CHECK(1u == m_astcNode[1].u32RxCnt);
+    CHECK(1u == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+    CHECK(0u == m_astcNode[0].u32DoneCnt);
+
+    CHECK(TRUE == Run(DDL_UsToTick(RETX_US) * 2u, 0u, 1u));
+    CHECK(1u == m_astcNode[0].u32DoneCnt);
+    CHECK(1u == m_astcNode[1].u32RxCnt);
+    CHECK(1u == m_astcNode[0].stcLink.u32Retx);
+    CHECK(1u == m_astcNode[1].stcLink.u32RxDup);
+    CHECK(1u == m_astcNode[0].stcLink.u32RxCrcErr);
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  可靠模式停止：已发出未应答及未发出的帧按序报告中止，待发送的应答帧丢弃，
+ *         重新初始化后正常收发
+ * @retval None
+ */
+static void AbortCheck(void)
+{
+    uint32_t i;
+
+    UartConfig();
+    NodeInit(0u, 2u, RX_SIZE);
+    NodeInit(1u, 2u, RX_SIZE);
+
+    /* 对方不应答：窗口内2帧发出后停止发送 */
+    m_astcFault[1].u8Type = LPUART_LINK_TYPE_ACK;
+    m_astcFault[1].u8Seq  = ANY_SEQ;
+    m_astcFault[1].u32Cnt = 0xFFFFFFFFu;
+    for (i = 0u; i < 5u; i++)
+    {
+        CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[i], m_au16FrameLen[i]));
+    }
+    Step(DDL_UsToTick(RETX_US) / 2u);
+    CHECK(2u == m_astcNode[1].u32RxCnt);
+    CHECK(2u == (uint8_t)(m_astcNode[0].stcLink.u8TxNext - m_astcNode[0].stcLink.u8TxBase));
+    CHECK(0u == m_astcNode[0].u32DoneCnt);
+
+    m_astcNode[0].stcLink.u8AckPend = 1u;
+    LPUART_LinkDeInit(&m_astcNode[0].stcLink);
+    CHECK(5u == m_astcNode[0].u32DoneCnt);
+    CHECK(5u == m_astcNode[0].u32AbortCnt);
+    for (i = 0u; i < 5u; i++)
+    {
+        CHECK(m_au8Frame[i] == m_astcNode[0].apu8Done[i]);
+    }
+    CHECK(0u == m_astcNode[0].stcLink.u8AckPend);
+    CHECK(0u == LPUART_LinkPoll(&m_astcNode[0].stcLink));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_RC | LPUART_INT_TXE));
+    /* 再次停止不重复报告 */
+    NodeDeInit();
+    CHECK(5u == m_astcNode[0].u32DoneCnt);
+
+    UartConfig();
+    NodeInit(0u, 2u, RX_SIZE);
+    NodeInit(1u, 2u, RX_SIZE);
+    CHECK(Ok == LPUART_LinkSend(&m_astcNode[0].stcLink, m_au8Frame[0], m_au16FrameLen[0]));
+    CHECK(TRUE == Run(1000000u, 0u, 1u));
+    CHECK(1u == m_astcNode[0].u32DoneCnt);
+    CHECK(0u == m_astcNode[0].u32AbortCnt);
+
+    NodeDeInit();
+}
+
+/**
+ * @brief  LPUART0及LPUART1 8位无校验，收发
+ * @retval None
+ */
+static void UartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32FrameLength      = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BAUD;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART0);
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+/**
+ * @brief  初始化链路端点并清除记录及线路干扰
+ * @param  [in] u8Unit 0: LPUART0，1: LPUART1
+ * @param  [in] u8Window 窗口
+ * @param  [in] u16RxSize 接收帧缓冲长度
+ * @retval None
+ */
+static void NodeInit(uint8_t u8Unit, uint8_t u8Window, uint16_t u16RxSize)
+{
+    stc_node_t            *pstcNode = &m_astcNode[u8Unit];
+    stc_lpuart_link_init_t stcInit;
+
+    memset(pstcNode, 0, sizeof(stc_node_t));
+    memset(&m_astcFault[u8Unit], 0, sizeof(stc_wire_fault_t));
+
+    LPUART_LinkStcInit(&stcInit);
+    stcInit.pu8RxBuf  = pstcNode->au8RxBuf;
+    stcInit.u16RxSize = u16RxSize;
+    stcInit.u8Window  = u8Window;
+    stcInit.u32RetxUs = RETX_US;
+    stcInit.pfnRx     = OnRx;
+    stcInit.pfnTxDone = OnTxDone;
+    stcInit.pvArg     = pstcNode;
+    CHECK(Ok == LPUART_LinkInit((0u == u8Unit) ? LPUART0 : LPUART1, &pstcNode->stcLink, &stcInit, IrqPriorityLevel2));
+}
+
+/**
+ * @brief  停止两个链路端点
+ * @retval None
+ */
+static void NodeDeInit(void)
+{
+    LPUART_LinkDeInit(&m_astcNode[0].stcLink);
+    LPUART_LinkDeInit(&m_astcNode[1].stcLink);
+}
+
+/**
+ * @brief  生成测试帧：帧i长度为3+i，第一个字节为i，其余取自0xC0、0xDB、0xDC、0xDD、0x55
+ * @retval None
+ */
+static void FrameFill(void)
+{
+    const uint8_t au8Pat[] = {0xC0u, 0xDBu, 0xDCu, 0xDDu, 0x55u};
+    uint32_t      i;
+    uint32_t      j;
+
+    for (i = 0u; i < FRAME_NUM; i++)
+    {
+        m_au16FrameLen[i] = (uint16_t)(3u + i);
+        m_au8Frame[i][0]  = (uint8_t)i;
+        for (j = 1u; j < m_au16FrameLen[i]; j++)
+        {
+            m_au8Frame[i][j] = au8Pat[(i + j) % sizeof(au8Pat)];
+        }
+    }
+}
+
+/**
+ * @brief  一帧的线路字节数：类型、序号、数据及CRC转义后的长度加帧结束符
+ * @param  [in] u8Type 帧类型
+ * @param  [in] u8Seq 序号
+ * @param  [in] pu8Data 数据
+ * @param  [in] u16Len 数据长度
+ * @retval uint32_t 线路字节数
+ */
+static uint32_t  EncLen(uint8_t u8Type, uint8_t u8Seq, const uint8_t *pu8Data, uint16_t u16Len)
+{
+    uint8_t  au8Raw[2u + sizeof(m_au8Frame[0]) + 2u];
+    uint16_t u16Crc;
+    uint32_t u32Len = 1u;
+    uint32_t i;
+
+    au8Raw[0] = u8Type;
+    au8Raw[1] = u8Seq;
+    memcpy(&au8Raw[2], pu8Data, u16Len);
+    u16Crc              = LPUART_LinkCrc16(0xFFFFu, au8Raw, 2u + u16Len);
+    au8Raw[2u + u16Len] = (uint8_t)(u16Crc >> 8);
+    au8Raw[3u + u16Len] = (uint8_t)u16Crc;
+    for (i = 0u; i < (4u + u16Len); i++)
+    {
+        u32Len += ((0xC0u == au8Raw[i]) || (0xDBu == au8Raw[i])) ? 2u : 1u;
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  推进模拟时间并执行重发检查，直到两端收到的帧数达到期望值
+ * @param  [in] u64MaxCycles 最长等待周期
+ * @param  [in] u32RxA LPUART0期望收到的帧数
+ * @param  [in] u32RxB LPUART1期望收到的帧数
+ * @retval boolean_t TRUE: 达到期望且发送队列为空；FALSE: 超时
+ */
+static boolean_t Run(uint64_t u64MaxCycles, uint32_t u32RxA, uint32_t u32RxB)
+{
+    uint64_t u64End = HOST_CycleGet() + u64MaxCycles;
+
+    while (HOST_CycleGet() < u64End)
+    {
+        HOST_CycleAdvance(STEP);
+        HOST_IrqDispatch();
+        if ((0u == LPUART_LinkPoll(&m_astcNode[0].stcLink)) && (0u == LPUART_LinkPoll(&m_astcNode[1].stcLink))
+            && (m_astcNode[0].u32RxCnt >= u32RxA) && (m_astcNode[1].u32RxCnt >= u32RxB))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief  推进模拟时间并执行重发检查
+ * @param  [in] u64Cycles 推进的周期数
+ * @retval None
+ */
+static void Step(uint64_t u64Cycles)
+{
+    uint64_t u64End = HOST_CycleGet() + u64Cycles;
+
+    while (HOST_CycleGet() < u64End)
+    {
+        HOST_CycleAdvance(STEP);
+        HOST_IrqDispatch();
+        (void)LPUART_LinkPoll(&m_astcNode[0].stcLink);
+        (void)LPUART_LinkPoll(&m_astcNode[1].stcLink);
+    }
+}
+
+/**
+ * @brief  发送帧回调（停止位结束时）：LPUART0与LPUART1交叉连接，按干扰设置修改序号字节
+ * @param  [in] u8Unit 发送的LPUART单元
+ * @param  [in] u16Data 发送的帧
+ * @retval None
+ */
+static void Wire(uint8_t u8Unit, uint16_t u16Data)
+{
+    stc_node_t       *pstcNode  = &m_astcNode[u8Unit];
+    stc_wire_fault_t *pstcFault = &m_astcFault[u8Unit];
+    uint8_t           u8Byte    = (uint8_t)u16Data;
+
+    pstcNode->u32WireCnt++;
+    if (0xC0u == u8Byte)
+    {
+        pstcNode->u8WirePos = 0u;
+    }
+    else
+    {
+        if (0u == pstcNode->u8WirePos)
+        {
+            pstcNode->u8WireType = u8Byte;
+        }
+        else if ((1u == pstcNode->u8WirePos) && (0u != pstcFault->u32Cnt) && (pstcFault->u8Type == pstcNode->u8WireType)
+                 && ((ANY_SEQ == pstcFault->u8Seq) || (pstcFault->u8Seq == u8Byte)))
+        {
+            pstcFault->u32Cnt--;
+            u8Byte ^= 0x20u;
+        }
+        pstcNode->u8WirePos++;
+    }
+
+    (void)HOST_LpuartRxPush((0u == u8Unit) ? 1u : 0u, u8Byte);
+}
+
+/**
+ * @brief  收到数据帧：记录帧编号，核对数据
+ * @param  [in] pu8Data 数据
+ * @param  [in] u16Len 数据长度
+ * @param  [in] pvArg 链路端点
+ * @retval None
+ */
+static void OnRx(const uint8_t *pu8Data, uint16_t u16Len, void *pvArg)
+{
+    stc_node_t *pstcNode = (stc_node_t *)pvArg;
+    uint8_t     u8Id     = pu8Data[0];
+
+    if ((u8Id >= FRAME_NUM) || (u16Len != m_au16FrameLen[u8Id]) || (0 != memcmp(pu8Data, m_au8Frame[u8Id], u16Len)))
+    {
+        pstcNode->u32RxBad++;
+    }
+    if (pstcNode->u32RxCnt < LOG_MAX)
+    {
+        pstcNode->au8RxId[pstcNode->u32RxCnt] = u8Id;
+    }
+    pstcNode->u32RxCnt++;
+}
+
+/**
+ * @brief  发送缓冲释放：记录释放顺序及中止次数
+ * @param  [in] pu8Data 释放的缓冲
+ * @param  [in] u32Status 释放状态
+ * @param  [in] pvArg 链路端点
+ * @retval None
+ */
+static void OnTxDone(const uint8_t *pu8Data, uint32_t u32Status, void *pvArg)
+{
+    stc_node_t *pstcNode = (stc_node_t *)pvArg;
+
+    if (pstcNode->u32DoneCnt < LOG_MAX)
+    {
+        pstcNode->apu8Done[pstcNode->u32DoneCnt] = pu8Data;
+    }
+    pstcNode->u32DoneCnt++;
+    if (LPUART_LINK_TX_STS_ABORT == u32Status)
+    {
+        pstcNode->u32AbortCnt++;
+    }
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,506 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART deep sleep batched receive
+ *        (LPUART_LpRxInit/LPUART_LpRxSleep) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  线路上的一个字节
+ */
+typedef struct
+{
+    uint8_t u8Data; /*!< 数据 */
+    uint8_t u8Fe;   /*!< 以帧错误接收 */
+} stc_line_byte_t;
+
+/**
+ * @brief  一次运行的统计
+ */
+typedef struct
+{
+    uint32_t u32Wakeup;     /*!< 主循环唤醒次数 */
+    uint64_t u64Irq;        /*!< 中断次数 */
+    uint64_t u64Cycles;     /*!< 总周期数 */
+    uint64_t u64SleepCycle; /*!< 休眠周期数 */
+} stc_run_stat_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BUF_SIZE  (64u)
+#define LINE_MAX  (64u)
+#define WAKE_MAX  (32u)
+#define LINE_CNT  (4u) /* 文本行数 */
+
+#define REG_ADDR(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg))
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void ParamCheck(void);
+static void DelimCheck(void);
+static void WatermarkCheck(void);
+static void FrameCheck(void);
+static void FullCheck(void);
+static void PendingCheck(void);
+static void DeInitCheck(void);
+static void HwConfig(void);
+static void LpRxInitDefault(stc_lpuart_lprx_init_t *pstcInit);
+static void LineAdd(const uint8_t *pu8Data, uint32_t u32Len);
+static void LineByteEvent(void *pvArg);
+static void LineRun(uint32_t u32SkipRead, stc_run_stat_t *pstcStat);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32ErrCnt = 0u;
+static stc_lpuart_lprx_t m_stcLpRx;
+static uint8_t           m_au8Buf[BUF_SIZE];
+
+static stc_line_byte_t m_astcLine[LINE_MAX];
+static uint32_t        m_u32LineLen = 0u;
+static uint32_t        m_u32LinePos = 0u;
+
+static uint8_t  m_au8Out[LINE_MAX]; /* 主循环读出的数据 */
+static uint32_t m_u32OutLen = 0u;
+static uint32_t m_au32Event[WAKE_MAX]; /* 每次唤醒的事件 */
+static uint32_t m_au32Read[WAKE_MAX];  /* 每次唤醒读出的字节数 */
+
+static const char m_acText[] = "T=21.5\nT=21.6\nT=21.4\nT=21.7\n"; /* 每行7字节 */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    HwConfig();
+
+    ParamCheck();
+    DelimCheck();
+    WatermarkCheck();
+    FrameCheck();
+    FullCheck();
+    PendingCheck();
+    DeInitCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查，初始化后接收中断使能，重复初始化
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+
+    LPUART_LpRxStcInit(&stcInit);
+    CHECK(((uint16_t)'\n' == stcInit.u16Delim) && (LPUART_LPRX_FRAME_NONE == stcInit.u8LenPos));
+    CHECK((LPUART_LPRX_EVT_DELIM | LPUART_LPRX_EVT_FULL) == stcInit.u32WakeMask);
+
+    LpRxInitDefault(&stcInit);
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, NULL, &stcInit, IrqPriorityLevel2));
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, NULL, IrqPriorityLevel2));
+    stcInit.pu8Buf = NULL;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Size = 0u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    stcInit.u16Size = 48u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Watermark = BUF_SIZE + 1u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Delim = 0x100u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    /* 帧长须包含长度字节 */
+    LpRxInitDefault(&stcInit);
+    stcInit.u8LenPos = 1u;
+    stcInit.u8LenAdd = 1u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LpRxInitDefault(&stcInit);
+    stcInit.u32WakeMask = 0u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    stcInit.u32WakeMask = LPUART_LPRX_EVT_DELIM | 0x20u;
+    CHECK(ErrorInvalidParameter == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    CHECK(0u == NVIC->ISER[0]);
+
+    LpRxInitDefault(&stcInit);
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    CHECK(0u != READ_REG32_BIT(LPUART1->SCON, LPUART_INT_RC));
+    CHECK(0u != (NVIC->ISER[0] & (1uL << (uint32_t)LPUART1_IRQn)));
+    CHECK((BUF_SIZE - 1u) == m_stcLpRx.u16Mask);
+
+    /* 重复初始化不影响已运行的实例 */
+    CHECK(ErrorInvalidMode == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    CHECK(0u != READ_REG32_BIT(LPUART1->SCON, LPUART_INT_RC));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  每字节唤醒主循环（水位1）与按分隔字节批量唤醒对比：中断次数相同，主循环唤醒次数为行数
+ * @retval None
+ */
+static void DelimCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+    stc_run_stat_t         stcByte;
+    stc_run_stat_t         stcLine;
+    uint32_t               u32Bytes = sizeof(m_acText) - 1u;
+    uint32_t               i;
+
+    /* 每字节唤醒：相当于接收中断返回线程处理 */
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Watermark = 1u;
+    stcInit.u16Delim     = LPUART_LPRX_DELIM_NONE;
+    stcInit.u32WakeMask  = LPUART_LPRX_EVT_WATERMARK;
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LineAdd((const uint8_t *)m_acText, u32Bytes);
+    LineRun(0u, &stcByte);
+    CHECK(u32Bytes == stcByte.u32Wakeup);
+    CHECK(u32Bytes == m_stcLpRx.u32WakeCnt);
+    CHECK(u32Bytes == m_stcLpRx.u32SleepCnt);
+    CHECK(u32Bytes == m_stcLpRx.u32IrqCnt);
+    CHECK((u32Bytes == m_u32OutLen) && (0 == memcmp(m_au8Out, m_acText, u32Bytes)));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+
+    /* 按'\n'唤醒：其余字节中断返回后直接继续休眠 */
+    LpRxInitDefault(&stcInit);
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LineAdd((const uint8_t *)m_acText, u32Bytes);
+    LineRun(0u, &stcLine);
+    CHECK(LINE_CNT == stcLine.u32Wakeup);
+    CHECK(LINE_CNT == m_stcLpRx.u32WakeCnt);
+    CHECK(LINE_CNT == m_stcLpRx.u32SleepCnt);
+    CHECK(u32Bytes == m_stcLpRx.u32IrqCnt);
+    CHECK(stcLine.u64Irq == stcByte.u64Irq);
+    for (i = 0u; i < LINE_CNT; i++)
+    {
+        CHECK((LPUART_LPRX_EVT_DELIM == m_au32Event[i]) && (7u == m_au32Read[i]));
+    }
+    CHECK((u32Bytes == m_u32OutLen) && (0 == memcmp(m_au8Out, m_acText, u32Bytes)));
+    CHECK((0u == m_stcLpRx.u32Overflow) && (0u == m_stcLpRx.u32Error));
+
+    /* 唤醒时间不计休眠：主循环处理期间的周期减少 */
+    printf("per byte: %u bytes, irqs %llu, main loop wakeups %u, awake %llu of %llu cycles\n", (unsigned)u32Bytes,
+           (unsigned long long)stcByte.u64Irq, (unsigned)stcByte.u32Wakeup,
+           (unsigned long long)(stcByte.u64Cycles - stcByte.u64SleepCycle), (unsigned long long)stcByte.u64Cycles);
+    printf("per line: %u bytes, irqs %llu, main loop wakeups %u, awake %llu of %llu cycles\n", (unsigned)u32Bytes,
+           (unsigned long long)stcLine.u64Irq, (unsigned)stcLine.u32Wakeup,
+           (unsigned long long)(stcLine.u64Cycles - stcLine.u64SleepCycle), (unsigned long long)stcLine.u64Cycles);
+    CHECK((stcLine.u64Cycles - stcLine.u64SleepCycle) < (stcByte.u64Cycles - stcByte.u64SleepCycle));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  水位唤醒：每8字节唤醒一次
+ * @retval None
+ */
+static void WatermarkCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+    stc_run_stat_t         stcStat;
+    uint8_t                au8Data[24];
+    uint32_t               i;
+
+    for (i = 0u; i < sizeof(au8Data); i++)
+    {
+        au8Data[i] = (uint8_t)(0x80u + i);
+    }
+
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Watermark = 8u;
+    stcInit.u16Delim     = LPUART_LPRX_DELIM_NONE;
+    stcInit.u32WakeMask  = LPUART_LPRX_EVT_WATERMARK;
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LineAdd(au8Data, sizeof(au8Data));
+    LineRun(0u, &stcStat);
+
+    CHECK(3u == stcStat.u32Wakeup);
+    CHECK(sizeof(au8Data) == m_stcLpRx.u32IrqCnt);
+    for (i = 0u; i < 3u; i++)
+    {
+        CHECK((LPUART_LPRX_EVT_WATERMARK == m_au32Event[i]) && (8u == m_au32Read[i]));
+    }
+    CHECK((sizeof(au8Data) == m_u32OutLen) && (0 == memcmp(m_au8Out, au8Data, sizeof(au8Data))));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  长度前缀帧：地址(1) + 长度(1) + 数据 + 校验(2)，每帧唤醒一次；帧错误唤醒并重新同步
+ * @retval None
+ */
+static void FrameCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+    stc_run_stat_t         stcStat;
+    static const uint8_t   au8F0[] = {0x01u, 0x00u, 0x5Au, 0xA5u};
+    static const uint8_t   au8F1[] = {0x01u, 0x03u, 0x0Au, 0x0Du, 0x0Au, 0x12u, 0x34u}; /* 数据含'\n'不影响 */
+    static const uint8_t   au8F2[] = {0x02u, 0x0Au, 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 0x56u, 0x78u};
+
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Delim    = LPUART_LPRX_DELIM_NONE;
+    stcInit.u8LenPos    = 1u;
+    stcInit.u8LenAdd    = 4u;
+    stcInit.u32WakeMask = LPUART_LPRX_EVT_FRAME | LPUART_LPRX_EVT_ERR;
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LineAdd(au8F0, sizeof(au8F0));
+    LineAdd(au8F1, sizeof(au8F1));
+    LineAdd(au8F2, sizeof(au8F2));
+    LineAdd(au8F1, sizeof(au8F1)); /* 最后一字节帧错误 */
+    m_astcLine[m_u32LineLen - 1u].u8Fe = 1u;
+    LineAdd(au8F0, sizeof(au8F0));
+    LineRun(0u, &stcStat);
+
+    CHECK(5u == stcStat.u32Wakeup);
+    CHECK((LPUART_LPRX_EVT_FRAME == m_au32Event[0]) && (sizeof(au8F0) == m_au32Read[0]));
+    CHECK((LPUART_LPRX_EVT_FRAME == m_au32Event[1]) && (sizeof(au8F1) == m_au32Read[1]));
+    CHECK((LPUART_LPRX_EVT_FRAME == m_au32Event[2]) && (sizeof(au8F2) == m_au32Read[2]));
+    CHECK((LPUART_LPRX_EVT_ERR == m_au32Event[3]) && (sizeof(au8F1) == m_au32Read[3]));
+    CHECK((LPUART_LPRX_EVT_FRAME == m_au32Event[4]) && (sizeof(au8F0) == m_au32Read[4]));
+    CHECK(1u == m_stcLpRx.u32Error);
+    CHECK(0 == memcmp(&m_au8Out[sizeof(au8F0) + sizeof(au8F1)], au8F2, sizeof(au8F2)));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  接收缓冲满：满时唤醒，不读出时之后的字节丢弃并再次唤醒
+ * @retval None
+ */
+static void FullCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+    stc_run_stat_t         stcStat;
+    uint8_t                au8Data[20];
+    uint32_t               i;
+
+    for (i = 0u; i < sizeof(au8Data); i++)
+    {
+        au8Data[i] = (uint8_t)('a' + i);
+    }
+    au8Data[sizeof(au8Data) - 1u] = (uint8_t)'\n';
+
+    LpRxInitDefault(&stcInit);
+    stcInit.u16Size = 16u;
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+    LineAdd(au8Data, sizeof(au8Data));
+    LineRun(1u, &stcStat); /* 第一次唤醒不读出 */
+
+    CHECK(3u == stcStat.u32Wakeup);
+    CHECK((LPUART_LPRX_EVT_FULL == m_au32Event[0]) && (0u == m_au32Read[0]));
+    CHECK((LPUART_LPRX_EVT_FULL == m_au32Event[1]) && (16u == m_au32Read[1]));
+    CHECK((LPUART_LPRX_EVT_DELIM == m_au32Event[2]) && (3u == m_au32Read[2]));
+    CHECK(1u == m_stcLpRx.u32Overflow);
+    CHECK(0 == memcmp(m_au8Out, au8Data, 16u));
+    CHECK(0 == memcmp(&m_au8Out[16], &au8Data[17], 3u));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  主循环未休眠时发生的事件：中断不计唤醒，LPUART_LpRxSleep()不休眠直接返回
+ * @retval None
+ */
+static void PendingCheck(void)
+{
+    stc_lpuart_lprx_init_t stcInit;
+    uint8_t                u8Data = 0u;
+
+    LpRxInitDefault(&stcInit);
+    stcInit.u32WakeMask = LPUART_LPRX_EVT_DELIM;
+    CHECK(Ok == LPUART_LpRxInit(LPUART1, &m_stcLpRx, &stcInit, IrqPriorityLevel2));
+
+    /* 帧错误：不在唤醒事件中，留待下次返回 */
+    HOST_RegWrite(REG_ADDR(LPUART1_BASE, LPUART_TypeDef, ISR), HOST_RegRead(REG_ADDR(LPUART1_BASE, LPUART_TypeDef, ISR)) | LPUART_ISR_FE_Msk);
+    CHECK(Ok == HOST_LpuartRxPush(1u, 'x'));
+    HOST_IrqDispatch();
+    CHECK(Ok == HOST_LpuartRxPush(1u, '\n'));
+    HOST_IrqDispatch();
+    CHECK((2u == m_stcLpRx.u32IrqCnt) && (0u == m_stcLpRx.u32WakeCnt));
+
+    CHECK((LPUART_LPRX_EVT_DELIM | LPUART_LPRX_EVT_ERR) == LPUART_LpRxSleep(&m_stcLpRx));
+    CHECK(0u == m_stcLpRx.u32SleepCnt);
+    CHECK(0u == m_stcLpRx.u32Event);
+    CHECK(0u == (SCB->SCR & SCB_SCR_SLEEPONEXIT_Msk));
+    CHECK(2u == LPUART_LpRxCountGet(&m_stcLpRx));
+    CHECK((1u == LPUART_LpRxRead(&m_stcLpRx, &u8Data, 1u)) && ('x' == u8Data));
+    CHECK(1u == LPUART_LpRxCountGet(&m_stcLpRx));
+    LPUART_LpRxDeInit(&m_stcLpRx);
+}
+
+/**
+ * @brief  停止后接收中断禁止，不再写入接收缓冲
+ * @retval None
+ */
+static void DeInitCheck(void)
+{
+    uint32_t u32Count = LPUART_LpRxCountGet(&m_stcLpRx);
+
+    CHECK(0u == READ_REG32_BIT(LPUART1->SCON, LPUART_INT_RC));
+    CHECK(0u == (NVIC->ISER[0] & (1uL << (uint32_t)LPUART1_IRQn)));
+    (void)HOST_LpuartRxPush(1u, '\n');
+    HOST_IrqDispatch();
+    CHECK(u32Count == LPUART_LpRxCountGet(&m_stcLpRx));
+    CHECK(2u == m_stcLpRx.u32IrqCnt);
+}
+
+/**
+ * @brief  时钟及LPUART配置：传输时钟XTL，9600
+ * @retval None
+ */
+static void HwConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+    SYSCTRL_ClockSrcEnable(SYSCTRL_CLK_SRC_XTL);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_XTL;
+    stcLpuartInit.stcBaudRate.u32Sclk       = LPUART_XTL_FREQ;
+    stcLpuartInit.stcBaudRate.u32Baud       = 9600u;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+    CHECK(Ok == LPUART_XtlBselSet(LPUART1, LPUART_XTL_BAUD_9600));
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+/**
+ * @brief  默认配置：64字节缓冲，按'\n'唤醒
+ * @param  [out] pstcInit 配置
+ * @retval None
+ */
+static void LpRxInitDefault(stc_lpuart_lprx_init_t *pstcInit)
+{
+    LPUART_LpRxStcInit(pstcInit);
+    pstcInit->pu8Buf  = m_au8Buf;
+    pstcInit->u16Size = sizeof(m_au8Buf);
+}
+
+/**
+ * @brief  登记线路数据（连续发送）
+ * @param  [in] pu8Data 数据
+ * @param  [in] u32Len 长度
+ * @retval None
+ */
+static void LineAdd(const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t i;
+
+    for (i = 0u; (i < u32Len) && (m_u32LineLen < LINE_MAX); i++)
+    {
+        m_astcLine[m_u32LineLen].u8Data = pu8Data[i];
+        m_astcLine[m_u32LineLen].u8Fe   = 0u;
+        m_u32LineLen++;
+    }
+}
+
+/**
+ * @brief  线路字节到达：写入接收并登记下一字节
+ * @param  [in] pvArg 未使用
+ * @retval None
+ */
+static void LineByteEvent(void *pvArg)
+{
+    stc_line_byte_t *pstc   = &m_astcLine[m_u32LinePos];
+    uint32_t         u32Isr = REG_ADDR(LPUART1_BASE, LPUART_TypeDef, ISR);
+
+    (void)pvArg;
+
+    if (0u != pstc->u8Fe)
+    {
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_FE_Msk);
+    }
+    (void)HOST_LpuartRxPush(1u, pstc->u8Data);
+
+    if (++m_u32LinePos < m_u32LineLen)
+    {
+        (void)HOST_EventSchedule(HOST_LpuartFrameCycles(1u), LineByteEvent, NULL);
+    }
+}
+
+/**
+ * @brief  主循环：LPUART_LpRxSleep()休眠直到唤醒事件，读出接收缓冲；线路数据发完后返回
+ * @note   线路数据的最后一字节须产生唤醒事件
+ * @param  [in] u32SkipRead 前若干次唤醒不读出
+ * @param  [out] pstcStat 统计
+ * @retval None
+ */
+static void LineRun(uint32_t u32SkipRead, stc_run_stat_t *pstcStat)
+{
+    stc_host_access_stat_t stcStat;
+    uint32_t               u32StCtrl = SysTick->CTRL;
+    uint64_t               u64Start;
+    uint32_t               u32Wakeup = 0u;
+
+    /* 停止SystemInit()启动的SysTick：只由线路数据唤醒 */
+    SysTick->CTRL = 0u;
+    m_u32LinePos  = 0u;
+    m_u32OutLen   = 0u;
+    HOST_AccessStatClear();
+    u64Start = HOST_CycleGet();
+    (void)HOST_EventSchedule(HOST_LpuartFrameCycles(1u), LineByteEvent, NULL);
+
+    while ((m_u32LinePos < m_u32LineLen) && (u32Wakeup < WAKE_MAX))
+    {
+        m_au32Event[u32Wakeup] = LPUART_LpRxSleep(&m_stcLpRx);
+        m_au32Read[u32Wakeup]  = 0u;
+        if (u32Wakeup >= u32SkipRead)
+        {
+            m_au32Read[u32Wakeup] = LPUART_LpRxRead(&m_stcLpRx, &m_au8Out[m_u32OutLen], sizeof(m_au8Out) - m_u32OutLen);
+            m_u32OutLen += m_au32Read[u32Wakeup];
+        }
+        u32Wakeup++;
+    }
+
+    HOST_AccessStatGet(&stcStat);
+    pstcStat->u32Wakeup     = u32Wakeup;
+    pstcStat->u64Irq        = stcStat.u64Irq;
+    pstcStat->u64Cycles     = HOST_CycleGet() - u64Start;
+    pstcStat->u64SleepCycle = stcStat.u64SleepCycles;
+
+    SysTick->CTRL = u32StCtrl;
+    m_u32LineLen  = 0u;
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
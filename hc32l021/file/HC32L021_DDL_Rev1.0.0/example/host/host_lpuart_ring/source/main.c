@@ -0,0 +1,276 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the interrupt driven ring buffer
+ *        transfer of the LPUART (LPUART_Ring*) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TX_SIZE   (64u)     /* 发送缓冲长度 */
+#define RX_SIZE   (32u)     /* 接收缓冲长度 */
+#define MSG_LEN   (100u)    /* 发送测试长度 */
+#define STRESS_LEN (2000u)  /* 分段写入测试长度 */
+#define BAUD      (115200u)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     SysClockConfig(uint32_t u32SysClockSrc);
+static void     LpuartConfig(void);
+static void     TxCapture(uint8_t u8Unit, uint16_t u16Data);
+static void     TxWaitIdle(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32ErrCnt = 0u;
+static stc_lpuart_ring_t m_stcRing;
+static uint8_t           m_au8TxBuf[TX_SIZE];
+static uint8_t           m_au8RxBuf[RX_SIZE];
+static uint8_t           m_au8Capture[STRESS_LEN];
+static uint32_t          m_u32CaptureCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_lpuart_ring_t stcIdle;
+    uint8_t           au8Msg[STRESS_LEN];
+    uint8_t           au8Rx[RX_SIZE * 2u];
+    uint32_t          u32Sent;
+    uint32_t          u32Cnt;
+    uint32_t          u32Chunk;
+    uint64_t          u64Cycle;
+    uint64_t          u64Poll;
+    uint32_t          i;
+
+    SysClockConfig(SYSCTRL_CLK_SRC_RC48M_48M);
+    LpuartConfig();
+    HOST_LpuartTxHookSet(TxCapture);
+    for (i = 0u; i < STRESS_LEN; i++)
+    {
+        au8Msg[i] = (uint8_t)(i * 7u + 3u);
+    }
+
+    /* 1. 参数检查：长度须为2的幂 */
+    CHECK(ErrorInvalidParameter == LPUART_RingInit(LPUART0, &m_stcRing, m_au8TxBuf, 48u, m_au8RxBuf, RX_SIZE, IrqPriorityLevel1));
+    CHECK(ErrorInvalidParameter == LPUART_RingInit(LPUART0, &m_stcRing, NULL, TX_SIZE, m_au8RxBuf, RX_SIZE, IrqPriorityLevel1));
+    CHECK(ErrorInvalidParameter == LPUART_RingInit(LPUART0, &m_stcRing, NULL, 0u, NULL, 0u, IrqPriorityLevel1));
+    CHECK(Ok == LPUART_RingInit(LPUART0, &m_stcRing, m_au8TxBuf, TX_SIZE, m_au8RxBuf, RX_SIZE, IrqPriorityLevel1));
+    CHECK(ErrorInvalidMode == LPUART_RingInit(LPUART0, &m_stcRing, m_au8TxBuf, TX_SIZE, m_au8RxBuf, RX_SIZE, IrqPriorityLevel1));
+    CHECK(0u != (NVIC->ISER[0] & (1uL << (uint32_t)LPUART0_IRQn)));
+    CHECK(0u != READ_REG32_BIT(LPUART0->SCON, LPUART_INT_RC)); /* 重复初始化不影响已运行的实例 */
+    CHECK(TRUE == LPUART_IntFlagGet(LPUART0, LPUART_FLAG_TXE));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_TXE)); /* 空闲时不使能TX空中断 */
+
+    /* 2. 发送：写入不等待，超出缓冲的部分不写入 */
+    u64Cycle = HOST_CycleGet();
+    u32Sent  = LPUART_RingWrite(&m_stcRing, au8Msg, MSG_LEN);
+    u64Cycle = HOST_CycleGet() - u64Cycle;
+    printf("ring write %u bytes: %llu cycles\n", (unsigned)u32Sent, (unsigned long long)u64Cycle);
+    CHECK(TX_SIZE == u32Sent);
+    CHECK(u64Cycle < 200u);
+    CHECK(0u != READ_REG32_BIT(LPUART0->SCON, LPUART_INT_TXE));
+    while (u32Sent < MSG_LEN)
+    {
+        u32Sent += LPUART_RingWrite(&m_stcRing, &au8Msg[u32Sent], MSG_LEN - u32Sent);
+        HOST_CycleAdvance(HOST_LpuartFrameCycles(0u) / 2u); /* 缓冲满时等待 */
+        HOST_IrqDispatch();
+    }
+    TxWaitIdle();
+    CHECK(MSG_LEN == m_u32CaptureCnt);
+    CHECK(0 == memcmp(m_au8Capture, au8Msg, MSG_LEN));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_TXE)); /* 发送完成后禁止TX空中断 */
+
+    /* 与查询发送比较：每字节占用CPU时间 */
+    m_u32CaptureCnt = 0u;
+    u64Poll         = HOST_CycleGet();
+    LPUART_TransmitPoll(LPUART0, au8Msg, 16u);
+    u64Poll = HOST_CycleGet() - u64Poll;
+    u64Cycle = HOST_CycleGet();
+    CHECK(16u == LPUART_RingWrite(&m_stcRing, au8Msg, 16u));
+    u64Cycle = HOST_CycleGet() - u64Cycle;
+    printf("cpu per byte @%u: poll %llu ns, ring %llu ns\n", (unsigned)BAUD,
+           (unsigned long long)(u64Poll * 1000u / 16u / (SystemCoreClock / 1000000u)),
+           (unsigned long long)(u64Cycle * 1000u / 16u / (SystemCoreClock / 1000000u)));
+    CHECK(u64Poll > (15u * HOST_LpuartFrameCycles(0u)));
+    CHECK((u64Cycle * 100u) < u64Poll);
+    TxWaitIdle();
+    CHECK(32u == m_u32CaptureCnt);
+
+    /* 3. 发送进行中以不同长度分段写入，顺序不变 */
+    m_u32CaptureCnt = 0u;
+    u32Sent         = 0u;
+    u32Chunk        = 1u;
+    while (u32Sent < STRESS_LEN)
+    {
+        u32Cnt = STRESS_LEN - u32Sent;
+        u32Cnt = (u32Cnt < u32Chunk) ? u32Cnt : u32Chunk;
+        u32Sent += LPUART_RingWrite(&m_stcRing, &au8Msg[u32Sent], u32Cnt);
+        u32Chunk = (u32Chunk % 37u) + 1u;
+        HOST_CycleAdvance(HOST_LpuartFrameCycles(0u) / 3u);
+        HOST_IrqDispatch();
+    }
+    TxWaitIdle();
+    CHECK(STRESS_LEN == m_u32CaptureCnt);
+    CHECK(0 == memcmp(m_au8Capture, au8Msg, STRESS_LEN));
+
+    /* 4. 接收：中断写入接收缓冲，读出返回实际字节数 */
+    CHECK(0u == LPUART_RingRead(&m_stcRing, au8Rx, sizeof(au8Rx)));
+    for (i = 0u; i < 10u; i++)
+    {
+        CHECK(Ok == HOST_LpuartRxPush(0u, (uint16_t)(0x30u + i)));
+        HOST_IrqDispatch();
+    }
+    CHECK(10u == LPUART_RingRxCountGet(&m_stcRing));
+    CHECK(4u == LPUART_RingRead(&m_stcRing, au8Rx, 4u));
+    CHECK((0x30u == au8Rx[0]) && (0x33u == au8Rx[3]));
+    CHECK(6u == LPUART_RingRead(&m_stcRing, au8Rx, sizeof(au8Rx)));
+    CHECK((0x34u == au8Rx[0]) && (0x39u == au8Rx[5]));
+
+    /* 接收缓冲满：丢弃并计数，已接收数据不被覆盖 */
+    for (i = 0u; i < (RX_SIZE + 5u); i++)
+    {
+        CHECK(Ok == HOST_LpuartRxPush(0u, (uint16_t)i));
+        HOST_IrqDispatch();
+    }
+    CHECK(RX_SIZE == LPUART_RingRxCountGet(&m_stcRing));
+    CHECK(5u == m_stcRing.u32RxOverflow);
+    CHECK(RX_SIZE == LPUART_RingRead(&m_stcRing, au8Rx, sizeof(au8Rx)));
+    CHECK((0u == au8Rx[0]) && ((RX_SIZE - 1u) == au8Rx[RX_SIZE - 1u]));
+
+    /* 接收与发送同时进行 */
+    m_u32CaptureCnt = 0u;
+    CHECK(8u == LPUART_RingWrite(&m_stcRing, au8Msg, 8u));
+    for (i = 0u; i < 8u; i++)
+    {
+        CHECK(Ok == HOST_LpuartRxPush(0u, (uint16_t)(0xA0u + i)));
+        HOST_CycleAdvance(HOST_LpuartFrameCycles(0u));
+        HOST_IrqDispatch();
+    }
+    TxWaitIdle();
+    CHECK(8u == m_u32CaptureCnt);
+    CHECK(8u == LPUART_RingRead(&m_stcRing, au8Rx, sizeof(au8Rx)));
+    CHECK((0xA0u == au8Rx[0]) && (0xA7u == au8Rx[7]));
+
+    /* 5. 停止：禁止中断并注销回调 */
+    LPUART_RingDeInit(&m_stcRing);
+    CHECK(0u == (NVIC->ISER[0] & (1uL << (uint32_t)LPUART0_IRQn)));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_TXE | LPUART_INT_RC));
+
+    /* 只发送 */
+    CHECK(Ok == LPUART_RingInit(LPUART0, &m_stcRing, m_au8TxBuf, TX_SIZE, NULL, 0u, IrqPriorityLevel1));
+    CHECK(0u == READ_REG32_BIT(LPUART0->SCON, LPUART_INT_RC));
+    CHECK(0u == LPUART_RingRead(&m_stcRing, au8Rx, sizeof(au8Rx)));
+    LPUART_RingDeInit(&m_stcRing);
+
+    /* 空指针及未初始化的控制块不操作 */
+    LPUART_RingDeInit(NULL);
+    DDL_ZERO_STRUCT(stcIdle);
+    LPUART_RingDeInit(&stcIdle);
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  系统时钟切换
+ * @param  [in] u32SysClockSrc 时钟源 @ref SYSCTRL_Clock_Source
+ * @retval None
+ */
+static void SysClockConfig(uint32_t u32SysClockSrc)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit = {0};
+
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+    stcSysClockInit.u32SysClockSrc = u32SysClockSrc;
+    stcSysClockInit.u32HclkDiv     = SYSCTRL_HCLK_PRS_DIV1;
+    SYSCTRL_ClockInit(&stcSysClockInit);
+}
+
+/**
+ * @brief  LPUART0 115200bps 8N1 收发
+ * @retval None
+ */
+static void LpuartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32Baud = BAUD;
+    LPUART_Init(LPUART0, &stcLpuartInit);
+    LPUART_IntFlagClearAll(LPUART0);
+}
+
+/**
+ * @brief  记录发送的帧
+ * @param  [in] u8Unit LPUART通道
+ * @param  [in] u16Data 帧数据
+ * @retval None
+ */
+static void TxCapture(uint8_t u8Unit, uint16_t u16Data)
+{
+    if ((0u == u8Unit) && (m_u32CaptureCnt < STRESS_LEN))
+    {
+        m_au8Capture[m_u32CaptureCnt++] = (uint8_t)u16Data;
+    }
+}
+
+/**
+ * @brief  等待发送缓冲及移位寄存器为空
+ * @retval None
+ */
+static void TxWaitIdle(void)
+{
+    while ((0u != LPUART_RingTxCountGet(&m_stcRing)) || (FALSE == LPUART_IntFlagGet(LPUART0, LPUART_FLAG_TC)))
+    {
+        HOST_CycleAdvance(HOST_LpuartFrameCycles(0u) / 4u);
+        HOST_IrqDispatch();
+    }
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,343 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the XTL BSEL/MODU baud rate generator
+ *        of the LPUART (LPUART_XtlBaudCalc) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdlib.h>
+#include "ddl.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define FRAME_BITS    (10u)        /* 8N1：起始位+8数据位+停止位 */
+#define START_DELAY   (1.0 / 16.0) /* 对端起始位检测延迟（位时间） */
+#define REMOTE_ERR    (0.02)       /* 对端时钟误差 */
+#define BRUTE_STEP    (7u)         /* 穷举比较的波特率步长 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     KnownValueCheck(void);
+static void     RegisterCheck(void);
+static void     RangeCheck(void);
+static void     UnreachableReport(void);
+static uint32_t EdgeErrMax(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud);
+static double   TxMargin(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud, double dRemoteErr);
+static double   RxMargin(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud, double dRemoteErr);
+static uint32_t Base(const stc_lpuart_xtl_baud_t *pstcCfg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    KnownValueCheck();
+    RegisterCheck();
+    RangeCheck();
+    UnreachableReport();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  9600、4800波特率与原固定值相同
+ * @retval None
+ */
+static void KnownValueCheck(void)
+{
+    stc_lpuart_xtl_baud_t stcCfg;
+
+    CHECK(Ok == LPUART_XtlBaudCalc(9600u, &stcCfg));
+    CHECK((LPUART_XTL_BAUD_9600 == stcCfg.u32Bsel) && (0x54Au == stcCfg.u32Modu));
+    printf("9600: BSEL=%u MODU=0x%03X err=%dppm edge=%u.%u%% margin tx=%.1f%% rx=%.1f%%\n", (unsigned)stcCfg.u32Bsel, (unsigned)stcCfg.u32Modu,
+           (int)stcCfg.i32ErrPpm, stcCfg.u16EdgeErrPml / 10u, stcCfg.u16EdgeErrPml % 10u, 100.0 * TxMargin(3u, stcCfg.u32Modu, 9600u, 0.0),
+           100.0 * RxMargin(3u, stcCfg.u32Modu, 9600u, 0.0));
+
+    CHECK(Ok == LPUART_XtlBaudCalc(4800u, &stcCfg));
+    CHECK((LPUART_XTL_BAUD_4800 == stcCfg.u32Bsel) && (0xEFBu == stcCfg.u32Modu));
+    printf("4800: BSEL=%u MODU=0x%03X err=%dppm edge=%u.%u%% margin tx=%.1f%% rx=%.1f%%\n", (unsigned)stcCfg.u32Bsel, (unsigned)stcCfg.u32Modu,
+           (int)stcCfg.i32ErrPpm, stcCfg.u16EdgeErrPml / 10u, stcCfg.u16EdgeErrPml % 10u, 100.0 * TxMargin(6u, stcCfg.u32Modu, 4800u, 0.0),
+           100.0 * RxMargin(6u, stcCfg.u32Modu, 4800u, 0.0));
+
+    CHECK(ErrorInvalidParameter == LPUART_XtlBaudCalc(9600u, NULL));
+}
+
+/**
+ * @brief  寄存器设置及模型帧时间
+ * @retval None
+ */
+static void RegisterCheck(void)
+{
+    stc_lpuart_init_t     stcInit;
+    stc_lpuart_xtl_baud_t stcCfg;
+    uint32_t              u32Clk = 0u;
+    uint32_t              i;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart0);
+    LPUART_StcInit(&stcInit);
+    stcInit.u32TransMode        = LPUART_MODE_TX_RX;
+    stcInit.stcBaudRate.u32Baud = 9600u;
+    LPUART_Init(LPUART0, &stcInit);
+
+    /* 传输时钟不是XTL */
+    CHECK(Error == LPUART_XtlBselSet(LPUART0, LPUART_XTL_BAUD_9600));
+    CHECK(Ok == LPUART_XtlBaudCalc(10000u, &stcCfg));
+    CHECK(Error == LPUART_XtlBaudSet(LPUART0, &stcCfg));
+
+    stcInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_XTL;
+    stcInit.stcBaudRate.u32Sclk       = LPUART_XTL_FREQ;
+    LPUART_Init(LPUART0, &stcInit);
+    CHECK(Error == LPUART_XtlBselSet(LPUART0, LPUART_XTL_BAUD_NORMAL));
+    CHECK(Ok == LPUART_XtlBselSet(LPUART0, LPUART_XTL_BAUD_4800));
+    CHECK((LPUART_XTL_BAUD_4800 == LPUART0->BSEL) && (0xEFBu == LPUART0->MODU));
+
+    CHECK(Ok == LPUART_XtlBaudSet(LPUART0, &stcCfg));
+    CHECK((stcCfg.u32Bsel == LPUART0->BSEL) && (stcCfg.u32Modu == LPUART0->MODU));
+    for (i = 0u; i < FRAME_BITS; i++)
+    {
+        u32Clk += Base(&stcCfg) + ((stcCfg.u32Modu >> i) & 1u);
+    }
+    CHECK(((uint64_t)SystemCoreClock * u32Clk / LPUART_XTL_FREQ) == HOST_LpuartFrameCycles(0u));
+
+    SYSCTRL_PeriphReset(PeriphResetLpuart0);
+}
+
+/**
+ * @brief  全部可调制波特率：最大边沿偏差为穷举最小值，采样余量
+ * @retval None
+ */
+static void RangeCheck(void)
+{
+    static const uint32_t au32Range[2][2] = {{4682u, 5461u}, {8192u, 10922u}};
+    stc_lpuart_xtl_baud_t stcCfg;
+    uint32_t              u32Cnt       = 0u;
+    uint32_t              u32Brute     = 0u;
+    uint32_t              u32WorstBaud = 0u;
+    double                dWorst       = 1.0;
+    double                dWorstRemote = 1.0;
+    double                dMargin;
+    uint32_t              u32Baud;
+    uint32_t              u32Modu;
+    uint32_t              u32Min;
+    uint32_t              r;
+
+    for (r = 0u; r < 2u; r++)
+    {
+        /* 范围外 */
+        CHECK(ErrorInvalidParameter == LPUART_XtlBaudCalc(au32Range[r][0] - 1u, &stcCfg));
+        CHECK(ErrorInvalidParameter == LPUART_XtlBaudCalc(au32Range[r][1] + 1u, &stcCfg));
+
+        for (u32Baud = au32Range[r][0]; u32Baud <= au32Range[r][1]; u32Baud++)
+        {
+            CHECK(Ok == LPUART_XtlBaudCalc(u32Baud, &stcCfg));
+            CHECK(0u == (stcCfg.u32Modu & ~LPUART_MODU_MODU_Msk));
+            /* 边沿偏差不超过半个XTL时钟 */
+            CHECK((EdgeErrMax(Base(&stcCfg), stcCfg.u32Modu, u32Baud) * 2u) <= u32Baud);
+            CHECK(stcCfg.u16EdgeErrPml == DDL_UDivRound(EdgeErrMax(Base(&stcCfg), stcCfg.u32Modu, u32Baud) * 1000u, LPUART_XTL_FREQ));
+
+            if (0u == (u32Baud % BRUTE_STEP))
+            {
+                u32Min = UINT32_MAX;
+                for (u32Modu = 0u; u32Modu <= LPUART_MODU_MODU_Msk; u32Modu++)
+                {
+                    u32Min = (EdgeErrMax(Base(&stcCfg), u32Modu, u32Baud) < u32Min) ? EdgeErrMax(Base(&stcCfg), u32Modu, u32Baud) : u32Min;
+                }
+                CHECK(u32Min == EdgeErrMax(Base(&stcCfg), stcCfg.u32Modu, u32Baud));
+                u32Brute++;
+            }
+
+            /* 发送：余量不小于半位减去最大边沿偏差及检测延迟 */
+            dMargin = TxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, 0.0);
+            CHECK(dMargin >= (0.5 - ((double)EdgeErrMax(Base(&stcCfg), stcCfg.u32Modu, u32Baud) / LPUART_XTL_FREQ) - START_DELAY - 1e-9));
+            dMargin = (RxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, 0.0) < dMargin) ? RxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, 0.0) : dMargin;
+            CHECK(dMargin > 0.0);
+            if (dMargin < dWorst)
+            {
+                dWorst       = dMargin;
+                u32WorstBaud = u32Baud;
+            }
+
+            dMargin = TxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, REMOTE_ERR);
+            dMargin = (TxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, -REMOTE_ERR) < dMargin) ? TxMargin(Base(&stcCfg), stcCfg.u32Modu, u32Baud, -REMOTE_ERR)
+                                                                                                  : dMargin;
+            CHECK(dMargin > 0.0);
+            dWorstRemote = (dMargin < dWorstRemote) ? dMargin : dWorstRemote;
+            u32Cnt++;
+        }
+    }
+    printf("%u baud rates, %u compared with all 4096 MODU patterns\n", (unsigned)u32Cnt, (unsigned)u32Brute);
+    printf("worst sampling margin %.1f%% @%u, %.1f%% with remote clock +/-%.0f%%\n", 100.0 * dWorst, (unsigned)u32WorstBaud, 100.0 * dWorstRemote,
+           100.0 * REMOTE_ERR);
+}
+
+/**
+ * @brief  不能由调制产生的波特率：输出OVER/SCNT方式的误差
+ * @retval None
+ */
+static void UnreachableReport(void)
+{
+    static const uint32_t au32Baud[] = {1200u, 2400u, 19200u};
+    stc_lpuart_xtl_baud_t stcXtl;
+    stc_lpuart_baud_cfg_t stcCfg;
+    uint32_t              i;
+
+    for (i = 0u; i < ARRAY_SZ(au32Baud); i++)
+    {
+        CHECK(ErrorInvalidParameter == LPUART_XtlBaudCalc(au32Baud[i], &stcXtl));
+        if (Ok == LPUART_BaudCalc(LPUART_XTL_FREQ, au32Baud[i], &stcCfg))
+        {
+            printf("%u: no BSEL/MODU setting, OVER/SCNT %u*%u err=%dppm\n", (unsigned)au32Baud[i],
+                   (unsigned)(16u >> (stcCfg.u32Over >> LPUART_SCON_OVER_Pos)), (unsigned)stcCfg.u32Scnt, (int)stcCfg.i32ErrPpm);
+        }
+    }
+}
+
+/**
+ * @brief  12位内各位边沿与理想位置的最大偏差
+ * @param  [in] u32Base 每位时钟基数
+ * @param  [in] u32Modu 调制位
+ * @param  [in] u32Baud 波特率
+ * @retval uint32_t 偏差*Baud（XTL时钟*波特率）
+ */
+static uint32_t EdgeErrMax(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud)
+{
+    uint32_t u32Edge = 0u;
+    uint32_t u32Max  = 0u;
+    int32_t  i32Err;
+    uint32_t i;
+
+    for (i = 1u; i <= LPUART_XTL_MODU_BITS; i++)
+    {
+        u32Edge += u32Base + ((u32Modu >> (i - 1u)) & 1u);
+        i32Err = abs((int32_t)(u32Edge * u32Baud) - (int32_t)(i * LPUART_XTL_FREQ));
+        u32Max = ((uint32_t)i32Err > u32Max) ? (uint32_t)i32Err : u32Max;
+    }
+    return u32Max;
+}
+
+/**
+ * @brief  LPUART发送、对端接收的采样余量：对端在起始位下降沿后（16倍采样，检测延迟0~1/16位）
+ *         于每位中点采样，余量为采样点到发送位边沿的最小距离
+ * @param  [in] u32Base 每位时钟基数
+ * @param  [in] u32Modu 调制位
+ * @param  [in] u32Baud 波特率
+ * @param  [in] dRemoteErr 对端时钟误差
+ * @retval double 余量（位时间）
+ */
+static double TxMargin(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud, double dRemoteErr)
+{
+    const double dBit    = (double)LPUART_XTL_FREQ / u32Baud; /* 位时间（XTL时钟） */
+    const double dRemote = dBit / (1.0 + dRemoteErr);
+    double       dMargin = 1.0;
+    double       dEdge   = 0.0;
+    double       dNext;
+    double       dSample;
+    double       dDelay;
+    uint32_t     i;
+
+    for (dDelay = 0.0; dDelay <= (START_DELAY * dRemote); dDelay += START_DELAY * dRemote)
+    {
+        dEdge = 0.0;
+        for (i = 0u; i < FRAME_BITS; i++)
+        {
+            dNext   = dEdge + u32Base + ((u32Modu >> i) & 1u);
+            dSample = dDelay + (i + 0.5) * dRemote;
+            dMargin = ((dSample - dEdge) < dMargin * dBit) ? ((dSample - dEdge) / dBit) : dMargin;
+            dMargin = ((dNext - dSample) < dMargin * dBit) ? ((dNext - dSample) / dBit) : dMargin;
+            dEdge   = dNext;
+        }
+    }
+    return dMargin;
+}
+
+/**
+ * @brief  对端发送、LPUART接收的采样余量：LPUART在起始位下降沿后的下一个XTL时钟开始计时（延迟0~1个时钟），
+ *         于每个调制位的中点采样
+ * @param  [in] u32Base 每位时钟基数
+ * @param  [in] u32Modu 调制位
+ * @param  [in] u32Baud 波特率
+ * @param  [in] dRemoteErr 对端时钟误差
+ * @retval double 余量（位时间）
+ */
+static double RxMargin(uint32_t u32Base, uint32_t u32Modu, uint32_t u32Baud, double dRemoteErr)
+{
+    const double dBit    = (double)LPUART_XTL_FREQ / u32Baud;
+    const double dRemote = dBit / (1.0 + dRemoteErr);
+    double       dMargin = 1.0;
+    double       dEdge;
+    double       dLen;
+    double       dSample;
+    double       dDelay;
+    uint32_t     i;
+
+    for (dDelay = 0.0; dDelay <= 1.0; dDelay += 1.0)
+    {
+        dEdge = dDelay;
+        for (i = 0u; i < FRAME_BITS; i++)
+        {
+            dLen    = u32Base + ((u32Modu >> i) & 1u);
+            dSample = dEdge + (dLen / 2.0);
+            dMargin = ((dSample - i * dRemote) < dMargin * dBit) ? ((dSample - i * dRemote) / dBit) : dMargin;
+            dMargin = (((i + 1u) * dRemote - dSample) < dMargin * dBit) ? (((i + 1u) * dRemote - dSample) / dBit) : dMargin;
+            dEdge += dLen;
+        }
+    }
+    return dMargin;
+}
+
+/**
+ * @brief  BSEL对应的每位时钟基数
+ * @param  [in] pstcCfg 调制配置
+ * @retval uint32_t 时钟数
+ */
+static uint32_t Base(const stc_lpuart_xtl_baud_t *pstcCfg)
+{
+    return (LPUART_XTL_BAUD_9600 == pstcCfg->u32Bsel) ? 3u : 6u;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
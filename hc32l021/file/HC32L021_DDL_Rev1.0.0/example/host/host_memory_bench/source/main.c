@@ -0,0 +1,282 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the word-aligned memory primitives
+ *        (DDL_MemoryClear/Set/Copy/Compare) and their bus access benchmark
+ *        against the byte loop on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "hsi2c.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SRAM_BUF1   (0x20000000u) /* 基准测试缓冲区1（模型SRAM，每次访存均计数） */
+#define SRAM_BUF2   (0x20000800u) /* 基准测试缓冲区2 */
+#define CHECK_LEN   (48u)         /* 功能测试最大长度 */
+#define BENCH_NUM   (4u)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     FunctionCheck(void);
+static void     ByteClear(void *pvDst, uint32_t u32Count);
+static void     ByteCopy(void *pvDst, const void *pvSrc, uint32_t u32Count);
+static int32_t  ByteCompare(const void *pvBuf1, const void *pvBuf2, uint32_t u32Count);
+static uint64_t AccessGet(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    const uint32_t au32Len[BENCH_NUM] = {sizeof(stc_hsi2c_com_t), 16u, 64u, 256u};
+    uint8_t       *pu8Buf1 = (uint8_t *)DDL_MEM_MAP(SRAM_BUF1);
+    uint8_t       *pu8Buf2 = (uint8_t *)DDL_MEM_MAP(SRAM_BUF2);
+    uint64_t       au64Byte[3];
+    uint64_t       au64Word[3];
+    uint64_t       u64Cnt;
+    uint32_t       i;
+
+    /* 1. 功能：各种对齐及长度与标准库结果一致 */
+    FunctionCheck();
+
+    /* 2. 基准：SRAM访问次数（每次访问HOST_ACCESS_CYCLES_DEFAULT个周期） */
+    printf("%-8s %-22s %-22s %-22s\n", "bytes", "clear byte/word", "copy byte/word", "compare byte/word");
+    for (i = 0u; i < BENCH_NUM; i++)
+    {
+        memset(HOST_MemPtr(SRAM_BUF2), 0x5A, au32Len[i]);
+
+        u64Cnt = AccessGet();
+        ByteClear(pu8Buf1, au32Len[i]);
+        au64Byte[0] = AccessGet() - u64Cnt;
+        u64Cnt      = AccessGet();
+        DDL_MemoryClear(pu8Buf1, au32Len[i]);
+        au64Word[0] = AccessGet() - u64Cnt;
+
+        u64Cnt = AccessGet();
+        ByteCopy(pu8Buf1, pu8Buf2, au32Len[i]);
+        au64Byte[1] = AccessGet() - u64Cnt;
+        u64Cnt      = AccessGet();
+        DDL_MemoryCopy(pu8Buf1, pu8Buf2, au32Len[i]);
+        au64Word[1] = AccessGet() - u64Cnt;
+        CHECK(0 == memcmp(HOST_MemPtr(SRAM_BUF1), HOST_MemPtr(SRAM_BUF2), au32Len[i]));
+
+        u64Cnt = AccessGet();
+        CHECK(0 == ByteCompare(pu8Buf1, pu8Buf2, au32Len[i]));
+        au64Byte[2] = AccessGet() - u64Cnt;
+        u64Cnt      = AccessGet();
+        CHECK(0 == DDL_MemoryCompare(pu8Buf1, pu8Buf2, au32Len[i]));
+        au64Word[2] = AccessGet() - u64Cnt;
+
+        printf("%-8u %6llu / %-13llu %6llu / %-13llu %6llu / %-13llu\n", (unsigned)au32Len[i], (unsigned long long)au64Byte[0],
+               (unsigned long long)au64Word[0], (unsigned long long)au64Byte[1], (unsigned long long)au64Word[1],
+               (unsigned long long)au64Byte[2], (unsigned long long)au64Word[2]);
+
+        /* 对齐缓冲区：每4字节一次访问 */
+        CHECK(au64Byte[0] == au32Len[i]);
+        CHECK(au64Word[0] == ((au32Len[i] + 3u) / 4u));
+        CHECK(au64Word[1] == (2u * ((au32Len[i] + 3u) / 4u)));
+        CHECK(au64Word[2] == (2u * ((au32Len[i] + 3u) / 4u)));
+    }
+
+    /* 3. 非对齐起始地址：首尾按字节，中间按字 */
+    DDL_MemoryClear(pu8Buf1, 68u);
+    u64Cnt = AccessGet();
+    DDL_MemorySet(pu8Buf1 + 1u, 0xA5u, 64u);
+    u64Cnt = AccessGet() - u64Cnt;
+    printf("set 64 bytes @+1: %llu accesses\n", (unsigned long long)u64Cnt);
+    CHECK((3u + 15u + 1u) == u64Cnt);
+    CHECK(0x00u == pu8Buf1[0]);
+    CHECK(0xA5u == pu8Buf1[1]);
+    CHECK(0xA5u == pu8Buf1[64]);
+    CHECK(0x00u == pu8Buf1[65]);
+
+    /* DDL_ZERO_STRUCT()经DDL_MemoryClear()按字清零 */
+    u64Cnt = AccessGet();
+    DDL_ZERO_STRUCT(*(stc_hsi2c_com_t *)(void *)pu8Buf2);
+    u64Cnt = AccessGet() - u64Cnt;
+    CHECK(u64Cnt == ((sizeof(stc_hsi2c_com_t) + 3u) / 4u));
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  全部对齐组合及长度下与标准库比较
+ * @retval None
+ */
+static void FunctionCheck(void)
+{
+    uint8_t  au8Dst[CHECK_LEN + 8u];
+    uint8_t  au8Ref[CHECK_LEN + 8u];
+    uint8_t  au8Src[CHECK_LEN + 8u];
+    uint32_t u32Dst;
+    uint32_t u32Src;
+    uint32_t u32Len;
+    uint32_t u32Pos;
+    int32_t  i32Ret;
+    int32_t  i32Ref;
+
+    for (u32Src = 0u; u32Src < sizeof(au8Src); u32Src++)
+    {
+        au8Src[u32Src] = (uint8_t)(u32Src * 37u + 11u);
+    }
+
+    for (u32Dst = 0u; u32Dst < 4u; u32Dst++)
+    {
+        for (u32Len = 0u; u32Len <= CHECK_LEN; u32Len++)
+        {
+            memset(au8Dst, 0xCC, sizeof(au8Dst));
+            memset(au8Ref, 0xCC, sizeof(au8Ref));
+            DDL_MemorySet(&au8Dst[u32Dst], 0x3Cu, u32Len);
+            memset(&au8Ref[u32Dst], 0x3C, u32Len);
+            CHECK(0 == memcmp(au8Dst, au8Ref, sizeof(au8Dst)));
+
+            DDL_MemoryClear(&au8Dst[u32Dst], u32Len);
+            memset(&au8Ref[u32Dst], 0, u32Len);
+            CHECK(0 == memcmp(au8Dst, au8Ref, sizeof(au8Dst)));
+
+            for (u32Src = 0u; u32Src < 4u; u32Src++)
+            {
+                memset(au8Dst, 0xCC, sizeof(au8Dst));
+                memset(au8Ref, 0xCC, sizeof(au8Ref));
+                DDL_MemoryCopy(&au8Dst[u32Dst], &au8Src[u32Src], u32Len);
+                memcpy(&au8Ref[u32Dst], &au8Src[u32Src], u32Len);
+                CHECK(0 == memcmp(au8Dst, au8Ref, sizeof(au8Dst)));
+
+                /* 逐个位置制造差异，返回值符号与memcmp()一致 */
+                CHECK(0 == DDL_MemoryCompare(&au8Dst[u32Dst], &au8Src[u32Src], u32Len));
+                for (u32Pos = 0u; u32Pos < u32Len; u32Pos++)
+                {
+                    au8Dst[u32Dst + u32Pos] ^= (uint8_t)(0x80u >> (u32Pos & 7u));
+                    i32Ret = DDL_MemoryCompare(&au8Dst[u32Dst], &au8Src[u32Src], u32Len);
+                    i32Ref = memcmp(&au8Dst[u32Dst], &au8Src[u32Src], u32Len);
+                    CHECK(((i32Ret < 0) && (i32Ref < 0)) || ((i32Ret > 0) && (i32Ref > 0)));
+                    au8Dst[u32Dst + u32Pos] ^= (uint8_t)(0x80u >> (u32Pos & 7u));
+                }
+            }
+        }
+    }
+
+    /* NULL不访问 */
+    DDL_MemoryClear(NULL, 4u);
+    DDL_MemoryCopy(NULL, au8Src, 4u);
+    CHECK(0 == DDL_MemoryCompare(NULL, au8Src, 4u));
+}
+
+/**
+ * @brief  原按字节清零实现（基准）
+ * @param  [in] pvDst 起始地址
+ * @param  [in] u32Count 长度
+ * @retval None
+ */
+static void ByteClear(void *pvDst, uint32_t u32Count)
+{
+    uint8_t *pu8Addr = (uint8_t *)pvDst;
+
+    while (u32Count--)
+    {
+        *pu8Addr++ = 0;
+    }
+}
+
+/**
+ * @brief  按字节复制（基准）
+ * @param  [out] pvDst 目标地址
+ * @param  [in] pvSrc 源地址
+ * @param  [in] u32Count 长度
+ * @retval None
+ */
+static void ByteCopy(void *pvDst, const void *pvSrc, uint32_t u32Count)
+{
+    uint8_t       *pu8Dst = (uint8_t *)pvDst;
+    const uint8_t *pu8Src = (const uint8_t *)pvSrc;
+
+    while (u32Count--)
+    {
+        *pu8Dst++ = *pu8Src++;
+    }
+}
+
+/**
+ * @brief  按字节比较（基准）
+ * @param  [in] pvBuf1 地址1
+ * @param  [in] pvBuf2 地址2
+ * @param  [in] u32Count 长度
+ * @retval int32_t 第一个不同字节之差
+ */
+static int32_t ByteCompare(const void *pvBuf1, const void *pvBuf2, uint32_t u32Count)
+{
+    const uint8_t *pu8Buf1 = (const uint8_t *)pvBuf1;
+    const uint8_t *pu8Buf2 = (const uint8_t *)pvBuf2;
+
+    while (u32Count--)
+    {
+        if (*pu8Buf1 != *pu8Buf2)
+        {
+            return (int32_t)*pu8Buf1 - (int32_t)*pu8Buf2;
+        }
+        pu8Buf1++;
+        pu8Buf2++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  总线访问总次数
+ * @retval uint64_t 读写次数之和
+ */
+static uint64_t AccessGet(void)
+{
+    stc_host_access_stat_t stcStat;
+
+    HOST_AccessStatGet(&stcStat);
+
+    return stcStat.u64Read + stcStat.u64Write;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
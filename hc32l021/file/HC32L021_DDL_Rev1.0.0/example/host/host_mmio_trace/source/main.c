@@ -0,0 +1,212 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the MMIO access trace (register access
+ *        counting by peripheral and call site, built with DDL_MMIO_TRACE)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "sysctrl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define LOG_NUM (16u)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     SysClockConfig(void);
+static void     GpioConfig(void);
+static void     LpUartConfig(void);
+static uint32_t ApiAccessGet(const char *pcFunc, uint32_t *pu32Write);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_ddl_mmio_log_t astcLog[LOG_NUM];
+    uint8_t            au8Tx[4] = {0x48, 0x43, 0x33, 0x32};
+    uint32_t           u32Read;
+    uint32_t           u32Write;
+    uint32_t           u32Num;
+    uint32_t           i;
+
+    /* 只统计以下初始化及发送过程 */
+    DDL_MmioTraceClear();
+
+    SysClockConfig();
+    GpioConfig();
+    LpUartConfig();
+    CHECK(Ok == LPUART_TransmitPoll(LPUART1, au8Tx, sizeof(au8Tx)));
+
+    DDL_MmioReport();
+
+    /* 时钟切换及分频设置均有寄存器访问 */
+    u32Read = ApiAccessGet("SYSCTRL_SysClockSwitch", &u32Write);
+    printf("SYSCTRL_SysClockSwitch: %u read, %u write\n", (unsigned)u32Read, (unsigned)u32Write);
+    CHECK(0u != u32Write);
+    u32Read = ApiAccessGet("SYSCTRL_HclkDivSet", &u32Write);
+    CHECK(0u != u32Write);
+
+    /* GPIO_Init()输出模式：OUT/OD/DIR/ADS/PU各一次读-改-写，两次调用 */
+    u32Read = ApiAccessGet("GPIO_Init", &u32Write);
+    printf("GPIO_Init: %u read, %u write\n", (unsigned)u32Read, (unsigned)u32Write);
+    CHECK(u32Write >= 10u);
+    CHECK(u32Read == u32Write);
+
+    /* 每字节至少一次TXE查询及一次SBUF读-改-写 */
+    u32Read = ApiAccessGet("LPUART_TransmitPoll", &u32Write);
+    CHECK(u32Write >= sizeof(au8Tx));
+    CHECK(u32Read >= (2u * sizeof(au8Tx)));
+
+    /* 最近访问记录按时间排列 */
+    u32Num = DDL_MmioLogGet(astcLog, LOG_NUM);
+    CHECK(LOG_NUM == u32Num);
+    for (i = 1u; i < u32Num; i++)
+    {
+        CHECK(astcLog[i].u32Tick >= astcLog[i - 1u].u32Tick);
+    }
+    CHECK((LPUART1_BASE + offsetof(LPUART_TypeDef, ICR)) == astcLog[u32Num - 1u].u32Addr);
+
+    /* 暂停后不再记录 */
+    u32Read = ApiAccessGet("GPIO_Init", &u32Write);
+    DDL_MmioTraceCmd(FALSE);
+    GpioConfig();
+    DDL_MmioTraceCmd(TRUE);
+    CHECK(u32Read == ApiAccessGet("GPIO_Init", &u32Num));
+    CHECK(u32Write == u32Num);
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  按函数名汇总调用位置统计
+ * @param  [in] pcFunc 函数名
+ * @param  [out] pu32Write 写访问次数
+ * @retval uint32_t 读访问次数
+ */
+static uint32_t ApiAccessGet(const char *pcFunc, uint32_t *pu32Write)
+{
+    const stc_ddl_mmio_site_t *pstcSite;
+    uint32_t                   u32Num = DDL_MmioSiteGet(&pstcSite);
+    uint32_t                   u32Read = 0u;
+    uint32_t                   i;
+
+    *pu32Write = 0u;
+    for (i = 0u; i < u32Num; i++)
+    {
+        if ((NULL != pstcSite[i].pcFunc) && (0 == strcmp(pstcSite[i].pcFunc, pcFunc)))
+        {
+            u32Read += pstcSite[i].u32Read;
+            *pu32Write += pstcSite[i].u32Write;
+        }
+    }
+
+    return u32Read;
+}
+
+/**
+ * @brief  时钟初始化
+ * @retval None
+ */
+static void SysClockConfig(void)
+{
+    stc_sysctrl_clock_init_t stcSysClockInit = {0};
+
+    /* 结构体初始化 */
+    SYSCTRL_ClockStcInit(&stcSysClockInit);
+
+    stcSysClockInit.u32SysClockSrc = SYSCTRL_CLK_SRC_RC48M_48M; /* 选择系统默认RC48M 48MHz作为Hclk时钟源 */
+    stcSysClockInit.u32HclkDiv     = SYSCTRL_HCLK_PRS_DIV1;     /* Hclk 1分频 */
+    SYSCTRL_ClockInit(&stcSysClockInit);                        /* 系统时钟初始化 */
+}
+
+/**
+ * @brief  GPIO配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01、PA02为推挽输出 */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    stcGpioInit.u32Pin = GPIO_PIN_02;
+    GPIO_Init(GPIOA, &stcGpioInit);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();
+    stcLpuartInit.stcBaudRate.u32Baud       = 115200u;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
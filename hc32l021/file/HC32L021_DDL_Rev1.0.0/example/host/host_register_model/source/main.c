@@ -0,0 +1,274 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the host register model (runs the
+ *        unmodified DDL on Linux against RAM backed peripheral registers)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "flash.h"
+#include "lpuart.h"
+#include "spi.h"
+#include "sysctrl.h"
+#include "trng.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TEST_LEN       (8u)
+#define TEST_FLASH_ADR (0xFE00u) /* 扇区127 首地址 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     LpUartTxCapture(uint8_t u8Unit, uint16_t u16Data);
+static void     LpUartRxInject(void *pvArg);
+static uint16_t SpiDeviceInvert(uint16_t u16Tx);
+static void     LpUartConfig(void);
+static void     SpiConfig(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+static uint8_t  u8TxLog[32];
+static uint32_t u32TxLogCnt = 0u;
+static uint8_t  u8IrqRxData[TEST_LEN];
+static uint32_t u32IrqRxCnt   = 0u;
+static uint32_t u32SysTickCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_stk_chip_info_t stcChipInfo;
+    uint8_t             au8Tx[TEST_LEN] = {0x55, 0xAA, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    uint8_t             au8Rx[TEST_LEN] = {0};
+    uint16_t            au16Tx[TEST_LEN];
+    uint16_t            au16Rx[TEST_LEN];
+    uint32_t            au32Data[TEST_LEN];
+    uint64_t            u64Start;
+    uint32_t            i;
+
+    /* 芯片信息（信息区） */
+    STK_ChipInfoGet(&stcChipInfo);
+    printf("chip %s, flash %u KB, ram %u KB, HCLK %u Hz\n", stcChipInfo.pcProductNum, (unsigned)(stcChipInfo.u32FlashSize >> 10u),
+           (unsigned)(stcChipInfo.u32RamSize >> 10u), (unsigned)SystemCoreClock);
+
+    /* SysTick轮询延时：4MHz下1ms为4000个HCLK周期 */
+    u64Start = HOST_CycleGet();
+    DDL_Delay1ms(2u);
+    printf("DDL_Delay1ms(2): %llu cycles\n", (unsigned long long)(HOST_CycleGet() - u64Start));
+    CHECK((HOST_CycleGet() - u64Start) >= 8000u);
+
+    /* LPUART1查询收发 */
+    LpUartConfig();
+    HOST_LpuartTxHookSet(LpUartTxCapture);
+    u64Start = HOST_CycleGet();
+    CHECK(Ok == LPUART_TransmitPoll(LPUART1, au8Tx, TEST_LEN));
+    printf("LPUART1 %u bytes @9600: %llu cycles\n", (unsigned)TEST_LEN, (unsigned long long)(HOST_CycleGet() - u64Start));
+    CHECK(TEST_LEN == u32TxLogCnt);
+    CHECK(0 == memcmp(u8TxLog, au8Tx, TEST_LEN));
+
+    HOST_LpuartRxPush(1u, 0x5Au);
+    CHECK(Ok == LPUART_ReceivePollTimeOut(LPUART1, au8Rx, 1u, 0xFFFFu));
+    CHECK(0x5Au == au8Rx[0]);
+
+    /* LPUART1中断接收：模拟时间事件逐字节注入 */
+    LPUART_IntFlagClearAll(LPUART1);
+    LPUART_IntEnable(LPUART1, LPUART_INT_RC);
+    EnableNvic(LPUART1_IRQn, IrqPriorityLevel3, TRUE);
+    for (i = 0u; i < TEST_LEN; i++)
+    {
+        HOST_EventSchedule((uint64_t)(i + 1u) * HOST_LpuartFrameCycles(1u), LpUartRxInject, (void *)(uintptr_t)au8Tx[i]);
+    }
+    while (u32IrqRxCnt < TEST_LEN)
+    {
+        __WFI();
+    }
+    CHECK(0 == memcmp(u8IrqRxData, au8Tx, TEST_LEN));
+    EnableNvic(LPUART1_IRQn, IrqPriorityLevel3, FALSE);
+
+    /* SysTick中断 */
+    SysTick_Config(SystemCoreClock / 1000u);
+    DDL_Delay1ms(1u);
+    while (u32SysTickCnt < 5u)
+    {
+        __WFI();
+    }
+    SysTick->CTRL = 0u;
+    SysTick->LOAD = 0xFFFFFFu;
+    SysTick->VAL  = 0u;
+    SysTick->CTRL = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_CLKSOURCE_Msk;
+
+    /* SPI主机：默认回环，及自定义从设备 */
+    SpiConfig();
+    for (i = 0u; i < TEST_LEN; i++)
+    {
+        au16Tx[i] = (uint16_t)(0x10u + i);
+    }
+    CHECK(Ok == SPI_TransmitReceive(SPI, au16Tx, au16Rx, TEST_LEN));
+    CHECK(0 == memcmp(au16Tx, au16Rx, sizeof(au16Rx)));
+    HOST_SpiDeviceSet(SpiDeviceInvert);
+    CHECK(Ok == SPI_TransmitReceive(SPI, au16Tx, au16Rx, TEST_LEN));
+    CHECK((uint16_t)(~au16Tx[3] & 0xFFu) == au16Rx[3]);
+    HOST_SpiDeviceSet(NULL);
+
+    /* FLASH擦写 */
+    for (i = 0u; i < TEST_LEN; i++)
+    {
+        au32Data[i] = 0x20000020u + i;
+    }
+    FLASH_ReadOnlyDisable();
+    CHECK(Ok == FLASH_LockUnlockSectors(0x80000000u));
+    CHECK(Ok == FLASH_SectorErase(TEST_FLASH_ADR));
+    CHECK(0xFFFFFFFFu == RW_MEM32(TEST_FLASH_ADR));
+    CHECK(Ok == FLASH_WriteWord(TEST_FLASH_ADR, au32Data, TEST_LEN));
+    CHECK(0x20000027u == RW_MEM32(TEST_FLASH_ADR + 28u));
+
+    /* TRNG */
+    CHECK(Ok == TRNG_Init());
+
+    HOST_AccessReport(stdout);
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  LPUART1中断服务函数
+ * @retval None
+ */
+void LpUart1_IRQHandler(void)
+{
+    if (LPUART_IntFlagGet(LPUART1, LPUART_FLAG_RC))
+    {
+        LPUART_IntFlagClear(LPUART1, LPUART_FLAG_RC);
+        u8IrqRxData[u32IrqRxCnt++ % TEST_LEN] = LPUART_ReceiveInt(LPUART1);
+    }
+}
+
+/**
+ * @brief  SysTick中断服务函数
+ * @retval None
+ */
+void SysTick_IRQHandler(void)
+{
+    u32SysTickCnt++;
+}
+
+/**
+ * @brief  LPUART发送帧记录（主机模型回调）
+ * @param  [in] u8Unit 通道号
+ * @param  [in] u16Data 发送帧
+ * @retval None
+ */
+static void LpUartTxCapture(uint8_t u8Unit, uint16_t u16Data)
+{
+    (void)u8Unit;
+
+    if (u32TxLogCnt < sizeof(u8TxLog))
+    {
+        u8TxLog[u32TxLogCnt++] = (uint8_t)u16Data;
+    }
+}
+
+/**
+ * @brief  模拟上位机发送一字节
+ * @param  [in] pvArg 数据
+ * @retval None
+ */
+static void LpUartRxInject(void *pvArg)
+{
+    HOST_LpuartRxPush(1u, (uint16_t)(uintptr_t)pvArg);
+}
+
+/**
+ * @brief  SPI从设备模型：MISO为MOSI取反
+ * @param  [in] u16Tx MOSI数据
+ * @retval uint16_t MISO数据
+ */
+static uint16_t SpiDeviceInvert(uint16_t u16Tx)
+{
+    return (uint16_t)(~u16Tx & 0xFFu);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    LPUART_StcInit(&stcLpuartInit);
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR;
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();
+    stcLpuartInit.stcBaudRate.u32Baud       = 9600u;
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1);
+}
+
+/**
+ * @brief  SPI主机配置
+ * @retval None
+ */
+static void SpiConfig(void)
+{
+    stc_spi_init_t stcSpiInit = {0};
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32BaudRate  = SPI_BAUDRATE_PCLK_DIV8;
+    stcSpiInit.u32Mode      = SPI_MD_MASTER;
+    stcSpiInit.u32DataWidth = SPI_DATA_WIDTH_8BIT;
+    stcSpiInit.u32NSS       = SPI_NSS_HARD_OUTPUT;
+    SPI_Init(SPI, &stcSpiInit);
+    SPI_FlagClearALL(SPI);
+    SPI_Enable(SPI);
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
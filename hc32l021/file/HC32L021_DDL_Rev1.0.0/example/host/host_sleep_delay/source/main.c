@@ -0,0 +1,186 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the sleep delay mode (DDL_Delay1ms()
+ *        parks the core in WFI between SysTick wakeups) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "lpm.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define DELAY_SLACK (400u) /* 延时结束判断的周期误差上限 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint64_t DelayMeasure(uint32_t u32Ms, uint32_t u32Us10, uint64_t *pu64Sleep);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt     = 0u;
+static uint32_t u32SysTickCnt = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t u32Ms = SystemCoreClock / 1000u;
+    uint64_t u64Cycle;
+    uint64_t u64Sleep;
+    uint64_t u64Tick;
+
+    /* 1. 默认忙等：不休眠 */
+    CHECK(DDL_DELAY_MD_BUSY == DDL_DelayModeGet());
+    u64Cycle = DelayMeasure(50u, 0u, &u64Sleep);
+    printf("busy  50ms: %llu cycles, sleep %llu\n", (unsigned long long)u64Cycle, (unsigned long long)u64Sleep);
+    CHECK((u64Cycle >= 50u * u32Ms) && (u64Cycle < 50u * u32Ms + DELAY_SLACK));
+    CHECK(0u == u64Sleep);
+
+    /* 2. 休眠模式：不改变SysTick设置（SystemInit()默认未使能溢出中断） */
+    CHECK(ErrorInvalidParameter == DDL_DelayModeSet(2u));
+    CHECK(Ok == DDL_DelayModeSet(DDL_DELAY_MD_SLEEP));
+    CHECK(0u == (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk));
+    CHECK(SysTick_LOAD_RELOAD_Msk == SysTick->LOAD);
+
+    /* 延时时长不变，临时按剩余时长设定SysTick周期，只唤醒一次，结束后恢复SysTick设置 */
+    u32SysTickCnt = 0u;
+    u64Tick       = DDL_TickGet();
+    u64Cycle      = DelayMeasure(50u, 0u, &u64Sleep);
+    printf("sleep 50ms: %llu cycles, sleep %llu, wakeup %u\n", (unsigned long long)u64Cycle, (unsigned long long)u64Sleep,
+           (unsigned)u32SysTickCnt);
+    CHECK((u64Cycle >= 50u * u32Ms) && (u64Cycle < 50u * u32Ms + DELAY_SLACK));
+    CHECK(u64Sleep >= (u64Cycle * 95u / 100u));
+    CHECK(u32SysTickCnt <= 1u);
+    CHECK(0u == (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk));
+    CHECK(SysTick_LOAD_RELOAD_Msk == SysTick->LOAD);
+    /* 重设SysTick时时基连续（允许少量重设开销） */
+    CHECK((u64Cycle - (DDL_TickGet() - u64Tick)) < DELAY_SLACK);
+
+    /* 超过最大重载周期（0x1000000）：按最大周期分段，唤醒两次 */
+    u32SysTickCnt = 0u;
+    u64Cycle      = DelayMeasure(5000u, 0u, &u64Sleep);
+    printf("sleep 5000ms: %llu cycles, sleep %llu, wakeup %u\n", (unsigned long long)u64Cycle, (unsigned long long)u64Sleep,
+           (unsigned)u32SysTickCnt);
+    CHECK((u64Cycle >= 5000u * u32Ms) && (u64Cycle < 5000u * u32Ms + DELAY_SLACK));
+    CHECK(u64Sleep >= (u64Cycle * 99u / 100u));
+    CHECK(u32SysTickCnt <= 2u);
+
+    /* 不足DDL_DELAY_SLEEP_MIN：忙等，不多睡 */
+    u64Cycle = DelayMeasure(0u, 3u, &u64Sleep);
+    printf("sleep 30us: %llu cycles, sleep %llu\n", (unsigned long long)u64Cycle, (unsigned long long)u64Sleep);
+    CHECK((u64Cycle >= 30u * (u32Ms / 1000u)) && (u64Cycle < 30u * (u32Ms / 1000u) + DELAY_SLACK));
+    CHECK(0u == u64Sleep);
+
+    /* 3. 关中断调用（时基要求不超过一个溢出周期）：时长不变 */
+    __disable_irq();
+    u64Cycle = DelayMeasure(0u, 80u, &u64Sleep);
+    __enable_irq();
+    CHECK((u64Cycle >= 800u * (u32Ms / 1000u)) && (u64Cycle < 800u * (u32Ms / 1000u) + DELAY_SLACK));
+
+    /* 4. 延时前后SCR不变（深度休眠配置不影响延时） */
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    u64Cycle = DelayMeasure(2u, 0u, &u64Sleep);
+    CHECK((u64Cycle >= 2u * u32Ms) && (u64Cycle < 2u * u32Ms + DELAY_SLACK));
+    CHECK(SCB_SCR_SLEEPDEEP_Msk == SCB->SCR);
+    SCB->SCR = 0u;
+
+    /* 5. 用户已使能溢出中断（1ms）：保持用户周期，每次溢出唤醒一次 */
+    CHECK(Ok == DDL_TickInit(u32Ms));
+    u32SysTickCnt = 0u;
+    u64Cycle      = DelayMeasure(50u, 0u, &u64Sleep);
+    printf("sleep 50ms (1ms tick): %llu cycles, sleep %llu, wakeup %u\n", (unsigned long long)u64Cycle, (unsigned long long)u64Sleep,
+           (unsigned)u32SysTickCnt);
+    CHECK((u64Cycle >= 50u * u32Ms) && (u64Cycle < 50u * u32Ms + DELAY_SLACK));
+    CHECK((u32SysTickCnt >= 49u) && (u32SysTickCnt <= 51u));
+    CHECK((u32Ms - 1u) == SysTick->LOAD);
+
+    /* 6. 恢复忙等 */
+    CHECK(Ok == DDL_DelayModeSet(DDL_DELAY_MD_BUSY));
+    u64Cycle = DelayMeasure(3u, 0u, &u64Sleep);
+    CHECK(0u == u64Sleep);
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  SysTick中断服务函数
+ * @retval None
+ */
+void SysTick_IRQHandler(void)
+{
+    u32SysTickCnt++;
+}
+
+/**
+ * @brief  测量一次延时的模拟周期及其中的休眠周期
+ * @param  [in] u32Ms DDL_Delay1ms()延时
+ * @param  [in] u32Us10 DDL_Delay10us()延时（u32Ms为0时使用）
+ * @param  [out] pu64Sleep 休眠周期
+ * @retval uint64_t 延时总周期
+ */
+static uint64_t DelayMeasure(uint32_t u32Ms, uint32_t u32Us10, uint64_t *pu64Sleep)
+{
+    stc_host_access_stat_t stcStat;
+    uint64_t               u64Sleep;
+    uint64_t               u64Start;
+
+    HOST_AccessStatGet(&stcStat);
+    u64Sleep = stcStat.u64SleepCycles;
+    u64Start = HOST_CycleGet();
+    if (0u != u32Ms)
+    {
+        DDL_Delay1ms(u32Ms);
+    }
+    else
+    {
+        DDL_Delay10us(u32Us10);
+    }
+    HOST_AccessStatGet(&stcStat);
+    *pu64Sleep = stcStat.u64SleepCycles - u64Sleep;
+
+    return HOST_CycleGet() - u64Start;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
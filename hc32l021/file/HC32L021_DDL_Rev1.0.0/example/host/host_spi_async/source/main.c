@@ -0,0 +1,604 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the interrupt driven SPI transaction
+ *        queue (SPI_AsyncSubmit, GPIO chip select, per-transaction mode
+ *        switching, back-to-back frames) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "spi.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  总线上的一帧（从设备模型在帧结束时记录）
+ */
+typedef struct
+{
+    uint64_t u64Cycle; /*!< 帧结束时刻 */
+    uint16_t u16Cs;    /*!< 片选引脚电平（PA OUT） */
+    uint16_t u16Tx;    /*!< 主机发送 */
+    uint32_t u32Mode;  /*!< BRR/CPOL/CPHA/WIDTH */
+} stc_frame_t;
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define CS_FLASH (GPIO_PIN_04)
+#define CS_LCD   (GPIO_PIN_05)
+#define CS_RADIO (GPIO_PIN_07)
+#define CS_ALL   (CS_FLASH | CS_LCD | CS_RADIO)
+
+#define REG_ADDR(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg))
+
+#define MODE_MSK  (SPI_CR0_BRR_Msk | SPI_CR0_CPOL_Msk | SPI_CR0_CPHA_Msk | SPI_CR0_WIDTH_Msk)
+#define FRAME_MAX (256u)
+#define RESP_BASE (0xA500u) /* 从设备应答：RESP_BASE + 帧序号 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     ParamCheck(void);
+static void     QueueCheck(void);
+static void     SleepCheck(void);
+static void     ResubmitCheck(void);
+static void     AbortCheck(void);
+static void     OvfCheck(void);
+static void     SpiConfig(void);
+static void     BusClear(void);
+static void     XferSet(stc_spi_xfer_t *pstcXfer, uint32_t u32CsPin, uint32_t u32BaudRate, uint32_t u32CPOL,
+                        uint32_t u32CPHA, uint32_t u32DataWidth, const stc_spi_seg_t *pstcSeg, uint8_t u8SegNum);
+static uint32_t WaitIdle(uint64_t u64MaxCycles);
+static uint32_t FrameCycles(uint32_t u32Mode);
+static uint16_t SpiDevice(uint16_t u16Tx);
+static void     GpioOut(uint8_t u8Port, uint16_t u16Old, uint16_t u16New);
+static void     OnDone(stc_spi_xfer_t *pstcXfer, uint32_t u32Status, void *pvArg);
+static void     OnDoneResubmit(stc_spi_xfer_t *pstcXfer, uint32_t u32Status, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t        u32ErrCnt = 0u;
+static stc_spi_async_t m_stcAsync;
+
+static stc_frame_t m_astcFrame[FRAME_MAX];
+static uint32_t    m_u32FrameCnt = 0u;
+static uint32_t    m_u32CsMulti  = 0u; /* 同时有多于一个片选有效的次数 */
+static uint32_t    m_u32CsFall   = 0u; /* 片选下降沿数 */
+
+static stc_spi_xfer_t *m_apstcDone[8];
+static uint32_t        m_au32DoneSts[8];
+static uint32_t        m_u32DoneCnt  = 0u;
+static uint32_t        m_u32Resubmit = 0u;
+
+static const uint8_t  m_au8FlashCmd[] = {0x03u, 0x00u, 0x10u, 0x00u};
+static const uint16_t m_au16Lcd[]     = {0x2A00u, 0x0010u, 0x2C00u, 0xF800u};
+static const uint8_t  m_au8Radio[]    = {0x81u, 0x42u, 0x24u, 0x18u, 0x3Cu, 0x7Eu};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32Pin       = CS_ALL;
+    stcGpioInit.bOutputValue = TRUE;
+    GPIO_Init(GPIOA, &stcGpioInit);
+
+    HOST_SpiDeviceSet(SpiDevice);
+    HOST_GpioOutHookSet(GpioOut);
+
+    ParamCheck();
+    QueueCheck();
+    SleepCheck();
+    ResubmitCheck();
+    AbortCheck();
+    OvfCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查、重复初始化、已在队列中的事务再次提交
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_spi_seg_t  stcSeg  = {m_au8FlashCmd, NULL, 4u};
+    stc_spi_seg_t  stcZero = {m_au8FlashCmd, NULL, 0u};
+    stc_spi_xfer_t stcXfer;
+
+    SpiConfig();
+    CHECK(ErrorInvalidParameter == SPI_AsyncInit(SPI, NULL, IrqPriorityLevel2));
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    CHECK(ErrorInvalidMode == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    CHECK(0u == SPI_AsyncPendingGet(&m_stcAsync));
+
+    SPI_XferStcInit(&stcXfer);
+    CHECK(ErrorInvalidParameter == SPI_AsyncSubmit(&m_stcAsync, NULL));
+    CHECK(ErrorInvalidParameter == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    XferSet(&stcXfer, CS_FLASH, SPI_BAUDRATE_PCLK_DIV2, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcZero, 1u);
+    CHECK(ErrorInvalidParameter == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+
+    XferSet(&stcXfer, CS_FLASH, SPI_BAUDRATE_PCLK_DIV2, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcSeg, 1u);
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    CHECK(SPI_XFER_STS_ACTIVE == stcXfer.u32Status);
+    CHECK(ErrorNotReady == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    CHECK(1u == SPI_AsyncPendingGet(&m_stcAsync));
+    CHECK(0u == WaitIdle(10000u));
+    CHECK(SPI_XFER_STS_OK == stcXfer.u32Status);
+    CHECK(1u == m_u32DoneCnt);
+    CHECK(4u == m_u32FrameCnt);
+
+    SPI_AsyncDeInit(&m_stcAsync);
+    CHECK(0u == READ_REG32_BIT(SPI->CR1, SPI_INT_RXNE | SPI_INT_TXE));
+}
+
+/**
+ * @brief  三个设备共用SPI：闪存（模式0、8位、PCLK/2，命令加只读）、显示（CPOL高、CPHA第二沿、16位、
+ *         PCLK/4，只写）、射频（PCLK/8，全双工）依次提交，中断中连续执行
+ * @retval None
+ */
+static void QueueCheck(void)
+{
+    uint8_t        au8FlashRx[8];
+    uint8_t        au8RadioRx[6];
+    stc_spi_seg_t  astcFlash[2];
+    stc_spi_seg_t  stcLcd   = {m_au16Lcd, NULL, 4u};
+    stc_spi_seg_t  stcRadio = {m_au8Radio, au8RadioRx, 6u};
+    stc_spi_xfer_t stcFlash;
+    stc_spi_xfer_t stcLcdXfer;
+    stc_spi_xfer_t stcRadioXfer;
+    uint32_t       u32Mode;
+    uint32_t       u32Gap;
+    uint32_t       i;
+
+    astcFlash[0].pvTx   = m_au8FlashCmd;
+    astcFlash[0].pvRx   = NULL;
+    astcFlash[0].u16Len = 4u;
+    astcFlash[1].pvTx   = NULL;
+    astcFlash[1].pvRx   = au8FlashRx;
+    astcFlash[1].u16Len = 8u;
+    memset(au8FlashRx, 0, sizeof(au8FlashRx));
+    memset(au8RadioRx, 0, sizeof(au8RadioRx));
+
+    SpiConfig();
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+
+    XferSet(&stcFlash, CS_FLASH, SPI_BAUDRATE_PCLK_DIV2, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, astcFlash, 2u);
+    stcFlash.u16Fill = 0xFFu;
+    XferSet(&stcLcdXfer, CS_LCD, SPI_BAUDRATE_PCLK_DIV4, SPI_CLK_POLARITY_HIGH, SPI_CLK_PHASE_2EDGE,
+            SPI_DATA_WIDTH_16BIT, &stcLcd, 1u);
+    XferSet(&stcRadioXfer, CS_RADIO, SPI_BAUDRATE_PCLK_DIV8, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcRadio, 1u);
+
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcFlash));
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcLcdXfer));
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcRadioXfer));
+    CHECK(3u == SPI_AsyncPendingGet(&m_stcAsync));
+    CHECK(SPI_XFER_STS_QUEUED == stcRadioXfer.u32Status);
+    CHECK(0u == WaitIdle(100000u));
+
+    /* 完成顺序、状态 */
+    CHECK(3u == m_u32DoneCnt);
+    CHECK((&stcFlash == m_apstcDone[0]) && (&stcLcdXfer == m_apstcDone[1]) && (&stcRadioXfer == m_apstcDone[2]));
+    CHECK((SPI_XFER_STS_OK == m_au32DoneSts[0]) && (SPI_XFER_STS_OK == m_au32DoneSts[1]) &&
+          (SPI_XFER_STS_OK == m_au32DoneSts[2]));
+    CHECK(3u == m_stcAsync.u32XferCnt);
+    CHECK(0u == m_stcAsync.u32OvfCnt);
+
+    /* 每帧恰有一个片选有效，模式与事务一致 */
+    CHECK(22u == m_u32FrameCnt);
+    CHECK(3u == m_u32CsFall);
+    CHECK(0u == m_u32CsMulti);
+    CHECK(CS_ALL == (HOST_RegRead(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, OUT)) & CS_ALL));
+    for (i = 0u; i < m_u32FrameCnt; i++)
+    {
+        if (i < 12u)
+        {
+            CHECK((CS_ALL & ~CS_FLASH) == (m_astcFrame[i].u16Cs & CS_ALL));
+            CHECK((SPI_BAUDRATE_PCLK_DIV2 | SPI_DATA_WIDTH_8BIT) == m_astcFrame[i].u32Mode);
+            CHECK(((i < 4u) ? m_au8FlashCmd[i] : 0xFFu) == m_astcFrame[i].u16Tx);
+        }
+        else if (i < 16u)
+        {
+            CHECK((CS_ALL & ~CS_LCD) == (m_astcFrame[i].u16Cs & CS_ALL));
+            CHECK((SPI_BAUDRATE_PCLK_DIV4 | SPI_CLK_POLARITY_HIGH | SPI_CLK_PHASE_2EDGE | SPI_DATA_WIDTH_16BIT) ==
+                  m_astcFrame[i].u32Mode);
+            CHECK(m_au16Lcd[i - 12u] == m_astcFrame[i].u16Tx);
+        }
+        else
+        {
+            CHECK((CS_ALL & ~CS_RADIO) == (m_astcFrame[i].u16Cs & CS_ALL));
+            CHECK((SPI_BAUDRATE_PCLK_DIV8 | SPI_DATA_WIDTH_8BIT) == m_astcFrame[i].u32Mode);
+            CHECK(m_au8Radio[i - 16u] == m_astcFrame[i].u16Tx);
+        }
+    }
+    for (i = 0u; i < 8u; i++)
+    {
+        CHECK((uint8_t)(RESP_BASE + 4u + i) == au8FlashRx[i]);
+    }
+    for (i = 0u; i < 6u; i++)
+    {
+        CHECK((uint8_t)(RESP_BASE + 16u + i) == au8RadioRx[i]);
+    }
+
+    /* 事务内帧间隔等于帧时间（总线不空闲） */
+    for (i = 1u; i < m_u32FrameCnt; i++)
+    {
+        if ((12u == i) || (16u == i))
+        {
+            continue;
+        }
+        u32Mode = m_astcFrame[i].u32Mode;
+        u32Gap  = (uint32_t)(m_astcFrame[i].u64Cycle - m_astcFrame[i - 1u].u64Cycle);
+        CHECK(FrameCycles(u32Mode) == u32Gap);
+    }
+    printf("in-transaction frame gaps: flash %u, lcd %u, radio %u cycles (frames %u/%u/%u)\n",
+           (unsigned)(m_astcFrame[11].u64Cycle - m_astcFrame[10].u64Cycle),
+           (unsigned)(m_astcFrame[15].u64Cycle - m_astcFrame[14].u64Cycle),
+           (unsigned)(m_astcFrame[17].u64Cycle - m_astcFrame[16].u64Cycle),
+           (unsigned)FrameCycles(m_astcFrame[0].u32Mode), (unsigned)FrameCycles(m_astcFrame[12].u32Mode),
+           (unsigned)FrameCycles(m_astcFrame[16].u32Mode));
+    printf("transaction switch: flash->lcd %u cycles, lcd->radio %u cycles\n",
+           (unsigned)(m_astcFrame[12].u64Cycle - m_astcFrame[11].u64Cycle - FrameCycles(m_astcFrame[12].u32Mode)),
+           (unsigned)(m_astcFrame[16].u64Cycle - m_astcFrame[15].u64Cycle - FrameCycles(m_astcFrame[16].u32Mode)));
+
+    SPI_AsyncDeInit(&m_stcAsync);
+}
+
+/**
+ * @brief  传输期间CPU休眠：主循环只执行WFI，唤醒次数约为帧数
+ * @retval None
+ */
+static void SleepCheck(void)
+{
+    static uint8_t         au8Tx[64];
+    stc_spi_seg_t          stcSeg = {au8Tx, NULL, 64u};
+    stc_spi_xfer_t         stcXfer;
+    stc_host_access_stat_t stcStat;
+    uint64_t               u64Start;
+    uint64_t               u64Took;
+
+    SpiConfig();
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    XferSet(&stcXfer, CS_RADIO, SPI_BAUDRATE_PCLK_DIV16, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcSeg, 1u);
+
+    HOST_AccessStatClear();
+    u64Start = HOST_CycleGet();
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    CHECK(0u == WaitIdle(100000u));
+    u64Took = HOST_CycleGet() - u64Start;
+    HOST_AccessStatGet(&stcStat);
+
+    CHECK(64u == m_u32FrameCnt);
+    CHECK(u64Took >= 64u * (uint64_t)FrameCycles(SPI_BAUDRATE_PCLK_DIV16 | SPI_DATA_WIDTH_8BIT));
+    CHECK(stcStat.u64SleepCycles * 2u > u64Took);
+    printf("64 bytes at PCLK/16: %u cycles, CPU asleep %u cycles (%u%%), %u WFI\n", (unsigned)u64Took,
+           (unsigned)stcStat.u64SleepCycles, (unsigned)(stcStat.u64SleepCycles * 100u / u64Took),
+           (unsigned)stcStat.u64Wfi);
+
+    SPI_AsyncDeInit(&m_stcAsync);
+}
+
+/**
+ * @brief  完成回调中再次提交同一事务：轮询读取状态寄存器3次
+ * @retval None
+ */
+static void ResubmitCheck(void)
+{
+    static const uint8_t au8Cmd[] = {0x05u, 0xFFu};
+    stc_spi_seg_t        stcSeg   = {au8Cmd, NULL, 2u};
+    stc_spi_xfer_t       stcXfer;
+
+    SpiConfig();
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    XferSet(&stcXfer, CS_FLASH, SPI_BAUDRATE_PCLK_DIV4, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcSeg, 1u);
+    stcXfer.pfnDone = OnDoneResubmit;
+    m_u32Resubmit   = 2u;
+
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    CHECK(0u == WaitIdle(100000u));
+    CHECK(3u == m_u32DoneCnt);
+    CHECK(6u == m_u32FrameCnt);
+    CHECK(3u == m_u32CsFall);
+    CHECK(3u == m_stcAsync.u32XferCnt);
+
+    SPI_AsyncDeInit(&m_stcAsync);
+}
+
+/**
+ * @brief  传输中中止：两个事务都以SPI_XFER_STS_ABORT回调，片选释放，之后可立即提交
+ * @retval None
+ */
+static void AbortCheck(void)
+{
+    static uint8_t au8Rx[64];
+    stc_spi_seg_t  stcRx  = {NULL, au8Rx, 64u};
+    stc_spi_seg_t  stcLcd = {m_au16Lcd, NULL, 4u};
+    stc_spi_xfer_t stcFlash;
+    stc_spi_xfer_t stcLcdXfer;
+    uint32_t       u32Loop = 0u;
+
+    SpiConfig();
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    XferSet(&stcFlash, CS_FLASH, SPI_BAUDRATE_PCLK_DIV8, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcRx, 1u);
+    XferSet(&stcLcdXfer, CS_LCD, SPI_BAUDRATE_PCLK_DIV4, SPI_CLK_POLARITY_HIGH, SPI_CLK_PHASE_2EDGE,
+            SPI_DATA_WIDTH_16BIT, &stcLcd, 1u);
+
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcFlash));
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcLcdXfer));
+    while ((m_u32FrameCnt < 10u) && (u32Loop < 1000u))
+    {
+        __WFI();
+        u32Loop++;
+    }
+    SPI_AsyncAbort(&m_stcAsync);
+
+    CHECK(2u == m_u32DoneCnt);
+    CHECK((&stcFlash == m_apstcDone[0]) && (&stcLcdXfer == m_apstcDone[1]));
+    CHECK((SPI_XFER_STS_ABORT == m_au32DoneSts[0]) && (SPI_XFER_STS_ABORT == m_au32DoneSts[1]));
+    CHECK(0u == SPI_AsyncPendingGet(&m_stcAsync));
+    CHECK(FALSE == SPI->SR_f.BUSY);
+    CHECK(0u == READ_REG32_BIT(SPI->CR1, SPI_INT_RXNE));
+    CHECK(CS_ALL == (HOST_RegRead(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, OUT)) & CS_ALL));
+    /* 中止时发送缓冲中的字仍发出 */
+    CHECK((m_u32FrameCnt >= 10u) && (m_u32FrameCnt <= 12u));
+    CHECK(1u == m_u32CsFall);
+
+    BusClear();
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcLcdXfer));
+    CHECK(0u == WaitIdle(100000u));
+    CHECK(SPI_XFER_STS_OK == m_au32DoneSts[0]);
+    CHECK(4u == m_u32FrameCnt);
+    CHECK(m_au16Lcd[3] == m_astcFrame[3].u16Tx);
+
+    SPI_AsyncDeInit(&m_stcAsync);
+}
+
+/**
+ * @brief  中断响应超过一帧时间：接收上溢，事务以SPI_XFER_STS_OVF完成，丢失的字不写入，其余位置正确
+ * @retval None
+ */
+static void OvfCheck(void)
+{
+    uint8_t        au8Rx[6];
+    stc_spi_seg_t  stcSeg = {m_au8Radio, au8Rx, 6u};
+    stc_spi_xfer_t stcXfer;
+    uint32_t       i;
+
+    SpiConfig();
+    CHECK(Ok == SPI_AsyncInit(SPI, &m_stcAsync, IrqPriorityLevel2));
+    XferSet(&stcXfer, CS_RADIO, SPI_BAUDRATE_PCLK_DIV8, SPI_CLK_POLARITY_LOW, SPI_CLK_PHASE_1EDGE,
+            SPI_DATA_WIDTH_8BIT, &stcSeg, 1u);
+    memset(au8Rx, 0x55, sizeof(au8Rx));
+
+    __disable_irq();
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    HOST_CycleAdvance(4u * FrameCycles(SPI_BAUDRATE_PCLK_DIV8 | SPI_DATA_WIDTH_8BIT));
+    CHECK(TRUE == SPI->SR_f.OVF);
+    __enable_irq();
+    CHECK(0u == WaitIdle(100000u));
+
+    CHECK(1u == m_u32DoneCnt);
+    CHECK(SPI_XFER_STS_OVF == m_au32DoneSts[0]);
+    CHECK(SPI_XFER_STS_OVF == stcXfer.u32Status);
+    CHECK(1u == m_stcAsync.u32OvfCnt);
+    CHECK(6u == m_u32FrameCnt);
+    CHECK(0x55u == au8Rx[0]);
+    for (i = 1u; i < 6u; i++)
+    {
+        CHECK((uint8_t)(RESP_BASE + i) == au8Rx[i]);
+    }
+    CHECK(FALSE == SPI->SR_f.OVF);
+
+    /* 下一个事务不受影响 */
+    BusClear();
+    CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, &stcXfer));
+    CHECK(0u == WaitIdle(100000u));
+    CHECK(SPI_XFER_STS_OK == m_au32DoneSts[0]);
+    CHECK((uint8_t)RESP_BASE == au8Rx[0]);
+
+    SPI_AsyncDeInit(&m_stcAsync);
+}
+
+/**
+ * @brief  SPI复位并配置为主机（PCLK/2、模式0、8位、软件片选），清除总线记录
+ * @retval None
+ */
+static void SpiConfig(void)
+{
+    stc_spi_init_t stcSpiInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SYSCTRL_PeriphReset(PeriphResetSpi);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32BaudRate  = SPI_BAUDRATE_PCLK_DIV2;
+    stcSpiInit.u32Mode      = SPI_MD_MASTER;
+    stcSpiInit.u32DataWidth = SPI_DATA_WIDTH_8BIT;
+    stcSpiInit.u32NSS       = SPI_NSS_HARD_OUTPUT;
+    SPI_Init(SPI, &stcSpiInit);
+
+    BusClear();
+}
+
+/**
+ * @brief  清除总线及完成回调记录
+ * @retval None
+ */
+static void BusClear(void)
+{
+    m_u32FrameCnt = 0u;
+    m_u32CsMulti  = 0u;
+    m_u32CsFall   = 0u;
+    m_u32DoneCnt  = 0u;
+}
+
+/**
+ * @brief  填写事务描述
+ * @retval None
+ */
+static void XferSet(stc_spi_xfer_t *pstcXfer, uint32_t u32CsPin, uint32_t u32BaudRate, uint32_t u32CPOL,
+                    uint32_t u32CPHA, uint32_t u32DataWidth, const stc_spi_seg_t *pstcSeg, uint8_t u8SegNum)
+{
+    SPI_XferStcInit(pstcXfer);
+    pstcXfer->CSx          = GPIOA;
+    pstcXfer->u32CsPin     = u32CsPin;
+    pstcXfer->u32BaudRate  = u32BaudRate;
+    pstcXfer->u32CPOL      = u32CPOL;
+    pstcXfer->u32CPHA      = u32CPHA;
+    pstcXfer->u32DataWidth = u32DataWidth;
+    pstcXfer->pstcSeg      = pstcSeg;
+    pstcXfer->u8SegNum     = u8SegNum;
+    pstcXfer->pfnDone      = OnDone;
+}
+
+/**
+ * @brief  在WFI中等待队列空闲
+ * @param  [in] u64MaxCycles 最长等待周期
+ * @retval uint32_t 未完成的事务数
+ */
+static uint32_t WaitIdle(uint64_t u64MaxCycles)
+{
+    uint64_t u64End = HOST_CycleGet() + u64MaxCycles;
+
+    while ((0u != SPI_AsyncPendingGet(&m_stcAsync)) && (HOST_CycleGet() < u64End))
+    {
+        __WFI();
+    }
+    return SPI_AsyncPendingGet(&m_stcAsync);
+}
+
+/**
+ * @brief  一帧占用的HCLK周期（PCLK = HCLK）
+ * @param  [in] u32Mode BRR/WIDTH配置
+ * @retval uint32_t 周期数
+ */
+static uint32_t FrameCycles(uint32_t u32Mode)
+{
+    uint32_t u32Width = ((u32Mode & SPI_CR0_WIDTH_Msk) >> SPI_CR0_WIDTH_Pos) + 1u;
+    uint32_t u32Div   = 2u << ((u32Mode & SPI_CR0_BRR_Msk) >> SPI_CR0_BRR_Pos);
+
+    return u32Width * u32Div;
+}
+
+/**
+ * @brief  从设备模型：记录帧结束时刻、片选及模式，应答RESP_BASE加帧序号
+ * @param  [in] u16Tx 主机发送
+ * @retval uint16_t 从设备应答
+ */
+static uint16_t SpiDevice(uint16_t u16Tx)
+{
+    uint32_t u32Idx = m_u32FrameCnt;
+
+    if (u32Idx < FRAME_MAX)
+    {
+        m_astcFrame[u32Idx].u64Cycle = HOST_CycleGet();
+        m_astcFrame[u32Idx].u16Cs    = (uint16_t)HOST_RegRead(REG_ADDR(GPIOA_BASE, GPIO_TypeDef, OUT));
+        m_astcFrame[u32Idx].u16Tx    = u16Tx;
+        m_astcFrame[u32Idx].u32Mode  = HOST_RegRead(REG_ADDR(SPI_BASE, SPI_TypeDef, CR0)) & MODE_MSK;
+    }
+    m_u32FrameCnt++;
+    return (uint16_t)(RESP_BASE + u32Idx);
+}
+
+/**
+ * @brief  GPIO输出变化：统计片选下降沿及同时有效
+ * @retval None
+ */
+static void GpioOut(uint8_t u8Port, uint16_t u16Old, uint16_t u16New)
+{
+    uint16_t u16Low = (uint16_t)(~u16New & CS_ALL);
+
+    if (0u != u8Port)
+    {
+        return;
+    }
+    if (0u != (u16Old & ~u16New & CS_ALL))
+    {
+        m_u32CsFall++;
+    }
+    if (0u != (u16Low & (u16Low - 1u)))
+    {
+        m_u32CsMulti++;
+    }
+}
+
+/**
+ * @brief  完成回调：记录顺序及状态
+ * @retval None
+ */
+static void OnDone(stc_spi_xfer_t *pstcXfer, uint32_t u32Status, void *pvArg)
+{
+    (void)pvArg;
+
+    if (m_u32DoneCnt < 8u)
+    {
+        m_apstcDone[m_u32DoneCnt]   = pstcXfer;
+        m_au32DoneSts[m_u32DoneCnt] = u32Status;
+    }
+    m_u32DoneCnt++;
+}
+
+/**
+ * @brief  完成回调：记录后再次提交，共m_u32Resubmit次
+ * @retval None
+ */
+static void OnDoneResubmit(stc_spi_xfer_t *pstcXfer, uint32_t u32Status, void *pvArg)
+{
+    OnDone(pstcXfer, u32Status, pvArg);
+    if (0u != m_u32Resubmit)
+    {
+        m_u32Resubmit--;
+        CHECK(Ok == SPI_AsyncSubmit(&m_stcAsync, pstcXfer));
+    }
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,419 @@
+/**
+ *******************************************************************************
+ * @file  w25q_model.c
+ * @brief Behavioural model of a W25Qxx serial NOR flash attached to the SPI
+ *        master of the host register model: command decoding on SSI chip
+ *        select edges, WEL, BUSY timing, page program wrap, erase types and
+ *        JESD216 SFDP basic parameter table.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdlib.h>
+#include "w25q_model.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define REG_ADDR(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg))
+
+#define SR1_BUSY      (0x01u)
+#define SR1_WEL       (0x02u)
+#define SFDP_SIZE     (0x100u)
+#define SFDP_BFPT     (0x80u) /* 基本参数表地址 */
+#define SFDP_BFPT_DW  (16u)   /* 基本参数表长度（DWORD） */
+#define PAGE_SIZE_MAX (0x100u)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+stc_w25q_model_stat_t stcW25qModelStat;
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t W25qFrame(uint16_t u16Tx);
+static uint32_t W25qSsiWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New);
+static void     W25qCsRise(void);
+static void     W25qSfdpBuild(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_w25q_model_cfg_t m_stcCfg;
+static uint8_t             *m_pu8Mem;
+static uint8_t              m_au8Sfdp[SFDP_SIZE];
+static uint8_t              m_au8Page[PAGE_SIZE_MAX];
+
+static boolean_t m_bCs;        /* 片选有效 */
+static boolean_t m_bIgnore;    /* 本次片选的指令被忽略 */
+static uint32_t  m_u32Idx;     /* 本次片选内的字节序号 */
+static uint8_t   m_u8Cmd;      /* 本次片选的指令 */
+static uint32_t  m_u32Addr;    /* 地址（数据阶段自增） */
+static uint32_t  m_u32ProgLen; /* 页编程数据字节数 */
+static uint8_t   m_u8Wel;
+static uint8_t   m_u8RstEn;
+static uint64_t  m_u64BusyEnd;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  默认配置：W25Q16JV（2MB，256字节页，4K/32K/64K擦除，带SFDP）
+ * @param  [out] pstcCfg 配置
+ * @retval None
+ */
+void W25Q_ModelCfgInit(stc_w25q_model_cfg_t *pstcCfg)
+{
+    pstcCfg->u32JedecId           = 0xEF4015u;
+    pstcCfg->u32Capacity          = 0x200000u;
+    pstcCfg->u32PageSize          = 0x100u;
+    pstcCfg->au8EraseExp[0]       = 12u;
+    pstcCfg->au8EraseCmd[0]       = 0x20u;
+    pstcCfg->au8EraseExp[1]       = 15u;
+    pstcCfg->au8EraseCmd[1]       = 0x52u;
+    pstcCfg->au8EraseExp[2]       = 16u;
+    pstcCfg->au8EraseCmd[2]       = 0xD8u;
+    pstcCfg->au8EraseExp[3]       = 0u;
+    pstcCfg->au8EraseCmd[3]       = 0xFFu;
+    pstcCfg->bSfdp                = TRUE;
+    pstcCfg->u32ProgCycles        = 1600u;    /* 0.4ms@4MHz */
+    pstcCfg->u32SectorEraseCycles = 180000u;  /* 45ms@4MHz */
+    pstcCfg->u32BlockEraseCycles  = 600000u;  /* 150ms@4MHz */
+}
+
+/**
+ * @brief  安装模型：存储阵列全部擦除（0xFF），统计清零，SPI从设备及SSI写钩子指向模型
+ * @note   须在SPI初始化之后调用；SSI清零为片选有效
+ * @param  [in] pstcCfg 配置
+ * @retval en_result_t
+ */
+en_result_t W25Q_ModelInit(const stc_w25q_model_cfg_t *pstcCfg)
+{
+    if ((pstcCfg->u32Capacity > W25Q_MODEL_CAPACITY_MAX) || (pstcCfg->u32PageSize > PAGE_SIZE_MAX)
+        || (0u != (pstcCfg->u32PageSize & (pstcCfg->u32PageSize - 1u))))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    m_stcCfg = *pstcCfg;
+    free(m_pu8Mem);
+    m_pu8Mem = (uint8_t *)malloc(m_stcCfg.u32Capacity);
+    if (NULL == m_pu8Mem)
+    {
+        return Error;
+    }
+    memset(m_pu8Mem, 0xFF, m_stcCfg.u32Capacity);
+    memset(&stcW25qModelStat, 0, sizeof(stcW25qModelStat));
+    W25qSfdpBuild();
+
+    m_bCs        = FALSE;
+    m_u8Wel      = 0u;
+    m_u8RstEn    = 0u;
+    m_u64BusyEnd = 0u;
+
+    HOST_SpiDeviceSet(W25qFrame);
+    return HOST_RegHookSet(REG_ADDR(SPI_BASE, SPI_TypeDef, SSI), NULL, W25qSsiWrite);
+}
+
+/**
+ * @brief  存储阵列后门指针
+ * @retval uint8_t*
+ */
+uint8_t *W25Q_ModelMem(void)
+{
+    return m_pu8Mem;
+}
+
+/**
+ * @brief  编程/擦除进行中
+ * @retval boolean_t
+ */
+boolean_t W25Q_ModelBusy(void)
+{
+    return (HOST_CycleGet() < m_u64BusyEnd) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  SSI写：检测片选边沿
+ */
+static uint32_t W25qSsiWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    boolean_t bCs = (0u == (u32New & SPI_SSI_SSI_Msk)) ? TRUE : FALSE;
+
+    (void)u32Addr;
+    (void)u32Old;
+
+    if ((TRUE == bCs) && (FALSE == m_bCs))
+    {
+        stcW25qModelStat.u32Cs++;
+        m_u32Idx     = 0u;
+        m_bIgnore    = FALSE;
+        m_u32ProgLen = 0u;
+    }
+    else if ((FALSE == bCs) && (TRUE == m_bCs))
+    {
+        W25qCsRise();
+    }
+    m_bCs = bCs;
+
+    return u32New;
+}
+
+/**
+ * @brief  SPI一帧：输入MOSI，返回同一帧的MISO
+ */
+static uint16_t W25qFrame(uint16_t u16Tx)
+{
+    uint8_t  u8Tx  = (uint8_t)u16Tx;
+    uint8_t  u8Out = 0xFFu;
+    uint32_t u32Data;
+
+    if (FALSE == m_bCs)
+    {
+        stcW25qModelStat.u32Stray++;
+        return 0xFFu;
+    }
+    stcW25qModelStat.u32Frames++;
+
+    if (0u == m_u32Idx)
+    {
+        m_u8Cmd   = u8Tx;
+        m_u32Addr = 0u;
+        stcW25qModelStat.au32Cmd[u8Tx]++;
+        if ((TRUE == W25Q_ModelBusy()) && (0x05u != u8Tx))
+        {
+            stcW25qModelStat.u32BusyViolation++;
+            m_bIgnore = TRUE;
+        }
+        m_u32Idx++;
+        return 0xFFu;
+    }
+    if (TRUE == m_bIgnore)
+    {
+        return 0xFFu;
+    }
+
+    /* 地址阶段：第1~3字节 */
+    if ((m_u32Idx <= 3u) && ((0x03u == m_u8Cmd) || (0x0Bu == m_u8Cmd) || (0x5Au == m_u8Cmd) || (0x02u == m_u8Cmd)
+                             || (0x90u == m_u8Cmd) || (0x20u == m_u8Cmd) || (0x52u == m_u8Cmd) || (0xD8u == m_u8Cmd)))
+    {
+        m_u32Addr = (m_u32Addr << 8) | u8Tx;
+        m_u32Idx++;
+        return 0xFFu;
+    }
+
+    switch (m_u8Cmd)
+    {
+        case 0x05u:
+            u8Out = (uint8_t)(((TRUE == W25Q_ModelBusy()) ? SR1_BUSY : 0u) | ((0u != m_u8Wel) ? SR1_WEL : 0u));
+            break;
+        case 0x9Fu:
+            u8Out = (uint8_t)(m_stcCfg.u32JedecId >> (8u * (2u - ((m_u32Idx - 1u) % 3u))));
+            break;
+        case 0x90u:
+            u8Out = (0u == ((m_u32Idx - 4u + (m_u32Addr & 1u)) & 1u)) ? (uint8_t)(m_stcCfg.u32JedecId >> 16)
+                                                                      : (uint8_t)(m_stcCfg.u32JedecId - 1u);
+            break;
+        case 0x03u:
+            u8Out     = m_pu8Mem[m_u32Addr % m_stcCfg.u32Capacity];
+            m_u32Addr = (m_u32Addr + 1u) % m_stcCfg.u32Capacity;
+            stcW25qModelStat.u32ReadBytes++;
+            break;
+        case 0x0Bu:
+            if (m_u32Idx >= 5u) /* 第4字节为空周期 */
+            {
+                u8Out     = m_pu8Mem[m_u32Addr % m_stcCfg.u32Capacity];
+                m_u32Addr = (m_u32Addr + 1u) % m_stcCfg.u32Capacity;
+                stcW25qModelStat.u32ReadBytes++;
+            }
+            break;
+        case 0x5Au:
+            if (m_u32Idx >= 5u)
+            {
+                u8Out = (m_u32Addr < SFDP_SIZE) ? m_au8Sfdp[m_u32Addr] : 0xFFu;
+                m_u32Addr++;
+            }
+            break;
+        case 0x02u:
+            /* 数据先进入页缓冲，超过页末尾时回绕到页首 */
+            u32Data = ((m_u32Addr & (m_stcCfg.u32PageSize - 1u)) + m_u32ProgLen) & (m_stcCfg.u32PageSize - 1u);
+            if ((0u != m_u32ProgLen) && (0u == u32Data))
+            {
+                stcW25qModelStat.u32PageWrap++;
+            }
+            if (m_u32ProgLen < m_stcCfg.u32PageSize)
+            {
+                m_au8Page[u32Data] = 0xFFu;
+            }
+            m_au8Page[u32Data] &= u8Tx;
+            m_u32ProgLen++;
+            stcW25qModelStat.u32ProgBytes++;
+            break;
+        default:
+            break;
+    }
+    m_u32Idx++;
+
+    return u8Out;
+}
+
+/**
+ * @brief  片选上升沿：写使能/复位/编程/擦除指令在此执行
+ */
+static void W25qCsRise(void)
+{
+    uint32_t u32Base;
+    uint32_t u32Size = 0u;
+    uint32_t u32Len;
+    uint32_t i;
+
+    if ((TRUE == m_bIgnore) || (0u == m_u32Idx))
+    {
+        return;
+    }
+
+    if (0x66u != m_u8Cmd)
+    {
+        if ((0x99u == m_u8Cmd) && (0u != m_u8RstEn))
+        {
+            m_u8Wel = 0u;
+        }
+        m_u8RstEn = 0u;
+    }
+
+    switch (m_u8Cmd)
+    {
+        case 0x66u:
+            m_u8RstEn = 1u;
+            break;
+        case 0x06u:
+            m_u8Wel = 1u;
+            break;
+        case 0x04u:
+            m_u8Wel = 0u;
+            break;
+        case 0x02u:
+            if (0u == m_u8Wel)
+            {
+                stcW25qModelStat.u32WelMissing++;
+                break;
+            }
+            if ((m_u32Idx > 4u) && (m_u32Addr < m_stcCfg.u32Capacity))
+            {
+                u32Base = m_u32Addr & ~(m_stcCfg.u32PageSize - 1u);
+                u32Len  = (m_u32ProgLen < m_stcCfg.u32PageSize) ? m_u32ProgLen : m_stcCfg.u32PageSize;
+                for (i = 0u; i < u32Len; i++)
+                {
+                    u32Size = ((m_u32Addr & (m_stcCfg.u32PageSize - 1u)) + i) & (m_stcCfg.u32PageSize - 1u);
+                    m_pu8Mem[u32Base + u32Size] &= m_au8Page[u32Size];
+                }
+                m_u64BusyEnd = HOST_CycleGet() + m_stcCfg.u32ProgCycles;
+            }
+            m_u8Wel = 0u;
+            break;
+        case 0xC7u:
+            if (0u == m_u8Wel)
+            {
+                stcW25qModelStat.u32WelMissing++;
+                break;
+            }
+            memset(m_pu8Mem, 0xFF, m_stcCfg.u32Capacity);
+            m_u64BusyEnd = HOST_CycleGet() + (uint64_t)m_stcCfg.u32BlockEraseCycles * 8u;
+            m_u8Wel      = 0u;
+            break;
+        default:
+            for (i = 0u; i < 4u; i++)
+            {
+                if ((0u != m_stcCfg.au8EraseExp[i]) && (m_u8Cmd == m_stcCfg.au8EraseCmd[i]))
+                {
+                    u32Size = 1uL << m_stcCfg.au8EraseExp[i];
+                }
+            }
+            if ((0u == u32Size) || (4u != m_u32Idx))
+            {
+                break;
+            }
+            if (0u == m_u8Wel)
+            {
+                stcW25qModelStat.u32WelMissing++;
+                break;
+            }
+            u32Base = (m_u32Addr % m_stcCfg.u32Capacity) & ~(u32Size - 1u);
+            memset(&m_pu8Mem[u32Base], 0xFF, u32Size);
+            m_u64BusyEnd = HOST_CycleGet() + ((u32Size <= 0x1000u) ? m_stcCfg.u32SectorEraseCycles : m_stcCfg.u32BlockEraseCycles);
+            m_u8Wel      = 0u;
+            break;
+    }
+}
+
+/**
+ * @brief  生成SFDP：头（签名、版本1.6、1个参数头），基本参数表在0x80，16个DWORD
+ *         （DWORD2容量，DWORD8/9擦除类型，DWORD11页尺寸），其余为0xFF
+ */
+static void W25qSfdpBuild(void)
+{
+    uint32_t au32Dw[SFDP_BFPT_DW];
+    uint32_t u32Exp;
+    uint32_t i;
+
+    memset(m_au8Sfdp, 0xFF, sizeof(m_au8Sfdp));
+    if (FALSE == m_stcCfg.bSfdp)
+    {
+        return;
+    }
+
+    m_au8Sfdp[0]  = 'S';
+    m_au8Sfdp[1]  = 'F';
+    m_au8Sfdp[2]  = 'D';
+    m_au8Sfdp[3]  = 'P';
+    m_au8Sfdp[4]  = 0x06u; /* 次版本 */
+    m_au8Sfdp[5]  = 0x01u; /* 主版本 */
+    m_au8Sfdp[6]  = 0x00u; /* 参数头个数-1 */
+    m_au8Sfdp[8]  = 0x00u; /* 参数ID LSB：基本参数表 */
+    m_au8Sfdp[9]  = 0x06u;
+    m_au8Sfdp[10] = 0x01u;
+    m_au8Sfdp[11] = SFDP_BFPT_DW;
+    m_au8Sfdp[12] = SFDP_BFPT;
+    m_au8Sfdp[13] = 0x00u;
+    m_au8Sfdp[14] = 0x00u;
+    m_au8Sfdp[15] = 0xFFu; /* 参数ID MSB */
+
+    memset(au32Dw, 0xFF, sizeof(au32Dw));
+    au32Dw[0] = 0xFFF920E5u;
+    au32Dw[1] = (m_stcCfg.u32Capacity * 8u) - 1u;
+    au32Dw[7] = m_stcCfg.au8EraseExp[0] | ((uint32_t)m_stcCfg.au8EraseCmd[0] << 8) | ((uint32_t)m_stcCfg.au8EraseExp[1] << 16)
+                | ((uint32_t)m_stcCfg.au8EraseCmd[1] << 24);
+    au32Dw[8] = m_stcCfg.au8EraseExp[2] | ((uint32_t)m_stcCfg.au8EraseCmd[2] << 8) | ((uint32_t)m_stcCfg.au8EraseExp[3] << 16)
+                | ((uint32_t)m_stcCfg.au8EraseCmd[3] << 24);
+    for (u32Exp = 0u; (1uL << u32Exp) < m_stcCfg.u32PageSize; u32Exp++)
+    {
+        ;
+    }
+    au32Dw[10] = (au32Dw[10] & ~0xF0u) | (u32Exp << 4);
+
+    for (i = 0u; i < SFDP_BFPT_DW; i++)
+    {
+        m_au8Sfdp[SFDP_BFPT + (4u * i)]      = (uint8_t)au32Dw[i];
+        m_au8Sfdp[SFDP_BFPT + (4u * i) + 1u] = (uint8_t)(au32Dw[i] >> 8);
+        m_au8Sfdp[SFDP_BFPT + (4u * i) + 2u] = (uint8_t)(au32Dw[i] >> 16);
+        m_au8Sfdp[SFDP_BFPT + (4u * i) + 3u] = (uint8_t)(au32Dw[i] >> 24);
+    }
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
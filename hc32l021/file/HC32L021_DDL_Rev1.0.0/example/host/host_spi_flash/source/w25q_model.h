@@ -0,0 +1,96 @@
+/**
+ *******************************************************************************
+ * @file  w25q_model.h
+ * @brief Behavioural model of a W25Qxx serial NOR flash attached to the SPI
+ *        master of the host register model.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __W25Q_MODEL_H__
+#define __W25Q_MODEL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  W25Q模型配置
+ */
+typedef struct
+{
+    uint32_t  u32JedecId;           /*!< JEDEC ID（0x9F返回的3字节） */
+    uint32_t  u32Capacity;          /*!< 容量（字节） */
+    uint32_t  u32PageSize;          /*!< 页尺寸（字节，2的幂） */
+    uint8_t   au8EraseExp[4];       /*!< SFDP擦除类型1~4的尺寸2^N，0表示不支持 */
+    uint8_t   au8EraseCmd[4];       /*!< SFDP擦除类型1~4的指令 */
+    boolean_t bSfdp;                /*!< FALSE: SFDP读出全为0xFF */
+    uint32_t  u32ProgCycles;        /*!< 页编程忙时间（HCLK周期） */
+    uint32_t  u32SectorEraseCycles; /*!< 4KB擦除忙时间（HCLK周期） */
+    uint32_t  u32BlockEraseCycles;  /*!< 大于4KB的擦除忙时间（HCLK周期） */
+} stc_w25q_model_cfg_t;
+
+/**
+ * @brief  W25Q模型统计
+ */
+typedef struct
+{
+    uint32_t u32Cs;            /*!< 片选次数 */
+    uint32_t u32Frames;        /*!< 片选有效时的帧数 */
+    uint32_t u32Stray;         /*!< 片选无效时的帧数 */
+    uint32_t au32Cmd[256];     /*!< 各指令次数 */
+    uint32_t u32ReadBytes;     /*!< 读出的数据字节数（READ/FAST_READ） */
+    uint32_t u32ProgBytes;     /*!< 页编程数据字节数 */
+    uint32_t u32PageWrap;      /*!< 页编程数据超过页末尾回绕次数 */
+    uint32_t u32BusyViolation; /*!< 忙期间收到非读状态寄存器指令的次数（指令被忽略） */
+    uint32_t u32WelMissing;    /*!< WEL未置位时的编程/擦除指令次数 */
+} stc_w25q_model_stat_t;
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define W25Q_MODEL_CAPACITY_MAX (0x1000000u) /*!< 最大容量16MB（3字节地址） */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+extern stc_w25q_model_stat_t stcW25qModelStat; /* 模型统计，可由测试直接清零 */
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+void        W25Q_ModelCfgInit(stc_w25q_model_cfg_t *pstcCfg);     /* 默认配置：W25Q16JV */
+en_result_t W25Q_ModelInit(const stc_w25q_model_cfg_t *pstcCfg); /* 安装模型（SPI从设备及SSI片选钩子） */
+uint8_t    *W25Q_ModelMem(void);                                 /* 存储阵列后门指针 */
+boolean_t   W25Q_ModelBusy(void);                                /* 编程/擦除进行中 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __W25Q_MODEL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,379 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the W25Qxx LRU read cache
+ *        (hit/miss, LRU replacement, write/erase invalidation) against a W25Q
+ *        behavioural model on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "spi.h"
+#include "w25q_model.h"
+#include "w25qxx.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define LINE_NUM    (8u) /* 8行共2112字节 */
+#define RAM_BUDGET  (6u * 1024u)
+#define LINE        (W25QXX_CACHE_LINE_SIZE)
+#define META_ROUNDS (50u)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void      HitMissCheck(void);
+static void      LruCheck(void);
+static void      WriteInvalidateCheck(void);
+static void      EraseInvalidateCheck(void);
+static void      BypassCheck(void);
+static void      MetadataBench(void);
+static void      FlashStart(void);
+static void      Pattern(uint32_t u32Addr, uint32_t u32Size, uint8_t u8Seed);
+static boolean_t Cached(uint32_t u32Addr);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt = 0u;
+
+static stc_w25qxx_cache_line_t m_astcLine[LINE_NUM];
+static uint8_t                 m_au8Buf[2u * LINE];
+static uint8_t                 m_au8Ref[2u * LINE];
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    CHECK(sizeof(m_astcLine) <= (RAM_BUDGET / 2u));
+
+    HitMissCheck();
+    LruCheck();
+    WriteInvalidateCheck();
+    EraseInvalidateCheck();
+    BypassCheck();
+    MetadataBench();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  命中/未命中：首次读入整行（一次FAST_READ），之后同一行不访问总线；跨行读分行计数；
+ *         越界参数被拒绝；W25QXX_Init()使全部缓存行失效
+ * @retval None
+ */
+static void HitMissCheck(void)
+{
+    stc_w25qxx_cache_stat_t stcStat;
+    uint32_t                i;
+
+    FlashStart();
+    Pattern(0x100u, LINE, 0x10u);
+
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x120u, 32u));
+    CHECK(0 == memcmp(m_au8Buf, &m_au8Ref[0x20u], 32u));
+    CHECK(1u == stcW25qModelStat.u32Cs);
+    CHECK(LINE == stcW25qModelStat.u32ReadBytes);
+    for (i = 0u; i < 10u; i++)
+    {
+        CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x100u + (i * 16u), 16u));
+        CHECK(0 == memcmp(m_au8Buf, &m_au8Ref[i * 16u], 16u));
+    }
+    CHECK(1u == stcW25qModelStat.u32Cs);
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK((10u == stcStat.u32Hit) && (1u == stcStat.u32Miss) && (0u == stcStat.u32Evict));
+
+    /* 跨两行：0x100行命中，0x200行未命中 */
+    Pattern(0x1F0u, 32u, 0x20u);
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x1F0u, 32u));
+    CHECK(0 != memcmp(m_au8Buf, m_au8Ref, 16u)); /* 后门修改未经驱动，命中行仍为旧数据 */
+    CHECK(0 == memcmp(&m_au8Buf[16u], &m_au8Ref[16u], 16u));
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK((11u == stcStat.u32Hit) && (2u == stcStat.u32Miss));
+    W25QXX_CacheInvalidate(0x1FFu, 1u);
+    CHECK(FALSE == Cached(0x100u));
+    CHECK(TRUE == Cached(0x200u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x1F0u, 32u));
+    CHECK(0 == memcmp(m_au8Buf, m_au8Ref, 32u));
+
+    /* 容量末尾一行 */
+    Pattern(0x200000u - LINE, LINE, 0x30u);
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x200000u - 8u, 8u));
+    CHECK(0 == memcmp(m_au8Buf, &m_au8Ref[LINE - 8u], 8u));
+    CHECK(W25QXX_ERROR == W25QXX_CacheRead(m_au8Buf, 0x200000u - 8u, 9u));
+    CHECK(W25QXX_ERROR == W25QXX_CacheRead(m_au8Buf, 0x200001u, 0u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x200000u, 0u));
+
+    CHECK(W25QXX_OK == W25QXX_Init());
+    for (i = 0u; i < LINE_NUM; i++)
+    {
+        CHECK(W25QXX_CACHE_TAG_INVALID == m_astcLine[i].u32Tag);
+    }
+    W25QXX_CacheStatClear();
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK((0u == stcStat.u32Hit) && (0u == stcStat.u32Miss) && (0u == stcStat.u32Evict));
+}
+
+/**
+ * @brief  LRU：缓存满后替换最久未访问的行，最近访问过的行保留
+ * @retval None
+ */
+static void LruCheck(void)
+{
+    stc_w25qxx_cache_stat_t stcStat;
+    uint32_t                i;
+
+    FlashStart();
+    for (i = 0u; i < LINE_NUM; i++)
+    {
+        CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, i * 0x1000u, 4u));
+    }
+    /* 访问第0行，此时最久未访问的是第1行 */
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0u, 4u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, LINE_NUM * 0x1000u, 4u));
+    CHECK(TRUE == Cached(0u));
+    CHECK(FALSE == Cached(0x1000u));
+    CHECK(TRUE == Cached(0x2000u));
+    CHECK(TRUE == Cached(LINE_NUM * 0x1000u));
+
+    /* 再读入一行替换第2行 */
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x1000u, 4u));
+    CHECK(FALSE == Cached(0x2000u));
+    CHECK(TRUE == Cached(0x3000u));
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK((1u == stcStat.u32Hit) && ((LINE_NUM + 2u) == stcStat.u32Miss) && (2u == stcStat.u32Evict));
+}
+
+/**
+ * @brief  写穿：W25QXX_Write()使重叠的缓存行失效，之后读到新数据；其他行仍命中
+ * @retval None
+ */
+static void WriteInvalidateCheck(void)
+{
+    uint32_t i;
+
+    FlashStart();
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x10000u, 2u * LINE));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x20000u, 4u));
+    CHECK(0xFFu == m_au8Buf[0]);
+
+    for (i = 0u; i < 8u; i++)
+    {
+        m_au8Ref[i] = (uint8_t)(0xA0u + i);
+    }
+    CHECK(W25QXX_OK == W25QXX_Write(m_au8Ref, 0x100FCu, 8u)); /* 跨0x10000、0x10100两行 */
+    CHECK(FALSE == Cached(0x10000u));
+    CHECK(FALSE == Cached(0x10100u));
+    CHECK(TRUE == Cached(0x20000u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x100FCu, 8u));
+    CHECK(0 == memcmp(m_au8Buf, m_au8Ref, 8u));
+
+    /* 整行刚好在写入范围之外时不失效 */
+    CHECK(W25QXX_OK == W25QXX_Write(m_au8Ref, 0x10200u, 4u));
+    CHECK(TRUE == Cached(0x10000u));
+    CHECK(TRUE == Cached(0x10100u));
+}
+
+/**
+ * @brief  擦除：W25QXX_EraseStart()使扇区内的缓存行失效；擦除期间其他行命中照常返回，
+ *         未命中返回W25QXX_BUSY；完成后读到0xFF
+ * @retval None
+ */
+static void EraseInvalidateCheck(void)
+{
+    FlashStart();
+    Pattern(0x3000u, LINE, 0x40u);
+    Pattern(0x4000u, LINE, 0x50u);
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x3000u, 16u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x4000u, 16u));
+
+    CHECK(W25QXX_OK == W25QXX_EraseStart(0x3000u, 0x1000u, NULL));
+    CHECK(FALSE == Cached(0x3000u));
+    CHECK(TRUE == Cached(0x4000u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x4000u, 16u));
+    CHECK(0 == memcmp(m_au8Buf, m_au8Ref, 16u));
+    CHECK(W25QXX_BUSY == W25QXX_CacheRead(m_au8Buf, 0x3000u, 16u));
+    CHECK(FALSE == Cached(0x3000u));
+    while (W25QXX_BUSY == W25QXX_ErasePoll())
+    {
+        ;
+    }
+
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x3000u, 16u));
+    CHECK((0xFFu == m_au8Buf[0]) && (0xFFu == m_au8Buf[15]));
+    CHECK(W25QXX_OK == W25QXX_BlockErase(0x4000u));
+    CHECK(FALSE == Cached(0x4000u));
+}
+
+/**
+ * @brief  不使用缓存：W25QXX_CacheInit(NULL, 0)后W25QXX_CacheRead()直接读取flash，不计数
+ * @retval None
+ */
+static void BypassCheck(void)
+{
+    stc_w25qxx_cache_stat_t stcStat;
+
+    FlashStart();
+    W25QXX_CacheInit(NULL, 0u);
+    Pattern(0x5000u, 16u, 0x60u);
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x5000u, 16u));
+    CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, 0x5000u, 16u));
+    CHECK(0 == memcmp(m_au8Buf, m_au8Ref, 16u));
+    CHECK(2u == stcW25qModelStat.u32Cs);
+    CHECK(16u * 2u == stcW25qModelStat.u32ReadBytes);
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK((0u == stcStat.u32Hit) && (0u == stcStat.u32Miss));
+}
+
+/**
+ * @brief  元数据反复读取：配置页及4个索引页，每轮各读一次32字节，比较直接读取与经缓存读取的片选次数、
+ *         SPI字节数及CPU周期
+ * @retval None
+ */
+static void MetadataBench(void)
+{
+    static const uint32_t au32Addr[] = {0x0u, 0x1000u, 0x1100u, 0x8000u, 0x8040u, 0x1F000u};
+    stc_w25qxx_cache_stat_t stcStat;
+    uint64_t                au64Cycle[2];
+    uint32_t                au32Cs[2];
+    uint32_t                au32Bytes[2];
+    uint64_t                u64Start;
+    uint32_t                u32Pass;
+    uint32_t                u32Round;
+    uint32_t                i;
+
+    for (u32Pass = 0u; u32Pass < 2u; u32Pass++)
+    {
+        FlashStart();
+        if (0u == u32Pass)
+        {
+            W25QXX_CacheInit(NULL, 0u);
+        }
+        u64Start = HOST_CycleGet();
+        for (u32Round = 0u; u32Round < META_ROUNDS; u32Round++)
+        {
+            for (i = 0u; i < ARRAY_SZ(au32Addr); i++)
+            {
+                CHECK(W25QXX_OK == W25QXX_CacheRead(m_au8Buf, au32Addr[i], 32u));
+            }
+        }
+        au64Cycle[u32Pass] = HOST_CycleGet() - u64Start;
+        au32Cs[u32Pass]    = stcW25qModelStat.u32Cs;
+        au32Bytes[u32Pass] = stcW25qModelStat.u32ReadBytes;
+    }
+
+    W25QXX_CacheStatGet(&stcStat);
+    CHECK(5u == stcStat.u32Miss); /* 0x8000与0x8040同一行 */
+    CHECK(((META_ROUNDS * ARRAY_SZ(au32Addr)) - 5u) == stcStat.u32Hit);
+    CHECK(0u == stcStat.u32Evict);
+    CHECK((META_ROUNDS * ARRAY_SZ(au32Addr)) == au32Cs[0]);
+    CHECK(5u == au32Cs[1]);
+    CHECK((au64Cycle[1] * 5u) < au64Cycle[0]);
+    printf("metadata %u reads: uncached %u CS %u bytes %u cycles, cached (%u lines, %u bytes RAM) %u CS %u bytes %u cycles\n",
+           (unsigned)(META_ROUNDS * ARRAY_SZ(au32Addr)), (unsigned)au32Cs[0], (unsigned)au32Bytes[0],
+           (unsigned)au64Cycle[0], (unsigned)LINE_NUM, (unsigned)sizeof(m_astcLine), (unsigned)au32Cs[1],
+           (unsigned)au32Bytes[1], (unsigned)au64Cycle[1]);
+}
+
+/**
+ * @brief  配置SPI主机，安装W25Q16模型，初始化驱动及缓存，模型统计清零
+ * @retval None
+ */
+static void FlashStart(void)
+{
+    stc_spi_init_t       stcSpiInit;
+    stc_w25q_model_cfg_t stcCfg;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SYSCTRL_PeriphReset(PeriphResetSpi);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32BaudRate  = SPI_BAUDRATE_PCLK_DIV2;
+    stcSpiInit.u32Mode      = SPI_MD_MASTER;
+    stcSpiInit.u32DataWidth = SPI_DATA_WIDTH_8BIT;
+    stcSpiInit.u32NSS       = SPI_NSS_HARD_OUTPUT;
+    SPI_Init(SPI, &stcSpiInit);
+    SPI_FlagClearALL(SPI);
+    SPI_Enable(SPI);
+    W25QXX_Disable();
+
+    W25Q_ModelCfgInit(&stcCfg);
+    CHECK(Ok == W25Q_ModelInit(&stcCfg));
+    CHECK(W25QXX_OK == W25QXX_Init());
+    W25QXX_CacheInit(m_astcLine, LINE_NUM);
+    memset(&stcW25qModelStat, 0, sizeof(stcW25qModelStat));
+}
+
+/**
+ * @brief  以后门写入测试数据，并复制到m_au8Ref
+ * @retval None
+ */
+static void Pattern(uint32_t u32Addr, uint32_t u32Size, uint8_t u8Seed)
+{
+    uint32_t i;
+
+    for (i = 0u; i < u32Size; i++)
+    {
+        m_au8Ref[i]                  = (uint8_t)(u8Seed + (i * 13u) + (i >> 8));
+        W25Q_ModelMem()[u32Addr + i] = m_au8Ref[i];
+    }
+}
+
+/**
+ * @brief  地址所在行是否在缓存中
+ * @retval boolean_t
+ */
+static boolean_t Cached(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0u; i < LINE_NUM; i++)
+    {
+        if ((u32Addr & ~(LINE - 1u)) == m_astcLine[i].u32Tag)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
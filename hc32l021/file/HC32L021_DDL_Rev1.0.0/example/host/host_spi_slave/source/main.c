@@ -0,0 +1,459 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the double-buffered interrupt driven
+ *        SPI slave (SPI_SlaveStreamInit, buffer swap on NSS rising edge,
+ *        overrun and underflow accounting) on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "spi.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BUF_SIZE   (16u)
+#define XFER_MAX   (32u)
+#define FRAME_SLOW (64u) /* 8位帧，SCLK = HCLK/8 */
+#define SETUP      (20u) /* NSS下降沿到第一个时钟 */
+#define FILL       (0xEEu)
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void ParamCheck(void);
+static void StreamCheck(void);
+static void LengthCheck(void);
+static void DropCheck(void);
+static void OvfCheck(void);
+static void RateCheck(void);
+static void SpiConfig(void);
+static void SlaveStart(boolean_t bRelease);
+static void MasterXfer(uint32_t u32Seed, uint32_t u32Len, uint32_t u32FrameCycles);
+static void MasterStart(uint32_t u32Seed, uint32_t u32Len, uint32_t u32FrameCycles);
+static void MasterWait(void);
+static void OnDone(uint8_t u8Buf, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t        u32ErrCnt = 0u;
+static stc_spi_slave_t m_stcSlave;
+
+static uint8_t m_au8Rx[2][BUF_SIZE];
+static uint8_t m_au8Tx[2][BUF_SIZE];
+
+/* 外部主机 */
+static uint16_t m_au16Mosi[XFER_MAX];
+static uint16_t m_au16Miso[XFER_MAX];
+
+/* 完成回调记录 */
+static boolean_t m_bRelease = TRUE; /* 回调中校验后立即归还 */
+static uint32_t  m_u32DoneCnt;
+static uint8_t   m_u8DoneBuf;
+static uint16_t  m_u16DoneLen;
+static uint32_t  m_u32DoneSts;
+static uint32_t  m_u32Seed;     /* 本次主机发送的数据种子 */
+static uint32_t  m_u32BadData;  /* 状态为OK但数据错误的缓冲数 */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < BUF_SIZE; i++)
+    {
+        m_au8Tx[0][i] = (uint8_t)(0x10u + i);
+        m_au8Tx[1][i] = (uint8_t)(0x80u + i);
+    }
+
+    ParamCheck();
+    StreamCheck();
+    LengthCheck();
+    DropCheck();
+    OvfCheck();
+    RateCheck();
+
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  参数检查、非从机模式、NSS有效时初始化、重复初始化、归还未交出的缓冲
+ * @retval None
+ */
+static void ParamCheck(void)
+{
+    stc_spi_slave_init_t stcInit;
+    stc_spi_init_t       stcSpiInit;
+
+    SpiConfig();
+    SPI_SlaveStreamStcInit(&stcInit);
+    CHECK(ErrorInvalidParameter == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+    stcInit.apvRx[0] = m_au8Rx[0];
+    stcInit.apvRx[1] = m_au8Rx[1];
+    CHECK(ErrorInvalidParameter == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+    stcInit.u16Size = BUF_SIZE;
+    CHECK(ErrorInvalidParameter == SPI_SlaveStreamInit(SPI, NULL, &stcInit, IrqPriorityLevel1));
+
+    /* 主机模式 */
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32Mode = SPI_MD_MASTER;
+    SPI_Init(SPI, &stcSpiInit);
+    CHECK(ErrorInvalidMode == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+
+    /* NSS有效 */
+    SpiConfig();
+    CHECK(Ok == HOST_SpiExtMasterXfer(NULL, NULL, 0u, FRAME_SLOW, 1000u));
+    CHECK(SPI_NSS_EXTERN_INPUT_LOW_LEVEL == SPI_NSSExternInputGet(SPI));
+    CHECK(ErrorNotReady == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+    HOST_CycleAdvance(1000u); /* 未使能中断，不能以WFI等待 */
+    CHECK(FALSE == HOST_SpiExtMasterBusy());
+    CHECK(SPI_NSS_EXTERN_INPUT_HIGH_LEVEL == SPI_NSSExternInputGet(SPI));
+
+    CHECK(Ok == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+    CHECK(ErrorInvalidMode == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+    CHECK(ErrorInvalidParameter == SPI_SlaveStreamRelease(&m_stcSlave, 2u));
+    CHECK(ErrorInvalidMode == SPI_SlaveStreamRelease(&m_stcSlave, 0u));
+    SPI_SlaveStreamDeInit(&m_stcSlave);
+    CHECK(0u == READ_REG32_BIT(SPI->CR1, SPI_INT_RXNE | SPI_INT_SSR));
+}
+
+/**
+ * @brief  连续6次片选：缓冲0/1交替交出，接收数据正确，主机收到的是同下标发送缓冲的数据；
+ *         应用在主循环中处理并归还前一个缓冲时另一个缓冲继续接收
+ * @retval None
+ */
+static void StreamCheck(void)
+{
+    uint32_t i;
+    uint32_t u32Xfer;
+
+    SlaveStart(FALSE);
+    for (u32Xfer = 0u; u32Xfer < 6u; u32Xfer++)
+    {
+        MasterStart(u32Xfer * 7u, BUF_SIZE, FRAME_SLOW);
+
+        /* 主循环处理前一个缓冲：在本次片选进行中归还 */
+        while (m_stcSlave.u32RxPos < 4u)
+        {
+            __WFI();
+        }
+        CHECK(TRUE == HOST_SpiExtMasterBusy());
+        if (0u != u32Xfer)
+        {
+            CHECK(Ok == SPI_SlaveStreamRelease(&m_stcSlave, (uint8_t)((u32Xfer - 1u) & 1u)));
+        }
+        MasterWait();
+
+        CHECK(u32Xfer + 1u == m_u32DoneCnt);
+        CHECK((u32Xfer & 1u) == m_u8DoneBuf);
+        CHECK(BUF_SIZE == m_u16DoneLen);
+        CHECK(SPI_SLAVE_STS_OK == m_u32DoneSts);
+        for (i = 0u; i < BUF_SIZE; i++)
+        {
+            CHECK(m_au8Tx[u32Xfer & 1u][i] == m_au16Miso[i]);
+        }
+    }
+    CHECK(0u == m_u32BadData);
+    CHECK(6u == m_stcSlave.u32FrameCnt);
+    CHECK((0u == m_stcSlave.u32DropCnt) && (0u == m_stcSlave.u32OvfCnt) && (0u == m_stcSlave.u32UdfCnt));
+
+    SPI_SlaveStreamDeInit(&m_stcSlave);
+}
+
+/**
+ * @brief  主机读取少于及多于缓冲长度：预装未发出的字被清空，下一次片选从发送缓冲第一个字开始；
+ *         超出部分接收丢弃、发送填充值
+ * @retval None
+ */
+static void LengthCheck(void)
+{
+    uint32_t i;
+
+    SlaveStart(TRUE);
+
+    MasterXfer(3u, 10u, FRAME_SLOW);
+    CHECK(10u == m_u16DoneLen);
+    CHECK(SPI_SLAVE_STS_OK == m_u32DoneSts);
+    for (i = 0u; i < 10u; i++)
+    {
+        CHECK(m_au8Tx[0][i] == m_au16Miso[i]);
+    }
+
+    MasterXfer(5u, BUF_SIZE + 4u, FRAME_SLOW);
+    CHECK(1u == m_u8DoneBuf);
+    CHECK(BUF_SIZE == m_u16DoneLen);
+    CHECK(SPI_SLAVE_STS_TRUNC == m_u32DoneSts);
+    for (i = 0u; i < BUF_SIZE + 4u; i++)
+    {
+        CHECK(((i < BUF_SIZE) ? m_au8Tx[1][i] : FILL) == m_au16Miso[i]);
+    }
+
+    /* 片选期间无时钟：不交出缓冲 */
+    MasterXfer(0u, 0u, FRAME_SLOW);
+    CHECK(2u == m_u32DoneCnt);
+
+    MasterXfer(9u, 2u, FRAME_SLOW);
+    CHECK((3u == m_u32DoneCnt) && (0u == m_u8DoneBuf) && (2u == m_u16DoneLen));
+    CHECK((m_au8Tx[0][0] == m_au16Miso[0]) && (m_au8Tx[0][1] == m_au16Miso[1]));
+    CHECK(0u == m_u32BadData);
+
+    SPI_SlaveStreamDeInit(&m_stcSlave);
+}
+
+/**
+ * @brief  应用未归还缓冲：第二次片选起丢弃并计数，归还后恢复
+ * @retval None
+ */
+static void DropCheck(void)
+{
+    SlaveStart(FALSE);
+
+    MasterXfer(1u, 8u, FRAME_SLOW);
+    MasterXfer(2u, 8u, FRAME_SLOW);
+    MasterXfer(3u, 8u, FRAME_SLOW);
+    CHECK(1u == m_u32DoneCnt);
+    CHECK(0u == m_u8DoneBuf);
+    CHECK(2u == m_stcSlave.u32DropCnt);
+
+    CHECK(Ok == SPI_SlaveStreamRelease(&m_stcSlave, 0u));
+    CHECK(ErrorInvalidMode == SPI_SlaveStreamRelease(&m_stcSlave, 0u));
+    MasterXfer(4u, 8u, FRAME_SLOW);
+    CHECK(2u == m_u32DoneCnt);
+    CHECK(1u == m_u8DoneBuf);
+    CHECK(SPI_SLAVE_STS_OK == m_u32DoneSts);
+    CHECK(0u == m_u32BadData);
+
+    SPI_SlaveStreamDeInit(&m_stcSlave);
+}
+
+/**
+ * @brief  中断被屏蔽超过一帧：上溢计数并在状态中报告，丢失的字之外数据位置不变，下一次片选正常
+ * @retval None
+ */
+static void OvfCheck(void)
+{
+    uint32_t i;
+
+    SlaveStart(TRUE);
+    memset(m_au8Rx[0], 0, BUF_SIZE);
+
+    /* 第2帧结束时第1帧数据未读出 */
+    __disable_irq();
+    m_u32Seed = 0x20u;
+    for (i = 0u; i < 8u; i++)
+    {
+        m_au16Mosi[i] = (uint16_t)(0x20u + i);
+    }
+    CHECK(Ok == HOST_SpiExtMasterXfer(m_au16Mosi, m_au16Miso, 8u, FRAME_SLOW, SETUP));
+    HOST_CycleAdvance(SETUP + (2u * FRAME_SLOW) + (FRAME_SLOW / 2u));
+    CHECK(TRUE == SPI->SR_f.OVF);
+    __enable_irq();
+    while (TRUE == HOST_SpiExtMasterBusy())
+    {
+        __WFI();
+    }
+    HOST_IrqDispatch();
+
+    CHECK(1u == m_u32DoneCnt);
+    CHECK(8u == m_u16DoneLen);
+    CHECK(0u != (SPI_SLAVE_STS_OVF & m_u32DoneSts));
+    CHECK(1u == m_stcSlave.u32OvfCnt);
+    CHECK(0u == m_au8Rx[0][0]);
+    for (i = 1u; i < 8u; i++)
+    {
+        CHECK((uint8_t)(0x20u + i) == m_au8Rx[0][i]);
+    }
+
+    MasterXfer(0x40u, BUF_SIZE, FRAME_SLOW);
+    CHECK(SPI_SLAVE_STS_OK == m_u32DoneSts);
+    CHECK(0u == m_u32BadData);
+
+    SPI_SlaveStreamDeInit(&m_stcSlave);
+}
+
+/**
+ * @brief  逐步提高SCLK：中断跟不上时上溢/下溢被计数并报告，状态为OK的缓冲数据始终正确
+ * @retval None
+ */
+static void RateCheck(void)
+{
+    static const uint32_t au32Frame[] = {64u, 48u, 32u, 24u, 16u};
+    uint32_t              i;
+    uint32_t              u32Xfer;
+
+    for (i = 0u; i < ARRAY_SZ(au32Frame); i++)
+    {
+        SlaveStart(TRUE);
+        for (u32Xfer = 0u; u32Xfer < 8u; u32Xfer++)
+        {
+            MasterXfer(u32Xfer, BUF_SIZE, au32Frame[i]);
+        }
+        CHECK(8u == m_u32DoneCnt);
+        CHECK(0u == m_u32BadData);
+        if (au32Frame[i] >= 32u)
+        {
+            CHECK((0u == m_stcSlave.u32OvfCnt) && (0u == m_stcSlave.u32UdfCnt));
+        }
+        printf("frame %2u cycles (SCLK HCLK/%u): %u buffers, overrun %u, underflow %u\n", (unsigned)au32Frame[i],
+               (unsigned)(au32Frame[i] / 8u), (unsigned)m_stcSlave.u32FrameCnt, (unsigned)m_stcSlave.u32OvfCnt,
+               (unsigned)m_stcSlave.u32UdfCnt);
+        SPI_SlaveStreamDeInit(&m_stcSlave);
+    }
+}
+
+/**
+ * @brief  SPI复位并配置为从机（模式0、8位、NSS管脚输入）
+ * @retval None
+ */
+static void SpiConfig(void)
+{
+    stc_spi_init_t stcSpiInit;
+
+    SYSCTRL_PeriphClockEnable(PeriphClockSpi);
+    SYSCTRL_PeriphReset(PeriphResetSpi);
+
+    SPI_StcInit(&stcSpiInit);
+    stcSpiInit.u32Mode      = SPI_MD_SLAVE;
+    stcSpiInit.u32DataWidth = SPI_DATA_WIDTH_8BIT;
+    stcSpiInit.u32NSS       = SPI_NSS_HARD_INPUT;
+    SPI_Init(SPI, &stcSpiInit);
+}
+
+/**
+ * @brief  配置SPI并开始双缓冲收发
+ * @param  [in] bRelease TRUE: 完成回调中立即归还缓冲
+ * @retval None
+ */
+static void SlaveStart(boolean_t bRelease)
+{
+    stc_spi_slave_init_t stcInit;
+
+    SpiConfig();
+    SPI_SlaveStreamStcInit(&stcInit);
+    stcInit.apvRx[0] = m_au8Rx[0];
+    stcInit.apvRx[1] = m_au8Rx[1];
+    stcInit.apvTx[0] = m_au8Tx[0];
+    stcInit.apvTx[1] = m_au8Tx[1];
+    stcInit.u16Size  = BUF_SIZE;
+    stcInit.u16Fill  = FILL;
+    stcInit.pfnDone  = OnDone;
+    CHECK(Ok == SPI_SlaveStreamInit(SPI, &m_stcSlave, &stcInit, IrqPriorityLevel1));
+
+    m_bRelease    = bRelease;
+    m_u32DoneCnt  = 0u;
+    m_u32BadData  = 0u;
+}
+
+/**
+ * @brief  外部主机发送u32Len个字（种子加序号），等待NSS上升沿中断处理完
+ * @retval None
+ */
+static void MasterXfer(uint32_t u32Seed, uint32_t u32Len, uint32_t u32FrameCycles)
+{
+    MasterStart(u32Seed, u32Len, u32FrameCycles);
+    MasterWait();
+}
+
+/**
+ * @brief  外部主机开始发送u32Len个字（种子加序号）
+ * @retval None
+ */
+static void MasterStart(uint32_t u32Seed, uint32_t u32Len, uint32_t u32FrameCycles)
+{
+    uint32_t i;
+
+    m_u32Seed = u32Seed;
+    for (i = 0u; i < u32Len; i++)
+    {
+        m_au16Mosi[i] = (uint16_t)((u32Seed + i) & 0xFFu);
+    }
+    memset(m_au16Miso, 0, sizeof(m_au16Miso));
+    CHECK(Ok == HOST_SpiExtMasterXfer(m_au16Mosi, m_au16Miso, u32Len, u32FrameCycles, SETUP));
+}
+
+/**
+ * @brief  在WFI中等待外部主机传输结束及NSS上升沿中断处理完，再保持片选无效SETUP个周期
+ * @retval None
+ */
+static void MasterWait(void)
+{
+    while (TRUE == HOST_SpiExtMasterBusy())
+    {
+        __WFI();
+    }
+    HOST_IrqDispatch();
+    HOST_CycleAdvance(SETUP); /* 片选无效时间 */
+}
+
+/**
+ * @brief  接收完成回调：记录并校验数据，按需立即归还
+ * @retval None
+ */
+static void OnDone(uint8_t u8Buf, uint16_t u16Len, uint32_t u32Status, void *pvArg)
+{
+    uint32_t i;
+
+    (void)pvArg;
+
+    m_u32DoneCnt++;
+    m_u8DoneBuf  = u8Buf;
+    m_u16DoneLen = u16Len;
+    m_u32DoneSts = u32Status;
+    if (SPI_SLAVE_STS_OK == (u32Status & ~SPI_SLAVE_STS_TRUNC))
+    {
+        for (i = 0u; i < u16Len; i++)
+        {
+            if ((uint8_t)(m_u32Seed + i) != m_au8Rx[u8Buf][i])
+            {
+                m_u32BadData++;
+                break;
+            }
+        }
+    }
+    if (TRUE == m_bRelease)
+    {
+        (void)SPI_SlaveStreamRelease(&m_stcSlave, u8Buf);
+    }
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,236 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the 64-bit SysTick time base
+ *        (DDL_TickGet/DDL_TimeUsGet) running on the host register model
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TICK_OVERHEAD (64u) /* 单次DDL_TickGet()总线访问消耗的模拟周期上限 */
+
+#define CHECK(x)                                                   \
+    do                                                             \
+    {                                                              \
+        if (!(x))                                                  \
+        {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #x);    \
+            u32ErrCnt++;                                           \
+        }                                                          \
+    } while (0)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void TickTrack(uint32_t u32Step, uint32_t u32Loop);
+static void ConvertCheck(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t u32ErrCnt     = 0u;
+static uint32_t u32SysTickCnt = 0u;
+static volatile uint32_t u32IrqTest = 0u;  /* 非0时在下一次SysTick中断中执行延时测试 */
+static uint64_t u64IrqDelay         = 0u;  /* 中断中DDL_Delay1ms(5)消耗的周期 */
+static uint64_t u64IrqDeadline      = 0u;  /* 中断中2000us超时到期消耗的周期 */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint64_t u64Tick;
+    uint64_t u64Us;
+    uint64_t u64Start;
+    uint32_t u32Mode;
+
+    /* 1. SystemInit()默认配置（溢出中断未使能）：跨越24位回绕 */
+    TickTrack(1000000u, 40u);
+    u64Us = DDL_TimeUsGet();
+    CHECK(((DDL_TickGet() / (SystemCoreClock / 1000000u)) - u64Us) < TICK_OVERHEAD);
+
+    /* 2. 切换为1ms溢出中断，时基保持连续 */
+    u64Tick = DDL_TickGet();
+    CHECK(Ok == DDL_TickInit(SystemCoreClock / 1000u));
+    CHECK((DDL_TickGet() - u64Tick) < TICK_OVERHEAD);
+    CHECK(ErrorInvalidParameter == DDL_TickInit(0x1000001u));
+    TickTrack(1500u, 200u);
+    printf("SysTick irq: %u\n", (unsigned)u32SysTickCnt);
+    CHECK(u32SysTickCnt >= 74u);
+
+    /* 3. 关中断期间溢出：挂起标志参与计算，不回退 */
+    __disable_irq();
+    u64Tick = DDL_TickGet();
+    HOST_CycleAdvance(SystemCoreClock / 1000u + 500u);
+    CHECK((DDL_TickGet() - u64Tick) >= (SystemCoreClock / 1000u + 500u));
+    __enable_irq();
+    CHECK((DDL_TickGet() - u64Tick) < (SystemCoreClock / 1000u + 500u + 2u * TICK_OVERHEAD));
+
+    /* 4. 延时函数基于时基 */
+    u64Start = HOST_CycleGet();
+    DDL_Delay1ms(3u);
+    printf("DDL_Delay1ms(3): %llu cycles\n", (unsigned long long)(HOST_CycleGet() - u64Start));
+    CHECK((HOST_CycleGet() - u64Start) >= (3u * SystemCoreClock / 1000u));
+    CHECK((HOST_CycleGet() - u64Start) < (3u * SystemCoreClock / 1000u + 4u * TICK_OVERHEAD));
+    u64Start = HOST_CycleGet();
+    DDL_Delay10us(5u);
+    CHECK((HOST_CycleGet() - u64Start) >= (50u * (SystemCoreClock / 1000000u)));
+
+    /* 5. 在SysTick中断中延时及判断超时（溢出中断无法响应），忙等及休眠模式下时基照常前进 */
+    for (u32Mode = DDL_DELAY_MD_BUSY; u32Mode <= DDL_DELAY_MD_SLEEP; u32Mode++)
+    {
+        CHECK(Ok == DDL_DelayModeSet(u32Mode));
+        u64IrqDelay    = 0u;
+        u64IrqDeadline = 0u;
+        u32IrqTest     = 1u;
+        while (0u != u32IrqTest)
+        {
+            __WFI();
+        }
+        printf("irq mode %u: DDL_Delay1ms(5) %llu cycles, deadline 2000us %llu cycles\n", (unsigned)u32Mode,
+               (unsigned long long)u64IrqDelay, (unsigned long long)u64IrqDeadline);
+        CHECK(u64IrqDelay >= (5u * SystemCoreClock / 1000u));
+        CHECK(u64IrqDelay < (5u * SystemCoreClock / 1000u + 4u * TICK_OVERHEAD));
+        CHECK(u64IrqDeadline >= (2u * SystemCoreClock / 1000u));
+        CHECK(u64IrqDeadline < (2u * SystemCoreClock / 1000u + 4u * TICK_OVERHEAD));
+    }
+    CHECK(Ok == DDL_DelayModeSet(DDL_DELAY_MD_BUSY));
+
+    /* 6. 微秒时间：HCLK改变后从当前时间继续 */
+    u64Us = DDL_TimeUsGet();
+    HOST_CycleAdvance(SystemCoreClock / 1000u - 100u);
+    CHECK((DDL_TimeUsGet() - u64Us) >= 975u);
+    CHECK((DDL_TimeUsGet() - u64Us) <= 1000u + TICK_OVERHEAD);
+    u64Us           = DDL_TimeUsGet();
+    SystemCoreClock = 2000000u;
+    CHECK(DDL_TimeUsGet() >= u64Us);
+    u64Us = DDL_TimeUsGet();
+    HOST_CycleAdvance(1000u);
+    CHECK((DDL_TimeUsGet() - u64Us) >= 500u);
+    CHECK((DDL_TimeUsGet() - u64Us) < 500u + TICK_OVERHEAD);
+    SystemCoreClockUpdate();
+
+    ConvertCheck();
+
+    printf("time %llu us, tick %llu\n", (unsigned long long)DDL_TimeUsGet(), (unsigned long long)DDL_TickGet());
+    printf("%s (%u errors)\n", (0u == u32ErrCnt) ? "PASS" : "FAIL", (unsigned)u32ErrCnt);
+
+    return (0u == u32ErrCnt) ? 0 : 1;
+}
+
+/**
+ * @brief  SysTick中断服务函数（时基累加在其之前由SysTick_Handler()完成）
+ * @retval None
+ */
+void SysTick_IRQHandler(void)
+{
+    stc_ddl_deadline_t stcDeadline;
+    uint64_t           u64Start;
+
+    u32SysTickCnt++;
+    if (0u != u32IrqTest)
+    {
+        u64Start = HOST_CycleGet();
+        DDL_Delay1ms(5u);
+        u64IrqDelay = HOST_CycleGet() - u64Start;
+
+        /* 超时上限4ms，防止时基停止时测试无法结束 */
+        u64Start = HOST_CycleGet();
+        DDL_DeadlineInit(&stcDeadline, 2000u);
+        while ((FALSE == DDL_DeadlineExpired(&stcDeadline)) && ((HOST_CycleGet() - u64Start) < (4u * SystemCoreClock / 1000u)))
+        {
+            ;
+        }
+        u64IrqDeadline = HOST_CycleGet() - u64Start;
+        u32IrqTest     = 0u;
+    }
+}
+
+/**
+ * @brief  推进模拟时间并检查时基增量与模拟周期一致、单调
+ * @param  [in] u32Step 每次推进的周期
+ * @param  [in] u32Loop 次数
+ * @retval None
+ */
+static void TickTrack(uint32_t u32Step, uint32_t u32Loop)
+{
+    uint64_t u64Tick0  = DDL_TickGet();
+    uint64_t u64Cycle0 = HOST_CycleGet();
+    uint64_t u64Last   = u64Tick0;
+    uint64_t u64Tick;
+    uint64_t u64Cycle;
+    int64_t  i64Diff;
+    uint32_t i;
+
+    for (i = 0u; i < u32Loop; i++)
+    {
+        HOST_CycleAdvance(u32Step);
+        u64Tick  = DDL_TickGet();
+        u64Cycle = HOST_CycleGet();
+        /* 读VAL的时刻在总线访问序列中的位置不同，允许少量周期偏差 */
+        i64Diff = (int64_t)((u64Cycle - u64Cycle0) - (u64Tick - u64Tick0));
+        CHECK(u64Tick > u64Last);
+        CHECK((i64Diff > -(int64_t)TICK_OVERHEAD) && (i64Diff < (int64_t)TICK_OVERHEAD));
+        u64Last = u64Tick;
+    }
+    printf("track %u x %u cycles: tick +%llu\n", (unsigned)u32Loop, (unsigned)u32Step, (unsigned long long)(u64Last - u64Tick0));
+}
+
+/**
+ * @brief  微秒/时基计数换算
+ * @retval None
+ */
+static void ConvertCheck(void)
+{
+    uint32_t u32Hclk = SystemCoreClock;
+
+    SystemCoreClock = 48000000u;
+    CHECK(0u == DDL_TickToUs(47u));
+    CHECK(1u == DDL_TickToUs(48u));
+    CHECK(1000000000000ull == DDL_TickToUs(48000000000000ull));
+    CHECK(48u == DDL_UsToTick(1u));
+    CHECK(0xFFFFFFFFull * 48u == DDL_UsToTick(0xFFFFFFFFull));
+
+    SystemCoreClock = 32768u;
+    CHECK(1000000u == DDL_TickToUs(32768u));
+    CHECK(30u == DDL_TickToUs(1u));
+    CHECK(DDL_UsToTick(1000000u) >= 32768u);
+    CHECK(DDL_UsToTick(1000000u) <= 32769u);
+    CHECK(1u == DDL_UsToTick(1u));
+
+    SystemCoreClock = 6000000u;
+    CHECK(333333u == DDL_TickToUs(1999999u));
+    CHECK(6000u == DDL_UsToTick(1000u));
+
+    SystemCoreClock = u32Hclk;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
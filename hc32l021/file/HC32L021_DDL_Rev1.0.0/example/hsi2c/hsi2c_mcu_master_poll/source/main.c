@@ -41,7 +41,7 @@
 /* Config address mode */
 #define HSI2C_ADDR_MD (HSI2C_ADDR_MD_7BIT)
 
-#define TRANS_TIMEOUT (0xFFFFFFFFu) /* 传输超时保护计数值 */
+#define TRANS_TIMEOUT (DDL_TIMEOUT_FOREVER) /* 传输超时时间（us），不超时 */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
@@ -88,7 +88,7 @@ int32_t main(void)
     Hsi2cMasterWriteConfig();
 
     /* 主机轮询传输 */
-    HSI2C_MasterTransferPoll(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
+    HSI2C_MasterTransferPollTimeoutUs(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
@@ -102,7 +102,7 @@ int32_t main(void)
     Hsi2cMasterReadConfig();
 
     /* 主机轮询传输 */
-    HSI2C_MasterTransferPoll(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
+    HSI2C_MasterTransferPollTimeoutUs(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
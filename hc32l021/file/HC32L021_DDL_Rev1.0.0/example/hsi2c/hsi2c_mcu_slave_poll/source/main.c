@@ -31,7 +31,7 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
-#define TRANS_TIMEOUT (0xFFFFFFFFu) /* 传输超时保护计数值 */
+#define TRANS_TIMEOUT (DDL_TIMEOUT_FOREVER) /* 传输超时时间（us），不超时 */
 #define TRANS_SIZE    (30)          /* 传输字节数 */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
@@ -78,7 +78,7 @@ int32_t main(void)
     /* HSI2C配置：从机读 */
     Hsi2cSlaveReadConfig();
     /* 从机轮询传输 */
-    HSI2C_SlaveTransferPoll(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
+    HSI2C_SlaveTransferPollTimeoutUs(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
@@ -88,7 +88,7 @@ int32_t main(void)
     /* HSI2C配置：从机写 */
     Hsi2cSlaveWriteConfig();
     /* 从机轮询传输 */
-    HSI2C_SlaveTransferPoll(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
+    HSI2C_SlaveTransferPollTimeoutUs(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
@@ -36,7 +36,7 @@
 #define DEVICE_PAGE_SIZE (8u)               /* 设备页字节长度 */
 #define TRANS_SIZE       (DEVICE_PAGE_SIZE) /* 传输字节数 */
 
-#define TRANS_TIMEOUT    (0xFFFFFFFFu) /* 传输超时保护计数值 */
+#define TRANS_TIMEOUT    (DDL_TIMEOUT_FOREVER) /* 传输超时时间（us），不超时 */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
@@ -83,7 +83,7 @@ int32_t main(void)
     Hsi2cMasterWriteConfig();
 
     /* 主机轮询传输 */
-    HSI2C_MasterTransferPoll(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
+    HSI2C_MasterTransferPollTimeoutUs(HSI2C, u8WriteData, sizeof(u8WriteData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
@@ -97,7 +97,7 @@ int32_t main(void)
     Hsi2cMasterReadConfig();
 
     /* 主机轮询传输 */
-    HSI2C_MasterTransferPoll(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
+    HSI2C_MasterTransferPollTimeoutUs(HSI2C, u8ReadData, sizeof(u8ReadData), TRANS_TIMEOUT);
 
     while (stcHsi2cCom.enComStatus == Hsi2cComBusy)
     {
@@ -0,0 +1,161 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of LPUART auto-baud detection: the first
+ *        sync byte 0xF0 from the master is measured by ATIM3 PWC on RXD
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define DEFAULT_BAUD (9600u) /* 检测前及LPUART_Init()的波特率 */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void GpioConfig(void);
+static void LpUartConfig(void);
+static void AutoBaudConfig(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_lpuart_autobaud_t stcAutoBaud;
+static const uint32_t        u32BaudList[] = {1200u, 2400u, 4800u, 9600u, 19200u, 38400u, 57600u, 115200u};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint8_t u8Data;
+
+    /* 端口配置 */
+    GpioConfig();
+
+    /* LPUART配置 */
+    LpUartConfig();
+
+    /* 自动波特率检测：同步字节的起始位加低4位为5位低电平 */
+    AutoBaudConfig();
+
+    /* 等待检测完成，检测期间接收禁止 */
+    while (0u == stcAutoBaud.u32Baud)
+    {
+        __WFI();
+    }
+
+    while (1)
+    {
+        /* 按检测到的波特率原样返回收到的数据 */
+        if (TRUE == LPUART_IntFlagGet(LPUART1, LPUART_FLAG_RC))
+        {
+            u8Data = LPUART_ReceiveInt(LPUART1);
+            LPUART_IntFlagClear(LPUART1, LPUART_FLAG_RC);
+            LPUART_TransmitPoll(LPUART1, &u8Data, 1u);
+        }
+    }
+}
+
+/**
+ * @brief  自动波特率检测配置
+ * @retval None
+ */
+static void AutoBaudConfig(void)
+{
+    stc_lpuart_autobaud_init_t stcAbInit;
+
+    /* ATIM3测量RXD低电平宽度 */
+    SYSCTRL_PeriphClockEnable(PeriphClockAtim3);
+
+    LPUART_AutoBaudStcInit(&stcAbInit);                      /* 结构体初始化：同步字节0xF0，偏差3% */
+    stcAbInit.u32Pclk      = SYSCTRL_HclkFreqGet();          /* ATIM3计数时钟及LPUART传输时钟 */
+    stcAbInit.u32BaudMin   = 1200u;                          /* 最低波特率     */
+    stcAbInit.u32BaudMax   = 115200u;                        /* 最高波特率     */
+    stcAbInit.pu32BaudList = u32BaudList;                    /* 标准波特率表   */
+    stcAbInit.u16BaudNum   = ARRAY_SZ(u32BaudList);
+    LPUART_AutoBaudStart(LPUART1, &stcAutoBaud, &stcAbInit, IrqPriorityLevel2);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                      /* 结构体初始化 */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;         /* 1停止位      */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR; /* 数据8位     */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;         /* 收发模式     */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;      /* 传输时钟源   */
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();     /* HCLK获取     */
+    stcLpuartInit.stcBaudRate.u32Baud       = DEFAULT_BAUD;              /* 缺省波特率   */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    /* 配置PA02为LPUART1_RX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_02;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA02_AF_LPUART1_RXD();
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
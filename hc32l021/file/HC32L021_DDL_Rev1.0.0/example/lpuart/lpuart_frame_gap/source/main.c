@@ -0,0 +1,194 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of LPUART frame reception delimited by
+ *        inter-frame gap (Modbus RTU t1.5/t3.5)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "btim.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define FRAME_BAUD     (9600u)
+#define FRAME_BUF_SIZE (2u * 64u) /* 两个64字节帧缓冲 */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void GpioConfig(void);
+static void LpUartConfig(void);
+static void FrameConfig(void);
+static void OnFrame(uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_lpuart_frame_t stcFrame;
+static uint8_t            u8FrameBuf[FRAME_BUF_SIZE];
+static uint8_t *volatile  pu8RxFrame = NULL;
+static volatile uint16_t  u16RxLen   = 0u;
+static volatile uint32_t  u32RxStatus;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint8_t *pu8Data;
+
+    /* 端口配置 */
+    GpioConfig();
+
+    /* LPUART配置 */
+    LpUartConfig();
+
+    /* 帧间隔接收配置：字节接收在中断中完成，t3.5静默后回调 */
+    FrameConfig();
+
+    while (1)
+    {
+        /* 休眠直至收到完整帧：中断返回后继续休眠，帧回调清除SLEEPONEXIT后返回主循环 */
+        SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+        __WFI();
+
+        pu8Data = pu8RxFrame;
+        if (NULL != pu8Data)
+        {
+            pu8RxFrame = NULL;
+            /* 状态正常的帧原样发回 */
+            if (LPUART_FRAME_STS_OK == u32RxStatus)
+            {
+                LPUART_TransmitPoll(LPUART1, pu8Data, u16RxLen);
+            }
+            /* 归还帧缓冲，另一个帧缓冲在此期间继续接收 */
+            LPUART_FrameRelease(&stcFrame, pu8Data);
+        }
+    }
+}
+
+/**
+ * @brief  帧回调（BTIM中断中调用）：记录帧并唤醒主循环
+ * @param  [in] pu8Data   帧缓冲
+ * @param  [in] u16Len    帧长度
+ * @param  [in] u32Status 帧状态 @ref LPUART_Frame_Status
+ * @param  [in] pvArg     回调参数
+ * @retval None
+ */
+static void OnFrame(uint8_t *pu8Data, uint16_t u16Len, uint32_t u32Status, void *pvArg)
+{
+    (void)pvArg;
+
+    u16RxLen    = u16Len;
+    u32RxStatus = u32Status;
+    pu8RxFrame  = pu8Data;
+
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+}
+
+/**
+ * @brief  帧间隔接收配置
+ * @retval None
+ */
+static void FrameConfig(void)
+{
+    stc_lpuart_frame_init_t stcFrameInit;
+
+    /* CTIMER0作为BTIM0~2使用 */
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+
+    LPUART_FrameStcInit(&stcFrameInit);                                            /* 结构体初始化   */
+    stcFrameInit.BTIMx        = BTIM0;                                             /* 帧间隔定时器   */
+    stcFrameInit.u32Pclk      = SYSCTRL_HclkFreqGet();                             /* 定时器计数时钟 */
+    stcFrameInit.u32Baud      = FRAME_BAUD;                                        /* 波特率         */
+    stcFrameInit.u32EndGapUs  = LPUART_FRAME_GAP_US(FRAME_BAUD, LPUART_FRAME_T35); /* 帧结束t3.5     */
+    stcFrameInit.u32CharGapUs = LPUART_FRAME_GAP_US(FRAME_BAUD, LPUART_FRAME_T15); /* 帧内t1.5       */
+    stcFrameInit.pu8Buf       = u8FrameBuf;                                        /* 接收缓冲       */
+    stcFrameInit.u16BufSize   = FRAME_BUF_SIZE;                                    /* 接收缓冲长度   */
+    stcFrameInit.pfnFrame     = OnFrame;                                           /* 帧回调         */
+    stcFrameInit.pvArg        = NULL;
+    LPUART_FrameInit(LPUART1, &stcFrame, &stcFrameInit, IrqPriorityLevel3);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                      /* 结构体初始化 */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;         /* 1停止位      */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR; /* 数据8位     */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;         /* 收发模式     */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;      /* 传输时钟源   */
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();     /* HCLK获取     */
+    stcLpuartInit.stcBaudRate.u32Baud       = FRAME_BAUD;                /* 波特率       */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    /* 配置PA02为LPUART1_RX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_02;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA02_AF_LPUART1_RXD();
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,172 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART single-wire half-duplex
+ *        transaction engine: a command is sent and the response received on
+ *        one wire, interrupt driven, with the turnaround time measured
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "sysctrl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define CMD_LEN    4u    /* 命令长度 */
+#define RESP_LEN   4u    /* 应答长度 */
+#define RESP_TMO   5000u /* 应答超时时间（us），从命令最后一个停止位起计算 */
+#define CMD_PERIOD 100u  /* 命令周期（ms） */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void GpioConfig(void);
+static void LpUartConfig(void);
+static void XferDone(uint32_t u32Status, uint16_t u16RxLen, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_lpuart_hd_t stcHd;
+static uint8_t         u8Cmd[CMD_LEN]   = {0xA5u, 0x01u, 0x00u, 0x00u};
+uint8_t                u8Resp[RESP_LEN] = {0};
+volatile uint32_t      u32OkCnt         = 0u; /* 正常应答次数 */
+volatile uint32_t      u32TimeoutCnt    = 0u; /* 超时次数 */
+volatile uint32_t      u32ErrCnt        = 0u; /* 总线冲突或应答错误次数 */
+volatile uint32_t      u32TurnUs        = 0u; /* 最近一次应答时间（us） */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_ddl_deadline_t stcPeriod;
+
+    /* 端口配置 */
+    GpioConfig();
+
+    /* LPUART配置 */
+    LpUartConfig();
+
+    /* 单线半双工事务：使能单线模式及接收，注册中断回调 */
+    LPUART_HdInit(LPUART1, &stcHd, XferDone, NULL, IrqPriorityLevel3);
+
+    DDL_DeadlineInit(&stcPeriod, CMD_PERIOD * 1000u);
+    while (1)
+    {
+        /* 等待应答期间检查超时 */
+        if (0u != (LPUART_HD_STS_BUSY & LPUART_HdPoll(&stcHd)))
+        {
+            continue;
+        }
+
+        if (TRUE == DDL_DeadlineExpired(&stcPeriod))
+        {
+            DDL_DeadlineInit(&stcPeriod, CMD_PERIOD * 1000u);
+            u8Cmd[2]++;
+            u8Cmd[3] = (uint8_t)(u8Cmd[0] ^ u8Cmd[1] ^ u8Cmd[2]);
+            (void)LPUART_HdXfer(&stcHd, u8Cmd, CMD_LEN, u8Resp, RESP_LEN, RESP_TMO);
+        }
+    }
+}
+
+/**
+ * @brief  事务完成回调：统计结果，记录应答时间（命令最后一个停止位到第一个应答字节接收完成）
+ * @param  [in] u32Status 事务状态 @ref LPUART_Hd_Status
+ * @param  [in] u16RxLen 收到的应答字节数
+ * @param  [in] pvArg 回调参数
+ * @retval None
+ */
+static void XferDone(uint32_t u32Status, uint16_t u16RxLen, void *pvArg)
+{
+    (void)u16RxLen;
+    (void)pvArg;
+
+    if (LPUART_HD_STS_OK == u32Status)
+    {
+        u32OkCnt++;
+        u32TurnUs = (uint32_t)DDL_TickToUs(stcHd.u32TurnTicks);
+    }
+    else if (0u != (u32Status & LPUART_HD_STS_TIMEOUT))
+    {
+        u32TimeoutCnt++;
+    }
+    else
+    {
+        u32ErrCnt++;
+    }
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                      /* 结构体初始化 */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;         /* 1停止位      */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR; /* 数据8位      */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;         /* 收发模式     */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;      /* 传输时钟源   */
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();     /* HCLK获取     */
+    stcLpuartInit.stcBaudRate.u32Baud       = 9600;                      /* 波特率       */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX，开漏输出，收发共用 */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_OD;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,339 @@
+/**
+ *******************************************************************************
+ * @file  log_dec.c
+ * @brief This file provides the host decoder of the deferred binary log
+ *        (ddl_log): SLIP deframing, LEB128 parsing and text formatting.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "log_dec.h"
+
+/**
+ * @addtogroup LOG_DEC
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup LOG_DEC_Local_Macros LOG_DEC局部宏定义
+ * @{
+ */
+/* SLIP分帧（RFC 1055），与ddl_log.c一致 */
+#define LOG_SLIP_END     (0xC0u)
+#define LOG_SLIP_ESC     (0xDBu)
+#define LOG_SLIP_ESC_END (0xDCu)
+#define LOG_SLIP_ESC_ESC (0xDDu)
+
+#define LOG_SPEC_MAX (16u) /* 单个转换说明的最大长度 */
+/**
+ * @}
+ */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t LogVarintGet(const uint8_t *pu8Data, uint32_t u32Len, uint32_t *pu32Pos, uint32_t *pu32Value);
+static uint32_t LogFormat(char *pcText, uint32_t u32Size, const char *pcFmt, const uint32_t *pu32Arg, uint32_t u32Argc);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup LOG_DEC_Global_Functions LOG_DEC全局函数定义
+ * @{
+ */
+
+/**
+ * @brief  日志解码器初始化
+ * @param  [out] pstcDec 解码器 @ref stc_log_dec_t
+ * @param  [in] ppcFmt 格式字符串表：以DDL_LOG_FMT_STR展开，与目标板使用同一份表
+ * @param  [in] u32FmtNum 格式字符串个数
+ * @retval en_result_t
+ *           - Ok: 初始化成功
+ *           - ErrorInvalidParameter: 参数错误
+ */
+en_result_t LOG_DecodeInit(stc_log_dec_t *pstcDec, const char *const *ppcFmt, uint32_t u32FmtNum)
+{
+    if ((NULL == pstcDec) || ((NULL == ppcFmt) && (0u != u32FmtNum)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    pstcDec->ppcFmt     = ppcFmt;
+    pstcDec->u32FmtNum  = u32FmtNum;
+    pstcDec->u32Len     = 0u;
+    pstcDec->bEsc       = FALSE;
+    pstcDec->bOverflow  = FALSE;
+    pstcDec->u32RecCnt  = 0u;
+    pstcDec->u32ErrCnt  = 0u;
+    pstcDec->u32DropCnt = 0u;
+
+    return Ok;
+}
+
+/**
+ * @brief  输入一字节：记录结束时按格式字符串还原文本（不含换行）
+ * @note   无法解码的记录（长度错误、未知ID、帧同步前的残余字节）输出"<...>"提示并计入u32ErrCnt；
+ *         DDL_LOG_ID_DROP记录输出"<n log records dropped>"并计入u32DropCnt
+ * @param  [in] pstcDec 解码器 @ref stc_log_dec_t
+ * @param  [in] u8Byte 输入字节
+ * @param  [out] pcText 文本缓冲，总以'\0'结束
+ * @param  [in] u32Size 文本缓冲长度（不为0）
+ * @retval uint32_t 文本长度，0表示记录未结束
+ */
+uint32_t LOG_Decode(stc_log_dec_t *pstcDec, uint8_t u8Byte, char *pcText, uint32_t u32Size)
+{
+    uint32_t au32Arg[DDL_LOG_ARG_MAX];
+    uint32_t u32Id;
+    uint32_t u32Argc = 0u;
+    uint32_t u32Pos  = 0u;
+    uint32_t u32Ret;
+    int32_t  i32Len;
+
+    if (LOG_SLIP_END != u8Byte)
+    {
+        if (TRUE == pstcDec->bEsc)
+        {
+            pstcDec->bEsc = FALSE;
+            u8Byte        = (LOG_SLIP_ESC_END == u8Byte) ? LOG_SLIP_END : ((LOG_SLIP_ESC_ESC == u8Byte) ? LOG_SLIP_ESC : u8Byte);
+        }
+        else if (LOG_SLIP_ESC == u8Byte)
+        {
+            pstcDec->bEsc = TRUE;
+            return 0u;
+        }
+        else
+        {
+            ;
+        }
+
+        if (pstcDec->u32Len < sizeof(pstcDec->au8Rec))
+        {
+            pstcDec->au8Rec[pstcDec->u32Len] = u8Byte;
+            pstcDec->u32Len++;
+        }
+        else
+        {
+            pstcDec->bOverflow = TRUE;
+        }
+        return 0u;
+    }
+
+    /* 空帧（同步用的帧结束符） */
+    if ((0u == pstcDec->u32Len) && (FALSE == pstcDec->bOverflow))
+    {
+        pstcDec->bEsc = FALSE;
+        return 0u;
+    }
+
+    u32Ret = (TRUE == pstcDec->bOverflow) ? 0u : LogVarintGet(pstcDec->au8Rec, pstcDec->u32Len, &u32Pos, &u32Id);
+    while ((0u != u32Ret) && (u32Pos < pstcDec->u32Len))
+    {
+        if (u32Argc >= DDL_LOG_ARG_MAX)
+        {
+            u32Ret = 0u;
+            break;
+        }
+        u32Ret = LogVarintGet(pstcDec->au8Rec, pstcDec->u32Len, &u32Pos, &au32Arg[u32Argc]);
+        u32Argc++;
+    }
+
+    if (0u == u32Ret)
+    {
+        pstcDec->u32ErrCnt++;
+        i32Len = snprintf(pcText, u32Size, "<bad log record, %u bytes>", (unsigned)pstcDec->u32Len);
+    }
+    else if ((DDL_LOG_ID_DROP == u32Id) && (1u == u32Argc))
+    {
+        pstcDec->u32DropCnt += au32Arg[0];
+        i32Len = snprintf(pcText, u32Size, "<%u log records dropped>", (unsigned)au32Arg[0]);
+    }
+    else if (u32Id >= pstcDec->u32FmtNum)
+    {
+        pstcDec->u32ErrCnt++;
+        i32Len = snprintf(pcText, u32Size, "<unknown log id %u>", (unsigned)u32Id);
+    }
+    else
+    {
+        pstcDec->u32RecCnt++;
+        i32Len = (int32_t)LogFormat(pcText, u32Size, pstcDec->ppcFmt[u32Id], au32Arg, u32Argc);
+    }
+
+    pstcDec->u32Len    = 0u;
+    pstcDec->bEsc      = FALSE;
+    pstcDec->bOverflow = FALSE;
+
+    if (i32Len < 0)
+    {
+        pcText[0] = '\0';
+        i32Len    = 0;
+    }
+    return ((uint32_t)i32Len < u32Size) ? (uint32_t)i32Len : (u32Size - 1u);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LOG_DEC_Local_Functions LOG_DEC局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  解码LEB128变长整数
+ * @param  [in] pu8Data 记录
+ * @param  [in] u32Len 记录长度
+ * @param  [in,out] pu32Pos 读位置
+ * @param  [out] pu32Value 数值
+ * @retval uint32_t 使用的字节数，0表示记录不完整或超过32位
+ */
+static uint32_t LogVarintGet(const uint8_t *pu8Data, uint32_t u32Len, uint32_t *pu32Pos, uint32_t *pu32Value)
+{
+    uint32_t u32Value = 0u;
+    uint32_t u32Shift = 0u;
+    uint32_t u32Pos   = *pu32Pos;
+    uint8_t  u8Byte;
+
+    do
+    {
+        if ((u32Pos >= u32Len) || (u32Shift > 28u))
+        {
+            return 0u;
+        }
+        u8Byte = pu8Data[u32Pos];
+        u32Pos++;
+        u32Value |= (uint32_t)(u8Byte & 0x7Fu) << u32Shift;
+        u32Shift += 7u;
+    } while (0u != (u8Byte & 0x80u));
+
+    u32Shift   = u32Pos - *pu32Pos;
+    *pu32Pos   = u32Pos;
+    *pu32Value = u32Value;
+
+    return u32Shift;
+}
+
+/**
+ * @brief  按格式字符串输出文本：每个转换说明取一个32位参数，转换说明单独交给snprintf()
+ * @param  [out] pcText 文本缓冲
+ * @param  [in] u32Size 文本缓冲长度
+ * @param  [in] pcFmt 格式字符串
+ * @param  [in] pu32Arg 参数
+ * @param  [in] u32Argc 参数个数，不足时输出"?"
+ * @retval uint32_t 完整输出所需的长度（不含'\0'）
+ */
+static uint32_t LogFormat(char *pcText, uint32_t u32Size, const char *pcFmt, const uint32_t *pu32Arg, uint32_t u32Argc)
+{
+    char     acSpec[LOG_SPEC_MAX + 1u];
+    uint32_t u32Out = 0u;
+    uint32_t u32Arg = 0u;
+    uint32_t u32Spec;
+    int32_t  i32Len;
+    char     cConv;
+
+    while ('\0' != *pcFmt)
+    {
+        if (('%' != *pcFmt) || ('%' == pcFmt[1]))
+        {
+            if (u32Out + 1u < u32Size)
+            {
+                pcText[u32Out] = *pcFmt;
+            }
+            u32Out++;
+            pcFmt += ('%' == *pcFmt) ? 2 : 1;
+            continue;
+        }
+
+        /* 标志、宽度、精度保留，长度修饰符去掉（参数均为32位） */
+        u32Spec           = 0u;
+        acSpec[u32Spec++] = *pcFmt++;
+        while (('\0' != *pcFmt) && (NULL != strchr("-+ #0123456789.", *pcFmt)))
+        {
+            if (u32Spec < (LOG_SPEC_MAX - 1u))
+            {
+                acSpec[u32Spec++] = *pcFmt;
+            }
+            pcFmt++;
+        }
+        while (('\0' != *pcFmt) && (NULL != strchr("hlLqjzt", *pcFmt)))
+        {
+            pcFmt++;
+        }
+        cConv = *pcFmt;
+        if ('\0' != cConv)
+        {
+            pcFmt++;
+        }
+
+        acSpec[u32Spec++] = ('p' == cConv) ? 'X' : cConv;
+        acSpec[u32Spec]   = '\0';
+
+        if (('\0' == cConv) || (NULL == strchr("diuxXocp", cConv)) || (u32Arg >= u32Argc))
+        {
+            i32Len = snprintf((u32Out < u32Size) ? &pcText[u32Out] : NULL, (u32Out < u32Size) ? (u32Size - u32Out) : 0u, "?");
+        }
+        else if (('d' == cConv) || ('i' == cConv) || ('c' == cConv))
+        {
+            i32Len = snprintf((u32Out < u32Size) ? &pcText[u32Out] : NULL, (u32Out < u32Size) ? (u32Size - u32Out) : 0u, acSpec,
+                              (int)(int32_t)pu32Arg[u32Arg]);
+        }
+        else if ('p' == cConv)
+        {
+            i32Len = snprintf((u32Out < u32Size) ? &pcText[u32Out] : NULL, (u32Out < u32Size) ? (u32Size - u32Out) : 0u, "0x%08X",
+                              (unsigned)pu32Arg[u32Arg]);
+        }
+        else
+        {
+            i32Len = snprintf((u32Out < u32Size) ? &pcText[u32Out] : NULL, (u32Out < u32Size) ? (u32Size - u32Out) : 0u, acSpec,
+                              (unsigned)pu32Arg[u32Arg]);
+        }
+        u32Arg++;
+        u32Out += (i32Len > 0) ? (uint32_t)i32Len : 0u;
+    }
+
+    if (u32Size > 0u)
+    {
+        pcText[(u32Out < u32Size) ? u32Out : (u32Size - 1u)] = '\0';
+    }
+
+    return u32Out;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
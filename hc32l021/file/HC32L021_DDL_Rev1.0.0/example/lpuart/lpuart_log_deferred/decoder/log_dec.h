@@ -0,0 +1,103 @@
+/**
+ *******************************************************************************
+ * @file  log_dec.h
+ * @brief This file contains all the functions prototypes of the host decoder
+ *        of the deferred binary log (ddl_log).
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __LOG_DEC_H__
+#define __LOG_DEC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "ddl_log.h"
+
+/**
+ * @addtogroup LOG_DEC 日志主机解码
+ * @brief 主机端程序：输入DDL_LogRead()输出的字节流，由与目标板同一份格式字符串表
+ *        （DDL_LOG_FMT_STR展开）还原文本；只在主机上编译，不进入目标板驱动库
+ * @{
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup LOG_DEC_Global_Types LOG_DEC全局类型定义
+ * @{
+ */
+
+/**
+ * @brief  日志解码器（由LOG_DecodeInit()初始化）
+ */
+typedef struct
+{
+    const char *const *ppcFmt;                  /*!< 格式字符串表，按ID索引 */
+    uint32_t           u32FmtNum;               /*!< 格式字符串个数 */
+    uint8_t            au8Rec[DDL_LOG_REC_MAX]; /*!< 当前记录（已去转义） */
+    uint32_t           u32Len;                  /*!< 当前记录长度 */
+    boolean_t          bEsc;                    /*!< 上一字节为转义字节 */
+    boolean_t          bOverflow;               /*!< 当前记录超长 */
+    uint32_t           u32RecCnt;               /*!< 已解码的记录数 */
+    uint32_t           u32ErrCnt;               /*!< 无法解码的记录数 */
+    uint32_t           u32DropCnt;              /*!< 目标板报告的丢弃记录数 */
+} stc_log_dec_t;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup LOG_DEC_Global_Functions LOG_DEC全局函数定义
+ * @{
+ */
+en_result_t LOG_DecodeInit(stc_log_dec_t *pstcDec, const char *const *ppcFmt, uint32_t u32FmtNum); /* 解码器初始化 */
+uint32_t    LOG_Decode(stc_log_dec_t *pstcDec, uint8_t u8Byte, char *pcText, uint32_t u32Size);   /* 输入一字节，记录结束时输出文本 */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_DEC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
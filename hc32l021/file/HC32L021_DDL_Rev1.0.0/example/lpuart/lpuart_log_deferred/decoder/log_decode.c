@@ -0,0 +1,97 @@
+/**
+ *******************************************************************************
+ * @file  log_decode.c
+ * @brief Host decoder of the lpuart_log_deferred example: rebuilds the log
+ *        text from the captured LPUART byte stream and the format string
+ *        table of the same build (log_fmt.h)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include "log_dec.h"
+#include "log_fmt.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TEXT_MAX (256u)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* 与目标板同一份格式字符串表 */
+static const char *const m_apcLogFmt[] = {LOG_FMT_TABLE(DDL_LOG_FMT_STR)};
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function：逐字节解码，每条记录输出一行
+ * @param  [in] argc 参数个数
+ * @param  [in] argv 参数：串口抓包文件或串口设备（须预先设置为原始模式），省略时读标准输入
+ * @retval int 0: 正常结束；1: 无法打开输入
+ */
+int main(int argc, char *argv[])
+{
+    stc_log_dec_t stcDec;
+    char              acText[TEXT_MAX];
+    FILE             *pFile = stdin;
+    int               iByte;
+
+    if (argc > 1)
+    {
+        pFile = fopen(argv[1], "rb");
+        if (NULL == pFile)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    (void)LOG_DecodeInit(&stcDec, m_apcLogFmt, LOG_FMT_NUM);
+
+    while (EOF != (iByte = fgetc(pFile)))
+    {
+        if (0u != LOG_Decode(&stcDec, (uint8_t)iByte, acText, sizeof(acText)))
+        {
+            printf("%s\n", acText);
+            fflush(stdout);
+        }
+    }
+
+    fprintf(stderr, "records=%u dropped=%u errors=%u\n", (unsigned)stcDec.u32RecCnt, (unsigned)stcDec.u32DropCnt,
+            (unsigned)stcDec.u32ErrCnt);
+
+    if (stdin != pFile)
+    {
+        (void)fclose(pFile);
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,55 @@
+/**
+*******************************************************************************
+* @file  ddl_device.h
+* @brief This file contains all the functions prototypes of the device define
+*        driver library
+@verbatim
+  Change Logs:
+  Date             Author          Notes
+  2024-09-18       MADS            First version
+@endverbatim
+*******************************************************************************
+* Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+*
+* This software component is licensed by XHSC under BSD 3-Clause license
+* (the "License"); You may not use this file except in compliance with the
+* License. You may obtain a copy of the License at:
+*                    opensource.org/licenses/BSD-3-Clause
+*
+*******************************************************************************
+*/
+
+#ifndef __DDL_DEVICE_H__
+#define __DDL_DEVICE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define DDL_MCU_SERIES  DDL_DEVICE_SERIES_HC32L021
+#define DDL_MCU_PACKAGE DDL_DEVICE_PACKAGE
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DDL_DEVICE_H__ */
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,55 @@
+/**
+ *******************************************************************************
+ * @file  log_fmt.h
+ * @brief Log format string table of the lpuart_log_deferred example, shared by
+ *        the target build (IDs only) and the host decoder (strings)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __LOG_FMT_H__
+#define __LOG_FMT_H__
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl_log.h"
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* 格式字符串表：只能在末尾追加，已发布固件的ID不变 */
+#define LOG_FMT_TABLE(X)                                              \
+    X(LOG_BOOT, "boot, hclk=%u Hz, log buffer %u words")              \
+    X(LOG_TICK, "t=%u ms, previous log call %u cycles")               \
+    X(LOG_STAT, "uptime %u s, dropped %u records, pending %u words")  \
+    X(LOG_TIMER, "btim0 period %u us, prescaler %u, arr %u")
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  日志格式ID
+ */
+typedef enum
+{
+    LOG_FMT_TABLE(DDL_LOG_FMT_ID) LOG_FMT_NUM
+} en_log_fmt_id_t;
+
+#endif /* __LOG_FMT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,210 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the deferred binary log: records are
+ *        written from the BTIM interrupt without formatting (the cycles of each
+ *        call are measured with the SysTick time base and logged) and drained
+ *        to LPUART1 by the idle loop through the interrupt-driven TX ring
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "btim.h"
+#include "ddl_log.h"
+#include "log_fmt.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define LOG_BAUD     (9600u)
+#define LOG_WORDS    (256u) /* 日志缓冲字数，2的幂 */
+#define RING_TX_SIZE (128u) /* 发送缓冲长度，2的幂 */
+#define TICK_US      (1000u)
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void GpioConfig(void);
+static void LpUartConfig(void);
+static void TimerConfig(void);
+static void TimerCallback(uint32_t u32Flags, void *pvArg);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t          u32LogBuf[LOG_WORDS];
+static stc_lpuart_ring_t stcRing;
+static uint8_t           u8RingTxBuf[RING_TX_SIZE];
+static stc_int_cb_t      stcTimerCb;
+static volatile uint32_t u32Ms        = 0u;
+static uint32_t          u32LogCycles = 0u;
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint8_t  u8Out[32];
+    uint32_t u32Free;
+    uint32_t u32Len;
+
+    /* 日志缓冲初始化：之后线程及中断中均可记录 */
+    DDL_LogInit(u32LogBuf, LOG_WORDS);
+    DDL_LOG2(LOG_BOOT, SystemCoreClock, LOG_WORDS);
+
+    /* 端口配置 */
+    GpioConfig();
+
+    /* LPUART配置，只使用发送缓冲 */
+    LpUartConfig();
+    LPUART_RingInit(LPUART1, &stcRing, u8RingTxBuf, RING_TX_SIZE, NULL, 0u, IrqPriorityLevel3);
+
+    /* BTIM0 1ms中断中记录日志 */
+    TimerConfig();
+
+    while (1)
+    {
+        /* 空闲时取出编码后的日志写入发送缓冲，由TX空中断发送 */
+        u32Free = RING_TX_SIZE - LPUART_RingTxCountGet(&stcRing);
+        u32Len  = DDL_LogRead(u8Out, (u32Free < sizeof(u8Out)) ? u32Free : sizeof(u8Out));
+        if (0u != u32Len)
+        {
+            (void)LPUART_RingWrite(&stcRing, u8Out, u32Len);
+        }
+        else
+        {
+            /* 无日志待发送：休眠至下一次中断 */
+            __WFI();
+        }
+    }
+}
+
+/**
+ * @brief  BTIM0溢出中断：每100ms记录一次，同时记录上一次日志调用的耗时
+ * @param  [in] u32Flags 中断标志
+ * @param  [in] pvArg    回调参数
+ * @retval None
+ */
+static void TimerCallback(uint32_t u32Flags, void *pvArg)
+{
+    uint64_t u64Start;
+
+    (void)u32Flags;
+    (void)pvArg;
+
+    BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);
+    u32Ms++;
+
+    if (0u == (u32Ms % 100u))
+    {
+        u64Start = DDL_TickGet();
+        DDL_LOG2(LOG_TICK, u32Ms, u32LogCycles);
+        u32LogCycles = (uint32_t)(DDL_TickGet() - u64Start);
+    }
+    if (0u == (u32Ms % 1000u))
+    {
+        DDL_LOG3(LOG_STAT, u32Ms / 1000u, DDL_LogDropCountGet(), DDL_LogPendingGet());
+    }
+}
+
+/**
+ * @brief  BTIM0配置：PCLK计数，1ms溢出中断
+ * @retval None
+ */
+static void TimerConfig(void)
+{
+    stc_btim_init_t stcBtimInit;
+    uint32_t        u32Arr = (SYSCTRL_HclkFreqGet() / (1000000u / TICK_US)) - 1u;
+
+    /* CTIMER0作为BTIM0~2使用 */
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM);
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);
+
+    BTIM_StcInit(&stcBtimInit);                              /* 结构体初始化 */
+    stcBtimInit.u32Prescaler       = BTIM_COUNTER_CLK_DIV1;  /* 不分频       */
+    stcBtimInit.u32AutoReloadValue = u32Arr;                 /* 1ms溢出      */
+    BTIM_Init(BTIM0, &stcBtimInit);
+    BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);
+    BTIM_IntEnable(BTIM0, BTIM_INT_UI);
+
+    stcTimerCb.pfnCallback = TimerCallback;
+    stcTimerCb.pvArg       = NULL;
+    stcTimerCb.u32SrcMask  = BTIM03_AIT_FLAG_UI;
+    INT_CallbackRegister(CTIM0_IRQn, &stcTimerCb, IrqPriorityLevel1);
+
+    DDL_LOG3(LOG_TIMER, TICK_US, 1u, u32Arr);
+    BTIM_Enable(BTIM0);
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                      /* 结构体初始化 */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;         /* 1停止位      */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR; /* 数据8位     */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX;            /* 发送模式     */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;      /* 传输时钟源   */
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();     /* HCLK获取     */
+    stcLpuartInit.stcBaudRate.u32Baud       = LOG_BAUD;                  /* 波特率       */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
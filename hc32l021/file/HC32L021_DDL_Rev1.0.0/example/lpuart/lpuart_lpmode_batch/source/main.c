@@ -0,0 +1,177 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of the LPUART deep sleep batched
+ *        receive: the core stays in deep sleep (sleep-on-exit) while bytes
+ *        are received and the main loop wakes once per line
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpm.h"
+#include "lpuart.h"
+#include "sysctrl.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define RX_BUF_SIZE (64u) /* 接收缓冲长度（2的幂），即一行的最大长度 */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void LpUartDeepSleepConfig(void);
+static void GpioConfig(void);
+static void LpUartConfig(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_lpuart_lprx_t stcLpRx;
+static uint8_t           u8RxBuf[RX_BUF_SIZE];
+uint8_t                  u8TxData[2]         = {0x55, 0xAA};
+uint8_t                  u8Line[RX_BUF_SIZE] = {0};
+volatile uint32_t        u32LineCnt          = 0u; /* 主循环唤醒次数 */
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_lpuart_lprx_init_t stcLpRxInit;
+    uint32_t               u32Len;
+
+    /*STK 按键配置*/
+    STK_UserKeyConfig();
+
+    /*  LPUART IO口相关配置*/
+    GpioConfig();
+
+    /*  LPUART 功能配置 */
+    LpUartConfig();
+
+    /* 发送2字节数0x55、0xAA据到上位机 */
+    LPUART_TransmitPoll(LPUART1, u8TxData, 2);
+
+    /* 需按键按下，才能继续运行 */
+    LpUartDeepSleepConfig();
+
+    /* 深度休眠批量接收：收到'\n'或接收缓冲满时唤醒主循环，其余字节只在接收中断中写入接收缓冲 */
+    LPUART_LpRxStcInit(&stcLpRxInit);
+    stcLpRxInit.pu8Buf  = u8RxBuf;
+    stcLpRxInit.u16Size = RX_BUF_SIZE;
+    LPUART_LpRxInit(LPUART1, &stcLpRx, &stcLpRxInit, IrqPriorityLevel3);
+
+    while (1)
+    {
+        /* 进入深度休眠（SLEEPONEXIT），唤醒事件发生后返回 */
+        (void)LPUART_LpRxSleep(&stcLpRx);
+
+        /* 整行发回上位机 */
+        u32Len = LPUART_LpRxRead(&stcLpRx, u8Line, RX_BUF_SIZE);
+        LPUART_TransmitPoll(LPUART1, u8Line, u32Len);
+        u32LineCnt++;
+    }
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* 打开XTL */
+    SYSCTRL_ClockSrcEnable(SYSCTRL_CLK_SRC_XTL);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                    /* 结构体初始化         */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;       /* 1停止位              */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_PAR; /* 数据8位，奇偶校验1位 */
+    stcLpuartInit.u32Parity                 = LPUART_B8_PARITY_EVEN;   /* 偶校验               */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;       /* 收发模式             */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_XTL;     /* 传输时钟源           */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    /* 当XTL时钟为32768时，调用此函数产生9600波特率 */
+    LPUART_XtlBselSet(LPUART1, LPUART_XTL_BAUD_9600);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    /* 配置PA02为LPUART1_RX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_02;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA02_AF_LPUART1_RXD();
+}
+
+/**
+ * @brief  深度休眠模式外部端口配置
+ * @retval None
+ */
+static void LpUartDeepSleepConfig(void)
+{
+    /* 初始化IO配置为模拟端口(follow STK) */
+    GPIOA->ADS = 0xEFF9u; /* 不用的引脚全部配置成模拟(除TX,RX,USER KEY)*/
+
+    while (!STK_USER_KEY_PRESSED()) /* 等待按键按下，只有按键按下后才能继续运行到低功耗模式*/
+    {
+        ;
+    }
+
+    /* SWD接口配置为GPIO，注意接下来不能进行debug调试 */
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_SWD_USE_IO);
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,142 @@
+/**
+ *******************************************************************************
+ * @file  main.c
+ * @brief This file provides example of LPUART ring buffer transfer
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+#include "gpio.h"
+#include "lpuart.h"
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define RING_TX_SIZE (128u) /* 发送缓冲长度，2的幂 */
+#define RING_RX_SIZE (64u)  /* 接收缓冲长度，2的幂 */
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void GpioConfig(void);
+static void LpUartConfig(void);
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_lpuart_ring_t stcRing;
+static uint8_t           u8RingTxBuf[RING_TX_SIZE];
+static uint8_t           u8RingRxBuf[RING_RX_SIZE];
+static const uint8_t     u8Banner[] = "LPUART ring buffer echo\r\n";
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint8_t  u8Data[16];
+    uint32_t u32Len;
+    uint32_t u32Sent;
+
+    /* 端口配置 */
+    GpioConfig();
+
+    /* LPUART配置 */
+    LpUartConfig();
+
+    /* 环形缓冲收发初始化：中断中收发数据 */
+    LPUART_RingInit(LPUART1, &stcRing, u8RingTxBuf, RING_TX_SIZE, u8RingRxBuf, RING_RX_SIZE, IrqPriorityLevel3);
+
+    /* 写入发送缓冲后立即返回，不等待发送 */
+    LPUART_RingWrite(&stcRing, u8Banner, sizeof(u8Banner) - 1u);
+
+    while (1)
+    {
+        /* 读出已接收的数据并原样发回 */
+        u32Len = LPUART_RingRead(&stcRing, u8Data, sizeof(u8Data));
+        for (u32Sent = 0u; u32Sent < u32Len;)
+        {
+            u32Sent += LPUART_RingWrite(&stcRing, &u8Data[u32Sent], u32Len - u32Sent);
+        }
+
+        /* 此处可执行其他任务 */
+    }
+}
+
+/**
+ * @brief  LPUART配置
+ * @retval None
+ */
+static void LpUartConfig(void)
+{
+    stc_lpuart_init_t stcLpuartInit;
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockLpuart1);
+
+    /* LPUART 初始化 */
+    LPUART_StcInit(&stcLpuartInit);                                      /* 结构体初始化 */
+    stcLpuartInit.u32StopBits               = LPUART_STOPBITS_1;         /* 1停止位      */
+    stcLpuartInit.u32FrameLength            = LPUART_FRAME_LEN_8B_NOPAR; /* 数据8位     */
+    stcLpuartInit.u32TransMode              = LPUART_MODE_TX_RX;         /* 收发模式     */
+    stcLpuartInit.stcBaudRate.u32SclkSelect = LPUART_SCLK_SEL_PCLK;      /* 传输时钟源   */
+    stcLpuartInit.stcBaudRate.u32Sclk       = SYSCTRL_HclkFreqGet();     /* HCLK获取     */
+    stcLpuartInit.stcBaudRate.u32Baud       = 9600;                      /* 波特率       */
+    LPUART_Init(LPUART1, &stcLpuartInit);
+
+    LPUART_IntFlagClearAll(LPUART1); /* 清除所有状态标志 */
+}
+
+/**
+ * @brief  端口配置
+ * @retval None
+ */
+static void GpioConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    /* 外设模块时钟使能 */
+    SYSCTRL_PeriphClockEnable(PeriphClockGpio);
+
+    /* 配置PA01为LPUART1_TX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode      = GPIO_MD_OUTPUT_PP;
+    stcGpioInit.u32PullUp    = GPIO_PULL_UP;
+    stcGpioInit.bOutputValue = TRUE;
+    stcGpioInit.u32Pin       = GPIO_PIN_01;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA01_AF_LPUART1_TXD();
+
+    /* 配置PA02为LPUART1_RX */
+    GPIO_StcInit(&stcGpioInit);
+    stcGpioInit.u32Mode = GPIO_MD_INPUT;
+    stcGpioInit.u32Pin  = GPIO_PIN_02;
+    GPIO_Init(GPIOA, &stcGpioInit);
+    GPIO_PA02_AF_LPUART1_RXD();
+}
+
+/******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -32,7 +32,8 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
-#define RX_TX_FRAME_LEN 10u /* 通信帧长度 */
+#define RX_TX_FRAME_LEN 10u      /* 通信帧长度 */
+#define RX_TX_TIMEOUT   1000000u /* 收发超时时间（us） */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
@@ -81,9 +82,9 @@ int32_t main(void)
         }
 
         /* 数据接收完成后进行发送 */
-        if (Ok == (LPUART_ReceivePollTimeOut(LPUART1, u8RxData, RX_TX_FRAME_LEN, 0xFFFFFF))) /* 从上位机接收RX_TX_FRAME_LEN长度数据完成 */
+        if (Ok == (LPUART_ReceivePollTimeOutUs(LPUART1, u8RxData, RX_TX_FRAME_LEN, RX_TX_TIMEOUT))) /* 从上位机接收RX_TX_FRAME_LEN长度数据完成 */
         {
-            LPUART_TransmitPollTimeOut(LPUART1, u8RxData, RX_TX_FRAME_LEN, 0xFFFFFF); /* 将收到的数据发送到上位机 */
+            LPUART_TransmitPollTimeOutUs(LPUART1, u8RxData, RX_TX_FRAME_LEN, RX_TX_TIMEOUT); /* 将收到的数据发送到上位机 */
         }
     }
 }
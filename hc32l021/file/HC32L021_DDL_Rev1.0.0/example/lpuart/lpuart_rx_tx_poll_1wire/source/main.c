@@ -32,7 +32,8 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
-#define RX_TX_FRAME_LEN 10u /* 通信帧长度 */
+#define RX_TX_FRAME_LEN 10u      /* 通信帧长度 */
+#define RX_TX_TIMEOUT   1000000u /* 收发超时时间（us） */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
@@ -76,9 +77,9 @@ int32_t main(void)
             ;
         }
 
-        if (Ok == (LPUART_ReceivePollTimeOut(LPUART1, u8RxData, RX_TX_FRAME_LEN, 0xFFFFF))) /* 从PC接收RX_TX_FRAME_LEN长度数据完成 */
+        if (Ok == (LPUART_ReceivePollTimeOutUs(LPUART1, u8RxData, RX_TX_FRAME_LEN, RX_TX_TIMEOUT))) /* 从PC接收RX_TX_FRAME_LEN长度数据完成 */
         {
-            LPUART_TransmitPollTimeOut(LPUART1, u8RxData, RX_TX_FRAME_LEN, 0xFFFFF); /* 将收到的数据发送给PC */
+            LPUART_TransmitPollTimeOutUs(LPUART1, u8RxData, RX_TX_FRAME_LEN, RX_TX_TIMEOUT); /* 将收到的数据发送给PC */
         }
     }
 }
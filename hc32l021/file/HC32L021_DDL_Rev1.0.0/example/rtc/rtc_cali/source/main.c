@@ -89,8 +89,8 @@ static void GpioConfig(void)
  */
 static void RtcConfig(void)
 {
-    uint16_t  u16RtcCompValue = 0;
-    float32_t f32RtcCompUint  = 0;
+    uint16_t u16RtcCompValue = 0;
+    int32_t  i32RtcCompUint  = 0;
 
     SYSCTRL_PeriphClockEnable(PeriphClockRtc);           /* RTC模块时钟打开 */
     SYSCTRL_ClockSrcEnable(SYSCTRL_CLK_SRC_XTL);         /* 打开XTL */
@@ -114,9 +114,9 @@ static void RtcConfig(void)
 
     RTC_Init(&stcRtcInit); /* RTC初始化 */
 
-    f32RtcCompUint = 10; /* 补偿目标值 单位:ppm*/
+    i32RtcCompUint = DDL_Q16(10); /* 补偿目标值 单位:ppm，Q16.16格式 */
 
-    if (Ok == RTC_CompValueCalculate(f32RtcCompUint, RTC_COMPEN_PRICISION_0P96PPM, &u16RtcCompValue)) /* 计算补偿寄存器值 */
+    if (Ok == RTC_CompValueCalculateQ16(i32RtcCompUint, RTC_COMPEN_PRICISION_0P96PPM, &u16RtcCompValue)) /* 计算补偿寄存器值 */
     {
         RTC_CompConfig(u16RtcCompValue, RTC_COMPEN_PRICISION_0P96PPM); /* 补偿配置 */
     }
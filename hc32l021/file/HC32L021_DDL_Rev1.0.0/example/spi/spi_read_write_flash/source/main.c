@@ -6,6 +6,8 @@
    Change Logs:
    Date             Author          Notes
    2024-12-15       MADS            First version
+   2026-10-18       MADS            Use byte buffers for flash read and write
+   2026-10-18       MADS            Erase asynchronously, polled from BTIM0 interrupt
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -21,6 +23,7 @@
 /******************************************************************************
  * Include files
  ******************************************************************************/
+#include "btim.h"
 #include "ddl.h"
 #include "flash.h"
 #include "gpio.h"
@@ -41,14 +44,15 @@
 /******************************************************************************
  * Local variable definitions ('static')                                      *
  ******************************************************************************/
-static uint16_t          u16WriteData[DATA_SIZE] = {0};
-static uint16_t          u16ReadData[DATA_SIZE]  = {0};
+static uint8_t           u8WriteData[DATA_SIZE]  = {0};
+static uint8_t           u8ReadData[DATA_SIZE]   = {0};
 static volatile uint16_t u16W25QXXID             = 0;
 /******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
 static void GpioConfig(void);
 static void SpiConfig(void);
+static void Btim0Config(uint16_t u16Period);
 /*****************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -69,9 +73,11 @@ int32_t main(void)
     SpiConfig();     /* SPI配置 */
     SPI_Enable(SPI); /* 使能主机SPI*/
 
+    Btim0Config(4000u); /* BTIM0初始化，1ms周期轮询擦除状态 */
+
     for (u16Count = 0; u16Count < DATA_SIZE; u16Count++)
     {
-        u16WriteData[u16Count] = u16Count;
+        u8WriteData[u16Count] = (uint8_t)u16Count;
     }
 
     while (FALSE == STK_USER_KEY_PRESSED()) /* 等待按键按下 */
@@ -88,17 +94,30 @@ int32_t main(void)
         }
     }
 
-    u16W25QXXID = W25QXX_ReadID();                  /* 获取W25QXX的ID号 */
-    if (W25QXX_OK != W25QXX_BlockErase(FLASH_ADDR)) /* W25QXX擦 */
+    u16W25QXXID = W25QXX_ReadID(); /* 获取W25QXX的ID号 */
+
+    BTIM_Enable(BTIM0); /* 启动BTIM0运行 */
+    if (W25QXX_OK != W25QXX_EraseStart(FLASH_ADDR, W25QXX_SECTOR_SIZE, NULL)) /* W25QXX扇区擦，立即返回 */
+    {
+        while (1)
+        {
+            ;
+        }
+    }
+    while (W25QXX_BUSY == W25QXX_EraseStatusGet()) /* 擦除期间CPU休眠，由BTIM0中断查询完成 */
+    {
+        __WFI();
+    }
+    BTIM_Disable(BTIM0); /* 停止BTIM0 */
+    if (W25QXX_OK != W25QXX_EraseStatusGet())
     {
         while (1)
         {
             ;
         }
     }
-    DDL_Delay1ms(100);
 
-    if (W25QXX_OK != W25QXX_Write(u16WriteData, FLASH_ADDR, DATA_SIZE)) /* W25QXX写 */
+    if (W25QXX_OK != W25QXX_Write(u8WriteData, FLASH_ADDR, DATA_SIZE)) /* W25QXX写 */
     {
         while (1)
         {
@@ -107,7 +126,7 @@ int32_t main(void)
     }
     DDL_Delay1ms(100);
 
-    if (W25QXX_OK != W25QXX_Read(u16ReadData, FLASH_ADDR, DATA_SIZE)) /* W25QXX读 */
+    if (W25QXX_OK != W25QXX_Read(u8ReadData, FLASH_ADDR, DATA_SIZE)) /* W25QXX读 */
     {
         while (1)
         {
@@ -118,7 +137,7 @@ int32_t main(void)
     /* 判断是否有数据读错*/
     for (u16Count = 0; u16Count < DATA_SIZE; u16Count++)
     {
-        if (u16WriteData[u16Count] != u16ReadData[u16Count])
+        if (u8WriteData[u16Count] != u8ReadData[u16Count])
         {
             u16ErrorNum++;
         }
@@ -140,6 +159,20 @@ int32_t main(void)
     }
 }
 
+/**
+ * @brief  BTIM0中断服务函数：查询W25QXX擦除状态
+ * @retval None
+ */
+void Ctim0_IRQHandler(void)
+{
+    if (TRUE == BTIM_IntFlagGet(BTIM0, BTIM_FLAG_UI)) /* 获取BTIM0的溢出中断标志位 */
+    {
+        BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI); /* 清除BTIM0的溢出中断标志位 */
+
+        (void)W25QXX_ErasePoll(); /* 擦除进行中时读取一次状态寄存器 */
+    }
+}
+
 /**
  * @brief  SPI端口配置
  * @retval None
@@ -201,6 +234,30 @@ static void SpiConfig(void)
     SPI_FlagClearALL(SPI); /* 清除所有中断标志位 */
 }
 
+/**
+ * @brief  初始化BTIM0
+ * @retval None
+ */
+static void Btim0Config(uint16_t u16Period)
+{
+    stc_btim_init_t stcBtimInit = {0};
+
+    SYSCTRL_FuncEnable(SYSCTRL_FUNC_CTIMER0_USE_BTIM); /* 配置BTIM0/1/2有效，GTIM0无效 */
+    SYSCTRL_PeriphClockEnable(PeriphClockCtim0);       /* 使能BTIM0/1/2 外设时钟 */
+
+    BTIM_StcInit(&stcBtimInit);                               /* 结构体变量初始值初始化 */
+    stcBtimInit.u32Mode            = BTIM_MD_PCLK;            /* 工作模式: 计数器模式，计数时钟源来自PCLK */
+    stcBtimInit.u32OneShotEn       = BTIM_CONTINUOUS_COUNTER; /* 连续计数模式 */
+    stcBtimInit.u32Prescaler       = BTIM_COUNTER_CLK_DIV1;   /* 对计数时钟不分频 */
+    stcBtimInit.u32ToggleEn        = BTIM_TOGGLE_DISABLE;     /* TOG输出禁止 */
+    stcBtimInit.u32AutoReloadValue = u16Period - 1;           /* 自动重载寄存ARR赋值,计数周期为PRS*(ARR+1)*TPCLK */
+    BTIM_Init(BTIM0, &stcBtimInit);                           /* BTIM0初始化*/
+
+    BTIM_IntFlagClear(BTIM0, BTIM_FLAG_UI);          /* 清除溢出中断标志位 */
+    BTIM_IntEnable(BTIM0, BTIM_INT_UI);              /* 允许BTIM0溢出中断  */
+    EnableNvic(CTIM0_IRQn, IrqPriorityLevel3, TRUE); /* 开启中断 */
+}
+
 /******************************************************************************
  * EOF (not truncated)
  ******************************************************************************/
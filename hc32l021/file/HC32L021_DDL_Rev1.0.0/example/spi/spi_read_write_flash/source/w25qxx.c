@@ -6,6 +6,9 @@
    Change Logs:
    Date             Author          Notes
    2024-12-06       MADS            First version
+   2026-10-18       MADS            Use byte buffers with pipelined SPI transmit/receive
+   2026-10-18       MADS            Add FAST_READ streaming, SFDP geometry and timer-polled asynchronous erase
+   2026-10-18       MADS            Add LRU read cache with write/erase invalidation
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -28,20 +31,61 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/* 总线占用状态：前台操作、连续读及擦除互斥，擦除期间只有W25QXX_ErasePoll()访问器件 */
+#define W25QXX_STATE_IDLE   (0u)
+#define W25QXX_STATE_CMD    (1u) /*!< 前台指令进行中 */
+#define W25QXX_STATE_STREAM (2u) /*!< 连续读进行中（片选保持有效） */
+#define W25QXX_STATE_ERASE  (3u) /*!< 擦除进行中 */
+#define W25QXX_STATE_POLL   (4u) /*!< 擦除进行中，正在读取状态寄存器 */
+
+#define W25QXX_ADDR_MAX     (0x1000000u) /*!< 3字节地址范围 */
+#define W25QXX_SFDP_DW_MAX  (16u)        /*!< 读取的基本参数表最大长度（DWORD） */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static void                     W25QXX_Reset(void);
+static uint8_t                  W25QXX_Acquire(uint8_t u8State);
+static void                     W25QXX_CmdSend(uint8_t u8Cmd);
+static uint8_t                  W25QXX_StatusRegRead(void);
+static uint8_t                  W25QXX_WaitReady(uint32_t u32Timeout);
+static uint8_t                  W25QXX_WelSet(void);
+static void                     W25QXX_AddrCmdSend(uint8_t u8Cmd, uint32_t u32Addr, uint32_t u32Dummy);
+static void                     W25QXX_SfdpParse(void);
+static stc_w25qxx_cache_line_t *W25QXX_CacheLineGet(uint32_t u32LineAddr);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static volatile uint8_t        m_u8State       = W25QXX_STATE_IDLE;
+static volatile uint8_t        m_u8EraseStatus = W25QXX_OK;
+static uint32_t                m_u32EraseAddr;
+static stc_ddl_deadline_t      m_stcEraseDeadline;
+static func_ptr_w25qxx_erase_t m_pfnEraseDone;
+
+/* 无SFDP时的默认参数（W25Q16） */
+static const stc_w25qxx_info_t m_stcInfoDefault = {
+    0u,
+    W25QXX_FLASH_SIZE,
+    W25QXX_PAGE_SIZE,
+    {{W25QXX_SECTOR_SIZE, SECTOR_ERASE_CMD}, {0x8000u, BLOCK_ERASE_32K_CMD}, {W25QXX_BLOCK_SIZE, BLOCK_ERASE_64K_CMD}, {0u, 0u}},
+    FALSE,
+};
+static stc_w25qxx_info_t       m_stcInfo;
+
+/* 读缓存（只在线程中访问，W25QXX_ErasePoll()不访问缓存） */
+static stc_w25qxx_cache_line_t *m_pstcCacheLine;
+static uint32_t                 m_u32CacheLineNum;
+static uint32_t                 m_u32CacheStamp;
+static stc_w25qxx_cache_stat_t  m_stcCacheStat;
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
 /**
  * @brief  Initializes the W25QXX interface
+ * @note   复位器件，读取JEDEC ID及SFDP基本参数表得到容量、页尺寸及擦除类型
+ *         （无SFDP时容量按JEDEC ID容量字节2^N推算，其余取默认值）
  * @retval W25QXX memory status
  *         W25QXX_OK        成功
  *         W25QXX_ERROR     错误
@@ -50,294 +94,845 @@
  */
 uint8_t W25QXX_Init(void)
 {
+    uint8_t u8Ret;
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return W25QXX_BUSY;
+    }
+
     W25QXX_Reset(); /* Reset W25Qxxx */
+    W25QXX_SfdpParse();
+    W25QXX_CacheInvalidate(0u, W25QXX_ADDR_MAX);
+    m_u8EraseStatus = W25QXX_OK;
+
+    u8Ret     = (0u != (W25QXX_StatusRegRead() & W25QXX_FSR_BUSY)) ? W25QXX_BUSY : W25QXX_OK;
+    m_u8State = W25QXX_STATE_IDLE;
 
-    return W25QXX_StatusGet();
+    return u8Ret;
 }
 
 /**
- * @brief  This function reset the W25QXX
- * @retval None
+ * @brief  获取器件几何参数（W25QXX_Init()后有效）
+ * @retval const stc_w25qxx_info_t*
  */
-static void W25QXX_Reset(void)
+const stc_w25qxx_info_t *W25QXX_InfoGet(void)
 {
-    uint16_t u16Cmd[2] = {RESET_ENABLE_CMD, RESET_MEMORY_CMD};
+    return &m_stcInfo;
+}
 
-    W25QXX_Enable(); /* enable w25qxx */
+/**
+ * @brief  This function send a Write Enable and check it is effective
+ * @retval W25QXX memory status
+ *         W25QXX_OK        成功
+ *         W25QXX_ERROR     WEL未置位
+ *         W25QXX_BUSY      擦除或连续读进行中
+ */
+uint8_t W25QXX_WriteEnable(void)
+{
+    uint8_t u8Ret;
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return W25QXX_BUSY;
+    }
 
-    /* Send the reset command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 2);  // transmit Cmd 0x66,0x99
+    u8Ret     = W25QXX_WelSet();
+    m_u8State = W25QXX_STATE_IDLE;
 
-    W25QXX_Disable(); /* disable w25qxx */
+    return u8Ret;
 }
 
 /**
- * @brief  Reads current status of the W25QXX
+ * @brief  This function send a Write Disable and check it is effective
  * @retval W25QXX memory status
  *         W25QXX_OK        成功
- *         W25QXX_ERROR     错误
- *         W25QXX_BUSY      状态忙
- *         W25QXX_TIMEOUT   超时
+ *         W25QXX_ERROR     WEL未清零
+ *         W25QXX_BUSY      擦除或连续读进行中
  */
-static uint8_t W25QXX_StatusGet(void)
+uint8_t W25QXX_WriteDisable(void)
 {
-    uint16_t u16Cmd[2] = {READ_STATUS_REG1_CMD, 0x0000u};  // 0x05
-    uint16_t status;
+    uint8_t u8Ret;
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return W25QXX_BUSY;
+    }
+
+    W25QXX_CmdSend(WRITE_DISABLE_CMD); /* 0x04 */
+    u8Ret     = (0u != (W25QXX_StatusRegRead() & W25QXX_FSR_WREN)) ? W25QXX_ERROR : W25QXX_OK;
+    m_u8State = W25QXX_STATE_IDLE;
+
+    return u8Ret;
+}
+
+/**
+ * @brief  Read Manufacture/Device ID
+ * @retval value address
+ *         0XEF13,表示芯片型号为W25Q80
+ *         0XEF14,表示芯片型号为W25Q16
+ *         0XEF15,表示芯片型号为W25Q32
+ *         0XEF16,表示芯片型号为W25Q64
+ *         0,擦除或连续读进行中
+ */
+uint16_t W25QXX_ReadID(void)
+{
+    uint8_t u8Rt_ID[2] = {0};
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return 0u;
+    }
 
     W25QXX_Enable(); /* enable w25qxx */
 
-    /* Send the read status command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 1);  // transmit Cmd 0x05
+    /* Send the read ID command */
+    W25QXX_AddrCmdSend(READ_ID_CMD, 0u, 0u);
 
     /* Reception of the data */
-    SPI_FlagClearALL(SPI);
-    SPI_TransmitReceive(SPI, &u16Cmd[1], &status, 1);
+    SPI_Receive8(W25QXX_SPI, u8Rt_ID, 2, 0xFFu, DDL_TIMEOUT_FOREVER);
 
-    W25QXX_Disable(); /* disable w25qxx */
+    W25QXX_Disable(); /* diable w25qxx */
+    m_u8State = W25QXX_STATE_IDLE;
+
+    return (uint16_t)(((uint16_t)u8Rt_ID[0] << 8) | u8Rt_ID[1]);
+}
+
+/**
+ * @brief  读取JEDEC ID
+ * @retval uint32_t 厂商（bit23:16）、类型（bit15:8）、容量（bit7:0）；擦除或连续读进行中时为0
+ */
+uint32_t W25QXX_ReadJedecID(void)
+{
+    uint8_t u8Cmd    = READ_JEDEC_ID_CMD;
+    uint8_t au8Id[3] = {0};
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return 0u;
+    }
 
-    /* Check the value of the register */
-    if ((status & W25QXX_FSR_BUSY) != 0)
+    W25QXX_Enable();
+    SPI_Transmit8(W25QXX_SPI, &u8Cmd, 1u, DDL_TIMEOUT_FOREVER);
+    SPI_Receive8(W25QXX_SPI, au8Id, 3u, 0xFFu, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable();
+    m_u8State = W25QXX_STATE_IDLE;
+
+    return ((uint32_t)au8Id[0] << 16) | ((uint32_t)au8Id[1] << 8) | au8Id[2];
+}
+
+/**
+ * @brief  读取SFDP（JESD216）数据
+ * @param  pu8Data Pointer to data to be read
+ * @param  u32Addr SFDP地址
+ * @param  u32Size 读取长度
+ * @retval W25QXX memory status
+ */
+uint8_t W25QXX_SfdpRead(uint8_t *pu8Data, uint32_t u32Addr, uint32_t u32Size)
+{
+    en_result_t enRet;
+
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
     {
         return W25QXX_BUSY;
     }
-    else
+
+    W25QXX_Enable();
+    W25QXX_AddrCmdSend(READ_SFDP_CMD, u32Addr, W25QXX_FAST_READ_DUMMY_BYTES);
+    enRet = SPI_Receive8(W25QXX_SPI, pu8Data, u32Size, 0xFFu, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable();
+    m_u8State = W25QXX_STATE_IDLE;
+
+    return (Ok == enRet) ? W25QXX_OK : W25QXX_ERROR;
+}
+
+/**
+ * @brief  Reads an amount of data from the QSPI memory
+ * @note   一次FAST_READ指令连续读出全部数据
+ * @param  pu8Data Pointer to data to be read
+ * @param  u32ReadAddr Read start address
+ * @param  u32Size u32Size of data to read
+ * @retval QSPI memory status
+ *         W25QXX_OK        成功
+ *         W25QXX_ERROR     地址超出容量或SPI错误
+ *         W25QXX_BUSY      擦除或连续读进行中
+ */
+uint8_t W25QXX_Read(uint8_t *pu8Data, uint32_t u32ReadAddr, uint32_t u32Size)
+{
+    uint8_t u8Ret;
+
+    if ((u32ReadAddr > m_stcInfo.u32Capacity) || (u32Size > (m_stcInfo.u32Capacity - u32ReadAddr)))
+    {
+        return W25QXX_ERROR;
+    }
+    if (0u == u32Size)
     {
         return W25QXX_OK;
     }
+
+    u8Ret = W25QXX_ReadStart(u32ReadAddr);
+    if (W25QXX_OK == u8Ret)
+    {
+        u8Ret = W25QXX_ReadContinue(pu8Data, u32Size);
+        W25QXX_ReadStop();
+    }
+
+    return u8Ret;
 }
 
 /**
- * @brief  This function send a Write Enable and wait it is effective
- * @retval W25QXX memory status
+ * @brief  开始连续读：片选置低并发送FAST_READ指令、地址及空周期，片选保持有效直到W25QXX_ReadStop()
+ * @param  u32ReadAddr Read start address
+ * @retval QSPI memory status
  *         W25QXX_OK        成功
- *         W25QXX_ERROR     错误
- *         W25QXX_BUSY      状态忙
- *         W25QXX_TIMEOUT   超时
+ *         W25QXX_ERROR     地址超出容量
+ *         W25QXX_BUSY      擦除或连续读进行中
  */
-uint8_t W25QXX_WriteEnable(void)
+uint8_t W25QXX_ReadStart(uint32_t u32ReadAddr)
 {
-    uint16_t u16Cmd[]     = {WRITE_ENABLE_CMD};  // 0x06
-    uint32_t u32DelayTick = 0;
+    if (u32ReadAddr >= m_stcInfo.u32Capacity)
+    {
+        return W25QXX_ERROR;
+    }
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_STREAM))
+    {
+        return W25QXX_BUSY;
+    }
 
     W25QXX_Enable(); /* enable w25qxx */
+    W25QXX_AddrCmdSend(FAST_READ_CMD, u32ReadAddr, W25QXX_FAST_READ_DUMMY_BYTES);
 
-    /* Send the Write Enable command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 1);  // transmit Cmd 0x06
+    return W25QXX_OK;
+}
 
-    W25QXX_Disable(); /* disable w25qxx */
+/**
+ * @brief  连续读：从上一次读到的位置继续读出u32Size字节（到达容量末尾后器件从地址0继续）
+ * @param  pu8Data Pointer to data to be read
+ * @param  u32Size u32Size of data to read
+ * @retval QSPI memory status
+ *         W25QXX_OK        成功
+ *         W25QXX_ERROR     未开始连续读或SPI错误
+ */
+uint8_t W25QXX_ReadContinue(uint8_t *pu8Data, uint32_t u32Size)
+{
+    if (W25QXX_STATE_STREAM != m_u8State)
+    {
+        return W25QXX_ERROR;
+    }
 
-    /* Wait the end of Flash writing */
-    while (W25QXX_StatusGet() == W25QXX_BUSY)
+    return (Ok == SPI_Receive8(W25QXX_SPI, pu8Data, u32Size, 0xFFu, DDL_TIMEOUT_FOREVER)) ? W25QXX_OK : W25QXX_ERROR;
+}
+
+/**
+ * @brief  结束连续读：片选置高
+ * @retval None
+ */
+void W25QXX_ReadStop(void)
+{
+    if (W25QXX_STATE_STREAM == m_u8State)
     {
-        /* Check for the Timeout */
-        if ((u32DelayTick++) > W25QXX_TIMEOUT_VALUE)
-        {
-            return W25QXX_TIMEOUT;
-        }
+        W25QXX_Disable(); /* disable w25qxx */
+        m_u8State = W25QXX_STATE_IDLE;
     }
-    return W25QXX_OK;
 }
 
 /**
- * @brief  This function send a Write Enable and wait it is effective
- * @retval W25QXX memory status
+ * @brief  Writes an amount of data to the QSPI memory
+ * @note   按页拆分，每页一次页编程并等待完成
+ * @param  pu8Data Pointer to data to be written
+ * @param  u32WriteAddr Write start address
+ * @param  u32Size u32Size of data to write
+ * @retval QSPI memory status
  *         W25QXX_OK        成功
- *         W25QXX_ERROR     错误
- *         W25QXX_BUSY      状态忙
- *         W25QXX_TIMEOUT   超时
+ *         W25QXX_ERROR     地址超出容量或WEL未置位
+ *         W25QXX_BUSY      擦除或连续读进行中
+ *         W25QXX_TIMEOUT   页编程超时
  */
-uint8_t W25QXX_WriteDisable(void)
+uint8_t W25QXX_Write(const uint8_t *pu8Data, uint32_t u32WriteAddr, uint32_t u32Size)
 {
-    uint16_t u16Cmd[]     = {WRITE_DISABLE_CMD};  // 0x04
-    uint32_t u32DelayTick = 0;
+    uint32_t u32PageMask = m_stcInfo.u32PageSize - 1u;
+    uint32_t u32CurrentSize;
+    uint8_t  u8Ret       = W25QXX_OK;
 
-    W25QXX_Enable(); /* enable w25qxx */
+    if ((u32WriteAddr > m_stcInfo.u32Capacity) || (u32Size > (m_stcInfo.u32Capacity - u32WriteAddr)))
+    {
+        return W25QXX_ERROR;
+    }
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return W25QXX_BUSY;
+    }
+    W25QXX_CacheInvalidate(u32WriteAddr, u32Size); /* 写穿：编程前使缓存行失效，失败时也不会读到旧数据 */
+
+    /* Perform the write page by page */
+    while ((0u != u32Size) && (W25QXX_OK == u8Ret))
+    {
+        /* 到本页末尾的字节数 */
+        u32CurrentSize = m_stcInfo.u32PageSize - (u32WriteAddr & u32PageMask);
+        if (u32CurrentSize > u32Size)
+        {
+            u32CurrentSize = u32Size;
+        }
 
-    /* Send the Write Disable command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 1);  // transmit Cmd 0x04
+        u8Ret = W25QXX_WelSet(); /* Enable write operations */
+        if (W25QXX_OK == u8Ret)
+        {
+            W25QXX_Enable();
+            W25QXX_AddrCmdSend(PAGE_PROG_CMD, u32WriteAddr, 0u);
+            SPI_Transmit8(W25QXX_SPI, pu8Data, u32CurrentSize, DDL_TIMEOUT_FOREVER);
+            W25QXX_Disable();
 
-    W25QXX_Disable(); /* disable w25qxx */
+            /* Wait the end of Flash writing */
+            u8Ret = W25QXX_WaitReady(W25QXX_PAGE_PROG_MAX_TIME);
+        }
+
+        u32WriteAddr += u32CurrentSize;
+        pu8Data += u32CurrentSize;
+        u32Size -= u32CurrentSize;
+    }
+    m_u8State = W25QXX_STATE_IDLE;
 
-    /* Wait the end of Flash writing */
-    while (W25QXX_StatusGet() == W25QXX_BUSY)
+    return u8Ret;
+}
+
+/**
+ * @brief  开始擦除并立即返回，由定时器中断周期调用W25QXX_ErasePoll()查询完成
+ * @param  u32Addr 擦除地址，须按u32Size对齐
+ * @param  u32Size 擦除尺寸，须为W25QXX_InfoGet()->astcErase[]中的一种
+ * @param  pfnDone 完成回调，可为NULL
+ * @retval W25QXX memory status
+ *         W25QXX_OK        擦除已开始
+ *         W25QXX_ERROR     尺寸不支持、地址未对齐或超出容量、WEL未置位
+ *         W25QXX_BUSY      擦除或其他操作进行中
+ */
+uint8_t W25QXX_EraseStart(uint32_t u32Addr, uint32_t u32Size, func_ptr_w25qxx_erase_t pfnDone)
+{
+    const stc_w25qxx_erase_t *pstcErase = NULL;
+    uint32_t                  i;
+
+    for (i = 0u; i < ARRAY_SZ(m_stcInfo.astcErase); i++)
     {
-        /* Check for the Timeout */
-        if ((u32DelayTick++) > W25QXX_TIMEOUT_VALUE)
+        if ((0u != u32Size) && (u32Size == m_stcInfo.astcErase[i].u32Size))
         {
-            return W25QXX_TIMEOUT;
+            pstcErase = &m_stcInfo.astcErase[i];
+            break;
         }
     }
+    if ((NULL == pstcErase) || (0u != (u32Addr & (u32Size - 1u))) || (u32Addr >= m_stcInfo.u32Capacity))
+    {
+        return W25QXX_ERROR;
+    }
+    if (W25QXX_OK != W25QXX_Acquire(W25QXX_STATE_CMD))
+    {
+        return W25QXX_BUSY;
+    }
+
+    if (W25QXX_OK != W25QXX_WelSet())
+    {
+        m_u8State = W25QXX_STATE_IDLE;
+        return W25QXX_ERROR;
+    }
+    W25QXX_CacheInvalidate(u32Addr, u32Size);
+
+    W25QXX_Enable();
+    W25QXX_AddrCmdSend(pstcErase->u8Cmd, u32Addr, 0u);
+    W25QXX_Disable();
+
+    m_u32EraseAddr = u32Addr;
+    m_pfnEraseDone = pfnDone;
+    DDL_DeadlineInit(&m_stcEraseDeadline, (u32Size <= W25QXX_SECTOR_SIZE) ? W25QXX_SECTOR_ERASE_MAX_TIME : W25QXX_BLOCK_ERASE_MAX_TIME);
+    m_u8EraseStatus = W25QXX_BUSY;
+    m_u8State       = W25QXX_STATE_ERASE;
+
     return W25QXX_OK;
 }
 
 /**
- * @brief  Read Manufacture/Device ID
- * @retval value address
- *         0XEF13,表示芯片型号为W25Q80
- *         0XEF14,表示芯片型号为W25Q16
- *         0XEF15,表示芯片型号为W25Q32
- *         0XEF16,表示芯片型号为W25Q64
+ * @brief  擦除状态轮询：擦除进行中时读取一次状态寄存器，BUSY清零或超时时结束擦除并调用完成回调
+ * @note   可在定时器中断及线程中调用；擦除期间其他接口返回W25QXX_BUSY，不访问总线
+ * @retval W25QXX memory status
+ *         W25QXX_OK        无擦除进行中，上一次擦除成功
+ *         W25QXX_BUSY      擦除进行中
+ *         W25QXX_TIMEOUT   上一次擦除超时
  */
-uint16_t W25QXX_ReadID(void)
+uint8_t W25QXX_ErasePoll(void)
 {
-    uint16_t u16Idt[4]   = {0xaa, 0x55, 0xaa, 0x55};
-    uint16_t u16Cmd[4]   = {READ_ID_CMD, 0x00, 0x00, 0x00};
-    uint16_t u16Rt_ID[4] = {0};
+    uint32_t  u32Primask;
+    uint8_t   u8Ret;
+    boolean_t bPoll = FALSE;
 
-    W25QXX_Enable(); /* enable w25qxx */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (W25QXX_STATE_ERASE == m_u8State)
+    {
+        m_u8State = W25QXX_STATE_POLL;
+        bPoll     = TRUE;
+    }
+    u8Ret = m_u8EraseStatus;
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+    if (FALSE == bPoll)
+    {
+        return u8Ret;
+    }
 
-    /* Send the read ID command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 4);
+    if (0u == (W25QXX_StatusRegRead() & W25QXX_FSR_BUSY))
+    {
+        u8Ret = W25QXX_OK;
+    }
+    else if (TRUE == DDL_DeadlineExpired(&m_stcEraseDeadline))
+    {
+        u8Ret = W25QXX_TIMEOUT;
+    }
+    else
+    {
+        m_u8State = W25QXX_STATE_ERASE;
+        return W25QXX_BUSY;
+    }
 
-    /* Reception of the data */
-    SPI_TransmitReceive(SPI, u16Idt, u16Rt_ID, 2);
+    m_u8EraseStatus = u8Ret;
+    m_u8State       = W25QXX_STATE_IDLE;
+    if (NULL != m_pfnEraseDone)
+    {
+        m_pfnEraseDone(m_u32EraseAddr, u8Ret);
+    }
 
-    W25QXX_Disable(); /* diable w25qxx */
+    return u8Ret;
+}
 
-    return (((0x00FFu & u16Rt_ID[0]) << 8) | (u16Rt_ID[1]));
+/**
+ * @brief  获取擦除状态（不访问总线）
+ * @retval W25QXX memory status
+ *         W25QXX_OK        无擦除进行中，上一次擦除成功
+ *         W25QXX_BUSY      擦除进行中
+ *         W25QXX_TIMEOUT   上一次擦除超时
+ */
+uint8_t W25QXX_EraseStatusGet(void)
+{
+    return m_u8EraseStatus;
 }
 
 /**
- * @brief  Reads an amount of data from the QSPI memory
- * @param  pu16Data Pointer to data to be read
- * @param  u32ReadAddr Read start address
- * @param  u32Size u32Size of data to read
+ * @brief  Erases the specified sector of the QSPI memory
+ * @note   擦除最小擦除单元（通常为4KB扇区）并在线程中轮询直到完成
+ * @param  u32Addr Block address to erase
  * @retval QSPI memory status
  */
-uint8_t W25QXX_Read(uint16_t *pu16Data, uint32_t u32ReadAddr, uint32_t u32Size)
+uint8_t W25QXX_BlockErase(uint32_t u32Addr)
 {
-    uint16_t u16Cmd[4];
+    uint32_t u32Size = m_stcInfo.astcErase[0].u32Size;
+    uint8_t  u8Ret;
 
-    /* Configure the command */
-    u16Cmd[0] = READ_CMD;
-    u16Cmd[1] = (uint16_t)(u32ReadAddr >> 16);
-    u16Cmd[2] = (uint16_t)(u32ReadAddr >> 8);
-    u16Cmd[3] = (uint16_t)(u32ReadAddr);
+    u8Ret = W25QXX_EraseStart(u32Addr & ~(u32Size - 1u), u32Size, NULL);
+    while (W25QXX_OK == u8Ret)
+    {
+        u8Ret = W25QXX_ErasePoll();
+        if (W25QXX_BUSY != u8Ret)
+        {
+            break;
+        }
+        u8Ret = W25QXX_OK;
+    }
 
-    W25QXX_Enable(); /* enable w25qxx */
+    return u8Ret;
+}
 
-    /* Send the read command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 4);
+/**
+ * @brief  读缓存初始化：使用调用者分配的u32LineNum个缓存行，全部置为无效并清零统计
+ * @note   u32LineNum为0时不使用缓存，W25QXX_CacheRead()直接读取flash；
+ *         缓存接口只能在线程中调用
+ * @param  pstcLine 缓存行数组
+ * @param  u32LineNum 缓存行数（每行W25QXX_CACHE_LINE_SIZE+8字节，如8行约2.1KB）
+ * @retval None
+ */
+void W25QXX_CacheInit(stc_w25qxx_cache_line_t *pstcLine, uint32_t u32LineNum)
+{
+    m_pstcCacheLine   = pstcLine;
+    m_u32CacheLineNum = (NULL != pstcLine) ? u32LineNum : 0u;
+    m_u32CacheStamp   = 0u;
+    W25QXX_CacheInvalidate(0u, W25QXX_ADDR_MAX);
+    W25QXX_CacheStatClear();
+}
 
-    /* Reception of the data */
-    SPI_FlagClearALL(SPI);
+/**
+ * @brief  经读缓存读取数据：按行查找，命中时从RAM复制，未命中时以一次FAST_READ读入整行并替换最久未访问的行
+ * @note   适合反复读取的配置、索引等小块数据；大块顺序读取应使用W25QXX_Read()，避免冲掉缓存
+ * @param  pu8Data Pointer to data to be read
+ * @param  u32ReadAddr Read start address
+ * @param  u32Size u32Size of data to read
+ * @retval QSPI memory status
+ *         W25QXX_OK        成功
+ *         W25QXX_ERROR     地址超出容量或SPI错误
+ *         W25QXX_BUSY      未命中时擦除或连续读进行中（已命中的部分已复制）
+ */
+uint8_t W25QXX_CacheRead(uint8_t *pu8Data, uint32_t u32ReadAddr, uint32_t u32Size)
+{
+    stc_w25qxx_cache_line_t *pstcLine;
+    uint32_t                 u32LineAddr;
+    uint32_t                 u32Offset;
+    uint32_t                 u32CurrentSize;
+    uint8_t                  u8Ret;
 
-    if (Ok != SPI_TransmitReceive(SPI, NULL, pu16Data, u32Size))
+    if ((u32ReadAddr > m_stcInfo.u32Capacity) || (u32Size > (m_stcInfo.u32Capacity - u32ReadAddr)))
     {
         return W25QXX_ERROR;
     }
+    if (0u == m_u32CacheLineNum)
+    {
+        return W25QXX_Read(pu8Data, u32ReadAddr, u32Size);
+    }
 
-    W25QXX_Disable(); /* disable w25qxx */
+    while (0u != u32Size)
+    {
+        u32Offset      = u32ReadAddr & (W25QXX_CACHE_LINE_SIZE - 1u);
+        u32LineAddr    = u32ReadAddr - u32Offset;
+        u32CurrentSize = W25QXX_CACHE_LINE_SIZE - u32Offset;
+        if (u32CurrentSize > u32Size)
+        {
+            u32CurrentSize = u32Size;
+        }
+
+        pstcLine = W25QXX_CacheLineGet(u32LineAddr);
+        if (u32LineAddr == pstcLine->u32Tag)
+        {
+            m_stcCacheStat.u32Hit++;
+        }
+        else
+        {
+            if (W25QXX_CACHE_TAG_INVALID != pstcLine->u32Tag)
+            {
+                m_stcCacheStat.u32Evict++;
+            }
+            pstcLine->u32Tag = W25QXX_CACHE_TAG_INVALID;
+
+            u8Ret = W25QXX_Read(pstcLine->au8Data, u32LineAddr, W25QXX_CACHE_LINE_SIZE);
+            if (W25QXX_OK != u8Ret)
+            {
+                return u8Ret;
+            }
+            pstcLine->u32Tag = u32LineAddr;
+            m_stcCacheStat.u32Miss++;
+        }
+        pstcLine->u32Stamp = ++m_u32CacheStamp;
+
+        DDL_MemoryCopy(pu8Data, &pstcLine->au8Data[u32Offset], u32CurrentSize);
+        pu8Data += u32CurrentSize;
+        u32ReadAddr += u32CurrentSize;
+        u32Size -= u32CurrentSize;
+    }
 
     return W25QXX_OK;
 }
 
 /**
- * @brief  Writes an amount of data to the QSPI memory
- * @param  pu16Data Pointer to data to be written
- * @param  u32WriteAddr Write start address
- * @param  u32Size u32Size of data to write,No more than 256byte.
- * @retval QSPI memory status
+ * @brief  使与[u32Addr, u32Addr+u32Size)重叠的缓存行失效
+ * @note   W25QXX_Write()、W25QXX_EraseStart()及W25QXX_Init()自动调用；
+ *         器件被其他途径修改时（如另一主机）由应用调用
+ * @param  u32Addr 起始地址
+ * @param  u32Size 字节数
+ * @retval None
  */
-uint8_t W25QXX_Write(uint16_t *pu16Data, uint32_t u32WriteAddr, uint32_t u32Size)
+void W25QXX_CacheInvalidate(uint32_t u32Addr, uint32_t u32Size)
 {
-    uint16_t u16Cmd[4];
-    uint32_t u32EndAddr, u32CurrentSize, u32CurrentAddr;
-    uint32_t u32DelayTick = 0;
+    uint32_t i;
+    uint32_t u32Tag;
 
-    /* Calculation of the size between the write address and the end of the page */
-    u32CurrentAddr = 0;
-
-    while (u32CurrentAddr <= u32WriteAddr)
+    if (0u == u32Size)
     {
-        u32CurrentAddr += W25QXX_PAGE_SIZE;
+        return;
     }
-    u32CurrentSize = u32CurrentAddr - u32WriteAddr;
 
-    /* Check if the size of the data is less than the remaining place in the page */
-    if (u32CurrentSize > u32Size)
+    for (i = 0u; i < m_u32CacheLineNum; i++)
     {
-        u32CurrentSize = u32Size;
+        u32Tag = m_pstcCacheLine[i].u32Tag;
+        if (W25QXX_CACHE_TAG_INVALID == u32Tag)
+        {
+            continue;
+        }
+        /* 行起始在范围之前时看范围起点是否落在行内，否则看行起始是否落在范围内 */
+        if ((u32Tag < u32Addr) ? ((u32Addr - u32Tag) < W25QXX_CACHE_LINE_SIZE) : ((u32Tag - u32Addr) < u32Size))
+        {
+            m_pstcCacheLine[i].u32Tag = W25QXX_CACHE_TAG_INVALID;
+        }
     }
+}
 
-    /* Initialize the adress variables */
-    u32CurrentAddr = u32WriteAddr;
-    u32EndAddr     = u32WriteAddr + u32Size;
+/**
+ * @brief  获取读缓存统计
+ * @param  pstcStat 统计输出
+ * @retval None
+ */
+void W25QXX_CacheStatGet(stc_w25qxx_cache_stat_t *pstcStat)
+{
+    *pstcStat = m_stcCacheStat;
+}
 
-    /* Perform the write page by page */
-    do
+/**
+ * @brief  读缓存统计清零
+ * @retval None
+ */
+void W25QXX_CacheStatClear(void)
+{
+    m_stcCacheStat.u32Hit   = 0u;
+    m_stcCacheStat.u32Miss  = 0u;
+    m_stcCacheStat.u32Evict = 0u;
+}
+
+/**
+ * @brief  This function reset the W25QXX
+ * @note   复位使能与复位为两条指令，各自一次片选
+ * @retval None
+ */
+static void W25QXX_Reset(void)
+{
+    W25QXX_CmdSend(RESET_ENABLE_CMD); /* 0x66 */
+    W25QXX_CmdSend(RESET_MEMORY_CMD); /* 0x99 */
+
+    DDL_Delay10us(3u); /* tRST */
+}
+
+/**
+ * @brief  占用总线：空闲时进入u8State
+ * @param  u8State 新状态
+ * @retval W25QXX_OK: 成功；W25QXX_BUSY: 擦除、连续读或其他操作进行中
+ */
+static uint8_t W25QXX_Acquire(uint8_t u8State)
+{
+    uint8_t  u8Ret = W25QXX_BUSY;
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (W25QXX_STATE_IDLE == m_u8State)
+    {
+        m_u8State = u8State;
+        u8Ret     = W25QXX_OK;
+    }
+    if (0u == u32Primask)
     {
-        /* Configure the command */
-        u16Cmd[0] = PAGE_PROG_CMD;
-        u16Cmd[1] = (uint16_t)(u32CurrentAddr >> 16);
-        u16Cmd[2] = (uint16_t)(u32CurrentAddr >> 8);
-        u16Cmd[3] = (uint16_t)(u32CurrentAddr);
+        __enable_irq();
+    }
 
-        W25QXX_WriteEnable(); /* Enable write operations */
+    return u8Ret;
+}
 
-        W25QXX_Enable();
+/**
+ * @brief  发送单字节指令（一次片选）
+ * @param  u8Cmd 指令
+ * @retval None
+ */
+static void W25QXX_CmdSend(uint8_t u8Cmd)
+{
+    W25QXX_Enable();
+    SPI_Transmit8(W25QXX_SPI, &u8Cmd, 1u, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable();
+}
 
-        /* Send the command */
-        SPI_TransmitReceive(SPI, u16Cmd, NULL, 4);
+/**
+ * @brief  Reads status register 1 of the W25QXX
+ * @retval uint8_t 状态寄存器1
+ */
+static uint8_t W25QXX_StatusRegRead(void)
+{
+    uint8_t u8Cmd = READ_STATUS_REG1_CMD; /* 0x05 */
+    uint8_t u8Status;
 
-        SPI_TransmitReceive(SPI, pu16Data, NULL, u32CurrentSize);
+    W25QXX_Enable(); /* enable w25qxx */
+    SPI_Transmit8(W25QXX_SPI, &u8Cmd, 1u, DDL_TIMEOUT_FOREVER);
+    SPI_Receive8(W25QXX_SPI, &u8Status, 1u, 0x00u, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable(); /* disable w25qxx */
 
-        W25QXX_Disable();
+    return u8Status;
+}
 
-        /* Wait the end of Flash writing */
-        while (W25QXX_StatusGet() == W25QXX_BUSY)
+/**
+ * @brief  等待BUSY清零
+ * @param  u32Timeout 等待时间（us）
+ * @retval W25QXX_OK: 成功；W25QXX_TIMEOUT: 超时
+ */
+static uint8_t W25QXX_WaitReady(uint32_t u32Timeout)
+{
+    stc_ddl_deadline_t stcDeadline;
+
+    DDL_DeadlineInit(&stcDeadline, u32Timeout);
+    while (0u != (W25QXX_StatusRegRead() & W25QXX_FSR_BUSY))
+    {
+        /* Check for the Timeout */
+        if (DDL_DeadlineExpired(&stcDeadline))
         {
-            /* Check for the Timeout */
-            if ((u32DelayTick++) > W25QXX_TIMEOUT_VALUE)
-            {
-                return W25QXX_TIMEOUT;
-            }
+            return W25QXX_TIMEOUT;
         }
-        /* Update the address and size variables for next page programming */
-        u32CurrentAddr += u32CurrentSize;
-        pu16Data       += u32CurrentSize;
-        u32CurrentSize  = ((u32CurrentAddr + W25QXX_PAGE_SIZE) > u32EndAddr) ? (u32EndAddr - u32CurrentAddr) : W25QXX_PAGE_SIZE;
-    } while (u32CurrentAddr < u32EndAddr);
+    }
 
     return W25QXX_OK;
 }
 
 /**
- * @brief  Erases the specified block of the QSPI memory
- * @param  u32Addr Block address to erase
- * @retval QSPI memory status
+ * @brief  发送写使能并确认WEL置位
+ * @retval W25QXX_OK: 成功；W25QXX_ERROR: WEL未置位
  */
-uint8_t W25QXX_BlockErase(uint32_t u32Addr)
+static uint8_t W25QXX_WelSet(void)
+{
+    W25QXX_CmdSend(WRITE_ENABLE_CMD); /* 0x06 */
+
+    return (0u != (W25QXX_StatusRegRead() & W25QXX_FSR_WREN)) ? W25QXX_OK : W25QXX_ERROR;
+}
+
+/**
+ * @brief  发送指令、3字节地址及u32Dummy个空字节（片选由调用者控制）
+ * @param  u8Cmd 指令
+ * @param  u32Addr 地址
+ * @param  u32Dummy 空字节数（0或1）
+ * @retval None
+ */
+static void W25QXX_AddrCmdSend(uint8_t u8Cmd, uint32_t u32Addr, uint32_t u32Dummy)
+{
+    uint8_t au8Cmd[5];
+
+    au8Cmd[0] = u8Cmd;
+    au8Cmd[1] = (uint8_t)(u32Addr >> 16);
+    au8Cmd[2] = (uint8_t)(u32Addr >> 8);
+    au8Cmd[3] = (uint8_t)(u32Addr);
+    au8Cmd[4] = 0x00u;
+
+    SPI_Transmit8(W25QXX_SPI, au8Cmd, 4u + u32Dummy, DDL_TIMEOUT_FOREVER);
+}
+
+/**
+ * @brief  读取JEDEC ID及SFDP基本参数表，更新m_stcInfo
+ * @note   基本参数表：DWORD2容量，DWORD8/9擦除类型（尺寸2^N及指令），DWORD11页尺寸（JESD216A及以后）；
+ *         容量超出3字节地址范围时只使用前16MB
+ * @retval None
+ */
+static void W25QXX_SfdpParse(void)
 {
-    uint16_t u16Cmd[4];
-    uint32_t u32DelayTick = 0;
+    uint8_t            au8Hdr[16];
+    uint8_t            au8Tbl[W25QXX_SFDP_DW_MAX * 4u];
+    uint32_t           au32Dw[W25QXX_SFDP_DW_MAX];
+    uint32_t           u32Len;
+    uint32_t           u32Ptp;
+    uint32_t           u32Exp;
+    uint32_t           i;
+    uint32_t           j;
+    stc_w25qxx_erase_t stcTmp;
+    stc_w25qxx_info_t  stcInfo  = m_stcInfoDefault;
+    uint8_t            au8Id[3] = {0};
+    uint8_t            u8Cmd    = READ_JEDEC_ID_CMD;
 
-    u16Cmd[0] = SECTOR_ERASE_CMD;  // 0X20
-    u16Cmd[1] = (uint16_t)(u32Addr >> 16);
-    u16Cmd[2] = (uint16_t)(u32Addr >> 8);
-    u16Cmd[3] = (uint16_t)(u32Addr);
+    W25QXX_Enable();
+    SPI_Transmit8(W25QXX_SPI, &u8Cmd, 1u, DDL_TIMEOUT_FOREVER);
+    SPI_Receive8(W25QXX_SPI, au8Id, 3u, 0xFFu, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable();
 
-    W25QXX_WriteEnable(); /* Enable write operations */
+    stcInfo.u32JedecId = ((uint32_t)au8Id[0] << 16) | ((uint32_t)au8Id[1] << 8) | au8Id[2];
+    if ((au8Id[2] >= 0x10u) && (au8Id[2] <= 0x18u))
+    {
+        stcInfo.u32Capacity = 1uL << au8Id[2];
+    }
+    m_stcInfo = stcInfo;
 
+    /* SFDP头：签名、参数头个数；第一个参数头须为基本参数表（ID 0xFF00） */
     W25QXX_Enable();
+    W25QXX_AddrCmdSend(READ_SFDP_CMD, 0u, W25QXX_FAST_READ_DUMMY_BYTES);
+    SPI_Receive8(W25QXX_SPI, au8Hdr, sizeof(au8Hdr), 0xFFu, DDL_TIMEOUT_FOREVER);
+    W25QXX_Disable();
 
-    /* Send the Block Erase command */
-    SPI_TransmitReceive(SPI, u16Cmd, NULL, 4);
+    if ((W25QXX_SFDP_SIGNATURE != (au8Hdr[0] | ((uint32_t)au8Hdr[1] << 8) | ((uint32_t)au8Hdr[2] << 16) | ((uint32_t)au8Hdr[3] << 24)))
+        || (0x00u != au8Hdr[8]) || (0x01u != au8Hdr[10]) || (au8Hdr[11] < 9u))
+    {
+        return;
+    }
+    u32Len = (au8Hdr[11] < W25QXX_SFDP_DW_MAX) ? au8Hdr[11] : W25QXX_SFDP_DW_MAX;
+    u32Ptp = au8Hdr[12] | ((uint32_t)au8Hdr[13] << 8) | ((uint32_t)au8Hdr[14] << 16);
 
-    /*Deselect the FLASH: Chip Select high */
+    W25QXX_Enable();
+    W25QXX_AddrCmdSend(READ_SFDP_CMD, u32Ptp, W25QXX_FAST_READ_DUMMY_BYTES);
+    SPI_Receive8(W25QXX_SPI, au8Tbl, u32Len * 4u, 0xFFu, DDL_TIMEOUT_FOREVER);
     W25QXX_Disable();
-    DDL_Delay1ms(100);
-    /* Wait the end of Flash writing */
-    while (W25QXX_StatusGet() == W25QXX_BUSY)
+
+    for (i = 0u; i < u32Len; i++)
     {
-        /* Check for the Timeout */
-        if ((u32DelayTick++) > W25QXX_SECTOR_ERASE_MAX_TIME)
+        au32Dw[i] = au8Tbl[4u * i] | ((uint32_t)au8Tbl[(4u * i) + 1u] << 8) | ((uint32_t)au8Tbl[(4u * i) + 2u] << 16)
+                    | ((uint32_t)au8Tbl[(4u * i) + 3u] << 24);
+    }
+
+    /* DWORD2：bit31为0时为位数-1，为1时位数为2^N */
+    if (0u == (au32Dw[1] & 0x80000000u))
+    {
+        stcInfo.u32Capacity = (au32Dw[1] >= ((W25QXX_ADDR_MAX * 8u) - 1u)) ? W25QXX_ADDR_MAX : ((au32Dw[1] + 1u) >> 3);
+    }
+    else
+    {
+        u32Exp              = au32Dw[1] & 0x7FFFFFFFu;
+        stcInfo.u32Capacity = (u32Exp >= 27u) ? W25QXX_ADDR_MAX : ((u32Exp >= 3u) ? (1uL << (u32Exp - 3u)) : 0u);
+    }
+
+    /* DWORD8/9：擦除类型1~4 */
+    for (i = 0u; i < 4u; i++)
+    {
+        u32Exp                       = (au32Dw[7u + (i >> 1)] >> ((i & 1u) * 16u)) & 0xFFu;
+        stcInfo.astcErase[i].u32Size = ((0u != u32Exp) && (u32Exp < 32u)) ? (1uL << u32Exp) : 0u;
+        stcInfo.astcErase[i].u8Cmd   = (uint8_t)(au32Dw[7u + (i >> 1)] >> (((i & 1u) * 16u) + 8u));
+    }
+    /* 按尺寸从小到大排列，不支持的类型放在最后 */
+    for (i = 1u; i < 4u; i++)
+    {
+        stcTmp = stcInfo.astcErase[i];
+        for (j = i; (j > 0u) && ((0u == stcInfo.astcErase[j - 1u].u32Size)
+                                 || ((0u != stcTmp.u32Size) && (stcTmp.u32Size < stcInfo.astcErase[j - 1u].u32Size)));
+             j--)
         {
-            return W25QXX_TIMEOUT;
+            stcInfo.astcErase[j] = stcInfo.astcErase[j - 1u];
         }
+        stcInfo.astcErase[j] = stcTmp;
     }
-    W25QXX_WriteDisable();
-    return W25QXX_OK;
+
+    /* DWORD11：页尺寸2^N */
+    if (u32Len >= 11u)
+    {
+        u32Exp              = (au32Dw[10] >> 4) & 0x0Fu;
+        stcInfo.u32PageSize = 1uL << u32Exp;
+    }
+    stcInfo.bSfdp = TRUE;
+
+    /* 参数无效时保留默认值 */
+    if ((0u != stcInfo.u32Capacity) && (0u != stcInfo.astcErase[0].u32Size) && (0u != stcInfo.u32PageSize)
+        && (stcInfo.u32PageSize <= stcInfo.astcErase[0].u32Size))
+    {
+        m_stcInfo = stcInfo;
+    }
+}
+
+/**
+ * @brief  查找缓存行：返回标签为u32LineAddr的行；未命中时返回无效行或最久未访问的行
+ * @param  u32LineAddr 行地址
+ * @retval stc_w25qxx_cache_line_t*
+ */
+static stc_w25qxx_cache_line_t *W25QXX_CacheLineGet(uint32_t u32LineAddr)
+{
+    stc_w25qxx_cache_line_t *pstcVictim = &m_pstcCacheLine[0];
+    uint32_t                 i;
+
+    for (i = 0u; i < m_u32CacheLineNum; i++)
+    {
+        if (u32LineAddr == m_pstcCacheLine[i].u32Tag)
+        {
+            return &m_pstcCacheLine[i];
+        }
+        if (W25QXX_CACHE_TAG_INVALID == pstcVictim->u32Tag)
+        {
+            continue;
+        }
+        if ((W25QXX_CACHE_TAG_INVALID == m_pstcCacheLine[i].u32Tag)
+            || ((int32_t)(m_pstcCacheLine[i].u32Stamp - pstcVictim->u32Stamp) < 0))
+        {
+            pstcVictim = &m_pstcCacheLine[i];
+        }
+    }
+
+    return pstcVictim;
 }
 
 /*******************************************************************************
@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2024-12-06       MADS            First version
+   2026-10-18       MADS            Use byte buffers for read and write
+   2026-10-18       MADS            Add FAST_READ streaming, SFDP geometry and timer-polled asynchronous erase
+   2026-10-18       MADS            Add LRU read cache with write/erase invalidation
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -48,6 +51,63 @@ extern "C" {
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup W25QXX_Global_Types W25QXX Global Types
+ * @{
+ */
+
+/**
+ * @brief  擦除类型（尺寸与指令）
+ */
+typedef struct
+{
+    uint32_t u32Size; /*!< 擦除尺寸（字节，2的幂），0表示不支持 */
+    uint8_t  u8Cmd;   /*!< 擦除指令 */
+} stc_w25qxx_erase_t;
+
+/**
+ * @brief  器件几何参数：W25QXX_Init()由SFDP基本参数表读出，无SFDP时按JEDEC ID容量字节及默认值推算
+ */
+typedef struct
+{
+    uint32_t           u32JedecId;   /*!< JEDEC ID：厂商（bit23:16）、类型（bit15:8）、容量（bit7:0） */
+    uint32_t           u32Capacity;  /*!< 容量（字节） */
+    uint32_t           u32PageSize;  /*!< 页编程尺寸（字节，2的幂） */
+    stc_w25qxx_erase_t astcErase[4]; /*!< 擦除类型，按尺寸从小到大排列 */
+    boolean_t          bSfdp;        /*!< TRUE: 参数来自SFDP */
+} stc_w25qxx_info_t;
+
+/**
+ * @brief  异步擦除完成回调：在调用W25QXX_ErasePoll()的定时器中断中调用，u8Status为W25QXX_OK或W25QXX_TIMEOUT
+ */
+typedef void (*func_ptr_w25qxx_erase_t)(uint32_t u32Addr, uint8_t u8Status);
+
+#define W25QXX_CACHE_LINE_SIZE (256u) /*!< 读缓存行尺寸（字节，按行对齐） */
+
+/**
+ * @brief  读缓存行：由调用者分配数组并交给W25QXX_CacheInit()，每行占用W25QXX_CACHE_LINE_SIZE+8字节
+ */
+typedef struct
+{
+    uint32_t u32Tag;                          /*!< 行对应的flash地址，W25QXX_CACHE_TAG_INVALID表示无效 */
+    uint32_t u32Stamp;                        /*!< 最近一次访问的序号，替换时选最小者（LRU） */
+    uint8_t  au8Data[W25QXX_CACHE_LINE_SIZE]; /*!< 行数据 */
+} stc_w25qxx_cache_line_t;
+
+/**
+ * @brief  读缓存统计（按行计数，一次读跨多行时每行计一次）
+ */
+typedef struct
+{
+    uint32_t u32Hit;   /*!< 命中次数 */
+    uint32_t u32Miss;  /*!< 未命中次数（每次从flash读入一行） */
+    uint32_t u32Evict; /*!< 替换有效行的次数 */
+} stc_w25qxx_cache_stat_t;
+
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
@@ -70,11 +130,13 @@ extern "C" {
 
 #define W25QXX_DUMMY_CYCLES_READ        (4u)
 #define W25QXX_DUMMY_CYCLES_READ_QUAD   (10u)
+#define W25QXX_FAST_READ_DUMMY_BYTES    (1u)         /*!< FAST_READ地址后8个空周期 */
 
-#define W25QXX_BULK_ERASE_MAX_TIME      (250000u)
-#define W25QXX_SECTOR_ERASE_MAX_TIME    (3000u)
-#define W25QXX_SUBSECTOR_ERASE_MAX_TIME (800u)
-#define W25QXX_TIMEOUT_VALUE            (0xFFFFFFu)
+/* 最大时间（us） */
+#define W25QXX_PAGE_PROG_MAX_TIME       (3000u)
+#define W25QXX_SECTOR_ERASE_MAX_TIME    (400000u)    /*!< 4KB擦除 */
+#define W25QXX_BLOCK_ERASE_MAX_TIME     (2000000u)   /*!< 32KB/64KB擦除 */
+#define W25QXX_REG_WRITE_MAX_TIME       (15000u)
 
 #define W25QXX_Enable()                 (SPI_MasterNSSOutput(W25QXX_SPI, SPI_NSS_CONFIG_ENABLE))  /* SPI CS置低 */
 #define W25QXX_Disable()                (SPI_MasterNSSOutput(W25QXX_SPI, SPI_NSS_CONFIG_DISABLE)) /* SPI CS置高 */
@@ -127,11 +189,17 @@ extern "C" {
 
 /* Erase Operations */
 #define SECTOR_ERASE_CMD       (0x20u)
+#define BLOCK_ERASE_32K_CMD    (0x52u)
+#define BLOCK_ERASE_64K_CMD    (0xD8u)
 #define CHIP_ERASE_CMD         (0xC7u)
 
 #define PROG_ERASE_RESUME_CMD  (0x7Au)
 #define PROG_ERASE_SUSPEND_CMD (0x75u)
 
+/* SFDP */
+#define READ_SFDP_CMD          (0x5Au)
+#define W25QXX_SFDP_SIGNATURE  (0x50444653u) /*!< "SFDP" */
+
 /* Flag Status Register */
 #define W25QXX_FSR_BUSY (0x01u) /*!< busy */
 #define W25QXX_FSR_WREN (0x02u) /*!< write enable */
@@ -142,6 +210,8 @@ extern "C" {
 #define W25QXX_BUSY     (0x02u)
 #define W25QXX_TIMEOUT  (0x03u)
 
+#define W25QXX_CACHE_TAG_INVALID (0xFFFFFFFFu) /*!< 无效缓存行 */
+
 /**
  * @}
  */
@@ -157,15 +227,27 @@ extern "C" {
  * @addtogroup SYSCTRL_Global_Functions SYSCTRL全局函数定义
  * @{
  */
-uint8_t        W25QXX_Init(void);                                                         /* W25QXX初始化 */
-static void    W25QXX_Reset(void);                                                        /* W25QXX复位 */
-static uint8_t W25QXX_StatusGet(void);                                                    /* W25QXX获取状态 */
-uint8_t        W25QXX_WriteEnable(void);                                                  /* W25QXX写使能 */
-uint8_t        W25QXX_WriteDisable(void);                                                 /* W25QXX写关闭 */
-uint16_t       W25QXX_ReadID(void);                                                       /* W25QXX读取ID */
-uint8_t        W25QXX_Read(uint16_t *pu16Data, uint32_t u32ReadAddr, uint32_t u32Size);   /* W25QXX读取数据 */
-uint8_t        W25QXX_Write(uint16_t *pu16Data, uint32_t u32WriteAddr, uint32_t u32Size); /* W25QXX写数据 */
-uint8_t        W25QXX_BlockErase(uint32_t u32Addr);                                       /* W25QXX擦除块 */
+uint8_t                  W25QXX_Init(void);                                                             /* W25QXX初始化 */
+const stc_w25qxx_info_t *W25QXX_InfoGet(void);                                                          /* W25QXX几何参数 */
+uint8_t                  W25QXX_WriteEnable(void);                                                      /* W25QXX写使能 */
+uint8_t                  W25QXX_WriteDisable(void);                                                     /* W25QXX写关闭 */
+uint16_t                 W25QXX_ReadID(void);                                                           /* W25QXX读取ID */
+uint32_t                 W25QXX_ReadJedecID(void);                                                      /* W25QXX读取JEDEC ID */
+uint8_t                  W25QXX_SfdpRead(uint8_t *pu8Data, uint32_t u32Addr, uint32_t u32Size);         /* W25QXX读取SFDP */
+uint8_t                  W25QXX_Read(uint8_t *pu8Data, uint32_t u32ReadAddr, uint32_t u32Size);         /* W25QXX读取数据 */
+uint8_t                  W25QXX_ReadStart(uint32_t u32ReadAddr);                                        /* W25QXX连续读开始 */
+uint8_t                  W25QXX_ReadContinue(uint8_t *pu8Data, uint32_t u32Size);                       /* W25QXX连续读数据 */
+void                     W25QXX_ReadStop(void);                                                         /* W25QXX连续读结束 */
+uint8_t                  W25QXX_Write(const uint8_t *pu8Data, uint32_t u32WriteAddr, uint32_t u32Size); /* W25QXX写数据 */
+uint8_t                  W25QXX_EraseStart(uint32_t u32Addr, uint32_t u32Size, func_ptr_w25qxx_erase_t pfnDone); /* W25QXX异步擦除开始 */
+uint8_t                  W25QXX_ErasePoll(void);                                                        /* W25QXX擦除状态轮询（定时器中断中调用） */
+uint8_t                  W25QXX_EraseStatusGet(void);                                                   /* W25QXX擦除状态 */
+uint8_t                  W25QXX_BlockErase(uint32_t u32Addr);                                           /* W25QXX擦除扇区（阻塞） */
+void                     W25QXX_CacheInit(stc_w25qxx_cache_line_t *pstcLine, uint32_t u32LineNum);      /* W25QXX读缓存初始化 */
+uint8_t                  W25QXX_CacheRead(uint8_t *pu8Data, uint32_t u32ReadAddr, uint32_t u32Size);    /* W25QXX经缓存读取数据 */
+void                     W25QXX_CacheInvalidate(uint32_t u32Addr, uint32_t u32Size);                    /* W25QXX读缓存失效 */
+void                     W25QXX_CacheStatGet(stc_w25qxx_cache_stat_t *pstcStat);                        /* W25QXX读缓存统计 */
+void                     W25QXX_CacheStatClear(void);                                                   /* W25QXX读缓存统计清零 */
 /**
  * @}
  */
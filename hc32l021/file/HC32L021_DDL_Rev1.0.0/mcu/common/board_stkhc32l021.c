@@ -99,12 +99,12 @@ void STK_LedConfig(void)
  */
 void STK_ChipInfoGet(stc_stk_chip_info_t *pstcChipInfo)
 {
-    memcpy((void *)(&pstcChipInfo->u8UID[0]), (uint8_t *)0x001008B4, 10);
-    pstcChipInfo->pcProductNum       = (char_t *)0x00100740u;
-    pstcChipInfo->u32FlashSize       = *((uint32_t *)0x00100760u);
-    pstcChipInfo->u32RamSize         = *((uint32_t *)0x00100764u);
-    pstcChipInfo->u16FlashSectorSize = *((uint16_t *)0x00100768u);
-    pstcChipInfo->u16PinCount        = *((uint16_t *)0x0010076Au);
+    memcpy((void *)(&pstcChipInfo->u8UID[0]), (uint8_t *)DDL_MEM_MAP(0x001008B4u), 10);
+    pstcChipInfo->pcProductNum       = (char_t *)DDL_MEM_MAP(0x00100740u);
+    pstcChipInfo->u32FlashSize       = RW_MEM32(0x00100760u);
+    pstcChipInfo->u32RamSize         = RW_MEM32(0x00100764u);
+    pstcChipInfo->u16FlashSectorSize = RW_MEM16(0x00100768u);
+    pstcChipInfo->u16PinCount        = RW_MEM16(0x0010076Au);
 }
 /**
  * @}
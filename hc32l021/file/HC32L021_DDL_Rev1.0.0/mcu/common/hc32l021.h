@@ -67,6 +67,11 @@ typedef enum IRQn
 #include <core_cm0plus.h>
 #include <stdint.h>
 
+/* 芯片地址到访问地址的映射：目标板上为恒等映射，主机寄存器模型（DDL_HOST_MODEL）中重定向到RAM */
+#ifndef DDL_MEM_MAP
+#define DDL_MEM_MAP(addr) (addr)
+#endif
+
 #define SUCCESS (0)
 #define ERROR   (-1)
 
@@ -3635,33 +3640,33 @@ typedef struct
 #define VC_BASE                                (PERIPH_BASE + 0x00002800UL)
 
 
-#define ADC                                    ((ADC_TypeDef *)0x40002400UL)
-#define ATIM3_MODE0                            ((ATIM3_MODE0_TypeDef *)0x40009800UL)
-#define ATIM3_MODE1                            ((ATIM3_MODE1_TypeDef *)0x40009800UL)
-#define ATIM3_MODE23                           ((ATIM3_MODE23_TypeDef *)0x40009800UL)
-#define BTIM0                                  ((BTIM_TypeDef *)0x40001800UL)
-#define BTIM1                                  ((BTIM_TypeDef *)0x40001900UL)
-#define BTIM2                                  ((BTIM_TypeDef *)0x40001A00UL)
-#define BTIM3                                  ((BTIM_TypeDef *)0x40001C00UL)
-#define BTIM4                                  ((BTIM_TypeDef *)0x40001D00UL)
-#define BTIM5                                  ((BTIM_TypeDef *)0x40001E00UL)
-#define CTRIM                                  ((CTRIM_TypeDef *)0x40009000UL)
-#define FLASH                                  ((FLASH_TypeDef *)0x40020000UL)
-#define GPIOA                                  ((GPIO_TypeDef *)0x40020C00UL)
-#define GPIOAUX                                ((GPIOAUX_TypeDef *)0x40020C00UL)
-#define GPIOB                                  ((GPIO_TypeDef *)0x40020C40UL)
-#define GTIM0                                  ((GTIM_TypeDef *)0x40001800UL)
-#define GTIM1                                  ((GTIM_TypeDef *)0x40001C00UL)
-#define HSI2C                                  ((HSI2C_TypeDef *)0x4000BC00UL)
-#define IWDT                                   ((IWDT_TypeDef *)0x40001000UL)
-#define LPUART0                                ((LPUART_TypeDef *)0x40000000UL)
-#define LPUART1                                ((LPUART_TypeDef *)0x40008000UL)
-#define LVD                                    ((LVD_TypeDef *)0x40002C00UL)
-#define RTC                                    ((RTC_TypeDef *)0x40001400UL)
-#define SPI                                    ((SPI_TypeDef *)0x40000800UL)
-#define SYSCTRL                                ((SYSCTRL_TypeDef *)0x40021800UL)
-#define TRNG                                   ((TRNG_TypeDef *)0x40008C00UL)
-#define VC                                     ((VC_TypeDef *)0x40002800UL)
+#define ADC                                    ((ADC_TypeDef *)DDL_MEM_MAP(0x40002400UL))
+#define ATIM3_MODE0                            ((ATIM3_MODE0_TypeDef *)DDL_MEM_MAP(0x40009800UL))
+#define ATIM3_MODE1                            ((ATIM3_MODE1_TypeDef *)DDL_MEM_MAP(0x40009800UL))
+#define ATIM3_MODE23                           ((ATIM3_MODE23_TypeDef *)DDL_MEM_MAP(0x40009800UL))
+#define BTIM0                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001800UL))
+#define BTIM1                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001900UL))
+#define BTIM2                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001A00UL))
+#define BTIM3                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001C00UL))
+#define BTIM4                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001D00UL))
+#define BTIM5                                  ((BTIM_TypeDef *)DDL_MEM_MAP(0x40001E00UL))
+#define CTRIM                                  ((CTRIM_TypeDef *)DDL_MEM_MAP(0x40009000UL))
+#define FLASH                                  ((FLASH_TypeDef *)DDL_MEM_MAP(0x40020000UL))
+#define GPIOA                                  ((GPIO_TypeDef *)DDL_MEM_MAP(0x40020C00UL))
+#define GPIOAUX                                ((GPIOAUX_TypeDef *)DDL_MEM_MAP(0x40020C00UL))
+#define GPIOB                                  ((GPIO_TypeDef *)DDL_MEM_MAP(0x40020C40UL))
+#define GTIM0                                  ((GTIM_TypeDef *)DDL_MEM_MAP(0x40001800UL))
+#define GTIM1                                  ((GTIM_TypeDef *)DDL_MEM_MAP(0x40001C00UL))
+#define HSI2C                                  ((HSI2C_TypeDef *)DDL_MEM_MAP(0x4000BC00UL))
+#define IWDT                                   ((IWDT_TypeDef *)DDL_MEM_MAP(0x40001000UL))
+#define LPUART0                                ((LPUART_TypeDef *)DDL_MEM_MAP(0x40000000UL))
+#define LPUART1                                ((LPUART_TypeDef *)DDL_MEM_MAP(0x40008000UL))
+#define LVD                                    ((LVD_TypeDef *)DDL_MEM_MAP(0x40002C00UL))
+#define RTC                                    ((RTC_TypeDef *)DDL_MEM_MAP(0x40001400UL))
+#define SPI                                    ((SPI_TypeDef *)DDL_MEM_MAP(0x40000800UL))
+#define SYSCTRL                                ((SYSCTRL_TypeDef *)DDL_MEM_MAP(0x40021800UL))
+#define TRNG                                   ((TRNG_TypeDef *)DDL_MEM_MAP(0x40008C00UL))
+#define VC                                     ((VC_TypeDef *)DDL_MEM_MAP(0x40002800UL))
 
 
 //********************    Bits Define For Peripheral ADC    ********************//
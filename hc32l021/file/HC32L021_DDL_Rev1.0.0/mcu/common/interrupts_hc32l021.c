@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2024-10-30       MADS            First version
+   2026-10-18       MADS            Add runtime callback dispatch
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -39,15 +40,36 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup INT_Local_Macros INT局部宏定义
+ * @{
+ */
+#define INT_VECTOR_NUM     (33u)                                   /* SysTick及32个外部中断 */
+#define INT_VECTOR_IDX(x)  ((uint32_t)((int32_t)(x) + 1))          /* SysTick_IRQn(-1)对应0 */
+#define INT_VECTOR_VALID   (0xDDC4C723u)                           /* 本芯片已实现的外部中断 */
+#define INT_IS_VALID_IRQ(x) ((SysTick_IRQn == (x)) || (((int32_t)(x) >= 0) && ((int32_t)(x) < 32) \
+                                                      && (0u != (INT_VECTOR_VALID & (1UL << (uint32_t)(x))))))
+
+#if defined(DDL_INT_LATENCY)
+#define INT_ENTRY_STAMP() (READ_REG32(SysTick->VAL)) /* 进入中断时刻 */
+#else
+#define INT_ENTRY_STAMP() (0u)
+#endif
+/**
+ * @}
+ */
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
  ******************************************************************************/
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static uint32_t INT_SrcFlagGet(IRQn_Type enIrq);
+static void     INT_Dispatch(IRQn_Type enIrq, uint32_t u32Entry);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static stc_int_cb_t *m_apstcIntCb[INT_VECTOR_NUM]; /* 各中断向量的回调链表 */
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -77,6 +99,152 @@ void EnableNvic(IRQn_Type enIrq, en_irq_priority_level_t enLevel, boolean_t bEn)
     }
 }
 
+/**
+ * @brief  注册中断回调
+ * @note   同一中断向量可注册多个回调，按注册顺序调用；中断标志在进入中断时读取一次，
+ *         按u32SrcMask匹配后传给回调。首个回调注册时经EnableNvic()使能中断，
+ *         中断优先级取该向量已注册回调中的最高优先级。SysTick只设置优先级。
+ * @param  [in] enIrq 中断号枚举类型 @ref IRQn_Type
+ * @param  [in] pstcCb 回调节点，调用前设置pfnCallback、pvArg、u32SrcMask @ref stc_int_cb_t
+ * @param  [in] enLevel 中断优先级枚举类型 @ref en_irq_priority_level_t
+ * @retval en_result_t
+ *         - Ok: 注册成功
+ *         - ErrorInvalidParameter: 参数错误或该中断号无对应向量
+ *         - ErrorInvalidMode: 该节点已注册
+ */
+en_result_t INT_CallbackRegister(IRQn_Type enIrq, stc_int_cb_t *pstcCb, en_irq_priority_level_t enLevel)
+{
+    stc_int_cb_t **ppstcNode;
+    uint32_t       u32Primask;
+    uint8_t        u8Level = (uint8_t)enLevel;
+
+    if ((NULL == pstcCb) || (NULL == pstcCb->pfnCallback) || (!INT_IS_VALID_IRQ(enIrq)) || (enLevel > IrqPriorityLevel3))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    for (ppstcNode = &m_apstcIntCb[INT_VECTOR_IDX(enIrq)]; NULL != *ppstcNode; ppstcNode = &(*ppstcNode)->pstcNext)
+    {
+        if (pstcCb == *ppstcNode)
+        {
+            if (0u == u32Primask)
+            {
+                __enable_irq();
+            }
+            return ErrorInvalidMode;
+        }
+        u8Level = ((*ppstcNode)->u8Level < u8Level) ? (*ppstcNode)->u8Level : u8Level;
+    }
+
+    pstcCb->pstcNext = NULL;
+    pstcCb->u8Level  = (uint8_t)enLevel;
+#if defined(DDL_INT_LATENCY)
+    INT_LatencyClear(pstcCb);
+#endif
+    *ppstcNode = pstcCb;
+
+    if ((SysTick_IRQn != enIrq) && (pstcCb == m_apstcIntCb[INT_VECTOR_IDX(enIrq)]))
+    {
+        EnableNvic(enIrq, enLevel, TRUE);
+    }
+    else
+    {
+        /* 已使能的中断不清除挂起 */
+        NVIC_SetPriority(enIrq, u8Level);
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  注销中断回调
+ * @note   注销该向量最后一个回调时经EnableNvic()禁止中断，否则按剩余回调更新优先级；
+ *         可在回调中注销自身
+ * @param  [in] enIrq 中断号枚举类型 @ref IRQn_Type
+ * @param  [in] pstcCb 已注册的回调节点 @ref stc_int_cb_t
+ * @retval en_result_t
+ *         - Ok: 注销成功
+ *         - ErrorInvalidParameter: 参数错误
+ *         - ErrorUninitialized: 该节点未注册
+ */
+en_result_t INT_CallbackUnregister(IRQn_Type enIrq, stc_int_cb_t *pstcCb)
+{
+    stc_int_cb_t **ppstcNode;
+    stc_int_cb_t  *pstcNode;
+    en_result_t    enRet = ErrorUninitialized;
+    uint32_t       u32Primask;
+    uint8_t        u8Level = (uint8_t)IrqPriorityLevel3;
+
+    if ((NULL == pstcCb) || (!INT_IS_VALID_IRQ(enIrq)))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    for (ppstcNode = &m_apstcIntCb[INT_VECTOR_IDX(enIrq)]; NULL != *ppstcNode; ppstcNode = &(*ppstcNode)->pstcNext)
+    {
+        if (pstcCb == *ppstcNode)
+        {
+            /* 保留节点的pstcNext，在回调中注销时分发继续 */
+            *ppstcNode = pstcCb->pstcNext;
+            enRet      = Ok;
+            break;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcNode = m_apstcIntCb[INT_VECTOR_IDX(enIrq)];
+        if (NULL == pstcNode)
+        {
+            if (SysTick_IRQn != enIrq)
+            {
+                EnableNvic(enIrq, (en_irq_priority_level_t)pstcCb->u8Level, FALSE);
+            }
+        }
+        else
+        {
+            for (; NULL != pstcNode; pstcNode = pstcNode->pstcNext)
+            {
+                u8Level = (pstcNode->u8Level < u8Level) ? pstcNode->u8Level : u8Level;
+            }
+            NVIC_SetPriority(enIrq, u8Level);
+        }
+    }
+
+    if (0u == u32Primask)
+    {
+        __enable_irq();
+    }
+
+    return enRet;
+}
+
+#if defined(DDL_INT_LATENCY)
+/**
+ * @brief  延迟统计清零
+ * @param  [in] pstcCb 回调节点 @ref stc_int_cb_t
+ * @retval None
+ */
+void INT_LatencyClear(stc_int_cb_t *pstcCb)
+{
+    pstcCb->stcLatency.u32Count = 0u;
+    pstcCb->stcLatency.u32Last  = 0u;
+    pstcCb->stcLatency.u32Min   = 0xFFFFFFFFu;
+    pstcCb->stcLatency.u32Max   = 0u;
+}
+#endif /* DDL_INT_LATENCY */
+
 /**
  * @defgroup INT_Weak_Functions 中断弱定义函数
  * @{
@@ -177,6 +345,10 @@ void HardFault_Handler(void)
  */
 void SysTick_Handler(void)
 {
+    uint32_t u32Entry = INT_ENTRY_STAMP();
+
+    DDL_TickIrqHandler();
+    INT_Dispatch(SysTick_IRQn, u32Entry);
     SysTick_IRQHandler();
 }
 
@@ -186,6 +358,7 @@ void SysTick_Handler(void)
  */
 void PORTA_IRQHandler(void)
 {
+    INT_Dispatch(PORTA_IRQn, INT_ENTRY_STAMP());
     PortA_IRQHandler();
 }
 
@@ -195,6 +368,7 @@ void PORTA_IRQHandler(void)
  */
 void PORTB_IRQHandler(void)
 {
+    INT_Dispatch(PORTB_IRQn, INT_ENTRY_STAMP());
     PortB_IRQHandler();
 }
 
@@ -204,6 +378,7 @@ void PORTB_IRQHandler(void)
  */
 void ATIM3_IRQHandler(void)
 {
+    INT_Dispatch(ATIM3_IRQn, INT_ENTRY_STAMP());
     Atim3_IRQHandler();
 }
 
@@ -213,6 +388,7 @@ void ATIM3_IRQHandler(void)
  */
 void LPUART0_IRQHandler(void)
 {
+    INT_Dispatch(LPUART0_IRQn, INT_ENTRY_STAMP());
     LpUart0_IRQHandler();
 }
 
@@ -222,6 +398,7 @@ void LPUART0_IRQHandler(void)
  */
 void LPUART1_IRQHandler(void)
 {
+    INT_Dispatch(LPUART1_IRQn, INT_ENTRY_STAMP());
     LpUart1_IRQHandler();
 }
 
@@ -231,6 +408,7 @@ void LPUART1_IRQHandler(void)
  */
 void SPI_IRQHandler(void)
 {
+    INT_Dispatch(SPI_IRQn, INT_ENTRY_STAMP());
     Spi_IRQHandler();
 }
 
@@ -240,6 +418,7 @@ void SPI_IRQHandler(void)
  */
 void CTIM0_IRQHandler(void)
 {
+    INT_Dispatch(CTIM0_IRQn, INT_ENTRY_STAMP());
     Ctim0_IRQHandler();
 }
 
@@ -249,6 +428,7 @@ void CTIM0_IRQHandler(void)
  */
 void CTIM1_IRQHandler(void)
 {
+    INT_Dispatch(CTIM1_IRQn, INT_ENTRY_STAMP());
     Ctim1_IRQHandler();
 }
 
@@ -258,6 +438,7 @@ void CTIM1_IRQHandler(void)
  */
 void HSI2C_IRQHandler(void)
 {
+    INT_Dispatch(HSI2C_IRQn, INT_ENTRY_STAMP());
     Hsi2c_IRQHandler();
 }
 
@@ -267,6 +448,7 @@ void HSI2C_IRQHandler(void)
  */
 void IWDT_IRQHandler(void)
 {
+    INT_Dispatch(IWDT_IRQn, INT_ENTRY_STAMP());
     Iwdt_IRQHandler();
 }
 
@@ -276,6 +458,7 @@ void IWDT_IRQHandler(void)
  */
 void RTC_IRQHandler(void)
 {
+    INT_Dispatch(RTC_IRQn, INT_ENTRY_STAMP());
     Rtc_IRQHandler();
 }
 
@@ -285,6 +468,7 @@ void RTC_IRQHandler(void)
  */
 void ADC_IRQHandler(void)
 {
+    INT_Dispatch(ADC_IRQn, INT_ENTRY_STAMP());
     Adc_IRQHandler();
 }
 
@@ -294,6 +478,7 @@ void ADC_IRQHandler(void)
  */
 void VC0_IRQHandler(void)
 {
+    INT_Dispatch(VC0_IRQn, INT_ENTRY_STAMP());
     Vc0_IRQHandler();
 }
 
@@ -303,6 +488,7 @@ void VC0_IRQHandler(void)
  */
 void VC1_IRQHandler(void)
 {
+    INT_Dispatch(VC1_IRQn, INT_ENTRY_STAMP());
     Vc1_IRQHandler();
 }
 
@@ -312,6 +498,7 @@ void VC1_IRQHandler(void)
  */
 void LVD_IRQHandler(void)
 {
+    INT_Dispatch(LVD_IRQn, INT_ENTRY_STAMP());
     Lvd_IRQHandler();
 }
 
@@ -321,6 +508,7 @@ void LVD_IRQHandler(void)
  */
 void FLASH_IRQHandler(void)
 {
+    INT_Dispatch(FLASH_IRQn, INT_ENTRY_STAMP());
     Flash_IRQHandler();
 }
 
@@ -330,9 +518,132 @@ void FLASH_IRQHandler(void)
  */
 void CTRIM_CLKDET_IRQHandler(void)
 {
+    INT_Dispatch(CTRIM_CLKDET_IRQn, INT_ENTRY_STAMP());
     Ctrim_Clkdet_IRQHandler();
 }
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup INT_Local_Functions INT局部函数定义
+ * @{
+ */
+
+/**
+ * @brief  读取中断向量的中断源标志 @ref INT_Src_Flag
+ * @param  [in] enIrq 中断号枚举类型 @ref IRQn_Type
+ * @retval uint32_t 中断源标志
+ */
+static uint32_t INT_SrcFlagGet(IRQn_Type enIrq)
+{
+    uint32_t u32Flags;
+
+    switch (enIrq)
+    {
+        case PORTA_IRQn:
+            u32Flags = READ_REG32(GPIOA->STAT);
+            break;
+        case PORTB_IRQn:
+            u32Flags = READ_REG32(GPIOB->STAT);
+            break;
+        case ATIM3_IRQn:
+            u32Flags = READ_REG32(ATIM3_MODE0->IFR);
+            break;
+        case LPUART0_IRQn:
+            u32Flags = READ_REG32(LPUART0->ISR);
+            break;
+        case LPUART1_IRQn:
+            u32Flags = READ_REG32(LPUART1->ISR);
+            break;
+        case SPI_IRQn:
+            u32Flags = READ_REG32(SPI->SR);
+            break;
+        case CTIM0_IRQn: /* BTIM0/1/2或GTIM0 */
+            u32Flags = (0u != READ_REG32_BIT(SYSCTRL->SYSCTRL1, SYSCTRL_SYSCTRL1_CTIMER0_FUN_SEL_Msk)) ? READ_REG32(BTIM0->AIFR)
+                                                                                                  : READ_REG32(GTIM0->IFR);
+            break;
+        case CTIM1_IRQn: /* BTIM3/4/5或GTIM1 */
+            u32Flags = (0u != READ_REG32_BIT(SYSCTRL->SYSCTRL1, SYSCTRL_SYSCTRL1_CTIMER1_FUN_SEL_Msk)) ? READ_REG32(BTIM3->AIFR)
+                                                                                                  : READ_REG32(GTIM1->IFR);
+            break;
+        case HSI2C_IRQn:
+            u32Flags = (READ_REG32(HSI2C->MSR) & INT_SRC_HSI2C_MASTER) | (READ_REG32(HSI2C->SSR) << 16u);
+            break;
+        case IWDT_IRQn:
+            u32Flags = READ_REG32(IWDT->SR);
+            break;
+        case RTC_IRQn:
+            u32Flags = READ_REG32(RTC->IFR);
+            break;
+        case ADC_IRQn:
+            u32Flags = READ_REG32(ADC->IFR);
+            break;
+        case VC0_IRQn:
+            u32Flags = READ_REG32(VC->VC0_SR);
+            break;
+        case VC1_IRQn:
+            u32Flags = READ_REG32(VC->VC1_SR);
+            break;
+        case LVD_IRQn:
+            u32Flags = READ_REG32(LVD->SR);
+            break;
+        case FLASH_IRQn:
+            u32Flags = READ_REG32(FLASH->IFR);
+            break;
+        case CTRIM_CLKDET_IRQn:
+            u32Flags = READ_REG32(CTRIM->ISR);
+            break;
+        default: /* SysTick */
+            u32Flags = 0u;
+            break;
+    }
+
+    return u32Flags;
+}
+
+/**
+ * @brief  中断回调分发：读取一次中断源标志，依次调用匹配的回调
+ * @param  [in] enIrq 中断号枚举类型 @ref IRQn_Type
+ * @param  [in] u32Entry 进入中断时的SysTick->VAL（仅DDL_INT_LATENCY时使用）
+ * @retval None
+ */
+static void INT_Dispatch(IRQn_Type enIrq, uint32_t u32Entry)
+{
+    stc_int_cb_t *pstcCb = m_apstcIntCb[INT_VECTOR_IDX(enIrq)];
+    uint32_t      u32Flags;
+#if defined(DDL_INT_LATENCY)
+    uint32_t u32Cycle;
+#endif
+
+    (void)u32Entry;
+    if (NULL == pstcCb)
+    {
+        return;
+    }
+
+    u32Flags = INT_SrcFlagGet(enIrq);
+    while (NULL != pstcCb)
+    {
+        if ((INT_SRC_ALL == pstcCb->u32SrcMask) || (0u != (u32Flags & pstcCb->u32SrcMask)))
+        {
+#if defined(DDL_INT_LATENCY)
+            /* SysTick向下计数，期间至多重装一次 */
+            u32Cycle = READ_REG32(SysTick->VAL);
+            u32Cycle = (u32Entry >= u32Cycle) ? (u32Entry - u32Cycle) : (u32Entry + READ_REG32(SysTick->LOAD) + 1u - u32Cycle);
+            pstcCb->stcLatency.u32Count++;
+            pstcCb->stcLatency.u32Last = u32Cycle;
+            pstcCb->stcLatency.u32Min  = (u32Cycle < pstcCb->stcLatency.u32Min) ? u32Cycle : pstcCb->stcLatency.u32Min;
+            pstcCb->stcLatency.u32Max  = (u32Cycle > pstcCb->stcLatency.u32Max) ? u32Cycle : pstcCb->stcLatency.u32Max;
+#endif
+            pstcCb->pfnCallback(u32Flags, pstcCb->pvArg);
+        }
+        /* 回调中注销的节点pstcNext不变 */
+        pstcCb = pstcCb->pstcNext;
+    }
+}
+
 /**
  * @}
  */
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-10-30       MADS            First version
+   2026-10-18       MADS            Add runtime callback dispatch
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -61,6 +62,40 @@ typedef enum
     IrqPriorityLevel2 = 0x2u, /*!< 优先级2*/
     IrqPriorityLevel3 = 0x3u, /*!< 优先级3*/
 } en_irq_priority_level_t;
+
+/**
+ * @brief 中断回调函数类型
+ * @note  u32Flags为进入中断时读取一次的中断源标志 @ref INT_Src_Flag ，回调中自行清除所处理的标志
+ */
+typedef void (*func_ptr_int_cb_t)(uint32_t u32Flags, void *pvArg);
+
+#if defined(DDL_INT_LATENCY)
+/**
+ * @brief 进入中断到调用回调的延迟统计（HCLK周期，SysTick->VAL计时）
+ */
+typedef struct
+{
+    uint32_t u32Count; /*!< 统计次数 */
+    uint32_t u32Last;  /*!< 最近一次延迟 */
+    uint32_t u32Min;   /*!< 最小延迟 */
+    uint32_t u32Max;   /*!< 最大延迟 */
+} stc_int_latency_t;
+#endif /* DDL_INT_LATENCY */
+
+/**
+ * @brief 中断回调节点（由调用者分配，注册期间不可释放）
+ */
+typedef struct stc_int_cb
+{
+    func_ptr_int_cb_t  pfnCallback; /*!< 回调函数 */
+    void              *pvArg;       /*!< 回调参数 */
+    uint32_t           u32SrcMask;  /*!< 关注的中断源标志 @ref INT_Src_Flag */
+    struct stc_int_cb *pstcNext;    /*!< 内部使用：同一中断向量的下一节点 */
+    uint8_t            u8Level;     /*!< 内部使用：注册的中断优先级 */
+#if defined(DDL_INT_LATENCY)
+    stc_int_latency_t stcLatency; /*!< 进入中断到调用本回调的延迟 */
+#endif
+} stc_int_cb_t;
 /**
  * @}
  */
@@ -68,6 +103,32 @@ typedef enum
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup INT_Global_Macros INT全局宏定义
+ * @{
+ */
+
+/**
+ * @defgroup INT_Src_Flag 中断源标志
+ * @brief    各中断向量传给回调的标志：
+ *           PORTA/PORTB：GPIOx->STAT（按引脚 @ref GPIO_Pins_Define ）；
+ *           CTIM0/CTIM1：BTIM模式为BTIM0/BTIM3的AIFR（ @ref BTIM_All_Int_Flag ，区分BTIM0~2或BTIM3~5），GTIM模式为GTIMx->IFR；
+ *           HSI2C：低16位为MSR[15:0]，高16位为SSR[15:0]；
+ *           ATIM3/RTC/ADC/FLASH：IFR；LPUARTx：ISR；SPI：SR；IWDT/LVD：SR；VC0/VC1：VCx_SR；CTRIM_CLKDET：CTRIM->ISR；
+ *           SysTick：0
+ * @{
+ */
+#define INT_SRC_ALL          (0xFFFFFFFFu) /*!< 每次进入中断均调用，不判断标志 */
+#define INT_SRC_HSI2C_MASTER (0x0000FFFFu) /*!< HSI2C主机标志 */
+#define INT_SRC_HSI2C_SLAVE  (0xFFFF0000u) /*!< HSI2C从机标志 */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global variable definitions ('extern')
  ******************************************************************************/
@@ -79,6 +140,12 @@ typedef enum
  * @{
  */
 void EnableNvic(IRQn_Type enIrq, en_irq_priority_level_t enLevel, boolean_t bEn); /* 中断使能 */
+
+en_result_t INT_CallbackRegister(IRQn_Type enIrq, stc_int_cb_t *pstcCb, en_irq_priority_level_t enLevel); /* 注册中断回调 */
+en_result_t INT_CallbackUnregister(IRQn_Type enIrq, stc_int_cb_t *pstcCb);                            /* 注销中断回调 */
+#if defined(DDL_INT_LATENCY)
+void INT_LatencyClear(stc_int_cb_t *pstcCb); /* 延迟统计清零 */
+#endif
 /**
  * @}
  */
@@ -88,7 +88,7 @@ void SystemCoreClockUpdate(void)
  */
 void SystemInit(void)
 {
-    SYSCTRL->RC48M_CR = (*((volatile uint32_t *)(0x001007BCul))); /* 加载RC48M Trim值 */
+    SYSCTRL->RC48M_CR = RW_MEM32(0x001007BCul); /* 加载RC48M Trim值 */
     FLASH->BYPASS = 0x5A5Au;
     FLASH->BYPASS = 0xA5A5u;
     FLASH->CR_f.RO = 1u; /* FLASH只读、不可编程或擦写 */
@@ -0,0 +1,289 @@
+/**
+ *******************************************************************************
+ * @file  core_cm0plus.h
+ * @brief Host (Linux) replacement of the CMSIS Cortex-M0+ core header, used
+ *        only by the host register-model build (DDL_HOST_MODEL)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __CORE_CM0PLUS_H__
+#define __CORE_CM0PLUS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdint.h>
+#include "host_model.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_HOST HOST寄存器模型
+ * @{
+ */
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup HOST_CMSIS_Macros HOST CMSIS编译器及内核宏定义
+ * @{
+ */
+#define __CM0PLUS_REV 0x0000U /*!< Core revision r0p0 */
+
+#define __I   volatile const /*!< 只读 */
+#define __O   volatile       /*!< 只写 */
+#define __IO  volatile       /*!< 读写 */
+#define __IM  volatile const /*!< 结构体成员只读 */
+#define __OM  volatile       /*!< 结构体成员只写 */
+#define __IOM volatile       /*!< 结构体成员读写 */
+
+#define __ASM           __asm__
+#define __INLINE        inline
+#define __STATIC_INLINE static inline
+#define __WEAK          __attribute__((weak))
+#define __PACKED        __attribute__((packed))
+#define __ALIGNED(x)    __attribute__((aligned(x)))
+#define __NO_RETURN     __attribute__((noreturn))
+
+#define __NOP()        HOST_CycleAdvance(1u)    /* NOP消耗一个模拟周期 */
+#define __WFI()        HOST_WaitForInterrupt()  /* 推进模拟时间直到下一个中断 */
+#define __WFE()        HOST_WaitForInterrupt()
+#define __SEV()        ((void)0)
+#define __ISB()        __asm__ volatile("" ::: "memory")
+#define __DSB()        __asm__ volatile("" ::: "memory")
+#define __DMB()        __asm__ volatile("" ::: "memory")
+#define __enable_irq()  HOST_PrimaskSet(0u)
+#define __disable_irq() HOST_PrimaskSet(1u)
+#define __get_PRIMASK() HOST_PrimaskGet()
+#define __set_PRIMASK(x) HOST_PrimaskSet(x)
+#define __get_IPSR()     HOST_IpsrGet()
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup HOST_CMSIS_Types HOST内核外设寄存器结构
+ * @{
+ */
+/**
+ * @brief NVIC寄存器结构
+ */
+typedef struct
+{
+    __IOM uint32_t ISER[1U];
+    uint32_t       RESERVED0[31U];
+    __IOM uint32_t ICER[1U];
+    uint32_t       RSERVED1[31U];
+    __IOM uint32_t ISPR[1U];
+    uint32_t       RESERVED2[31U];
+    __IOM uint32_t ICPR[1U];
+    uint32_t       RESERVED3[31U];
+    uint32_t       RESERVED4[64U];
+    __IOM uint32_t IP[8U];
+} NVIC_Type;
+
+/**
+ * @brief SCB寄存器结构
+ */
+typedef struct
+{
+    __IM uint32_t  CPUID;
+    __IOM uint32_t ICSR;
+    __IOM uint32_t VTOR;
+    __IOM uint32_t AIRCR;
+    __IOM uint32_t SCR;
+    __IOM uint32_t CCR;
+    uint32_t       RESERVED1;
+    __IOM uint32_t SHP[2U];
+    __IOM uint32_t SHCSR;
+} SCB_Type;
+
+/**
+ * @brief SysTick寄存器结构
+ */
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t LOAD;
+    __IOM uint32_t VAL;
+    __IM uint32_t  CALIB;
+} SysTick_Type;
+/**
+ * @}
+ */
+
+/**
+ * @defgroup HOST_CMSIS_Core_Macros HOST内核外设地址及位定义
+ * @{
+ */
+#define SCS_BASE     (0xE000E000UL)
+#define SysTick_BASE (SCS_BASE + 0x0010UL)
+#define NVIC_BASE    (SCS_BASE + 0x0100UL)
+#define SCB_BASE     (SCS_BASE + 0x0D00UL)
+
+#define SCB     ((SCB_Type *)DDL_MEM_MAP(SCB_BASE))
+#define SysTick ((SysTick_Type *)DDL_MEM_MAP(SysTick_BASE))
+#define NVIC    ((NVIC_Type *)DDL_MEM_MAP(NVIC_BASE))
+
+#define SCB_ICSR_PENDSTSET_Pos    26U
+#define SCB_ICSR_PENDSTSET_Msk    (1UL << SCB_ICSR_PENDSTSET_Pos)
+#define SCB_ICSR_PENDSTCLR_Pos    25U
+#define SCB_ICSR_PENDSTCLR_Msk    (1UL << SCB_ICSR_PENDSTCLR_Pos)
+#define SCB_ICSR_VECTACTIVE_Pos   0U
+#define SCB_ICSR_VECTACTIVE_Msk   (0x1FFUL << SCB_ICSR_VECTACTIVE_Pos)
+
+#define SCB_SCR_SEVONPEND_Pos     4U
+#define SCB_SCR_SEVONPEND_Msk     (1UL << SCB_SCR_SEVONPEND_Pos)
+#define SCB_SCR_SLEEPDEEP_Pos     2U
+#define SCB_SCR_SLEEPDEEP_Msk     (1UL << SCB_SCR_SLEEPDEEP_Pos)
+#define SCB_SCR_SLEEPONEXIT_Pos   1U
+#define SCB_SCR_SLEEPONEXIT_Msk   (1UL << SCB_SCR_SLEEPONEXIT_Pos)
+
+#define SysTick_CTRL_COUNTFLAG_Pos 16U
+#define SysTick_CTRL_COUNTFLAG_Msk (1UL << SysTick_CTRL_COUNTFLAG_Pos)
+#define SysTick_CTRL_CLKSOURCE_Pos 2U
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << SysTick_CTRL_CLKSOURCE_Pos)
+#define SysTick_CTRL_TICKINT_Pos   1U
+#define SysTick_CTRL_TICKINT_Msk   (1UL << SysTick_CTRL_TICKINT_Pos)
+#define SysTick_CTRL_ENABLE_Pos    0U
+#define SysTick_CTRL_ENABLE_Msk    (1UL << SysTick_CTRL_ENABLE_Pos)
+#define SysTick_LOAD_RELOAD_Pos    0U
+#define SysTick_LOAD_RELOAD_Msk    (0xFFFFFFUL << SysTick_LOAD_RELOAD_Pos)
+#define SysTick_VAL_CURRENT_Pos    0U
+#define SysTick_VAL_CURRENT_Msk    (0xFFFFFFUL << SysTick_VAL_CURRENT_Pos)
+
+#define _BIT_SHIFT(IRQn)         (((((uint32_t)(int32_t)(IRQn))) & 0x03UL) * 8UL)
+#define _SHP_IDX(IRQn)           ((((((uint32_t)(int32_t)(IRQn)) & 0x0FUL) - 8UL) >> 2UL))
+#define _IP_IDX(IRQn)            ((((uint32_t)(int32_t)(IRQn)) >> 2UL))
+/**
+ * @}
+ */
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @defgroup HOST_CMSIS_Functions HOST NVIC及SysTick函数
+ * @{
+ */
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ISER[0U] = (uint32_t)(1UL << (((uint32_t)IRQn) & 0x1FUL));
+    }
+}
+
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ICER[0U] = (uint32_t)(1UL << (((uint32_t)IRQn) & 0x1FUL));
+    }
+}
+
+__STATIC_INLINE uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((uint32_t)(((NVIC->ISPR[0U] & (1UL << (((uint32_t)IRQn) & 0x1FUL))) != 0UL) ? 1UL : 0UL));
+    }
+    return 0U;
+}
+
+__STATIC_INLINE void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ISPR[0U] = (uint32_t)(1UL << (((uint32_t)IRQn) & 0x1FUL));
+    }
+}
+
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ICPR[0U] = (uint32_t)(1UL << (((uint32_t)IRQn) & 0x1FUL));
+    }
+}
+
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->IP[_IP_IDX(IRQn)] = ((uint32_t)(NVIC->IP[_IP_IDX(IRQn)] & ~(0xFFUL << _BIT_SHIFT(IRQn)))
+                                   | (((priority << (8U - __NVIC_PRIO_BITS)) & (uint32_t)0xFFUL) << _BIT_SHIFT(IRQn)));
+    }
+    else
+    {
+        SCB->SHP[_SHP_IDX(IRQn)] = ((uint32_t)(SCB->SHP[_SHP_IDX(IRQn)] & ~(0xFFUL << _BIT_SHIFT(IRQn)))
+                                    | (((priority << (8U - __NVIC_PRIO_BITS)) & (uint32_t)0xFFUL) << _BIT_SHIFT(IRQn)));
+    }
+}
+
+__STATIC_INLINE uint32_t NVIC_GetPriority(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((uint32_t)(((NVIC->IP[_IP_IDX(IRQn)] >> _BIT_SHIFT(IRQn)) & (uint32_t)0xFFUL) >> (8U - __NVIC_PRIO_BITS)));
+    }
+    return ((uint32_t)(((SCB->SHP[_SHP_IDX(IRQn)] >> _BIT_SHIFT(IRQn)) & (uint32_t)0xFFUL) >> (8U - __NVIC_PRIO_BITS)));
+}
+
+__STATIC_INLINE uint32_t SysTick_Config(uint32_t ticks)
+{
+    if ((ticks - 1UL) > SysTick_LOAD_RELOAD_Msk)
+    {
+        return (1UL);
+    }
+
+    SysTick->LOAD = (uint32_t)(ticks - 1UL);
+    NVIC_SetPriority(SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    return (0UL);
+}
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_CM0PLUS_H__ */
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
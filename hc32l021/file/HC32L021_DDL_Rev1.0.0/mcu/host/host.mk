@@ -0,0 +1,82 @@
+################################################################################
+# @file  host.mk
+# @brief Common rules of the host (Linux x86_64) register-model build.
+#        Included by the HOST/Makefile of each example and by mcu/host/Makefile.
+#
+#   Change Logs:
+#   Date             Author          Notes
+#   2026-10-18       MADS            First version
+#
+# Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+#
+# This software component is licensed by XHSC under BSD 3-Clause license
+# (the "License"); You may not use this file except in compliance with the
+# License. You may obtain a copy of the License at:
+#                    opensource.org/licenses/BSD-3-Clause
+################################################################################
+
+# 调用方需设置:
+#   DDL_ROOT  驱动库根目录（含driver/、mcu/）
+#   TARGET    输出程序名（为空时只生成libddl_host.a）
+#   SRCS      用户源文件
+#   INCS      用户头文件目录（放在最前，其中有ddl_device.h时代替mcu/host/ddl_device.h；
+#             仅在主机上运行的测试不提供，使用mcu/host/ddl_device.h）
+# 可选:
+#   DDL_DEFS  驱动库及用户代码共用的编译宏，如-DDDL_MMIO_TRACE（寄存器访问跟踪）
+
+CC      ?= gcc
+AR      ?= ar
+OUT     ?= output
+
+HOST_DIR    := $(DDL_ROOT)/mcu/host
+DDL_SRCS    := $(wildcard $(DDL_ROOT)/driver/src/*.c)
+COMMON_SRCS := $(DDL_ROOT)/mcu/common/system_hc32l021.c \
+               $(DDL_ROOT)/mcu/common/interrupts_hc32l021.c \
+               $(DDL_ROOT)/mcu/common/board_stkhc32l021.c
+HOST_SRCS   := $(HOST_DIR)/host_model.c \
+               $(HOST_DIR)/host_periph.c
+START_SRCS  := $(HOST_DIR)/startup_host.c
+
+# host目录放在common之前，使<core_cm0plus.h>解析到主机版本
+CPPFLAGS += -DDDL_HOST_MODEL $(DDL_DEFS) $(addprefix -I,$(INCS)) -I$(HOST_DIR) -I$(DDL_ROOT)/mcu/common -I$(DDL_ROOT)/driver/inc
+CFLAGS   ?= -O2 -g
+CPPFLAGS += -MMD -MP
+CFLAGS   += -std=gnu11 -Wall -fno-strict-aliasing
+# 与Cortex-M0+一致：单次访存不超过32位，循环不替换为库函数，使模型统计的访问次数与目标板相同
+CFLAGS   += -fno-tree-vectorize -fno-store-merging -fno-tree-loop-distribute-patterns
+
+LIB_OBJS := $(patsubst $(DDL_ROOT)/%.c,$(OUT)/ddl/%.o,$(DDL_SRCS) $(COMMON_SRCS) $(HOST_SRCS))
+APP_OBJS := $(patsubst %.c,$(OUT)/app/%.o,$(notdir $(SRCS) $(START_SRCS)))
+
+# 按SRCS顺序查找，同名文件以先列出的目录为准
+vpath %.c $(dir $(SRCS) $(START_SRCS))
+
+.PHONY: all run clean
+
+ifneq ($(TARGET),)
+all: $(OUT)/$(TARGET)
+else
+all: $(OUT)/libddl_host.a
+endif
+
+$(OUT)/libddl_host.a: $(LIB_OBJS)
+	$(AR) rcs $@ $^
+
+$(OUT)/$(TARGET): $(APP_OBJS) $(OUT)/libddl_host.a
+	$(CC) $(CFLAGS) -o $@ $(APP_OBJS) $(OUT)/libddl_host.a $(LDLIBS) -lm
+
+$(OUT)/ddl/%.o: $(DDL_ROOT)/%.c
+	@mkdir -p $(dir $@)
+	$(CC) $(CPPFLAGS) $(CFLAGS) -c -o $@ $<
+
+$(OUT)/app/%.o: %.c
+	@mkdir -p $(dir $@)
+	$(CC) $(CPPFLAGS) $(CFLAGS) -c -o $@ $<
+
+-include $(LIB_OBJS:.o=.d) $(APP_OBJS:.o=.d)
+
+run: all
+	./$(OUT)/$(TARGET)
+
+clean:
+	rm -rf $(OUT)
@@ -0,0 +1,1211 @@
+/**
+ *******************************************************************************
+ * @file  host_model.c
+ * @brief This file provides the host register model: every peripheral
+ *        instance of hc32l021.h is redirected into RAM, each bus access is
+ *        trapped, counted and passed through per-register read/write hooks
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+   2026-10-18       MADS            Return to sleep after an interrupt when SLEEPONEXIT is set
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "ddl.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "The host register model requires x86_64 Linux (page protection + single step)."
+#endif
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @defgroup DDL_HOST HOST寄存器模型
+ * @brief Host register model HOST寄存器模型
+ *
+ * 总线视图（pu8HostBus）上的外设页面平时处于PROT_NONE状态，驱动的每一次寄存器访问都会
+ * 产生SIGSEGV：处理函数调用读钩子、临时开放该页并置位TF单步执行该指令，随后的SIGTRAP
+ * 重新保护页面、调用写钩子、推进模拟时间并在安全点执行挂起的中断。钩子及外设模型只通过
+ * 后门视图（HOST_RegRead/HOST_RegWrite）访问寄存器，不会再次触发陷入。
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  模型地址区间
+ */
+typedef struct
+{
+    uint32_t               u32Base;    /*!< 芯片地址 */
+    uint32_t               u32Size;    /*!< 大小（页对齐） */
+    uint32_t               u32Offset;  /*!< 在后门视图中的偏移 */
+    host_reg_read_hook_t  *ppfnRead;   /*!< 每个32位寄存器的读钩子 */
+    host_reg_write_hook_t *ppfnWrite;  /*!< 每个32位寄存器的写钩子 */
+} stc_host_region_t;
+
+/**
+ * @brief  单步执行中的访问
+ */
+typedef struct
+{
+    uint8_t            u8Armed;   /*!< 单步进行中 */
+    uint8_t            u8Write;   /*!< 写访问 */
+    uint32_t           u32Reg;    /*!< 寄存器地址（字对齐） */
+    uint32_t           u32Old;    /*!< 访问前的寄存器值 */
+    uint32_t           u32Clear;  /*!< 读后清零的位 */
+    uint8_t           *pu8Page;   /*!< 临时开放的页 */
+    stc_host_region_t *pstcRegion; /*!< 所属区间 */
+} stc_host_step_t;
+
+/**
+ * @brief  模拟时间事件
+ */
+typedef struct
+{
+    uint64_t          u64Cycle; /*!< 到期周期 */
+    host_event_func_t pfnEvent; /*!< 回调 */
+    void             *pvArg;    /*!< 回调参数 */
+} stc_host_event_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define HOST_BUS_SIZE   (0x100000000ULL) /* 总线视图大小（4GB地址空间） */
+#define HOST_PAGE_SIZE  (0x1000u)
+#define HOST_EFLAGS_TF  (0x100u)
+#define HOST_PRIO_NONE  (4)              /* 线程模式优先级（低于所有中断） */
+#define HOST_CPUID      (0x410CC601u)    /* Cortex-M0+ r0p1 */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+uint8_t *pu8HostBus = NULL;
+
+extern void (*const HOST_VectorTable[16u + HOST_IRQ_NUM])(void);
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void     HostTimeAdvanceTo(uint64_t u64Target);
+static void     HostSysTickUpdate(void);
+static uint32_t HostNvicRead(uint32_t u32Addr, uint32_t u32Value);
+static uint32_t HostNvicWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New);
+static uint32_t HostSysTickRead(uint32_t u32Addr, uint32_t u32Value);
+static uint32_t HostSysTickWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New);
+static uint32_t HostIcsrRead(uint32_t u32Addr, uint32_t u32Value);
+static uint32_t HostIcsrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_host_region_t m_astcRegion[] = {
+    {0x00000000u, 0x00010000u, 0u, NULL, NULL}, /* FLASH存储阵列 64KB */
+    {0x00100000u, 0x00001000u, 0u, NULL, NULL}, /* 信息区（Trim值、芯片信息） */
+    {0x20000000u, 0x00002000u, 0u, NULL, NULL}, /* SRAM 6KB，按页对齐（供需要统计访存次数的代码经DDL_MEM_MAP()访问） */
+    {0x40000000u, 0x00022000u, 0u, NULL, NULL}, /* 外设寄存器 */
+    {0xE000E000u, 0x00001000u, 0u, NULL, NULL}, /* 内核外设（SysTick/NVIC/SCB） */
+};
+
+static stc_host_periph_stat_t m_astcPeriph[] = {
+    {"LPUART0", 0x40000000u, 0x400u, 0u, 0u},
+    {"SPI", 0x40000800u, 0x400u, 0u, 0u},
+    {"IWDT", 0x40001000u, 0x400u, 0u, 0u},
+    {"RTC", 0x40001400u, 0x400u, 0u, 0u},
+    {"CTIM0", 0x40001800u, 0x400u, 0u, 0u},
+    {"CTIM1", 0x40001C00u, 0x400u, 0u, 0u},
+    {"ADC", 0x40002400u, 0x400u, 0u, 0u},
+    {"VC", 0x40002800u, 0x400u, 0u, 0u},
+    {"LVD", 0x40002C00u, 0x400u, 0u, 0u},
+    {"LPUART1", 0x40008000u, 0x400u, 0u, 0u},
+    {"TRNG", 0x40008C00u, 0x400u, 0u, 0u},
+    {"CTRIM", 0x40009000u, 0x400u, 0u, 0u},
+    {"ATIM3", 0x40009800u, 0x400u, 0u, 0u},
+    {"HSI2C", 0x4000BC00u, 0x400u, 0u, 0u},
+    {"FLASH", 0x40020000u, 0x400u, 0u, 0u},
+    {"GPIO", 0x40020C00u, 0x400u, 0u, 0u},
+    {"SYSCTRL", 0x40021800u, 0x400u, 0u, 0u},
+    {"FLASHMEM", 0x00000000u, 0x10000u, 0u, 0u},
+    {"INFO", 0x00100000u, 0x1000u, 0u, 0u},
+    {"SRAM", 0x20000000u, 0x1800u, 0u, 0u},
+    {"SysTick", 0xE000E010u, 0x10u, 0u, 0u},
+    {"NVIC", 0xE000E100u, 0x400u, 0u, 0u},
+    {"SCB", 0xE000ED00u, 0x100u, 0u, 0u},
+    {"OTHER", 0x00000000u, 0x0u, 0u, 0u},
+};
+
+static uint8_t               *m_pu8Alias = NULL; /* 后门视图 */
+static volatile stc_host_step_t m_stcStep;
+static host_trace_hook_t      m_pfnTrace = NULL;
+static stc_host_access_stat_t m_stcStat;
+
+static uint64_t         m_u64Cycle       = 0u;
+static uint32_t         m_u32AccessCycle = HOST_ACCESS_CYCLES_DEFAULT;
+static stc_host_event_t m_astcEvent[HOST_EVENT_MAX];
+static uint32_t         m_u32EventCnt = 0u;
+
+static host_irq_level_t m_apfnIrqLevel[HOST_IRQ_NUM];
+
+static uint32_t m_u32IrqEnable  = 0u;
+static uint32_t m_u32IrqPending = 0u;
+static uint8_t  m_u8SysTickPending = 0u;
+static uint32_t m_u32Primask    = 0u;
+static int32_t  m_i32ActivePrio = HOST_PRIO_NONE;
+static uint8_t  m_u8InHandler   = 0u;
+static uint32_t m_u32Ipsr       = 0u; /* 当前异常号（线程模式为0） */
+static uint8_t  m_u8InWfi       = 0u; /* HOST_WaitForInterrupt()执行中 */
+
+static uint64_t m_u64StStart = 0u; /* SysTick开始计数时的周期 */
+static uint32_t m_u32StStartVal = 0u; /* 开始计数时的VAL */
+static uint64_t m_u64StHits  = 0u; /* 已处理的计数到0次数 */
+static uint32_t m_u32StFrozen = 0u; /* 停止时的VAL */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  查找地址所属区间
+ * @param  [in] u32Addr 芯片地址
+ * @retval stc_host_region_t* 区间，不属于模型时返回NULL
+ */
+static stc_host_region_t *HostRegionFind(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0u; i < ARRAY_SZ(m_astcRegion); i++)
+    {
+        if ((u32Addr >= m_astcRegion[i].u32Base) && ((u32Addr - m_astcRegion[i].u32Base) < m_astcRegion[i].u32Size))
+        {
+            return &m_astcRegion[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  统计单次访问
+ * @param  [in] u32Addr 芯片地址
+ * @param  [in] u8Write 写访问
+ * @retval None
+ */
+static void HostAccessCount(uint32_t u32Addr, uint8_t u8Write)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (ARRAY_SZ(m_astcPeriph) - 1u); i++)
+    {
+        if ((u32Addr >= m_astcPeriph[i].u32Base) && ((u32Addr - m_astcPeriph[i].u32Base) < m_astcPeriph[i].u32Size))
+        {
+            break;
+        }
+    }
+
+    if (u8Write)
+    {
+        m_astcPeriph[i].u64Write++;
+        m_stcStat.u64Write++;
+    }
+    else
+    {
+        m_astcPeriph[i].u64Read++;
+        m_stcStat.u64Read++;
+    }
+}
+
+/**
+ * @brief  判断指令是否为纯写（不读取目标）指令
+ * @param  [in] pu8Ip 指令地址
+ * @retval uint8_t 1: 纯写 0: 读-改-写
+ */
+static uint8_t HostIsPureStore(const uint8_t *pu8Ip)
+{
+    uint8_t u8Op;
+
+    while (((*pu8Ip >= 0x40u) && (*pu8Ip <= 0x4Fu)) || (0x66u == *pu8Ip) || (0x67u == *pu8Ip) || (0xF2u == *pu8Ip) || (0xF3u == *pu8Ip)
+           || (0x2Eu == *pu8Ip) || (0x3Eu == *pu8Ip) || (0x26u == *pu8Ip) || (0x36u == *pu8Ip) || (0x64u == *pu8Ip) || (0x65u == *pu8Ip))
+    {
+        pu8Ip++;
+    }
+
+    u8Op = pu8Ip[0];
+    if ((0x88u == u8Op) || (0x89u == u8Op) || (0xC6u == u8Op) || (0xC7u == u8Op) || (0xA2u == u8Op) || (0xA3u == u8Op) || (0xA4u == u8Op)
+        || (0xA5u == u8Op) || (0xAAu == u8Op) || (0xABu == u8Op))
+    {
+        return 1u;
+    }
+    if (0x0Fu == u8Op)
+    {
+        u8Op = pu8Ip[1];
+        if ((0x11u == u8Op) || (0x13u == u8Op) || (0x17u == u8Op) || (0x29u == u8Op) || (0x2Bu == u8Op) || (0x7Eu == u8Op) || (0x7Fu == u8Op)
+            || (0xC3u == u8Op) || (0xD6u == u8Op) || (0xE7u == u8Op))
+        {
+            return 1u;
+        }
+    }
+    return 0u;
+}
+
+/**
+ * @brief  总线访问陷入（访问前）
+ * @retval None
+ */
+static void HostSegvHandler(int32_t i32Sig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    ucontext_t        *pstcCtx = (ucontext_t *)pvCtx;
+    uintptr_t          uAddr   = (uintptr_t)pstcInfo->si_addr;
+    stc_host_region_t *pstcRegion;
+    uint32_t           u32Addr;
+    uint32_t           u32Idx;
+    uint32_t          *pu32Reg;
+    uint8_t            u8Write;
+
+    (void)i32Sig;
+
+    if ((NULL == pu8HostBus) || (uAddr < (uintptr_t)pu8HostBus) || (uAddr >= ((uintptr_t)pu8HostBus + HOST_BUS_SIZE)) || m_stcStep.u8Armed)
+    {
+        signal(SIGSEGV, SIG_DFL); /* 非模型地址：按普通段错误处理 */
+        return;
+    }
+
+    u32Addr    = (uint32_t)(uAddr - (uintptr_t)pu8HostBus);
+    pstcRegion = HostRegionFind(u32Addr);
+    if (NULL == pstcRegion)
+    {
+        fprintf(stderr, "host model: bus fault at 0x%08X (pc=%p)\n", (unsigned)u32Addr, (void *)pstcCtx->uc_mcontext.gregs[REG_RIP]);
+        abort();
+    }
+
+    u8Write = (0u != (pstcCtx->uc_mcontext.gregs[REG_ERR] & 0x2)) ? 1u : 0u;
+    u32Idx  = (u32Addr - pstcRegion->u32Base) >> 2u;
+    pu32Reg = (uint32_t *)(m_pu8Alias + pstcRegion->u32Offset + (u32Idx << 2u));
+
+    m_stcStep.u32Clear = 0u;
+    if ((0u == u8Write) || (0u == HostIsPureStore((const uint8_t *)pstcCtx->uc_mcontext.gregs[REG_RIP])))
+    {
+        if (NULL != pstcRegion->ppfnRead[u32Idx])
+        {
+            *pu32Reg = pstcRegion->ppfnRead[u32Idx](u32Addr & ~3u, *pu32Reg);
+        }
+        HostAccessCount(u32Addr, 0u);
+        if (NULL != m_pfnTrace)
+        {
+            m_pfnTrace(u32Addr, *pu32Reg, 0u, m_u64Cycle);
+        }
+    }
+
+    m_stcStep.u8Write    = u8Write;
+    m_stcStep.u32Reg     = u32Addr & ~3u;
+    m_stcStep.u32Old     = *pu32Reg;
+    m_stcStep.pstcRegion = pstcRegion;
+    m_stcStep.pu8Page    = (uint8_t *)(uAddr & ~(uintptr_t)(HOST_PAGE_SIZE - 1u));
+    m_stcStep.u8Armed    = 1u;
+
+    mprotect(m_stcStep.pu8Page, HOST_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    pstcCtx->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TF;
+}
+
+/**
+ * @brief  总线访问单步完成（访问后）
+ * @retval None
+ */
+static void HostTrapHandler(int32_t i32Sig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    ucontext_t        *pstcCtx = (ucontext_t *)pvCtx;
+    stc_host_region_t *pstcRegion;
+    uint32_t           u32Idx;
+    uint32_t          *pu32Reg;
+    uint32_t           u32Reg;
+    uint32_t           u32Old;
+
+    (void)i32Sig;
+    (void)pstcInfo;
+
+    if (0u == m_stcStep.u8Armed)
+    {
+        signal(SIGTRAP, SIG_DFL);
+        raise(SIGTRAP);
+        return;
+    }
+
+    mprotect(m_stcStep.pu8Page, HOST_PAGE_SIZE, PROT_NONE);
+    pstcCtx->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)HOST_EFLAGS_TF;
+    m_stcStep.u8Armed = 0u;
+
+    pstcRegion = m_stcStep.pstcRegion;
+    u32Reg     = m_stcStep.u32Reg;
+    u32Old     = m_stcStep.u32Old;
+    u32Idx     = (u32Reg - pstcRegion->u32Base) >> 2u;
+    pu32Reg    = (uint32_t *)(m_pu8Alias + pstcRegion->u32Offset + (u32Idx << 2u));
+
+    if (m_stcStep.u8Write || (*pu32Reg != u32Old))
+    {
+        if (NULL != pstcRegion->ppfnWrite[u32Idx])
+        {
+            *pu32Reg = pstcRegion->ppfnWrite[u32Idx](u32Reg, u32Old, *pu32Reg);
+        }
+        HostAccessCount(u32Reg, 1u);
+        if (NULL != m_pfnTrace)
+        {
+            m_pfnTrace(u32Reg, *pu32Reg, 1u, m_u64Cycle);
+        }
+    }
+    *pu32Reg &= ~m_stcStep.u32Clear;
+
+    HostTimeAdvanceTo(m_u64Cycle + m_u32AccessCycle);
+    HOST_IrqDispatch();
+}
+
+/**
+ * @brief  寄存器模型初始化：建立总线视图与后门视图并安装陷入处理
+ * @retval None
+ */
+void HOST_ModelInit(void)
+{
+    struct sigaction stcAct;
+    uint32_t         u32Total = 0u;
+    uint32_t         i;
+    int32_t          i32Fd;
+
+    if (NULL != pu8HostBus)
+    {
+        return;
+    }
+
+    for (i = 0u; i < ARRAY_SZ(m_astcRegion); i++)
+    {
+        m_astcRegion[i].u32Offset = u32Total;
+        u32Total += m_astcRegion[i].u32Size;
+        m_astcRegion[i].ppfnRead  = calloc(m_astcRegion[i].u32Size / 4u, sizeof(host_reg_read_hook_t));
+        m_astcRegion[i].ppfnWrite = calloc(m_astcRegion[i].u32Size / 4u, sizeof(host_reg_write_hook_t));
+    }
+
+    i32Fd = memfd_create("hc32l021-regs", 0);
+    if ((i32Fd < 0) || (0 != ftruncate(i32Fd, u32Total)))
+    {
+        perror("host model: memfd");
+        exit(1);
+    }
+
+    m_pu8Alias = mmap(NULL, u32Total, PROT_READ | PROT_WRITE, MAP_SHARED, i32Fd, 0);
+    pu8HostBus = mmap(NULL, HOST_BUS_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if ((MAP_FAILED == (void *)m_pu8Alias) || (MAP_FAILED == (void *)pu8HostBus))
+    {
+        perror("host model: mmap");
+        exit(1);
+    }
+
+    for (i = 0u; i < ARRAY_SZ(m_astcRegion); i++)
+    {
+        if (MAP_FAILED
+            == mmap(pu8HostBus + m_astcRegion[i].u32Base, m_astcRegion[i].u32Size, PROT_NONE, MAP_SHARED | MAP_FIXED, i32Fd,
+                    (off_t)m_astcRegion[i].u32Offset))
+        {
+            perror("host model: region mmap");
+            exit(1);
+        }
+    }
+    close(i32Fd);
+
+    memset(&stcAct, 0, sizeof(stcAct));
+    stcAct.sa_flags     = SA_SIGINFO | SA_NODEFER;
+    stcAct.sa_sigaction = (void (*)(int, siginfo_t *, void *))HostSegvHandler;
+    sigaction(SIGSEGV, &stcAct, NULL);
+    sigaction(SIGBUS, &stcAct, NULL);
+    stcAct.sa_sigaction = (void (*)(int, siginfo_t *, void *))HostTrapHandler;
+    sigaction(SIGTRAP, &stcAct, NULL);
+
+    HOST_ModelReset();
+}
+
+/**
+ * @brief  寄存器模型复位：寄存器恢复复位值，钩子、统计、事件及模拟时间清零
+ * @retval None
+ */
+void HOST_ModelReset(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < ARRAY_SZ(m_astcRegion); i++)
+    {
+        memset(m_pu8Alias + m_astcRegion[i].u32Offset, 0, m_astcRegion[i].u32Size);
+        memset(m_astcRegion[i].ppfnRead, 0, (m_astcRegion[i].u32Size / 4u) * sizeof(host_reg_read_hook_t));
+        memset(m_astcRegion[i].ppfnWrite, 0, (m_astcRegion[i].u32Size / 4u) * sizeof(host_reg_write_hook_t));
+    }
+
+    /* FLASH为擦除状态 */
+    memset(HOST_MemPtr(0x00000000u), 0xFF, 0x10000u);
+
+    /* 信息区：芯片信息 */
+    memcpy(HOST_MemPtr(0x00100740u), "HC32L021", sizeof("HC32L021"));
+    HOST_RegWrite(0x00100760u, 64u * 1024u);
+    HOST_RegWrite(0x00100764u, 6u * 1024u);
+    HOST_RegWrite(0x00100768u, (20u << 16u) | 512u);
+
+    /* 信息区：RC48M/RCL Trim值（RC48M_CR.FSEL与目标频率对应） */
+    HOST_RegWrite(0x001007B0u, (3u << SYSCTRL_RC48M_CR_FSEL_Pos) | 0x200u);
+    HOST_RegWrite(0x001007B4u, (2u << SYSCTRL_RC48M_CR_FSEL_Pos) | 0x200u);
+    HOST_RegWrite(0x001007B8u, (1u << SYSCTRL_RC48M_CR_FSEL_Pos) | 0x200u);
+    HOST_RegWrite(0x001007BCu, (0u << SYSCTRL_RC48M_CR_FSEL_Pos) | 0x200u);
+    HOST_RegWrite(0x001007A8u, 0x180u);
+    HOST_RegWrite(0x001007ACu, 0x1C0u);
+
+    /* 内核外设 */
+    HOST_RegWrite(SCB_BASE + 0x00u, HOST_CPUID);
+    HOST_RegWrite(SysTick_BASE + 0x0Cu, 0x40000000u); /* CALIB: NOREF */
+
+    m_pfnTrace = NULL;
+    memset(&m_stcStat, 0, sizeof(m_stcStat));
+    HOST_AccessStatClear();
+    m_u64Cycle         = 0u;
+    m_u32AccessCycle   = HOST_ACCESS_CYCLES_DEFAULT;
+    m_u32EventCnt      = 0u;
+    m_u32IrqEnable     = 0u;
+    m_u32IrqPending    = 0u;
+    memset(m_apfnIrqLevel, 0, sizeof(m_apfnIrqLevel));
+    m_u8SysTickPending = 0u;
+    m_u32Primask       = 0u;
+    m_i32ActivePrio    = HOST_PRIO_NONE;
+    m_u32Ipsr          = 0u;
+    m_u64StStart       = 0u;
+    m_u32StStartVal    = 0u;
+    m_u64StHits        = 0u;
+    m_u32StFrozen      = 0u;
+
+    HOST_RegRangeHookSet(NVIC_BASE, 0x300u, HostNvicRead, HostNvicWrite);
+    HOST_RegHookSet(SysTick_BASE + 0x00u, HostSysTickRead, HostSysTickWrite);
+    HOST_RegHookSet(SysTick_BASE + 0x04u, NULL, HostSysTickWrite);
+    HOST_RegHookSet(SysTick_BASE + 0x08u, HostSysTickRead, HostSysTickWrite);
+    HOST_RegHookSet(SCB_BASE + 0x04u, HostIcsrRead, HostIcsrWrite);
+
+    HOST_PeriphModelInit();
+}
+
+/**
+ * @brief  设置单个32位寄存器的读写钩子
+ * @param  [in] u32Addr 寄存器芯片地址
+ * @param  [in] pfnRead 读钩子，NULL为普通RAM行为
+ * @param  [in] pfnWrite 写钩子，NULL为普通RAM行为
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - ErrorInvalidParameter: 地址不属于模型
+ */
+en_result_t HOST_RegHookSet(uint32_t u32Addr, host_reg_read_hook_t pfnRead, host_reg_write_hook_t pfnWrite)
+{
+    return HOST_RegRangeHookSet(u32Addr, 4u, pfnRead, pfnWrite);
+}
+
+/**
+ * @brief  设置一段地址范围内所有寄存器的读写钩子
+ * @param  [in] u32Addr 起始芯片地址
+ * @param  [in] u32Size 范围大小（字节）
+ * @param  [in] pfnRead 读钩子
+ * @param  [in] pfnWrite 写钩子
+ * @retval en_result_t
+ *           - Ok: 设置成功
+ *           - ErrorInvalidParameter: 地址不属于模型
+ */
+en_result_t HOST_RegRangeHookSet(uint32_t u32Addr, uint32_t u32Size, host_reg_read_hook_t pfnRead, host_reg_write_hook_t pfnWrite)
+{
+    stc_host_region_t *pstcRegion = HostRegionFind(u32Addr);
+    uint32_t           u32Idx;
+
+    if ((NULL == pstcRegion) || ((u32Addr - pstcRegion->u32Base + u32Size) > pstcRegion->u32Size))
+    {
+        return ErrorInvalidParameter;
+    }
+
+    for (u32Idx = (u32Addr - pstcRegion->u32Base) >> 2u; u32Size >= 4u; u32Size -= 4u, u32Idx++)
+    {
+        pstcRegion->ppfnRead[u32Idx]  = pfnRead;
+        pstcRegion->ppfnWrite[u32Idx] = pfnWrite;
+    }
+    return Ok;
+}
+
+/**
+ * @brief  读钩子中调用：本次读访问完成后清零指定位（读清零标志）
+ * @param  [in] u32Mask 清零位
+ * @retval None
+ */
+void HOST_ReadClearSet(uint32_t u32Mask)
+{
+    m_stcStep.u32Clear |= u32Mask;
+}
+
+/**
+ * @brief  设置总线访问跟踪回调
+ * @param  [in] pfnTrace 回调，NULL关闭跟踪
+ * @retval None
+ */
+void HOST_TraceHookSet(host_trace_hook_t pfnTrace)
+{
+    m_pfnTrace = pfnTrace;
+}
+
+/**
+ * @brief  后门指针（不触发钩子、不计数）
+ * @param  [in] u32Addr 芯片地址
+ * @retval void* 主机指针，地址不属于模型时返回NULL
+ */
+void *HOST_MemPtr(uint32_t u32Addr)
+{
+    stc_host_region_t *pstcRegion = HostRegionFind(u32Addr);
+
+    if (NULL == pstcRegion)
+    {
+        return NULL;
+    }
+    return m_pu8Alias + pstcRegion->u32Offset + (u32Addr - pstcRegion->u32Base);
+}
+
+/**
+ * @brief  后门读32位寄存器
+ * @param  [in] u32Addr 芯片地址
+ * @retval uint32_t 寄存器值
+ */
+uint32_t HOST_RegRead(uint32_t u32Addr)
+{
+    uint32_t *pu32Reg = (uint32_t *)HOST_MemPtr(u32Addr & ~3u);
+
+    return (NULL != pu32Reg) ? *pu32Reg : 0u;
+}
+
+/**
+ * @brief  后门写32位寄存器
+ * @param  [in] u32Addr 芯片地址
+ * @param  [in] u32Val 写入值
+ * @retval None
+ */
+void HOST_RegWrite(uint32_t u32Addr, uint32_t u32Val)
+{
+    uint32_t *pu32Reg = (uint32_t *)HOST_MemPtr(u32Addr & ~3u);
+
+    if (NULL != pu32Reg)
+    {
+        *pu32Reg = u32Val;
+    }
+}
+
+/**
+ * @brief  获取访问统计汇总
+ * @param  [out] pstcStat 统计结果
+ * @retval None
+ */
+void HOST_AccessStatGet(stc_host_access_stat_t *pstcStat)
+{
+    *pstcStat = m_stcStat;
+}
+
+/**
+ * @brief  获取各外设访问统计
+ * @param  [out] ppstc 统计表
+ * @retval uint32_t 统计表项数
+ */
+uint32_t HOST_PeriphStatGet(const stc_host_periph_stat_t **ppstc)
+{
+    *ppstc = m_astcPeriph;
+    return ARRAY_SZ(m_astcPeriph);
+}
+
+/**
+ * @brief  访问统计清零
+ * @retval None
+ */
+void HOST_AccessStatClear(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < ARRAY_SZ(m_astcPeriph); i++)
+    {
+        m_astcPeriph[i].u64Read  = 0u;
+        m_astcPeriph[i].u64Write = 0u;
+    }
+    memset(&m_stcStat, 0, sizeof(m_stcStat));
+}
+
+/**
+ * @brief  输出各外设访问统计
+ * @param  [in] pFile 输出文件
+ * @retval None
+ */
+void HOST_AccessReport(FILE *pFile)
+{
+    uint32_t i;
+
+    fprintf(pFile, "%-10s %12s %12s\n", "periph", "read", "write");
+    for (i = 0u; i < ARRAY_SZ(m_astcPeriph); i++)
+    {
+        if ((0u != m_astcPeriph[i].u64Read) || (0u != m_astcPeriph[i].u64Write))
+        {
+            fprintf(pFile, "%-10s %12llu %12llu\n", m_astcPeriph[i].pcName, (unsigned long long)m_astcPeriph[i].u64Read,
+                    (unsigned long long)m_astcPeriph[i].u64Write);
+        }
+    }
+    fprintf(pFile, "%-10s %12llu %12llu\n", "total", (unsigned long long)m_stcStat.u64Read, (unsigned long long)m_stcStat.u64Write);
+    fprintf(pFile, "cycles %llu, irqs %llu, wfi %llu\n", (unsigned long long)m_u64Cycle, (unsigned long long)m_stcStat.u64Irq,
+            (unsigned long long)m_stcStat.u64Wfi);
+}
+
+/**
+ * @brief  获取当前模拟HCLK周期
+ * @retval uint64_t 周期数
+ */
+uint64_t HOST_CycleGet(void)
+{
+    return m_u64Cycle;
+}
+
+/**
+ * @brief  推进模拟时间（执行到期事件，不执行中断）
+ * @param  [in] u32Cycles 周期数
+ * @retval None
+ */
+void HOST_CycleAdvance(uint32_t u32Cycles)
+{
+    HostTimeAdvanceTo(m_u64Cycle + u32Cycles);
+}
+
+/**
+ * @brief  设置单次总线访问消耗的模拟周期
+ * @param  [in] u32Cycles 周期数
+ * @retval None
+ */
+void HOST_AccessCyclesSet(uint32_t u32Cycles)
+{
+    m_u32AccessCycle = u32Cycles;
+}
+
+/**
+ * @brief  登记模拟时间事件
+ * @param  [in] u64Delay 相对当前时间的延迟（周期）
+ * @param  [in] pfnEvent 回调
+ * @param  [in] pvArg 回调参数
+ * @retval en_result_t
+ *           - Ok: 登记成功
+ *           - ErrorBufferFull: 事件表已满
+ */
+en_result_t HOST_EventSchedule(uint64_t u64Delay, host_event_func_t pfnEvent, void *pvArg)
+{
+    if (m_u32EventCnt >= HOST_EVENT_MAX)
+    {
+        return ErrorBufferFull;
+    }
+    m_astcEvent[m_u32EventCnt].u64Cycle = m_u64Cycle + u64Delay;
+    m_astcEvent[m_u32EventCnt].pfnEvent = pfnEvent;
+    m_astcEvent[m_u32EventCnt].pvArg    = pvArg;
+    m_u32EventCnt++;
+    return Ok;
+}
+
+/**
+ * @brief  取消模拟时间事件
+ * @param  [in] pfnEvent 回调
+ * @param  [in] pvArg 回调参数
+ * @retval None
+ */
+void HOST_EventCancel(host_event_func_t pfnEvent, void *pvArg)
+{
+    uint32_t i = 0u;
+
+    while (i < m_u32EventCnt)
+    {
+        if ((m_astcEvent[i].pfnEvent == pfnEvent) && (m_astcEvent[i].pvArg == pvArg))
+        {
+            m_astcEvent[i] = m_astcEvent[--m_u32EventCnt];
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+/**
+ * @brief  SysTick下一次计数到0的周期
+ * @retval uint64_t 周期，SysTick未使能时返回UINT64_MAX
+ */
+static uint64_t HostSysTickNextHit(void)
+{
+    uint32_t u32Ctrl = HOST_RegRead(SysTick_BASE + 0x00u);
+    uint64_t u64Period = (uint64_t)(HOST_RegRead(SysTick_BASE + 0x04u) & SysTick_LOAD_RELOAD_Msk) + 1u;
+
+    if (0u == (u32Ctrl & SysTick_CTRL_ENABLE_Msk))
+    {
+        return UINT64_MAX;
+    }
+    return m_u64StStart + m_u32StStartVal + (m_u64StHits * u64Period);
+}
+
+/**
+ * @brief  根据模拟时间更新SysTick计数到0标志及中断
+ * @retval None
+ */
+static void HostSysTickUpdate(void)
+{
+    uint32_t u32Ctrl = HOST_RegRead(SysTick_BASE + 0x00u);
+    uint64_t u64Period = (uint64_t)(HOST_RegRead(SysTick_BASE + 0x04u) & SysTick_LOAD_RELOAD_Msk) + 1u;
+    uint64_t u64Elapsed;
+    uint64_t u64Hits;
+
+    if (0u == (u32Ctrl & SysTick_CTRL_ENABLE_Msk))
+    {
+        return;
+    }
+
+    u64Elapsed = m_u64Cycle - m_u64StStart;
+    u64Hits    = (u64Elapsed >= m_u32StStartVal) ? (1u + (u64Elapsed - m_u32StStartVal) / u64Period) : 0u;
+    if (u64Hits > m_u64StHits)
+    {
+        m_u64StHits = u64Hits;
+        HOST_RegWrite(SysTick_BASE + 0x00u, u32Ctrl | SysTick_CTRL_COUNTFLAG_Msk);
+        if (u32Ctrl & SysTick_CTRL_TICKINT_Msk)
+        {
+            m_u8SysTickPending = 1u;
+        }
+    }
+}
+
+/**
+ * @brief  当前SysTick VAL
+ * @retval uint32_t VAL
+ */
+static uint32_t HostSysTickVal(void)
+{
+    uint32_t u32Load = HOST_RegRead(SysTick_BASE + 0x04u) & SysTick_LOAD_RELOAD_Msk;
+    uint64_t u64Elapsed;
+
+    if (0u == (HOST_RegRead(SysTick_BASE + 0x00u) & SysTick_CTRL_ENABLE_Msk))
+    {
+        return m_u32StFrozen;
+    }
+
+    u64Elapsed = m_u64Cycle - m_u64StStart;
+    if (u64Elapsed <= m_u32StStartVal)
+    {
+        return (uint32_t)(m_u32StStartVal - u64Elapsed);
+    }
+    return u32Load - (uint32_t)((u64Elapsed - m_u32StStartVal - 1u) % ((uint64_t)u32Load + 1u));
+}
+
+/**
+ * @brief  SysTick重新开始计数
+ * @param  [in] u32Val 起始VAL，0表示下一个周期重装LOAD
+ * @retval None
+ */
+static void HostSysTickRestart(uint32_t u32Val)
+{
+    m_u64StStart    = m_u64Cycle;
+    m_u32StStartVal = (0u == u32Val) ? ((HOST_RegRead(SysTick_BASE + 0x04u) & SysTick_LOAD_RELOAD_Msk) + 1u) : u32Val;
+    m_u64StHits     = 0u;
+}
+
+static uint32_t HostSysTickRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    HostSysTickUpdate();
+    if ((SysTick_BASE + 0x08u) == u32Addr)
+    {
+        return HostSysTickVal();
+    }
+    /* CTRL：COUNTFLAG读后清零 */
+    HOST_ReadClearSet(SysTick_CTRL_COUNTFLAG_Msk);
+    return HOST_RegRead(u32Addr);
+}
+
+static uint32_t HostSysTickWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    if ((SysTick_BASE + 0x00u) == u32Addr)
+    {
+        uint32_t u32Val = HostSysTickVal();
+
+        u32New = (u32New & ~SysTick_CTRL_COUNTFLAG_Msk);
+        if ((u32Old & SysTick_CTRL_ENABLE_Msk) && !(u32New & SysTick_CTRL_ENABLE_Msk))
+        {
+            m_u32StFrozen = u32Val;
+        }
+        else if (!(u32Old & SysTick_CTRL_ENABLE_Msk) && (u32New & SysTick_CTRL_ENABLE_Msk))
+        {
+            HostSysTickRestart(m_u32StFrozen);
+        }
+        return u32New;
+    }
+    if ((SysTick_BASE + 0x08u) == u32Addr)
+    {
+        /* 写VAL：计数清零，COUNTFLAG清零 */
+        HOST_RegWrite(SysTick_BASE + 0x00u, HOST_RegRead(SysTick_BASE + 0x00u) & ~SysTick_CTRL_COUNTFLAG_Msk);
+        m_u32StFrozen = 0u;
+        HostSysTickRestart(0u);
+        return 0u;
+    }
+    return u32New & SysTick_LOAD_RELOAD_Msk;
+}
+
+static uint32_t HostIcsrRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    (void)u32Addr;
+
+    /* PENDSTSET反映SysTick是否已计数到0而中断尚未响应 */
+    HostSysTickUpdate();
+    return (u32Value & ~SCB_ICSR_PENDSTSET_Msk) | (m_u8SysTickPending ? SCB_ICSR_PENDSTSET_Msk : 0u);
+}
+
+static uint32_t HostIcsrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Addr;
+    (void)u32Old;
+
+    if (u32New & SCB_ICSR_PENDSTSET_Msk)
+    {
+        m_u8SysTickPending = 1u;
+    }
+    if (u32New & SCB_ICSR_PENDSTCLR_Msk)
+    {
+        m_u8SysTickPending = 0u;
+    }
+    return m_u8SysTickPending ? SCB_ICSR_PENDSTSET_Msk : 0u;
+}
+
+static uint32_t HostNvicRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    switch (u32Addr - NVIC_BASE)
+    {
+        case 0x000u:
+        case 0x080u:
+            return m_u32IrqEnable;
+        case 0x100u:
+        case 0x180u:
+            return m_u32IrqPending;
+        default:
+            return u32Value;
+    }
+}
+
+static uint32_t HostNvicWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Old;
+
+    switch (u32Addr - NVIC_BASE)
+    {
+        case 0x000u:
+            m_u32IrqEnable |= u32New;
+            return m_u32IrqEnable;
+        case 0x080u:
+            m_u32IrqEnable &= ~u32New;
+            return m_u32IrqEnable;
+        case 0x100u:
+            m_u32IrqPending |= u32New;
+            return m_u32IrqPending;
+        case 0x180u:
+            m_u32IrqPending &= ~u32New;
+            return m_u32IrqPending;
+        default:
+            return u32New;
+    }
+}
+
+/**
+ * @brief  推进模拟时间到指定周期，按时间顺序执行到期事件
+ * @param  [in] u64Target 目标周期
+ * @retval None
+ */
+static void HostTimeAdvanceTo(uint64_t u64Target)
+{
+    uint32_t i;
+    uint32_t u32Min;
+
+    for (;;)
+    {
+        u32Min = HOST_EVENT_MAX;
+        for (i = 0u; i < m_u32EventCnt; i++)
+        {
+            if ((m_astcEvent[i].u64Cycle <= u64Target)
+                && ((HOST_EVENT_MAX == u32Min) || (m_astcEvent[i].u64Cycle < m_astcEvent[u32Min].u64Cycle)))
+            {
+                u32Min = i;
+            }
+        }
+        if (HOST_EVENT_MAX == u32Min)
+        {
+            break;
+        }
+        {
+            stc_host_event_t stcEvent = m_astcEvent[u32Min];
+
+            m_astcEvent[u32Min] = m_astcEvent[--m_u32EventCnt];
+            if (stcEvent.u64Cycle > m_u64Cycle)
+            {
+                m_u64Cycle = stcEvent.u64Cycle;
+            }
+            HostSysTickUpdate();
+            stcEvent.pfnEvent(stcEvent.pvArg);
+        }
+    }
+
+    if (u64Target > m_u64Cycle)
+    {
+        m_u64Cycle = u64Target;
+    }
+    HostSysTickUpdate();
+}
+
+/**
+ * @brief  外设模型挂起中断
+ * @param  [in] i32Irq 中断号（IRQn_Type），HOST_SYSTICK_IRQ为SysTick
+ * @retval None
+ */
+void HOST_IrqPend(int32_t i32Irq)
+{
+    if (HOST_SYSTICK_IRQ == i32Irq)
+    {
+        m_u8SysTickPending = 1u;
+    }
+    else if ((i32Irq >= 0) && (i32Irq < (int32_t)HOST_IRQ_NUM))
+    {
+        m_u32IrqPending |= (1u << (uint32_t)i32Irq);
+    }
+    else
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  设置外设电平中断源：请求有效期间中断保持挂起，服务返回后仍有效则再次挂起
+ * @param  [in] i32Irq 中断号（IRQn_Type）
+ * @param  [in] pfnLevel 电平查询函数，NULL取消
+ * @retval None
+ */
+void HOST_IrqLevelSet(int32_t i32Irq, host_irq_level_t pfnLevel)
+{
+    if ((i32Irq >= 0) && (i32Irq < (int32_t)HOST_IRQ_NUM))
+    {
+        m_apfnIrqLevel[i32Irq] = pfnLevel;
+    }
+}
+
+/**
+ * @brief  中断优先级
+ * @param  [in] i32Irq 中断号
+ * @retval int32_t 优先级 0~3
+ */
+static int32_t HostIrqPrio(int32_t i32Irq)
+{
+    uint32_t u32Shift;
+
+    if (HOST_SYSTICK_IRQ == i32Irq)
+    {
+        return (int32_t)((HOST_RegRead(SCB_BASE + 0x20u) >> 30u) & 0x3u); /* SHP[1] bit31:30 */
+    }
+    u32Shift = ((uint32_t)i32Irq & 0x3u) * 8u + 6u;
+    return (int32_t)((HOST_RegRead(NVIC_BASE + 0x300u + (((uint32_t)i32Irq >> 2u) << 2u)) >> u32Shift) & 0x3u);
+}
+
+/**
+ * @brief  选出可以抢占当前执行级别的最高优先级中断
+ * @retval int32_t 中断号，无可执行中断时返回INT32_MIN
+ */
+static int32_t HostIrqSelect(void)
+{
+    int32_t  i32Best = INT32_MIN;
+    int32_t  i32BestPrio = m_i32ActivePrio;
+    uint32_t u32Ready;
+    int32_t  i;
+
+    for (i = 0; i < (int32_t)HOST_IRQ_NUM; i++)
+    {
+        if ((NULL != m_apfnIrqLevel[i]) && (TRUE == m_apfnIrqLevel[i]()))
+        {
+            m_u32IrqPending |= (1u << (uint32_t)i);
+        }
+    }
+    u32Ready = m_u32IrqPending & m_u32IrqEnable;
+
+    if (m_u8SysTickPending && (HostIrqPrio(HOST_SYSTICK_IRQ) < i32BestPrio))
+    {
+        i32Best     = HOST_SYSTICK_IRQ;
+        i32BestPrio = HostIrqPrio(HOST_SYSTICK_IRQ);
+    }
+    for (i = 0; i < (int32_t)HOST_IRQ_NUM; i++)
+    {
+        if ((u32Ready & (1u << (uint32_t)i)) && (HostIrqPrio(i) < i32BestPrio))
+        {
+            i32Best     = i;
+            i32BestPrio = HostIrqPrio(i);
+        }
+    }
+    return i32Best;
+}
+
+/**
+ * @brief  在安全点执行已挂起且使能、优先级足够的中断（支持抢占嵌套）
+ * @retval None
+ */
+void HOST_IrqDispatch(void)
+{
+    int32_t i32Irq;
+    int32_t i32SavedPrio;
+    uint32_t u32SavedIpsr;
+    boolean_t bRan = FALSE;
+    void (*pfnHandler)(void);
+
+    if ((0u != m_u32Primask) || (NULL == pu8HostBus))
+    {
+        return;
+    }
+
+    while (INT32_MIN != (i32Irq = HostIrqSelect()))
+    {
+        bRan = TRUE;
+        if (HOST_SYSTICK_IRQ == i32Irq)
+        {
+            m_u8SysTickPending = 0u;
+        }
+        else
+        {
+            m_u32IrqPending &= ~(1u << (uint32_t)i32Irq);
+        }
+
+        pfnHandler   = HOST_VectorTable[16 + i32Irq];
+        i32SavedPrio = m_i32ActivePrio;
+        u32SavedIpsr = m_u32Ipsr;
+        m_i32ActivePrio = HostIrqPrio(i32Irq);
+        m_u32Ipsr       = (uint32_t)(16 + i32Irq);
+        m_u8InHandler++;
+        m_stcStat.u64Irq++;
+        if (NULL != pfnHandler)
+        {
+            pfnHandler();
+        }
+        /* 电平中断源在返回前已撤销：服务期间采样到的挂起不保留 */
+        if ((i32Irq >= 0) && (NULL != m_apfnIrqLevel[i32Irq]) && (FALSE == m_apfnIrqLevel[i32Irq]()))
+        {
+            m_u32IrqPending &= ~(1u << (uint32_t)i32Irq);
+        }
+        m_u8InHandler--;
+        m_i32ActivePrio = i32SavedPrio;
+        m_u32Ipsr       = u32SavedIpsr;
+    }
+
+    /* 中断返回线程时SLEEPONEXIT置位：不回到线程，直接再次休眠（WFI中由其自身循环处理） */
+    if ((TRUE == bRan) && (0u == m_u8InHandler) && (0u == m_u8InWfi)
+        && (0u != (HOST_RegRead(SCB_BASE + 0x10u) & SCB_SCR_SLEEPONEXIT_Msk)))
+    {
+        HOST_WaitForInterrupt();
+    }
+}
+
+/**
+ * @brief  __WFI()：推进模拟时间到下一个事件，唤醒后执行中断；SLEEPONEXIT置位时中断返回后继续休眠
+ * @retval None
+ */
+void HOST_WaitForInterrupt(void)
+{
+    uint64_t u64Next;
+    uint64_t u64Start;
+    uint32_t i;
+
+    m_u8InWfi++;
+    do
+    {
+        m_stcStat.u64Wfi++;
+        u64Start = m_u64Cycle;
+
+        /* WFI唤醒不受PRIMASK影响，只要有使能的挂起中断即唤醒 */
+        while (INT32_MIN == HostIrqSelect())
+        {
+            u64Next = HostSysTickNextHit();
+            for (i = 0u; i < m_u32EventCnt; i++)
+            {
+                if (m_astcEvent[i].u64Cycle < u64Next)
+                {
+                    u64Next = m_astcEvent[i].u64Cycle;
+                }
+            }
+            if (UINT64_MAX == u64Next)
+            {
+                m_stcStat.u64SleepCycles += m_u64Cycle - u64Start;
+                m_u8InWfi--;
+                return; /* 没有任何唤醒源 */
+            }
+            HostTimeAdvanceTo((u64Next > m_u64Cycle) ? u64Next : (m_u64Cycle + 1u));
+        }
+        m_stcStat.u64SleepCycles += m_u64Cycle - u64Start;
+
+        if (0u != m_u32Primask)
+        {
+            m_u8InWfi--;
+            return; /* PRIMASK置位：唤醒后不执行中断 */
+        }
+        HOST_IrqDispatch();
+    } while ((0u == m_u8InHandler) && (0u != (HOST_RegRead(SCB_BASE + 0x10u) & SCB_SCR_SLEEPONEXIT_Msk)));
+    m_u8InWfi--;
+}
+
+/**
+ * @brief  设置PRIMASK，开中断时立即执行挂起的中断
+ * @param  [in] u32Val PRIMASK
+ * @retval None
+ */
+void HOST_PrimaskSet(uint32_t u32Val)
+{
+    m_u32Primask = u32Val & 1u;
+    if (0u == m_u32Primask)
+    {
+        HOST_IrqDispatch();
+    }
+}
+
+/**
+ * @brief  获取PRIMASK
+ * @retval uint32_t PRIMASK
+ */
+uint32_t HOST_PrimaskGet(void)
+{
+    return m_u32Primask;
+}
+
+/**
+ * @brief  __get_IPSR()：当前异常号，线程模式为0，SysTick为15，外设中断为16+IRQn
+ * @retval uint32_t
+ */
+uint32_t HOST_IpsrGet(void)
+{
+    return m_u32Ipsr;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,212 @@
+/**
+ *******************************************************************************
+ * @file  host_model.h
+ * @brief This file contains all the functions prototypes of the host
+ *        register model (RAM backed peripheral registers for Linux builds)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+#ifndef __HOST_MODEL_H__
+#define __HOST_MODEL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "base_types.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_HOST HOST寄存器模型
+ * @{
+ */
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup HOST_Global_Types HOST全局类型定义
+ * @{
+ */
+/**
+ * @brief  寄存器读钩子：总线读之前调用，返回值写入寄存器后再由驱动读取
+ */
+typedef uint32_t (*host_reg_read_hook_t)(uint32_t u32Addr, uint32_t u32Value);
+
+/**
+ * @brief  寄存器写钩子：总线写之后调用，返回值为寄存器最终保存的值
+ */
+typedef uint32_t (*host_reg_write_hook_t)(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New);
+
+/**
+ * @brief  总线访问跟踪回调
+ */
+typedef void (*host_trace_hook_t)(uint32_t u32Addr, uint32_t u32Value, uint8_t u8Write, uint64_t u64Cycle);
+
+/**
+ * @brief  模拟时间事件回调
+ */
+typedef void (*host_event_func_t)(void *pvArg);
+
+/**
+ * @brief  电平中断源：返回TRUE表示外设中断请求有效
+ */
+typedef boolean_t (*host_irq_level_t)(void);
+
+/**
+ * @brief  SPI从设备模型：输入MOSI数据，返回同一帧的MISO数据
+ */
+typedef uint16_t (*host_spi_device_t)(uint16_t u16Tx);
+
+/**
+ * @brief  GPIO输出变化回调：u8Port为0（PA）或1（PB），u16Old/u16New为OUT变化前后的值
+ */
+typedef void (*host_gpio_out_t)(uint8_t u8Port, uint16_t u16Old, uint16_t u16New);
+
+/**
+ * @brief  LPUART发送帧回调：u16Data的bit8为第9位
+ */
+typedef void (*host_lpuart_tx_t)(uint8_t u8Unit, uint16_t u16Data);
+
+/**
+ * @brief  单个外设的总线访问统计
+ */
+typedef struct
+{
+    const char *pcName;   /*!< 外设名称 */
+    uint32_t    u32Base;  /*!< 外设基地址 */
+    uint32_t    u32Size;  /*!< 外设地址空间大小 */
+    uint64_t    u64Read;  /*!< 读访问次数 */
+    uint64_t    u64Write; /*!< 写访问次数 */
+} stc_host_periph_stat_t;
+
+/**
+ * @brief  总线访问统计汇总
+ */
+typedef struct
+{
+    uint64_t u64Read;        /*!< 读访问总次数 */
+    uint64_t u64Write;       /*!< 写访问总次数 */
+    uint64_t u64Irq;         /*!< 已执行的中断服务次数 */
+    uint64_t u64Wfi;         /*!< WFI（休眠）次数 */
+    uint64_t u64SleepCycles; /*!< 休眠中度过的模拟周期 */
+} stc_host_access_stat_t;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup HOST_Global_Macros HOST全局宏定义
+ * @{
+ */
+/**
+ * @brief  芯片地址到主机地址的映射，hc32l021.h中的外设实例及RW_MEMx均经由此宏访问
+ */
+#define DDL_MEM_MAP(addr) ((uintptr_t)pu8HostBus + (uint32_t)(addr))
+
+#define HOST_ACCESS_CYCLES_DEFAULT (2u)        /*!< 每次外设总线访问消耗的模拟HCLK周期数 */
+#define HOST_EVENT_MAX             (16u)       /*!< 同时挂起的模拟时间事件最大数量 */
+#define HOST_IRQ_NUM               (32u)       /*!< 外部中断数量 */
+#define HOST_SYSTICK_IRQ           (-1)        /*!< SysTick异常号 */
+#define HOST_HCLK_DEFAULT          (4000000u)  /*!< 默认模拟HCLK频率 */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+extern uint8_t *pu8HostBus; /* 受保护的总线视图基地址 */
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup HOST_Global_Functions HOST全局函数定义
+ * @{
+ */
+void HOST_ModelInit(void);  /* 寄存器模型初始化（startup_host.c在main前自动调用） */
+void HOST_ModelReset(void); /* 寄存器、钩子、统计及模拟时间复位 */
+
+en_result_t HOST_RegHookSet(uint32_t u32Addr, host_reg_read_hook_t pfnRead, host_reg_write_hook_t pfnWrite); /* 单个寄存器钩子 */
+en_result_t HOST_RegRangeHookSet(uint32_t u32Addr, uint32_t u32Size, host_reg_read_hook_t pfnRead,
+                                 host_reg_write_hook_t pfnWrite); /* 地址范围钩子 */
+void        HOST_ReadClearSet(uint32_t u32Mask);                  /* 读钩子中设置读后清零位 */
+void        HOST_TraceHookSet(host_trace_hook_t pfnTrace);        /* 总线访问跟踪回调 */
+
+uint32_t HOST_RegRead(uint32_t u32Addr);                   /* 后门读（不触发钩子、不计数） */
+void     HOST_RegWrite(uint32_t u32Addr, uint32_t u32Val); /* 后门写（不触发钩子、不计数） */
+void    *HOST_MemPtr(uint32_t u32Addr);                    /* 后门指针 */
+
+void     HOST_AccessStatGet(stc_host_access_stat_t *pstcStat);     /* 访问统计汇总 */
+uint32_t HOST_PeriphStatGet(const stc_host_periph_stat_t **ppstc); /* 各外设访问统计 */
+void     HOST_AccessStatClear(void);                               /* 访问统计清零 */
+void     HOST_AccessReport(FILE *pFile);                           /* 输出各外设访问统计 */
+
+uint64_t    HOST_CycleGet(void);                                                           /* 当前模拟HCLK周期 */
+void        HOST_CycleAdvance(uint32_t u32Cycles);                                         /* 推进模拟时间 */
+void        HOST_AccessCyclesSet(uint32_t u32Cycles);                                      /* 设置单次总线访问消耗周期 */
+en_result_t HOST_EventSchedule(uint64_t u64Delay, host_event_func_t pfnEvent, void *pvArg); /* 模拟时间事件 */
+void        HOST_EventCancel(host_event_func_t pfnEvent, void *pvArg);                     /* 取消事件 */
+
+void     HOST_IrqPend(int32_t i32Irq);                               /* 外设模型挂起中断（边沿） */
+void     HOST_IrqLevelSet(int32_t i32Irq, host_irq_level_t pfnLevel); /* 外设模型电平中断源 */
+void     HOST_IrqDispatch(void);                                     /* 在安全点执行已挂起且使能的中断 */
+void     HOST_WaitForInterrupt(void);                                /* __WFI() */
+void     HOST_PrimaskSet(uint32_t u32Val);                           /* __enable_irq()/__disable_irq() */
+uint32_t HOST_PrimaskGet(void);
+uint32_t HOST_IpsrGet(void);                                         /* __get_IPSR() */
+
+void        HOST_PeriphModelInit(void);                            /* 默认外设行为模型（host_periph.c） */
+void        HOST_SpiDeviceSet(host_spi_device_t pfnDevice);        /* SPI从设备模型 */
+en_result_t HOST_SpiExtMasterXfer(const uint16_t *pu16Mosi, uint16_t *pu16Miso, uint32_t u32Len, uint32_t u32FrameCycles,
+                                  uint32_t u32SetupCycles);       /* 外部主机对SPI从机的一次传输 */
+boolean_t   HOST_SpiExtMasterBusy(void);                           /* 外部主机传输进行中 */
+void        HOST_GpioOutHookSet(host_gpio_out_t pfnOut);           /* GPIO输出变化回调 */
+void        HOST_LpuartTxHookSet(host_lpuart_tx_t pfnTx);          /* LPUART发送帧回调 */
+en_result_t HOST_LpuartRxPush(uint8_t u8Unit, uint16_t u16Data);   /* 向LPUART注入接收帧 */
+uint32_t    HOST_LpuartFrameCycles(uint8_t u8Unit);                /* LPUART一帧占用的HCLK周期 */
+en_result_t HOST_LpuartRxWave(uint8_t u8Unit, uint8_t u8Data, uint32_t u32Baud); /* 远端按指定波特率向RX线发送一帧 */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_MODEL_H__ */
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,1448 @@
+/**
+ *******************************************************************************
+ * @file  host_periph.c
+ * @brief This file provides the default behaviour models of the peripherals
+ *        used by the host register model (status bits, FLASH array, SPI and
+ *        LPUART timing, SPI slave driven by an external master, GPIO port
+ *        interrupts and output set/clear, BTIM counting, LPUART RX line
+ *        waveform and ATIM3 pulse width capture)
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+   2026-10-18       MADS            Add BTIM counter and overflow interrupt model
+   2026-10-18       MADS            Add LPUART multiprocessor address detection
+   2026-10-18       MADS            Add LPUART RX line waveform and ATIM3 mode1 PWC model
+   2026-10-18       MADS            Add LPUART single-wire echo in half-duplex mode
+   2026-10-18       MADS            Add GPIO BSET/BCLR/BSETCLR output model and output change hook
+   2026-10-18       MADS            Add SPI slave mode model driven by an external master (NSS edges, UDF/OVF)
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdlib.h>
+
+#include "atim3.h"
+#include "btim.h"
+#include "ddl.h"
+#include "lpuart.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_HOST HOST寄存器模型
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief  LPUART通道模型状态
+ */
+typedef struct
+{
+    uint32_t u32Base;     /*!< 寄存器基地址 */
+    int32_t  i32Irq;      /*!< 中断号 */
+    uint8_t  u8Unit;      /*!< 通道号 */
+    uint8_t  u8Shifting;  /*!< 移位寄存器忙 */
+    uint8_t  u8Holding;   /*!< 发送缓冲有数据 */
+    uint16_t u16Shift;    /*!< 正在发送的帧 */
+    uint16_t u16Hold;     /*!< 发送缓冲中的帧 */
+    uint16_t u16TxBit8;   /*!< 发送第9位 */
+    uint64_t u64SbufRead; /*!< 最近一次读SBUF时的总线访问序号 */
+
+    uint8_t  u8WaveBusy;        /*!< RX线上正在输出波形帧 */
+    uint8_t  u8Wave;            /*!< 当前波形帧在历史中的下标 */
+    uint8_t  u8WaveBit;         /*!< 当前波形帧下一个输出的位边界 */
+    uint8_t  au8WaveData[4u];   /*!< 最近的波形帧数据（8N1），供接收采样回看 */
+    uint32_t au32WaveBaud[4u];  /*!< 波形帧波特率，0为空 */
+    uint64_t au64WaveStart[4u]; /*!< 波形帧起始位下降沿时刻 */
+    uint8_t  u8RxBusy;          /*!< 接收器已检测到起始位 */
+    uint8_t  u8RxBits;          /*!< 接收数据位数（含第9位） */
+    uint32_t u32RxFrame;        /*!< 接收帧周期数（起始位时的配置） */
+    uint32_t u32RxHalf;         /*!< 接收帧长（半位） */
+    uint64_t u64RxStart;        /*!< 接收起始位下降沿时刻 */
+} stc_host_lpuart_t;
+
+/**
+ * @brief  SPI模型状态
+ */
+typedef struct
+{
+    uint8_t  u8Shifting; /*!< 移位寄存器忙 */
+    uint8_t  u8Holding;  /*!< 发送缓冲有数据 */
+    uint8_t  u8Loaded;   /*!< 从机：移位寄存器已装入下一帧的发送数据 */
+    uint16_t u16Shift;   /*!< 正在发送的数据 */
+    uint16_t u16Hold;    /*!< 发送缓冲中的数据 */
+    uint16_t u16Rx;      /*!< 接收缓冲 */
+
+    const uint16_t *pu16ExtMosi;       /*!< 外部主机：MOSI数据 */
+    uint16_t       *pu16ExtMiso;       /*!< 外部主机：MISO数据，可为NULL */
+    uint32_t        u32ExtLen;         /*!< 外部主机：帧数 */
+    uint32_t        u32ExtPos;         /*!< 外部主机：下一个开始的帧 */
+    uint32_t        u32ExtFrameCycles; /*!< 外部主机：每帧HCLK周期 */
+    uint8_t         u8ExtBusy;         /*!< 外部主机：NSS有效 */
+} stc_host_spi_t;
+
+/**
+ * @brief  BTIM模型状态（只模拟PCLK定时模式的计数与溢出）
+ */
+typedef struct
+{
+    uint32_t u32Base;    /*!< 寄存器基地址 */
+    uint32_t u32Group;   /*!< AIFR/AICR所在的基地址（BTIM0或BTIM3） */
+    uint32_t u32AifrUi;  /*!< 本单元在AIFR中的溢出标志 */
+    uint8_t  u8Running;  /*!< 计数中 */
+    uint32_t u32CntBase; /*!< u64Start时刻的计数值 */
+    uint64_t u64Start;   /*!< 计数起点（HCLK周期） */
+} stc_host_btim_t;
+
+/**
+ * @brief  ATIM3模型状态（只模拟模式1 PWC对LPUART RXD的脉宽测量）
+ */
+typedef struct
+{
+    uint8_t  u8Phase;  /*!< 0: 等待起始边沿；1: 测量中 */
+    uint64_t u64Start; /*!< 起始边沿时刻（HCLK周期） */
+} stc_host_atim3_t;
+
+#define HOST_REG(base, type, reg) ((uint32_t)(base) + (uint32_t)offsetof(type, reg)) /* 寄存器芯片地址 */
+
+#define HOST_FLASH_SIZE        (0x10000u)
+#define HOST_FLASH_SECTOR_SIZE (0x200u)
+
+#define HOST_LPUART_ISR_W0C (LPUART_ISR_RC_Msk | LPUART_ISR_TC_Msk | LPUART_ISR_FE_Msk | LPUART_ISR_PE_Msk | LPUART_ISR_CTSIF_Msk)
+#define HOST_SPI_SR_W0C     (0xFCu) /* SSF/SSR/UDF/OVF/SSERR/MODF写0清零 */
+#define HOST_GPIO_STAT_W0C  (0xFFFFu) /* ICLR写0清零STAT */
+#define HOST_BTIM_IFR_W0C   (BTIM_IFR_UI_Msk | BTIM_IFR_TI_Msk)
+#define HOST_BTIM_AIFR_W0C  (0x3Fu)
+#define HOST_ATIM3_IFR_W0C  (0x7FFFDu) /* ICLR写0清零IFR */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t HostSpiLoopback(uint16_t u16Tx);
+static void     HostBtimOverflow(void *pvArg);
+static void     HostAtim3Edge(uint8_t u8Unit, uint8_t u8Level);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_host_lpuart_t m_astcLpuart[2u] = {
+    {LPUART0_BASE, (int32_t)LPUART0_IRQn, 0u, 0u, 0u, 0u, 0u, 0u, 0u},
+    {LPUART1_BASE, (int32_t)LPUART1_IRQn, 1u, 0u, 0u, 0u, 0u, 0u, 0u},
+};
+static host_lpuart_tx_t  m_pfnLpuartTx = NULL;
+
+static stc_host_spi_t    m_stcSpi;
+static host_spi_device_t m_pfnSpiDevice = HostSpiLoopback;
+
+static host_gpio_out_t m_pfnGpioOut = NULL;
+
+static stc_host_btim_t m_astcBtim[6u] = {
+    {BTIM0_BASE, BTIM0_BASE, BTIM_AIFR_UI03_Msk, 0u, 0u, 0u}, {BTIM1_BASE, BTIM0_BASE, BTIM_AIFR_UI14_Msk, 0u, 0u, 0u},
+    {BTIM2_BASE, BTIM0_BASE, BTIM_AIFR_UI25_Msk, 0u, 0u, 0u}, {BTIM3_BASE, BTIM3_BASE, BTIM_AIFR_UI03_Msk, 0u, 0u, 0u},
+    {BTIM4_BASE, BTIM3_BASE, BTIM_AIFR_UI14_Msk, 0u, 0u, 0u}, {BTIM5_BASE, BTIM3_BASE, BTIM_AIFR_UI25_Msk, 0u, 0u, 0u},
+};
+
+static stc_host_atim3_t m_stcAtim3;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  时钟稳定标志：时钟使能后立即稳定
+ */
+static uint32_t HostClkStableRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    switch (u32Addr)
+    {
+        case HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, RC48M_CR):
+            return u32Value | SYSCTRL_RC48M_CR_STABLE_Msk;
+        case HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, RCL_CR):
+            return u32Value | SYSCTRL_RCL_CR_STABLE_Msk;
+        default:
+            return u32Value | SYSCTRL_XTL_CR_STABLE_Msk;
+    }
+}
+
+/**
+ * @brief  FLASH存储阵列写：按CR.OP执行编程（只能由1变0）、扇区擦除或全片擦除，CR.CONTP为1时为连续编程
+ */
+static uint32_t HostFlashArrayWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Cr = HOST_RegRead(HOST_REG(FLASH_BASE, FLASH_TypeDef, CR));
+
+    if (0u != (u32Cr & FLASH_CR_RO_Msk))
+    {
+        return u32Old;
+    }
+
+    if (0u != (u32Cr & FLASH_CR_CONTP_Msk))
+    {
+        return u32Old & u32New;
+    }
+
+    switch (u32Cr & FLASH_CR_OP_Msk)
+    {
+        case 1u: /* 编程 */
+            return u32Old & u32New;
+        case 2u: /* 扇区擦除 */
+            memset(HOST_MemPtr(u32Addr & ~(HOST_FLASH_SECTOR_SIZE - 1u)), 0xFF, HOST_FLASH_SECTOR_SIZE);
+            return 0xFFFFFFFFu;
+        case 3u: /* 全片擦除 */
+            memset(HOST_MemPtr(0u), 0xFF, HOST_FLASH_SIZE);
+            return 0xFFFFFFFFu;
+        default: /* 读模式下写无效 */
+            return u32Old;
+    }
+}
+
+/**
+ * @brief  RTC CR1：WAITF跟随WAIT
+ */
+static uint32_t HostRtcCr1Write(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Addr;
+    (void)u32Old;
+
+    if (0u != (u32New & RTC_CR1_WAIT_Msk))
+    {
+        return u32New | RTC_CR1_WAITF_Msk;
+    }
+    return u32New & ~RTC_CR1_WAITF_Msk;
+}
+
+/**
+ * @brief  IWDT KR：启动/停止计数器
+ */
+static uint32_t HostIwdtKrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Sr = HOST_REG(IWDT_BASE, IWDT_TypeDef, SR);
+
+    (void)u32Addr;
+
+    if (0xCCCCu == (u32New & 0xFFFFu))
+    {
+        HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) | IWDT_SR_RUN_Msk);
+    }
+    else if ((0x5678u == (u32New & 0xFFFFu)) && (0x1234u == (u32Old & 0xFFFFu)))
+    {
+        HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) & ~IWDT_SR_RUN_Msk);
+    }
+    else
+    {
+        ;
+    }
+    return u32New;
+}
+
+/**
+ * @brief  TRNG CR：RUN置位后立即产生随机数并自动清零
+ */
+static uint32_t HostTrngCrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Addr;
+    (void)u32Old;
+
+    if (0u != (u32New & TRNG_CR_RNG_RUN_Msk))
+    {
+        HOST_RegWrite(HOST_REG(TRNG_BASE, TRNG_TypeDef, DATA0), ((uint32_t)rand() << 16u) ^ (uint32_t)rand());
+        HOST_RegWrite(HOST_REG(TRNG_BASE, TRNG_TypeDef, DATA1), ((uint32_t)rand() << 16u) ^ (uint32_t)rand());
+    }
+    return u32New & ~TRNG_CR_RNG_RUN_Msk;
+}
+
+/**
+ * @brief  查找LPUART通道
+ */
+static stc_host_lpuart_t *HostLpuartFind(uint32_t u32Addr)
+{
+    return ((u32Addr & 0xFFFFFC00u) == LPUART0_BASE) ? &m_astcLpuart[0] : &m_astcLpuart[1];
+}
+
+/**
+ * @brief  LPUART帧长（起始位+数据位+第9位+停止位），单位半位
+ */
+static uint32_t HostLpuartHalfBits(uint32_t u32Scon)
+{
+    uint32_t u32Half = (1u + 8u) * 2u;
+
+    if (u32Scon & (0x2u << LPUART_SCON_SM_Pos))
+    {
+        u32Half += 2u; /* 模式2/3第9位 */
+    }
+    return u32Half + 2u + ((u32Scon & LPUART_SCON_STOPBIT_Msk) >> LPUART_SCON_STOPBIT_Pos);
+}
+
+/**
+ * @brief  LPUART一帧（起始位+数据位+第9位+停止位）占用的HCLK周期
+ * @param  [in] u8Unit 通道号 0/1
+ * @retval uint32_t 周期数
+ */
+uint32_t HOST_LpuartFrameCycles(uint8_t u8Unit)
+{
+    uint32_t u32Base = m_astcLpuart[u8Unit & 1u].u32Base;
+    uint32_t u32Scon = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SCON));
+    uint32_t u32Scnt = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SCNT)) & 0xFFFFu;
+    uint32_t u32Bsel = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, BSEL)) & 0x3u;
+    uint32_t u32Sclk;
+    uint32_t u32Half = HostLpuartHalfBits(u32Scon); /* 帧长（半位为单位） */
+    uint32_t u32Modu;
+    uint64_t u64Div;
+    uint32_t i;
+
+    switch (u32Scon & LPUART_SCON_SCLKSEL_Msk)
+    {
+        case LPUART_SCLK_SEL_XTL:
+        case LPUART_SCLK_SEL_RCL:
+            u32Sclk = 32768u;
+            break;
+        default:
+            u32Sclk = SystemCoreClock;
+            break;
+    }
+
+    if ((32768u == u32Sclk) && (u32Bsel >= 2u))
+    {
+        /* XTL调制：第i位为3或6个时钟，MODU第i位为1时加1个时钟 */
+        u32Modu = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, MODU));
+        u64Div  = 0u;
+        for (i = 0u; i < (u32Half >> 1); i++)
+        {
+            u64Div += ((2u == u32Bsel) ? 3u : 6u) + ((u32Modu >> i) & 1u);
+        }
+        if (0u != (u32Half & 1u))
+        {
+            u64Div += (((2u == u32Bsel) ? 3u : 6u) + ((u32Modu >> i) & 1u)) >> 1; /* 1.5停止位 */
+        }
+        return (uint32_t)(((uint64_t)SystemCoreClock * u64Div) / u32Sclk);
+    }
+
+    u64Div = (uint64_t)(16u >> ((u32Scon & LPUART_SCON_OVER_Msk) >> LPUART_SCON_OVER_Pos)) * ((0u == u32Scnt) ? 1u : u32Scnt);
+    return (uint32_t)(((uint64_t)SystemCoreClock * u64Div * u32Half) / ((uint64_t)u32Sclk * 2u));
+}
+
+/**
+ * @brief  LPUART一帧发送完成
+ */
+static void HostLpuartTxDone(void *pvArg)
+{
+    stc_host_lpuart_t *pstc   = (stc_host_lpuart_t *)pvArg;
+    uint32_t           u32Isr = HOST_REG(pstc->u32Base, LPUART_TypeDef, ISR);
+
+    if (NULL != m_pfnLpuartTx)
+    {
+        m_pfnLpuartTx(pstc->u8Unit, pstc->u16Shift);
+    }
+
+    /* 单线半双工：TX与RX为同一根线，接收使能时收到自身发送的帧（回波），RC先于TC置位 */
+    if (0u != (HOST_RegRead(HOST_REG(pstc->u32Base, LPUART_TypeDef, SCON)) & LPUART_SCON_HDSEL_Msk))
+    {
+        (void)HOST_LpuartRxPush(pstc->u8Unit, pstc->u16Shift);
+    }
+
+    if (pstc->u8Holding)
+    {
+        pstc->u8Holding = 0u;
+        pstc->u16Shift  = pstc->u16Hold;
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_TXE_Msk);
+        HOST_EventSchedule(HOST_LpuartFrameCycles(pstc->u8Unit), HostLpuartTxDone, pstc);
+    }
+    else
+    {
+        pstc->u8Shifting = 0u;
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_TC_Msk);
+    }
+}
+
+static uint32_t HostLpuartSbufRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    stc_host_access_stat_t stcStat;
+
+    HOST_AccessStatGet(&stcStat);
+    HostLpuartFind(u32Addr)->u64SbufRead = stcStat.u64Read + stcStat.u64Write;
+    return u32Value;
+}
+
+/**
+ * @brief  LPUART SBUF写：写DATA发送一帧，写入的DATA8或已设置的发送第9位为该帧第9位；紧跟在读SBUF之后、
+ *         DATA不变且DATA8与发送第9位不同的写为设置发送第9位（发送数据与接收缓存相同的读-改-写仍为发送）
+ */
+static uint32_t HostLpuartSbufWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    stc_host_lpuart_t     *pstc   = HostLpuartFind(u32Addr);
+    uint32_t               u32Isr = HOST_REG(pstc->u32Base, LPUART_TypeDef, ISR);
+    stc_host_access_stat_t stcStat;
+    uint16_t               u16Frame;
+
+    HOST_AccessStatGet(&stcStat);
+    if (((stcStat.u64Read + stcStat.u64Write) == (pstc->u64SbufRead + 1u)) && (0u == ((u32Old ^ u32New) & LPUART_SBUF_DATA_Msk)) &&
+        ((u32New & LPUART_SBUF_DATA8_Msk) != pstc->u16TxBit8))
+    {
+        pstc->u16TxBit8 = (uint16_t)(u32New & LPUART_SBUF_DATA8_Msk);
+        return u32Old;
+    }
+
+    u16Frame = (uint16_t)((u32New & (LPUART_SBUF_DATA_Msk | LPUART_SBUF_DATA8_Msk)) | pstc->u16TxBit8);
+    if (0u == pstc->u8Shifting)
+    {
+        pstc->u8Shifting = 1u;
+        pstc->u16Shift   = u16Frame;
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) & ~LPUART_ISR_TC_Msk);
+        HOST_EventSchedule(HOST_LpuartFrameCycles(pstc->u8Unit), HostLpuartTxDone, pstc);
+    }
+    else
+    {
+        pstc->u8Holding = 1u;
+        pstc->u16Hold   = u16Frame;
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) & ~(LPUART_ISR_TXE_Msk | LPUART_ISR_TC_Msk));
+    }
+    return u32Old; /* SBUF读出的始终是接收数据 */
+}
+
+/**
+ * @brief  LPUART ICR：写0清除ISR中对应标志，读出全1
+ */
+static uint32_t HostLpuartIcrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Isr = HOST_REG(HostLpuartFind(u32Addr)->u32Base, LPUART_TypeDef, ISR);
+
+    (void)u32Old;
+
+    HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) & ~(~u32New & HOST_LPUART_ISR_W0C));
+    return HOST_LPUART_ISR_W0C;
+}
+
+static boolean_t HostLpuartIrqLevel(const stc_host_lpuart_t *pstc)
+{
+    uint32_t u32Scon = HOST_RegRead(HOST_REG(pstc->u32Base, LPUART_TypeDef, SCON));
+    uint32_t u32Isr  = HOST_RegRead(HOST_REG(pstc->u32Base, LPUART_TypeDef, ISR));
+
+    return (((u32Isr & LPUART_ISR_RC_Msk) && (u32Scon & LPUART_SCON_RCIE_Msk))
+            || ((u32Isr & LPUART_ISR_TC_Msk) && (u32Scon & LPUART_SCON_TCIE_Msk))
+            || ((u32Isr & LPUART_ISR_TXE_Msk) && (u32Scon & LPUART_SCON_TXEIE_Msk))
+            || ((u32Isr & LPUART_ISR_FE_Msk) && (u32Scon & LPUART_SCON_FEIE_Msk))
+            || ((u32Isr & LPUART_ISR_PE_Msk) && (u32Scon & LPUART_SCON_PEIE_Msk))
+            || ((u32Isr & LPUART_ISR_CTSIF_Msk) && (u32Scon & LPUART_SCON_CTSIE_Msk)))
+               ? TRUE
+               : FALSE;
+}
+
+static boolean_t HostLpuart0IrqLevel(void)
+{
+    return HostLpuartIrqLevel(&m_astcLpuart[0]);
+}
+
+static boolean_t HostLpuart1IrqLevel(void)
+{
+    return HostLpuartIrqLevel(&m_astcLpuart[1]);
+}
+
+/**
+ * @brief  设置LPUART发送帧回调（每帧停止位结束时调用）
+ * @param  [in] pfnTx 回调，NULL关闭
+ * @retval None
+ */
+void HOST_LpuartTxHookSet(host_lpuart_tx_t pfnTx)
+{
+    m_pfnLpuartTx = pfnTx;
+}
+
+/**
+ * @brief  多机模式（模式2/3、B8CONT为0）ADRDET置位时的地址识别：只接收与SADDR & SADEN或
+ *         广播地址SADDR | SADEN匹配的地址帧（第9位为1），忽略SADEN为0的位
+ */
+static boolean_t HostLpuartAddrAccept(uint32_t u32Base, uint16_t u16Data)
+{
+    uint32_t u32Scon  = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SCON));
+    uint32_t u32Saddr = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SADDR)) & LPUART_SADDR_SADDR_Msk;
+    uint32_t u32Saden = HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SADEN)) & LPUART_SADEN_SADEN_Msk;
+    uint32_t u32Bcast = u32Saddr | u32Saden;
+    uint32_t u32Addr  = (uint32_t)u16Data & LPUART_SBUF_DATA_Msk;
+
+    if ((0u == (u32Scon & LPUART_SCON_ADRDET_Msk)) || (0u == (u32Scon & (0x2u << LPUART_SCON_SM_Pos)))
+        || (0u != (u32Scon & LPUART_SCON_B8CONT_Msk)))
+    {
+        return TRUE;
+    }
+
+    return ((0u != (u16Data & LPUART_SBUF_DATA8_Msk))
+            && ((0u == ((u32Addr ^ u32Saddr) & u32Saden)) || (u32Bcast == (u32Addr & u32Bcast))))
+               ? TRUE
+               : FALSE;
+}
+
+/**
+ * @brief  向LPUART注入一帧接收数据（帧接收完成时刻）
+ * @param  [in] u8Unit 通道号 0/1
+ * @param  [in] u16Data 数据，bit8为第9位
+ * @retval en_result_t
+ *           - Ok: 注入成功（地址识别未通过的帧被丢弃，不置位RC）
+ *           - ErrorNotReady: 接收未使能
+ */
+en_result_t HOST_LpuartRxPush(uint8_t u8Unit, uint16_t u16Data)
+{
+    uint32_t u32Base = m_astcLpuart[u8Unit & 1u].u32Base;
+    uint32_t u32Isr  = HOST_REG(u32Base, LPUART_TypeDef, ISR);
+
+    if (0u == (HOST_RegRead(HOST_REG(u32Base, LPUART_TypeDef, SCON)) & LPUART_SCON_REN_Msk))
+    {
+        return ErrorNotReady;
+    }
+
+    if (FALSE == HostLpuartAddrAccept(u32Base, u16Data))
+    {
+        return Ok;
+    }
+
+    HOST_RegWrite(HOST_REG(u32Base, LPUART_TypeDef, SBUF), (uint32_t)u16Data & (LPUART_SBUF_DATA_Msk | LPUART_SBUF_DATA8_Msk));
+    HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_RC_Msk);
+    return Ok;
+}
+
+/**
+ * @brief  波形帧第u32Bit位（起始位为第0位）的线电平：起始位0，8位数据低位在前，之后为停止位及空闲1
+ */
+static uint8_t HostLpuartWaveLevel(uint8_t u8Data, uint32_t u32Bit)
+{
+    if (0u == u32Bit)
+    {
+        return 0u;
+    }
+    return (u32Bit <= 8u) ? ((u8Data >> (u32Bit - 1u)) & 1u) : 1u;
+}
+
+/**
+ * @brief  波形帧第u32Bit个位边界相对起始位下降沿的周期数（向上取整）
+ */
+static uint64_t HostLpuartWaveEdge(uint32_t u32Baud, uint32_t u32Bit)
+{
+    return (((uint64_t)u32Bit * SystemCoreClock) + u32Baud - 1u) / u32Baud;
+}
+
+/**
+ * @brief  RX线在u64Cycle时刻的电平：由最近的波形帧推算，之前或没有波形时为空闲1
+ */
+static uint8_t HostLpuartLineAt(const stc_host_lpuart_t *pstc, uint64_t u64Cycle)
+{
+    uint32_t u32Idx;
+    uint32_t i;
+
+    for (i = 0u; i < ARRAY_SZ(pstc->au8WaveData); i++)
+    {
+        u32Idx = (pstc->u8Wave + ARRAY_SZ(pstc->au8WaveData) - i) % ARRAY_SZ(pstc->au8WaveData);
+        if ((0u != pstc->au32WaveBaud[u32Idx]) && (u64Cycle >= pstc->au64WaveStart[u32Idx]))
+        {
+            return HostLpuartWaveLevel(pstc->au8WaveData[u32Idx],
+                                       (uint32_t)(((u64Cycle - pstc->au64WaveStart[u32Idx]) * pstc->au32WaveBaud[u32Idx]) / SystemCoreClock));
+        }
+    }
+    return 1u;
+}
+
+/**
+ * @brief  接收器在停止位中点按起始位时的波特率逐位采样：数据位低位在前，停止位为0时置位FE
+ */
+static void HostLpuartRxSample(void *pvArg)
+{
+    stc_host_lpuart_t *pstc    = (stc_host_lpuart_t *)pvArg;
+    uint32_t           u32Isr  = HOST_REG(pstc->u32Base, LPUART_TypeDef, ISR);
+    uint16_t           u16Data = 0u;
+    uint64_t           u64At;
+    uint32_t           i;
+
+    pstc->u8RxBusy = 0u;
+    for (i = 1u; i <= pstc->u8RxBits; i++)
+    {
+        u64At = pstc->u64RxStart + (((2u * i + 1u) * (uint64_t)pstc->u32RxFrame) / pstc->u32RxHalf);
+        u16Data |= (uint16_t)(HostLpuartLineAt(pstc, u64At) << (i - 1u));
+    }
+    if ((Ok == HOST_LpuartRxPush(pstc->u8Unit, u16Data)) && (0u == HostLpuartLineAt(pstc, HOST_CycleGet())))
+    {
+        HOST_RegWrite(u32Isr, HOST_RegRead(u32Isr) | LPUART_ISR_FE_Msk);
+    }
+}
+
+/**
+ * @brief  RX线电平变化：送往ATIM3捕获；接收使能且空闲时下降沿启动接收，按当前波特率登记停止位采样
+ */
+static void HostLpuartLineEdge(stc_host_lpuart_t *pstc, uint8_t u8Level)
+{
+    uint32_t u32Scon = HOST_RegRead(HOST_REG(pstc->u32Base, LPUART_TypeDef, SCON));
+
+    if ((0u == u8Level) && (0u == pstc->u8RxBusy) && (0u != (u32Scon & LPUART_SCON_REN_Msk)))
+    {
+        pstc->u8RxBusy   = 1u;
+        pstc->u8RxBits   = (0u != (u32Scon & (0x2u << LPUART_SCON_SM_Pos))) ? 9u : 8u;
+        pstc->u64RxStart = HOST_CycleGet();
+        pstc->u32RxFrame = HOST_LpuartFrameCycles(pstc->u8Unit);
+        pstc->u32RxHalf  = HostLpuartHalfBits(u32Scon);
+        /* 第一个停止位中点 */
+        (void)HOST_EventSchedule(((2u * (pstc->u8RxBits + 1u) + 1u) * (uint64_t)pstc->u32RxFrame) / pstc->u32RxHalf, HostLpuartRxSample,
+                                 pstc);
+    }
+    HostAtim3Edge(pstc->u8Unit, u8Level);
+}
+
+/**
+ * @brief  波形帧输出到第u8WaveBit个位边界：电平变化时产生边沿，并登记下一个电平变化的位边界
+ */
+static void HostLpuartWaveStep(void *pvArg)
+{
+    stc_host_lpuart_t *pstc    = (stc_host_lpuart_t *)pvArg;
+    uint8_t            u8Data  = pstc->au8WaveData[pstc->u8Wave];
+    uint32_t           u32Baud = pstc->au32WaveBaud[pstc->u8Wave];
+    uint32_t           u32Bit  = pstc->u8WaveBit;
+    uint32_t           u32Next;
+    uint64_t           u64Now;
+
+    if (u32Bit >= 10u)
+    {
+        pstc->u8WaveBusy = 0u; /* 停止位结束 */
+        return;
+    }
+
+    if ((0u == u32Bit) || (HostLpuartWaveLevel(u8Data, u32Bit) != HostLpuartWaveLevel(u8Data, u32Bit - 1u)))
+    {
+        HostLpuartLineEdge(pstc, HostLpuartWaveLevel(u8Data, u32Bit));
+    }
+
+    for (u32Next = u32Bit + 1u; u32Next < 10u; u32Next++)
+    {
+        if (HostLpuartWaveLevel(u8Data, u32Next) != HostLpuartWaveLevel(u8Data, u32Next - 1u))
+        {
+            break;
+        }
+    }
+    pstc->u8WaveBit = (uint8_t)u32Next;
+    u64Now          = HOST_CycleGet() - pstc->au64WaveStart[pstc->u8Wave];
+    (void)HOST_EventSchedule(HostLpuartWaveEdge(u32Baud, u32Next) - u64Now, HostLpuartWaveStep, pstc);
+}
+
+/**
+ * @brief  远端以u32Baud向LPUART RX线发送一帧8N1波形（从当前时刻的起始位下降沿开始）
+ * @note   接收器按自身波特率在各位中点采样，波特率不匹配时收到错误数据或置位FE；
+ *         RXD经GPIOAUX TIMCPS接到ATIM3 CH0A时，各边沿同时送往ATIM3模式1脉宽测量
+ * @param  [in] u8Unit 通道号 0/1
+ * @param  [in] u8Data 数据
+ * @param  [in] u32Baud 远端波特率
+ * @retval en_result_t
+ *           - Ok: 开始输出
+ *           - ErrorInvalidParameter: u32Baud为0
+ *           - ErrorNotReady: 上一帧波形尚未结束
+ */
+en_result_t HOST_LpuartRxWave(uint8_t u8Unit, uint8_t u8Data, uint32_t u32Baud)
+{
+    stc_host_lpuart_t *pstc = &m_astcLpuart[u8Unit & 1u];
+
+    if (0u == u32Baud)
+    {
+        return ErrorInvalidParameter;
+    }
+    if (0u != pstc->u8WaveBusy)
+    {
+        return ErrorNotReady;
+    }
+
+    pstc->u8Wave                      = (uint8_t)((pstc->u8Wave + 1u) % ARRAY_SZ(pstc->au8WaveData));
+    pstc->au8WaveData[pstc->u8Wave]   = u8Data;
+    pstc->au32WaveBaud[pstc->u8Wave]  = u32Baud;
+    pstc->au64WaveStart[pstc->u8Wave] = HOST_CycleGet();
+    pstc->u8WaveBit                   = 0u;
+    pstc->u8WaveBusy                  = 1u;
+    HostLpuartWaveStep(pstc);
+    return Ok;
+}
+
+/**
+ * @brief  SPI默认从设备：MISO回环MOSI
+ */
+static uint16_t HostSpiLoopback(uint16_t u16Tx)
+{
+    return u16Tx;
+}
+
+/**
+ * @brief  SPI一帧占用的HCLK周期
+ */
+static uint32_t HostSpiFrameCycles(void)
+{
+    uint32_t u32Cr0 = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, CR0));
+    uint32_t u32Bits = ((u32Cr0 & SPI_CR0_WIDTH_Msk) >> SPI_CR0_WIDTH_Pos) + 1u;
+
+    return u32Bits * (2u << ((u32Cr0 & SPI_CR0_BRR_Msk) >> SPI_CR0_BRR_Pos));
+}
+
+/**
+ * @brief  SPI一帧传输完成
+ */
+static void HostSpiFrameDone(void *pvArg)
+{
+    uint32_t u32Sr = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+    uint32_t u32Val;
+
+    (void)pvArg;
+
+    u32Val = HOST_RegRead(u32Sr);
+    if (u32Val & SPI_SR_RXNE_Msk)
+    {
+        u32Val |= SPI_SR_OVF_Msk;
+    }
+    m_stcSpi.u16Rx = m_pfnSpiDevice(m_stcSpi.u16Shift);
+    HOST_RegWrite(HOST_REG(SPI_BASE, SPI_TypeDef, DR), m_stcSpi.u16Rx);
+    u32Val |= SPI_SR_RXNE_Msk;
+
+    if (m_stcSpi.u8Holding)
+    {
+        m_stcSpi.u8Holding = 0u;
+        m_stcSpi.u16Shift  = m_stcSpi.u16Hold;
+        u32Val |= SPI_SR_TXE_Msk;
+        HOST_EventSchedule(HostSpiFrameCycles(), HostSpiFrameDone, NULL);
+    }
+    else
+    {
+        m_stcSpi.u8Shifting = 0u;
+        u32Val &= ~SPI_SR_BUSY_Msk;
+    }
+    HOST_RegWrite(u32Sr, u32Val);
+}
+
+/**
+ * @brief  SPI DR读：读出接收缓冲并清除RXNE
+ */
+static uint32_t HostSpiDrRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    uint32_t u32Sr = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+
+    (void)u32Addr;
+    (void)u32Value;
+
+    HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) & ~SPI_SR_RXNE_Msk);
+    return m_stcSpi.u16Rx;
+}
+
+/**
+ * @brief  SPI DR写：主机模式下启动传输，移位寄存器忙时写入发送缓冲；
+ *         从机模式下先装入移位寄存器（TXE保持置位），已装入时写入发送缓冲
+ */
+static uint32_t HostSpiDrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Sr  = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+    uint32_t u32Cr0 = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, CR0));
+
+    (void)u32Addr;
+    (void)u32Old;
+
+    if (0u == (u32Cr0 & SPI_CR0_MSTR_Msk))
+    {
+        if (0u == m_stcSpi.u8Loaded)
+        {
+            m_stcSpi.u8Loaded = 1u;
+            m_stcSpi.u16Shift = (uint16_t)u32New;
+        }
+        else
+        {
+            m_stcSpi.u8Holding = 1u;
+            m_stcSpi.u16Hold   = (uint16_t)u32New;
+            HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) & ~SPI_SR_TXE_Msk);
+        }
+    }
+    else if (0u == m_stcSpi.u8Shifting)
+    {
+        m_stcSpi.u16Shift = (uint16_t)u32New;
+        if ((u32Cr0 & SPI_CR0_EN_Msk) && (u32Cr0 & SPI_CR0_MSTR_Msk))
+        {
+            m_stcSpi.u8Shifting = 1u;
+            HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) | SPI_SR_BUSY_Msk);
+            HOST_EventSchedule(HostSpiFrameCycles(), HostSpiFrameDone, NULL);
+        }
+    }
+    else
+    {
+        m_stcSpi.u8Holding = 1u;
+        m_stcSpi.u16Hold   = (uint16_t)u32New;
+        HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) & ~SPI_SR_TXE_Msk);
+    }
+    return m_stcSpi.u16Rx;
+}
+
+/**
+ * @brief  SPI ICR：写0清除SR中对应标志
+ */
+static uint32_t HostSpiIcrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Sr = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+
+    (void)u32Addr;
+    (void)u32Old;
+
+    HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) & ~(~u32New & HOST_SPI_SR_W0C));
+    return HOST_SPI_SR_W0C;
+}
+
+/**
+ * @brief  SPI CR0写：EN清零时丢弃从机已装入的发送数据（移位寄存器及发送缓冲），TXE置位
+ */
+static uint32_t HostSpiCr0Write(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Sr = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+
+    (void)u32Addr;
+
+    if ((0u != (u32Old & SPI_CR0_EN_Msk)) && (0u == (u32New & SPI_CR0_EN_Msk)) && (0u == m_stcSpi.u8Shifting))
+    {
+        m_stcSpi.u8Loaded  = 0u;
+        m_stcSpi.u8Holding = 0u;
+        HOST_RegWrite(u32Sr, HOST_RegRead(u32Sr) | SPI_SR_TXE_Msk);
+    }
+    return u32New;
+}
+
+/**
+ * @brief  外部主机驱动的从机帧边界：结束上一帧（接收），开始下一帧（发送），全部结束后NSS无效
+ */
+static void HostSpiExtStep(void *pvArg)
+{
+    uint32_t u32Sr   = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+    uint32_t u32Cr0  = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, CR0));
+    uint32_t u32Val  = HOST_RegRead(u32Sr);
+    uint8_t  u8Slave = ((u32Cr0 & SPI_CR0_EN_Msk) && (0u == (u32Cr0 & SPI_CR0_MSTR_Msk))) ? 1u : 0u;
+    uint16_t u16Miso = 0xFFFFu;
+
+    (void)pvArg;
+
+    /* 上一帧结束：MOSI进入接收缓冲 */
+    if ((0u != m_stcSpi.u32ExtPos) && (0u != u8Slave))
+    {
+        if (u32Val & SPI_SR_RXNE_Msk)
+        {
+            u32Val |= SPI_SR_OVF_Msk;
+        }
+        m_stcSpi.u16Rx = m_stcSpi.pu16ExtMosi[m_stcSpi.u32ExtPos - 1u];
+        HOST_RegWrite(HOST_REG(SPI_BASE, SPI_TypeDef, DR), m_stcSpi.u16Rx);
+        u32Val |= SPI_SR_RXNE_Msk;
+    }
+
+    if (m_stcSpi.u32ExtPos < m_stcSpi.u32ExtLen)
+    {
+        /* 下一帧开始：移位寄存器未装入时下溢，发送移位寄存器中上一帧收到的数据 */
+        if (0u != u8Slave)
+        {
+            if (0u != m_stcSpi.u8Loaded)
+            {
+                u16Miso = m_stcSpi.u16Shift;
+            }
+            else
+            {
+                u16Miso = m_stcSpi.u16Rx;
+                u32Val |= SPI_SR_UDF_Msk;
+            }
+            m_stcSpi.u8Loaded = 0u;
+            if (0u != m_stcSpi.u8Holding)
+            {
+                m_stcSpi.u8Holding = 0u;
+                m_stcSpi.u8Loaded  = 1u;
+                m_stcSpi.u16Shift  = m_stcSpi.u16Hold;
+                u32Val |= SPI_SR_TXE_Msk;
+            }
+        }
+        if (NULL != m_stcSpi.pu16ExtMiso)
+        {
+            m_stcSpi.pu16ExtMiso[m_stcSpi.u32ExtPos] = u16Miso;
+        }
+        m_stcSpi.u32ExtPos++;
+        HOST_EventSchedule(m_stcSpi.u32ExtFrameCycles, HostSpiExtStep, NULL);
+    }
+    else
+    {
+        /* NSS上升沿 */
+        m_stcSpi.u8ExtBusy = 0u;
+        u32Val |= SPI_SR_SSLVL_Msk;
+        if (0u != u8Slave)
+        {
+            u32Val |= SPI_SR_SSR_Msk;
+        }
+    }
+    HOST_RegWrite(u32Sr, u32Val);
+}
+
+/**
+ * @brief  外部主机对从机的一次传输：NSS立即置低，u32SetupCycles后连续发送u32Len帧，最后一帧结束时NSS置高
+ * @note   本机须为从机模式且已使能（否则只改变NSS电平），u32Len为0时只产生NSS下降沿及上升沿
+ * @param  [in] pu16Mosi 主机发送的数据（传输结束前须有效）
+ * @param  [out] pu16Miso 从机应答数据，可为NULL
+ * @param  [in] u32Len 帧数
+ * @param  [in] u32FrameCycles 每帧HCLK周期（SCLK周期 * 数据宽度）
+ * @param  [in] u32SetupCycles NSS下降沿到第一帧开始的HCLK周期
+ * @retval en_result_t
+ *           - Ok: 已开始
+ *           - ErrorInvalidParameter: 参数错误
+ *           - ErrorNotReady: 上一次传输未结束
+ */
+en_result_t HOST_SpiExtMasterXfer(const uint16_t *pu16Mosi, uint16_t *pu16Miso, uint32_t u32Len, uint32_t u32FrameCycles,
+                                  uint32_t u32SetupCycles)
+{
+    uint32_t u32Sr  = HOST_REG(SPI_BASE, SPI_TypeDef, SR);
+    uint32_t u32Cr0 = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, CR0));
+    uint32_t u32Val = HOST_RegRead(u32Sr) & ~SPI_SR_SSLVL_Msk;
+
+    if (((NULL == pu16Mosi) && (0u != u32Len)) || (0u == u32FrameCycles))
+    {
+        return ErrorInvalidParameter;
+    }
+    if (0u != m_stcSpi.u8ExtBusy)
+    {
+        return ErrorNotReady;
+    }
+
+    m_stcSpi.pu16ExtMosi       = pu16Mosi;
+    m_stcSpi.pu16ExtMiso       = pu16Miso;
+    m_stcSpi.u32ExtLen         = u32Len;
+    m_stcSpi.u32ExtPos         = 0u;
+    m_stcSpi.u32ExtFrameCycles = u32FrameCycles;
+    m_stcSpi.u8ExtBusy         = 1u;
+
+    /* NSS下降沿 */
+    if ((u32Cr0 & SPI_CR0_EN_Msk) && (0u == (u32Cr0 & SPI_CR0_MSTR_Msk)))
+    {
+        u32Val |= SPI_SR_SSF_Msk;
+    }
+    HOST_RegWrite(u32Sr, u32Val);
+    return HOST_EventSchedule(u32SetupCycles, HostSpiExtStep, NULL);
+}
+
+/**
+ * @brief  外部主机传输是否进行中（NSS有效）
+ * @retval boolean_t TRUE: 进行中
+ */
+boolean_t HOST_SpiExtMasterBusy(void)
+{
+    return (0u != m_stcSpi.u8ExtBusy) ? TRUE : FALSE;
+}
+
+static boolean_t HostSpiIrqLevel(void)
+{
+    uint32_t u32Cr1 = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, CR1));
+    uint32_t u32Sr  = HOST_RegRead(HOST_REG(SPI_BASE, SPI_TypeDef, SR));
+
+    return (0u != (u32Cr1 & u32Sr & 0xFFu)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  设置SPI从设备模型（主机模式下每传输一帧调用一次）
+ * @param  [in] pfnDevice 从设备，NULL恢复为回环
+ * @retval None
+ */
+void HOST_SpiDeviceSet(host_spi_device_t pfnDevice)
+{
+    m_pfnSpiDevice = (NULL != pfnDevice) ? pfnDevice : HostSpiLoopback;
+}
+
+/**
+ * @brief  GPIO ICLR：写0清除STAT对应位（STAT由测试程序经HOST_RegWrite()置位模拟引脚中断）
+ */
+static uint32_t HostGpioIclrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Stat = u32Addr - (uint32_t)offsetof(GPIO_TypeDef, ICLR) + (uint32_t)offsetof(GPIO_TypeDef, STAT);
+
+    (void)u32Old;
+
+    HOST_RegWrite(u32Stat, HOST_RegRead(u32Stat) & ~(~u32New & HOST_GPIO_STAT_W0C));
+    return HOST_GPIO_STAT_W0C;
+}
+
+/**
+ * @brief  GPIO OUT更新：写入新值并通知输出变化回调
+ */
+static void HostGpioOutUpdate(uint32_t u32Base, uint32_t u32Old, uint32_t u32New)
+{
+    u32Old &= 0xFFFFu;
+    u32New &= 0xFFFFu;
+    HOST_RegWrite(HOST_REG(u32Base, GPIO_TypeDef, OUT), u32New);
+    if ((u32Old != u32New) && (NULL != m_pfnGpioOut))
+    {
+        m_pfnGpioOut((GPIOB_BASE == u32Base) ? 1u : 0u, (uint16_t)u32Old, (uint16_t)u32New);
+    }
+}
+
+/**
+ * @brief  GPIO OUT写
+ */
+static uint32_t HostGpioOutWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    HostGpioOutUpdate(u32Addr - (uint32_t)offsetof(GPIO_TypeDef, OUT), u32Old, u32New);
+    return u32New & 0xFFFFu;
+}
+
+/**
+ * @brief  GPIO BSET/BCLR/BSETCLR写：置位或清零OUT对应位（BSETCLR高16位置位、低16位清零），读为0
+ */
+static uint32_t HostGpioBitWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Base;
+    uint32_t u32Offset;
+    uint32_t u32Out;
+
+    (void)u32Old;
+
+    /* PA、PB寄存器交错排列（基地址相差0x40），按与端口寄存器区起点的距离判断端口 */
+    if ((u32Addr - HOST_REG(GPIOA_BASE, GPIO_TypeDef, DIR)) < (GPIOB_BASE - GPIOA_BASE))
+    {
+        u32Base = GPIOA_BASE;
+    }
+    else
+    {
+        u32Base = GPIOB_BASE;
+    }
+    u32Offset = u32Addr - u32Base;
+    u32Out    = HOST_RegRead(HOST_REG(u32Base, GPIO_TypeDef, OUT));
+
+    if ((uint32_t)offsetof(GPIO_TypeDef, BSET) == u32Offset)
+    {
+        HostGpioOutUpdate(u32Base, u32Out, u32Out | u32New);
+    }
+    else if ((uint32_t)offsetof(GPIO_TypeDef, BCLR) == u32Offset)
+    {
+        HostGpioOutUpdate(u32Base, u32Out, u32Out & ~u32New);
+    }
+    else
+    {
+        HostGpioOutUpdate(u32Base, u32Out, (u32Out & ~u32New) | (u32New >> 16u));
+    }
+    return 0u;
+}
+
+/**
+ * @brief  设置GPIO输出变化回调（OUT、BSET、BCLR、BSETCLR写使输出变化时调用）
+ * @param  [in] pfnOut 回调，NULL关闭
+ * @retval None
+ */
+void HOST_GpioOutHookSet(host_gpio_out_t pfnOut)
+{
+    m_pfnGpioOut = pfnOut;
+}
+
+static boolean_t HostPortAIrqLevel(void)
+{
+    return (0u != HOST_RegRead(HOST_REG(GPIOA_BASE, GPIO_TypeDef, STAT))) ? TRUE : FALSE;
+}
+
+static boolean_t HostPortBIrqLevel(void)
+{
+    return (0u != HOST_RegRead(HOST_REG(GPIOB_BASE, GPIO_TypeDef, STAT))) ? TRUE : FALSE;
+}
+
+static stc_host_btim_t *HostBtimFind(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (ARRAY_SZ(m_astcBtim) - 1u); i++)
+    {
+        if ((u32Addr & 0xFFFFFF00u) == m_astcBtim[i].u32Base)
+        {
+            break;
+        }
+    }
+    return &m_astcBtim[i];
+}
+
+/**
+ * @brief  BTIM当前计数值：计数中由起点时间及预分频推算
+ */
+static uint32_t HostBtimCount(const stc_host_btim_t *pstc, uint32_t u32Cr)
+{
+    uint32_t u32Prs = (u32Cr & BTIM_CR_PRS_Msk) >> BTIM_CR_PRS_Pos;
+
+    if (0u == pstc->u8Running)
+    {
+        return HOST_RegRead(HOST_REG(pstc->u32Base, BTIM_TypeDef, CNT)) & BTIM_CNT_CNT_Msk;
+    }
+    return (pstc->u32CntBase + (uint32_t)((HOST_CycleGet() - pstc->u64Start) >> u32Prs)) & BTIM_CNT_CNT_Msk;
+}
+
+/**
+ * @brief  BTIM从u32Cnt开始按当前CR/ARR重新计时，登记下一次溢出（计数到ARR后溢出，周期PRS*(ARR+1)）
+ */
+static void HostBtimRestart(stc_host_btim_t *pstc, uint32_t u32Cnt)
+{
+    uint32_t u32Cr  = HOST_RegRead(HOST_REG(pstc->u32Base, BTIM_TypeDef, CR));
+    uint32_t u32Arr = HOST_RegRead(HOST_REG(pstc->u32Base, BTIM_TypeDef, ARR)) & BTIM_ARR_ARR_Msk;
+    uint64_t u64Ticks;
+
+    HOST_EventCancel(HostBtimOverflow, pstc);
+    HOST_RegWrite(HOST_REG(pstc->u32Base, BTIM_TypeDef, CNT), u32Cnt);
+    pstc->u8Running  = ((0u != (u32Cr & BTIM_CR_CEN_Msk)) && (BTIM_MD_PCLK == (u32Cr & BTIM_CR_MD_Msk))) ? 1u : 0u;
+    pstc->u32CntBase = u32Cnt;
+    pstc->u64Start   = HOST_CycleGet();
+    if (0u != pstc->u8Running)
+    {
+        u64Ticks = (uint64_t)((u32Arr - u32Cnt) & BTIM_CNT_CNT_Msk) + 1u;
+        (void)HOST_EventSchedule(u64Ticks << ((u32Cr & BTIM_CR_PRS_Msk) >> BTIM_CR_PRS_Pos), HostBtimOverflow, pstc);
+    }
+}
+
+/**
+ * @brief  BTIM溢出：置UI标志，单次模式停止计数，连续模式从0重新计数
+ */
+static void HostBtimOverflow(void *pvArg)
+{
+    stc_host_btim_t *pstc    = (stc_host_btim_t *)pvArg;
+    uint32_t         u32Cr   = HOST_REG(pstc->u32Base, BTIM_TypeDef, CR);
+    uint32_t         u32Ifr  = HOST_REG(pstc->u32Base, BTIM_TypeDef, IFR);
+    uint32_t         u32Aifr = HOST_REG(pstc->u32Group, BTIM_TypeDef, AIFR);
+
+    HOST_RegWrite(u32Ifr, HOST_RegRead(u32Ifr) | BTIM_IFR_UI_Msk);
+    HOST_RegWrite(u32Aifr, HOST_RegRead(u32Aifr) | pstc->u32AifrUi);
+    if (0u != (HOST_RegRead(u32Cr) & BTIM_CR_OST_Msk))
+    {
+        HOST_RegWrite(u32Cr, HOST_RegRead(u32Cr) & ~BTIM_CR_CEN_Msk);
+    }
+    HostBtimRestart(pstc, 0u);
+}
+
+static uint32_t HostBtimCntRead(uint32_t u32Addr, uint32_t u32Value)
+{
+    stc_host_btim_t *pstc = HostBtimFind(u32Addr);
+
+    (void)u32Value;
+
+    return HostBtimCount(pstc, HOST_RegRead(HOST_REG(pstc->u32Base, BTIM_TypeDef, CR)));
+}
+
+static uint32_t HostBtimCntWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Old;
+
+    HostBtimRestart(HostBtimFind(u32Addr), u32New & BTIM_CNT_CNT_Msk);
+    return u32New & BTIM_CNT_CNT_Msk;
+}
+
+/**
+ * @brief  BTIM CR/ARR写：按写之前的配置结算当前计数，再按新配置计时
+ */
+static uint32_t HostBtimCfgWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    stc_host_btim_t *pstc  = HostBtimFind(u32Addr);
+    uint32_t         u32Cr = HOST_RegRead(HOST_REG(pstc->u32Base, BTIM_TypeDef, CR));
+
+    if (HOST_REG(pstc->u32Base, BTIM_TypeDef, CR) == u32Addr)
+    {
+        u32Cr = u32Old;
+    }
+    HOST_RegWrite(u32Addr, u32New);
+    HostBtimRestart(pstc, HostBtimCount(pstc, u32Cr));
+    return u32New;
+}
+
+/**
+ * @brief  BTIM ICR：写0清除IFR及AIFR中对应标志，读出全1
+ */
+static uint32_t HostBtimIcrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    stc_host_btim_t *pstc    = HostBtimFind(u32Addr);
+    uint32_t         u32Ifr  = HOST_REG(pstc->u32Base, BTIM_TypeDef, IFR);
+    uint32_t         u32Aifr = HOST_REG(pstc->u32Group, BTIM_TypeDef, AIFR);
+    uint32_t         u32Clr  = ~u32New & HOST_BTIM_IFR_W0C;
+
+    (void)u32Old;
+
+    HOST_RegWrite(u32Ifr, HOST_RegRead(u32Ifr) & ~u32Clr);
+    if (0u != (u32Clr & BTIM_IFR_UI_Msk))
+    {
+        HOST_RegWrite(u32Aifr, HOST_RegRead(u32Aifr) & ~pstc->u32AifrUi);
+    }
+    if (0u != (u32Clr & BTIM_IFR_TI_Msk))
+    {
+        HOST_RegWrite(u32Aifr, HOST_RegRead(u32Aifr) & ~(pstc->u32AifrUi << 1u));
+    }
+    return HOST_BTIM_IFR_W0C;
+}
+
+/**
+ * @brief  BTIM AICR：写0清除AIFR及对应单元IFR中的标志，读出全1
+ */
+static uint32_t HostBtimAicrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    stc_host_btim_t *pstc    = HostBtimFind(u32Addr);
+    uint32_t         u32Clr  = ~u32New & HOST_BTIM_AIFR_W0C;
+    uint32_t         u32Aifr = HOST_REG(pstc->u32Group, BTIM_TypeDef, AIFR);
+    uint32_t         u32Ifr;
+    uint32_t         i;
+
+    (void)u32Old;
+
+    HOST_RegWrite(u32Aifr, HOST_RegRead(u32Aifr) & ~u32Clr);
+    for (i = 0u; i < ARRAY_SZ(m_astcBtim); i++)
+    {
+        if (m_astcBtim[i].u32Group == pstc->u32Group)
+        {
+            u32Ifr = HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, IFR);
+            HOST_RegWrite(u32Ifr, HOST_RegRead(u32Ifr) & ~((u32Clr / m_astcBtim[i].u32AifrUi) & HOST_BTIM_IFR_W0C));
+        }
+    }
+    return HOST_BTIM_AIFR_W0C;
+}
+
+/**
+ * @brief  CTIM0/CTIM1在BTIM模式下的中断电平：组内任一单元IFR与IER同时置位
+ */
+static boolean_t HostBtimIrqLevel(uint32_t u32Group, uint32_t u32FunSel)
+{
+    uint32_t u32Ifr;
+    uint32_t u32Ier;
+    uint32_t i;
+
+    if (0u == (HOST_RegRead(HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, SYSCTRL1)) & u32FunSel))
+    {
+        return FALSE;
+    }
+    for (i = 0u; i < ARRAY_SZ(m_astcBtim); i++)
+    {
+        u32Ifr = HOST_RegRead(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, IFR));
+        u32Ier = HOST_RegRead(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, IER));
+        if ((m_astcBtim[i].u32Group == u32Group) && (0u != (u32Ifr & u32Ier & HOST_BTIM_IFR_W0C)))
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static boolean_t HostCtim0IrqLevel(void)
+{
+    return HostBtimIrqLevel(BTIM0_BASE, SYSCTRL_SYSCTRL1_CTIMER0_FUN_SEL_Msk);
+}
+
+static boolean_t HostCtim1IrqLevel(void)
+{
+    return HostBtimIrqLevel(BTIM3_BASE, SYSCTRL_SYSCTRL1_CTIMER1_FUN_SEL_Msk);
+}
+
+/**
+ * @brief  ATIM3模式1 PWC：CH0A（经TIMCPS选择LPUARTx RXD）边沿。起始边沿清零计数，结束边沿将计数值
+ *         存入CCR0A并置位CA0F，计数超出16位时同时置位UIF；单次测量在结束边沿后停止计数
+ */
+static void HostAtim3Edge(uint8_t u8Unit, uint8_t u8Level)
+{
+    static const uint8_t au8PrsShift[8u] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 8u};
+    uint32_t             u32M1cr  = HOST_RegRead(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, M1CR));
+    uint32_t             u32Mscr  = HOST_RegRead(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, MSCR));
+    uint32_t             u32Ts    = u32Mscr & ATIM3_MODE1_MSCR_TS_Msk;
+    uint32_t             u32Sel   = (HOST_RegRead(HOST_REG(GPIOAUX_BASE, GPIOAUX_TypeDef, TIMCPS)) & GPIOAUX_TIMCPS_ATIM3_C0A_Msk)
+                          >> GPIOAUX_TIMCPS_ATIM3_C0A_Pos;
+    uint32_t             u32Ifr   = HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, IFR);
+    uint8_t              u8Fall   = (0u == u8Level) ? 1u : 0u;
+    uint32_t             u32Edge1 = (0u != (u32M1cr & ATIM3_MODE1_M1CR_EDG1ST_Msk)) ? 1u : 0u;
+    uint32_t             u32Edge2 = (0u != (u32M1cr & ATIM3_MODE1_M1CR_EDG2ND_Msk)) ? 1u : 0u;
+    uint64_t             u64Ticks;
+
+    if ((ATIM3_M1_M1CR_WORK_MODE_PWC != (u32M1cr & ATIM3_MODE1_M1CR_MODE_Msk)) || (0u == (u32M1cr & ATIM3_MODE1_M1CR_CTEN_Msk))
+        || ((ATIM3_M1_MSCR_TS_CH0A_EDGE != u32Ts) && (ATIM3_M1_MSCR_TS_CH0A_FILTER != u32Ts))
+        || (0u != (u32Mscr & ATIM3_MODE1_MSCR_IA0S_Msk)) || (((uint32_t)u8Unit + 1u) != u32Sel))
+    {
+        return;
+    }
+
+    if (0u == m_stcAtim3.u8Phase)
+    {
+        if (u8Fall == u32Edge1)
+        {
+            m_stcAtim3.u8Phase  = 1u;
+            m_stcAtim3.u64Start = HOST_CycleGet();
+        }
+        return;
+    }
+    if (u8Fall != u32Edge2)
+    {
+        return;
+    }
+
+    u64Ticks = (HOST_CycleGet() - m_stcAtim3.u64Start)
+               >> au8PrsShift[(u32M1cr & ATIM3_MODE1_M1CR_PRS_Msk) >> ATIM3_MODE1_M1CR_PRS_Pos];
+    HOST_RegWrite(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, CCR0A), (uint32_t)(u64Ticks & 0xFFFFu));
+    HOST_RegWrite(u32Ifr, HOST_RegRead(u32Ifr) | ATIM3_MODE1_IFR_CA0F_Msk | ((u64Ticks > 0xFFFFu) ? ATIM3_MODE1_IFR_UIF_Msk : 0u));
+
+    if (0u != (u32M1cr & ATIM3_MODE1_M1CR_ONESHOT_Msk))
+    {
+        HOST_RegWrite(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, M1CR), u32M1cr & ~ATIM3_MODE1_M1CR_CTEN_Msk);
+        m_stcAtim3.u8Phase = 0u;
+    }
+    else
+    {
+        /* 周期测量（起始与结束边沿相同）时结束边沿即下一次的起始边沿 */
+        m_stcAtim3.u8Phase  = (u32Edge1 == u32Edge2) ? 1u : 0u;
+        m_stcAtim3.u64Start = HOST_CycleGet();
+    }
+}
+
+/**
+ * @brief  ATIM3 M1CR写：CTEN由0变1时重新等待起始边沿
+ */
+static uint32_t HostAtim3M1crWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    (void)u32Addr;
+
+    if ((0u == (u32Old & ATIM3_MODE1_M1CR_CTEN_Msk)) && (0u != (u32New & ATIM3_MODE1_M1CR_CTEN_Msk)))
+    {
+        m_stcAtim3.u8Phase = 0u;
+    }
+    return u32New;
+}
+
+/**
+ * @brief  ATIM3 ICLR：写0清除IFR中对应标志，读出全1
+ */
+static uint32_t HostAtim3IclrWrite(uint32_t u32Addr, uint32_t u32Old, uint32_t u32New)
+{
+    uint32_t u32Ifr = HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, IFR);
+
+    (void)u32Addr;
+    (void)u32Old;
+
+    HOST_RegWrite(u32Ifr, HOST_RegRead(u32Ifr) & ~(~u32New & HOST_ATIM3_IFR_W0C));
+    return HOST_ATIM3_IFR_W0C;
+}
+
+/**
+ * @brief  ATIM3模式1中断电平：CA0F与CR0.CIEA、UIF与M1CR.UIE
+ */
+static boolean_t HostAtim3IrqLevel(void)
+{
+    uint32_t u32M1cr = HOST_RegRead(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, M1CR));
+    uint32_t u32Ifr  = HOST_RegRead(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, IFR));
+    uint32_t u32Cr0  = HOST_RegRead(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, CR0));
+
+    if (ATIM3_M1_M1CR_WORK_MODE_PWC != (u32M1cr & ATIM3_MODE1_M1CR_MODE_Msk))
+    {
+        return FALSE;
+    }
+    return (((u32Ifr & ATIM3_MODE1_IFR_CA0F_Msk) && (u32Cr0 & ATIM3_MODE1_CR0_CIEA_Msk))
+            || ((u32Ifr & ATIM3_MODE1_IFR_UIF_Msk) && (u32M1cr & ATIM3_MODE1_M1CR_UIE_Msk)))
+               ? TRUE
+               : FALSE;
+}
+
+/**
+ * @brief  默认外设行为模型初始化（HOST_ModelReset中调用）
+ * @retval None
+ */
+void HOST_PeriphModelInit(void)
+{
+    uint32_t i;
+    uint32_t u32Base;
+
+    /* SYSCTRL：时钟立即稳定 */
+    HOST_RegHookSet(HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, RC48M_CR), HostClkStableRead, NULL);
+    HOST_RegHookSet(HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, RCL_CR), HostClkStableRead, NULL);
+    HOST_RegHookSet(HOST_REG(SYSCTRL_BASE, SYSCTRL_TypeDef, XTL_CR), HostClkStableRead, NULL);
+
+    /* FLASH：存储阵列编程/擦除，操作立即完成 */
+    HOST_RegRangeHookSet(0u, HOST_FLASH_SIZE, NULL, HostFlashArrayWrite);
+
+    HOST_RegHookSet(HOST_REG(RTC_BASE, RTC_TypeDef, CR1), NULL, HostRtcCr1Write);
+    HOST_RegHookSet(HOST_REG(IWDT_BASE, IWDT_TypeDef, KR), NULL, HostIwdtKrWrite);
+    HOST_RegHookSet(HOST_REG(TRNG_BASE, TRNG_TypeDef, CR), NULL, HostTrngCrWrite);
+
+    /* LPUART0/1 */
+    for (i = 0u; i < ARRAY_SZ(m_astcLpuart); i++)
+    {
+        m_astcLpuart[i].u8Shifting  = 0u;
+        m_astcLpuart[i].u8Holding   = 0u;
+        m_astcLpuart[i].u16TxBit8   = 0u;
+        m_astcLpuart[i].u64SbufRead = UINT64_MAX - 1u;
+        m_astcLpuart[i].u8WaveBusy  = 0u;
+        m_astcLpuart[i].u8RxBusy    = 0u;
+        memset(m_astcLpuart[i].au32WaveBaud, 0, sizeof(m_astcLpuart[i].au32WaveBaud));
+        HOST_RegWrite(HOST_REG(m_astcLpuart[i].u32Base, LPUART_TypeDef, ISR), LPUART_ISR_TXE_Msk);
+        HOST_RegWrite(HOST_REG(m_astcLpuart[i].u32Base, LPUART_TypeDef, ICR), HOST_LPUART_ISR_W0C);
+        HOST_RegWrite(HOST_REG(m_astcLpuart[i].u32Base, LPUART_TypeDef, MODU), 0x54Au);
+        HOST_RegHookSet(HOST_REG(m_astcLpuart[i].u32Base, LPUART_TypeDef, SBUF), HostLpuartSbufRead, HostLpuartSbufWrite);
+        HOST_RegHookSet(HOST_REG(m_astcLpuart[i].u32Base, LPUART_TypeDef, ICR), NULL, HostLpuartIcrWrite);
+    }
+    HOST_IrqLevelSet((int32_t)LPUART0_IRQn, HostLpuart0IrqLevel);
+    HOST_IrqLevelSet((int32_t)LPUART1_IRQn, HostLpuart1IrqLevel);
+    m_pfnLpuartTx = NULL;
+
+    /* SPI */
+    memset(&m_stcSpi, 0, sizeof(m_stcSpi));
+    m_pfnSpiDevice = HostSpiLoopback;
+    HOST_RegWrite(HOST_REG(SPI_BASE, SPI_TypeDef, SR), SPI_SR_TXE_Msk | SPI_SR_SSLVL_Msk);
+    HOST_RegWrite(HOST_REG(SPI_BASE, SPI_TypeDef, ICR), HOST_SPI_SR_W0C);
+    HOST_RegHookSet(HOST_REG(SPI_BASE, SPI_TypeDef, CR0), NULL, HostSpiCr0Write);
+    HOST_RegHookSet(HOST_REG(SPI_BASE, SPI_TypeDef, DR), HostSpiDrRead, HostSpiDrWrite);
+    HOST_RegHookSet(HOST_REG(SPI_BASE, SPI_TypeDef, ICR), NULL, HostSpiIcrWrite);
+    HOST_IrqLevelSet((int32_t)SPI_IRQn, HostSpiIrqLevel);
+
+    /* GPIO端口中断 */
+    HOST_RegWrite(HOST_REG(GPIOA_BASE, GPIO_TypeDef, ICLR), HOST_GPIO_STAT_W0C);
+    HOST_RegWrite(HOST_REG(GPIOB_BASE, GPIO_TypeDef, ICLR), HOST_GPIO_STAT_W0C);
+    HOST_RegHookSet(HOST_REG(GPIOA_BASE, GPIO_TypeDef, ICLR), NULL, HostGpioIclrWrite);
+    HOST_RegHookSet(HOST_REG(GPIOB_BASE, GPIO_TypeDef, ICLR), NULL, HostGpioIclrWrite);
+    HOST_IrqLevelSet((int32_t)PORTA_IRQn, HostPortAIrqLevel);
+    HOST_IrqLevelSet((int32_t)PORTB_IRQn, HostPortBIrqLevel);
+
+    /* GPIO输出 */
+    m_pfnGpioOut = NULL;
+    for (i = 0u; i < 2u; i++)
+    {
+        u32Base = (0u == i) ? GPIOA_BASE : GPIOB_BASE;
+        HOST_RegHookSet(HOST_REG(u32Base, GPIO_TypeDef, OUT), NULL, HostGpioOutWrite);
+        HOST_RegHookSet(HOST_REG(u32Base, GPIO_TypeDef, BSET), NULL, HostGpioBitWrite);
+        HOST_RegHookSet(HOST_REG(u32Base, GPIO_TypeDef, BCLR), NULL, HostGpioBitWrite);
+        HOST_RegHookSet(HOST_REG(u32Base, GPIO_TypeDef, BSETCLR), NULL, HostGpioBitWrite);
+    }
+
+    /* BTIM0~5（CTIM0/CTIM1的BTIM模式） */
+    for (i = 0u; i < ARRAY_SZ(m_astcBtim); i++)
+    {
+        m_astcBtim[i].u8Running  = 0u;
+        m_astcBtim[i].u32CntBase = 0u;
+        m_astcBtim[i].u64Start   = 0u;
+        HOST_RegWrite(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, ICR), HOST_BTIM_IFR_W0C);
+        HOST_RegWrite(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, AICR), HOST_BTIM_AIFR_W0C);
+        HOST_RegHookSet(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, CNT), HostBtimCntRead, HostBtimCntWrite);
+        HOST_RegHookSet(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, CR), NULL, HostBtimCfgWrite);
+        HOST_RegHookSet(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, ARR), NULL, HostBtimCfgWrite);
+        HOST_RegHookSet(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, ICR), NULL, HostBtimIcrWrite);
+        HOST_RegHookSet(HOST_REG(m_astcBtim[i].u32Base, BTIM_TypeDef, AICR), NULL, HostBtimAicrWrite);
+    }
+    HOST_IrqLevelSet((int32_t)CTIM0_IRQn, HostCtim0IrqLevel);
+    HOST_IrqLevelSet((int32_t)CTIM1_IRQn, HostCtim1IrqLevel);
+
+    /* ATIM3模式1 PWC */
+    m_stcAtim3.u8Phase = 0u;
+    HOST_RegWrite(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, ICLR), HOST_ATIM3_IFR_W0C);
+    HOST_RegHookSet(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, M1CR), NULL, HostAtim3M1crWrite);
+    HOST_RegHookSet(HOST_REG(ATIM3_MODE1_BASE, ATIM3_MODE1_TypeDef, ICLR), NULL, HostAtim3IclrWrite);
+    HOST_IrqLevelSet((int32_t)ATIM3_IRQn, HostAtim3IrqLevel);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
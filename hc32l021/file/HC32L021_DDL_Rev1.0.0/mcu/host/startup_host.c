@@ -0,0 +1,167 @@
+/**
+ *******************************************************************************
+ * @file  startup_host.c
+ * @brief Host (Linux) startup of the register-model build: vector table and
+ *        model/system initialization before main()
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       MADS            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2024, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "ddl.h"
+
+/**
+ * @addtogroup HC32L021_DDL 驱动库
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_HOST HOST寄存器模型
+ * @{
+ */
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+extern void HardFault_Handler(void);
+extern void SysTick_Handler(void);
+extern void PORTA_IRQHandler(void);
+extern void PORTB_IRQHandler(void);
+extern void ATIM3_IRQHandler(void);
+extern void LPUART0_IRQHandler(void);
+extern void LPUART1_IRQHandler(void);
+extern void SPI_IRQHandler(void);
+extern void CTIM0_IRQHandler(void);
+extern void CTIM1_IRQHandler(void);
+extern void HSI2C_IRQHandler(void);
+extern void IWDT_IRQHandler(void);
+extern void RTC_IRQHandler(void);
+extern void ADC_IRQHandler(void);
+extern void VC0_IRQHandler(void);
+extern void VC1_IRQHandler(void);
+extern void LVD_IRQHandler(void);
+extern void FLASH_IRQHandler(void);
+extern void CTRIM_CLKDET_IRQHandler(void);
+
+void NMI_Handler(void);
+void SVC_Handler(void);
+void PendSV_Handler(void);
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/**
+ * @brief  中断向量表（与startup_hc32l021.s一致），由HOST_IrqDispatch()按异常号索引
+ */
+void (*const HOST_VectorTable[16u + HOST_IRQ_NUM])(void) = {
+    NULL,                    /* Top of Stack */
+    NULL,                    /* Reset */
+    NMI_Handler,             /* NMI */
+    HardFault_Handler,       /* Hard Fault */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    SVC_Handler,             /* SVCall */
+    NULL,                    /* Reserved */
+    NULL,                    /* Reserved */
+    PendSV_Handler,          /* PendSV */
+    SysTick_Handler,         /* SysTick */
+    PORTA_IRQHandler,        /* 0 */
+    PORTB_IRQHandler,        /* 1 */
+    NULL,                    /* 2 */
+    NULL,                    /* 3 */
+    NULL,                    /* 4 */
+    ATIM3_IRQHandler,        /* 5 */
+    NULL,                    /* 6 */
+    NULL,                    /* 7 */
+    LPUART0_IRQHandler,      /* 8 */
+    LPUART1_IRQHandler,      /* 9 */
+    SPI_IRQHandler,          /* 10 */
+    NULL,                    /* 11 */
+    NULL,                    /* 12 */
+    NULL,                    /* 13 */
+    CTIM0_IRQHandler,        /* 14 */
+    CTIM1_IRQHandler,        /* 15 */
+    NULL,                    /* 16 */
+    NULL,                    /* 17 */
+    HSI2C_IRQHandler,        /* 18 */
+    NULL,                    /* 19 */
+    NULL,                    /* 20 */
+    NULL,                    /* 21 */
+    IWDT_IRQHandler,         /* 22 */
+    RTC_IRQHandler,          /* 23 */
+    ADC_IRQHandler,          /* 24 */
+    NULL,                    /* 25 */
+    VC0_IRQHandler,          /* 26 */
+    VC1_IRQHandler,          /* 27 */
+    LVD_IRQHandler,          /* 28 */
+    NULL,                    /* 29 */
+    FLASH_IRQHandler,        /* 30 */
+    CTRIM_CLKDET_IRQHandler, /* 31 */
+};
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+__WEAK void NMI_Handler(void)
+{
+    ;
+}
+
+__WEAK void SVC_Handler(void)
+{
+    ;
+}
+
+__WEAK void PendSV_Handler(void)
+{
+    ;
+}
+
+/**
+ * @brief  main()之前建立寄存器模型并调用SystemInit()（对应目标板的Reset_Handler）
+ * @retval None
+ */
+__attribute__((constructor)) static void HOST_ResetHandler(void)
+{
+    HOST_ModelInit();
+    SystemInit();
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/